@@ -7,6 +7,9 @@ import os
 import subprocess
 import re
 import shutil
+import filecmp
+import hashlib
+import concurrent.futures
 
 
 def UniqueQuartet(q):
@@ -29,6 +32,216 @@ def QStr(q):
   return "( {} {} | {} {} )".format(q[0], q[1], q[2], q[3])
 
 
+def ReadOptionTable(path):
+  # Each line is an AM quartet followed by generator options
+  # for that quartet, ie
+  #   2 2 2 2 -ve 0 -vg 99 -he 99 -hg 99
+  # Comments start with #
+  table = {}
+  for line in open(path, 'r').readlines():
+    line = line.split('#')[0].split()
+    if len(line) == 0:
+      continue
+    if len(line) < 4 or len(line) % 2 != 0:
+      print("Bad line in option table {}: {}".format(path, ' '.join(line)))
+      quit(1)
+
+    q = tuple(int(x) for x in line[:4])
+    table[q] = dict(zip(line[4::2], line[5::2]))
+  return table
+
+
+def QuartetOptions(q):
+  # Options for the ostei generators for a particular quartet.
+  # Quartets not in the table use the entry for the quartet they
+  # are permuted from (if any), then the options given to this script.
+  # This is the same as OptionsForQuartet in the generator
+  opts = { "-ve": str(args.ve), "-vg": str(args.vg), "-he": str(args.he), "-hg": str(args.hg) }
+
+  canonical = (max(q[0], q[1]), min(q[0], q[1]), max(q[2], q[3]), min(q[2], q[3]))
+  if q in option_table:
+    opts.update(option_table[q])
+  elif canonical in option_table:
+    opts.update(option_table[canonical])
+
+  ret = []
+  for k in ["-ve", "-vg", "-he", "-hg"]:
+    ret.extend([k, opts[k]])
+  return ret
+
+
+class GeneratorJob:
+  # A single run of a generator program. The outputs (source, header
+  # fragment and log) are stored in the cache, in a directory named by
+  # a hash of the generator binary and the arguments that affect the
+  # output (AM, options, ...). The output paths are not part of the key.
+  #
+  # qopts are the options for this quartet from the per-quartet option
+  # table. They are part of the key, while the table itself is given
+  # to the generator (-qo)
+  def __init__(self, generator, genargs, filebase, destdir, log_stderr, q = None, permute = False, qopts = []):
+    self.generator = generator
+    self.genargs = genargs
+    self.qoargs = table_opts if qopts else []
+    self.filebase = filebase
+    self.destdir = destdir
+    self.log_stderr = log_stderr
+    self.q = q
+    self.permute = permute
+
+    self.cachedir = os.path.join(cachedir, CacheKey(generator, genargs + qopts))
+    self.outfile = os.path.join(self.cachedir, filebase + ".c")
+    self.hpart = os.path.join(self.cachedir, filebase + ".h.part")
+    self.logfile = os.path.join(self.cachedir, filebase + ".log")
+    self.donefile = os.path.join(self.cachedir, "done")
+
+  def Cached(self):
+    return os.path.isfile(self.donefile)
+
+  def Prepare(self):
+    # remove anything left over from an interrupted run
+    shutil.rmtree(self.cachedir, ignore_errors=True)
+    os.makedirs(self.cachedir)
+
+  def Cmdline(self):
+    return [self.generator] + self.genargs + self.qoargs + ["-o", self.outfile, "-oh", self.hpart]
+
+  def Finish(self):
+    # Only now is the cache entry complete
+    open(self.donefile, 'w').close()
+
+  def Install(self):
+    shutil.copyfile(self.outfile, os.path.join(self.destdir, self.filebase + ".c"))
+    shutil.copyfile(self.logfile, os.path.join(self.destdir, self.filebase + ".log"))
+
+
+generator_hashes = {}
+
+def CacheKey(generator, genargs):
+  if not generator in generator_hashes:
+    h = hashlib.sha256()
+    with open(generator, 'rb') as f:
+      h.update(f.read())
+    generator_hashes[generator] = h.hexdigest()
+
+  h = hashlib.sha256()
+  h.update(generator_hashes[generator].encode())
+  h.update(' '.join([os.path.basename(generator)] + genargs).encode())
+  return h.hexdigest()
+
+
+def RunGenerator(job):
+  job.Prepare()
+  with open(job.logfile, 'w') as lf:
+    return subprocess.call(job.Cmdline(), stdout=lf, stderr=(lf if job.log_stderr else None))
+
+
+def RunGenerators(jobs, headerfile, what, errcode, njobs):
+  # Runs up to njobs generators at a time. Each generator writes
+  # its declarations to its own header fragment (hpart), and these
+  # are appended to the header file in the order of the jobs list,
+  # so the output does not depend on the order the jobs finish in.
+  # Jobs whose output is already in the cache are not run.
+  torun = [ job for job in jobs if not job.Cached() ]
+  print("{}: {} of {} generator jobs found in cache".format(what, len(jobs)-len(torun), len(jobs)))
+
+  with concurrent.futures.ThreadPoolExecutor(max_workers=njobs) as ex:
+    rets = list(ex.map(RunGenerator, torun))
+
+  for job, ret in zip(torun, rets):
+    CheckGeneratorReturn(ret, what, errcode)
+    job.Finish()
+
+  InstallJobs(jobs, headerfile)
+
+
+def RunMultiGenerator(multigen, deriv, jobs, headerfile, logfile, what, errcode, njobs, cmdopts):
+  # Same as RunGenerators, but all the quartets are generated
+  # by a single ostei_multi_generator process (with njobs threads).
+  torun = [ job for job in jobs if not job.Cached() ]
+  print("{}: {} of {} generator jobs found in cache".format(what, len(jobs)-len(torun), len(jobs)))
+
+  if len(torun) > 0:
+    jobfile = logfile + ".jobs"
+    with open(jobfile, 'w') as jf:
+      for job in torun:
+        job.Prepare()
+        q = job.q
+        jf.write("{} {} {} {} {} {} {} {}\n".format(q[0], q[1], q[2], q[3], int(job.permute),
+                                                    job.outfile, job.hpart, job.logfile))
+
+    cmdline = [multigen, "-d", str(deriv), "-j", str(njobs), "-f", jobfile]
+    cmdline.extend(cmdopts)
+
+    print()
+    print("Command line:")
+    print(' '.join(cmdline))
+    print()
+
+    with open(logfile, 'w') as lf:
+      ret = subprocess.call(cmdline, stdout=lf, stderr=lf)
+
+    CheckGeneratorReturn(ret, what, errcode)
+    os.remove(jobfile)
+
+    for job in torun:
+      job.Finish()
+
+  InstallJobs(jobs, headerfile)
+
+
+def CheckGeneratorReturn(ret, what, errcode):
+  if ret != 0:
+    print("\n")
+    print("*********************************")
+    print("While generating {}".format(what))
+    print("Subprocess returned {} - aborting".format(ret))
+    print("*********************************")
+    print("\n")
+    quit(errcode)
+
+
+def InstallJobs(jobs, headerfile):
+  # Copy the sources and logs from the cache, and
+  # append the header fragments to the header file
+  with open(headerfile, 'a') as hfile:
+    for job in jobs:
+      job.Install()
+      with open(job.hpart, 'r') as hf:
+        hfile.write(hf.read())
+
+
+def SyncTree(src, dst):
+  # Make dst the same as src. Files whose contents have not changed
+  # are not touched, so they keep their modification times and the
+  # build system does not rebuild them. Returns the number of files
+  # that were written
+  nwritten = 0
+  os.makedirs(dst, exist_ok=True)
+
+  for dirpath, dirnames, filenames in os.walk(src):
+    dstdir = os.path.join(dst, os.path.relpath(dirpath, src))
+    os.makedirs(dstdir, exist_ok=True)
+    for f in filenames:
+      srcfile = os.path.join(dirpath, f)
+      dstfile = os.path.join(dstdir, f)
+      if not os.path.isfile(dstfile) or not filecmp.cmp(srcfile, dstfile, shallow=False):
+        shutil.copy(srcfile, dstfile)
+        nwritten += 1
+
+  # remove anything not in src
+  for dirpath, dirnames, filenames in os.walk(dst, topdown=False):
+    srcdir = os.path.join(src, os.path.relpath(dirpath, dst))
+    for f in filenames:
+      if not os.path.isfile(os.path.join(srcdir, f)):
+        os.remove(os.path.join(dirpath, f))
+    for d in dirnames:
+      if not os.path.isdir(os.path.join(srcdir, d)):
+        shutil.rmtree(os.path.join(dirpath, d), ignore_errors=True)
+
+  return nwritten
+
+
 
 # path to this file
 thisfile = os.path.realpath(__file__)
@@ -46,6 +259,12 @@ parser.add_argument("-vg", required=False, type=int, default=0, help="General VR
 parser.add_argument("-he", required=False, type=int, default=0, help="External HRR for this L value and above")
 parser.add_argument("-hg", required=False, type=int, default=0, help="General HRR for this L value and above")
 parser.add_argument("-d", required=False, type=int, default=0, help="Maximum derivative to generate code for")
+parser.add_argument("-j", required=False, type=int, default=1, help="Number of generator programs to run at once")
+parser.add_argument("-f", required=False, action='store_true', help="Also generate single-precision (float) ostei kernels")
+parser.add_argument("-df", required=False, action='store_true', help="Also generate 3- and 2-center ostei kernels (for density fitting)")
+parser.add_argument("-m", required=False, action='store_true', help="Generate all ostei quartets from a single process (ostei_multi_generator)")
+parser.add_argument("-t", required=False, type=str, default=None, help="File with per-quartet generator options (see tune.py)")
+parser.add_argument("-c", required=False, type=str, default=None, help="Cache directory for generated sources (default: <outdir>/.generator_cache)")
 parser.add_argument("outdir", type=str, help="Output directory")
 
 args = parser.parse_args()
@@ -66,6 +285,7 @@ ostei_gen = os.path.join(args.g, "ostei_generator")
 ostei_deriv1_gen = os.path.join(args.g, "ostei_deriv1_generator")
 hrr_gen = os.path.join(args.g, "ostei_hrr_generator")
 vrr_gen = os.path.join(args.g, "ostei_vrr_generator")
+multi_gen = os.path.join(args.g, "ostei_multi_generator")
 
 if not os.path.isfile(ostei_gen):
   print("The file \"{}\" does not exist or is not a (binary) file".format(ostei_gen))
@@ -83,35 +303,62 @@ if not os.path.isfile(vrr_gen):
   print("The file \"{}\" does not exist or is not a (binary) file".format(vrr_gen))
   quit(1)
 
+if args.m and not os.path.isfile(multi_gen):
+  print("The file \"{}\" does not exist or is not a (binary) file".format(multi_gen))
+  quit(1)
+
+# options common to all the ostei generators
+ostei_opts = ["-ve", str(args.ve), "-vg", str(args.vg), "-he", str(args.he), "-hg", str(args.hg)]
+
+# per-quartet options
+option_table = {}
+table_opts = []
+if args.t:
+  option_table = ReadOptionTable(args.t)
+  table_opts = ["-qo", os.path.abspath(args.t)]
+
+
+# Generated sources are kept here, and reused if the generator
+# and its arguments have not changed
+cachedir = args.c
+if cachedir is None:
+  cachedir = os.path.join(args.outdir, ".generator_cache")
+cachedir = os.path.abspath(cachedir)
+
 
 ####################################################
 # Create output directory
+#
+# Everything is first written to a staging directory,
+# which is then synced to the real output directory,
+# only writing files that have changed.
 ####################################################
-outdir = os.path.join(args.outdir, "simint")
-outdir_test = os.path.join(args.outdir, "test")
-outdir_examples = os.path.join(args.outdir, "examples")
-outdir_cmake = os.path.join(args.outdir, "cmake")
+stagedir = os.path.join(args.outdir, ".staging")
+
+outdir = os.path.join(stagedir, "simint")
+outdir_test = os.path.join(stagedir, "test")
+outdir_examples = os.path.join(stagedir, "examples")
+outdir_cmake = os.path.join(stagedir, "cmake")
 
 outdir_ostei = os.path.join(outdir, "ostei")
 outdir_osteigen = os.path.join(outdir_ostei, "gen")
 outdir_vec = os.path.join(outdir, "vectorization")
 
 if os.path.isdir(args.outdir):
-  print("WARNING - output directory exists. Overwriting...")
-  shutil.rmtree(outdir, ignore_errors=True)
-  shutil.rmtree(outdir_test, ignore_errors=True)
-  shutil.rmtree(outdir_examples, ignore_errors=True)
-  shutil.rmtree(outdir_cmake, ignore_errors=True)
+  print("WARNING - output directory exists. Only changed files will be overwritten...")
+
+shutil.rmtree(stagedir, ignore_errors=True)
+os.makedirs(cachedir, exist_ok=True)
 
 
 shutil.copytree(os.path.join(skeldir, "simint"),            outdir)
 shutil.copytree(os.path.join(skeldir, "test"),              outdir_test)
 shutil.copytree(os.path.join(skeldir, "examples"),          outdir_examples)
 shutil.copytree(os.path.join(skeldir, "cmake"),             outdir_cmake)
-shutil.copy(os.path.join(skeldir, "CMakeLists.txt"),        args.outdir)
-shutil.copy(os.path.join(skeldir, "README"),                args.outdir)
-shutil.copy(os.path.join(skeldir, "LICENSE"),               args.outdir)
-shutil.copy(os.path.join(skeldir, "CHANGELOG"),             args.outdir)
+shutil.copy(os.path.join(skeldir, "CMakeLists.txt"),        stagedir)
+shutil.copy(os.path.join(skeldir, "README"),                stagedir)
+shutil.copy(os.path.join(skeldir, "LICENSE"),               stagedir)
+shutil.copy(os.path.join(skeldir, "CHANGELOG"),             stagedir)
 
 # We need to create the ostei/gen directory, which
 # is empty and therefore not included in the git
@@ -145,7 +392,7 @@ for i in range(0, maxam + 1):
 
 print()
 print("Valid: {}".format(len(valid)))
-for q in valid:
+for q in sorted(valid):
   print("  {}".format(QStr(q)))
 
 print()
@@ -162,6 +409,10 @@ worksize_bcont = [[0]*(maxam+1) for _ in range(derorder+1)]
 worksize_cont  = [[0]*(maxam+1) for _ in range(derorder+1)]
 worksize_prim  = [[0]*(maxam+1) for _ in range(derorder+1)]
 
+# Work required by each quartet that was generated
+# Values are (bcont, prim, cont)
+worksize_quartet = [{} for _ in range(derorder+1)]
+
 # Required external HRR and VRR
 reqext_hrr = []
 reqext_vrr = []
@@ -193,7 +444,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("\n")
 
 
-for q in valid:
+jobs = []
+for q in sorted(valid):
   filebase = "ostei_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
   outfile = os.path.join(outdir_osteigen, filebase + ".c")
   logfile = os.path.join(outdir_osteigen, filebase + ".log")
@@ -202,35 +454,36 @@ for q in valid:
   print("      Output: {}".format(outfile))
   print("     Logfile: {}".format(logfile))
 
-  with open(logfile, 'w') as lf:
-    cmdline = [ostei_gen];
-    cmdline.extend(["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])])
-    cmdline.extend(["-o", outfile])
-    cmdline.extend(["-oh", headerfile])
-    cmdline.extend(["-ve", str(args.ve)]) 
-    cmdline.extend(["-vg", str(args.vg)]) 
-    cmdline.extend(["-he", str(args.he)]) 
-    cmdline.extend(["-hg", str(args.hg)]) 
+  genargs = ["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])]
+  genargs.extend(ostei_opts)
+  qopts = QuartetOptions(q) if args.t else []
 
-    if max(q) >= args.p:
-        cmdline.append("-p")
+  if max(q) >= args.p:
+      genargs.append("-p")
+
+  if args.m:
+    multiargs = ["-d", "0"] + genargs
+    jobs.append(GeneratorJob(multi_gen, multiargs, filebase, outdir_osteigen, True, q, max(q) >= args.p, qopts))
+  else:
+    job = GeneratorJob(ostei_gen, genargs, filebase, outdir_osteigen, True, qopts = qopts)
+    jobs.append(job)
 
     print()
     print("Command line:")
-    print(' '.join(cmdline))
+    print(' '.join(job.Cmdline()))
     print()
 
-    ret = subprocess.call(cmdline, stdout=lf, stderr=lf)
+if args.m:
+  RunMultiGenerator(multi_gen, 0, jobs, headerfile,
+                    os.path.join(cachedir, "ostei_multi.log"),
+                    "ostei", 5, args.j, ostei_opts + table_opts)
+else:
+  RunGenerators(jobs, headerfile, "ostei", 5, args.j)
 
-    if ret != 0:
-      print("\n")
-      print("*********************************")
-      print("While generating ostei")
-      print("Subprocess returned {} - aborting".format(ret))
-      print("*********************************")
-      print("\n")
-      quit(5)
 
+for q in sorted(valid):
+  filebase = "ostei_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+  logfile = os.path.join(outdir_osteigen, filebase + ".log")
 
   # reopen the logfile, find work and requirements
   for line in open(logfile, 'r').readlines():
@@ -239,6 +492,7 @@ for q in valid:
       worksize_bcont[0][mq] = max(worksize_bcont[0][mq], int(line.split()[2]))
       worksize_prim[0][mq] = max(worksize_prim[0][mq], int(line.split()[3]))
       worksize_cont[0][mq] = max(worksize_cont[0][mq], int(line.split()[4]))
+      worksize_quartet[0][q] = tuple(int(x) for x in line.split()[2:5])
     elif line.startswith("SIMINT EXTERNAL HRR"):
       reqam = tuple(line.split()[3:])
       reqext_hrr.append(reqam)
@@ -269,6 +523,216 @@ with open(headerfile, 'a') as hfile:
 shutil.copy(os.path.join(skeldir, "ostei_s_s_s_s.c"), outdir_osteigen)
 print("***** Overwrite <OUTDIR>\simint\ostei\gen\ostei_s_s_s_s.c with skel\ostei_s_s_s_s.c *****")
 
+
+####################################################
+# Generate the float (single precision) ERI sources
+# and headers. These are the same quartets as above
+####################################################
+if args.f:
+  print("-------------------------------")
+  print("Generating float ERI")
+  print("Maximum AM: {}".format(maxam))
+  print("-------------------------------")
+
+  headerbase = "ostei_float_generated.h"
+  headerfile = os.path.join(outdir_osteigen, headerbase)
+
+  print()
+  print("Header file: {}".format(headerfile))
+  print()
+
+  # Start the header file
+  with open(headerfile, 'w') as hfile:
+    hfile.write("#pragma once\n\n")
+    hfile.write("\n\n")
+    hfile.write("#include \"simint/ostei/gen/ostei_generated.h\"\n")
+
+    hfile.write("\n")
+    hfile.write("#ifdef __cplusplus\n")
+    hfile.write("extern \"C\" {\n")
+    hfile.write("#endif\n")
+    hfile.write("\n")
+
+
+  jobs = []
+  for q in sorted(valid):
+    filebase = "ostei_flt_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+    outfile = os.path.join(outdir_osteigen, filebase + ".c")
+    logfile = os.path.join(outdir_osteigen, filebase + ".log")
+    filelists[0][max(q)].append(filebase + ".c")
+    print("Creating: {}".format(filebase))
+    print("      Output: {}".format(outfile))
+    print("     Logfile: {}".format(logfile))
+
+    genargs = ["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3]), "-flt"]
+    genargs.extend(ostei_opts)
+    qopts = QuartetOptions(q) if args.t else []
+
+    if max(q) >= args.p:
+        genargs.append("-p")
+
+    if args.m:
+      multiargs = ["-d", "0"] + genargs
+      jobs.append(GeneratorJob(multi_gen, multiargs, filebase, outdir_osteigen, True, q, max(q) >= args.p, qopts))
+    else:
+      job = GeneratorJob(ostei_gen, genargs, filebase, outdir_osteigen, True, qopts = qopts)
+      jobs.append(job)
+
+      print()
+      print("Command line:")
+      print(' '.join(job.Cmdline()))
+      print()
+
+  if args.m:
+    RunMultiGenerator(multi_gen, 0, jobs, headerfile,
+                      os.path.join(cachedir, "ostei_float_multi.log"),
+                      "ostei_float", 5, args.j, ostei_opts + table_opts + ["-flt"])
+  else:
+    RunGenerators(jobs, headerfile, "ostei_float", 5, args.j)
+
+
+  for q in sorted(valid):
+    filebase = "ostei_flt_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+    logfile = os.path.join(outdir_osteigen, filebase + ".log")
+
+    # The float kernels use the same workspace as the double
+    # ones, so they must not need more. The VRR is always inline,
+    # but the HRR may be external.
+    for line in open(logfile, 'r').readlines():
+      mq = max(q)
+      if line.startswith("WORK SIZE"):
+        ws = tuple(int(x) for x in line.split()[2:5])
+        worksize_bcont[0][mq] = max(worksize_bcont[0][mq], ws[0])
+        worksize_prim[0][mq] = max(worksize_prim[0][mq], ws[1])
+        worksize_cont[0][mq] = max(worksize_cont[0][mq], ws[2])
+        worksize_quartet[0][q] = tuple(max(a, b) for a, b in zip(worksize_quartet[0][q], ws))
+      elif line.startswith("SIMINT EXTERNAL HRR"):
+        reqam = tuple(line.split()[3:])
+        reqext_hrr.append(reqam)
+        filelists[0][mq].append( "hrr_{}_{}_{}.c".format(reqam[0],
+                                                         amchar[int(reqam[1])],
+                                                         amchar[int(reqam[2])]) )
+
+    print()
+
+
+  # Close out the header file
+  with open(headerfile, 'a') as hfile:
+    hfile.write("#ifdef __cplusplus\n")
+    hfile.write("}\n")
+    hfile.write("#endif\n")
+    hfile.write("\n")
+
+
+####################################################
+# Generate the 3- and 2-center ERI sources and headers
+# The missing centers (second, and fourth for 2-center)
+# are s shells in the same quartets as above
+####################################################
+if args.df:
+  print("-------------------------------")
+  print("Generating 3- and 2-center ERI")
+  print("Maximum AM: {}".format(maxam))
+  print("-------------------------------")
+
+  headerbase = "ostei_df_generated.h"
+  headerfile = os.path.join(outdir_osteigen, headerbase)
+
+  print()
+  print("Header file: {}".format(headerfile))
+  print()
+
+  # Start the header file
+  with open(headerfile, 'w') as hfile:
+    hfile.write("#pragma once\n\n")
+    hfile.write("\n\n")
+    hfile.write("#include \"simint/ostei/gen/ostei_generated.h\"\n")
+
+    hfile.write("\n")
+    hfile.write("#ifdef __cplusplus\n")
+    hfile.write("extern \"C\" {\n")
+    hfile.write("#endif\n")
+    hfile.write("\n")
+
+
+  def DFFileBase(nc, q):
+    if nc == 2:
+      return "ostei_2c_{}_{}".format(amchar[q[0]], amchar[q[2]])
+    return "ostei_3c_{}_{}_{}".format(amchar[q[0]], amchar[q[2]], amchar[q[3]])
+
+  valid_df = { 3: sorted(q for q in valid if q[1] == 0),
+               2: sorted(q for q in valid if q[1] == 0 and q[3] == 0) }
+
+  for nc in [3, 2]:
+    jobs = []
+    for q in valid_df[nc]:
+      filebase = DFFileBase(nc, q)
+      outfile = os.path.join(outdir_osteigen, filebase + ".c")
+      logfile = os.path.join(outdir_osteigen, filebase + ".log")
+      filelists[0][max(q)].append(filebase + ".c")
+      print("Creating: {}".format(filebase))
+      print("      Output: {}".format(outfile))
+      print("     Logfile: {}".format(logfile))
+
+      genargs = ["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3]), "-nc", str(nc)]
+      genargs.extend(ostei_opts)
+      qopts = QuartetOptions(q) if args.t else []
+
+      if max(q) >= args.p:
+          genargs.append("-p")
+
+      if args.m:
+        multiargs = ["-d", "0"] + genargs
+        jobs.append(GeneratorJob(multi_gen, multiargs, filebase, outdir_osteigen, True, q, max(q) >= args.p, qopts))
+      else:
+        job = GeneratorJob(ostei_gen, genargs, filebase, outdir_osteigen, True, qopts = qopts)
+        jobs.append(job)
+
+        print()
+        print("Command line:")
+        print(' '.join(job.Cmdline()))
+        print()
+
+    what = "ostei_{}c".format(nc)
+    if args.m:
+      RunMultiGenerator(multi_gen, 0, jobs, headerfile,
+                        os.path.join(cachedir, what + "_multi.log"),
+                        what, 5, args.j, ostei_opts + table_opts + ["-nc", str(nc)])
+    else:
+      RunGenerators(jobs, headerfile, what, 5, args.j)
+
+
+    for q in valid_df[nc]:
+      logfile = os.path.join(outdir_osteigen, DFFileBase(nc, q) + ".log")
+
+      # These kernels are called through simint_compute_ostei_3c/2c with
+      # the workspace of the 4-center quartet, so must not need more.
+      # The VRR is always inline, but the HRR may be external.
+      for line in open(logfile, 'r').readlines():
+        mq = max(q)
+        if line.startswith("WORK SIZE"):
+          ws = tuple(int(x) for x in line.split()[2:5])
+          worksize_bcont[0][mq] = max(worksize_bcont[0][mq], ws[0])
+          worksize_prim[0][mq] = max(worksize_prim[0][mq], ws[1])
+          worksize_cont[0][mq] = max(worksize_cont[0][mq], ws[2])
+          worksize_quartet[0][q] = tuple(max(a, b) for a, b in zip(worksize_quartet[0][q], ws))
+        elif line.startswith("SIMINT EXTERNAL HRR"):
+          reqam = tuple(line.split()[3:])
+          reqext_hrr.append(reqam)
+          filelists[0][mq].append( "hrr_{}_{}_{}.c".format(reqam[0],
+                                                           amchar[int(reqam[1])],
+                                                           amchar[int(reqam[2])]) )
+
+      print()
+
+
+  # Close out the header file
+  with open(headerfile, 'a') as hfile:
+    hfile.write("#ifdef __cplusplus\n")
+    hfile.write("}\n")
+    hfile.write("#endif\n")
+    hfile.write("\n")
+
 ####################################################
 # Generate the ERI 1st derivative sources and headers
 ####################################################
@@ -300,7 +764,7 @@ for i in range(0, maxam1 + 1):
 
 print()
 print("Valid: {}".format(len(valid)))
-for q in valid:
+for q in sorted(valid):
   print("  {}".format(QStr(q)))
 
 print()
@@ -332,8 +796,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("\n")
 
 
-for q in valid:
-
+jobs = []
+for q in sorted(valid):
   filebase = "ostei_deriv1_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
   outfile = os.path.join(outdir_osteigen, filebase + ".c")
   logfile = os.path.join(outdir_osteigen, filebase + ".log")
@@ -342,35 +806,36 @@ for q in valid:
   print("      Output: {}".format(outfile))
   print("     Logfile: {}".format(logfile))
 
-  with open(logfile, 'w') as lf:
-    cmdline = [ostei_deriv1_gen];
-    cmdline.extend(["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])])
-    cmdline.extend(["-o", outfile])
-    cmdline.extend(["-oh", headerfile])
-    cmdline.extend(["-ve", str(args.ve)]) 
-    cmdline.extend(["-vg", str(args.vg)]) 
-    cmdline.extend(["-he", str(args.he)]) 
-    cmdline.extend(["-hg", str(args.hg)]) 
+  genargs = ["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])]
+  genargs.extend(ostei_opts)
+  qopts = QuartetOptions(q) if args.t else []
 
-    if max(q) >= args.p:
-        cmdline.append("-p")
+  if max(q) >= args.p:
+      genargs.append("-p")
+
+  if args.m:
+    multiargs = ["-d", "1"] + genargs
+    jobs.append(GeneratorJob(multi_gen, multiargs, filebase, outdir_osteigen, True, q, max(q) >= args.p, qopts))
+  else:
+    job = GeneratorJob(ostei_deriv1_gen, genargs, filebase, outdir_osteigen, True, qopts = qopts)
+    jobs.append(job)
 
     print()
     print("Command line:")
-    print(' '.join(cmdline))
+    print(' '.join(job.Cmdline()))
     print()
 
-    ret = subprocess.call(cmdline, stdout=lf, stderr=lf)
+if args.m:
+  RunMultiGenerator(multi_gen, 1, jobs, headerfile,
+                    os.path.join(cachedir, "ostei_deriv1_multi.log"),
+                    "ostei_deriv1", 5, args.j, ostei_opts + table_opts)
+else:
+  RunGenerators(jobs, headerfile, "ostei_deriv1", 5, args.j)
 
-    if ret != 0:
-      print("\n")
-      print("*********************************")
-      print("While generating ostei_deriv1")
-      print("Subprocess returned {} - aborting".format(ret))
-      print("*********************************")
-      print("\n")
-      quit(5)
 
+for q in sorted(valid):
+  filebase = "ostei_deriv1_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+  logfile = os.path.join(outdir_osteigen, filebase + ".log")
 
   # reopen the logfile, find work and requirements
   for line in open(logfile, 'r').readlines():
@@ -379,6 +844,7 @@ for q in valid:
       worksize_bcont[1][mq] = max(worksize_bcont[1][mq], int(line.split()[2]))
       worksize_prim[1][mq] = max(worksize_prim[1][mq], int(line.split()[3]))
       worksize_cont[1][mq] = max(worksize_cont[1][mq], int(line.split()[4]))
+      worksize_quartet[1][q] = tuple(int(x) for x in line.split()[2:5])
     elif line.startswith("SIMINT EXTERNAL HRR"):
       reqam = tuple(line.split()[3:])
       reqext_hrr.append(reqam)
@@ -420,6 +886,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("#define SIMINT_OSTEI_MAXAM @SIMINT_MAXAM@\n")
   hfile.write("#define SIMINT_OSTEI_MAXDER @SIMINT_MAXDER@\n")
   hfile.write("#define SIMINT_OSTEI_DERIV1_MAXAM (SIMINT_OSTEI_MAXDER > 0 ? @SIMINT_MAXAM@ : -1)\n")
+  hfile.write("#define SIMINT_OSTEI_FLOAT {}\n".format(1 if args.f else 0))
+  hfile.write("#define SIMINT_OSTEI_DF {}\n".format(1 if args.df else 0))
   hfile.write("\n\n")
 
   # A function for determining the max work size
@@ -445,6 +913,41 @@ with open(headerfile, 'w') as hfile:
   hfile.write("{\n")
   hfile.write("    return simint_ostei_worksize(derorder, maxam)*sizeof(double);\n")
   hfile.write("}\n\n")
+
+  # Work size for each individual quartet. Quartets that were not
+  # generated are computed by permuting one that was, and so need the
+  # same amount of work
+  hfile.write("static inline size_t simint_ostei_worksize_quartet(int derorder, int am1, int am2, int am3, int am4)\n")
+  hfile.write("{\n")
+  hfile.write("    static const size_t nelements[{}][{}][{}][{}][{}] = {{\n".format(derorder+1, maxam+1, maxam+1, maxam+1, maxam+1))
+
+  for d in range(0, derorder+1):
+    hfile.write("      {\n")
+    for i in range(0, maxam+1):
+      hfile.write("       {\n")
+      for j in range(0, maxam+1):
+        hfile.write("        {\n")
+        for k in range(0, maxam+1):
+          hfile.write("         {")
+          for l in range(0, maxam+1):
+            q = (i, j, k, l)
+            if not q in worksize_quartet[d]:
+              q = (max(i, j), min(i, j), max(k, l), min(k, l))
+            ws = worksize_quartet[d][q]
+            hfile.write(" (SIMINT_SIMD_ROUND(SIMINT_NSHELL_SIMD*{}) + SIMINT_SIMD_ROUND({}) + SIMINT_SIMD_LEN*{}),".format(ws[0], ws[2], ws[1]))
+          hfile.write(" },\n")
+        hfile.write("        },\n")
+      hfile.write("       },\n")
+    hfile.write("      },\n")
+
+  hfile.write("    };\n")
+  hfile.write("    return nelements[derorder][am1][am2][am3][am4];\n")
+  hfile.write("}\n\n")
+
+  hfile.write("static inline size_t simint_ostei_workmem_quartet(int derorder, int am1, int am2, int am3, int am4)\n")
+  hfile.write("{\n")
+  hfile.write("    return simint_ostei_worksize_quartet(derorder, am1, am2, am3, am4)*sizeof(double);\n")
+  hfile.write("}\n\n")
   hfile.write("\n")
 
 
@@ -484,7 +987,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("\n")
 
 
-for h in reqext_hrr:
+jobs = []
+for h in sorted(reqext_hrr):
     q = ( int(h[1]), int(h[2]) )
     filebase = "hrr_{}_{}_{}".format(h[0], amchar[q[0]], amchar[q[1]])
 
@@ -493,37 +997,27 @@ for h in reqext_hrr:
     print("Creating HRR: {}".format(filebase))
     print("      Output: {}".format(outfile))
     print("     Logfile: {}".format(logfile))
-    cmdline = [hrr_gen]
 
-    cmdline.extend(["-q", str(q[0]), str(q[1])])
-    cmdline.extend(["-o", outfile])
-    cmdline.extend(["-oh", headerfile])
+    genargs = ["-q", str(q[0]), str(q[1])]
 
     if h[0] == "I" or h[0] == "J":
-      cmdline.append("-bra")
+      genargs.append("-bra")
 
     if h[0] == "I":
-      cmdline.append("-bra_i")
+      genargs.append("-bra_i")
 
     if h[0] == "K":
-      cmdline.append("-ket_k")
+      genargs.append("-ket_k")
+
+    job = GeneratorJob(hrr_gen, genargs, filebase, outdir_osteigen, False)
+    jobs.append(job)
 
     print()
     print("Command line:")
-    print(' '.join(cmdline))
+    print(' '.join(job.Cmdline()))
     print()
 
-    with open(logfile, 'w') as lf:
-      ret = subprocess.call(cmdline, stdout=lf)
-
-    if ret != 0:
-      print("\n")
-      print("*********************************")
-      print("When generating hrr sources")
-      print("Subprocess returned {} - aborting".format(ret))
-      print("*********************************")
-      print("\n")
-      quit(1)
+RunGenerators(jobs, headerfile, "hrr sources", 1, args.j)
 
 # Close out the header file
 with open(headerfile, 'a') as hfile:
@@ -590,7 +1084,8 @@ with open(headerfile, 'w') as hfile:
   hfile.write("\n")
 
 
-for v in reqext_vrr:
+jobs = []
+for v in sorted(reqext_vrr):
     q = ( int(v[1]), int(v[2]), int(v[3]), int(v[4]))
     
     filebase = "vrr_{}_{}_{}_{}_{}".format(v[0], amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
@@ -601,37 +1096,27 @@ for v in reqext_vrr:
     print("     Logfile: {}".format(logfile))
 
 
-    with open(logfile, 'w') as lf:
-      cmdline = [vrr_gen]
-      cmdline.extend(["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])])
-      cmdline.extend(["-o", outfile])
-      cmdline.extend(["-oh", headerfile])
-
-      if v[0] == "J":
-        cmdline.append("-center_j");
-      if v[0] == "K":
-        cmdline.append("-center_k");
-      if v[0] == "L":
-        cmdline.append("-center_l");
+    genargs = ["-q", str(q[0]), str(q[1]), str(q[2]), str(q[3])]
 
-      print()
-      print("Command line:")
-      print(' '.join(cmdline))
-      print()
+    if v[0] == "J":
+      genargs.append("-center_j");
+    if v[0] == "K":
+      genargs.append("-center_k");
+    if v[0] == "L":
+      genargs.append("-center_l");
 
-      ret = subprocess.call(cmdline, stdout=lf)
+    job = GeneratorJob(vrr_gen, genargs, filebase, outdir_osteigen, False)
+    jobs.append(job)
 
-      if ret != 0:
-        print("\n")
-        print("*********************************")
-        print("When generating vrr sources")
-        print("Subprocess returned {} - aborting".format(ret))
-        print("*********************************")
-        print("\n")
-        quit(1)
+    print()
+    print("Command line:")
+    print(' '.join(job.Cmdline()))
+    print()
 
     print()
 
+RunGenerators(jobs, headerfile, "vrr sources", 1, args.j)
+
 # Close out the header file
 with open(headerfile, 'a') as hfile:
   hfile.write("\n")
@@ -668,3 +1153,21 @@ with open(os.path.join(outdir_cmake, "MaxAvailable.cmake"), 'w') as f:
     f.write("set(SIMINT_MAXAM_AVAILABLE {})\n".format(maxam))
 
 
+
+####################################################
+# Copy everything that changed to the output directory
+####################################################
+nwritten = 0
+for d in ["simint", "test", "examples", "cmake"]:
+  nwritten += SyncTree(os.path.join(stagedir, d), os.path.join(args.outdir, d))
+
+for f in ["CMakeLists.txt", "README", "LICENSE", "CHANGELOG"]:
+  dstfile = os.path.join(args.outdir, f)
+  if not os.path.isfile(dstfile) or not filecmp.cmp(os.path.join(stagedir, f), dstfile, shallow=False):
+    shutil.copy(os.path.join(stagedir, f), dstfile)
+    nwritten += 1
+
+shutil.rmtree(stagedir)
+
+print()
+print("{} files written to {}".format(nwritten, args.outdir))
@@ -76,6 +76,10 @@ std::vector<std::string> ParseCommonOptions(OptionMap & options, int argc, char
             options[Option::GeneralHRR] = GetIArg(i, argc, argv);
         else if(argstr == "-p")
             options[Option::FinalPermute] = 1;
+        else if(argstr == "-flt")
+            options[Option::Float] = 1;
+        else if(argstr == "-nc")
+            options[Option::Centers] = GetIArg(i, argc, argv);
         else
             ret.push_back(argstr);
     }
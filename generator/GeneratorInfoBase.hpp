@@ -8,6 +8,8 @@
 #ifndef SIMINT_GUARD_GENERATOR__GENERATORINFOBASE_HPP_
 #define SIMINT_GUARD_GENERATOR__GENERATORINFOBASE_HPP_
 
+#include <iostream>
+
 #include "generator/Types.hpp"
 #include "generator/Ncart.hpp"
 #include "generator/Options.hpp"
@@ -87,6 +89,25 @@ public:
         return GetOption(Option::FinalPermute);
     }
 
+    /*! \brief Stream for information about the generated code
+     *
+     * Work sizes, external requirements, etc, are written here
+     * and parsed later by create.py. Defaults to std::cout.
+     */
+    std::ostream & Log(void) const
+    {
+        return *log_;
+    }
+
+    /*! \brief Set the stream used for information about the generated code
+     *
+     * \param [in] log Stream to use. Must outlive this object (and any copies).
+     */
+    void SetLog(std::ostream & log)
+    {
+        log_ = &log;
+    }
+
 
 private:
     //! The requested AM quartet
@@ -100,6 +121,9 @@ private:
 
     //! Generate scalar code?
     bool scalar_;
+
+    //! Where information about the generated code goes
+    std::ostream * log_ = &std::cout;
 };
 
 
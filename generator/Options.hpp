@@ -19,6 +19,8 @@ enum class Option
     ExternalHRR,  //!< Write external HRR at this L value and above
     GeneralHRR,   //!< Write general HRR at this L value and above
     FinalPermute, //!< Generate code for permuting final integrals
+    Float,        //!< Compute primitives in single precision
+    Centers,      //!< Number of real centers (4, or 3 and 2 for density fitting)
 };
 
 
@@ -37,6 +39,8 @@ inline OptionMap DefaultOptions(void)
                       {Option::ExternalHRR, 0},
                       {Option::GeneralHRR, 0},
                       {Option::FinalPermute, 0},
+                      {Option::Float, 0},
+                      {Option::Centers, 4},
                     };
 }
 
@@ -0,0 +1,75 @@
+/*! \file
+ *
+ * \brief Per-quartet overrides of generator options (source)
+ * \author Benjamin Pritchard (ben@bennyp.org)
+ */
+
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <algorithm>
+
+#include "generator/QuartetOptions.hpp"
+#include "generator/StringBuilder.hpp"
+
+
+QuartetOptionMap ReadQuartetOptions(const std::string & path)
+{
+    static const std::map<std::string, Option> optnames{
+                                                         {"-ve", Option::ExternalVRR},
+                                                         {"-vg", Option::GeneralVRR},
+                                                         {"-he", Option::ExternalHRR},
+                                                         {"-hg", Option::GeneralHRR},
+                                                       };
+
+    std::ifstream f(path);
+    if(!f.is_open())
+        throw std::runtime_error(StringBuilder("Cannot open file: ", path, "\n"));
+
+    QuartetOptionMap qoptions;
+
+    std::string line;
+    while(std::getline(f, line))
+    {
+        line = line.substr(0, line.find('#'));
+
+        std::stringstream ss(line);
+        QAM am{0,0,0,0};
+        if(!(ss >> am[0] >> am[1] >> am[2] >> am[3]))
+            continue;
+
+        OptionMap & opt = qoptions[am];
+
+        std::string name;
+        while(ss >> name)
+        {
+            int value;
+            if(!optnames.count(name) || !(ss >> value))
+                throw std::runtime_error(StringBuilder("Bad option \"", name, "\" in ", path, "\n"));
+            opt[optnames.at(name)] = value;
+        }
+    }
+
+    return qoptions;
+}
+
+
+OptionMap OptionsForQuartet(const OptionMap & options, const QuartetOptionMap & qoptions, QAM am)
+{
+    QAM canonical{std::max(am[0], am[1]), std::min(am[0], am[1]),
+                  std::max(am[2], am[3]), std::min(am[2], am[3])};
+
+    auto it = qoptions.find(am.notag());
+    if(it == qoptions.end())
+        it = qoptions.find(canonical);
+
+    OptionMap ret(options);
+    if(it != qoptions.end())
+    {
+        for(const auto & opt : it->second)
+            ret[opt.first] = opt.second;
+    }
+
+    return ret;
+}
@@ -0,0 +1,53 @@
+/*! \file
+ *
+ * \brief Per-quartet overrides of generator options (header)
+ * \author Benjamin Pritchard (ben@bennyp.org)
+ */
+
+
+#ifndef SIMINT_GUARD_GENERATOR__QUARTETOPTIONS_HPP_
+#define SIMINT_GUARD_GENERATOR__QUARTETOPTIONS_HPP_
+
+#include <string>
+#include <map>
+
+#include "generator/Types.hpp"
+#include "generator/Options.hpp"
+
+
+/*! \brief Options that override the common options for particular AM quartets
+ *
+ * Only the options that are overridden are stored for each quartet.
+ */
+typedef std::map<QAM, OptionMap> QuartetOptionMap;
+
+
+/*! \brief Read per-quartet options from a file
+ *
+ * Each line contains an AM quartet followed by options and their values.
+ * Everything after a # is ignored. For example
+ *
+ *     2 2 2 2 -ve 0 -vg 99 -he 99 -hg 99   # comment
+ *
+ * \throw std::runtime_error if the file cannot be read or contains
+ *        unknown options
+ * \param [in] path Path to the file
+ */
+QuartetOptionMap ReadQuartetOptions(const std::string & path);
+
+
+/*! \brief Get the options to use for a particular AM quartet
+ *
+ * If \p am is not in \p qoptions, the entry for the quartet it would be
+ * permuted from (ie, ( 0 1 | 0 0 ) -> ( 1 0 | 0 0 )) is used. If that
+ * does not exist either, \p options is returned unchanged.
+ *
+ * \param [in] options Common options
+ * \param [in] qoptions Per-quartet overrides
+ * \param [in] am The AM quartet
+ * \return \p options with any overrides for \p am applied
+ */
+OptionMap OptionsForQuartet(const OptionMap & options, const QuartetOptionMap & qoptions, QAM am);
+
+
+#endif
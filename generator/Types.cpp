@@ -74,18 +74,56 @@ DoubletSet GenerateDoubletTargets(DAM am, DoubletType type)
 
 
 
-int GaussianOrder(const ExpList & ijk)
+namespace {
+
+/*! \brief Index of every gaussian in gindex_map, indexed directly by exponents
+ *
+ * GaussianOrder is called for almost every comparison of gaussians, so
+ * this avoids searching gindex_map each time.
+ */
+struct GaussianOrderTable
 {
-    int am = ijk[0] + ijk[1] + ijk[2];
+    int dim;
+    std::vector<int> order;
 
-    const std::vector<int> & v = gindex_map.at(am);
+    GaussianOrderTable(void)
+    {
+        dim = gindex_map.rbegin()->first + 1;
+        order.assign(dim*dim*dim, -1);
 
-    auto it = std::find(v.begin(), v.end(), HashExpList(ijk));
-    if(it == v.end())
+        for(const auto & it : gindex_map)
+        {
+            for(size_t n = 0; n < it.second.size(); n++)
+            {
+                // undo HashExpList
+                const int h = it.second[n];
+                const int i = (h >> 0x00) & 0xFF;
+                const int j = (h >> 0x08) & 0xFF;
+                const int k = (h >> 0x10) & 0xFF;
+                order[(i*dim + j)*dim + k] = static_cast<int>(n);
+            }
+        }
+    }
+};
+
+} // close anonymous namespace
+
+
+int GaussianOrder(const ExpList & ijk)
+{
+    // initialization of a static local is thread safe
+    static const GaussianOrderTable table;
+
+    const int dim = table.dim;
+    if(ijk[0] < 0 || ijk[1] < 0 || ijk[2] < 0 ||
+       ijk[0] >= dim || ijk[1] >= dim || ijk[2] >= dim)
         throw std::runtime_error("Gaussian not found in gindex_map");
 
-    return std::distance(v.begin(), it);
+    const int idx = table.order[(ijk[0]*dim + ijk[1])*dim + ijk[2]];
+    if(idx < 0)
+        throw std::runtime_error("Gaussian not found in gindex_map");
 
+    return idx;
 }
 
 
@@ -24,7 +24,7 @@ void OSTEIDeriv1_Writer::WriteShellOffsets(void) const
     os_ << indent6 << "// Handle if the first element of the vector is a new shell\n";
     os_ << indent6 << "if(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))\n";
     os_ << indent6 << "{\n";
-    os_ << indent7 << "nprim_icd += Q.nprim12[cd + (++icd)];\n";
+    os_ << indent7 << "nprim_icd += Q->nprim12[cd + (++icd)];\n";
 
     for(const auto it : hrr_writer_.Algo().TopAM())
         os_ << indent7 << PrimPtrName(it) << " += " << NCART(it) << ";\n";
@@ -38,7 +38,7 @@ void OSTEIDeriv1_Writer::WriteShellOffsets(void) const
     os_ << indent7 << "{\n";
     os_ << indent8 << "shelloffsets[n] = shelloffsets[n-1] + 1;\n";
     os_ << indent8 << "lastoffset++;\n";
-    os_ << indent8 << "nprim_icd += Q.nprim12[cd + (++icd)];\n";
+    os_ << indent8 << "nprim_icd += Q->nprim12[cd + (++icd)];\n";
     os_ << indent7 << "}\n";
     os_ << indent7 << "else\n";
     os_ << indent8 << "shelloffsets[n] = shelloffsets[n-1];\n";
@@ -50,6 +50,18 @@ void OSTEIDeriv1_Writer::WriteShellOffsets(void) const
 }
 
 
+void OSTEIDeriv1_Writer::WriteScreenedSkip(void) const
+{
+    // See OSTEI_Writer::WriteScreenedSkip
+    os_ << "\n";
+    os_ << indent7 << "// The rest of shell icd is insignificant, too\n";
+    os_ << indent7 << "if(nprim_icd >= (jend - jstart))\n";
+    os_ << indent8 << "break;\n";
+    os_ << indent7 << "iprimcd = (nprim_icd / SIMINT_SIMD_LEN) * SIMINT_SIMD_LEN;\n";
+    os_ << indent7 << "j = jstart + iprimcd - SIMINT_SIMD_LEN;\n";
+}
+
+
 void OSTEIDeriv1_Writer::WriteAccumulation(void) const
 {
     const auto topq = hrr_writer_.Algo().TopAM();
@@ -102,21 +114,76 @@ std::string OSTEIDeriv1_Writer::FunctionName_(QAM am) const
                          amchar[am[3]]);
 }
 
+std::string OSTEIDeriv1_Writer::KernelName_(QAM am) const
+{
+    return StringBuilder(FunctionName_(am), "_ptr");
+}
+
 std::string OSTEIDeriv1_Writer::FunctionPrototype_(QAM am) const
 {
+    std::string fname = KernelName_(am);
+    std::string indent(fname.length()+1+4, ' '); // +4 for return type
+
+    std::stringstream ss;
+    ss << "int " << fname << "(";
+    ss << "struct simint_multi_shellpair const * const restrict P,\n";
+    ss << indent << "struct simint_multi_shellpair const * const restrict Q,\n";
+    ss << indent << "double screen_tol,\n";
+    ss << indent << "double * const restrict work,\n";
+    ss << indent << "double * const restrict " << ArrVarName(am) << ")";
+    return ss.str();
+}
+
+std::string OSTEIDeriv1_Writer::ShimDefinition_(QAM am) const
+{
+    // Old by-value entry point, kept for compatibility
     std::string fname = FunctionName_(am);
     std::string indent(fname.length()+1+4, ' '); // +4 for return type
 
     std::stringstream ss;
+    ss << "static inline\n";
     ss << "int " << fname << "(";
     ss << "struct simint_multi_shellpair const P,\n";
     ss << indent << "struct simint_multi_shellpair const Q,\n";
     ss << indent << "double screen_tol,\n";
     ss << indent << "double * const restrict work,\n";
+    ss << indent << "double * const restrict " << ArrVarName(am) << ")\n";
+    ss << "{\n";
+    ss << indent1 << "return " << KernelName_(am) << "(&P, &Q, screen_tol, work, " << ArrVarName(am) << ");\n";
+    ss << "}\n";
+    return ss.str();
+}
+
+std::string OSTEIDeriv1_Writer::ViewKernelName_(QAM am) const
+{
+    return StringBuilder(FunctionName_(am), "_view");
+}
+
+std::string OSTEIDeriv1_Writer::ViewPrototype_(QAM am) const
+{
+    // The kernel itself, taking views of the shell pairs so that
+    // permuted kernels can swap centers without copying
+    std::string fname = ViewKernelName_(am);
+    std::string indent(fname.length()+1+4, ' '); // +4 for return type
+
+    std::stringstream ss;
+    ss << "static\n";
+    ss << "int " << fname << "(";
+    ss << "struct simint_multi_shellpair_view const * const restrict Pv,\n";
+    ss << indent << "struct simint_multi_shellpair_view const * const restrict Qv,\n";
+    ss << indent << "double screen_tol,\n";
+    ss << indent << "double * const restrict work,\n";
     ss << indent << "double * const restrict " << ArrVarName(am) << ")";
     return ss.str();
 }
 
+void OSTEIDeriv1_Writer::WriteViews_(bool swap12, bool swap34) const
+{
+    os_ << indent1 << "struct simint_multi_shellpair_view Pv, Qv;\n";
+    os_ << indent1 << "simint_init_shellpair_view(P, " << (swap12 ? 1 : 0) << ", &Pv);\n";
+    os_ << indent1 << "simint_init_shellpair_view(Q, " << (swap34 ? 1 : 0) << ", &Qv);\n";
+}
+
 void OSTEIDeriv1_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
 {
     QAM permuted = am;
@@ -137,53 +204,12 @@ void OSTEIDeriv1_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
     os_ << FunctionPrototype_(permuted) << "\n";
     os_ << "{\n";
 
-    const char * P_var = "P";
-    const char * Q_var = "Q";
+    // view P and Q with the centers swapped, and call
+    // the kernel for the unpermuted quartet
+    WriteViews_(swap12, swap34);
 
-    if(swap12)
-    {
-        P_var = "P_tmp";
-        os_ << indent1 << "double P_AB[3*P.nshell12];\n";
-    	os_ << indent1 << "struct simint_multi_shellpair P_tmp = P;\n";
-        os_ << indent1 << "P_tmp.alpha2 = P.beta2;  P_tmp.beta2 = P.alpha2;\n";
-        os_ << indent1 << "P_tmp.PA_x = P.PB_x;  P_tmp.PA_y = P.PB_y;  P_tmp.PA_z = P.PB_z;\n";
-        os_ << indent1 << "P_tmp.PB_x = P.PA_x;  P_tmp.PB_y = P.PA_y;  P_tmp.PB_z = P.PA_z;\n";
-        os_ << indent1 << "P_tmp.AB_x = P_AB;\n";
-        os_ << indent1 << "P_tmp.AB_y = P_AB + P.nshell12;\n";
-        os_ << indent1 << "P_tmp.AB_z = P_AB + 2*P.nshell12;\n";
-        os_ << "\n";
-        os_ << indent1 << "for(int i = 0; i < P.nshell12; i++)\n";
-        os_ << indent1 << "{\n";
-        os_ << indent2 << "P_tmp.AB_x[i] = -P.AB_x[i];\n";
-        os_ << indent2 << "P_tmp.AB_y[i] = -P.AB_y[i];\n";
-        os_ << indent2 << "P_tmp.AB_z[i] = -P.AB_z[i];\n";
-        os_ << indent1 << "}\n\n";
-    }
-
-    if(swap34)
-    {
-	    Q_var = "Q_tmp";
-        os_ << indent1 << "double Q_AB[3*Q.nshell12];\n";
-    	os_ << indent1 << "struct simint_multi_shellpair Q_tmp = Q;\n";
-        os_ << indent1 << "Q_tmp.alpha2 = Q.beta2;  Q_tmp.beta2 = Q.alpha2;\n";
-		os_ << indent1 << "Q_tmp.PA_x = Q.PB_x;  Q_tmp.PA_y = Q.PB_y;  Q_tmp.PA_z = Q.PB_z;\n";
-        os_ << indent1 << "Q_tmp.PB_x = Q.PA_x;  Q_tmp.PB_y = Q.PA_y;  Q_tmp.PB_z = Q.PA_z;\n";
-        os_ << indent1 << "Q_tmp.AB_x = Q_AB;\n";
-        os_ << indent1 << "Q_tmp.AB_y = Q_AB + Q.nshell12;\n";
-        os_ << indent1 << "Q_tmp.AB_z = Q_AB + 2*Q.nshell12;\n";
-        os_ << "\n";
-        os_ << indent1 << "for(int i = 0; i < Q.nshell12; i++)\n";
-        os_ << indent1 << "{\n";
-        os_ << indent2 << "Q_tmp.AB_x[i] = -Q.AB_x[i];\n";
-        os_ << indent2 << "Q_tmp.AB_y[i] = -Q.AB_y[i];\n";
-        os_ << indent2 << "Q_tmp.AB_z[i] = -Q.AB_z[i];\n";
-        os_ << indent1 << "}\n\n";
-    }
-
-    std::string fname = FunctionName_(am);
-    os_ << indent1 << "int ret = " << fname
-        << "(" << P_var << ", " << Q_var << ", screen_tol, "
-        << "work, " << ArrVarName(permuted) << ");\n";
+    os_ << indent1 << "int ret = " << ViewKernelName_(am)
+        << "(&Pv, &Qv, screen_tol, work, " << ArrVarName(permuted) << ");\n";
 
 
     size_t ncart_abcd = NCART(am);
@@ -254,6 +280,7 @@ void OSTEIDeriv1_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
     os_ << "\n";
 
     osh_ << FunctionPrototype_(permuted) << ";\n\n";
+    osh_ << ShimDefinition_(permuted) << "\n";
 }
 
 
@@ -621,10 +648,12 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     //////////////////////////////
     // Function name & signature
     //////////////////////////////
-    os_ << FunctionPrototype_(am) << "\n";
+    os_ << ViewPrototype_(am) << "\n";
     os_ << "{\n";
     os_ << "\n";
 
+    os_ << indent1 << "struct simint_multi_shellpair const * const restrict P = Pv->pair;\n";
+    os_ << indent1 << "struct simint_multi_shellpair const * const restrict Q = Qv->pair;\n\n";
     os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(work);\n";
     os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(" << ArrVarName(am) << ");\n";
 
@@ -636,7 +665,7 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     // directly into the final integral array that was passed into this function, so it must be zeroed first
     if(!hashrr)
         os_ << indent1 << "memset(" << ArrVarName(am)
-                       << ", 0, P.nshell12_clip * Q.nshell12_clip * "
+                       << ", 0, P->nshell12_clip * Q->nshell12_clip * "
                        << ncart << " * sizeof(double));\n\n";
 
 
@@ -681,23 +710,23 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
         os_ << indent1 << "abcd = 0;\n";
 
     os_ << indent1 << "istart = 0;\n";
-    os_ << indent1 << "for(ab = 0; ab < P.nshell12_clip; ++ab)\n";
+    os_ << indent1 << "for(ab = 0; ab < P->nshell12_clip; ++ab)\n";
     os_ << indent1 << "{\n";
 
-    os_ << indent2 << "const int iend = istart + P.nprim12[ab];\n";
+    os_ << indent2 << "const int iend = istart + P->nprim12[ab];\n";
     os_ << "\n";
 
     os_ << indent2 << "cd = 0;\n";
     os_ << indent2 << "jstart = 0;\n";
     os_ << "\n";
 
-    os_ << indent2 << "for(cd = 0; cd < Q.nshell12_clip; cd += SIMINT_NSHELL_SIMD)\n";
+    os_ << indent2 << "for(cd = 0; cd < Q->nshell12_clip; cd += SIMINT_NSHELL_SIMD)\n";
     os_ << indent2 << "{\n";
-    os_ << indent3 << "const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q.nshell12_clip) ? Q.nshell12_clip - cd : SIMINT_NSHELL_SIMD;\n";
+    os_ << indent3 << "const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q->nshell12_clip) ? Q->nshell12_clip - cd : SIMINT_NSHELL_SIMD;\n";
 
     os_ << indent3 << "int jend = jstart;\n";
     os_ << indent3 << "for(i = 0; i < nshellbatch; i++)\n";
-    os_ << indent4 << "jend += Q.nprim12[cd+i];\n";
+    os_ << indent4 << "jend += Q->nprim12[cd+i];\n";
     os_ << "\n";
 
 
@@ -717,36 +746,38 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
 
     os_ << indent4 << "if(check_screen)\n";
     os_ << indent4 << "{\n";
-    os_ << indent5 << "// Skip this whole thing if always insignificant\n";
-    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < screen_tol)\n";
-    os_ << indent6 << "continue;\n";
+    os_ << indent5 << "// Skip this whole thing if always insignificant.\n";
+    os_ << indent5 << "// The primitives are sorted by decreasing screening value,\n";
+    os_ << indent5 << "// so the rest of this shell pair is insignificant, too\n";
+    os_ << indent5 << "if((P->screen[i] * Q->screen_max) < screen_tol)\n";
+    os_ << indent6 << "break;\n";
 
-    os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P.screen[i]);\n";
+    os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P->screen[i]);\n";
     os_ << indent4 << "}\n\n";
 
     os_ << indent4 << "icd = 0;\n";
     os_ << indent4 << "iprimcd = 0;\n";
-    os_ << indent4 << "nprim_icd = Q.nprim12[cd];\n";
+    os_ << indent4 << "nprim_icd = Q->nprim12[cd];\n";
 
     DeclarePrimPointers();
     os_ << "\n";
 
     os_ << indent4 << "// Load these one per loop over i\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE P_alpha = SIMINT_DBLSET1(P.alpha[i]);\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE P_prefac = SIMINT_DBLSET1(P.prefac[i]);\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLSET1(P.x[i]), SIMINT_DBLSET1(P.y[i]), SIMINT_DBLSET1(P.z[i]) };\n";
+    os_ << indent4 << "const SIMINT_DBLTYPE P_alpha = SIMINT_DBLSET1(P->alpha[i]);\n";
+    os_ << indent4 << "const SIMINT_DBLTYPE P_prefac = SIMINT_DBLSET1(P->prefac[i]);\n";
+    os_ << indent4 << "const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLSET1(P->x[i]), SIMINT_DBLSET1(P->y[i]), SIMINT_DBLSET1(P->z[i]) };\n";
 
     os_ << "\n";
     os_ << indent4 << "// Contraction factors (needed for derivatives)\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE cfac_2a = SIMINT_DBLSET1(P.alpha2[i]);\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE cfac_2b = SIMINT_DBLSET1(P.beta2[i]);\n\n";
+    os_ << indent4 << "const SIMINT_DBLTYPE cfac_2a = SIMINT_DBLSET1(Pv->alpha2[i]);\n";
+    os_ << indent4 << "const SIMINT_DBLTYPE cfac_2b = SIMINT_DBLSET1(Pv->beta2[i]);\n\n";
 
     if(hasbravrr)
     {
         if(vrr_writer_.Algo().HasVRR_I())
-            os_ << indent4 << "const SIMINT_DBLTYPE P_PA[3] = { SIMINT_DBLSET1(P.PA_x[i]), SIMINT_DBLSET1(P.PA_y[i]), SIMINT_DBLSET1(P.PA_z[i]) };\n";
+            os_ << indent4 << "const SIMINT_DBLTYPE P_PA[3] = { SIMINT_DBLSET1(Pv->PA_x[i]), SIMINT_DBLSET1(Pv->PA_y[i]), SIMINT_DBLSET1(Pv->PA_z[i]) };\n";
         else
-            os_ << indent4 << "const SIMINT_DBLTYPE P_PB[3] = { SIMINT_DBLSET1(P.PB_x[i]), SIMINT_DBLSET1(P.PB_y[i]), SIMINT_DBLSET1(P.PB_z[i]) };\n";
+            os_ << indent4 << "const SIMINT_DBLTYPE P_PB[3] = { SIMINT_DBLSET1(Pv->PB_x[i]), SIMINT_DBLSET1(Pv->PB_y[i]), SIMINT_DBLSET1(Pv->PB_z[i]) };\n";
     }
 
     os_ << "\n";
@@ -762,30 +793,31 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << indent5 << "// (not_screened != 0 means we have to do this vector)\n";
     os_ << indent5 << "if(check_screen)\n";
     os_ << indent5 << "{\n";
-    os_ << indent6 << "const double vmax = vector_max(SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j)));\n";
+    os_ << indent6 << "const double vmax = vector_max(SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q->screen, j)));\n";
     os_ << indent6 << "if(vmax < screen_tol)\n";
     os_ << indent6 << "{\n";
     for(const auto it : batchcontq)
         os_ << indent7 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
+    WriteScreenedSkip();
     os_ << indent7 << "continue;\n";
     os_ << indent6 << "}\n";
     os_ << indent5 << "}\n\n";
 
 
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);\n";
+    os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q->alpha, j);\n";
     os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_mul = SIMINT_MUL(P_alpha, Q_alpha);\n";
     os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_sum = SIMINT_ADD(P_alpha, Q_alpha);\n";
     os_ << indent5 << "const SIMINT_DBLTYPE one_over_PQalpha_sum = SIMINT_DIV(const_1, PQalpha_sum);\n";
     os_ << "\n";
     os_ << indent5 << "// Contraction factors (needed for derivatives)\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE cfac_2c = SIMINT_DBLLOAD(Q.alpha2, j);\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE cfac_2d = SIMINT_DBLLOAD(Q.beta2, j);\n\n";
+    os_ << indent5 << "const SIMINT_DBLTYPE cfac_2c = SIMINT_DBLLOAD(Qv->alpha2, j);\n";
+    os_ << indent5 << "const SIMINT_DBLTYPE cfac_2d = SIMINT_DBLLOAD(Qv->beta2, j);\n\n";
     os_ << "\n";
     os_ << indent5 << "/* construct R2 = (Px - Qx)**2 + (Py - Qy)**2 + (Pz -Qz)**2 */\n";
     os_ << indent5 << "SIMINT_DBLTYPE PQ[3];\n";
-    os_ << indent5 << "PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));\n";
-    os_ << indent5 << "PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));\n";
-    os_ << indent5 << "PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));\n";
+    os_ << indent5 << "PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q->x, j));\n";
+    os_ << indent5 << "PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q->y, j));\n";
+    os_ << indent5 << "PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q->z, j));\n";
 
 
     os_ << indent5 << "SIMINT_DBLTYPE R2 = SIMINT_MUL(PQ[0], PQ[0]);\n";
@@ -812,9 +844,9 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     if(hasketvrr)
     {
         if(vrr_writer_.Algo().HasVRR_K())
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PA[3] = { SIMINT_DBLLOAD(Q.PA_x, j), SIMINT_DBLLOAD(Q.PA_y, j), SIMINT_DBLLOAD(Q.PA_z, j) };\n";
+            os_ << indent5 << "const SIMINT_DBLTYPE Q_PA[3] = { SIMINT_DBLLOAD(Qv->PA_x, j), SIMINT_DBLLOAD(Qv->PA_y, j), SIMINT_DBLLOAD(Qv->PA_z, j) };\n";
         else
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PB[3] = { SIMINT_DBLLOAD(Q.PB_x, j), SIMINT_DBLLOAD(Q.PB_y, j), SIMINT_DBLLOAD(Q.PB_z, j) };\n";
+            os_ << indent5 << "const SIMINT_DBLTYPE Q_PB[3] = { SIMINT_DBLLOAD(Qv->PB_x, j), SIMINT_DBLLOAD(Qv->PB_y, j), SIMINT_DBLLOAD(Qv->PB_z, j) };\n";
     }
 
     if(hasbravrr)
@@ -853,7 +885,7 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << "\n";
 
     // we need to zero out any that are beyond the end of the batch (that's been clipped)
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);\n";
+    os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q->prefac + j);\n";
     os_ << "\n\n";
     os_ << indent5 << "boys_F_split(" << PrimVarName({0,0,0,0})
                    << ", F_x, " << (info_.L()+1) << ");\n";
@@ -897,17 +929,19 @@ void OSTEIDeriv1_Writer::Write_Full_(void) const
     os_ << indent2 << "}   // close loop cdbatch\n";
 
     os_ << "\n";
-    os_ << indent2 << "istart = iend;\n";
+    os_ << indent2 << "// the primitives are padded to a multiple of the vector\n";
+    os_ << indent2 << "// length after every SIMINT_NSHELL_SIMD shell pairs\n";
+    os_ << indent2 << "istart = (((ab + 1) % SIMINT_NSHELL_SIMD) == 0) ? SIMINT_SIMD_ROUND(iend) : iend;\n";
 
     os_ << indent1 << "}  // close loop over ab\n";
     os_ << "\n";
-    os_ << indent1 << "return P.nshell12_clip * Q.nshell12_clip;\n";
+    os_ << indent1 << "return P->nshell12_clip * Q->nshell12_clip;\n";
     os_ << "}\n";
     os_ << "\n";
 
 
     // Write out memory requirement to the log file
-    std::cout << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
+    info_.Log() << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
 }
 
 
@@ -937,8 +971,17 @@ void OSTEIDeriv1_Writer::WriteFile(void) const
     // is this a special permutation? Handle it if so.
     Write_Full_();
 
+    // The entry point views the shell pairs as they are
+    os_ << FunctionPrototype_(am) << "\n";
+    os_ << "{\n";
+    WriteViews_(false, false);
+    os_ << indent1 << "return " << ViewKernelName_(am)
+        << "(&Pv, &Qv, screen_tol, work, " << ArrVarName(am) << ");\n";
+    os_ << "}\n\n";
+
     // Add to the header
     osh_ << FunctionPrototype_(am) << ";\n\n";
+    osh_ << ShimDefinition_(am) << "\n";
 
     // Write out the code for permuting final integrals, if necessary
     if(info_.FinalPermute())
@@ -0,0 +1,153 @@
+/*! \file
+ *
+ * \brief Generation of the source for a single OSTEI quartet (source)
+ * \author Benjamin Pritchard (ben@bennyp.org)
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "generator/StringBuilder.hpp"
+
+#include "generator/ostei/OSTEI_Generate.hpp"
+#include "generator/ostei/Algorithms.hpp"
+#include "generator/ostei/OSTEI_GeneratorInfo.hpp"
+#include "generator/ostei/OSTEI_VRR_Writer.hpp"
+#include "generator/ostei/OSTEI_HRR_Writer.hpp"
+#include "generator/ostei/OSTEI_Writer.hpp"
+
+
+void GenerateOSTEI(QAM finalam, const OptionMap & options,
+                   std::ostream & of, std::ostream & ofh, std::ostream & log)
+{
+    // Information for this OSTEI
+    OSTEI_GeneratorInfo info(finalam, 0, options);
+    info.SetLog(log);
+
+    // The missing centers of 3- and 2-center kernels must be s shells
+    if(info.Centers() < 2 || info.Centers() > 4)
+        throw std::runtime_error(StringBuilder("Number of centers must be 2, 3, or 4. Got ", info.Centers()));
+    if(info.BraOneCenter() && finalam[1] != 0)
+        throw std::runtime_error("AM of the second center must be zero for 3- and 2-center kernels");
+    if(info.KetOneCenter() && finalam[3] != 0)
+        throw std::runtime_error("AM of the fourth center must be zero for 2-center kernels");
+    if(info.BraOneCenter() && info.Float())
+        throw std::runtime_error("Float (single precision) kernels are only available for 4 centers");
+
+
+    //////////////////////////////////////////////////////////////
+    //! \todo We are doing all this work even if it is a special
+    //        permutation
+    //////////////////////////////////////////////////////////////
+
+    // algorithms used
+    Makowski_HRR hrralgo(info);
+    Makowski_VRR vrralgo(info);
+
+    // Working backwards, I need:
+    // 1.) HRR Steps
+    hrralgo.Create(finalam);
+    OSTEI_HRR_Writer hrr_writer(hrralgo, info,
+                                options.at(Option::ExternalHRR),
+                                options.at(Option::GeneralHRR));
+
+    QuartetSet topquartets = hrralgo.TopQuartets();
+
+    // 2.) VRR Steps
+    //     External and general VRR functions only exist for double
+    //     precision and always use PA and QC, so float and 3- and
+    //     2-center kernels always have the VRR inline
+    int vrr_external = options.at(Option::ExternalVRR);
+    int vrr_general = options.at(Option::GeneralVRR);
+    if(info.Float() || info.BraOneCenter())
+        vrr_external = vrr_general = std::numeric_limits<int>::max();
+
+    vrralgo.Create(topquartets);
+    OSTEI_VRR_Writer vrr_writer(vrralgo, info, vrr_external, vrr_general);
+
+
+    // Create the OSTEI_Writer and write the file
+    OSTEI_Writer ostei_writer(of, ofh, info, vrr_writer, hrr_writer);
+    ostei_writer.WriteFile();
+}
+
+
+void GenerateOSTEIDeriv1(QAM finalam, const OptionMap & options,
+                         std::ostream & of, std::ostream & ofh, std::ostream & log)
+{
+    // Information for this OSTEI
+    OSTEI_GeneratorInfo info(finalam, 1, options);
+    info.SetLog(log);
+
+    if(info.Float())
+        throw std::runtime_error("Float (single precision) kernels are not available for derivatives");
+    if(info.BraOneCenter())
+        throw std::runtime_error("3- and 2-center kernels are not available for derivatives");
+
+
+    //////////////////////////////////////////////////////////////
+    //! \todo Are there special permutations for derivatives?
+    //////////////////////////////////////////////////////////////
+
+    // algorithms used
+    Makowski_HRR hrralgo(info);
+    Makowski_VRR vrralgo(info);
+
+    // Working backwards, I need:
+    // 1.) HRR Steps
+    //     We need the different increments, decrements for derivatives
+    std::set<QAM> needed_am;
+
+    // We only need to do three centers. The fourth is free
+    // Find which one to skip
+    int max = *(std::max_element(finalam.begin(), finalam.end()));
+
+    int missing_center;
+    if(finalam[0] == max)
+        missing_center = 0;
+    else if(finalam[1] == max)
+        missing_center = 1;
+    else if(finalam[2] == max)
+        missing_center = 2;
+    else
+        missing_center = 3;
+
+    const char * dir[4] = {"2a", "2b", "2c", "2d"};
+    for(int i = 0; i < 4; i++)
+    {
+        if(i == missing_center)
+            continue;
+
+        QAM amtmp_p(finalam.qam, dir[i]);
+        QAM amtmp_m(finalam);
+        amtmp_p.qam[i]++;
+        amtmp_m.qam[i]--;
+
+        needed_am.insert(amtmp_p);
+        if(ValidQAM(amtmp_m))
+            needed_am.insert(amtmp_m);
+    }
+
+    info.SetDeriv1_MissingCenter(missing_center);
+
+    hrralgo.Create(needed_am);
+    OSTEI_HRR_Writer hrr_writer(hrralgo, info,
+                                options.at(Option::ExternalHRR),
+                                options.at(Option::GeneralHRR));
+
+    QuartetSet topquartets = hrralgo.TopQuartets();
+
+    // 2.) VRR Steps
+    vrralgo.Create(topquartets);
+    OSTEI_VRR_Writer vrr_writer(vrralgo, info,
+                                options.at(Option::ExternalVRR),
+                                options.at(Option::GeneralVRR));
+
+
+    // Create the OSTEI_Writer and write the file
+    OSTEIDeriv1_Writer ostei_deriv1_writer(of, ofh, info, vrr_writer, hrr_writer);
+    ostei_deriv1_writer.WriteFile();
+}
+
@@ -0,0 +1,38 @@
+/*! \file
+ *
+ * \brief Generation of the source for a single OSTEI quartet (header)
+ * \author Benjamin Pritchard (ben@bennyp.org)
+ */
+
+
+#pragma once
+
+#include <ostream>
+
+#include "generator/Types.hpp"
+#include "generator/Options.hpp"
+
+
+/*! \brief Generate the source for a single OSTEI quartet
+ *
+ * \param [in] finalam The AM quartet to generate
+ * \param [in] options Options for code generation
+ * \param [in] of Stream for the source file
+ * \param [in] ofh Stream for the header file (declarations are written here)
+ * \param [in] log Stream for information about the generated code (work size, etc)
+ */
+void GenerateOSTEI(QAM finalam, const OptionMap & options,
+                   std::ostream & of, std::ostream & ofh, std::ostream & log);
+
+
+/*! \brief Generate the source for a single OSTEI first derivative quartet
+ *
+ * \param [in] finalam The AM quartet to generate
+ * \param [in] options Options for code generation
+ * \param [in] of Stream for the source file
+ * \param [in] ofh Stream for the header file (declarations are written here)
+ * \param [in] log Stream for information about the generated code (work size, etc)
+ */
+void GenerateOSTEIDeriv1(QAM finalam, const OptionMap & options,
+                         std::ostream & of, std::ostream & ofh, std::ostream & log);
+
@@ -1,8 +1,11 @@
 #pragma once
 
 
+#include <string>
+
 #include "generator/Types.hpp"
 #include "generator/GeneratorInfoBase.hpp"
+#include "generator/StringBuilder.hpp"
 
 class OSTEI_GeneratorInfo : public GeneratorInfoBase
 {
@@ -33,6 +36,91 @@ public:
         return deriv1_missing_center_;
     }
 
+    /*! \brief Are primitives computed in single precision?
+     *
+     * Float kernels use vectors of twice the length (SIMINT_FLT_SIMD_LEN)
+     * for everything up to the contraction. Contracted integrals
+     * (and the HRR) are still in double precision.
+     */
+    bool Float(void) const
+    {
+        return GetOption(Option::Float);
+    }
+
+    //! Type of the vectors used for primitive integrals
+    std::string VecType(void) const
+    {
+        return Float() ? "SIMINT_FLTTYPE" : "SIMINT_DBLTYPE";
+    }
+
+    //! Number of primitives in each vector
+    std::string VecLen(void) const
+    {
+        return Float() ? "SIMINT_FLT_SIMD_LEN" : "SIMINT_SIMD_LEN";
+    }
+
+    //! Broadcasting a scalar (given as a string) to a vector
+    std::string VecSet1(const std::string & val) const
+    {
+        return (Float() ? "SIMINT_FLTSET1(" : "SIMINT_DBLSET1(") + val + ")";
+    }
+
+    //! Loading a vector from a shell pair array, starting at index \p idx
+    std::string VecLoad(const std::string & ptr, const std::string & idx) const
+    {
+        if(Float())
+            return "SIMINT_FLTLOAD(" + ptr + ", " + idx + ", nlane)";
+        else
+            return "SIMINT_DBLLOAD(" + ptr + ", " + idx + ")";
+    }
+
+    //! Name of a vector operation macro (ie, "MUL" -> SIMINT_MUL or SIMINT_FLT_MUL)
+    std::string VecOp(const std::string & op) const
+    {
+        return (Float() ? "SIMINT_FLT_" : "SIMINT_") + op;
+    }
+
+    //! Name of a helper function taking vectors (ie, contract or contract_flt)
+    std::string VecFunc(const std::string & func) const
+    {
+        return Float() ? func + "_flt" : func;
+    }
+
+    /*! \brief Number of real centers (4, or 3 and 2 for density fitting)
+     *
+     * With 3 centers, the second center (B) does not exist, and with 2
+     * centers the fourth (D) does not exist either. The shell pairs are still
+     * created with a zero shell (simint_create_zero_shell) in those positions,
+     * but the kernels know that P = A (and Q = C), and drop the PA (and QC)
+     * terms from the VRR.
+     */
+    int Centers(void) const
+    {
+        return GetOption(Option::Centers);
+    }
+
+    //! Is the bra made of a single center (ie, P = A)?
+    bool BraOneCenter(void) const
+    {
+        return Centers() < 4;
+    }
+
+    //! Is the ket made of a single center (ie, Q = C)?
+    bool KetOneCenter(void) const
+    {
+        return Centers() < 3;
+    }
+
+    //! Prefix for the names of the kernels (ostei_, ostei_flt_, ostei_3c_, ...)
+    std::string KernelPrefix(void) const
+    {
+        if(Float())
+            return "ostei_flt_";
+        if(Centers() < 4)
+            return StringBuilder("ostei_", Centers(), "c_");
+        return "ostei_";
+    }
+
     bool IsUnique(void) const
     {
         QAM am = FinalAM();
@@ -7,6 +7,9 @@
 
 #include <iostream>
 #include <algorithm>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
 #include "generator/Printing.hpp"
 #include "generator/ostei/OSTEI_HRR_Algorithm_Base.hpp"
 
@@ -144,6 +147,39 @@ void OSTEI_HRR_Algorithm_Base::HRRDoubletLoop_(HRRDoubletStepList & hrrlist,
 
 }
 
+void OSTEI_HRR_Algorithm_Base::SolveDoublets_(HRRDoubletStepList & hrrlist,
+                                              const DoubletSet & inittargets,
+                                              DoubletSet & solveddoublets,
+                                              RRStepType steptype)
+{
+    // The steps only depend on the initial targets and the direction,
+    // and the same bra or ket appears in many quartets. So when several
+    // quartets are generated by the same thread, reuse what we can.
+    typedef std::tuple<std::type_index, DoubletSet, RRStepType> CacheKey;
+    typedef std::pair<HRRDoubletStepList, DoubletSet> CacheEntry;
+    static thread_local std::map<CacheKey, CacheEntry> cache;
+
+    const CacheKey key{std::type_index(typeid(*this)), inittargets, steptype};
+
+    auto it = cache.find(key);
+    if(it == cache.end())
+    {
+        DoubletSet targets = inittargets;
+        DoubletSet solved, pruned;
+        HRRDoubletStepList steps;
+
+        PruneDoublets_(targets, pruned, steptype);
+        HRRDoubletLoop_(steps, targets, solved, pruned, steptype);
+        std::reverse(steps.begin(), steps.end());
+
+        it = cache.emplace(key, CacheEntry{steps, solved}).first;
+    }
+
+    hrrlist = it->second.first;
+    solveddoublets = it->second.second;
+}
+
+
 void OSTEI_HRR_Algorithm_Base::Create(QAM am)
 {
     Create(std::set<QAM>{am});
@@ -180,7 +216,7 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
                                       RRStepType ketsteptype)
 {
     // we need the kets from the original targets
-    DoubletSet initkets, solvedkets, prunedket;
+    DoubletSet initkets, solvedkets;
 
     for(auto & iam : am)
     {
@@ -189,16 +225,9 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
         initkets.insert(add_targets.begin(), add_targets.end());
     }
 
-    DoubletSet targets = initkets;
-    PruneDoublets_(targets, prunedket, ketsteptype);
-
-    //std::cout << "\n\n";
-    //PrintDoubletSet(targets, "Initial ket targets");
-
     // Solve the ket part
     HRRDoubletStepList ketsteps;
-    HRRDoubletLoop_(ketsteps, targets, solvedkets, prunedket, ketsteptype);
-    std::reverse(ketsteps.begin(), ketsteps.end());
+    SolveDoublets_(ketsteps, initkets, solvedkets, ketsteptype);
 
     // store in map by AM
     // and store requirements
@@ -222,7 +251,7 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
 
 
     // we need the bras from the original targets
-    DoubletSet initbras, solvedbras, prunedbra;
+    DoubletSet initbras, solvedbras;
     for(auto & iam : am)
     {
         // this strips off the tag
@@ -230,18 +259,9 @@ void OSTEI_HRR_Algorithm_Base::Create(std::set<QAM> am,
         initbras.insert(add_targets.begin(), add_targets.end());
     }
 
-
-    // Initial bra targets
-    targets = initbras;
-    PruneDoublets_(targets, prunedbra, brasteptype);
-
-    //std::cout << "\n\n";
-    //PrintDoubletSet(targets, "Initial bra targets");
-
     // Solve the bra part
     HRRDoubletStepList brasteps;
-    HRRDoubletLoop_(brasteps, targets, solvedbras, prunedbra, brasteptype);
-    std::reverse(brasteps.begin(), brasteps.end());
+    SolveDoublets_(brasteps, initbras, solvedbras, brasteptype);
 
     // store in map by AM
     // and store requirements
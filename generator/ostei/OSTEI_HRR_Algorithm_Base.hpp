@@ -67,6 +67,11 @@ class OSTEI_HRR_Algorithm_Base
                              DoubletSet & pruned,
                              RRStepType steptype);
 
+        void SolveDoublets_(HRRDoubletStepList & hrrlist,
+                            const DoubletSet & inittargets,
+                            DoubletSet & solveddoublets,
+                            RRStepType steptype);
+
         static void PruneDoublets_(DoubletSet & d, DoubletSet & pruned, RRStepType steptype);
 
         void AMOrder_AddWithDependencies_(QAMList & order,
@@ -126,14 +126,14 @@ void OSTEI_HRR_Writer::WriteHRR(std::ostream & os) const
     os << "\n\n";
 
     if(hrr_algo_.HasBraHRR())
-        os << indent3 << "const double hAB[3] = { P.AB_x[ab], P.AB_y[ab], P.AB_z[ab] };\n"; 
+        os << indent3 << "const double hAB[3] = { Pv->AB_sign * P->AB_x[ab], Pv->AB_sign * P->AB_y[ab], Pv->AB_sign * P->AB_z[ab] };\n";
     os << "\n\n";
 
     os << indent3 << "for(abcd = 0; abcd < nshellbatch; ++abcd, ++real_abcd)\n";
     os << indent3 << "{\n";
 
     if(hrr_algo_.HasKetHRR())
-        os << indent4 << "const double hCD[3] = { Q.AB_x[cd+abcd], Q.AB_y[cd+abcd], Q.AB_z[cd+abcd] };\n";
+        os << indent4 << "const double hCD[3] = { Qv->AB_sign * Q->AB_x[cd+abcd], Qv->AB_sign * Q->AB_y[cd+abcd], Qv->AB_sign * Q->AB_z[cd+abcd] };\n";
     os << "\n";
     os << indent4 << "// set up HRR pointers\n";
     for(const auto & it : hrr_algo_.TopAM())
@@ -222,8 +222,8 @@ void OSTEI_HRR_Writer::WriteHRR_Bra_External_(std::ostream & os, QAM am) const
     os << indent5 << "hAB, " << NCART(am[2], am[3]) << ");\n"; 
 
     // Mark this as required in the log file
-    std::cout << "SIMINT EXTERNAL HRR " << RRStepTypeToStr(rrstep)
-              << " " << am[0] << " " << am[1] << "\n";
+    info_.Log() << "SIMINT EXTERNAL HRR " << RRStepTypeToStr(rrstep)
+                << " " << am[0] << " " << am[1] << "\n";
 }
 
 void OSTEI_HRR_Writer::WriteHRR_Ket_External_(std::ostream & os, QAM am) const
@@ -242,8 +242,8 @@ void OSTEI_HRR_Writer::WriteHRR_Ket_External_(std::ostream & os, QAM am) const
     os << indent5 << "hCD, " << NCART(DAM{am[0], am[1]}) << ");\n";
 
     // Mark this as required in the log file
-    std::cout << "SIMINT EXTERNAL HRR " << RRStepTypeToStr(rrstep)
-              << " " << am[2] << " " << am[3] << "\n";
+    info_.Log() << "SIMINT EXTERNAL HRR " << RRStepTypeToStr(rrstep)
+                << " " << am[2] << " " << am[3] << "\n";
 }
 
 void OSTEI_HRR_Writer::WriteHRR_Bra_General_(std::ostream & os, QAM am) const
@@ -92,14 +92,21 @@ void OSTEI_VRR_Writer::WriteVRRSteps_(std::ostream & os, QAM am, const VRR_StepS
         }
 
 
-        if(it.type == RRStepType::I || it.type == RRStepType::J)
+        // If the bra (or ket) is a single center, P = A (or Q = C) and
+        // there is no PA (or QC) term. Start from the PQ term instead
+        const bool nopa = (it.type == RRStepType::I && info_.BraOneCenter()) ||
+                          (it.type == RRStepType::K && info_.KetOneCenter());
+
+        if(nopa)
+            os << indent6 << primname << " = " << info_.VecOp("MUL") << "(" << aoppq << ", " << srcname[1] << ");\n";
+        else if(it.type == RRStepType::I || it.type == RRStepType::J)
         {
             std::string ppa = StringBuilder("P_PA", stepdir);
 
             if(it.type != RRStepType::I)
                 ppa = StringBuilder("P_PB", stepdir);
 
-            os << indent6 << primname << " = SIMINT_MUL(" << ppa << ", " << srcname[0] << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("MUL") << "(" << ppa << ", " << srcname[0] << ");\n";
         }
         else
         {
@@ -108,19 +115,19 @@ void OSTEI_VRR_Writer::WriteVRRSteps_(std::ostream & os, QAM am, const VRR_StepS
             if(it.type != RRStepType::K)
                 qpa = StringBuilder("Q_PB", stepdir);
 
-            os << indent6 << primname << " = SIMINT_MUL(" << qpa << ", " << srcname[0] << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("MUL") << "(" << qpa << ", " << srcname[0] << ");\n";
         }
 
-        if(it.src[1])
-            os << indent6 << primname << " = SIMINT_FMADD( " << aoppq << ", " << srcname[1] << ", " << primname << ");\n";
+        if(it.src[1] && !nopa)
+            os << indent6 << primname << " = " << info_.VecOp("FMADD") << "( " << aoppq << ", " << srcname[1] << ", " << primname << ");\n";
         if(it.src[2] && it.src[3])
-            os << indent6 << primname << " = SIMINT_FMADD( " << vrr_const0 << ", SIMINT_FMADD(" << aover << ", " << srcname[3] << ", " << srcname[2] << "), " << primname << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("FMADD") << "( " << vrr_const0 << ", " << info_.VecOp("FMADD") << "(" << aover << ", " << srcname[3] << ", " << srcname[2] << "), " << primname << ");\n";
         if(it.src[4] && it.src[5])
-            os << indent6 << primname << " = SIMINT_FMADD( " << vrr_const1 << ", SIMINT_FMADD(" << aover << ", " << srcname[5] << ", " << srcname[4] << "), " << primname << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("FMADD") << "( " << vrr_const1 << ", " << info_.VecOp("FMADD") << "(" << aover << ", " << srcname[5] << ", " << srcname[4] << "), " << primname << ");\n";
         if(it.src[6])
-            os << indent6 << primname << " = SIMINT_FMADD( " << vrr_const2 << ", " << srcname[6] << ", " << primname << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("FMADD") << "( " << vrr_const2 << ", " << srcname[6] << ", " << primname << ");\n";
         if(it.src[7])
-            os << indent6 << primname << " = SIMINT_FMADD( " << vrr_const3 << ", " << srcname[7] << ", " << primname << ");\n";
+            os << indent6 << primname << " = " << info_.VecOp("FMADD") << "( " << vrr_const3 << ", " << srcname[7] << ", " << primname << ");\n";
         
         os << "\n";
 
@@ -151,25 +158,25 @@ void OSTEI_VRR_Writer::WriteVRR(std::ostream & os) const
     for(const auto & it : vrr_algo_.GetAllInt_2p())
     {
         if(it == 1)
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2p = one_over_2p;\n"; 
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2p = one_over_2p;\n"; 
         else
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2p = SIMINT_MUL(const_" << it << ", one_over_2p);\n";
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2p = " << info_.VecOp("MUL") << "(const_" << it << ", one_over_2p);\n";
     }
 
     for(const auto & it : vrr_algo_.GetAllInt_2q())
     {
         if(it == 1)
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2q = one_over_2q;\n"; 
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2q = one_over_2q;\n"; 
         else
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2q = SIMINT_MUL(const_" << it << ", one_over_2q);\n";
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2q = " << info_.VecOp("MUL") << "(const_" << it << ", one_over_2q);\n";
     }
 
     for(const auto & it : vrr_algo_.GetAllInt_2pq())
     {
         if(it == 1)
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2pq = one_over_2pq;\n"; 
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2pq = one_over_2pq;\n"; 
         else
-            os << indent5 << "const SIMINT_DBLTYPE vrr_const_" << it << "_over_2pq = SIMINT_MUL(const_" << it << ", one_over_2pq);\n";
+            os << indent5 << "const " << info_.VecType() << " vrr_const_" << it << "_over_2pq = " << info_.VecOp("MUL") << "(const_" << it << ", one_over_2pq);\n";
     }
 
     os << "\n\n";
@@ -222,8 +229,8 @@ void OSTEI_VRR_Writer::WriteVRR_External_(std::ostream & os, QAM am) const
     os << indent7 << (vrr_algo_.GetMReq(am)+1) << ");\n";
 
     // Mark this as required in the log file
-    std::cout << "SIMINT EXTERNAL VRR " << RRStepTypeToStr(rrstep)
-              << " " << am[0] << " " << am[1] << " " << am[2] << " " << am[3] << "\n";
+    info_.Log() << "SIMINT EXTERNAL VRR " << RRStepTypeToStr(rrstep)
+                << " " << am[0] << " " << am[1] << " " << am[2] << " " << am[3] << "\n";
 }
 
 void OSTEI_VRR_Writer::WriteVRR_General_(std::ostream & os, QAM am) const
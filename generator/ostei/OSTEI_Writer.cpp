@@ -28,17 +28,17 @@ void OSTEI_Writer::WriteShellOffsets(void) const
     os_ << indent5 << "// calculate the shell offsets\n";
     os_ << indent5 << "// these are the offset from the shell pointed to by cd\n";
     os_ << indent5 << "// for each element\n";
-    os_ << indent5 << "int shelloffsets[SIMINT_SIMD_LEN] = {0};\n";
+    os_ << indent5 << "int shelloffsets[" << info_.VecLen() << "] = {0};\n";
     os_ << indent5 << "int lastoffset = 0;\n";
-    os_ << indent5 << "const int nlane = ( ((j + SIMINT_SIMD_LEN) < jend) ? SIMINT_SIMD_LEN : (jend - j));\n";
+    os_ << indent5 << "const int nlane = ( ((j + " << info_.VecLen() << ") < jend) ? " << info_.VecLen() << " : (jend - j));\n";
     os_ << "\n";
-    os_ << indent5 << "if((iprimcd + SIMINT_SIMD_LEN) >= nprim_icd)\n";
+    os_ << indent5 << "if((iprimcd + " << info_.VecLen() << ") >= nprim_icd)\n";
     os_ << indent5 << "{\n";
 
     os_ << indent6 << "// Handle if the first element of the vector is a new shell\n";
     os_ << indent6 << "if(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))\n";
     os_ << indent6 << "{\n";
-    os_ << indent7 << "nprim_icd += Q.nprim12[cd + (++icd)];\n";
+    os_ << indent7 << "nprim_icd += Q->nprim12[cd + (++icd)];\n";
 
     for(const auto it : hrr_writer_.Algo().TopAM())
         os_ << indent7 << PrimPtrName(it) << " += " << NCART(it) << ";\n";
@@ -46,13 +46,13 @@ void OSTEI_Writer::WriteShellOffsets(void) const
     os_ << indent6 << "}\n";
     os_ << indent6 << "iprimcd++;\n";
 
-    os_ << indent6 << "for(n = 1; n < SIMINT_SIMD_LEN; ++n)\n";
+    os_ << indent6 << "for(n = 1; n < " << info_.VecLen() << "; ++n)\n";
     os_ << indent6 << "{\n";
     os_ << indent7 << "if(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))\n";
     os_ << indent7 << "{\n";
     os_ << indent8 << "shelloffsets[n] = shelloffsets[n-1] + 1;\n";
     os_ << indent8 << "lastoffset++;\n";
-    os_ << indent8 << "nprim_icd += Q.nprim12[cd + (++icd)];\n";
+    os_ << indent8 << "nprim_icd += Q->nprim12[cd + (++icd)];\n";
     os_ << indent7 << "}\n";
     os_ << indent7 << "else\n";
     os_ << indent8 << "shelloffsets[n] = shelloffsets[n-1];\n";
@@ -60,7 +60,32 @@ void OSTEI_Writer::WriteShellOffsets(void) const
     os_ << indent6 << "}\n";
     os_ << indent5 << "}\n";
     os_ << indent5 << "else\n";
-    os_ << indent6 << "iprimcd += SIMINT_SIMD_LEN;\n\n";
+    os_ << indent6 << "iprimcd += " << info_.VecLen() << ";\n\n";
+}
+
+
+void OSTEI_Writer::WriteScreenedSkip(void) const
+{
+    // The primitives of each ket shell pair are sorted by decreasing
+    // screening value. Once a vector is insignificant, so is the rest of the
+    // shell pair containing its last element (shell icd). Skip to the vector
+    // containing the first primitive of the next shell pair. The vectors in
+    // between belong only to shell icd, so the pointers stay the same.
+    os_ << "\n";
+    os_ << indent7 << "// The rest of shell icd is insignificant, too\n";
+    os_ << indent7 << "if(nprim_icd >= (jend - jstart))\n";
+    os_ << indent7 << "{\n";
+    os_ << indent8 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
+    os_ << indent8 << "skip_nprim += ((jend - j - 1) / " << info_.VecLen() << ") * " << info_.VecLen() << ";\n";
+    os_ << indent8 << "#endif \n";
+    os_ << indent8 << "break;\n";
+    os_ << indent7 << "}\n";
+    os_ << "\n";
+    os_ << indent7 << "iprimcd = (nprim_icd / " << info_.VecLen() << ") * " << info_.VecLen() << ";\n";
+    os_ << indent7 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
+    os_ << indent7 << "skip_nprim += (jstart + iprimcd) - (j + " << info_.VecLen() << ");\n";
+    os_ << indent7 << "#endif \n";
+    os_ << indent7 << "j = jstart + iprimcd - " << info_.VecLen() << ";\n";
 }
 
 
@@ -79,7 +104,7 @@ void OSTEI_Writer::WriteAccumulation(void) const
     for(const auto it : topq)
     {
         int ncart = NCART(it);
-        os_ << indent6 << "contract_all(" << ncart << ", " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
+        os_ << indent6 << info_.VecFunc("contract_all") << "(" << ncart << ", " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
     }
 
     os_ << indent5 << "}\n";
@@ -89,7 +114,7 @@ void OSTEI_Writer::WriteAccumulation(void) const
     for(const auto it : topq)
     {
         int ncart = NCART(it);
-        os_ << indent6 << "contract(" << ncart << ", shelloffsets, " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
+        os_ << indent6 << info_.VecFunc("contract") << "(" << ncart << ", shelloffsets, " << PrimVarName(it) << ", " << PrimPtrName(it) << ");\n";
     }
 
     for(const auto it : topq)
@@ -100,28 +125,90 @@ void OSTEI_Writer::WriteAccumulation(void) const
 
 std::string OSTEI_Writer::FunctionName_(QAM am) const
 {
-    return StringBuilder("ostei_",
+    // The missing centers of 3- and 2-center kernels are not part of the name
+    if(info_.KetOneCenter())
+        return StringBuilder(info_.KernelPrefix(), amchar[am[0]], "_", amchar[am[2]]);
+    if(info_.BraOneCenter())
+        return StringBuilder(info_.KernelPrefix(), amchar[am[0]], "_",
+                             amchar[am[2]], "_", amchar[am[3]]);
+
+    return StringBuilder(info_.KernelPrefix(),
                          amchar[am[0]], "_",
                          amchar[am[1]], "_" ,
                          amchar[am[2]], "_",
                          amchar[am[3]]);
 }
 
+std::string OSTEI_Writer::KernelName_(QAM am) const
+{
+    return StringBuilder(FunctionName_(am), "_ptr");
+}
+
 std::string OSTEI_Writer::FunctionPrototype_(QAM am) const
 {
+    std::string fname = KernelName_(am);
+    std::string indent(fname.length()+1+4, ' '); // +4 for return type
+
+    std::stringstream ss;
+    ss << "int " << fname << "(";
+    ss << "struct simint_multi_shellpair const * const restrict P,\n";
+    ss << indent << "struct simint_multi_shellpair const * const restrict Q,\n";
+    ss << indent << "double screen_tol,\n";
+    ss << indent << "double * const restrict work,\n";
+    ss << indent << "double * const restrict " << ArrVarName(am) << ")";
+    return ss.str();
+}
+
+std::string OSTEI_Writer::ShimDefinition_(QAM am) const
+{
+    // Old by-value entry point, kept for compatibility
     std::string fname = FunctionName_(am);
     std::string indent(fname.length()+1+4, ' '); // +4 for return type
 
     std::stringstream ss;
+    ss << "static inline\n";
     ss << "int " << fname << "(";
     ss << "struct simint_multi_shellpair const P,\n";
     ss << indent << "struct simint_multi_shellpair const Q,\n";
     ss << indent << "double screen_tol,\n";
     ss << indent << "double * const restrict work,\n";
+    ss << indent << "double * const restrict " << ArrVarName(am) << ")\n";
+    ss << "{\n";
+    ss << indent1 << "return " << KernelName_(am) << "(&P, &Q, screen_tol, work, " << ArrVarName(am) << ");\n";
+    ss << "}\n";
+    return ss.str();
+}
+
+std::string OSTEI_Writer::ViewKernelName_(QAM am) const
+{
+    return StringBuilder(FunctionName_(am), "_view");
+}
+
+std::string OSTEI_Writer::ViewPrototype_(QAM am) const
+{
+    // The kernel itself, taking views of the shell pairs so that
+    // permuted kernels can swap centers without copying
+    std::string fname = ViewKernelName_(am);
+    std::string indent(fname.length()+1+4, ' '); // +4 for return type
+
+    std::stringstream ss;
+    ss << "static\n";
+    ss << "int " << fname << "(";
+    ss << "struct simint_multi_shellpair_view const * const restrict Pv,\n";
+    ss << indent << "struct simint_multi_shellpair_view const * const restrict Qv,\n";
+    ss << indent << "double screen_tol,\n";
+    ss << indent << "double * const restrict work,\n";
     ss << indent << "double * const restrict " << ArrVarName(am) << ")";
     return ss.str();
 }
 
+void OSTEI_Writer::WriteViews_(bool swap12, bool swap34) const
+{
+    os_ << indent1 << "struct simint_multi_shellpair_view Pv, Qv;\n";
+    os_ << indent1 << "simint_init_shellpair_view(P, " << (swap12 ? 1 : 0) << ", &Pv);\n";
+    os_ << indent1 << "simint_init_shellpair_view(Q, " << (swap34 ? 1 : 0) << ", &Qv);\n";
+}
+
 void OSTEI_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
 {
     QAM permuted = am;
@@ -142,51 +229,12 @@ void OSTEI_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
     os_ << FunctionPrototype_(permuted) << "\n";
     os_ << "{\n";
 
-    const char * P_var = "P";
-    const char * Q_var = "Q";
-
-    if(swap12)
-    {
-        P_var = "P_tmp";
-        os_ << indent1 << "double P_AB[3*P.nshell12];\n";
-        os_ << indent1 << "struct simint_multi_shellpair P_tmp = P;\n";
-        os_ << indent1 << "P_tmp.PA_x = P.PB_x;  P_tmp.PA_y = P.PB_y;  P_tmp.PA_z = P.PB_z;\n";
-        os_ << indent1 << "P_tmp.PB_x = P.PA_x;  P_tmp.PB_y = P.PA_y;  P_tmp.PB_z = P.PA_z;\n";
-        os_ << indent1 << "P_tmp.AB_x = P_AB;\n";
-        os_ << indent1 << "P_tmp.AB_y = P_AB + P.nshell12;\n";
-        os_ << indent1 << "P_tmp.AB_z = P_AB + 2*P.nshell12;\n";
-        os_ << "\n";
-        os_ << indent1 << "for(int i = 0; i < P.nshell12; i++)\n";
-        os_ << indent1 << "{\n";
-        os_ << indent2 << "P_tmp.AB_x[i] = -P.AB_x[i];\n";
-        os_ << indent2 << "P_tmp.AB_y[i] = -P.AB_y[i];\n";
-        os_ << indent2 << "P_tmp.AB_z[i] = -P.AB_z[i];\n";
-        os_ << indent1 << "}\n\n";
-    }
-
-    if(swap34)
-    {
-        Q_var = "Q_tmp";
-        os_ << indent1 << "double Q_AB[3*Q.nshell12];\n";
-        os_ << indent1 << "struct simint_multi_shellpair Q_tmp = Q;\n";
-        os_ << indent1 << "Q_tmp.PA_x = Q.PB_x;  Q_tmp.PA_y = Q.PB_y;  Q_tmp.PA_z = Q.PB_z;\n";
-        os_ << indent1 << "Q_tmp.PB_x = Q.PA_x;  Q_tmp.PB_y = Q.PA_y;  Q_tmp.PB_z = Q.PA_z;\n";
-        os_ << indent1 << "Q_tmp.AB_x = Q_AB;\n";
-        os_ << indent1 << "Q_tmp.AB_y = Q_AB + Q.nshell12;\n";
-        os_ << indent1 << "Q_tmp.AB_z = Q_AB + 2*Q.nshell12;\n";
-        os_ << "\n";
-        os_ << indent1 << "for(int i = 0; i < Q.nshell12; i++)\n";
-        os_ << indent1 << "{\n";
-        os_ << indent2 << "Q_tmp.AB_x[i] = -Q.AB_x[i];\n";
-        os_ << indent2 << "Q_tmp.AB_y[i] = -Q.AB_y[i];\n";
-        os_ << indent2 << "Q_tmp.AB_z[i] = -Q.AB_z[i];\n";
-        os_ << indent1 << "}\n\n";
-    }
+    // view P and Q with the centers swapped, and call
+    // the kernel for the unpermuted quartet
+    WriteViews_(swap12, swap34);
 
-    std::string fname = FunctionName_(am);
-    os_ << indent1 << "int ret = " << fname
-        << "(" << P_var << ", " << Q_var << ", screen_tol, "
-        << "work, " << ArrVarName(permuted) << ");\n";
+    os_ << indent1 << "int ret = " << ViewKernelName_(am)
+        << "(&Pv, &Qv, screen_tol, work, " << ArrVarName(permuted) << ");\n";
 
 
     if(!IsSpecialPermutation_(permuted))
@@ -242,6 +290,8 @@ void OSTEI_Writer::Write_Permute_(QAM am, bool swap12, bool swap34) const
     os_ << "\n";
 
     osh_ << FunctionPrototype_(permuted) << ";\n\n";
+    if(!info_.Float() && !info_.BraOneCenter())
+        osh_ << ShimDefinition_(permuted) << "\n";
 }
 
 
@@ -273,20 +323,20 @@ void OSTEI_Writer::PartitionWorkspace(void) const
     {
         for(const auto & am : vrr_writer_.Algo().GetAllAM())
         {
-            os_ << indent1 << "SIMINT_DBLTYPE " << PrimVarName(am)
+            os_ << indent1 << info_.VecType() << " " << PrimVarName(am)
                 << "[" << (vrr_writer_.Algo().GetMReq(am)+1) << " * "
                 << NCART(am) << "] SIMINT_ALIGN_ARRAY_DBL;\n";
         }
     }
     else
     {
-        os_ << indent1 << "SIMINT_DBLTYPE * const primwork = (SIMINT_DBLTYPE *)(work + SIMINT_NSHELL_SIMD*" << ptidx << ");\n";
+        os_ << indent1 << info_.VecType() << " * const primwork = (" << info_.VecType() << " *)(work + SIMINT_NSHELL_SIMD*" << ptidx << ");\n";
         ptidx = 0;
 
         for(const auto & am : vrr_writer_.Algo().GetAllAM())
         {
             // add +1 fromm required m values to account for 0
-            os_ << indent1 << "SIMINT_DBLTYPE * const restrict " << PrimVarName(am)
+            os_ << indent1 << info_.VecType() << " * const restrict " << PrimVarName(am)
                 << " = primwork + " << ptidx << ";\n";
 
             ptidx += (vrr_writer_.Algo().GetMReq(am)+1) * NCART(am);
@@ -375,6 +425,23 @@ void OSTEI_Writer::Write_Full_(void) const
                         "\"simint/vectorization/vectorization.h\"",
                         "\"simint/boys/boys.h\""};
 
+    // Float kernels are declared in a separate header, and need
+    // the single-precision vector types and the Boys function wrapper
+    if(info_.Float())
+    {
+        includes.erase("\"simint/ostei/gen/ostei_generated.h\"");
+        includes.insert("\"simint/ostei/gen/ostei_float_generated.h\"");
+        includes.insert("\"simint/vectorization/vectorization_float.h\"");
+        includes.insert("\"simint/boys/boys_float.h\"");
+    }
+
+    // As are the 3- and 2-center kernels
+    if(info_.BraOneCenter())
+    {
+        includes.erase("\"simint/ostei/gen/ostei_generated.h\"");
+        includes.insert("\"simint/ostei/gen/ostei_df_generated.h\"");
+    }
+
     // Constants
     ConstantMap cm;
     cm.emplace("const_1", "1");  // for 1/x
@@ -402,10 +469,12 @@ void OSTEI_Writer::Write_Full_(void) const
     //////////////////////////////
     // Function name & signature
     //////////////////////////////
-    os_ << FunctionPrototype_(am) << "\n";
+    os_ << ViewPrototype_(am) << "\n";
     os_ << "{\n";
     os_ << "\n";
 
+    os_ << indent1 << "struct simint_multi_shellpair const * const restrict P = Pv->pair;\n";
+    os_ << indent1 << "struct simint_multi_shellpair const * const restrict Q = Qv->pair;\n\n";
     os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(work);\n";
     os_ << indent1 << "SIMINT_ASSUME_ALIGN_DBL(" << ArrVarName(am) << ");\n";
 
@@ -417,7 +486,7 @@ void OSTEI_Writer::Write_Full_(void) const
     // directly into the final integral array that was passed into this function, so it must be zeroed first
     if(!hashrr)
         os_ << indent1 << "memset(" << ArrVarName(am)
-                       << ", 0, P.nshell12_clip * Q.nshell12_clip * "
+                       << ", 0, P->nshell12_clip * Q->nshell12_clip * "
                        << ncart << " * sizeof(double));\n\n";
 
 
@@ -448,10 +517,12 @@ void OSTEI_Writer::Write_Full_(void) const
 
     os_ << indent1 << "// Create constants\n";
     for(const auto & it : cm)
-        os_ << indent1 << "const SIMINT_DBLTYPE " << it.first << " = SIMINT_DBLSET1(" << it.second << ");\n";
+        os_ << indent1 << "const " << info_.VecType() << " " << it.first << " = " << info_.VecSet1(it.second) << ";\n";
 
     os_ << "\n";
     os_ << indent1 << "#ifdef SIMINT_PRIM_SCREEN_STAT  // Statistic info for primitive screening \n";
+    os_ << indent1 << "// calc_nvec + skip_nvec is the number of vectors that were visited.\n";
+    os_ << indent1 << "// Primitives skipped without being visited only count in skip_nprim\n";
     os_ << indent1 << "int calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0;\n";
     os_ << indent1 << "#endif\n";
     
@@ -467,23 +538,23 @@ void OSTEI_Writer::Write_Full_(void) const
         os_ << indent1 << "abcd = 0;\n";
 
     os_ << indent1 << "istart = 0;\n";
-    os_ << indent1 << "for(ab = 0; ab < P.nshell12_clip; ++ab)\n";
+    os_ << indent1 << "for(ab = 0; ab < P->nshell12_clip; ++ab)\n";
     os_ << indent1 << "{\n";
 
-    os_ << indent2 << "const int iend = istart + P.nprim12[ab];\n";
+    os_ << indent2 << "const int iend = istart + P->nprim12[ab];\n";
     os_ << "\n";
 
     os_ << indent2 << "cd = 0;\n";
     os_ << indent2 << "jstart = 0;\n";
     os_ << "\n";
 
-    os_ << indent2 << "for(cd = 0; cd < Q.nshell12_clip; cd += SIMINT_NSHELL_SIMD)\n";
+    os_ << indent2 << "for(cd = 0; cd < Q->nshell12_clip; cd += SIMINT_NSHELL_SIMD)\n";
     os_ << indent2 << "{\n";
-    os_ << indent3 << "const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q.nshell12_clip) ? Q.nshell12_clip - cd : SIMINT_NSHELL_SIMD;\n";
+    os_ << indent3 << "const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q->nshell12_clip) ? Q->nshell12_clip - cd : SIMINT_NSHELL_SIMD;\n";
 
     os_ << indent3 << "int jend = jstart;\n";
     os_ << indent3 << "for(i = 0; i < nshellbatch; i++)\n";
-    os_ << indent4 << "jend += Q.nprim12[cd+i];\n";
+    os_ << indent4 << "jend += Q->nprim12[cd+i];\n";
     os_ << "\n";
 
 
@@ -498,145 +569,149 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << "\n";
     os_ << indent3 << "for(i = istart; i < iend; ++i)\n";
     os_ << indent3 << "{\n";
-    os_ << indent4 << "SIMINT_DBLTYPE bra_screen_max;  // only used if check_screen\n\n";
-    os_ << indent4 << "bra_screen_max = SIMINT_DBLSET1(0.);\n";
+    os_ << indent4 << info_.VecType() << " bra_screen_max;  // only used if check_screen\n\n";
+    os_ << indent4 << "bra_screen_max = " << info_.VecSet1("0.") << ";\n";
 
     os_ << indent4 << "if(check_screen)\n";
     os_ << indent4 << "{\n";
-    os_ << indent5 << "// Skip this whole thing if always insignificant\n";
-    os_ << indent5 << "if((P.screen[i] * Q.screen_max) < screen_tol)\n";
+    os_ << indent5 << "// Skip this whole thing if always insignificant.\n";
+    os_ << indent5 << "// The primitives are sorted by decreasing screening value,\n";
+    os_ << indent5 << "// so the rest of this shell pair is insignificant, too\n";
+    os_ << indent5 << "if((P->screen[i] * Q->screen_max) < screen_tol)\n";
     os_ << indent5 << "{\n";
     os_ << indent6 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
     os_ << indent6 << "int j_len = jend - jstart; \n";
-    os_ << indent6 << "skip_nprim += j_len; \n";
-    os_ << indent6 << "skip_nvec  += (j_len + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN; \n";
+    os_ << indent6 << "skip_nprim += j_len * (iend - i); \n";
+    os_ << indent6 << "skip_nvec  += (j_len + " << info_.VecLen() << " - 1) / " << info_.VecLen() << "; \n";
     os_ << indent6 << "#endif \n";
-    os_ << indent6 << "continue;\n";
+    os_ << indent6 << "break;\n";
     os_ << indent5 << "}\n";
 
-    os_ << indent5 << "bra_screen_max = SIMINT_DBLSET1(P.screen[i]);\n";
+    os_ << indent5 << "bra_screen_max = " << info_.VecSet1("P->screen[i]") << ";\n";
     os_ << indent4 << "}\n\n";
 
     os_ << indent4 << "icd = 0;\n";
     os_ << indent4 << "iprimcd = 0;\n";
-    os_ << indent4 << "nprim_icd = Q.nprim12[cd];\n";
+    os_ << indent4 << "nprim_icd = Q->nprim12[cd];\n";
 
     DeclarePrimPointers();
     os_ << "\n";
 
     os_ << indent4 << "// Load these one per loop over i\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE P_alpha = SIMINT_DBLSET1(P.alpha[i]);\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE P_prefac = SIMINT_DBLSET1(P.prefac[i]);\n";
-    os_ << indent4 << "const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLSET1(P.x[i]), SIMINT_DBLSET1(P.y[i]), SIMINT_DBLSET1(P.z[i]) };\n";
+    os_ << indent4 << "const " << info_.VecType() << " P_alpha = " << info_.VecSet1("P->alpha[i]") << ";\n";
+    os_ << indent4 << "const " << info_.VecType() << " P_prefac = " << info_.VecSet1("P->prefac[i]") << ";\n";
+    os_ << indent4 << "const " << info_.VecType() << " Pxyz[3] = { " << info_.VecSet1("P->x[i]") << ", " << info_.VecSet1("P->y[i]") << ", " << info_.VecSet1("P->z[i]") << " };\n";
 
     os_ << "\n";
 
-    if(hasbravrr)
+    // P = A for a single center, so there is no PA
+    if(hasbravrr && !info_.BraOneCenter())
     {
         if(vrr_writer_.Algo().HasVRR_I())
-            os_ << indent4 << "const SIMINT_DBLTYPE P_PA[3] = { SIMINT_DBLSET1(P.PA_x[i]), SIMINT_DBLSET1(P.PA_y[i]), SIMINT_DBLSET1(P.PA_z[i]) };\n";
+            os_ << indent4 << "const " << info_.VecType() << " P_PA[3] = { " << info_.VecSet1("Pv->PA_x[i]") << ", " << info_.VecSet1("Pv->PA_y[i]") << ", " << info_.VecSet1("Pv->PA_z[i]") << " };\n";
         else
-            os_ << indent4 << "const SIMINT_DBLTYPE P_PB[3] = { SIMINT_DBLSET1(P.PB_x[i]), SIMINT_DBLSET1(P.PB_y[i]), SIMINT_DBLSET1(P.PB_z[i]) };\n";
+            os_ << indent4 << "const " << info_.VecType() << " P_PB[3] = { " << info_.VecSet1("Pv->PB_x[i]") << ", " << info_.VecSet1("Pv->PB_y[i]") << ", " << info_.VecSet1("Pv->PB_z[i]") << " };\n";
     }
 
     os_ << "\n";
 
 
-    os_ << indent4 << "for(j = jstart; j < jend; j += SIMINT_SIMD_LEN)\n";
+    os_ << indent4 << "for(j = jstart; j < jend; j += " << info_.VecLen() << ")\n";
     os_ << indent4 << "{\n";
 
     WriteShellOffsets();
 
 
-    os_ << indent5 << "SIMINT_DBLTYPE prim_screen_res = SIMINT_DBLSET1(0.);\n";
+    os_ << indent5 << info_.VecType() << " prim_screen_res = " << info_.VecSet1("0.") << ";\n";
     os_ << indent5 << "if(check_screen)\n";
     os_ << indent5 << "{\n";
     os_ << indent6 << "// Do we have to compute this vector (or has it been screened out)?\n";
     os_ << indent6 << "// (not_screened != 0 means we have to do this vector)\n";
-    os_ << indent6 << "prim_screen_res = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));\n";
-    os_ << indent6 << "const double vmax = vector_max(prim_screen_res);\n";
+    os_ << indent6 << "prim_screen_res = " << info_.VecOp("MUL") << "(bra_screen_max, " << info_.VecLoad("Q->screen", "j") << ");\n";
+    os_ << indent6 << "const double vmax = " << info_.VecFunc("vector_max") << "(prim_screen_res);\n";
     os_ << indent6 << "if(vmax < screen_tol)\n";
     os_ << indent6 << "{\n";
     os_ << indent7 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
     os_ << indent7 << "skip_nvec++; \n";
-    os_ << indent7 << "skip_nprim += SIMINT_SIMD_LEN; \n";
+    os_ << indent7 << "skip_nprim += " << info_.VecLen() << "; \n";
     os_ << indent7 << "#endif \n";
     for(const auto it : batchcontq)
         os_ << indent7 << PrimPtrName(it) << " += lastoffset*" << NCART(it) << ";\n";
+    WriteScreenedSkip();
     os_ << indent7 << "continue;\n";
     os_ << indent6 << "}\n";
     os_ << indent5 << "}\n";
     os_ << indent5 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
     os_ << indent5 << "calc_nvec++; \n";
-    os_ << indent5 << "int calc_nprim_in_vec = count_prim_screen_survival(prim_screen_res, screen_tol); \n";
+    os_ << indent5 << "int calc_nprim_in_vec = " << info_.VecFunc("count_prim_screen_survival") << "(prim_screen_res, screen_tol); \n";
     os_ << indent5 << "calc_nprim += calc_nprim_in_vec; \n";
-    os_ << indent5 << "skip_nprim += (SIMINT_SIMD_LEN - calc_nprim_in_vec); \n";
+    os_ << indent5 << "skip_nprim += (" << info_.VecLen() << " - calc_nprim_in_vec); \n";
     os_ << indent5 << "#endif \n\n";
 
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_mul = SIMINT_MUL(P_alpha, Q_alpha);\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE PQalpha_sum = SIMINT_ADD(P_alpha, Q_alpha);\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE one_over_PQalpha_sum = SIMINT_DIV(const_1, PQalpha_sum);\n";
+    os_ << indent5 << "const " << info_.VecType() << " Q_alpha = " << info_.VecLoad("Q->alpha", "j") << ";\n";
+    os_ << indent5 << "const " << info_.VecType() << " PQalpha_mul = " << info_.VecOp("MUL") << "(P_alpha, Q_alpha);\n";
+    os_ << indent5 << "const " << info_.VecType() << " PQalpha_sum = " << info_.VecOp("ADD") << "(P_alpha, Q_alpha);\n";
+    os_ << indent5 << "const " << info_.VecType() << " one_over_PQalpha_sum = " << info_.VecOp("DIV") << "(const_1, PQalpha_sum);\n";
     os_ << "\n";
     os_ << "\n";
     os_ << indent5 << "/* construct R2 = (Px - Qx)**2 + (Py - Qy)**2 + (Pz -Qz)**2 */\n";
-    os_ << indent5 << "SIMINT_DBLTYPE PQ[3];\n";
-    os_ << indent5 << "PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));\n";
-    os_ << indent5 << "PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));\n";
-    os_ << indent5 << "PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));\n";
+    os_ << indent5 << info_.VecType() << " PQ[3];\n";
+    os_ << indent5 << "PQ[0] = " << info_.VecOp("SUB") << "(Pxyz[0], " << info_.VecLoad("Q->x", "j") << ");\n";
+    os_ << indent5 << "PQ[1] = " << info_.VecOp("SUB") << "(Pxyz[1], " << info_.VecLoad("Q->y", "j") << ");\n";
+    os_ << indent5 << "PQ[2] = " << info_.VecOp("SUB") << "(Pxyz[2], " << info_.VecLoad("Q->z", "j") << ");\n";
 
 
-    os_ << indent5 << "SIMINT_DBLTYPE R2 = SIMINT_MUL(PQ[0], PQ[0]);\n";
-    os_ << indent5 << "R2 = SIMINT_FMADD(PQ[1], PQ[1], R2);\n";
-    os_ << indent5 << "R2 = SIMINT_FMADD(PQ[2], PQ[2], R2);\n";
+    os_ << indent5 << info_.VecType() << " R2 = " << info_.VecOp("MUL") << "(PQ[0], PQ[0]);\n";
+    os_ << indent5 << "R2 = " << info_.VecOp("FMADD") << "(PQ[1], PQ[1], R2);\n";
+    os_ << indent5 << "R2 = " << info_.VecOp("FMADD") << "(PQ[2], PQ[2], R2);\n";
     os_ << "\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE alpha = SIMINT_MUL(PQalpha_mul, one_over_PQalpha_sum); // alpha from MEST\n";
+    os_ << indent5 << "const " << info_.VecType() << " alpha = " << info_.VecOp("MUL") << "(PQalpha_mul, one_over_PQalpha_sum); // alpha from MEST\n";
 
     if(hasoneoverp)
-        os_ << indent5 << "const SIMINT_DBLTYPE one_over_p = SIMINT_DIV(const_1, P_alpha);\n";
+        os_ << indent5 << "const " << info_.VecType() << " one_over_p = " << info_.VecOp("DIV") << "(const_1, P_alpha);\n";
 
     if(hasoneoverq)
-        os_ << indent5 << "const SIMINT_DBLTYPE one_over_q = SIMINT_DIV(const_1, Q_alpha);\n";
+        os_ << indent5 << "const " << info_.VecType() << " one_over_q = " << info_.VecOp("DIV") << "(const_1, Q_alpha);\n";
 
     if(hasoneover2p)
-        os_ << indent5 << "const SIMINT_DBLTYPE one_over_2p = SIMINT_MUL(one_half, one_over_p);\n";
+        os_ << indent5 << "const " << info_.VecType() << " one_over_2p = " << info_.VecOp("MUL") << "(one_half, one_over_p);\n";
 
     if(hasoneover2q)
-        os_ << indent5 << "const SIMINT_DBLTYPE one_over_2q = SIMINT_MUL(one_half, one_over_q);\n";
+        os_ << indent5 << "const " << info_.VecType() << " one_over_2q = " << info_.VecOp("MUL") << "(one_half, one_over_q);\n";
 
     if(hasoneover2pq)
-        os_ << indent5 << "const SIMINT_DBLTYPE one_over_2pq = SIMINT_MUL(one_half, one_over_PQalpha_sum);\n";
+        os_ << indent5 << "const " << info_.VecType() << " one_over_2pq = " << info_.VecOp("MUL") << "(one_half, one_over_PQalpha_sum);\n";
 
-    if(hasketvrr)
+    if(hasketvrr && !info_.KetOneCenter())
     {
         if(vrr_writer_.Algo().HasVRR_K())
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PA[3] = { SIMINT_DBLLOAD(Q.PA_x, j), SIMINT_DBLLOAD(Q.PA_y, j), SIMINT_DBLLOAD(Q.PA_z, j) };\n";
+            os_ << indent5 << "const " << info_.VecType() << " Q_PA[3] = { " << info_.VecLoad("Qv->PA_x", "j") << ", " << info_.VecLoad("Qv->PA_y", "j") << ", " << info_.VecLoad("Qv->PA_z", "j") << " };\n";
         else
-            os_ << indent5 << "const SIMINT_DBLTYPE Q_PB[3] = { SIMINT_DBLLOAD(Q.PB_x, j), SIMINT_DBLLOAD(Q.PB_y, j), SIMINT_DBLLOAD(Q.PB_z, j) };\n";
+            os_ << indent5 << "const " << info_.VecType() << " Q_PB[3] = { " << info_.VecLoad("Qv->PB_x", "j") << ", " << info_.VecLoad("Qv->PB_y", "j") << ", " << info_.VecLoad("Qv->PB_z", "j") << " };\n";
     }
 
     if(hasbravrr)
     {
         os_ << "\n";
         os_ << indent5 << "// NOTE: Minus sign!\n";
-        os_ << indent5 << "const SIMINT_DBLTYPE a_over_p = SIMINT_MUL(SIMINT_NEG(alpha), one_over_p);\n";
-        os_ << indent5 << "SIMINT_DBLTYPE aop_PQ[3];\n";
-        os_ << indent5 << "aop_PQ[0] = SIMINT_MUL(a_over_p, PQ[0]);\n";
-        os_ << indent5 << "aop_PQ[1] = SIMINT_MUL(a_over_p, PQ[1]);\n";
-        os_ << indent5 << "aop_PQ[2] = SIMINT_MUL(a_over_p, PQ[2]);\n";
+        os_ << indent5 << "const " << info_.VecType() << " a_over_p = " << info_.VecOp("MUL") << "(" << info_.VecOp("NEG") << "(alpha), one_over_p);\n";
+        os_ << indent5 << info_.VecType() << " aop_PQ[3];\n";
+        os_ << indent5 << "aop_PQ[0] = " << info_.VecOp("MUL") << "(a_over_p, PQ[0]);\n";
+        os_ << indent5 << "aop_PQ[1] = " << info_.VecOp("MUL") << "(a_over_p, PQ[1]);\n";
+        os_ << indent5 << "aop_PQ[2] = " << info_.VecOp("MUL") << "(a_over_p, PQ[2]);\n";
     }
 
     if(hasketvrr)
     {
         os_ << "\n";
-        os_ << indent5 << "SIMINT_DBLTYPE a_over_q = SIMINT_MUL(alpha, one_over_q);\n";
-        os_ << indent5 << "SIMINT_DBLTYPE aoq_PQ[3];\n";
-        os_ << indent5 << "aoq_PQ[0] = SIMINT_MUL(a_over_q, PQ[0]);\n";
-        os_ << indent5 << "aoq_PQ[1] = SIMINT_MUL(a_over_q, PQ[1]);\n";
-        os_ << indent5 << "aoq_PQ[2] = SIMINT_MUL(a_over_q, PQ[2]);\n";
+        os_ << indent5 << info_.VecType() << " a_over_q = " << info_.VecOp("MUL") << "(alpha, one_over_q);\n";
+        os_ << indent5 << info_.VecType() << " aoq_PQ[3];\n";
+        os_ << indent5 << "aoq_PQ[0] = " << info_.VecOp("MUL") << "(a_over_q, PQ[0]);\n";
+        os_ << indent5 << "aoq_PQ[1] = " << info_.VecOp("MUL") << "(a_over_q, PQ[1]);\n";
+        os_ << indent5 << "aoq_PQ[2] = " << info_.VecOp("MUL") << "(a_over_q, PQ[2]);\n";
 
         os_ << indent5 << "// Put a minus sign here so we don't have to in RR routines\n";
-        os_ << indent5 << "a_over_q = SIMINT_NEG(a_over_q);\n";
+        os_ << indent5 << "a_over_q = " << info_.VecOp("NEG") << "(a_over_q);\n";
     }
 
     os_ << "\n";
@@ -646,26 +721,26 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent5 << "// Maximum v value: " << info_.L() << "\n";
     os_ << indent5 << "//////////////////////////////////////////////\n";
     os_ << indent5 << "// The parameter to the Fjt function\n";
-    os_ << indent5 << "const SIMINT_DBLTYPE F_x = SIMINT_MUL(R2, alpha);\n";
+    os_ << indent5 << "const " << info_.VecType() << " F_x = " << info_.VecOp("MUL") << "(R2, alpha);\n";
     os_ << "\n";
     os_ << "\n";
 
     // we need to zero out any that are beyond the end of the batch (that's been clipped)
-    os_ << indent5 << "const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);\n";
+    os_ << indent5 << "const " << info_.VecType() << " Q_prefac = " << info_.VecFunc("mask_load") << "(nlane, Q->prefac + j);\n";
     os_ << "\n\n";
-    os_ << indent5 << "boys_F_split(" << PrimVarName({0,0,0,0})
+    os_ << indent5 << info_.VecFunc("boys_F_split") << "(" << PrimVarName({0,0,0,0})
                    << ", F_x, " << info_.L() << ");\n";
 
 
     // prefac = sqrt(1/PQalpha_sum) * P_prefac * Q_prefac
-    os_ << indent5 << "SIMINT_DBLTYPE prefac = SIMINT_SQRT(one_over_PQalpha_sum);\n";
-    os_ << indent5 << "prefac = SIMINT_MUL(SIMINT_MUL(P_prefac, Q_prefac), prefac);\n";
+    os_ << indent5 << info_.VecType() << " prefac = " << info_.VecOp("SQRT") << "(one_over_PQalpha_sum);\n";
+    os_ << indent5 << "prefac = " << info_.VecOp("MUL") << "(" << info_.VecOp("MUL") << "(P_prefac, Q_prefac), prefac);\n";
 
     const std::string name0000 = PrimVarName({0,0,0,0});
     const std::string name0000n = name0000 + "[n]";
 
     os_ << indent5 << "for(n = 0; n <= " << info_.L() << "; n++)\n"
-        << indent6 << name0000n << " = SIMINT_MUL(" << name0000n << ", prefac);\n";
+        << indent6 << name0000n << " = " << info_.VecOp("MUL") << "(" << name0000n << ", prefac);\n";
 
 
     if(vrr_writer_.Algo().HasVRR())
@@ -697,26 +772,28 @@ void OSTEI_Writer::Write_Full_(void) const
     os_ << indent2 << "}   // close loop cdbatch\n";
 
     os_ << "\n";
-    os_ << indent2 << "istart = iend;\n";
+    os_ << indent2 << "// the primitives are padded to a multiple of the vector\n";
+    os_ << indent2 << "// length after every SIMINT_NSHELL_SIMD shell pairs\n";
+    os_ << indent2 << "istart = (((ab + 1) % SIMINT_NSHELL_SIMD) == 0) ? SIMINT_SIMD_ROUND(iend) : iend;\n";
 
     os_ << indent1 << "}  // close loop over ab\n";
     os_ << "\n";
     
     os_ << indent1 << "#ifdef SIMINT_PRIM_SCREEN_STAT \n";
-    os_ << indent1 << "double *eri_res_end_pos = " << ArrVarName(am) << " + " << ncart << " * P.nshell12_clip * Q.nshell12_clip; \n";
+    os_ << indent1 << "double *eri_res_end_pos = " << ArrVarName(am) << " + " << ncart << " * P->nshell12_clip * Q->nshell12_clip; \n";
     os_ << indent1 << "eri_res_end_pos[0] = (double) calc_nprim; \n";
     os_ << indent1 << "eri_res_end_pos[1] = (double) skip_nprim; \n";
     os_ << indent1 << "eri_res_end_pos[2] = (double) calc_nvec; \n";
     os_ << indent1 << "eri_res_end_pos[3] = (double) skip_nvec; \n";
     os_ << indent1 << "#endif \n";
     
-    os_ << indent1 << "return P.nshell12_clip * Q.nshell12_clip;\n";
+    os_ << indent1 << "return P->nshell12_clip * Q->nshell12_clip;\n";
     os_ << "}\n";
     os_ << "\n";
 
 
     // Write out memory requirement to the log file
-    std::cout << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
+    info_.Log() << "\nWORK SIZE: " << bcont_nelements << "  " << prim_nelements << " " << cont_nelements << "\n";
 }
 
 
@@ -724,10 +801,22 @@ void OSTEI_Writer::Write_Permutations_(void) const
 {
     ///////////////////////////////////////////////////////////
     // Note that we never permute bra, ket. That would
-    // affect vectorization since we only vectorize on the ket
+    // affect vectorization since we only vectorize on the ket.
+    // Instead, simint_compute_ostei decides at run time whether
+    // to swap them (see use_swapped in ostei.c)
     ///////////////////////////////////////////////////////////
     QAM am = info_.FinalAM();
 
+    // The missing centers of 3- and 2-center kernels must stay
+    // where they are. Only 3,4 can be permuted, and only with 3 centers
+    if(info_.KetOneCenter())
+        return;
+    if(info_.BraOneCenter())
+    {
+        Write_Permute_(am, false, true);
+        return;
+    }
+
     // permute 1,2
     Write_Permute_(am, true, false);
 
@@ -746,9 +835,22 @@ void OSTEI_Writer::WriteFile(void) const
     // is this a special permutation? Handle it if so.
     Write_Full_();
 
+    // The entry point views the shell pairs as they are
+    os_ << FunctionPrototype_(am) << "\n";
+    os_ << "{\n";
+    WriteViews_(false, false);
+    os_ << indent1 << "return " << ViewKernelName_(am)
+        << "(&Pv, &Qv, screen_tol, work, " << ArrVarName(am) << ");\n";
+    os_ << "}\n\n";
+
     // Add to the header
     osh_ << FunctionPrototype_(am) << ";\n\n";
 
+    // Float and 3- and 2-center kernels are new, and so don't
+    // need the by-value entry point
+    if(!info_.Float() && !info_.BraOneCenter())
+        osh_ << ShimDefinition_(am) << "\n";
+
     // Write out the code for permuting final integrals, if necessary
     if(info_.FinalPermute())
         Write_Permutations_();
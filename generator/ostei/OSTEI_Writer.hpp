@@ -53,10 +53,16 @@ public:
 private:
     void PartitionWorkspace(void) const;
     void WriteShellOffsets(void) const;
+    void WriteScreenedSkip(void) const;
     void WriteAccumulation(void) const;
 
     std::string FunctionName_(QAM am) const;
+    std::string KernelName_(QAM am) const;
     std::string FunctionPrototype_(QAM am) const;
+    std::string ShimDefinition_(QAM am) const;
+    std::string ViewKernelName_(QAM am) const;
+    std::string ViewPrototype_(QAM am) const;
+    void WriteViews_(bool swap12, bool swap34) const;
 
     bool IsSpecialPermutation_(QAM am) const;
     void Write_Full_(void) const;
@@ -77,11 +83,17 @@ public:
 private:
     void PartitionWorkspace(void) const;
     void WriteShellOffsets(void) const;
+    void WriteScreenedSkip(void) const;
     void WriteAccumulation(void) const;
     void WriteFormDeriv(void) const;
 
     std::string FunctionName_(QAM am) const;
+    std::string KernelName_(QAM am) const;
     std::string FunctionPrototype_(QAM am) const;
+    std::string ShimDefinition_(QAM am) const;
+    std::string ViewKernelName_(QAM am) const;
+    std::string ViewPrototype_(QAM am) const;
+    void WriteViews_(bool swap12, bool swap34) const;
 
     void Write_Full_(void) const;
     void Write_Permutations_(void) const;
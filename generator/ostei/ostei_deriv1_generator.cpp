@@ -1,14 +1,12 @@
 #include <stdexcept>
 #include <fstream>
+#include <iostream>
 
 #include "generator/CommandLine.hpp"
+#include "generator/QuartetOptions.hpp"
 #include "generator/StringBuilder.hpp"
 
-#include "generator/ostei/Algorithms.hpp"
-#include "generator/ostei/OSTEI_GeneratorInfo.hpp"
-#include "generator/ostei/OSTEI_VRR_Writer.hpp"
-#include "generator/ostei/OSTEI_HRR_Writer.hpp"
-#include "generator/ostei/OSTEI_Writer.hpp"
+#include "generator/ostei/OSTEI_Generate.hpp"
 #include "generator/Printing.hpp"
 
 int main(int argc, char ** argv)
@@ -19,6 +17,7 @@ int main(int argc, char ** argv)
     // other stuff
     std::string fpath;
     std::string hpath;
+    std::string qopath;
     QAM finalam{0,0,0,0};
 
     bool finalamset = false;
@@ -36,6 +35,8 @@ int main(int argc, char ** argv)
             fpath = GetNextArg(iarg, otheropt);
         else if(argstr == "-oh")
             hpath = GetNextArg(iarg, otheropt);
+        else if(argstr == "-qo")
+            qopath = GetNextArg(iarg, otheropt);
         else if(argstr == "-q")
         {
             finalam[0] = GetIArg(iarg, otheropt);   
@@ -60,6 +61,10 @@ int main(int argc, char ** argv)
     CMDLINE_ASSERT( hpath != "", "output header file path (-oh) required" )
     CMDLINE_ASSERT( finalamset == true, "AM quartet (-q) required" )
 
+    // per-quartet options override the ones given on the command line
+    if(qopath != "")
+        options = OptionsForQuartet(options, ReadQuartetOptions(qopath), finalam);
+
 
     // open the output file
     // actually create
@@ -75,73 +80,7 @@ int main(int argc, char ** argv)
         throw std::runtime_error(StringBuilder("Cannot open file: ", hpath, "\n"));
     
 
-    // Information for this OSTEI
-    OSTEI_GeneratorInfo info(finalam, 1, options);
-
-
-    //////////////////////////////////////////////////////////////
-    //! \todo Are there special permutations for derivatives?
-    //////////////////////////////////////////////////////////////
-
-    // algorithms used
-    Makowski_HRR hrralgo(info);
-    Makowski_VRR vrralgo(info);
-
-    // Working backwards, I need:
-    // 1.) HRR Steps
-    //     We need the different increments, decrements for derivatives
-    std::set<QAM> needed_am;
-
-    // We only need to do three centers. The fourth is free
-    // Find which one to skip
-    int max = *(std::max_element(finalam.begin(), finalam.end()));
-    
-    int missing_center;
-    if(finalam[0] == max)
-        missing_center = 0;
-    else if(finalam[1] == max)
-        missing_center = 1;
-    else if(finalam[2] == max)
-        missing_center = 2;
-    else
-        missing_center = 3;
-    
-    const char * dir[4] = {"2a", "2b", "2c", "2d"};
-    for(int i = 0; i < 4; i++)
-    {
-        if(i == missing_center)
-            continue;
-
-        QAM amtmp_p(finalam.qam, dir[i]);
-        QAM amtmp_m(finalam);
-        amtmp_p.qam[i]++;
-        amtmp_m.qam[i]--;
-
-        needed_am.insert(amtmp_p);
-        if(ValidQAM(amtmp_m))
-            needed_am.insert(amtmp_m);
-    }
-
-    info.SetDeriv1_MissingCenter(missing_center);
-
-    hrralgo.Create(needed_am);
-    OSTEI_HRR_Writer hrr_writer(hrralgo, info,
-                                options[Option::ExternalHRR],
-                                options[Option::GeneralHRR]);
-
-    QuartetSet topquartets = hrralgo.TopQuartets();
-
-    // 2.) VRR Steps
-    vrralgo.Create(topquartets);
-    OSTEI_VRR_Writer vrr_writer(vrralgo, info,
-                                options[Option::ExternalVRR],
-                                options[Option::GeneralVRR]);
-
-
-    // Create the OSTEI_Writer and write the file
-    OSTEIDeriv1_Writer ostei_deriv1_writer(of, ofh, info, vrr_writer, hrr_writer);
-    ostei_deriv1_writer.WriteFile();
-
+    GenerateOSTEIDeriv1(finalam, options, of, ofh, std::cout);
 
 
     }
@@ -1,14 +1,12 @@
 #include <stdexcept>
 #include <fstream>
+#include <iostream>
 
 #include "generator/CommandLine.hpp"
+#include "generator/QuartetOptions.hpp"
 #include "generator/StringBuilder.hpp"
 
-#include "generator/ostei/Algorithms.hpp"
-#include "generator/ostei/OSTEI_GeneratorInfo.hpp"
-#include "generator/ostei/OSTEI_VRR_Writer.hpp"
-#include "generator/ostei/OSTEI_HRR_Writer.hpp"
-#include "generator/ostei/OSTEI_Writer.hpp"
+#include "generator/ostei/OSTEI_Generate.hpp"
 
 
 int main(int argc, char ** argv)
@@ -19,6 +17,7 @@ int main(int argc, char ** argv)
     // other stuff
     std::string fpath;
     std::string hpath;
+    std::string qopath;
     QAM finalam{0,0,0,0};
 
     bool finalamset = false;
@@ -36,6 +35,8 @@ int main(int argc, char ** argv)
             fpath = GetNextArg(iarg, otheropt);
         else if(argstr == "-oh")
             hpath = GetNextArg(iarg, otheropt);
+        else if(argstr == "-qo")
+            qopath = GetNextArg(iarg, otheropt);
         else if(argstr == "-q")
         {
             finalam[0] = GetIArg(iarg, otheropt);   
@@ -60,6 +61,10 @@ int main(int argc, char ** argv)
     CMDLINE_ASSERT( hpath != "", "output header file path (-oh) required" )
     CMDLINE_ASSERT( finalamset == true, "AM quartet (-q) required" )
 
+    // per-quartet options override the ones given on the command line
+    if(qopath != "")
+        options = OptionsForQuartet(options, ReadQuartetOptions(qopath), finalam);
+
 
     // open the output file
     // actually create
@@ -75,39 +80,7 @@ int main(int argc, char ** argv)
         throw std::runtime_error(StringBuilder("Cannot open file: ", hpath, "\n"));
     
 
-    // Information for this OSTEI
-    OSTEI_GeneratorInfo info(finalam, 0, options);
-
-
-    //////////////////////////////////////////////////////////////
-    //! \todo We are doing all this work even if it is a special
-    //        permutation
-    //////////////////////////////////////////////////////////////
-    
-    // algorithms used
-    Makowski_HRR hrralgo(info);
-    Makowski_VRR vrralgo(info);
-
-    // Working backwards, I need:
-    // 1.) HRR Steps
-    hrralgo.Create(finalam);
-    OSTEI_HRR_Writer hrr_writer(hrralgo, info,
-                                options[Option::ExternalHRR],
-                                options[Option::GeneralHRR]);
-
-    QuartetSet topquartets = hrralgo.TopQuartets();
-
-    // 2.) VRR Steps
-    vrralgo.Create(topquartets);
-    OSTEI_VRR_Writer vrr_writer(vrralgo, info,
-                                options[Option::ExternalVRR],
-                                options[Option::GeneralVRR]);
-
-
-    // Create the OSTEI_Writer and write the file
-    OSTEI_Writer ostei_writer(of, ofh, info, vrr_writer, hrr_writer);
-    ostei_writer.WriteFile();
-
+    GenerateOSTEI(finalam, options, of, ofh, std::cout);
 
 
     }
@@ -0,0 +1,319 @@
+#include <stdexcept>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "generator/CommandLine.hpp"
+#include "generator/QuartetOptions.hpp"
+#include "generator/StringBuilder.hpp"
+
+#include "generator/ostei/OSTEI_Generate.hpp"
+
+
+// Generates many OSTEI quartets from a single process, using
+// several threads. Work that is common between quartets (HRR steps)
+// is only done once per thread.
+//
+// Quartets can be given with -q (repeated), -l (all quartets up to an AM),
+// or with a job file (-f). Each line of the job file is
+//
+//     am1 am2 am3 am4 permute source_file header_file log_file
+//
+// and gives the same results as running ostei_generator (or
+// ostei_deriv1_generator) with
+//
+//     -q am1 am2 am3 am4 [-p] -o source_file -oh header_file > log_file
+//
+// Single-precision kernels (ostei_flt_*) are generated with -flt, and
+// 3- and 2-center kernels (ostei_3c_*, ostei_2c_*) with -nc 3 or -nc 2.
+// The missing centers must have zero AM in the quartets
+//
+// The header output is written once all quartets are done, in the order
+// the quartets were given, so it does not depend on the number of threads.
+//
+// Options for individual quartets can be given in a file with -qo
+// (see ReadQuartetOptions).
+
+
+namespace {
+
+struct GenerationJob
+{
+    QAM am{0,0,0,0};
+    bool permute;
+    std::string fpath;  // source file
+    std::string hpath;  // header file (declarations are appended)
+    std::string lpath;  // log file
+
+    std::string header; // declarations, written to hpath at the end
+    std::string error;  // set if something went wrong
+};
+
+
+// Same selection of quartets as create.py
+bool UniqueQuartet(QAM am)
+{
+    return am[0] >= am[1] && am[2] >= am[3];
+}
+
+
+// Does the quartet exist for kernels with this number of centers?
+bool ValidForCenters(int ncenter, QAM am)
+{
+    if(ncenter < 4 && am[1] != 0)
+        return false;
+    if(ncenter < 3 && am[3] != 0)
+        return false;
+    return true;
+}
+
+
+std::string FileBase(int deriv, bool flt, int ncenter, QAM am)
+{
+    std::stringstream ss;
+    ss << "ostei_";
+    if(flt)
+        ss << "flt_";
+    if(ncenter < 4)
+        ss << ncenter << "c_";
+    if(deriv > 0)
+        ss << "deriv" << deriv << "_";
+
+    if(ncenter == 2)
+        ss << amchar[am[0]] << "_" << amchar[am[2]];
+    else if(ncenter == 3)
+        ss << amchar[am[0]] << "_" << amchar[am[2]] << "_" << amchar[am[3]];
+    else
+        ss << amchar[am[0]] << "_" << amchar[am[1]] << "_"
+           << amchar[am[2]] << "_" << amchar[am[3]];
+    return ss.str();
+}
+
+
+void RunJob(int deriv, const OptionMap & options, const QuartetOptionMap & qoptions,
+            GenerationJob & job)
+{
+    try {
+        std::ofstream lf(job.lpath);
+        if(!lf.is_open())
+            throw std::runtime_error(StringBuilder("Cannot open file: ", job.lpath, "\n"));
+
+        lf << "Generating source file " << job.fpath << "\n";
+        lf << "Appending to header file " << job.hpath << "\n";
+
+        std::ofstream of(job.fpath);
+        if(!of.is_open())
+            throw std::runtime_error(StringBuilder("Cannot open file: ", job.fpath, "\n"));
+
+        OptionMap myoptions = OptionsForQuartet(options, qoptions, job.am);
+        if(job.permute)
+            myoptions[Option::FinalPermute] = 1;
+
+        std::stringstream ofh;
+        if(deriv == 0)
+            GenerateOSTEI(job.am, myoptions, of, ofh, lf);
+        else
+            GenerateOSTEIDeriv1(job.am, myoptions, of, ofh, lf);
+
+        job.header = ofh.str();
+    }
+    catch(std::exception & ex)
+    {
+        job.error = ex.what();
+    }
+}
+
+} // close anonymous namespace
+
+
+
+int main(int argc, char ** argv)
+{
+    try {
+
+
+    // other stuff
+    int deriv = 0;
+    int maxam = -1;
+    int permute_am = -1;
+    int nthread = 1;
+    std::string odir;
+    std::string hpath;
+    std::string jobfile;
+    std::string qopath;
+    std::vector<QAM> quartets;
+
+    // parse command line
+    OptionMap options = DefaultOptions();
+    std::vector<std::string> otheropt = ParseCommonOptions(options, argc, argv);
+
+    // parse specific options
+    size_t iarg = 0;
+    while(iarg < otheropt.size())
+    {
+        std::string argstr(GetNextArg(iarg, otheropt));
+        if(argstr == "-d")
+            deriv = GetIArg(iarg, otheropt);
+        else if(argstr == "-l")
+            maxam = GetIArg(iarg, otheropt);
+        else if(argstr == "-pl")
+            permute_am = GetIArg(iarg, otheropt);
+        else if(argstr == "-j")
+            nthread = GetIArg(iarg, otheropt);
+        else if(argstr == "-odir")
+            odir = GetNextArg(iarg, otheropt);
+        else if(argstr == "-oh")
+            hpath = GetNextArg(iarg, otheropt);
+        else if(argstr == "-f")
+            jobfile = GetNextArg(iarg, otheropt);
+        else if(argstr == "-qo")
+            qopath = GetNextArg(iarg, otheropt);
+        else if(argstr == "-q")
+        {
+            QAM am{0,0,0,0};
+            am[0] = GetIArg(iarg, otheropt);
+            am[1] = GetIArg(iarg, otheropt);
+            am[2] = GetIArg(iarg, otheropt);
+            am[3] = GetIArg(iarg, otheropt);
+            quartets.push_back(am);
+        }
+        else
+        {
+            std::cout << "\n\n";
+            std::cout << "--------------------------------\n";
+            std::cout << "Unknown argument: " << argstr << "\n";
+            std::cout << "--------------------------------\n";
+            return 1;
+        }
+    }
+
+
+    // check for required options
+    CMDLINE_ASSERT( deriv == 0 || deriv == 1, "derivative (-d) must be 0 or 1" )
+    CMDLINE_ASSERT( nthread > 0, "number of threads (-j) must be positive" )
+    CMDLINE_ASSERT( jobfile != "" || quartets.size() || maxam >= 0,
+                    "job file (-f), AM quartets (-q) or maximum AM (-l) required" )
+    CMDLINE_ASSERT( (quartets.empty() && maxam < 0) || (odir != "" && hpath != ""),
+                    "output directory (-odir) and header file path (-oh) required with -q or -l" )
+
+
+    QuartetOptionMap qoptions;
+    if(qopath != "")
+        qoptions = ReadQuartetOptions(qopath);
+
+    // With -l, only quartets with all AM below permute_am are generated
+    // without permutations. Without -l or -pl, nothing is permuted.
+    if(permute_am < 0 && maxam >= 0)
+        permute_am = maxam + 1;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        QAM am{i, j, k, l};
+        if(!ValidForCenters(options[Option::Centers], am))
+            continue;
+        if(UniqueQuartet(am) || std::max({i, j, k, l}) < permute_am)
+            quartets.push_back(am);
+    }
+
+
+    // Create all the jobs
+    std::vector<GenerationJob> jobs;
+
+    for(const auto & am : quartets)
+    {
+        GenerationJob job;
+        std::string filebase = odir + "/" + FileBase(deriv, options[Option::Float], options[Option::Centers], am);
+        job.am = am;
+        job.permute = options[Option::FinalPermute] ||
+                      (permute_am >= 0 && std::max({am[0], am[1], am[2], am[3]}) >= permute_am);
+        job.fpath = filebase + ".c";
+        job.hpath = hpath;
+        job.lpath = filebase + ".log";
+        jobs.push_back(job);
+    }
+
+    if(jobfile != "")
+    {
+        std::ifstream jf(jobfile);
+        if(!jf.is_open())
+            throw std::runtime_error(StringBuilder("Cannot open file: ", jobfile, "\n"));
+
+        std::string line;
+        while(std::getline(jf, line))
+        {
+            std::stringstream ss(line);
+            GenerationJob job;
+            int permute = 0;
+            if(!(ss >> job.am[0] >> job.am[1] >> job.am[2] >> job.am[3]
+                    >> permute >> job.fpath >> job.hpath >> job.lpath))
+                continue;
+
+            job.permute = options[Option::FinalPermute] || permute;
+            jobs.push_back(job);
+        }
+    }
+
+
+    std::cout << "Generating " << jobs.size() << " quartets using "
+              << nthread << " threads\n";
+
+
+    // Run the jobs. Each thread takes the next job that
+    // hasn't been started yet
+    std::atomic<size_t> next_job(0);
+
+    auto worker = [&]()
+    {
+        size_t ijob;
+        while((ijob = next_job++) < jobs.size())
+            RunJob(deriv, options, qoptions, jobs[ijob]);
+    };
+
+    std::vector<std::thread> threads;
+    for(int i = 1; i < nthread; i++)
+        threads.emplace_back(worker);
+    worker();
+
+    for(auto & it : threads)
+        it.join();
+
+
+    // Write out the headers (in order) and check for errors
+    int nerror = 0;
+    for(const auto & job : jobs)
+    {
+        if(job.error != "")
+        {
+            std::cout << "\n\n";
+            std::cout << "Error generating " << job.fpath << "\n";
+            std::cout << "What = " << job.error << "\n\n";
+            nerror++;
+            continue;
+        }
+
+        std::ofstream ofh(job.hpath, std::ofstream::app);
+        if(!ofh.is_open())
+            throw std::runtime_error(StringBuilder("Cannot open file: ", job.hpath, "\n"));
+        ofh << job.header;
+    }
+
+    if(nerror > 0)
+        return 1;
+
+
+    }
+    catch(std::exception & ex)
+    {
+        std::cout << "\n\n";
+        std::cout << "Caught exception\n";
+        std::cout << "What = " << ex.what() << "\n\n";
+        return 1;
+    }
+    return 0;
+}
@@ -3,6 +3,28 @@
 #######################################
 # Generates grid for the
 # boys function to arbitrary precision
+#
+# Two kinds of tables can be generated:
+#
+#   taylor:    Fn(x) at evenly-spaced points. Fn near a point is
+#              found by a Taylor expansion, using the F(n+k) values
+#              at that point as the derivatives.
+#
+#   chebyshev: For each n, the range of x is split into intervals,
+#              and Fn on each interval is given by a polynomial
+#              (Chebyshev interpolation, stored as coefficients of
+#              (x - middle of interval)^k). The spacing is chosen
+#              so that the error is below --max-error.
+#
+# The taylor table is also written transposed, [n][point] rather
+# than [point][n], to <filename>_transposed.c. That file is used when
+# simint is configured with SIMINT_BOYS_TRANSPOSED.
+#
+# simint ships a taylor table (see boys_taylor.h). The chebyshev
+# tables need more coefficients per evaluation at the same accuracy.
+# boys_shortgrid_chebyshev.c is used when simint is configured with
+# SIMINT_BOYS_CHEBYSHEV, and was generated with
+#   --method chebyshev --max-n 31 --max-x 36.5 --order 13 --spacing 2 --dps 40
 #######################################
 
 import argparse
@@ -11,68 +33,238 @@ from boys_common.boys import *
 from mpmath import mp # arbitrary-precision math
 
 # Note that types are being stored as a string. This is so mpmath
-# can parse it without turning it into a (possibly) lesser-precision float 
+# can parse it without turning it into a (possibly) lesser-precision float
 parser = argparse.ArgumentParser()
-parser.add_argument("--filename", type=str, required=True,               help="Output file name base (no extension)")
-parser.add_argument("--max-n",    type=int, required=True,               help="Maximum n value to go to")
-parser.add_argument("--max-x",    type=str, required=True,               help="Cutoff for the x value")
-parser.add_argument("--spacing",  type=str, required=True,               help="Space between pre-computed points")
-parser.add_argument("--dps",      type=int, required=False, default=256, help="Decimal precision/sig figs to use/calculate")
+parser.add_argument("--filename",  type=str, required=True,                  help="Output file name base (no extension)")
+parser.add_argument("--max-n",     type=int, required=True,                  help="Maximum n value to go to")
+parser.add_argument("--max-x",     type=str, required=True,                  help="Cutoff for the x value")
+parser.add_argument("--method",    type=str, required=False, default="taylor", choices=["taylor", "chebyshev"],
+                                                                             help="Type of table to generate")
+parser.add_argument("--spacing",   type=str, required=False,                 help="Space between pre-computed points (taylor), or "
+                                                                                  "width of the intervals (chebyshev, overrides --max-error)")
+parser.add_argument("--order",     type=int, required=False, default=13,     help="Order of the polynomials (chebyshev)")
+parser.add_argument("--max-error", type=str, required=False, default="1e-16",help="Maximum absolute error of the polynomials (chebyshev)")
+parser.add_argument("--dps",       type=int, required=False, default=256,    help="Decimal precision/sig figs to use/calculate")
 args = parser.parse_args()
 
 # Set the dps option
 mp.dps = args.dps
 
 # Convert stuff to mpmath
-inc = mp.mpf(args.spacing)
 maxx = mp.mpf(args.max_x)
 maxn = args.max_n
-npoints = int(maxx / inc) + 1
 
-# Start at x=0 and increment up
-x = mp.mpf(0)
-F = []
-pts = []
 
-while x < maxx:
-  F2 = BoysValue(maxn, x) 
-  F.append(F2)
-  pts.append(x)
-  x += inc
-
-# Output to file
-with open(args.filename + ".c", 'w') as f:
+def WriteHeaderComment(f, options):
   f.write("/*\n")
   f.write(" Generated with:\n")
   f.write("   " + " ".join(sys.argv[:]))
   f.write("\n")
   f.write("------------------------------------\n")
   f.write("Options for Boys function Fn(x):\n")
-  f.write("    Max n: {}\n".format(maxn))
-  f.write("    Max x: {}\n".format(maxx))
-  f.write("  Spacing: {}\n".format(inc))
-  f.write("  npoints: {}\n".format(npoints))
-  f.write("      DPS: {}\n".format(args.dps))
+  for k,v in options:
+    f.write("{:>11}: {}\n".format(k, v))
   f.write("------------------------------------\n")
   f.write("*/\n\n")
 
-  f.write("const double boys_shortgrid[{}][{}] = \n".format(npoints, maxn+1))
-  f.write("{\n")
 
-  for p,x in zip(F,pts):
-    f.write("/* x = {:12}*/  {{".format(mp.nstr(x, 4)))
-    for n in p:
-      f.write("{:32}, ".format(mp.nstr(n, 18)))
-    f.write("},\n")
-  f.write("};\n")
 
-with open(args.filename + ".h", 'w') as f: 
-  f.write("#pragma once\n")
-  f.write("\n")
-  f.write("#define BOYS_SHORTGRID_MAXN {}\n".format(maxn))
-  f.write("#define BOYS_SHORTGRID_MAXX {}\n".format(maxx))
-  f.write("#define BOYS_SHORTGRID_SPACE {}\n".format(inc))
-  f.write("#define BOYS_SHORTGRID_NPOINT {}\n".format(npoints))
-  f.write("#define BOYS_SHORTGRID_LOOKUPFAC {}\n".format(1.0/inc))
-  f.write("#define BOYS_SHORTGRID_LOOKUPFAC2 {}\n".format(0.5*inc))
-  f.write("\n")
+#######################################
+# Taylor tables
+#######################################
+def Taylor():
+  if not args.spacing:
+    print("--spacing is required with --method taylor")
+    quit(1)
+
+  inc = mp.mpf(args.spacing)
+  npoints = int(maxx / inc) + 1
+
+  # Start at x=0 and increment up
+  x = mp.mpf(0)
+  F = []
+  pts = []
+
+  while x < maxx:
+    F2 = BoysValue(maxn, x)
+    F.append(F2)
+    pts.append(x)
+    x += inc
+
+  options = [ ("Max n", maxn), ("Max x", maxx), ("Spacing", inc),
+              ("npoints", npoints), ("DPS", args.dps) ]
+
+  # Output to file
+  with open(args.filename + ".c", 'w') as f:
+    WriteHeaderComment(f, options)
+
+    f.write("const double boys_shortgrid[{}][{}] = \n".format(npoints, maxn+1))
+    f.write("{\n")
+
+    for p,x in zip(F,pts):
+      f.write("/* x = {:12}*/  {{".format(mp.nstr(x, 4)))
+      for n in p:
+        f.write("{:32}, ".format(mp.nstr(n, 18)))
+      f.write("},\n")
+    f.write("};\n")
+
+  # Transposed layout (SIMINT_BOYS_TRANSPOSED) - Fn at
+  # all the points is contiguous for a given n
+  with open(args.filename + "_transposed.c", 'w') as f:
+    WriteHeaderComment(f, options)
+
+    f.write("const double boys_shortgrid[{}][{}] = \n".format(maxn+1, npoints))
+    f.write("{\n")
+
+    for n in range(maxn+1):
+      f.write("/* n = {:2} */  {{".format(n))
+      for p in F:
+        f.write("{:32}, ".format(mp.nstr(p[n], 18)))
+      f.write("},\n")
+    f.write("};\n")
+
+  with open(args.filename + ".h", 'w') as f:
+    f.write("#pragma once\n")
+    f.write("\n")
+    f.write("#define BOYS_SHORTGRID_MAXN {}\n".format(maxn))
+    f.write("#define BOYS_SHORTGRID_MAXX {}\n".format(maxx))
+    f.write("#define BOYS_SHORTGRID_SPACE {}\n".format(inc))
+    f.write("#define BOYS_SHORTGRID_NPOINT {}\n".format(npoints))
+    f.write("#define BOYS_SHORTGRID_LOOKUPFAC {}\n".format(1.0/inc))
+    f.write("#define BOYS_SHORTGRID_LOOKUPFAC2 {}\n".format(0.5*inc))
+    f.write("\n")
+
+
+
+#######################################
+# Chebyshev tables
+#######################################
+
+# Chebyshev polynomials T_0 through T_order, as
+# lists of coefficients of t^k
+def ChebyshevPolynomials(order):
+  T = [ [mp.mpf(1)], [mp.mpf(0), mp.mpf(1)] ]
+  for k in range(2, order+1):
+    # T_k = 2t T_(k-1) - T_(k-2)
+    p = [mp.mpf(0)] + [ 2*c for c in T[k-1] ]
+    for i,c in enumerate(T[k-2]):
+      p[i] -= c
+    T.append(p)
+  return T[:order+1]
+
+
+# Polynomials for F0 through Fmaxn on [a, b], interpolated at the
+# Chebyshev nodes. Returned as coefficients of (x - (a+b)/2)^k,
+# rounded to double precision
+def FitInterval(a, b, order, T):
+  r = (b - a)/2
+  mid = (a + b)/2
+  npt = order + 1
+
+  theta = [ mp.pi*(j+mp.mpf("0.5"))/npt for j in range(npt) ]
+  F = [ BoysValue(maxn, mid + r*mp.cos(th)) for th in theta ]
+
+  coefs = []
+  for n in range(maxn+1):
+    c = [ 2*mp.fsum(F[j][n]*mp.cos(k*theta[j]) for j in range(npt))/npt for k in range(npt) ]
+    c[0] /= 2
+
+    # convert to coefficients of t^k, then of (x-mid)^k = (r*t)^k
+    m = [ mp.mpf(0) ] * npt
+    for k in range(npt):
+      for i,tk in enumerate(T[k]):
+        m[i] += c[k]*tk
+
+    coefs.append([ mp.mpf(float(m[k]/mp.power(r, k))) for k in range(npt) ])
+
+  return coefs
+
+
+# Largest difference between the polynomials and Fn on [a, b]
+def IntervalError(a, b, coefs, nsample):
+  mid = (a + b)/2
+  err = mp.mpf(0)
+
+  for s in range(nsample+1):
+    x = a + (b-a)*s/nsample
+    F = BoysValue(maxn, x)
+    for n in range(maxn+1):
+      v = mp.mpf(0)
+      for c in reversed(coefs[n]):
+        v = v*(x-mid) + c
+      err = max(err, mp.fabs(v - F[n]))
+
+  return err
+
+
+# Polynomials for all the intervals, and the largest error
+def FitAll(spacing, order):
+  T = ChebyshevPolynomials(order)
+  ninterval = int(maxx / spacing) + 1
+
+  allcoefs = []
+  maxerr = mp.mpf(0)
+  for i in range(ninterval):
+    a = i*spacing
+    coefs = FitInterval(a, a + spacing, order, T)
+    maxerr = max(maxerr, IntervalError(a, a + spacing, coefs, 2*order))
+    allcoefs.append(coefs)
+
+  return allcoefs, maxerr
+
+
+def Chebyshev():
+  order = args.order
+  maxerr = mp.mpf(args.max_error)
+
+  if args.spacing:
+    spacing = mp.mpf(args.spacing)
+    allcoefs, err = FitAll(spacing, order)
+  else:
+    # Try power-of-two spacings, largest first
+    spacing = mp.mpf(8)
+    while True:
+      allcoefs, err = FitAll(spacing, order)
+      print("Spacing {:10}  error {}".format(mp.nstr(spacing, 8), mp.nstr(err, 4)))
+      if err <= maxerr:
+        break
+      spacing /= 2
+
+  ninterval = len(allcoefs)
+  print("Using spacing {} ({} intervals), error {}".format(mp.nstr(spacing, 8), ninterval, mp.nstr(err, 4)))
+
+  with open(args.filename + ".c", 'w') as f:
+    WriteHeaderComment(f, [ ("Max n", maxn), ("Max x", maxx), ("Order", order),
+                            ("Spacing", spacing), ("Intervals", ninterval),
+                            ("Max error", mp.nstr(err, 4)), ("DPS", args.dps) ])
+
+    f.write("// Coefficients of (x - middle of interval)^k\n")
+    f.write("const double boys_shortgrid[{}][{}][{}] = \n".format(maxn+1, ninterval, order+1))
+    f.write("{\n")
+    for n in range(maxn+1):
+      f.write("  /* n = {} */\n".format(n))
+      f.write("  {\n")
+      for i in range(ninterval):
+        f.write("    /* x = {:12}*/  {{".format(mp.nstr(i*spacing, 4)))
+        for c in allcoefs[i][n]:
+          f.write("{:26}, ".format(repr(float(c))))
+        f.write("},\n")
+      f.write("  },\n")
+    f.write("};\n")
+
+  with open(args.filename + ".h", 'w') as f:
+    f.write("#pragma once\n")
+    f.write("\n")
+    f.write("#define BOYS_SHORTGRID_MAXN {}\n".format(maxn))
+    f.write("#define BOYS_SHORTGRID_MAXX {}\n".format(maxx))
+    f.write("#define BOYS_SHORTGRID_ORDER {}\n".format(order))
+    f.write("#define BOYS_SHORTGRID_SPACE {}\n".format(spacing))
+    f.write("#define BOYS_SHORTGRID_NINTERVAL {}\n".format(ninterval))
+    f.write("#define BOYS_SHORTGRID_LOOKUPFAC {}\n".format(1/spacing))
+    f.write("\n")
+
+
+if args.method == "taylor":
+  Taylor()
+else:
+  Chebyshev()
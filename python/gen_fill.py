@@ -31,6 +31,8 @@ amchar = "spdfghijklmnoqrtuvwxyzabceSPDFGHIJKLMNOQRTUVWXYZABCE0123456789"
 parser = argparse.ArgumentParser()
 parser.add_argument("-l", type=int, required=True, help="Maximum AM")
 parser.add_argument("-d", type=int, default=0, help="Derivative level")
+parser.add_argument("-f", action='store_true', help="Fill the array of float (single precision) kernels")
+parser.add_argument("-df", action='store_true', help="Fill the arrays of 3- and 2-center (density fitting) kernels")
 parser.add_argument("outfile", type=str, help="Output file")
 
 args = parser.parse_args()
@@ -38,6 +40,16 @@ args = parser.parse_args()
 
 maxam = args.l
 der = args.d
+flt = args.f
+df = args.df
+
+if flt and der > 0:
+  print("Float kernels are not available for derivatives")
+  quit(1)
+
+if df and (der > 0 or flt):
+  print("3- and 2-center kernels are only available in double precision without derivatives")
+  quit(1)
 
 print("-------------------------------")
 print("Generating Array Filling")
@@ -69,7 +81,17 @@ with open(sourcefile, 'w') as f:
   f.write("#include \"simint/ostei/ostei.h\"\n")
   f.write("#include \"simint/ostei/ostei_init.h\"\n")
   f.write("#include \"simint/ostei/ostei_config.h\"\n")
-  if der > 0:
+  if flt:
+    # The float kernels only exist if create.py was run with -f
+    f.write("#if SIMINT_OSTEI_FLOAT\n")
+    f.write("#include \"simint/ostei/gen/ostei_float_generated.h\"\n")
+    f.write("#endif\n")
+  elif df:
+    # The 3- and 2-center kernels only exist if create.py was run with -df
+    f.write("#if SIMINT_OSTEI_DF\n")
+    f.write("#include \"simint/ostei/gen/ostei_df_generated.h\"\n")
+    f.write("#endif\n")
+  elif der > 0:
     f.write("#include \"simint/ostei/gen/ostei_deriv{}_generated.h\"\n".format(der))
   else:
     f.write("#include \"simint/ostei/gen/ostei_generated.h\"\n")
@@ -77,12 +99,22 @@ with open(sourcefile, 'w') as f:
 
   f.write("// Stores pointers to the ostei functions\n")
   f.write("#define AMSIZE   SIMINT_OSTEI_MAXAM+1\n")
-  f.write("#define DERSIZE  SIMINT_OSTEI_MAXDER+1\n")
-  f.write("extern simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
+  if flt:
+    f.write("extern simint_osteifunc simint_osteifunc_float_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
+  elif df:
+    f.write("extern simint_osteifunc simint_osteifunc_3c_array[AMSIZE][AMSIZE][AMSIZE];\n")
+    f.write("extern simint_osteifunc simint_osteifunc_2c_array[AMSIZE][AMSIZE];\n")
+  else:
+    f.write("#define DERSIZE  SIMINT_OSTEI_MAXDER+1\n")
+    f.write("extern simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];\n")
   f.write("\n\n\n")
 
   # write the finalize functions
-  if der > 0:
+  if flt:
+    f.write("void simint_ostei_float_finalize(void)\n")
+  elif df:
+    f.write("void simint_ostei_df_finalize(void)\n")
+  elif der > 0:
     f.write("void simint_ostei_deriv{}_finalize(void)\n".format(der))
   else:
     f.write("void simint_ostei_finalize(void)\n")
@@ -91,26 +123,60 @@ with open(sourcefile, 'w') as f:
   f.write("}\n\n\n")
 
   # Now write the filling function
-  if der > 0:
+  if flt:
+    f.write("void simint_ostei_float_init(void)\n")
+  elif df:
+    f.write("void simint_ostei_df_init(void)\n")
+  elif der > 0:
     f.write("void simint_ostei_deriv{}_init(void)\n".format(der))
   else:
     f.write("void simint_ostei_init(void)\n")
   f.write("{\n")
 
+  if flt:
+    f.write("    #if SIMINT_OSTEI_FLOAT\n\n")
+  elif df:
+    f.write("    #if SIMINT_OSTEI_DF\n\n")
+
   for L,qset in valid.items():
+    if df:
+      # The second (and for 2 centers, the fourth) center is missing,
+      # so only quartets with zero AM there have kernels
+      f.write("    #if SIMINT_OSTEI_MAXAM >= {}\n".format(L))
+      for q in sorted(list(qset)):
+        if q[1] == 0:
+          fname = "ostei_3c_{}_{}_{}_ptr".format(amchar[q[0]], amchar[q[2]], amchar[q[3]])
+          f.write("    simint_osteifunc_3c_array[{}][{}][{}] = {};\n".format(q[0], q[2], q[3], fname))
+      for q in sorted(list(qset)):
+        if q[1] == 0 and q[3] == 0:
+          fname = "ostei_2c_{}_{}_ptr".format(amchar[q[0]], amchar[q[2]])
+          f.write("    simint_osteifunc_2c_array[{}][{}] = {};\n".format(q[0], q[2], fname))
+      f.write("    #endif\n\n")
+      continue
+
     if der > 0:
       f.write("    #if SIMINT_OSTEI_DERIV{}_MAXAM >= {}\n".format(der, L))
     else:
       f.write("    #if SIMINT_OSTEI_MAXAM >= {}\n".format(L))
   
     for q in sorted(list(qset)):
-      if der > 0:
-        fname = "ostei_deriv{}_{}_{}_{}_{}".format(der, amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+      if flt:
+        fname = "ostei_flt_{}_{}_{}_{}_ptr".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+      elif der > 0:
+        fname = "ostei_deriv{}_{}_{}_{}_{}_ptr".format(der, amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
       else:
-        fname = "ostei_{}_{}_{}_{}".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
+        fname = "ostei_{}_{}_{}_{}_ptr".format(amchar[q[0]], amchar[q[1]], amchar[q[2]], amchar[q[3]])
   
-      f.write("    simint_osteifunc_array[{}][{}][{}][{}][{}] = {};\n".format(der, q[0], q[1], q[2], q[3], fname))
+      if flt:
+        f.write("    simint_osteifunc_float_array[{}][{}][{}][{}] = {};\n".format(q[0], q[1], q[2], q[3], fname))
+      else:
+        f.write("    simint_osteifunc_array[{}][{}][{}][{}][{}] = {};\n".format(der, q[0], q[1], q[2], q[3], fname))
   
     f.write("    #endif\n\n")
 
+  if flt:
+    f.write("    #endif // SIMINT_OSTEI_FLOAT\n")
+  elif df:
+    f.write("    #endif // SIMINT_OSTEI_DF\n")
+
   f.write("}\n\n")
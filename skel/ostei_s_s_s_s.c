@@ -1,22 +1,21 @@
 #include "simint/boys/boys.h"
+#include "simint/simint_workspace.h"
 #include "simint/ostei/gen/ostei_generated.h"
 #include "simint/vectorization/vectorization.h"
 #include <math.h>
 #include <string.h>
-#include <stdlib.h>
-#include <assert.h>
 
 
-int ostei_s_s_s_s(struct simint_multi_shellpair const P,
-                  struct simint_multi_shellpair const Q,
-                  double screen_tol,
-                  double * const restrict work,
-                  double * const restrict INT__s_s_s_s)
+int ostei_s_s_s_s_ptr(struct simint_multi_shellpair const * const restrict P,
+                      struct simint_multi_shellpair const * const restrict Q,
+                      double screen_tol,
+                      double * const restrict work,
+                      double * const restrict INT__s_s_s_s)
 {
 
     SIMINT_ASSUME_ALIGN_DBL(work);
     SIMINT_ASSUME_ALIGN_DBL(INT__s_s_s_s);
-    memset(INT__s_s_s_s, 0, P.nshell12_clip * Q.nshell12_clip * 1 * sizeof(double));
+    memset(INT__s_s_s_s, 0, P->nshell12_clip * Q->nshell12_clip * 1 * sizeof(double));
 
     int ab, cd, abcd;
     int istart, jstart;
@@ -48,10 +47,15 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
     int ivec;
     const int TopAM_size = 1;
     int n_info_vector = SIMINT_NSHELL_SIMD * 4;
-    int *offset_info  = (int*) malloc(sizeof(int) * (SIMINT_SIMD_LEN + 1 + TopAM_size) * n_info_vector);
-    assert(offset_info != NULL);
+    // For each vector: shell offsets, lastoffset, pointer increments (TopAM_size)
+    // and the vector where the shell after the one of the last element starts
+    int offset_info_stack[(SIMINT_SIMD_LEN + 2 + 1) * SIMINT_NSHELL_SIMD * 4];
+    int *offset_info = offset_info_stack;
+    double *offset_info_pool = NULL;
 
     #ifdef SIMINT_PRIM_SCREEN_STAT
+    // calc_nvec + skip_nvec is the number of vectors that were visited.
+    // Primitives skipped without being visited only count in skip_nprim
     int calc_nprim = 0, skip_nprim = 0, calc_nvec = 0, skip_nvec = 0;
     #endif
     ////////////////////////////////////////
@@ -60,37 +64,40 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
 
     abcd = 0;
     istart = 0;
-    for(ab = 0; ab < P.nshell12_clip; ++ab)
+    for(ab = 0; ab < P->nshell12_clip; ++ab)
     {
-        const int iend = istart + P.nprim12[ab];
+        const int iend = istart + P->nprim12[ab];
 
         cd = 0;
         jstart = 0;
 
-        for(cd = 0; cd < Q.nshell12_clip; cd += SIMINT_NSHELL_SIMD)
+        for(cd = 0; cd < Q->nshell12_clip; cd += SIMINT_NSHELL_SIMD)
         {
-            const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q.nshell12_clip) ? Q.nshell12_clip - cd : SIMINT_NSHELL_SIMD;
+            const int nshellbatch = ((cd + SIMINT_NSHELL_SIMD) > Q->nshell12_clip) ? Q->nshell12_clip - cd : SIMINT_NSHELL_SIMD;
             int jend = jstart;
             for(i = 0; i < nshellbatch; i++)
-                jend += Q.nprim12[cd+i];
+                jend += Q->nprim12[cd+i];
             
             // Check if the offset buffer is large enough
             int j_vec = (jend - jstart + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
             if (j_vec > n_info_vector)
             {
+                // Too big for the stack buffer, so get it from the workspace pool
                 n_info_vector = j_vec;
-                free(offset_info);
-                offset_info  = (int*) malloc(sizeof(int) * (SIMINT_SIMD_LEN + 1 + TopAM_size) * n_info_vector);
+                simint_workspace_release(offset_info_pool);
+                offset_info_pool = simint_workspace_acquire_size((sizeof(int) * (SIMINT_SIMD_LEN + 2 + TopAM_size) * n_info_vector
+                                                                  + sizeof(double) - 1) / sizeof(double));
+                offset_info = (int*) offset_info_pool;
             }
             // Calculate all the shell offsets in the j-loop
             // These are the offset from the shell pointed to by cd for each element
             ivec = 0;
             iprimcd = 0;
-            nprim_icd = Q.nprim12[cd];
+            nprim_icd = Q->nprim12[cd];
             icd = 0;
             for (j = jstart; j < jend; j += SIMINT_SIMD_LEN)
             {
-                int *shelloffsets = offset_info + (SIMINT_SIMD_LEN + 1 + TopAM_size) * ivec;
+                int *shelloffsets = offset_info + (SIMINT_SIMD_LEN + 2 + TopAM_size) * ivec;
                 shelloffsets[0] = 0;
                 shelloffsets[SIMINT_SIMD_LEN] = 0;  // for lastoffset 
                 shelloffsets[SIMINT_SIMD_LEN + 1 + 0] = 0;
@@ -101,7 +108,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     // Handle if the first element of the vector is a new shell
                     if(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))
                     {
-                        nprim_icd += Q.nprim12[cd + (++icd)];
+                        nprim_icd += Q->nprim12[cd + (++icd)];
                         shelloffsets[SIMINT_SIMD_LEN + 1 + 0] += 1;    // for PRIM_PTR_INT__s_s_s_s
                     }
                     iprimcd++;
@@ -111,7 +118,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                         {
                             shelloffsets[n] = shelloffsets[n-1] + 1;
                             shelloffsets[SIMINT_SIMD_LEN]++;
-                            nprim_icd += Q.nprim12[cd + (++icd)];
+                            nprim_icd += Q->nprim12[cd + (++icd)];
                         }
                         else
                             shelloffsets[n] = shelloffsets[n-1];
@@ -119,6 +126,11 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     }
                 }
                 else iprimcd += SIMINT_SIMD_LEN; 
+
+                // The primitives of each shell are sorted by decreasing screening value,
+                // so if this vector is screened out, we can go on with the next shell
+                shelloffsets[SIMINT_SIMD_LEN + 1 + TopAM_size] =
+                    (nprim_icd >= (jend - jstart)) ? j_vec : (nprim_icd / SIMINT_SIMD_LEN);
             }
 
 
@@ -129,30 +141,32 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
 
                 if(check_screen)
                 {
-                    // Skip this whole thing if always insignificant
-                    if((P.screen[i] * Q.screen_max) < screen_tol)
+                    // Skip this whole thing if always insignificant.
+                    // The primitives are sorted by decreasing screening value,
+                    // so the rest of this shell pair is insignificant, too
+                    if((P->screen[i] * Q->screen_max) < screen_tol)
                     {
                         #ifdef SIMINT_PRIM_SCREEN_STAT
                         int j_len = jend - jstart;
-                        skip_nprim += j_len;
+                        skip_nprim += j_len * (iend - i);
                         skip_nvec  += (j_len + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
                         #endif
-                        continue;
+                        break;
                     }
-                    bra_screen_max = SIMINT_DBLSET1(P.screen[i]);
+                    bra_screen_max = SIMINT_DBLSET1(P->screen[i]);
                 }
 
                 icd = 0;
                 iprimcd = 0;
-                nprim_icd = Q.nprim12[cd];
+                nprim_icd = Q->nprim12[cd];
                 double * restrict PRIM_PTR_INT__s_s_s_s = INT__s_s_s_s + abcd * 1;
 
 
 
                 // Load these one per loop over i
-                const SIMINT_DBLTYPE P_alpha = SIMINT_DBLSET1(P.alpha[i]);
-                const SIMINT_DBLTYPE P_prefac = SIMINT_DBLSET1(P.prefac[i]);
-                const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLSET1(P.x[i]), SIMINT_DBLSET1(P.y[i]), SIMINT_DBLSET1(P.z[i]) };
+                const SIMINT_DBLTYPE P_alpha = SIMINT_DBLSET1(P->alpha[i]);
+                const SIMINT_DBLTYPE P_prefac = SIMINT_DBLSET1(P->prefac[i]);
+                const SIMINT_DBLTYPE Pxyz[3] = { SIMINT_DBLSET1(P->x[i]), SIMINT_DBLSET1(P->y[i]), SIMINT_DBLSET1(P->z[i]) };
 
                 ivec = 0;
                 for(j = jstart; j < jend; j += SIMINT_SIMD_LEN)
@@ -170,7 +184,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                         // Handle if the first element of the vector is a new shell
                         if(iprimcd >= nprim_icd && ((icd+1) < nshellbatch))
                         {
-                            nprim_icd += Q.nprim12[cd + (++icd)];
+                            nprim_icd += Q->nprim12[cd + (++icd)];
                             PRIM_PTR_INT__s_s_s_s += 1;
                         }
                         iprimcd++;
@@ -180,7 +194,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                             {
                                 shelloffsets[n] = shelloffsets[n-1] + 1;
                                 lastoffset++;
-                                nprim_icd += Q.nprim12[cd + (++icd)];
+                                nprim_icd += Q->nprim12[cd + (++icd)];
                             }
                             else
                                 shelloffsets[n] = shelloffsets[n-1];
@@ -190,7 +204,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     else iprimcd += SIMINT_SIMD_LEN;
                     */
                     
-                    int *shelloffsets = offset_info + (SIMINT_SIMD_LEN + 1 + TopAM_size) * ivec;
+                    int *shelloffsets = offset_info + (SIMINT_SIMD_LEN + 2 + TopAM_size) * ivec;
                     int lastoffset = shelloffsets[SIMINT_SIMD_LEN];
                     if (shelloffsets[SIMINT_SIMD_LEN + 1]) PRIM_PTR_INT__s_s_s_s += 1;
                     ivec++;
@@ -200,20 +214,24 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     SIMINT_DBLTYPE prim_screen_res = SIMINT_DBLSET1(0.);
                     if(check_screen)
                     {
-		      if(jend -j < SIMINT_SIMD_LEN ){
-			//initialize remainders when vlen < SIMD_LEN			
-			for(n = jend; n < j+SIMINT_SIMD_LEN; n++)
-			  Q.screen[n] = 0.;
-		      }
-		      prim_screen_res = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q.screen, j));
+                        // the padding of the screen array is zero
+                        prim_screen_res = SIMINT_MUL(bra_screen_max, SIMINT_DBLLOAD(Q->screen, j));
                         const double vmax = vector_max(prim_screen_res);
                         if(vmax < screen_tol)
                         {
+                            PRIM_PTR_INT__s_s_s_s += lastoffset*1;    
+
+                            // The rest of the shell of the last element is insignificant, too.
+                            // The vectors in between belong only to that shell.
+                            const int next_ivec = shelloffsets[SIMINT_SIMD_LEN + 1 + TopAM_size];
                             #ifdef SIMINT_PRIM_SCREEN_STAT
                             skip_nvec++;
-                            skip_nprim += SIMINT_SIMD_LEN;
+                            skip_nprim += SIMINT_SIMD_LEN * (next_ivec - ivec + 1);
                             #endif
-                            PRIM_PTR_INT__s_s_s_s += lastoffset*1;    
+                            if(next_ivec >= j_vec)
+                                break;
+                            ivec = next_ivec;
+                            j = jstart + (ivec - 1) * SIMINT_SIMD_LEN;
                             continue;
                         }
                     }
@@ -224,7 +242,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     skip_nprim += (SIMINT_SIMD_LEN - calc_nprim_in_vec);
                     #endif
 
-                    const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q.alpha, j);
+                    const SIMINT_DBLTYPE Q_alpha = SIMINT_DBLLOAD(Q->alpha, j);
                     const SIMINT_DBLTYPE PQalpha_mul = SIMINT_MUL(P_alpha, Q_alpha);
                     const SIMINT_DBLTYPE PQalpha_sum = SIMINT_ADD(P_alpha, Q_alpha);
                     const SIMINT_DBLTYPE one_over_PQalpha_sum = SIMINT_DIV(const_1, PQalpha_sum);
@@ -232,9 +250,9 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
 
                     /* construct R2 = (Px - Qx)**2 + (Py - Qy)**2 + (Pz -Qz)**2 */
                     SIMINT_DBLTYPE PQ[3];
-                    PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q.x, j));
-                    PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q.y, j));
-                    PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q.z, j));
+                    PQ[0] = SIMINT_SUB(Pxyz[0], SIMINT_DBLLOAD(Q->x, j));
+                    PQ[1] = SIMINT_SUB(Pxyz[1], SIMINT_DBLLOAD(Q->y, j));
+                    PQ[2] = SIMINT_SUB(Pxyz[2], SIMINT_DBLLOAD(Q->z, j));
                     SIMINT_DBLTYPE R2 = SIMINT_MUL(PQ[0], PQ[0]);
                     R2 = SIMINT_FMADD(PQ[1], PQ[1], R2);
                     R2 = SIMINT_FMADD(PQ[2], PQ[2], R2);
@@ -255,7 +273,7 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
                     const SIMINT_DBLTYPE F_x = SIMINT_MUL(R2, alpha);
 
 
-                    const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q.prefac + j);
+                    const SIMINT_DBLTYPE Q_prefac = mask_load(nlane, Q->prefac + j);
 
 
                     boys_F_split(PRIM_INT__s_s_s_s, F_x, 0);
@@ -310,7 +328,9 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
             
         }   // close loop cdbatch
 
-        istart = iend;
+        // the primitives are padded to a multiple of the vector
+        // length after every SIMINT_NSHELL_SIMD shell pairs
+        istart = (((ab + 1) % SIMINT_NSHELL_SIMD) == 0) ? SIMINT_SIMD_ROUND(iend) : iend;
     }  // close loop over ab
     
     #if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
@@ -318,16 +338,16 @@ int ostei_s_s_s_s(struct simint_multi_shellpair const P,
         INT__s_s_s_s[ca_res_idx[jj]] += _mm512_reduce_add_pd(ca_buf[jj]);
     #endif 
     
-    if (offset_info != NULL) free(offset_info);
+    simint_workspace_release(offset_info_pool);
     
     #ifdef SIMINT_PRIM_SCREEN_STAT
-    double *eri_res_end_pos = INT__s_s_s_s + 1 * P.nshell12_clip * Q.nshell12_clip;
+    double *eri_res_end_pos = INT__s_s_s_s + 1 * P->nshell12_clip * Q->nshell12_clip;
     eri_res_end_pos[0] = (double) calc_nprim;
     eri_res_end_pos[1] = (double) skip_nprim;
     eri_res_end_pos[2] = (double) calc_nvec;
     eri_res_end_pos[3] = (double) skip_nvec;
     #endif
 
-    return P.nshell12_clip * Q.nshell12_clip;
+    return P->nshell12_clip * Q->nshell12_clip;
 }
 
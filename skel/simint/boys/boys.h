@@ -3,7 +3,6 @@
 #include "simint/vectorization/vectorization.h"
 
 #include "simint/boys/boys_taylor.h"
-#include "simint/boys/boys_shortgrid.h"
 #include "simint/boys/boys_long.h"
 
 #ifdef __cplusplus
@@ -11,6 +10,77 @@
 extern "C" {
 #endif
 
+#ifdef SIMINT_BOYS_MIXED
+////////////////////////////////////////////////////////////////
+// Vectors where some lanes are below BOYS_SHORTGRID_MAXX and
+// some are above it (only with SIMINT_BOYS_MIXED).
+//
+// The long-range formula is cheap and vectorizes well, so it is
+// done for all lanes (lanes below BOYS_SHORTGRID_MAXX are given
+// BOYS_SHORTGRID_MAXX instead, and are thrown away). The Taylor
+// expansion is a table lookup for each lane anyway, so it is only
+// done for the lanes that need it, and the results are
+// written over the long-range values.
+////////////////////////////////////////////////////////////////
+
+static inline
+void boys_F_mixed_vec(SIMINT_DBLTYPE * restrict F,
+                      SIMINT_DBLTYPE x,
+                      int n)
+{
+    boys_F_long_vec(F, SIMINT_MAX(x, SIMINT_DBLSET1(BOYS_SHORTGRID_MAXX)), n);
+
+    double * restrict Fd = (double *)F;
+    double const * restrict xd = (double *)(&x);
+
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+    {
+        if(xd[i] < BOYS_SHORTGRID_MAXX)
+            boys_F_taylor(Fd + i, xd[i], n);
+    }
+}
+
+
+static inline
+SIMINT_DBLTYPE boys_F_mixed_single_vec(SIMINT_DBLTYPE x, int n)
+{
+    // Here, the long-range formula needs pow(), which costs a few
+    // times as much as a single scalar pow(). So it is only done for
+    // the whole vector when at least half the lanes need it.
+    SIMINT_DBLTYPE ret;
+    double * restrict retd = (double *)(&ret);
+    double const * restrict xd = (double *)(&x);
+
+    int nlong = 0;
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+        nlong += (xd[i] >= BOYS_SHORTGRID_MAXX);
+
+    if(2*nlong >= SIMINT_SIMD_LEN)
+    {
+        ret = boys_F_long_single_vec(SIMINT_MAX(x, SIMINT_DBLSET1(BOYS_SHORTGRID_MAXX)), n);
+
+        for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+        {
+            if(xd[i] < BOYS_SHORTGRID_MAXX)
+                retd[i] = boys_F_taylor_single(xd[i], n);
+        }
+    }
+    else
+    {
+        for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+        {
+            if(xd[i] < BOYS_SHORTGRID_MAXX)
+                retd[i] = boys_F_taylor_single(xd[i], n);
+            else
+                retd[i] = boys_F_long_single(xd[i], n);
+        }
+    }
+
+    return ret;
+}
+#endif
+
+
 static inline
 void boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
                           SIMINT_DBLTYPE x,
@@ -25,6 +95,9 @@ void boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
         boys_F_taylor_vec(F, x, n);
     else
     #endif
+    #if defined SIMINT_BOYS_MIXED && !defined SIMINT_BOYS_NOVECTOR
+        boys_F_mixed_vec(F, x, n);
+    #else
     {
         double * restrict Fd = (double *)F;
         double const * restrict xd = (double *)(&x);
@@ -37,6 +110,7 @@ void boys_F_split_small_n(SIMINT_DBLTYPE * restrict F,
                 boys_F_long(Fd + i, xd[i], n);
         }
     }
+    #endif
 }
 
 
@@ -54,6 +128,9 @@ void boys_F_split_large_n(SIMINT_DBLTYPE * restrict F,
         F[n] = boys_F_taylor_single_vec(x, n);
     else
     #endif
+    #if defined SIMINT_BOYS_MIXED && !defined SIMINT_BOYS_NOVECTOR
+        F[n] = boys_F_mixed_single_vec(x, n);
+    #else
     {
         double * restrict Fd = (double *)F;
         double const * restrict xd = (double *)(&x);
@@ -65,6 +142,7 @@ void boys_F_split_large_n(SIMINT_DBLTYPE * restrict F,
                 Fd[n*SIMINT_SIMD_LEN+i] = boys_F_long_single(xd[i], n);
         }
     }
+    #endif
 
     // factors for the recursion
     const SIMINT_DBLTYPE x2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), (x));
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "simint/vectorization/vectorization_float.h"
+#include "simint/boys/boys.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+////////////////////////////////////////////////////////////////
+// Boys function for the float (ostei_flt_*) kernels
+//
+// The tables and the long-range formula are only available in
+// double precision, so each half of the float vector is converted
+// to a double vector and evaluated with boys_F_split.
+////////////////////////////////////////////////////////////////
+
+static inline
+void boys_F_split_flt(SIMINT_FLTTYPE * restrict F,
+                      SIMINT_FLTTYPE x,
+                      int n)
+{
+    SIMINT_DBLTYPE F_lo[BOYS_SHORTGRID_MAXN+1];
+    boys_F_split(F_lo, SIMINT_FLT_TO_DBL_LO(x), n);
+
+    #if SIMINT_FLT_SIMD_LEN > SIMINT_SIMD_LEN
+    SIMINT_DBLTYPE F_hi[BOYS_SHORTGRID_MAXN+1];
+    boys_F_split(F_hi, SIMINT_FLT_TO_DBL_HI(x), n);
+
+    for(int i = 0; i <= n; i++)
+        F[i] = SIMINT_FLT_FROM_DBL(F_lo[i], F_hi[i]);
+    #else
+    for(int i = 0; i <= n; i++)
+        F[i] = SIMINT_FLT_FROM_DBL(F_lo[i], F_lo[i]);
+    #endif
+}
+
+
+#ifdef __cplusplus
+}
+#endif
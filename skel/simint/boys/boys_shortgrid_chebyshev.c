@@ -0,0 +1,723 @@
+/*
+ Generated with:
+   ../../../python/boys/gen_boys_shortgrid.py --filename boys_shortgrid_chebyshev --max-n 31 --max-x 36.5 --method chebyshev --order 13 --spacing 2 --dps 40
+------------------------------------
+Options for Boys function Fn(x):
+      Max n: 31
+      Max x: 36.5
+      Order: 13
+    Spacing: 2.0
+  Intervals: 19
+  Max error: 7.739e-17
+        DPS: 40
+------------------------------------
+*/
+
+// Coefficients of (x - middle of interval)^k
+const double boys_shortgrid[32][19][14] = 
+{
+  /* n = 0 */
+  {
+    /* x = 0.0         */  {0.7468241328124271        , -0.18947234582049235      , 0.0501343990725068        , -0.011122045796136926     , 0.0020676350472450026     , -0.0003280405376142373    , 4.523199181707407e-05     , -5.505159108659028e-06    , 5.990901526615572e-07     , -5.8918351157276874e-08   , 5.282791139042925e-09     , -4.352612446636946e-10    , 3.371231020778748e-11     , -2.3833707478428206e-12   , },
+    /* x = 2.0         */  {0.5043435602314388        , -0.07575941531059581      , 0.014790931463659996      , -0.0027256179519093977    , 0.00044922837231257387    , -6.561980562616933e-05    , 8.525711790764076e-06     , -9.925130359094175e-07    , 1.0436068459372914e-07    , -9.987633526071655e-09    , 8.759671695132404e-10     , -7.08686974266858e-11     , 5.403560536987725e-12     , -3.771198796178183e-13    , },
+    /* x = 4.0         */  {0.39571230961051357       , -0.03889743626114281      , 0.005497718089217101      , -0.0008039872315514306    , 0.00011262298635939766    , -1.4657181712030526e-05   , 1.7513240039194807e-06    , -1.915564624217541e-07    , 1.9205671576589612e-08    , -1.770938747807591e-09    , 1.5077956727760082e-10    , -1.1907671857301145e-11   , 8.89563600772874e-13      , -6.106149808836431e-14    , },
+    /* x = 6.0         */  {0.3349010581765593        , -0.023856369729357483     , 0.002523472400804204      , -0.0002895576433629472    , 3.34807709991985e-05      , -3.7618836727726855e-06   , 4.021631423655361e-07     , -4.0424674756076e-08      , 3.798583901612404e-09     , -3.3301417589596576e-10   , 2.724236997176391e-11     , -2.0833507638058844e-12   , 1.5150998631717e-13       , -1.0177796547315738e-14   , },
+    /* x = 8.0         */  {0.2954024494198404        , -0.016404391089764096     , 0.0013636045407001546     , -0.00012511699632328585   , 1.1878481577547041e-05    , -1.1307139891951941e-06   , 1.056429521629008e-07     , -9.539332326532766e-09    , 8.236386396400606e-10     , -6.753762449007068e-11    , 5.23908950233578e-12      , -3.8392603091969164e-13   , 2.6949984221050167e-14    , -1.7599703243470196e-15   , },
+    /* x = 10.0        */  {0.2672067433518623        , -0.012145001893230548     , 0.0008276887267932133     , -6.257716338743854e-05    , 4.946096896750199e-06     , -3.983542533740753e-07    , 3.2141787456799355e-08    , -2.5626391582954497e-09   , 1.9957823237838334e-10    , -1.504343890775244e-11    , 1.0899075703419906e-12    , -7.55627131832153e-14     , 5.065293929826823e-15     , -3.1883863501193997e-16   , },
+    /* x = 12.0        */  {0.24579504080564116       , -0.009453568479855162     , 0.0005453547136568942     , -3.494414619975616e-05    , 2.348387517601281e-06     , -1.618562097419443e-07    , 1.1292193770111265e-08    , -7.893361133228864e-10    , 5.476714448562597e-11     , -3.739237829633643e-12    , 2.492778331666823e-13     , -1.6126000802195214e-14   , 1.0196564386821638e-15    , -6.122769239010684e-17    , },
+    /* x = 14.0        */  {0.22882279832973734       , -0.007627416414247228     , 0.00038136572234035305    , -2.1185285117127937e-05   , 1.2353834341652319e-06    , -7.403803318310693e-08    , 4.510384327037364e-09     , -2.771911043758786e-10    , 1.707155086095696e-11     , -1.0467759090740184e-12   , 6.348252174343071e-14     , -3.784382122224365e-15    , 2.229202218772902e-16     , -1.262558209174685e-17    , },
+    /* x = 16.0        */  {0.2149416001041246        , -0.006321810550139631     , 0.0002789027978094368     , -1.3671502836848923e-05   , 7.036295585422669e-07     , -3.7240829722534686e-08   , 2.0063928044298258e-09    , -1.0935129127215355e-10   , 6.000203447098747e-12     , -3.299891750965566e-13    , 1.8104321032711116e-14    , -9.860526432584097e-16    , 5.3556919937613713e-17    , -2.8305680987250456e-18   , },
+    /* x = 18.0        */  {0.20331440033476209       , -0.005350378808735938     , 0.00021119908978172865    , -9.26309339921425e-06     , 4.265836841782531e-07     , -2.020536688290902e-08    , 9.746155514599964e-10     , -4.760233273411808e-11    , 2.345142626988335e-12     , -1.1616510622803269e-13   , 5.767462358851786e-15     , -2.860596053242762e-16    , 1.4238386514824072e-17    , -6.965224056257182e-19    , },
+    /* x = 20.0        */  {0.19339056992497952       , -0.004604537361112464     , 0.00016444775387001607    , -6.5257015096988804e-06   , 2.719034773326506e-07     , -1.1652855723771777e-08   , 5.086313260265186e-10     , -2.2486918724324855e-11   , 1.00343256717804e-12      , -4.507816847189959e-14    , 2.034234611525699e-15     , -9.201296958695682e-17    , 4.190950462603258e-18     , -1.889526217637572e-19    , },
+    /* x = 22.0        */  {0.1847910880801995        , -0.0040171975647300155    , 0.00013099557164751357    , -4.7462159922331144e-06   , 1.8056247197010415e-07    , -7.06546944325112e-09     , 2.8159169825501667e-10    , -1.1368166308100702e-11   , 4.633210233014002e-13     , -1.9019111806319347e-14   , 7.849459868127427e-16     , -3.252092475684612e-17    , 1.3585719954691062e-18    , -5.6434045197538e-20      , },
+    /* x = 24.0        */  {0.1772453850902791        , -0.003544907701527823     , 0.00010634723090695525    , -3.5449076506053623e-06   , 1.2407175619790127e-07    , -4.466580908467135e-09    , 1.6377424753342975e-10    , -6.0829883689237594e-12   , 2.2810517729754243e-13    , -8.616541270263552e-15    , 3.2734861690428896e-16    , -1.2491806306908623e-17   , 4.807516150615211e-19     , -1.844560073214502e-20    , },
+    /* x = 26.0        */  {0.17055445132438055       , -0.0031584157652315005    , 8.773377123902752e-05     , -2.7078324398479827e-06   , 8.775382761889391e-08     , -2.9251272972457208e-09   , 9.930982903356792e-11     , -3.4154104946549267e-12   , 1.185897796945338e-13     , -4.148106254675513e-15    , 1.4594117270973758e-16    , -5.158664068400275e-18    , 1.8384436303046552e-19    , -6.5416356030969686e-21   , },
+    /* x = 28.0        */  {0.1645682086235545        , -0.0028373829072982784    , 7.338059242793507e-05     , -2.108637712715472e-06    , 6.362268942505982e-08     , -1.9744972214721778e-09   , 6.241226240356167e-11     , -1.9984213250230466e-12   , 6.460402916374832e-14     , -2.1039505501765495e-15   , 6.892091058486795e-17     , -2.2684465982525285e-18   , 7.52439699856045e-20      , -2.4941617835497998e-21   , },
+    /* x = 30.0        */  {0.15917105461020217       , -0.0025672750743575444    , 6.21114937341791e-05      , -1.6696638099660383e-06   , 4.712760751622906e-08     , -1.3682208587474068e-09   , 4.045814290143794e-11     , -1.211879746328323e-12    , 3.664957543531184e-14     , -1.1165625961504127e-15   , 3.42169361430996e-17      , -1.0535867058750932e-18   , 3.267972324690172e-20     , -1.0135666502172847e-21   , },
+    /* x = 32.0        */  {0.154272305827641         , -0.0023374591792066114    , 5.312407225466042e-05     , -1.3415169761160236e-06   , 3.557052587892305e-08     , -9.701052506551126e-10    , 2.6947367975697974e-11    , -7.582592580376422e-13    , 2.1541454485298273e-14    , -6.165060786513539e-16    , 1.7747821547850828e-17    , -5.133649483345213e-19    , 1.4952733640258395e-20    , -4.356811112687185e-22    , },
+    /* x = 34.0        */  {0.14979969134027404       , -0.0021399955905753347    , 4.585704836946695e-05     , -1.0918344849858072e-06   , 2.7295862124269875e-08    , -7.018935974061645e-10    , 1.838292753859745e-11     , -4.877103206654141e-13    , 1.3063669097934397e-14    , -3.5251168100682216e-16   , 9.568145621546281e-18     , -2.609491913846455e-19    , 7.16399676571592e-21      , -1.9681440842344354e-22   , },
+    /* x = 36.0        */  {0.14569480906717377       , -0.001968848771178023     , 3.990909671306746e-05     , -8.988535295733991e-07    , 2.125667130743099e-08     , -5.170541669279012e-10    , 1.2809900530393225e-11    , -3.2148398991620824e-13   , 8.14570918330542e-15      , -2.0792350450906607e-16   , 5.3385644944895946e-18    , -1.3772706113574738e-19   , 3.575728812801239e-21     , -9.292533218068809e-23    , },
+  },
+  /* n = 1 */
+  {
+    /* x = 0.0         */  {0.18947234582049238       , -0.10026879814501737      , 0.03336613738840937       , -0.008270540188859346     , 0.001640202688089921      , -0.00027139195198876414   , 3.8536113670675376e-05    , -4.792717081847012e-06    , 5.302653531601399e-07     , -5.2835502001028494e-08   , 4.787685213266842e-09     , -3.979220059346946e-10    , 3.105236221983691e-11     , -2.2089060870848647e-12   , },
+    /* x = 2.0         */  {0.07575941531059581       , -0.029581862927320582     , 0.008176853855727974      , -0.001796913489231414     , 0.00032809902813375       , -5.11542709145705e-05     , 6.947591237428052e-06     , -8.348848290172766e-07    , 8.988873160467438e-08     , -8.760859454875302e-09    , 7.795264629106448e-10     , -6.380595423459645e-11    , 4.913180577954775e-12     , -3.4564204496876354e-13   , },
+    /* x = 4.0         */  {0.03889743626114281       , -0.010995436178434296     , 0.0024119616946542575     , -0.0004504919454345764    , 7.328590856061054e-05     , -1.0507944050654058e-05   , 1.340895234754039e-06     , -1.5364526920699573e-07   , 1.5938453441271273e-08    , -1.5079852889569037e-09   , 1.3097978372479908e-10    , -1.0509251610228376e-11   , 7.95474759446288e-13      , -5.517854053644154e-14    , },
+    /* x = 6.0         */  {0.023856369729357483      , -0.005046944801608424     , 0.000868672930088836      , -0.0001339230839963006    , 1.8809418363937232e-05    , -2.412978858635072e-06    , 2.8297272293822724e-07    , -3.0388654287407025e-08   , 2.99712834236514e-09      , -2.724547359940906e-10    , 2.2916115912215975e-11    , -1.7910291157257346e-12   , 1.3258137000970932e-13    , -9.03151369960261e-15     , },
+    /* x = 8.0         */  {0.016404391089764096      , -0.002727209081400312     , 0.00037535098896985657    , -4.751392631010483e-05    , 5.653569945988193e-06     , -6.338577137276457e-07    , 6.677532622705817e-08     , -6.589106258385937e-09    , 6.078387461469818e-10     , -5.239613704751389e-11    , 4.223063388029752e-12     , -3.188242179565218e-13    , 2.292432706126503e-14     , -1.5254049693540057e-15   , },
+    /* x = 10.0        */  {0.012145001893230548      , -0.001655377453586427     , 0.00018773149016231548    , -1.9784387586986153e-05   , 1.99177126687247e-06      , -1.9285072487262847e-07   , 1.7938474098017687e-08    , -1.596625356695702e-09    , 1.353909717085045e-10     , -1.0899996813737506e-11   , 8.311687832943027e-13     , -5.997952578464171e-14    , 4.1525615559102834e-15    , -2.68035232600635e-16     , },
+    /* x = 12.0        */  {0.009453568479855162      , -0.0010907094273137886    , 0.00010483243859926845    , -9.39355007040242e-06     , 8.092810487100957e-07     , -6.775316264501123e-08    , 5.525352791463995e-09     , -4.3813706312768274e-10   , 3.3653144316070327e-11    , -2.4929484162337346e-12   , 1.7738224472166995e-13    , -1.2087418387530606e-14   , 7.973288493876326e-16     , -4.949233908487863e-17    , },
+    /* x = 14.0        */  {0.007627416414247228      , -0.0007627314446807061    , 6.355585535138381e-05     , -4.941533736660397e-06    , 3.7019016591560516e-07    , -2.7062305967003e-08      , 1.940337730292819e-09     , -1.3657238867906693e-10   , 9.420983906722659e-12     , -6.348586052085848e-13    , 4.1627494351505677e-14    , -2.645900341535445e-15    , 1.6439039761579662e-16    , -9.715207061102098e-18    , },
+    /* x = 16.0        */  {0.006321810550139631      , -0.0005578055956188736    , 4.1014508510546765e-05    , -2.8145182341689553e-06   , 1.8620414861268757e-07    , -1.2038356827588379e-08   , 7.654590388371532e-10     , -4.800162373067117e-11    , 2.969902721426658e-12     , -1.8105026257574874e-13   , 1.084643674375753e-14     , -6.365275997508859e-16    , 3.684914514813561e-17     , -2.0520246647251155e-18   , },
+    /* x = 18.0        */  {0.005350378808735938      , -0.0004223981795634573    , 2.7789280197642748e-05    , -1.7063347367129867e-06   , 1.0102683441454817e-07    , -5.847693308991887e-09    , 3.332163291241325e-10     , -1.8761140132303565e-11   , 1.0454859875417802e-12    , -5.767624373925071e-14    , 3.1466248670703052e-15    , -1.6944653447530246e-16   , 9.065988719581671e-18     , -4.714113329272798e-19    , },
+    /* x = 20.0        */  {0.004604537361112464      , -0.00032889550774003215   , 1.957710452909664e-05     , -1.087613909330596e-06    , 5.82642786188596e-08      , -3.051787956217483e-09    , 1.5740843106681738e-10    , -8.027460315026091e-12    , 4.057035236545827e-13     , -2.034275389223322e-14    , 1.01213542220762e-15      , -4.9935493358051694e-17   , 2.4590181047543282e-18    , -1.1864701785329866e-19   , },
+    /* x = 22.0        */  {0.0040171975647300155     , -0.00026199114329502715   , 1.4238647976699342e-05    , -7.222498878804148e-07    , 3.532734721625579e-08     , -1.6895501895462327e-09   , 7.957716415581616e-11     , -3.706568124946503e-12    , 1.7117200816144497e-13    , -7.849572564692765e-15    , 3.577283099936447e-16     , -1.6204502372354562e-17   , 7.3431982472479985e-19    , -3.2789506105817475e-20   , },
+    /* x = 24.0        */  {0.003544907701527823      , -0.0002126944618139105    , 1.0634722951816087e-05    , -4.962870247916044e-07    , 2.2332904542335726e-08    , -9.826454852054609e-10    , 4.2580918582216435e-11    , -1.8248413997790266e-12   , 7.754887196785407e-14     , -3.273520274409452e-15    , 1.3740934577268548e-16    , -5.739252544403406e-18    , 2.3998321702735127e-19    , -9.92288601563929e-21     , },
+    /* x = 26.0        */  {0.0031584157652315005     , -0.00017546754247805505   , 8.123497319543948e-06     , -3.510153104755755e-07    , 1.462563648622862e-08     , -5.958589742030152e-10    , 2.390787346250795e-11     , -9.48718231431264e-13     , 3.733295645609213e-14     , -1.4594229571209236e-15   , 5.674514437905377e-17     , -2.1963309936292887e-18   , 8.509958210705485e-20     , -3.2672943591361208e-21   , },
+    /* x = 28.0        */  {0.0028373829072982784     , -0.00014676118485587014   , 6.3259131381464154e-06    , -2.544907577002392e-07    , 9.872486107360893e-09     , -3.7447357442194127e-10   , 1.3988949275135955e-11    , -5.168322311334256e-13    , 1.893555500595809e-14     , -6.892130964721481e-16    , 2.4952859418224993e-17    , -8.994447234797381e-19    , 3.244343551193225e-20     , -1.1610258243152614e-21   , },
+    /* x = 30.0        */  {0.0025672750743575444     , -0.0001242229874683582    , 5.008991429898115e-06     , -1.8851043006491622e-07   , 6.841104293737036e-09     , -2.4274885740884495e-10   , 8.483158224289227e-12     , -2.9319660265475944e-13   , 1.0049063384710469e-14    , -3.4217087903295754e-16   , 1.158943483751783e-17     , -3.9083216283587443e-19   , 1.3183249190366142e-20    , -4.415232883927236e-22    , },
+    /* x = 32.0        */  {0.0023374591792066114     , -0.00010624814450932084   , 4.024550928348071e-06     , -1.4228210351569217e-07   , 4.8505262532755635e-09    , -1.616842078542756e-10    , 5.307814806260068e-12     , -1.7233163554811532e-13   , 5.548554715207254e-15     , -1.7747882833958731e-16   , 5.647007249665803e-18     , -1.7889792045560166e-19   , 5.666466139147811e-21     , -1.7830079772054057e-22   , },
+    /* x = 34.0        */  {0.0021399955905753347     , -9.17140967389339e-05     , 3.2755034549574215e-06    , -1.091834484970795e-07    , 3.5094679870308226e-09    , -1.1029756523162208e-10   , 3.413972244656522e-12     , -1.0450935264109908e-13   , 3.1726051320113087e-15    , -9.568171725009552e-17    , 2.870438220815111e-18     , -8.574014056732289e-20    , 2.559636206345333e-21     , -7.594262665927954e-23    , },
+    /* x = 36.0        */  {0.001968848771178023      , -7.981819342613492e-05    , 2.6965605887201977e-06    , -8.502668522972396e-08    , 2.5852708346395062e-09    , -7.685940318237604e-11    , 2.250387929412876e-12     , -6.516567340285555e-14    , 1.8713115418278674e-15    , -5.338576152725225e-17    , 1.5149964538927578e-18    , -4.280699772338146e-20    , 1.208472452709067e-21     , -3.3916977083236965e-23   , },
+  },
+  /* n = 2 */
+  {
+    /* x = 0.0         */  {0.10026879814501738       , -0.06673227477682225      , 0.024811620566576726      , -0.006560810752247257     , 0.0013569597599613575     , -0.0002312166830362283    , 3.3549019488740395e-05    , -4.242118968353034e-06    , 4.7551969843316373e-07    , -4.788392469695673e-08    , 4.376965635135922e-09     , -3.664548143739688e-10    , 2.8779940294394346e-11    , -2.0581579183481873e-12   , },
+    /* x = 2.0         */  {0.029581862927320585      , -0.016353707711456493     , 0.00539074046769404       , -0.0013123961125175768    , 0.00025577135457554727    , -4.168554758142663e-05    , 5.844193790184261e-06     , -7.191092551264149e-07    , 7.884776281828996e-08     , -7.796360665839537e-09    , 7.018383858940285e-10     , -5.800145610857493e-11    , 4.503205735046623e-12     , -3.1895147321412474e-13   , },
+    /* x = 4.0         */  {0.010995436178434296      , -0.004823923389308601     , 0.0013514758363036975     , -0.00029314363423969423   , 5.253972025369085e-05     , -8.045371433263287e-06    , 1.0755168824300132e-06    , -1.275075332621139e-07    , 1.3571871927403047e-08    , -1.309970698089571e-09    , 1.155975367086226e-10     , -9.39481050433148e-12     , 7.188596841249938e-13     , -5.030293782427874e-14    , },
+    /* x = 6.0         */  {0.005046944801608424      , -0.001737345860177686     , 0.00040176925198889677    , -7.523767345530603e-05    , 1.2064894293242255e-05    , -1.6978363416166847e-06   , 2.1272057969071833e-07    , -2.3977011545344684e-08   , 2.4520933121550938e-09    , -2.2918901968453437e-10   , 1.9700647301570347e-11    , -1.566657641588596e-12    , 1.176544121415114e-13     , -8.107430043538055e-15    , },
+    /* x = 8.0         */  {0.002727209081400312      , -0.0007507019779397154    , 0.00014254177893031366    , -2.2614279783879428e-05   , 3.1692885686491215e-06    , -4.0065195802262355e-07   , 4.612374375640955e-08     , -4.862707453237482e-09    , 4.71565345493148e-10      , -4.223524734444742e-11    , 3.5069568133627514e-12    , -2.7106496649073695e-13   , 1.987011610851393e-14     , -1.3425062292547168e-15   , },
+    /* x = 10.0        */  {0.001655377453586427      , -0.00037546298032463133   , 5.935316276095832e-05     , -7.967085067477317e-06    , 9.642536243649686e-07     , -1.076308447012106e-07    , 1.1176377488102408e-08    , -1.0831273426939336e-09   , 9.809999011297059e-11     , -8.312478102028063e-12    , 6.597564103830837e-13     , -4.914094025501771e-14    , 3.491139646059139e-15     , -2.2996356183189303e-16   , },
+    /* x = 12.0        */  {0.0010907094273137886     , -0.00020966487719853698   , 2.8180650211207234e-05    , -3.2371241948381376e-06   , 3.387658132253737e-07     , -3.3152116768997584e-08   , 3.0669594403692616e-09    , -2.6922507750732484e-10   , 2.243653901323041e-11     , -1.7739636782871089e-12   , 1.3295840749636654e-13    , -9.444671460984058e-15    , 6.445622148561074e-16     , -4.109680276955088e-17    , },
+    /* x = 14.0        */  {0.0007627314446807061     , -0.00012711171070276762   , 1.4824601209981187e-05    , -1.4807606636619978e-06   , 1.3531152983507276e-07    , -1.1642026385564244e-08   , 9.560067204761305e-10     , -7.53678567466651e-11     , 5.713728041225106e-12     , -4.1630154439380585e-13   , 2.9104322574994146e-14    , -1.9494661865140753e-15   , 1.2650904332850739e-16    , -7.74045141166813e-18     , },
+    /* x = 16.0        */  {0.0005578055956188736     , -8.202901702109354e-05    , 8.443554702506866e-06     , -7.448165944506654e-07    , 6.019178413795301e-08     , -4.592754233787242e-09    , 3.360113660613788e-10     , -2.3759218859150906e-11   , 1.6294524774468985e-12    , -1.0846970741901845e-13   , 7.00169186382075e-15      , -4.3752878787208267e-16   , 2.6716953257365464e-17    , -1.5538223739577628e-18   , },
+    /* x = 18.0        */  {0.0004223981795634573     , -5.5578560395285496e-05   , 5.119004210138959e-06     , -4.041073376581743e-07    , 2.9238466544961715e-08    , -1.9992979749101435e-09   , 1.3132798091517595e-10    , -8.36388727032671e-12     , 5.190862171172062e-13     , -3.146740384821311e-14    , 1.863888935281937e-15     , -1.0778359064701022e-16   , 6.136691010959908e-18     , -3.36124916503927e-19     , },
+    /* x = 20.0        */  {0.00032889550774003215    , -3.915420905819328e-05    , 3.2628417279917877e-06    , -2.330571144754341e-07    , 1.525893978108792e-08     , -9.444505864397995e-10    , 5.6192222202757535e-11    , -3.2456280410411794e-12   , 1.83084790227099e-13      , -1.0121625948181617e-14   , 5.492853451430858e-16     , -2.927104946181668e-17    , 1.5442592439020657e-18    , -7.906298714119424e-20    , },
+    /* x = 22.0        */  {0.00026199114329502715    , -2.8477295953398685e-05   , 2.1667496636412444e-06    , -1.4130938886502204e-07   , 8.447750947731285e-09     , -4.774629849448973e-10    , 2.594597687404196e-11     , -1.3693760271897726e-12   , 7.064615433280087e-14     , -3.577352961007347e-15    , 1.7824830325918536e-16    , -8.750862565643667e-18    , 4.2670826578801615e-19    , -2.0326709480738063e-20   , },
+    /* x = 24.0        */  {0.0002126944618139105     , -2.1269445903632173e-05   , 1.4888610743748134e-06    , -8.933161816934258e-08    , 4.913227426027336e-09     , -2.554855114961102e-10    , 1.2773889798300121e-11    , -6.203909650306403e-13    , 2.946168279769946e-14     , -1.374113098662564e-15    , 6.313145724909236e-17     , -2.862656029985714e-18    , 1.2911415498409335e-19    , -5.71458468020443e-21     , },
+    /* x = 26.0        */  {0.00017546754247805505    , -1.6246994639087896e-05   , 1.0530459314267265e-06    , -5.850254594491438e-08    , 2.9792948710150854e-09    , -1.4344724077590885e-10   , 6.64102761997513e-12      , -2.9866364836780534e-13   , 1.3134806707776374e-14    , -5.67457459344178e-16     , 2.4159549320262358e-17    , -1.0159446750164144e-18   , 4.2508140349586716e-20    , -1.7502085065319566e-21   , },
+    /* x = 28.0        */  {0.00014676118485587014    , -1.2651826276292831e-05   , 7.634722731007177e-07     , -3.948994442944355e-08    , 1.8723678721097093e-09    , -8.393369565110119e-11    , 3.6178256179204423e-12    , -1.5148443896008434e-13   , 6.20291789725916e-15      , -2.4953058822804533e-16   , 9.893863592146481e-18     , -3.875808600319736e-19    , 1.510365096560277e-20     , -5.801524897762446e-22    , },
+    /* x = 30.0        */  {0.0001242229874683582     , -1.001798285979623e-05    , 5.655312901947487e-07     , -2.7364417174948134e-08   , 1.2137442870442257e-09    , -5.0898949345836996e-11   , 2.0523762185788013e-12    , -8.039250669048691e-14    , 3.0795379209716285e-15    , -1.158950582824862e-16    , 4.299144330900252e-18     , -1.5757940105196108e-19   , 5.743242942167622e-21     , -2.0653926772439857e-22   , },
+    /* x = 32.0        */  {0.00010624814450932084    , -8.049101856696141e-06    , 4.2684631054707655e-07    , -1.940210501310225e-08    , 8.084210392713783e-10     , -3.184688883759897e-11    , 1.206321448835197e-12     , -4.4388437574735945e-14   , 1.5973094585067768e-15    , -5.647034186938207e-17    , 1.967873751108514e-18     , -6.776249342405175e-20    , 2.3191372713686476e-21    , -7.836994236197357e-23    , },
+    /* x = 34.0        */  {9.17140967389339e-05      , -6.551006909914843e-06    , 3.275503454912385e-07     , -1.4037871948123289e-08   , 5.514878261581105e-10     , -2.048383346795462e-11    , 7.315654684870837e-13     , -2.538084099708489e-14    , 8.611354565576538e-16     , -2.870449039061201e-17    , 9.431402684560418e-19     , -3.0621216647311255e-20   , 9.877188046326143e-22     , -3.1473750489693223e-23   , },
+    /* x = 36.0        */  {7.981819342613492e-05     , -5.3931211774403954e-06   , 2.5508005568917186e-07    , -1.0341083338558025e-08   , 3.8429701591188023e-10    , -1.3502327576483801e-11   , 4.561597138197451e-13     , -1.4970492309694688e-14   , 4.804718542675342e-16     , -1.5150010242820152e-17   , 4.708764642883157e-19     , -1.446178086967217e-20    , 4.411064031299073e-22     , -1.3296618973922146e-23   , },
+  },
+  /* n = 3 */
+  {
+    /* x = 0.0         */  {0.06673227477682227       , -0.04962324113315674      , 0.019682432256740535      , -0.005427839039740191     , 0.0011560834151976241     , -0.00020129411787991937   , 2.9694832699342765e-05    , -3.80415397706747e-06     , 4.3095549185213594e-07    , -4.3776276856778e-08      , 4.030837132204361e-09     , -3.395803384752881e-10    , 2.681635776003397e-11     , -1.9266110492309823e-12   , },
+    /* x = 2.0         */  {0.016353707711456496      , -0.010781480935388586     , 0.003937188337552542      , -0.0010230854182860176    , 0.00020842773790964706    , -3.506516288669683e-05    , 5.0337647738166024e-06    , -6.307815477672361e-07    , 7.016727185599212e-08     , -7.01940117250222e-09     , 6.379907262694718e-10     , -5.315047254023694e-11    , 4.155566528060583e-12     , -2.960436094128333e-13    , },
+    /* x = 4.0         */  {0.004823923389308602      , -0.002702951672607474     , 0.0008794309027190535     , -0.00021015888101223962   , 4.0226857166705166e-05    , -6.453101317301576e-06    , 8.925527309686322e-07     , -1.0857488883879593e-07   , 1.1789740282156091e-08    , -1.1561341313978939e-09   , 1.033390047322988e-10     , -8.487733878163946e-12    , 6.553604093819109e-13     , -4.6200989626869044e-14   , },
+    /* x = 6.0         */  {0.001737345860177686      , -0.0008035385039778061    , 0.00022571302036591352    , -4.825957717256759e-05    , 8.489181708144551e-06     , -1.2763234817583134e-06   , 1.6783908052396516e-07    , -1.9616732726130115e-08   , 2.062701806042685e-09     , -1.9703172527136166e-10   , 1.7232619098307296e-11    , -1.38981081689143e-12     , 1.0562022797562971e-13    , -7.34844724261799e-15     , },
+    /* x = 8.0         */  {0.0007507019779397155     , -0.0002850835578606294    , 6.784283935163754e-05     , -1.2677154274531117e-05   , 2.003259790122929e-06     , -2.7674246312694553e-07   , 3.403895212556114e-08     , -3.7725205215337475e-09   , 3.8011732704151494e-10    , -3.5073680048693486e-11   , 2.9816159248299324e-12    , -2.3485221101954145e-13   , 1.7488476770328076e-14    , -1.1965638715791537e-15   , },
+    /* x = 10.0        */  {0.00037546298032463133    , -0.00011870632552191698   , 2.3901255202431833e-05    , -3.857014497448915e-06    , 5.381542235076683e-07     , -6.705826502728182e-08    , 7.581891391103054e-09     , -7.847995449386543e-10    , 7.48123195366437e-11      , -6.598253507313247e-12    , 5.405340923965057e-13     , -4.129191697992714e-14    , 2.99543594191434e-15      , -2.0061377560770948e-16   , },
+    /* x = 12.0        */  {0.00020966487719853698    , -5.636130042241453e-05    , 9.711372584514392e-06     , -1.355063252899589e-06    , 1.6576058384526238e-07    , -1.8401756659371878e-08   , 1.884575541233808e-09     , -1.7949224673358136e-10   , 1.5965675927995093e-11    , -1.3297039464510978e-12   , 1.0388862518678155e-13    , -7.63011521187477e-15     , 5.352624591182336e-16     , -3.488170604329591e-17    , },
+    /* x = 14.0        */  {0.00012711171070276762    , -2.9649202419962384e-05   , 4.4422819909859895e-06    , -5.412461193399444e-07    , 5.8210131927869704e-08    , -5.73604032597778e-09     , 5.275749969939234e-10     , -4.5709812437722116e-11   , 3.746714398301496e-12     , -2.910650317436744e-13    , 2.144364034157325e-14     , -1.4990750345514837e-15   , 1.0080322848338792e-16    , -6.345284951161311e-18    , },
+    /* x = 16.0        */  {8.202901702109354e-05     , -1.688710940501373e-05    , 2.2344497833519956e-06    , -2.407671365517454e-07    , 2.2963771168945198e-08    , -2.0160681969682853e-09   , 1.6631453197092762e-10    , -1.3035617533352041e-11   , 9.762274591977659e-13     , -7.002111073871201e-14    , 4.812726287563584e-15     , -3.1694437574247744e-16   , 2.0232557888677582e-17    , -1.21982964272946e-18     , },
+    /* x = 18.0        */  {5.5578560395285496e-05    , -1.023800842027792e-05    , 1.2123220129745227e-06    , -1.1695386617983317e-07   , 9.996489874552481e-09     , -7.879678856142642e-10    , 5.854721088381961e-11     , -4.1526892674848724e-12   , 2.8320665277970586e-13    , -1.8639750146852927e-14   , 1.1856017534077518e-15    , -7.288895870124109e-17    , 4.3760765244268885e-18    , -2.5047127467949956e-19   , },
+    /* x = 20.0        */  {3.915420905819328e-05     , -6.525683455983575e-06    , 6.991713434263022e-07     , -6.103575912434865e-08    , 4.722252932199368e-09     , -3.37153333243834e-10     , 2.2719396285509644e-11    , -1.4646782178419376e-12   , 9.109463734522662e-14     , -5.493044098192657e-15    , 3.219778169662213e-16     , -1.8364709244702384e-17   , 1.0291742147350998e-18    , -5.547260199386433e-20    , },
+    /* x = 22.0        */  {2.8477295953398685e-05    , -4.333499327282489e-06    , 4.239281665950661e-07     , -3.379100379092441e-08    , 2.387314924724571e-09     , -1.556758612508182e-10    , 9.585632189925294e-12     , -5.651692096435992e-13    , 3.219617751293991e-14     , -1.7825289060342278e-15   , 9.625864349964004e-17     , -5.0804600915581005e-18   , 2.6455440894070545e-19    , -1.334752068490364e-20    , },
+    /* x = 24.0        */  {2.1269445903632173e-05    , -2.977722148749627e-06    , 2.679948545080278e-07     , -1.9652909704109152e-08   , 1.2774275574805717e-09    , -7.664333879152302e-11    , 4.342736755115359e-12     , -2.356934558195723e-13    , 1.2367018100384285e-14    , -6.313266041716463e-16    , 3.1489008619035273e-17    , -1.5388685351177971e-18   , 7.436513509777304e-20     , -3.500709191833703e-21    , },
+    /* x = 26.0        */  {1.6246994639087896e-05    , -2.106091862853453e-06    , 1.7550763783474315e-07    , -1.1917179484060287e-08   , 7.172362038795498e-10     , -3.98461657203427e-11     , 2.0906455385481493e-12    , -1.0507845178801412e-13   , 5.107117190860737e-15     , -2.415989295576382e-16    , 1.1175335921064245e-17    , -5.070984453089695e-19    , 2.2772894622787355e-20    , -9.998134695255249e-22    , },
+    /* x = 28.0        */  {1.2651826276292831e-05    , -1.5269445462014354e-06   , 1.1846983328833063e-07    , -7.489471488438819e-09    , 4.196684782555076e-10     , -2.170695370767497e-11    , 1.0603910727129146e-12    , -4.9623342597758296e-14   , 2.245775310501447e-15     , -9.893969992129282e-17    , 4.263373376236346e-18     , -1.8031516516818708e-19   , 7.547831321298563e-21     , -3.0956707059222773e-22   , },
+    /* x = 30.0        */  {1.001798285979623e-05     , -1.1310625803894974e-06   , 8.20932515248444e-08      , -4.854977148176897e-09    , 2.5449474672918546e-10    , -1.2314257311523606e-11   , 5.62747546831008e-13      , -2.463630317423803e-14    , 1.0430555296863742e-15    , -4.299179814930958e-17    , 1.7333683817156703e-18    , -6.860921747749366e-20    , 2.6868395700381197e-21    , -1.0323797303383111e-22   , },
+    /* x = 32.0        */  {8.049101856696141e-06     , -8.536926210941531e-07    , 5.820631503930675e-08     , -3.2336841570855113e-09   , 1.5923444418799503e-10    , -7.2379286930292986e-12   , 3.1071906302234666e-13    , -1.2778475599033417e-14   , 5.082330785494601e-16     , -1.9678864057465626e-17   , 7.453857409266976e-19     , -2.771920077844298e-20    , 1.019422625125112e-21     , -3.681718518259742e-23    , },
+    /* x = 34.0        */  {6.551006909914843e-06     , -6.55100690982477e-07     , 4.2113615844369865e-08    , -2.205951304632441e-09    , 1.0241916733977316e-10    , -4.3893928109293635e-12   , 1.7766588697930668e-13    , -6.889083626321648e-15    , 2.583404141317023e-16     , -9.431450609910158e-18    , 3.3683278060349117e-19    , -1.1810797873446777e-20   , 4.0937785826649937e-22    , -1.3943164485956047e-23   , },
+    /* x = 36.0        */  {5.3931211774403954e-06    , -5.101601113783437e-07    , 3.102325001567407e-08     , -1.5371880636475205e-09   , 6.751163788241903e-11     , -2.736958282921213e-12    , 1.047934461677541e-13     , -3.843774823693671e-15    , 1.3635009241835718e-16    , -4.708783795982177e-18    , 1.5907936176240122e-19    , -5.276560682190921e-21    , 1.7293888611320416e-22    , -5.572255860226111e-24    , },
+  },
+  /* n = 4 */
+  {
+    /* x = 0.0         */  {0.049623241133156755      , -0.039364864513484164     , 0.016283517119219406      , -0.004624333660691583     , 0.001006470589415145      , -0.0001781689970865871    , 2.6629077764831685e-05    , -3.447640541409955e-06    , 3.939866516727322e-07     , -4.031459393370547e-08    , 3.735227302140517e-09     , -3.163646571400309e-10    , 2.510282829747049e-11     , -1.8108254631054733e-12   , },
+    /* x = 2.0         */  {0.010781480935388589      , -0.007874376675105555     , 0.0030692562548578764     , -0.0008337109516235022    , 0.0001753258144358397     , -3.0202588778718495e-05   , 4.415470823062483e-06     , -5.61337657305626e-07     , 6.317463478694596e-08     , -6.3808562958731396e-09   , 5.846314999529333e-10     , -4.903840164118804e-11    , 3.857185011573921e-12     , -2.7617442055381444e-13   , },
+    /* x = 4.0         */  {0.0027029516726074744     , -0.00175886180543818      , 0.0006304766430366918     , -0.00016090742866448787   , 3.2265506586869184e-05    , -5.355316406813838e-06    , 7.60024220137088e-07      , -9.431784222858728e-08    , 1.0405210899729895e-08    , -1.0335367978463947e-09   , 9.336143779553472e-11     , -7.736228953360155e-12    , 6.019347305711556e-13     , -4.2705077691386947e-14   , },
+    /* x = 6.0         */  {0.0008035385039778061     , -0.00045142604073183847   , 0.00014477873151769855    , -3.395672683221138e-05    , 6.381617408847815e-06     , -1.0070344864462631e-06   , 1.3731712881288304e-07    , -1.6501601864274624e-08   , 1.7732861061341522e-09    , -1.7234926660420413e-10   , 1.5287353104923686e-11    , -1.2473004971435594e-12   , 9.573560381150877e-14     , -6.715070967788974e-15    , },
+    /* x = 8.0         */  {0.0002850835578606294     , -0.00013568567870327693   , 3.8031462823592685e-05    , -8.013039160432837e-06    , 1.3837123156436445e-06    , -2.0423371328344175e-07   , 2.6407643607930216e-08    , -3.0409365964941346e-09   , 3.1566321217488645e-10    , -2.9819863042324614e-11   , 2.5832846155811098e-12    , -2.0662876802984479e-13   , 1.5587952858552165e-14    , -1.0778065455363018e-15   , },
+    /* x = 10.0        */  {0.000118706325521917      , -4.7802510404863964e-05   , 1.1571043492346636e-05    , -2.1526168940209798e-06   , 3.3529132513785437e-07    , -4.5491348433885995e-08   , 5.493596807632545e-09     , -5.984982237641041e-10    , 5.938429643453346e-11     , -5.405950681714698e-12    , 4.5419654728274385e-13    , -3.541299095069431e-14    , 2.613266535622255e-15     , -1.774383123127245e-16    , },
+    /* x = 12.0        */  {5.636130042241453e-05     , -1.9422745169028836e-05   , 4.06518975869875e-06      , -6.630423353794026e-07    , 9.200878329710014e-08     , -1.1307453262229215e-08   , 1.25644572597936e-09      , -1.2772535092933328e-10   , 1.1967337994822041e-11    , -1.0389898451963299e-12   , 8.392884541424482e-14     , -6.3327263516105255e-15   , 4.543429340331445e-16     , -3.0145124438878175e-17   , },
+    /* x = 14.0        */  {2.9649202419962384e-05    , -8.884563981971987e-06    , 1.6237383580198301e-06    , -2.3284052771118789e-07   , 2.868020162993038e-08     , -3.1654499845825996e-09   , 3.1996868686492653e-10    , -2.99737052068133e-11     , 2.6195857124366137e-12    , -2.1445470269390526e-13   , 1.6489408087686017e-14    , -1.1936660279353351e-15   , 8.264045675479307e-17     , -5.324924755914605e-18    , },
+    /* x = 16.0        */  {1.688710940501373e-05     , -4.468899566703993e-06    , 7.223014096552355e-07     , -9.185508467572687e-08    , 1.0080340984848878e-08    , -9.978871923109073e-10    , 9.124932269769941e-11     , -7.809817824271258e-12    , 6.301900732942789e-13     , -4.813065386426841e-14    , 3.486313185064116e-15     , -2.3983086062006546e-16   , 1.588504087014373e-17     , -9.867314542662161e-19    , },
+    /* x = 18.0        */  {1.023800842027792e-05     , -2.4246440259490458e-06   , 3.508615985394994e-07     , -3.9985959498199344e-08   , 3.939839428072728e-09     , -3.512832653982017e-10    , 2.9068824865638193e-11    , -2.2656528591795494e-12   , 1.6775776579984685e-13    , -1.1856683247568373e-14   , 8.017643883079157e-16     , -5.193185416108226e-17    , 3.2612750130595857e-18    , -1.937099935611379e-19    , },
+    /* x = 20.0        */  {6.525683455983575e-06     , -1.3983426868526046e-06   , 1.831072773730459e-07     , -1.888901172879525e-08    , 1.6857666662194522e-09    , -1.363163777330723e-10    , 1.0252747523538631e-11    , -7.287570225025482e-13    , 4.943739978738571e-14     , -3.2199179989250067e-15   , 2.020089623845969e-16     , -1.2228042774240106e-17   , 7.221763560731638e-19     , -4.06868296349883e-20     , },
+    /* x = 22.0        */  {4.333499327282489e-06     , -8.478563331901322e-07    , 1.0137301137277322e-07    , -9.549259698897779e-09    , 7.783793062541517e-10     , -5.7513793144087834e-11   , 3.9561844672141015e-12    , -2.575694028204241e-13    , 1.6042760778123024e-14    , -9.626181248944256e-16    , 5.588445101915543e-17     , -3.1469931970302564e-18   , 1.737395934948616e-19     , -9.22076995661989e-21     , },
+    /* x = 24.0        */  {2.977722148749627e-06     , -5.359897090160556e-07    , 5.8958729112327456e-08    , -5.109710229922164e-09    , 3.832166939576292e-10     , -2.6056420531807524e-11   , 1.649854190669542e-12     , -9.89361405534157e-14     , 5.681939582119825e-15     , -3.14897878158842e-16     , 1.6927412516618855e-17    , -8.855806829390605e-19    , 4.556062890586486e-20     , -2.2671697629936514e-21   , },
+    /* x = 26.0        */  {2.106091862853453e-06     , -3.510152756694863e-07    , 3.5751538452180856e-08    , -2.868944815518166e-09    , 1.99230828601717e-10      , -1.2543873231586941e-11   , 7.355491624991661e-13     , -4.085693639133089e-14    , 2.174390402305334e-15     , -1.1175544128118949e-16   , 5.578047416504776e-18     , -2.7145749591937286e-19   , 1.30104781173521e-20      , -6.057915943986431e-22    , },
+    /* x = 28.0        */  {1.5269445462014354e-06    , -2.3693966657666126e-07   , 2.246841446531646e-08     , -1.6786739130220206e-09   , 1.0853476853837581e-10    , -6.362346436363854e-12    , 3.4736339817970433e-13    , -1.796620215495599e-14    , 8.904573091573583e-16     , -4.2634337087166036e-17   , 1.983457169961345e-18     , -9.004739695210847e-20    , 4.027879999708756e-21     , -1.7553783614541316e-22   , },
+    /* x = 30.0        */  {1.1310625803894974e-06    , -1.641865030496888e-07    , 1.456493144453069e-08     , -1.017978986916739e-09    , 6.157128655761832e-11     , -3.376485281013056e-12    , 1.7245412221831428e-13    , -8.344444134590358e-15    , 3.8692618624088127e-16    , -1.7333872483853945e-17   , 7.546985594319719e-19     , -3.207740896967517e-20    , 1.3431237978875694e-21    , -5.489181058727826e-23    , },
+    /* x = 32.0        */  {8.536926210941531e-07     , -1.164126300786135e-07    , 9.701052471256533e-09     , -6.369377767519791e-10    , 3.618964346514658e-11     , -1.864314378143137e-12    , 8.944932919280731e-14     , -4.0658645938891065e-15   , 1.7710977743137423e-16    , -7.45392067593801e-18     , 3.049103146649408e-19     , -1.2177853593675228e-20   , 4.789484701177613e-22     , -1.8406916613712767e-23   , },
+    /* x = 34.0        */  {6.55100690982477e-07      , -8.422723168873973e-08    , 6.617853913897324e-09     , -4.0967666935909227e-10   , 2.1946964054646848e-11    , -1.0659953218790752e-12   , 4.822358538410776e-14     , -2.0667233007277798e-15   , 8.48830557972944e-17      , -3.368350404874376e-18    , 1.2991847534279179e-19    , -4.892810607106383e-21    , 1.8137069196158476e-22    , -6.574865433718859e-24    , },
+    /* x = 36.0        */  {5.101601113783437e-07     , -6.204650003134815e-08    , 4.611564190942562e-09     , -2.7004655152967595e-10   , 1.3684791414606076e-11    , -6.287606770077478e-13    , 2.6906423765804264e-14    , -1.090800734686679e-15    , 4.2379054274059234e-17    , -1.5908021617818883e-18   , 5.804205973094645e-20     , -2.067809551975597e-21    , 7.247851728306319e-23     , -2.4857958398435444e-24   , },
+  },
+  /* n = 5 */
+  {
+    /* x = 0.0         */  {0.03936486451348418       , -0.032567034238441726     , 0.013873000982073643      , -0.004025882357567275     , 0.0008908449854476487     , -0.00015977446742901507   , 2.4133483719236298e-05    , -3.151890012423215e-06    , 3.6283149677732695e-07    , -3.7358142741251795e-08   , 3.4798632050483898e-09    , -2.96110332514534e-10     , 2.3594561799937273e-11    , -1.7081348772384456e-12   , },
+    /* x = 2.0         */  {0.007874376675105557      , -0.006138512509716194     , 0.0025011328548703404     , -0.0007013032577292231    , 0.00015101294389580829    , -2.6492825065639466e-05   , 3.92936359050201e-06      , -5.053965933487985e-07    , 5.742772945972197e-08     , -5.847204262688931e-09    , 5.394001257917403e-10     , -4.550999475229604e-11    , 3.598374348546864e-12     , -2.5878161939387823e-13   , },
+    /* x = 4.0         */  {0.0017588618054381801     , -0.0012609532860734512    , 0.0004827222859934383     , -0.00012906202634530855   , 2.6776582034406622e-05    , -4.5601453403426785e-06   , 6.602248939802321e-07     , -8.324161281578752e-08    , 9.30183465216155e-09      , -9.337507744159553e-10    , 8.50951237883326e-11      , -7.104158495229104e-12    , 5.564005367908073e-13     , -3.9692116118757207e-14   , },
+    /* x = 6.0         */  {0.0004514260407318385     , -0.00028955746303540767   , 0.00010187018049663023    , -2.552646963505371e-05    , 5.035172432283387e-06     , -8.239027759162145e-07    , 1.1551121279994475e-07    , -1.4186277269252068e-08   , 1.5511439351611812e-09    , -1.528947652179444e-10    , 1.3719781604570682e-11    , -1.130292336811132e-12    , 8.748643241267827e-14     , -6.179225625939961e-15    , },
+    /* x = 8.0         */  {0.00013568567870327696    , -7.606292564718704e-05    , 2.40391174812979e-05      , -5.5348492625210685e-06   , 1.0211685664253744e-06    , -1.5844586212932045e-07   , 2.128655613625895e-08     , -2.5253038617368264e-09   , 2.683788513896915e-10     , -2.5836212235084464e-11   , 2.2728342993919566e-12    , -1.8411725707170625e-13   , 1.4041359562399051e-14    , -9.795357242288805e-16    , },
+    /* x = 10.0        */  {4.7802510404863964e-05    , -2.3142086984693543e-05   , 6.4578506820628414e-06    , -1.3411653005427445e-06   , 2.274567421707357e-07     , -3.2961580923875266e-08   , 4.18948756008041e-09      , -4.75074073955108e-10     , 4.865356956891703e-11     , -4.542511038669547e-12    , 3.8952976439548833e-13    , -3.0882987947160117e-14   , 2.311475143098462e-15     , -1.5875947579058675e-16   , },
+    /* x = 12.0        */  {1.9422745169028836e-05    , -8.130379517397543e-06    , 1.989127006138192e-06     , -3.680351331869559e-07    , 5.6537266311359925e-08    , -7.538674368882267e-09    , 8.940774554787191e-10     , -9.573865439962743e-11    , 9.350910806872528e-12     , -8.393793300313397e-13    , 6.965783847820999e-14     , -5.372792382737513e-15    , 3.926689942542449e-16     , -2.644459744230252e-17    , },
+    /* x = 14.0        */  {8.884563981971987e-06     , -3.247476716039668e-06    , 6.985215831335609e-07     , -1.147208065194726e-07    , 1.582724992294907e-08     , -1.919812123430477e-09    , 2.0981593627453598e-10    , -2.0956677160696092e-11   , 1.9300926953317907e-12    , -1.6490973828823128e-13   , 1.3129963438458187e-14    , -9.780186849720675e-16    , 6.935598278357673e-17     , -4.556204096003591e-18    , },
+    /* x = 16.0        */  {4.468899566703993e-06     , -1.4446028193104726e-06   , 2.7556525402718014e-07    , -4.0321363939350804e-08   , 4.989435961560845e-09     , -5.474959365886752e-10    , 5.466872473961807e-11     , -5.041519052765796e-12    , 4.331759496716855e-13     , -3.48659439337462e-14     , 2.6380760108378614e-15    , -1.881659420003813e-16    , 1.2850585258712227e-17    , -8.182862885728842e-19    , },
+    /* x = 18.0        */  {2.4246440259490458e-06    , -7.017231970789991e-07    , 1.1995787849459795e-07    , -1.5759357712282466e-08   , 1.7564163269921612e-09    , -1.7441294926985517e-10   , 1.585957000872314e-11     , -1.3420618367161738e-12   , 1.0671016108709332e-13    , -8.018175057427262e-15    , 5.712387994972584e-16     , -3.86716646589701e-17     , 2.522446994838158e-18     , -1.5456354574142444e-19   , },
+    /* x = 20.0        */  {1.3983426868526046e-06    , -3.6621455474609187e-07   , 5.666703518638573e-08     , -6.7430666648761155e-09   , 6.815818886655836e-10     , -6.151648515647887e-11    , 5.1012991564517495e-12    , -3.9549914020387216e-13   , 2.897926427498678e-14     , -2.0201961484054497e-15   , 1.3450623647540404e-16    , -8.573137260831977e-18    , 5.297412092769116e-19     , -3.099642390082973e-20    , },
+    /* x = 22.0        */  {8.478563331901322e-07     , -2.0274602274554647e-07   , 2.8647779096693332e-08    , -3.1135172250162427e-09   , 2.8756896572048467e-10    , -2.373710680656021e-11    , 1.8029858195245183e-12    , -1.2834207374432531e-13   , 8.663563592192879e-15     , -5.588673946759461e-16    , 3.4616467399072486e-17    , -2.0649008251215543e-18   , 1.2003647922562836e-19    , -6.658771180028305e-21    , },
+    /* x = 24.0        */  {5.359897090160556e-07     , -1.1791745822465493e-07   , 1.532913068976649e-08     , -1.5328667758304324e-09   , 1.3028210265904762e-10    , -9.89912514477639e-12     , 6.925529838259248e-13     , -4.545551376454573e-14    , 2.8340810062621572e-15    , -1.6927942860909637e-16   , 9.741286959223228e-18     , -5.4209858865577485e-19   , 2.950977341099712e-20     , -1.5431268136810807e-21   , },
+    /* x = 26.0        */  {3.510152756694863e-07     , -7.150307690436171e-08    , 8.606834446554498e-09     , -7.969233144068469e-10    , 6.271936615793707e-11     , -4.413294975185528e-12    , 2.8599855472795346e-13    , -1.739512249250596e-14    , 1.0057989958810843e-15    , -5.578180520301799e-17    , 2.986008644635424e-18     , -1.5496399225961106e-19   , 7.883949451881939e-21     , -3.87279978323991e-22     , },
+    /* x = 28.0        */  {2.3693966657666126e-07    , -4.493682893063292e-08    , 5.036021739066062e-09     , -4.3413907415349746e-10   , 3.181173218181988e-11     , -2.0841803891300276e-12   , 1.2576341508178429e-13    , -7.12365827589488e-15     , 3.8370904001548253e-16    , -1.983493357081591e-17    , 9.905152736720582e-19     , -4.8018718052334203e-20   , 2.284207518587884e-21     , -1.0528828560957491e-22   , },
+    /* x = 30.0        */  {1.641865030496888e-07     , -2.912986288906138e-08    , 3.053936960750217e-09     , -2.4628514623047156e-10   , 1.688242640506545e-11     , -1.0347247333250972e-12   , 5.841110894132919e-14     , -3.0954094319722426e-15   , 1.560048540761783e-16     , -7.54709185450092e-18     , 3.5284981536016385e-19    , -1.6024742360659114e-20   , 7.142056698706164e-22     , -3.0916394910097307e-23   , },
+    /* x = 32.0        */  {1.164126300786135e-07     , -1.9402104942513066e-08   , 1.9108133302559372e-09    , -1.447585738605858e-10    , 9.321571890715735e-12     , -5.366959751616439e-13    , 2.8461052156984967e-14    , -1.4168782011637027e-15   , 6.708528659514169e-17     , -3.049136676070094e-18    , 1.3395588918367573e-19    , -5.718117622939561e-21    , 2.3947186578283663e-22    , -9.755230925461003e-24    , },
+    /* x = 34.0        */  {8.422723168873973e-08     , -1.3235707827794648e-08   , 1.2290300080772769e-09    , -8.778785621858721e-11    , 5.329976609395392e-12     , -2.893415123062642e-13    , 1.446706310501849e-14     , -6.790644402152077e-16    , 3.0315153806666026e-17    , -1.2991960533492552e-18   , 5.38207574940462e-20      , -2.166585959282652e-21    , 8.553113734684956e-23     , -3.2876158376089594e-24   , },
+    /* x = 36.0        */  {6.204650003134815e-08     , -9.223128381885124e-09    , 8.101396545890279e-10     , -5.473916565842424e-11    , 3.1438033850387446e-12    , -1.6143854259540428e-13   , 7.635605142781033e-15     , -3.390324319877325e-16    , 1.4317219511153413e-17    , -5.804246395974302e-19    , 2.274585117854469e-20     , -8.662142018085755e-22    , 3.233494391798084e-23     , -1.1760556345306313e-24   , },
+  },
+  /* n = 6 */
+  {
+    /* x = 0.0         */  {0.03256703423844174       , -0.027746001964150044     , 0.012077647072700778      , -0.0035633799417022992    , 0.0007988723371590387     , -0.00014480090311034608   , 2.2063230019928843e-05    , -2.9026489450986467e-06   , 3.362234283307791e-07     , -3.48041866699142e-08     , 3.2570731778192615e-09    , -2.782861769852035e-10    , 2.2256840850082805e-11    , -1.6164411682208e-12      , },
+    /* x = 2.0         */  {0.006138512509716196      , -0.005002265709741096     , 0.0021039097731875124     , -0.0006040517755699359    , 0.00013246412533028895    , -2.3576181662727625e-05   , 3.537776143400451e-06     , -4.594213794959707e-07    , 5.262485988329308e-08     , -5.3948377749992966e-09   , 5.005888994907195e-10     , -4.245030723604975e-11    , 3.371813547755233e-12     , -2.434326905213896e-13    , },
+    /* x = 4.0         */  {0.0012609532860734516     , -0.0009654445719869399    , 0.0003871860790359019     , -0.00010710632813560156   , 2.2800726702029863e-05    , -3.961349382111818e-06    , 5.826912881912403e-07     , -7.441460774962688e-08    , 8.403760225681266e-09     , -8.510786229156943e-10    , 7.81425595805998e-11      , -6.565613940410423e-12    , 5.171553652303198e-13     , -3.70698396150444e-14     , },
+    /* x = 6.0         */  {0.00028955746303540767    , -0.00020374036099327024   , 7.65794089051575e-05      , -2.0140689728821065e-05   , 4.119513879629531e-06     , -6.930672796129489e-07    , 9.930394065213165e-08     , -1.240914076122885e-08    , 1.3760533855139328e-09    , -1.3721747369401968e-10   , 1.2432728188601142e-11    , -1.0326783652890845e-12   , 8.050722478032491e-14     , -5.7204704766922545e-15   , },
+    /* x = 8.0         */  {7.606292564718705e-05     , -4.8078234962597335e-05   , 1.660454778756264e-05     , -4.084674265652495e-06    , 7.922293106541292e-07     , -1.2771933725871262e-07   , 1.767712699602357e-08     , -2.1470291300805552e-09   , 2.3252598755439474e-10    , -2.2731425542551907e-11   , 2.025214103464856e-12     , -1.6580561949759318e-13   , 1.2761502517232365e-14    , -8.970312779154134e-16    , },
+    /* x = 10.0        */  {2.3142086984693543e-05    , -1.2915701364125927e-05   , 4.023495901628144e-06     , -9.098269686751071e-07    , 1.6480790462056585e-07    , -2.5136925431025912e-08   , 3.3255185119752416e-09    , -3.8922828774687684e-10   , 4.0882611586110636e-11    , -3.895790553411364e-12    , 3.39700900276565e-13      , -2.7307452521008565e-14   , 2.068225180941285e-15     , -1.4343718027093126e-16   , },
+    /* x = 12.0        */  {8.130379517397543e-06     , -3.978254012276423e-06    , 1.104105399560853e-06     , -2.261490652441564e-07    , 3.769337184460333e-08     , -5.364464744425682e-09    , 6.701705798757254e-10     , -7.480724243139339e-11    , 7.5544159454818e-12       , -6.966591108311978e-13    , 5.909878474375668e-14     , -4.641564366457177e-15    , 3.44482166625527e-16      , -2.3491166544532846e-17   , },
+    /* x = 14.0        */  {3.247476716039668e-06     , -1.3970431662671286e-06   , 3.4416241955841544e-07    , -6.330899969157982e-08    , 9.59906061718418e-09      , -1.2588956195958793e-09   , 1.4669673997223661e-10    , -1.544073413742071e-11    , 1.4841879717034379e-12    , -1.3131324994385431e-13   , 1.0757885668717498e-14    , -8.203872097651791e-16    , 5.934697594175115e-17     , -3.9620677149754885e-18   , },
+    /* x = 16.0        */  {1.4446028193104726e-06    , -5.511305080543615e-07    , 1.20964091818052e-07      , -1.9957743846205528e-08   , 2.73747968294881e-09      , -3.280123487784749e-10    , 3.5290633343272566e-11    , -3.4654062989214273e-12   , 3.1379355131188205e-13    , -2.6383141044722254e-14   , 2.0697706920051105e-15    , -1.521287943167961e-16    , 1.0657603035079949e-17    , -6.928333955917437e-19    , },
+    /* x = 18.0        */  {7.017231970789991e-07     , -2.399157569891961e-07    , 4.727807313684733e-08     , -7.025665307961728e-09    , 8.720647463502412e-10     , -9.515742011461179e-11    , 9.394432852379404e-12     , -8.536810514155026e-13    , 7.216358544734446e-14     , -5.712823087008493e-15    , 4.2537860070838e-16       , -2.9889591664790475e-17   , 2.0128574180871498e-18    , -1.2660643804677736e-19   , },
+    /* x = 20.0        */  {3.6621455474609187e-07    , -1.133340703727715e-07    , 2.0229199994628332e-08    , -2.726327554661002e-09    , 3.0758242578257395e-10    , -3.0607794950707375e-11   , 2.768493980564925e-12     , -2.31834068488301e-13     , 1.818176718333582e-14     , -1.3451461831395679e-15   , 9.430270311562315e-17     , -6.283733884199335e-18    , 4.03610550320623e-19      , -2.4389706717059612e-20   , },
+    /* x = 22.0        */  {2.0274602274554647e-07    , -5.729555819338667e-08    , 9.340551675048726e-09     , -1.1502758628816657e-09   , 1.1868553403283633e-10    , -1.0817914919605317e-11   , 8.983945160408047e-13     , -6.930849937120216e-14    , 5.029806915267907e-15     , -3.4618184823106856e-16   , 2.2713553939485645e-17    , -1.4254474204235351e-18   , 8.669317305182847e-20     , -4.997313376183359e-21    , },
+    /* x = 24.0        */  {1.1791745822465493e-07    , -3.065826137953298e-08    , 4.598600327491297e-09     , -5.211284106361304e-10    , 4.949562572388934e-11     , -4.155317903495511e-12    , 3.1818859631634e-13       , -2.2672645992747572e-14   , 1.5235149335162795e-15    , -9.74166419246709e-17     , 5.963010125968512e-18     , -3.508246819008258e-19    , 2.0087686026644418e-20    , -1.0976406599779528e-21   , },
+    /* x = 26.0        */  {7.150307690436171e-08     , -1.7213668893108996e-08   , 2.3907699432205406e-09    , -2.5087746463173407e-10   , 2.2066474875929298e-11    , -1.7159913284955796e-12   , 1.21765857439577e-13      , -8.04639147989179e-15     , 5.0203626389559715e-16    , -2.9860979679527577e-17   , 1.7045872248003561e-18    , -9.382776285055977e-20    , 5.0407091076679636e-21    , -2.5989988061192e-22      , },
+    /* x = 28.0        */  {4.493682893063292e-08     , -1.0072043478132124e-08   , 1.3024172224604923e-09    , -1.2724692872727587e-10   , 1.0420901945650539e-11    , -7.545804905234229e-13    , 4.986560792933891e-14     , -3.0696721954698633e-15   , 1.785144062631267e-16     , -9.905381294777447e-18    , 5.282018642755939e-19     , -2.721100265946819e-20    , 1.3702147919471136e-21    , -6.650113324948982e-23    , },
+    /* x = 30.0        */  {2.912986288906138e-08     , -6.107873921500434e-09    , 7.388554386914147e-10     , -6.752970562026079e-11    , 5.17362366662559e-12      , -3.5046665365701406e-13   , 2.166786602330402e-14     , -1.2480387981711316e-15   , 6.792382776559341e-17     , -3.528561296817933e-18    , 1.762711147259385e-19     , -8.51535661826755e-21     , 4.0229541762910776e-22    , -1.8371774655944866e-23   , },
+    /* x = 32.0        */  {1.9402104942513066e-08    , -3.8216266605118744e-09   , 4.342757215817574e-10     , -3.728628756286264e-11    , 2.6834798758082485e-12    , -1.707663129445965e-13    , 9.918147408005243e-15     , -5.366822825249047e-16    , 2.74422303860938e-17      , -1.3395776599372633e-18   , 6.289899907676501e-20     , -2.8572817334764806e-21   , 1.2692519672108148e-22    , -5.460563539599576e-24    , },
+    /* x = 34.0        */  {1.3235707827794648e-08    , -2.4580600161545537e-09   , 2.6336356865576165e-10    , -2.1319906437581476e-11   , 1.44670756153133e-12      , -8.680237863096571e-14    , 4.753451081464171e-15     , -2.4252122719675957e-16   , 1.169276457075328e-17     , -5.382135457942115e-19    , 2.3832356952506776e-20    , -1.0211623736408363e-21   , 4.2771224888518225e-23    , -1.7371895575170473e-24   , },
+    /* x = 36.0        */  {9.223128381885124e-09     , -1.6202793091780558e-09   , 1.642174969752727e-10     , -1.2575213540154946e-11   , 8.071927129770243e-13     , -4.5813630856975585e-14   , 2.3732270239005743e-15    , -1.1453775498670581e-16   , 5.223821785420504e-18     , -2.274605332199832e-19    , 9.5283278207627e-21       , -3.862550604106022e-22    , 1.529905048293232e-23     , -5.881186419785773e-25    , },
+  },
+  /* n = 7 */
+  {
+    /* x = 0.0         */  {0.027746001964150058      , -0.024155294145404172     , 0.010690139825105902      , -0.0031954893485523594    , 0.0007240045155650166     , -0.00013237938087399046   , 2.0318542551908132e-05    , -2.6897845518914594e-06   , 3.132378167210294e-07     , -3.2576003337721967e-08   , 3.061014280434422e-09     , -2.6248060117424977e-10   , 2.1062344848037735e-11    , -1.5340709347994785e-12   , },
+    /* x = 2.0         */  {0.005002265709741098      , -0.004207819546375417     , 0.0018121553267096593     , -0.0005298565013086039    , 0.00011788090831561865    , -2.1226656973408363e-05   , 3.2159496469640314e-06    , -4.209984484523032e-07    , 4.855356035102624e-08     , -5.00667862847912e-09     , 4.669334545618769e-10     , -3.977250089200061e-11    , 3.1718709903162948e-12    , -2.297896986159777e-13    , },
+    /* x = 4.0         */  {0.0009654445719869401     , -0.0007743721580718631    , 0.00032131898440678234    , -9.120290680622028e-05    , 1.9806746910857023e-05    , -3.496147746245667e-06    , 5.209022528171124e-07     , -6.723001665194998e-08    , 7.659710671453308e-09     , -7.815450700029542e-10    , 7.221875597975971e-11     , -6.101576998023937e-12    , 4.82997947195992e-13      , -3.4767819777103616e-14   , },
+    /* x = 6.0         */  {0.00020374036099327027    , -0.0001531588178103241    , 6.0422069186459796e-05    , -1.6478055518227325e-05   , 3.465336398110049e-06     , -5.958236465308781e-07    , 8.68639851111118e-08      , -1.1008417107811891e-08   , 1.2349577293469248e-09    , -1.2434557571479481e-10   , 1.1359006234874886e-11    , -9.501183036021656e-13    , 7.45318678100753e-14      , -5.323607646060863e-15    , },
+    /* x = 8.0         */  {4.807823496259734e-05     , -3.320909557512669e-05    , 1.2254022796956963e-05    , -3.1689172425713474e-06   , 6.38596686300541e-07      , -1.0606276238279943e-07   , 1.5029203877065076e-08    , -1.8602063508597293e-09   , 2.0458290167379053e-10    , -2.0254982526220645e-11   , 1.8237916128741473e-12    , -1.5065774419195572e-13   , 1.1686936324326207e-14    , -8.268857923915454e-16    , },
+    /* x = 10.0        */  {1.2915701364125929e-05    , -8.046991803256512e-06    , 2.7294809060252393e-06    , -6.59231618475125e-07     , 1.25684627156221e-07      , -1.9953111136117694e-08   , 2.7245980089884395e-09    , -3.2706064780276806e-10   , 3.506212620980449e-11     , -3.397458054155474e-12    , 3.003709972223518e-13     , -2.4426734759459637e-14   , 1.8686765413242774e-15    , -1.3067499075236928e-16   , },
+    /* x = 12.0        */  {3.978254012276423e-06     , -2.208210799121742e-06    , 6.784471957324561e-07     , -1.5077348737726116e-07   , 2.6822323722302344e-08    , -4.02102348962672e-09     , 5.236506961847815e-10     , -6.043528804025201e-11    , 6.2699337868907386e-12    , -5.910603221111484e-13    , 5.1055458238720205e-14    , -4.070524656601706e-15    , 3.060214977474677e-16     , -2.10901379082821e-17     , },
+    /* x = 14.0        */  {1.3970431662671286e-06    , -6.883248391168368e-07    , 1.8992699907473734e-07    , -3.8396242468545916e-08   , 6.294478098007749e-09     , -8.801804415511567e-10    , 1.0808513882583825e-10    , -1.1873497228287895e-11   , 1.1818195411811624e-12    , -1.0759085884568802e-13   , 9.02397407951093e-15      , -7.016873768932274e-16    , 5.161060661111462e-17     , -3.49259760088778e-18     , },
+    /* x = 16.0        */  {5.511305080543615e-07     , -2.4192818363610504e-07   , 5.987323153861622e-08     , -1.094991873176263e-08    , 1.6400617438971257e-09    , -2.1174380035322133e-10   , 2.4257844069641413e-11    , -2.5103472918123827e-12   , 2.3744831828275867e-13    , -2.0699758228602672e-14   , 1.673368939663642e-15     , -1.2610071959418487e-16   , 9.024216317381294e-18     , -5.969190289150859e-19    , },
+    /* x = 18.0        */  {2.399157569891961e-07     , -9.455614627369484e-08    , 2.1076995923885123e-08    , -3.4882589853951723e-09   , 4.757871005738825e-10     , -5.6366597166423086e-11   , 5.9757673559552426e-12    , -5.77308484880642e-13     , 5.14154162551709e-14      , -4.254150353194373e-15    , 3.287772238554361e-16     , -2.3836266051309348e-17   , 1.648896415925124e-18     , -1.060212456027875e-19    , },
+    /* x = 20.0        */  {1.133340703727715e-07     , -4.0458399989256696e-08   , 8.178982663982994e-09     , -1.230329703129218e-09    , 1.5303897475368555e-10    , -1.6610963893091936e-11   , 1.6228384787043758e-12    , -1.454541004974491e-13    , 1.2106317177815717e-14    , -9.430948197422876e-16    , 6.911957704819555e-17     , -4.784157181594201e-18    , 3.1761010314415686e-19    , -1.9725531242290937e-20   , },
+    /* x = 22.0        */  {5.729555819338667e-08     , -1.8681103350097458e-08   , 3.450827588644995e-09     , -4.747421361311335e-10    , 5.4089574598054766e-11    , -5.390367098151919e-12    , 4.851594954631316e-13     , -4.0238448055608745e-14   , 3.1156369239971543e-15    , -2.2714886351426377e-16   , 1.5679638130333276e-17    , -1.028688198051016e-18    , 6.506816861554122e-20     , -3.877065159607225e-21    , },
+    /* x = 24.0        */  {3.065826137953298e-08     , -9.197200654982595e-09    , 1.563385231908391e-09     , -1.97982502895513e-10     , 2.077658951748321e-11     , -1.9091315782972926e-12   , 1.5870852192209474e-13    , -1.2188117946892069e-14   , 8.767498354800158e-16     , -5.963289060963359e-17    , 3.859014631705361e-18     , -2.3861758992024397e-19   , 1.4290009388919887e-20    , -8.116322670534017e-22    , },
+    /* x = 26.0        */  {1.7213668893108996e-08    , -4.781539886441081e-09    , 7.526323938952022e-10     , -8.826589950370724e-11    , 8.579956642479108e-12     , -7.305951447270861e-13    , 5.632474035343858e-14     , -4.016289769683472e-15    , 2.6874882955367043e-16    , -1.7046498381690673e-17   , 1.0320932291180974e-18    , -5.994200379198641e-20    , 3.383121296380525e-21     , -1.821858632751826e-22    , },
+    /* x = 28.0        */  {1.0072043478132124e-08    , -2.604834444920985e-09    , 3.8174078618182763e-10    , -4.1683607782599746e-11   , 3.772902452617391e-12     , -2.9919364759769705e-13   , 2.148770536695837e-14     , -1.4281151675647506e-15   , 8.914843450462554e-17     , -5.282169985055542e-18    , 2.9931824084594045e-19    , -1.631048350667687e-20    , 8.655287440901066e-22     , -4.40351245395593e-23     , },
+    /* x = 30.0        */  {6.107873921500434e-09     , -1.4777108773828293e-09   , 2.0258911686078237e-10    , -2.0694494666501733e-11   , 1.7523332682851386e-12    , -1.3000719614546907e-13   , 8.736271586869906e-15     , -5.433906006172899e-16    , 3.1757052374292794e-17    , -1.7627505819231232e-18   , 9.366823545697526e-20     , -4.793126159111122e-21    , 2.3908302387127928e-22    , -1.1473838188211895e-23   , },
+    /* x = 32.0        */  {3.8216266605118744e-09    , -8.685514431635148e-10    , 1.1185886268858793e-10    , -1.0733919503232818e-11   , 8.538315647230006e-13     , -5.950888444961433e-14    , 3.756775977587395e-15     , -2.1953783705804616e-16   , 1.2056199125741143e-17    , -6.290010481449615e-19    , 3.1429916894658265e-20    , -1.5134514958802014e-21   , 7.105357336006876e-23     , -3.2171777685798494e-24   , },
+    /* x = 34.0        */  {2.4580600161545537e-09    , -5.267271373115233e-10    , 6.395971931274442e-11     , -5.786830246125267e-12    , 4.3401189315483367e-13    , -2.852070648926078e-14    , 1.6976485903526022e-15    , -9.354211475343743e-17    , 4.843921965110337e-18     , -2.3832689289702654e-19   , 1.1232734322529428e-20    , -5.1035408857322195e-22   , 2.260229668799624e-23     , -9.669300379881772e-25    , },
+    /* x = 36.0        */  {1.6202793091780558e-09    , -3.284349939505454e-10    , 3.7725640620464835e-11    , -3.22877085190808e-12     , 2.290681542848795e-13     , -1.4239362143555938e-14   , 8.017642848994362e-16     , -4.179057370237936e-17    , 2.0471448150617463e-18    , -9.528434343039581e-20    , 4.248789939440111e-21     , -1.826588955835525e-22    , 7.651260723412425e-24     , -3.099206804494526e-25    , },
+  },
+  /* n = 8 */
+  {
+    /* x = 0.0         */  {0.024155294145404183      , -0.021380279650214294     , 0.009586468045656129      , -0.002896018062180335     , 0.0006618969043826237     , -0.00012191125602927666   , 1.882849180240882e-05     , -2.5058997984368877e-06   , 2.9318416040708984e-07    , -3.061515870225482e-08    , 2.887159130702118e-09     , -2.483698098449967e-10    , 1.99892828612558e-11      , -1.4596733655784337e-12   , },
+    /* x = 2.0         */  {0.004207819546375419      , -0.00362431065341969      , 0.0015895695039256706     , -0.0004715236332505894    , 0.00010613328486892235    , -1.9295697988787313e-05   , 2.9469891301382625e-06    , -3.8842807506653507e-07   , 4.506012700387605e-08     , -4.670082238128381e-09    , 4.3747859047383046e-10    , -3.740979941454555e-11    , 2.9941463626494204e-12    , -2.1758490647061963e-13   , },
+    /* x = 4.0         */  {0.0007743721580718634     , -0.0006426379688136205    , 0.0002736087204186398     , -7.922698764164017e-05    , 1.7480738731509756e-05    , -3.1254135329993508e-06   , 4.7061011521264e-07       , -6.127762403446549e-08    , 7.033908525366508e-09     , -7.223000359996231e-10    , 6.711451572414063e-11     , -5.697796321402476e-12    , 4.5301128136639713e-13    , -3.273142477728236e-14    , },
+    /* x = 6.0         */  {0.00015315881781032413    , -0.00012084413837292809   , 4.943416655467878e-05     , -1.3861345592168321e-05   , 2.9791182326969184e-06    , -5.211839131143478e-07    , 7.705891955052115e-08     , -9.879652507813465e-09    , 1.119110618971003e-09     , -1.1360716549678213e-10   , 1.0450873486698296e-11    , -8.79453325667966e-13     , 6.936249383972632e-14     , -4.977125542719126e-15    , },
+    /* x = 8.0         */  {3.32090955751267e-05      , -2.4508045593915233e-05   , 9.506751727713553e-06     , -2.554386745160289e-06    , 5.303138119204986e-07     , -9.01752236393907e-08     , 1.3021444424806874e-08    , -1.6366617768226358e-09   , 1.8229490962439034e-10    , -1.824055040073923e-11    , 1.6571697783591152e-12    , -1.3794382421309795e-13   , 1.0773301683060504e-14    , -7.665864029716232e-16    , },
+    /* x = 10.0        */  {8.046991803256512e-06     , -5.458961812050684e-06    , 1.9776948554252993e-06    , -5.027385086183342e-07    , 9.976555568159618e-08     , -1.6347588112898556e-08   , 2.2894245297817375e-09    , -2.8049678498089157e-10   , 3.0577132854866746e-11    , -3.0041220045240595e-12   , 2.686839443959867e-13     , -2.2064463530643864e-14   , 1.702461676312052e-15     , -1.199027992859594e-16    , },
+    /* x = 12.0        */  {2.2082107991217425e-06    , -1.3568943914649448e-06   , 4.523204621317716e-07     , -1.0728929488816562e-07   , 2.01051174482924e-08      , -3.141904186505452e-09    , 4.2304701551941865e-10    , -5.0159434488903577e-11   , 5.31954453276764e-12      , -5.106202406732814e-13    , 4.477417362531984e-14     , -3.614946343458688e-15    , 2.7475277847777664e-16    , -1.9106655793125268e-17   , },
+    /* x = 14.0        */  {6.883248391168368e-07     , -3.7985399814948e-07      , 1.1518872740563584e-07    , -2.5177912391860855e-08   , 4.4009022077813156e-09    , -6.485108344867585e-10    , 8.311448047544776e-11     , -9.454550492856835e-12    , 9.68317992282533e-13      , -9.025044336628653e-14    , 7.718304290260097e-15     , -6.099852884915412e-16    , 4.549717731049148e-17     , -3.1144384381340833e-18   , },
+    /* x = 16.0        */  {2.4192818363610504e-07    , -1.1974646307723334e-07   , 3.2849756195287577e-08    , -6.560246975559992e-09    , 1.0587190017703126e-09    , -1.4554706467453073e-10   , 1.7572431022494855e-11    , -1.8995855681922085e-12   , 1.862978673298948e-13     , -1.6735482873953352e-14   , 1.3870656012527763e-15    , -1.0672512521102875e-16   , 7.775335425386323e-18     , -5.218951908869587e-19    , },
+    /* x = 18.0        */  {9.455614627369484e-08     , -4.21539918477704e-08     , 1.0464776956185464e-08    , -1.9031484022905883e-09   , 2.818329858328292e-10     , -3.5854604180220095e-11   , 4.041159390738087e-12     , -4.1132316052205754e-13   , 3.828736052175212e-14     , -3.2880830821408886e-15   , 2.621917461782463e-16     , -1.9515432992703672e-17   , 1.380887412438602e-18     , -9.045327145701547e-20    , },
+    /* x = 20.0        */  {4.0458399989256696e-08    , -1.6357965327966017e-08   , 3.6909891093876447e-09    , -6.1215589901385e-10      , 8.305481946558522e-11     , -9.737030880258186e-12    , 1.0181787028794638e-12    , -9.685050681802053e-14    , 8.487854669255634e-15     , -6.912518887470439e-16    , 5.2624466029531375e-17    , -3.762338019498804e-18    , 2.5689119592069027e-19    , -1.6329792358139886e-20   , },
+    /* x = 22.0        */  {1.8681103350097458e-08    , -6.901655177289995e-09    , 1.4242264083933988e-09    , -2.1635829839204996e-10   , 2.695183549078265e-11     , -2.910956974301168e-12    , 2.816691362785928e-13     , -2.4925089591248432e-14   , 2.0443400087955656e-15    , -1.5680701776006567e-16   , 1.1315338265250722e-17    , -7.71533997509585e-19     , 5.048618418854048e-20     , -3.0950419998186e-21      , },
+    /* x = 24.0        */  {9.197200654982595e-09     , -3.126770463816783e-09    , 5.939475086865387e-10     , -8.310635806989891e-11    , 9.545657891490917e-12     , -9.52251131837956e-13     , 8.5316825606866e-14       , -7.013997520236173e-15    , 5.366960613014694e-16     , -3.8592279924967376e-17   , 2.6247486894664527e-18    , -1.6961781191254615e-19   , 1.0567511163491037e-20    , -6.208354465580004e-22    , },
+    /* x = 26.0        */  {4.781539886441081e-09     , -1.5052647877904046e-09   , 2.6479769851112163e-10    , -3.4319826569909173e-11   , 3.652975723636342e-12     , -3.3794844218594207e-13   , 2.81140283834071e-14      , -2.1499903875833952e-15   , 1.5341849481565404e-16    , -1.0321388574569724e-17   , 6.593528691581411e-19     , -4.019919675314578e-20    , 2.3717518693642386e-21    , -1.3276643081481604e-22   , },
+    /* x = 28.0        */  {2.604834444920985e-09     , -7.634815723636553e-10    , 1.2505082334779922e-10    , -1.5091609810467904e-11   , 1.4959682379886843e-12    , -1.2892623221672368e-13   , 9.996806171997258e-15     , -7.13187418986144e-16     , 4.753953191420578e-17     , -2.993287015450142e-18    , 1.7941331527989451e-19    , -1.0295041556590229e-20   , 5.731851240815002e-22     , -3.043727791598704e-23    , },
+    /* x = 30.0        */  {1.4777108773828293e-09    , -4.0517823372156474e-10   , 6.20834839995052e-11      , -7.009333073140145e-12    , 6.500359807273919e-13     , -5.241762952491036e-14    , 3.80373420409734e-15      , -2.5405640493163676e-16   , 1.5864755716673943e-17    , -9.36708139261446e-19     , 5.272391901255405e-20     , -2.8464910536328356e-21   , 1.493303539046977e-22     , -7.502373065030154e-24    , },
+    /* x = 32.0        */  {8.685514431635148e-10     , -2.2371772537717585e-10   , 3.2201758509698453e-11    , -3.415326258891894e-12    , 2.975444222480834e-13     , -2.2540655866502602e-14   , 1.53676485935015e-15      , -9.644958927884071e-17    , 5.661009553682226e-18     , -3.143060026733276e-19    , 1.6647848746615548e-20    , -8.466783687123733e-22    , 4.1866115607241534e-23    , -1.988320571735134e-24    , },
+    /* x = 34.0        */  {5.267271373115233e-10     , -1.2791943862548886e-10   , 1.73604907383758e-11      , -1.7360475726193038e-12   , 1.4260353244630704e-13    , -1.0185891542393699e-14   , 6.54794803258936e-16      , -3.8751374661385364e-17   , 2.144942068487856e-18     , -1.1232928582396496e-19   , 5.613863278663536e-21     , -2.6953206548087444e-22   , 1.2581616590814603e-23    , -5.6520326838443105e-25   , },
+    /* x = 36.0        */  {3.284349939505454e-10     , -7.545128124092967e-11    , 9.68631255572424e-12      , -9.162726171395086e-13    , 7.119681071778061e-14     , -4.810585709481056e-15    , 2.9253401591230083e-16    , -1.6377158198788065e-17   , 8.575591002055407e-19     , -4.248848923963561e-20    , 2.0092387264673335e-21    , -9.130031750882148e-23    , 4.032287116377245e-24     , -1.7161420270553261e-25   , },
+  },
+  /* n = 9 */
+  {
+    /* x = 0.0         */  {0.021380279650214305      , -0.01917293609131463      , 0.008688054186540096      , -0.0026475876174544524    , 0.0006095562801584943     , -0.00011297095149907038   , 1.7541298530917238e-05    , -2.345470674472905e-06    , 2.7553655292209667e-07    , -2.8876375153512867e-08   , 2.731946064215332e-09     , -2.3569561823380934e-10   , 1.9020064086585416e-11    , -1.3921461873286463e-12   , },
+    /* x = 2.0         */  {0.0036243106534196916     , -0.0031791390078516934    , 0.0014145708997516339     , -0.0004245331394644041    , 9.64784899457267e-05      , -1.768193488243191e-05    , 2.7189965168719342e-06    , -3.604806288688505e-07    , 4.203075856052057e-08     , -4.375495860509166e-09    , 4.114897838250952e-10     , -3.531004330951132e-11    , 2.8351532770444088e-12    , -2.0660353306242718e-13   , },
+    /* x = 4.0         */  {0.0006426379688136207     , -0.0005472174408373323    , 0.00023768096292490053    , -6.992295492435019e-05    , 1.562706766526338e-05     , -2.8236607064804715e-06   , 4.289433669612816e-07     , -5.6271210264860204e-08   , 6.500703067107681e-09     , -6.712514005427855e-10    , 6.267307713945083e-11     , -5.34339685381282e-12     , 4.264840124477498e-13     , -3.091766344927748e-14    , },
+    /* x = 6.0         */  {0.00012084413837292813    , -9.886833310936553e-05    , 4.1584036776501956e-05    , -1.1916472930532461e-05   , 2.6059195656118056e-06    , -4.623535196008132e-07    , 6.915756736234846e-08     , -8.952876196335262e-09    , 1.0224649016857717e-09    , -1.0452479000770438e-10   , 9.673583491789004e-12     , -8.183356108468485e-13    , 6.484922139739087e-14     , -4.6721594463363594e-15   , },
+    /* x = 8.0         */  {2.450804559391524e-05     , -1.9013503455428326e-05   , 7.663160235480411e-06     , -2.1212552476429788e-06   , 4.508761182030377e-07     , -7.812866690009783e-08    , 1.145663240855009e-08     , -1.4583579385212637e-09   , 1.6416501620278287e-10    , -1.6574152182741578e-11   , 1.517320855811924e-12     , -1.2713721330470609e-13   , 9.987883258863223e-15     , -7.142444649855037e-16    , },
+    /* x = 10.0        */  {5.4589618120506845e-06    , -3.9553897108507874e-06   , 1.5082155258549323e-06    , -3.9906222272033745e-07   , 8.173794056542822e-08     , -1.3736547233133742e-08   , 1.9634774903755004e-09    , -2.4461685538185354e-10   , 2.7037107664760722e-11    , -2.68721986290428e-12     , 2.426996878374274e-13     , -2.0097479235731704e-14   , 1.5621588218728843e-15    , -1.1070357281766099e-16   , },
+    /* x = 12.0        */  {1.356894391464945e-06     , -9.046409242635729e-07    , 3.2186788466448587e-07    , -8.042046979221664e-08    , 1.570952093267323e-08     , -2.5382821016959733e-09   , 3.511160407215755e-10     , -4.255632357013028e-11    , 4.5955836678235545e-12    , -4.478016841306039e-13    , 3.976294126021509e-14     , -3.244706084211097e-15    , 2.489205700847289e-16     , -1.7444988988233058e-17   , },
+    /* x = 14.0        */  {3.7985399814948e-07       , -2.3037745481127646e-07   , 7.553373717558083e-08     , -1.7603608830972045e-08   , 3.24255417245698e-09      , -4.986868842320542e-10    , 6.618185333868477e-11     , -7.746538682214229e-12    , 8.122542288491979e-13     , -7.719268095544921e-14    , 6.709604902285821e-15     , -5.375533043251825e-16    , 4.0572531519760434e-17    , -2.804678366584104e-18    , },
+    /* x = 16.0        */  {1.1974646307723334e-07    , -6.569951239057593e-08    , 1.9680740926679693e-08    , -4.23487600705601e-09     , 7.277353233764171e-10     , -1.0543458636220458e-10   , 1.329709895927846e-11     , -1.4903820727701205e-12   , 1.5061938458447136e-13    , -1.3872243754462763e-14   , 1.1739385157342739e-15    , -9.19181300239026e-17     , 6.7984062756172514e-18    , -4.620297353520724e-19    , },
+    /* x = 18.0        */  {4.21539918477704e-08      , -2.092955391237106e-08    , 5.7094452068717174e-09    , -1.1273319433270336e-09   , 1.7927302090172748e-10    , -2.42469563829883e-11     , 2.8792621206443916e-12    , -3.062987372451616e-13    , 2.959275418992158e-14     , -2.6221868830571637e-15   , 2.146634551102959e-16     , -1.633548004455687e-17    , 1.1781864304903162e-18    , -7.84002442683544e-20     , },
+    /* x = 20.0        */  {1.6357965327966017e-08    , -7.3819782187753125e-09   , 1.8364676970415419e-09    , -3.3221927786158753e-10   , 4.868515440139875e-11     , -6.109072224059072e-12    , 6.779535472085573e-13     , -6.790281151094432e-14    , 6.221268107941379e-15     , -5.262920480312564e-16    , 4.138463356231265e-17     , -3.041331440287594e-18    , 2.1268174492811343e-19    , -1.3789425678827037e-20   , },
+    /* x = 22.0        */  {6.901655177289995e-09     , -2.8484528167868018e-09   , 6.490748951761484e-10     , -1.0780734196299225e-10   , 1.4554784871525096e-11    , -1.6900148189169495e-12   , 1.7447562704628714e-13    , -1.6354715324998015e-14   , 1.4112633579695635e-15    , -1.131620840112647e-16    , 8.486680232245578e-18     , -5.982391914419201e-19    , 4.030600135728914e-20     , -2.531984846346973e-21    , },
+    /* x = 24.0        */  {3.126770463816783e-09     , -1.1878950173730782e-09   , 2.4931907420969643e-10    , -3.818263156593694e-11    , 4.761255659193378e-12     , -5.119009538817716e-13    , 4.9097982624376696e-14    , -4.293567573749278e-15    , 3.4733055634895606e-16    , -2.6249167718465676e-17   , 1.8657597270274592e-18    , -1.2534303248917889e-19   , 8.084026664311848e-21     , -4.890904383045325e-22    , },
+    /* x = 26.0        */  {1.5052647877904046e-09    , -5.295953970222435e-10    , 1.0295947970972747e-10    , -1.4611902894539896e-11   , 1.689742210930419e-12     , -1.6868417034969905e-13   , 1.504993270968133e-14     , -1.2273477708466193e-15   , 9.289250446264296e-17     , -6.5938728215382994e-18   , 4.421840343373994e-19     , -2.816065264726058e-20    , 1.7285564497211004e-21    , -1.0013403332292452e-22   , },
+    /* x = 28.0        */  {7.634815723636553e-10     , -2.501016466955985e-10    , 4.52748294314037e-11      , -5.983872951953543e-12    , 6.446311610837664e-13     , -5.99808370427411e-14     , 4.992311932191999e-15     , -3.803162143255003e-16    , 2.693958466275407e-17     , -1.7942083082762773e-18   , 1.1324396718956436e-19    , -6.812623585576789e-21    , 3.962264340348603e-22     , -2.1868130957109638e-23   , },
+    /* x = 30.0        */  {4.0517823372156474e-10    , -1.241669679990104e-10    , 2.1027999219420433e-11    , -2.600143922909288e-12    , 2.620881476245848e-13     , -2.28224052271011e-14     , 1.7783948343629483e-15    , -1.2691803614308342e-16   , 8.430373593038627e-18     , -5.272567746054315e-19    , 3.131106943444573e-20     , -1.7766161563566217e-21   , 9.765163926709651e-23     , -5.116491452241958e-24    , },
+    /* x = 32.0        */  {2.2371772537717585e-10    , -6.440351701939691e-11    , 1.0245978776675682e-11    , -1.1901776889922633e-12   , 1.127032793325209e-13     , -9.220589156732972e-15    , 6.751471249140643e-16     , -4.528807402122599e-17    , 2.8287541051093042e-18    , -1.664829030691807e-19    , 9.313382803558463e-21     , -4.985393981637847e-22    , 2.5876987660391884e-23    , -1.2847679550245314e-24   , },
+    /* x = 34.0        */  {1.2791943862548886e-10    , -3.47209814767516e-11     , 5.208142717857911e-12     , -5.704141297852093e-13    , 5.092945771197051e-14     , -3.928768819723815e-15    , 2.712596226200323e-16     , -1.7159535899445108e-17   , 1.0109635931280867e-18    , -5.613982175014305e-20    , 2.964832467231435e-21     , -1.499416677910506e-22    , 7.355007519804979e-24     , -3.4593593768005137e-25   , },
+    /* x = 36.0        */  {7.545128124092967e-11     , -1.937262511144848e-11    , 2.748817851418526e-12     , -2.84787242871117e-13     , 2.4052928547405828e-14    , -1.7552040955228034e-15   , 1.1464010738887517e-16    , -6.860472614961787e-18    , 3.8239640881692797e-19    , -2.009272954829294e-20    , 1.0042979579413689e-21    , -4.8088701655372124e-23   , 2.2329973071094026e-24    , -9.958787325575669e-26    , },
+  },
+  /* n = 10 */
+  {
+    /* x = 0.0         */  {0.01917293609131464       , -0.017376108373082462     , 0.007942762852362489      , -0.002438225120561298     , 0.0005648547575069499     , -0.00010524779183984289   , 1.641829466563222e-05     , -2.20428992996694e-06     , 2.5988749570531597e-07    , -2.7324032925938468e-08   , 2.592535117741921e-09     , -2.242496612991146e-10    , 1.8140333818620818e-11    , -1.330581091569501e-12    , },
+    /* x = 2.0         */  {0.003179139007851695      , -0.0028291417995036034    , 0.0012735994183930843     , -0.0003859139597721641    , 8.840967441386753e-05     , -1.6313979197949187e-05   , 2.5233643938825776e-06    , -3.362456999352421e-07    , 3.9379480316642415e-08    , -4.115573662798394e-09    , 3.8839329325958194e-10    , -3.343191859324704e-11    , 2.6920948236330166e-12    , -1.9667133495622693e-13   , },
+    /* x = 4.0         */  {0.0005472174408373325     , -0.00047536192584985104   , 0.0002097688647730316     , -6.250827065945349e-05    , 1.4118303532655649e-05    , -2.573660216172925e-06    , 3.9389847063805283e-07    , -5.2005569644857486e-08   , 6.041265210821811e-09     , -6.268314291175449e-10    , 5.877481713304353e-11     , -5.029945128391511e-12    , 4.028563347107271e-13     , -2.9292266334120133e-14   , },
+    /* x = 6.0         */  {9.886833310936556e-05     , -8.316807355301142e-05    , 3.574941879159454e-05     , -1.042367826220678e-05    , 2.3117675980419358e-06    , -4.149454063387988e-07    , 6.267013319254542e-08     , -8.179710964759191e-09    , 9.407234996867363e-10     , -9.675096091506269e-11    , 9.001310725721238e-12     , -7.649873635325031e-13    , 6.087662634150404e-14     , -4.401781242221504e-15    , },
+    /* x = 8.0         */  {1.9013503455428333e-05    , -1.532632047096196e-05    , 6.363765742928508e-06     , -1.803504472775639e-06    , 3.906433345062053e-07     , -6.87397947800174e-08     , 1.0208505542207625e-08    , -1.3133188770342789e-09   , 1.4916742845370606e-10    , -1.5175505469484325e-11   , 1.3984518390542736e-12    , -1.1784965817423107e-13   , 9.306091345015018e-15     , -6.68416251458313e-16     , },
+    /* x = 10.0        */  {3.955389710850788e-06     , -3.01643105171004e-06     , 1.197186668160947e-06     , -3.2695176225609923e-07   , 6.868273616654124e-08     , -1.1780864992792456e-08   , 1.7123179834842878e-09    , -2.1629666873629144e-10   , 2.4184987742863004e-11    , -2.4273500208350472e-12   , 2.2106349357741156e-13    , -1.843765364200103e-14    , 1.4423386868680508e-15    , -1.0276630125696017e-16   , },
+    /* x = 12.0        */  {9.04640924263573e-07      , -6.437357693289992e-07    , 2.4126140937663977e-07    , -6.283808372981695e-08    , 1.2691410508614836e-08    , -2.1066962522157433e-09   , 2.9789426434297464e-10    , -3.676463929181923e-11    , 4.030216545759945e-12     , -3.976845173193913e-13    , 3.5690409081281785e-14    , -2.9389469843398093e-15   , 2.2727865443129224e-16    , -1.603567402617249e-17    , },
+    /* x = 14.0        */  {2.303774548112765e-07     , -1.51067474351166e-07     , 5.281082649291455e-08     , -1.2970216689688773e-08   , 2.4934344211814844e-09    , -3.970911212848258e-10    , 5.4225770673663747e-11    , -6.498029057329632e-12    , 6.947343468414922e-13     , -6.71048021858243e-14     , 5.912872936746228e-15     , -4.792299358832852e-16    , 3.653842822406821e-17     , -2.5471859974319073e-18   , },
+    /* x = 16.0        */  {6.569951239057595e-08     , -3.936148185336009e-08    , 1.2704628021167776e-08    , -2.910941293483084e-09    , 5.271729318144214e-10     , -7.978259395899498e-11    , 1.0432674493075985e-11    , -1.2049543019159968e-12   , 1.2485022875414328e-13    , -1.1740805837313626e-14   , 1.0110652404061838e-15    , -8.034080035362261e-17    , 6.0188201002080464e-18    , -4.134172169930333e-19    , },
+    /* x = 18.0        */  {2.092955391237106e-08     , -1.1418890413743552e-08   , 3.3819958299810587e-09    , -7.170920836031473e-10    , 1.212347819154987e-10     , -1.727557275774037e-11    , 2.1440911580412407e-12    , -2.3674190444455083e-13   , 2.359968767999277e-14     , -2.1468712346843577e-15   , 1.7968467494423085e-16    , -1.3931643192938133e-17   , 1.0212416940147594e-18    , -6.887417988357431e-20    , },
+    /* x = 20.0        */  {7.3819782187753125e-09    , -3.672935394083104e-09    , 9.966578335847555e-10     , -1.94740617604948e-10     , 3.0545361120389305e-11    , -4.067721289076079e-12    , 4.753196801256259e-13     , -4.97701226689379e-14     , 4.736629398769324e-15     , -4.1388703340149486e-16   , 3.345370075821886e-17     , -2.5166572837589526e-18   , 1.7960622363755406e-19    , -1.1842796517594107e-20   , },
+    /* x = 22.0        */  {2.8484528167868018e-09    , -1.2981497903523004e-09   , 3.2342202588897553e-10    , -5.821913948598482e-11    , 8.450074094601129e-12     , -1.046853763318129e-12    , 1.1448300719634938e-13    , -1.1290102899429829e-14   , 1.018458924624302e-15     , -8.487407156783839e-17    , 6.580466315417707e-18     , -4.773269924436113e-19    , 3.2975730581634235e-20    , -2.1152773796592873e-21   , },
+    /* x = 24.0        */  {1.1878950173730782e-09    , -4.986381484193936e-10    , 1.145478946978106e-10     , -1.904502263675192e-11    , 2.5595047694118316e-12    , -2.94587895940678e-13     , 3.00549730019719e-14      , -2.7786437099975134e-15   , 2.3624254005398023e-16    , -1.865895562519469e-17    , 1.3787434471616648e-18    , -9.58226775901694e-20     , 6.36905279559987e-21      , -3.9526179828205558e-22   , },
+    /* x = 26.0        */  {5.295953970222435e-10     , -2.0591895941945507e-10   , 4.383570868361965e-11     , -6.758968843717423e-12    , 8.434208517490609e-13     , -9.029959629637591e-14    , 8.591434393210755e-15     , -7.431398898137841e-16    , 5.934486121342825e-17     , -4.422107846410761e-18    , 3.097614884725664e-19     , -2.0509189013275514e-20   , 1.3038118770236767e-21    , -7.783825858012537e-23    , },
+    /* x = 28.0        */  {2.501016466955985e-10     , -9.054965886280742e-11    , 1.795161885586062e-11     , -2.578524644334177e-12    , 2.9990418521381906e-13    , -2.9953871601152884e-14   , 2.662213499733174e-15     , -2.1551664681692114e-16   , 1.6147875943137217e-17    , -1.1324955695756421e-18   , 7.493771668783557e-20     , -4.705927734895194e-21    , 2.8470127123733343e-22    , -1.626486264707946e-23    , },
+    /* x = 30.0        */  {1.241669679990104e-10     , -4.205599843884087e-11    , 7.800431768727862e-12     , -1.0483525904981411e-12   , 1.1411202613552972e-13    , -1.0670369007961334e-14   , 8.88426252885298e-16      , -6.744298194833277e-17    , 4.7453112206509516e-18    , -3.131231553358067e-19    , 1.9542534041304695e-20    , -1.1609433865620334e-21   , 6.660300364176204e-23     , -3.625777327022855e-24    , },
+    /* x = 32.0        */  {6.440351701939691e-11     , -2.0491957553351364e-11   , 3.5705330669767894e-12    , -4.508131173300363e-13    , 4.610294578367037e-14     , -4.05088274990996e-15     , 3.1701651812213486e-16    , -2.2630031219394817e-17   , 1.4983461842986915e-18    , -9.313680111837219e-20    , 5.48387796020303e-21      , -3.0792889225909833e-22   , 1.6722136906216295e-23    , -8.650624992308595e-25    , },
+    /* x = 34.0        */  {3.47209814767516e-11      , -1.0416285435715823e-11   , 1.7112423893556279e-12    , -2.0371783084786996e-13   , 1.9643844098620413e-14    , -1.6275577358289488e-15   , 1.2011675128968662e-16    , -8.087708330662457e-18    , 5.052584095288579e-19     , -2.9649084422241e-20      , 1.6493448736334941e-21    , -8.759697332903941e-23    , 4.5020663254462764e-24    , -2.210565786038834e-25    , },
+    /* x = 36.0        */  {1.937262511144848e-11     , -5.497635702837052e-12    , 8.543617286133509e-13     , -9.621171418962002e-14    , 8.776020477614365e-15     , -6.878406443629708e-16    , 4.802330830306224e-17     , -3.0591711573030166e-18   , 1.8083456951396632e-19    , -1.004318719339885e-20    , 5.289722182626375e-22     , -2.6614761850569994e-23   , 1.2959151077874672e-24    , -6.040630227226279e-26    , },
+  },
+  /* n = 11 */
+  {
+    /* x = 0.0         */  {0.017376108373082472      , -0.01588552570472715      , 0.00731467536168306       , -0.002259419029958199     , 0.000526238959210341      , -9.85097686204157e-05     , 1.5430029456353426e-05    , -2.0790975778484192e-06   , 2.4591641080744254e-07    , -2.5929729792046712e-08   , 2.4666343337977626e-09    , -2.1386194777447072e-10   , 1.7338262964694837e-11    , -1.2742229195011408e-12   , },
+    /* x = 2.0         */  {0.0028291417995036047     , -0.0025471988367864887    , 0.0011577418793163698     , -0.00035363869764522043   , 8.156989599137891e-05     , -1.5140186455574083e-05   , 2.3537198917073037e-06    , -3.150354908988048e-07    , 3.7040179765770036e-08    , -3.884577740689623e-09    , 3.677346757758461e-10     , -3.1742290694913866e-11   , 2.562701903449472e-12     , -1.8764551254415344e-13   , },
+    /* x = 4.0         */  {0.00047536192584985126    , -0.0004195377295461107    , 0.00018752481197834237    , -5.647321412910257e-05    , 1.286830108110584e-05     , -2.363390837513209e-06    , 3.640389863560017e-07     , -4.83300695394136e-08     , 5.641485343765078e-09     , -5.878437958217499e-10    , 5.5326969632426003e-11    , -4.750806375645819e-12    , 3.816819949622172e-13     , -2.7827597132443233e-14   , },
+    /* x = 6.0         */  {8.316807355301146e-05     , -7.149883758319619e-05    , 3.127103478661765e-05     , -9.247070391940482e-06    , 2.0747270317298927e-06    , -3.760208012013158e-07    , 5.725797658097763e-08     , -7.525780200933293e-09    , 8.707590175694135e-10     , -9.002740411758322e-11    , 8.414499839690403e-12     , -7.18039953248987e-13     , 5.735449667667762e-14     , -4.160503904836356e-15    , },
+    /* x = 8.0         */  {1.5326320470961968e-05    , -1.2727531485858088e-05   , 5.410513418326513e-06     , -1.5625733379905182e-06   , 3.4369897390547607e-07    , -6.12510335620756e-08     , 9.193232113368681e-09     , -1.1933382508197209e-09   , 1.3657960466988106e-10    , -1.3986676348341597e-11   , 1.2962920226266192e-12    , -1.0978944350834932e-13   , 8.709128122544087e-15     , -6.27981251511543e-16     , },
+    /* x = 10.0        */  {3.0164310517100407e-06    , -2.3943733363220573e-06   , 9.808552867682364e-07     , -2.7473094466092886e-07   , 5.8904324964779566e-08    , -1.027390794804596e-08    , 1.514076677230513e-09     , -1.934797223135348e-10    , 2.184615859598572e-11     , -2.2109643275895977e-12   , 2.0280596771648495e-13    , -1.7020543154785844e-14   , 1.3389520814483273e-15    , -9.585499362155825e-17    , },
+    /* x = 12.0        */  {6.437357693289993e-07     , -4.825228187533048e-07    , 1.8851425118944146e-07    , -5.076564203364939e-08    , 1.0533481261204161e-08    , -1.7873655933498112e-09   , 2.573524744405183e-10     , -3.2241704579927537e-11   , 3.579161946476373e-12     , -3.5695504296010663e-13   , 3.232715479533535e-14     , -2.682868618925666e-15    , 2.0892271673115087e-16    , -1.4827308194361393e-17   , },
+    /* x = 14.0        */  {1.5106747435116603e-07    , -1.0562165298583307e-07   , 3.8910650069064854e-08    , -9.973737684598638e-09    , 1.98545560644366e-09      , -3.2535462518804787e-10   , 4.548620330754435e-11     , -5.55787040765007e-12     , 6.03943420614468e-13      , -5.91367373623152e-14     , 5.271332801097862e-15     , -4.314711225524115e-16    , 3.3184875327808506e-17    , -2.3303497037136632e-18   , },
+    /* x = 16.0        */  {3.9361481853360093e-08    , -2.5409256042336187e-08   , 8.73282388044902e-09      , -2.1086917272372913e-09   , 3.9891296979806827e-10    , -6.259604714206266e-11    , 8.43468009856173e-12      , -9.988011304035008e-13    , 1.0566728436107007e-13    , -1.0111935321509134e-14   , 8.837176832368755e-16     , -7.110601278401405e-17    , 5.3857412200526784e-18    , -3.7333012360637407e-19   , },
+    /* x = 18.0        */  {1.1418890413743552e-08    , -6.763991659962222e-09    , 2.151276250809404e-09     , -4.84939127658651e-10     , 8.637786378920195e-11     , -1.2864546978350279e-11   , 1.6571933287110394e-12    , -1.887973867344744e-13    , 1.9321846257286005e-14    , -1.7970570848125653e-15   , 1.532430439157609e-16     , -1.2071304354732354e-17   , 8.97193994197504e-19      , -6.120727822099052e-20    , },
+    /* x = 20.0        */  {3.672935394083104e-09     , -1.993315667169529e-09    , 5.842218528148378e-10     , -1.2218144448099347e-10   , 2.0338606445463272e-11    , -2.851918085829013e-12    , 3.483908582846992e-13     , -3.789301585126886e-14    , 3.724984153267404e-15     , -3.3457246906420155e-16   , 2.768239634826411e-17     , -2.1243214926533386e-18   , 1.5425956524647916e-19    , -1.0319137522108695e-20   , },
+    /* x = 22.0        */  {1.2981497903523006e-09    , -6.468440517779542e-10    , 1.7465741845795341e-10    , -3.380029637830621e-11    , 5.234268816604794e-12     , -6.868980440630419e-13    , 7.903072022807978e-14     , -8.147668025006459e-15    , 7.6386678968655185e-16    , -6.58108462816444e-17     , 5.250454564845955e-18     , -3.90311746851782e-19     , 2.755037366031427e-20     , -1.7992425763899965e-21   , },
+    /* x = 24.0        */  {4.986381484193936e-10     , -2.2909578939562178e-10   , 5.713506791025557e-11     , -1.0238019077629484e-11   , 1.4729394797058936e-12    , -1.8032983817245198e-13   , 1.945050595796401e-14     , -1.8899397084114276e-15   , 1.67930626383202e-16      , -1.3788556707928373e-17   , 1.0540242675331068e-18    , -7.544908264701026e-20    , 5.1475624762196026e-21    , -3.265577742295859e-22    , },
+    /* x = 26.0        */  {2.0591895941945507e-10    , -8.76714173672394e-11     , 2.0276906531152234e-11    , -3.373683406992849e-12    , 4.5149798148234156e-13    , -5.154860638982358e-14    , 5.201979226478571e-15     , -4.747587732682161e-16    , 3.979897537078878e-17     , -3.0978283923388977e-18   , 2.2559643134952614e-19    , -1.5459382619474668e-20   , 1.0135875690222429e-21    , -6.212729896983276e-23    , },
+    /* x = 28.0        */  {9.054965886280742e-11     , -3.590323771172126e-11    , 7.735573933002524e-12     , -1.1996167408545947e-12   , 1.4976935800585393e-13    , -1.597328100453563e-14    , 1.5086165272886619e-15    , -1.291829841631593e-16    , 1.0192461047226193e-17    , -7.494200404724898e-19    , 5.1764304446094745e-20    , -3.3789934215048224e-21   , 2.1177073723709404e-22    , -1.2475320567822678e-23   , },
+    /* x = 30.0        */  {4.205599843884087e-11     , -1.560086353745573e-11    , 3.145057771494422e-12     , -4.564481045419736e-13    , 5.335184503982501e-14     , -5.33055751862033e-15     , 4.721008735503195e-16     , -3.7962484779404484e-17   , 2.8181085866290832e-18    , -1.9543448237621006e-19   , 1.27701928251579e-20      , -7.912566400254738e-22    , 4.7202173098243837e-23    , -2.6600728945687643e-24   , },
+    /* x = 32.0        */  {2.0491957553351364e-11    , -7.14106613395358e-12     , 1.3524393519901086e-12    , -1.8441178313464842e-13   , 2.0254413749553787e-14    , -1.9020991090304068e-15   , 1.584102185166191e-16     , -1.1986768340500362e-17   , 8.38231251092423e-19      , -5.484085867532438e-20    , 3.3871776971834677e-21    , -1.9885097780894728e-22   , 1.1260401431281497e-23    , -6.04945080874986e-25     , },
+    /* x = 34.0        */  {1.0416285435715823e-11    , -3.4224847787112558e-12   , 6.111534925436098e-13     , -7.857537639447361e-14    , 8.13778867914567e-15      , -7.207005078104626e-16    , 5.661395831019829e-17     , -4.0420670005978566e-18   , 2.668417693127455e-19     , -1.6493954124842688e-20   , 9.635574049426135e-22     , -5.358368496472662e-23    , 2.8771180985541223e-24    , -1.4704956261783007e-25   , },
+    /* x = 36.0        */  {5.497635702837052e-12     , -1.7087234572267018e-12   , 2.8863514256886004e-13    , -3.510408191045537e-14    , 3.4392032218150827e-15    , -2.881398498371675e-16    , 2.1414198100022736e-17    , -1.4466764845058596e-18   , 9.038868709439533e-20     , -5.289853474543012e-21    , 2.9276007874641215e-22    , -1.5436388720535518e-23   , 7.861189122092556e-25     , -3.820049638985358e-26    , },
+  },
+  /* n = 12 */
+  {
+    /* x = 0.0         */  {0.01588552570472716       , -0.014629350723368205     , 0.006778257089873794      , -0.0021049558367745923    , 0.0004925488431127705     , -9.258017733927548e-05    , 1.4553682993610198e-05    , -1.9673289957091407e-06   , 2.3336767813105047e-07    , -2.4670544001837926e-08   , 2.352373857404822e-09     , -2.0439242714724078e-10   , 1.6604016658301303e-11    , -1.2224387258909667e-12   , },
+    /* x = 2.0         */  {0.00254719883678649       , -0.002315483758633046     , 0.001060916092935544      , -0.000326279583955716     , 7.570093227943469e-05     , -1.4122319438471171e-05   , 2.205248428782083e-06     , -2.963211019291357e-07    , 3.496121575991679e-08     , -3.6779632582543813e-09   , 3.491494601188778e-10     , -3.021428473006296e-11    , 2.445114839863083e-12     , -1.7940795042115115e-13   , },
+    /* x = 4.0         */  {0.00041953772954611085    , -0.00037504962395672995   , 0.00016941964238729044    , -5.1473204322975795e-05   , 1.1816954187796276e-05    , -2.1842339311685347e-06   , 3.383104856706321e-07     , -4.513183308879024e-08    , 5.2905965310822285e-09    , -5.533607625283608e-10    , 5.22565538706181e-11      , -4.5006931176474485e-12   , 3.6260110402381693e-13    , -2.6501133047730327e-14   , },
+    /* x = 6.0         */  {7.149883758319621e-05     , -6.254206957324202e-05    , 2.774121117581889e-05     , -8.29890812670414e-06     , 1.8801040060406982e-06    , -3.435478614253943e-07    , 5.268046124273717e-08     , -6.966064749864852e-09    , 8.102469880884926e-10     , -8.415855101231577e-11    , 7.898096224910366e-12     , -6.764240290335629e-13    , 5.421138235540411e-14     , -3.943929267839041e-15    , },
+    /* x = 8.0         */  {1.2727531485858091e-05    , -1.0821026836654035e-05   , 4.687720013971172e-06     , -1.3747958955895637e-06   , 3.062551678154748e-07     , -5.515939297137402e-08    , 8.353367731270235e-09     , -1.0926357278717673e-09   , 1.2588013957188441e-10    , -1.2964954734824519e-11   , 1.2076326024151615e-12    , -1.0273364009780854e-13   , 8.18240355501858e-15      , -5.920578275720932e-16    , },
+    /* x = 10.0        */  {2.394373336322058e-06     , -1.961710573536626e-06    , 8.24192833982729e-07      , -2.3561729985421365e-07   , 5.136953974099825e-08     , -9.084460107539275e-09    , 1.3543580525056962e-09    , -1.747691005089687e-10    , 1.9898686854271118e-11    , -2.0283682191166678e-12   , 1.8721824373509508e-13    , -1.579810306911644e-14    , 1.248926387402919e-15     , -8.978777265832459e-17    , },
+    /* x = 12.0        */  {4.82522818753305e-07      , -3.770285023789064e-07    , 1.5229692610093938e-07    , -4.213392504406384e-08    , 8.936827966866184e-09     , -1.5441148534205455e-09   , 2.256919314972012e-10     , -2.8633269746215815e-11   , 3.2125965916815094e-12    , -3.233189050672416e-13    , 2.951037644225183e-14     , -2.4657353442328696e-15   , 1.9318353476613885e-16    , -1.378117627092546e-17    , },
+    /* x = 14.0        */  {1.0562165298583309e-07    , -7.782130013813337e-08    , 2.992121305379456e-08     , -7.941822425657433e-09    , 1.6267731259583236e-09    , -2.7291722090048406e-10   , 3.8905092766734404e-11    , -4.831543343997051e-12    , 5.322308223151027e-13     , -5.272070125672214e-14    , 4.746000412510332e-15     , -3.9178253548512536e-16   , 3.0360709336457646e-17    , -2.1456432122684128e-18   , },
+    /* x = 16.0        */  {2.540925604233619e-08     , -1.746564776089862e-08    , 6.326075181711661e-09     , -1.5956518791737097e-09   , 3.129802357131486e-10     , -5.060808075849523e-11    , 6.9916078992133875e-12    , -8.453376380607919e-13    , 9.100744706331506e-14     , -8.838344592556602e-15    , 7.821376166663102e-16     , -6.360958200357634e-17    , 4.8636646950662815e-18    , -3.398206599628479e-19    , },
+    /* x = 18.0        */  {6.7639916599622225e-09    , -4.302552501618902e-09    , 1.4548173829759192e-09    , -3.455114551538067e-10    , 6.432273489220414e-11     , -9.943159999284831e-12    , 1.3215817049678645e-12    , -1.545746671047637e-13    , 1.617351842119679e-14     , -1.532619225605698e-15    , 1.3277979314501024e-16    , -1.0601540974880826e-17   , 7.973510078945798e-19     , -5.493684792946086e-20    , },
+    /* x = 20.0        */  {1.993315667169529e-09     , -1.168443705629691e-09    , 3.6654433344297486e-10    , -8.135442578135575e-11    , 1.4259590429218971e-11    , -2.0903451541857046e-12   , 2.652511106040929e-13     , -2.979985616484685e-14    , 3.0111529819162527e-15    , -2.7685524869141445e-16   , 2.3366792916364335e-17    , -1.8238068380887963e-18   , 1.3441917087466649e-19    , -9.103914841046753e-21    , },
+    /* x = 22.0        */  {6.468440517779542e-10     , -3.4931483691590947e-10   , 1.0140088913491772e-10    , -2.0937075266334265e-11   , 3.434490220327597e-12     , -4.741843221329302e-13    , 5.703367611557787e-14     , -6.1109314046177265e-15   , 5.922977439771819e-16     , -5.2509886936741694e-17   , 4.293304595156229e-18     , -3.2594225547994936e-19   , 2.3435472929835726e-20    , -1.5542850290675572e-21   , },
+    /* x = 24.0        */  {2.2909578939562178e-10    , -1.142701358205116e-10    , 3.0714057232888293e-11    , -5.89175791880855e-12     , 9.016491908644031e-13     , -1.1670303588303554e-13   , 1.3229577948591695e-14    , -1.3434444957068361e-15   , 1.2409703241976646e-16    , -1.0541187672456235e-17   , 8.299183490227911e-19     , -6.09458993363512e-20     , 4.253091598709656e-21     , -2.749855599963342e-22    , },
+    /* x = 26.0        */  {8.76714173672394e-11      , -4.055381306230455e-11    , 1.0121050220978519e-11    , -1.805991925926594e-12    , 2.577430319495029e-13     , -3.121187538383044e-14    , 3.3233114110293504e-15    , -3.1839170786416173e-16   , 2.788045949175161e-17     , -2.2561386977295335e-18   , 1.7004933584517685e-19    , -1.2010838915038244e-20   , 8.090633247853396e-22     , -5.074352040779043e-23    , },
+    /* x = 28.0        */  {3.590323771172126e-11     , -1.5471147866005064e-11   , 3.5988502225637785e-12    , -5.990774320228784e-13    , 7.986640502275042e-14     , -9.051699168568423e-15    , 9.04280888795186e-16      , -8.153966994954497e-17    , 6.744781107735211e-18     , -5.176768351414005e-19    , 3.716820062520249e-20     , -2.5117547770225347e-21   , 1.624435504160686e-22     , -9.83249097867099e-24     , },
+    /* x = 30.0        */  {1.560086353745573e-11     , -6.2901155429888475e-12   , 1.3693443136259196e-12    , -2.1340738015919002e-13   , 2.6652787593115916e-14    , -2.832605242292287e-15    , 2.6573739338734347e-16    , -2.2544864919490983e-17   , 1.7589104881574404e-18    , -1.2770884746746175e-19   , 8.703679520974096e-21     , -5.603867205805639e-22    , 3.463313930041248e-23     , -2.0133355576645532e-24   , },
+    /* x = 32.0        */  {7.14106613395358e-12      , -2.704878703980218e-12    , 5.53235349403945e-13      , -8.101765499819122e-14    , 9.510495545155011e-15     , -9.504613113151438e-16    , 8.390737836920237e-17     , -6.705849187915267e-18    , 4.935677587234066e-19     , -3.387328202848518e-20    , 2.187330789604752e-21     , -1.3381115867269412e-22   , 7.875183436191227e-24     , -4.379297533915935e-25    , },
+    /* x = 34.0        */  {3.4224847787112558e-12    , -1.2223069850872197e-12   , 2.357261291834208e-13     , -3.2551154716577124e-14   , 3.603502539052974e-15     , -3.396837499111386e-16    , 2.8294469001013145e-17    , -2.134733964190268e-18    , 1.4844559392087833e-19    , -9.635922999422493e-21    , 5.8941388799637675e-22    , -3.422084611310392e-23    , 1.9140613780395158e-24    , -1.0153296759639191e-25   , },
+    /* x = 36.0        */  {1.7087234572267018e-12    , -5.772702851377201e-13    , 1.053122457313661e-13     , -1.3756812887258957e-14   , 1.4406992491859934e-15    , -1.284851886124957e-16    , 1.0126735390791815e-17    , -7.231094496654484e-19    , 4.760868287641914e-20     , -2.927687128828972e-21    , 1.6979870599154764e-22    , -9.358067047570898e-24    , 4.971773627702971e-25     , -2.512206355703191e-26    , },
+  },
+  /* n = 13 */
+  {
+    /* x = 0.0         */  {0.014629350723368214      , -0.013556514179749594     , 0.006314867510323005      , -0.0019701953723869183    , 0.00046290088670666743    , -8.732209853933541e-05    , 1.3771302920564989e-05    , -1.8669392237713696e-06   , 2.2203500188358043e-07    , -2.3527775168804735e-08   , 2.2482131745435326e-09    , -1.9572468422004756e-10   , 1.5929351476144768e-11    , -1.174694043108396e-12    , },
+    /* x = 2.0         */  {0.002315483758633047      , -0.0021218321858713814    , 0.0009788387518670355     , -0.0003028037291083514    , 7.061159719385694e-05     , -1.3231490657207815e-05   , 2.0742477062977156e-06    , -2.7968940402699366e-07   , 3.3101684767968886e-08    , -3.4920851643547813e-09   , 3.3234203014546075e-10    , -2.8825880117016442e-11   , 2.3377953739980793e-12    , -1.7186012380169152e-13   , },
+    /* x = 4.0         */  {0.0003750496239567301     , -0.0003388392847746241    , 0.00015441961296891089    , -4.7267816749803464e-05   , 1.0921169656062869e-05    , -2.0298629264628097e-06   , 3.159228305644482e-07     , -4.232472484887778e-08    , 4.9802491281890635e-09    , -5.226524578806048e-10    , 4.950540899932622e-11     , -4.275342273522313e-12    , 3.4532035317696797e-13    , -2.5294342093066916e-14   , },
+    /* x = 6.0         */  {6.254206957324205e-05     , -5.548242235164417e-05    , 2.4896724380109983e-05    , -7.520416023958039e-06    , 1.7177393071594777e-06    , -3.1608276929983383e-07   , 4.87624530930025e-08      , -6.48196888027101e-09     , 7.574272935442053e-10     , -7.899384326338048e-11    , 7.440337287954704e-12     , -6.39292880976495e-13     , 5.139001005923115e-14     , -3.748493360152893e-15    , },
+    /* x = 8.0         */  {1.0821026836654039e-05    , -9.3754400279433e-06      , 4.124387686768329e-06     , -1.225020671231313e-06    , 2.7579696486170405e-07    , -5.0120206662989014e-08   , 7.64845007189626e-09      , -1.007040067271359e-09    , 1.1668464234631445e-10    , -1.2078250174136537e-11   , 1.130021408945597e-12     , -9.650927425414467e-14    , 7.714437506582994e-15     , -5.599436502201859e-16    , },
+    /* x = 10.0        */  {1.9617105735366266e-06    , -1.648385667965602e-06    , 7.068518995625866e-07     , -2.054781589593815e-07    , 4.542230053842134e-08     , -8.12614835655159e-09     , 1.2233837000824526e-09    , -1.591893366301701e-10    , 1.82553214307159e-11      , -1.8724725416732823e-12   , 1.7377184018691386e-13    , -1.473388839054708e-14    , 1.169893451751506e-15     , -8.442248137920865e-17    , },
+    /* x = 12.0        */  {3.7702850237890653e-07    , -3.0459385220190073e-07   , 1.264017751321833e-07     , -3.5747311866761846e-08   , 7.720574267212538e-09     , -1.3541515953113414e-09   , 2.004328876963533e-10     , -2.5700748619883746e-11   , 2.909871275350974e-12     , -2.951479822186845e-13    , 2.712198404798978e-14     , -2.2796053666177664e-15   , 1.7955704441099754e-16    , -1.286765079371553e-17    , },
+    /* x = 14.0        */  {7.782130013813339e-08     , -5.98424261075925e-08     , 2.382546727697104e-08     , -6.50709250372477e-09     , 1.3645861045192479e-09    , -2.334305575774457e-10    , 3.382080332719619e-11     , -4.257842855493659e-12    , 4.744864844358617e-13     , -4.746683113426622e-14    , 4.309438597342297e-15     , -3.583693334213454e-16    , 2.79549273524595e-17      , -1.9866923173784048e-18   , },
+    /* x = 16.0        */  {1.7465647760898622e-08    , -1.2652150363423853e-08   , 4.7869556375209325e-09    , -1.2519209428355797e-09   , 2.530404037950907e-10     , -4.194964754846063e-11    , 5.9173634538741114e-12    , -7.280589928125779e-13    , 7.954512823177736e-14     , -7.822446497148648e-15    , 6.996790987477218e-16     , -5.74297061276913e-17     , 4.427234102034612e-18     , -3.1146955614112014e-19   , },
+    /* x = 18.0        */  {4.302552501618903e-09     , -2.9096347659519236e-09   , 1.0365343654613892e-09    , -2.572909395660996e-10    , 4.9715799996837116e-11    , -7.929490254267208e-12    , 1.0820226677509e-12       , -1.2938805416508612e-13   , 1.379357727899031e-14     , -1.3279688415278163e-15   , 1.1661279624400005e-16    , -9.419028617279673e-18    , 7.15689849843965e-19      , -4.973504485189534e-20    , },
+    /* x = 20.0        */  {1.1684437056296913e-09    , -7.330886668859636e-10    , 2.4406327734406224e-10    , -5.703836171643238e-11    , 1.0451725770995042e-11    , -1.5915066676173105e-12   , 2.0859899283459491e-13    , -2.4089208641108547e-14   , 2.4916979225772143e-15    , -2.336958275040489e-16    , 2.0061206016813402e-17    , -1.588678333852874e-18    , 1.1859425601215628e-19    , -8.118388133728858e-21    , },
+    /* x = 22.0        */  {3.4931483691590947e-10    , -2.0280177826983776e-10   , 6.281122579900197e-11     , -1.373796088123605e-11    , 2.370921610675621e-12     , -3.4220205736269845e-13   , 4.277651977966002e-14     , -4.738379401758138e-15    , 4.72589095293386e-16      , -4.293772197094015e-17    , 3.5852544467098616e-18    , -2.7714412314331916e-19   , 2.02458402880739e-20      , -1.3607041852891954e-21   , },
+    /* x = 24.0        */  {1.142701358205116e-10     , -6.142811446577699e-11    , 1.767527375642551e-11     , -3.6065967634447515e-12   , 5.835151794170386e-13     , -7.93774678073308e-14     , 9.404111461014236e-15     , -9.92775818187899e-16     , 9.487070819739763e-17     , -8.299992454142547e-18    , 6.703861713948514e-19     , -5.033098388178449e-20    , 3.5816204710452365e-21    , -2.35402918742315e-22     , },
+    /* x = 26.0        */  {4.055381306230455e-11     , -2.0242100441957108e-11   , 5.417975777779757e-12     , -1.0309721277957013e-12   , 1.5605937691947866e-13    , -1.9939868486974332e-14   , 2.22874195348198e-15      , -2.23043596685279e-16     , 2.0305251638057327e-17    , -1.7006386738787023e-18   , 1.321159439600742e-19     , -9.581920190183306e-21    , 6.608600602737854e-22     , -4.228525383122559e-23    , },
+    /* x = 28.0        */  {1.5471147866005064e-11    , -7.19770044512757e-12     , 1.797232296068631e-12     , -3.19465620090568e-13     , 4.525849584290169e-14     , -5.425685336675209e-15    , 5.707776893608279e-16     , -5.395823398604918e-17    , 4.659092129155493e-18     , -3.7170928325361267e-19   , 2.762870324098794e-20     , -1.9255138453419032e-21   , 1.2804032530081807e-22    , -7.937205654125336e-24    , },
+    /* x = 30.0        */  {6.2901155429888475e-12    , -2.7386886272518416e-12   , 6.402221404775692e-13     , -1.0661115037237805e-13   , 1.4163026211472817e-14    , -1.5944243610947614e-15   , 1.5781405438180795e-16    , -1.4071280968682926e-17   , 1.149379744278851e-18     , -8.704217979450261e-20    , 6.164139448516773e-21     , -4.1089777137110515e-22   , 2.6214992919769265e-23    , -1.5668100674265825e-24   , },
+    /* x = 32.0        */  {2.704878703980218e-12     , -1.1064706988078906e-12   , 2.4305296499457347e-13    , -3.8041982180602173e-14   , 4.752306556578008e-15     , -5.034442703761322e-16    , 4.6940944304418964e-17    , -3.948541456654759e-18    , 3.048595618037028e-19     , -2.1874432139701258e-20   , 1.4718997198727396e-21    , -9.352092136583868e-23    , 5.701460156907014e-24     , -3.2712763848396817e-25   , },
+    /* x = 34.0        */  {1.2223069850872197e-12    , -4.714522583668417e-13    , 9.765346414973134e-14     , -1.441401015620793e-14    , 1.6984187495561805e-15    , -1.6976681404177064e-16   , 1.4943137746993038e-17    , -1.1875646153754935e-18   , 8.672331200696142e-20     , -5.89438823208459e-21     , 3.764244061764916e-22     , -2.275109518451985e-23    , 1.3217108730544861e-24    , -7.255415673538685e-26    , },
+    /* x = 36.0        */  {5.772702851377201e-13     , -2.1062449146273225e-13   , 4.1270438661776865e-14    , -5.762796996743037e-15    , 6.424259430625886e-16     , -6.076041235318124e-17    , 5.061766147129457e-18     , -3.808694308908096e-19    , 2.6349185292426453e-20    , -1.6980459550215347e-21   , 1.0293762967404292e-22    , -5.914723574353952e-24    , 3.269896988582691e-25     , -1.71364533426415e-26     , },
+  },
+  /* n = 14 */
+  {
+    /* x = 0.0         */  {0.013556514179749603      , -0.01262973502064794      , 0.005910586117160011      , -0.0018516035467649183    , 0.0004366104927065942     , -8.262781807934669e-05    , 1.306857451879064e-05     , -1.776277896546251e-06    , 2.1175007855005112e-07    , -2.248601659116529e-08    , 2.152871753651165e-09     , -1.8776116095781205e-10   , 1.530730638970697e-11     , -1.1305344649968628e-12   , },
+    /* x = 2.0         */  {0.0021218321858713827     , -0.001957677503734352     , 0.0009084111873249461     , -0.0002824463887664196    , 6.615745328748186e-05     , -1.2445486318888075e-05   , 1.957825821262577e-06     , -2.6481316909868665e-07   , 3.1428781323117886e-08    , -3.3239870129410423e-09   , 3.170701658791009e-10     , -2.7558866179541495e-11   , 2.2394603482410465e-12    , -1.64919212235496e-13     , },
+    /* x = 4.0         */  {0.00033883928477462425    , -0.000308839225937863     , 0.00014180345024939457    , -4.3684678622930064e-05   , 1.014931463252504e-05     , -1.8955369952834926e-06   , 2.962730729292451e-07     , -3.984194769183156e-08    , 4.703874291669078e-09     , -4.951372205333388e-10    , 4.702664230778214e-11     , -4.071280279605118e-12    , 3.2959839789464315e-13    , -2.419184206855681e-14    , },
+    /* x = 6.0         */  {5.54824223516442e-05      , -4.979344876022606e-05    , 2.256124807187179e-05     , -6.870957228442838e-06    , 1.5804138465302062e-06    , -2.9257472031427045e-07   , 4.537378201289892e-08     , -6.05941165602021e-09     , 7.10944908687999e-10      , -7.441564491273517e-11    , 7.031909440451132e-12     , -6.059679785135768e-13    , 4.8843967928644845e-14    , -3.57127941493714e-15     , },
+    /* x = 8.0         */  {9.375440027943305e-06     , -8.248775373537564e-06    , 3.675062013693595e-06     , -1.1031878594178072e-06   , 2.506010333195415e-07     , -4.5890700692546116e-08   , 7.049280448833475e-09     , -9.334761435717447e-10    , 1.0870429885686318e-10    , -1.1302039027034923e-11   , 1.0615557738280492e-12    , -9.098028159756672e-14    , 7.296084354552885e-15     , -5.310729036969898e-16    , },
+    /* x = 10.0        */  {1.6483856679656027e-06    , -1.4137037991253092e-06   , 6.164344768780931e-07     , -1.8168920214933477e-07   , 4.063074178344398e-08     , -7.340302239663242e-09    , 1.11432535311776e-09      , -1.4604242219203327e-10   , 1.6852259933190714e-11    , -1.7379920940465343e-12   , 1.620658703885363e-13     , -1.3799818855097311e-14   , 1.100002231484406e-15     , -7.964658320858676e-17    , },
+    /* x = 12.0        */  {3.0459385220190084e-07    , -2.528035502643872e-07    , 1.0724193560027779e-07    , -3.088229706819118e-08    , 6.770757976660031e-09     , -1.202597332110863e-09    , 1.7990523984316327e-10    , -2.3278947595848583e-11   , 2.6563329029907845e-12    , -2.712612956226485e-13    , 2.5074619539886567e-14    , -2.1184989157197482e-15   , 1.6765748592826848e-16    , -1.2063729551089557e-17   , },
+    /* x = 14.0        */  {5.984242610759252e-08     , -4.765093455394523e-08    , 1.952127751117313e-08     , -5.458344417976008e-09    , 1.1671527879029558e-09    , -2.0292482087232397e-10   , 2.9804899912954564e-11    , -3.795888411157634e-12    , 4.272016420138447e-13     , -4.310073861303623e-14    , 3.941904443868732e-15     , -3.2991401036471405e-16   , 2.5884540282017768e-17    , -1.8486535880991766e-18   , },
+    /* x = 16.0        */  {1.2652150363423856e-08    , -9.573911275042356e-09    , 3.7557628285065575e-09    , -1.0121616151646728e-09   , 2.0974823774472708e-10    , -3.550418086449972e-11    , 5.096412938051593e-12     , -6.363604876000713e-13    , 7.040204341225254e-14     , -6.99777799626773e-15     , 6.317023815384744e-16     , -5.226526733180193e-17    , 4.057972462243134e-18     , -2.8722362193982864e-19   , },
+    /* x = 18.0        */  {2.9096347659519236e-09    , -2.0730687309228557e-09   , 7.718728186982705e-10     , -1.988631999848703e-10    , 3.964745127171519e-11     , -6.4921360288158936e-12   , 9.057163773354516e-13     , -1.1034853321791076e-13   , 1.1951723474483705e-14    , -1.1662838539513788e-15   , 1.0360550041235801e-16    , -8.452203791786159e-18    , 6.479427287194214e-19     , -4.5364801970726016e-20   , },
+    /* x = 20.0        */  {7.330886668859636e-10     , -4.88126554688137e-10     , 1.711150851492926e-10     , -4.180690308358099e-11    , 7.957533338146912e-12     , -1.2515939606013228e-12   , 1.686244601979991e-13     , -1.9933569686717306e-14   , 2.1032630685161136e-15    , -2.0063717077075742e-16   , 1.747485444116768e-17     , -1.4012126412461178e-18   , 1.0575987257244741e-19    , -7.307193888612015e-21    , },
+    /* x = 22.0        */  {2.0280177826983776e-10    , -1.2562245159800599e-10   , 4.121388264370742e-11     , -9.483686442636653e-12    , 1.7110102868233054e-12    , -2.566591192706326e-13    , 3.3168655765197844e-14    , -3.78071050399949e-15     , 3.864395986967051e-16     , -3.585668559275494e-17    , 3.04848663173912e-18      , -2.3933541244613225e-19   , 1.7725056080304314e-20    , -1.205058943127895e-21    , },
+    /* x = 24.0        */  {6.142811446577699e-11     , -3.535054751285137e-11    , 1.0819790290334131e-11    , -2.3340607176569867e-12   , 3.9688733903829e-13       , -5.642466886662172e-14    , 6.949430719461367e-15     , -7.589652824938317e-16    , 7.469994891876601e-17     , -6.7045641720061395e-18   , 5.5362436393582235e-19    , -4.2366293211411353e-20   , 3.0662233468013203e-21    , -2.0441182989524135e-22   , },
+    /* x = 26.0        */  {2.0242100441957108e-11    , -1.0835951555559575e-11   , 3.0929163833870823e-12    , -6.242375076759555e-13    , 9.969934243515271e-14     , -1.3372451738527928e-14   , 1.56130517544776e-15      , -1.62441945904354e-16     , 1.530575095630865e-17     , -1.3212826625451702e-18   , 1.0539829472708368e-19    , -7.82276414931316e-21     , 5.507364985603923e-22     , -3.585685975384678e-23    , },
+    /* x = 28.0        */  {7.19770044512757e-12      , -3.5944645921372733e-12   , 9.583968602717003e-13     , -1.8103398337124926e-13   , 2.7128426683426067e-14    , -3.4246661393832926e-15   , 3.7770763766222156e-16    , -3.7272724770316265e-17   , 3.3453840638776143e-18    , -2.7630951840459153e-19   , 2.1180149101906943e-20    , -1.5168568819023517e-21   , 1.033666654519094e-22     , -6.5431532144148524e-24   , },
+    /* x = 30.0        */  {2.7386886272518416e-12    , -1.2804442809551406e-12   , 3.1983345111713345e-13    , -5.6652104845822977e-14   , 7.972121805483085e-15     , -9.46884326905599e-16     , 9.849896673624398e-17     , -9.195035611844804e-18    , 7.833797135940897e-19     , -6.164568957507525e-20    , 4.519782155918545e-21     , -3.1083095245673874e-22   , 2.0402470744005635e-23    , -1.2498010114165282e-24   , },
+    /* x = 32.0        */  {1.1064706988078906e-12    , -4.861059299891473e-13    , 1.1412594654180638e-13    , -1.9009226226298297e-14   , 2.5172213518824648e-15    , -2.816456659501608e-16    , 2.7639790187923852e-17    , -2.438876023303344e-18    , 1.96869907814807e-19      , -1.47198610651863e-20     , 1.0287119887126263e-21    , -6.76635039073548e-23     , 4.259258324157785e-24     , -2.5136701331395067e-25   , },
+    /* x = 34.0        */  {4.714522583668417e-13     , -1.9530692829946278e-13   , 4.324203046862376e-14     , -6.7936749982217976e-15   , 8.488340702092229e-16     , -8.965882650827671e-17    , 8.312952305853848e-18     , -6.937863957769684e-19    , 5.304949789177997e-20     , -3.764427932803999e-21    , 2.5025832829149996e-22    , -1.570004177572635e-23    , 9.445563760357294e-25     , -5.350171456264591e-26    , },
+    /* x = 36.0        */  {2.1062449146273225e-13    , -8.254087732355374e-14    , 1.7288390990229106e-14    , -2.5697037722496933e-15   , 3.0380206176598637e-16    , -3.0370596888725784e-17   , 2.6660860158507157e-18    , -2.1079345967267668e-19   , 1.5282414420148058e-20    , -1.0294178579985666e-21   , 6.506115264939155e-23     , -3.8876006860969465e-24   , 2.230672415699157e-25     , -1.209304437978766e-26    , },
+  },
+  /* n = 15 */
+  {
+    /* x = 0.0         */  {0.012629735020647946      , -0.011821172234321881     , 0.005554810640294037      , -0.001746441970766863     , 0.00041313909040630373    , -7.841144764855517e-05    , 1.2433945229879798e-05    , -1.6939985866425602e-06   , 2.0237424778308795e-07    , -2.15324616172349e-08     , 2.065276486985674e-09     , -1.8041949120995408e-10   , 1.473196297504383e-11     , -1.0895712108248878e-12   , },
+    /* x = 2.0         */  {0.0019576775037343534     , -0.0018168223746501625    , 0.0008473391662991546     , -0.0002646298131412691    , 6.222743159582921e-05     , -1.1746955005527722e-05   , 1.8536921770234355e-06    , -2.514299535411536e-07    , 2.9915897405319345e-08    , -3.1712463632933833e-09   , 3.03133555353707e-10      , -2.639805534562011e-11    , 2.14903110662662e-12      , -1.5851510039463915e-13   , },
+    /* x = 4.0         */  {0.00030883922593786324    , -0.0002836069004988287    , 0.00013105403586877501    , -4.059725852883398e-05    , 9.477684976619983e-06     , -1.7776384489750241e-06   , 2.7889363287058446e-07    , -3.7630950894440937e-08   , 4.45623706839983e-09      , -4.703460791485386e-10    , 4.4782045589310104e-11    , -3.8856496082553084e-12   , 3.1523490823181016e-13    , -2.3180762483524293e-14   , },
+    /* x = 6.0         */  {4.9793448760226085e-05    , -4.51224961437494e-05     , 2.0612871685326288e-05    , -6.321655385934569e-06    , 1.4628736016010457e-06    , -2.722426937542711e-07    , 4.241588144959319e-08     , -5.6875528796385935e-09   , 6.697411097096026e-10     , -7.033081179853907e-11    , 6.665349029922955e-12     , -5.758996049044346e-13    , 4.653527118000634e-14     , -3.409878615777994e-15    , },
+    /* x = 8.0         */  {8.248775373537567e-06     , -7.350124027388051e-06    , 3.3095635782530933e-06    , -1.0024041332505824e-06   , 2.2945350346711144e-07    , -4.2295682941339116e-08   , 6.5343329839711566e-09    , -8.696334445455927e-10    , 1.0171839631490379e-10    , -1.0617293026946451e-11   , 1.0007390235418794e-12    , -8.603829609174388e-14    , 6.919975890767475e-15     , -5.049850550134824e-16    , },
+    /* x = 10.0        */  {1.4137037991253097e-06    , -1.2328689537563147e-06   , 5.450676064479555e-07     , -1.6252296712965898e-07   , 3.670151119896719e-08     , -6.685952155771765e-09    , 1.0222969522190668e-09    , -1.348179382264417e-10    , 1.5641935543946193e-11    , -1.6209176996684359e-12   , 1.5179145811799017e-13    , -1.2973952296549974e-14   , 1.0377873212317384e-15    , -7.536995117699801e-17    , },
+    /* x = 12.0        */  {2.5280355026438725e-07    , -2.1448387120057495e-07   , 9.264689120456622e-08     , -2.708303190602007e-08    , 6.012986660651855e-09     , -1.0794314446413421e-09   , 1.6295263270268144e-10    , -2.125064195207105e-11    , 2.4413526641255737e-12    , -2.507852023696447e-13    , 2.330250676336357e-14     , -1.9778411504946335e-15   , 1.571853507629318e-16     , -1.1351318598035883e-17   , },
+    /* x = 14.0        */  {4.765093455394524e-08     , -3.904255502234921e-08    , 1.637503325392692e-08     , -4.668611151517443e-09    , 1.0146241043763767e-09    , -1.7882940032743074e-10   , 2.657121880726132e-11     , -3.4176098982861714e-12   , 3.879067993383907e-13     , -3.9424981739768056e-14   , 3.6289056535300224e-15    , -3.0543190094881283e-16   , 2.4086486281237636e-17    , -1.7277920375691409e-18   , },
+    /* x = 16.0        */  {9.573911275042358e-09     , -7.51152565701357e-09     , 3.036484845493849e-09     , -8.389929509643622e-10    , 1.7752090432475657e-10    , -3.057847775926778e-11    , 4.454523402360922e-12     , -5.632158482789278e-13    , 6.298002519657087e-14     , -6.3179388797202996e-15   , 5.748952247167199e-16     , -4.7896925376833756e-17   , 3.742168029939486e-18     , -2.662882735821078e-19    , },
+    /* x = 18.0        */  {2.0730687309228557e-09    , -1.543745637396612e-09    , 5.965895999545847e-10     , -1.585898050845855e-10    , 3.24606801444296e-11      , -5.434298284496817e-12    , 7.72439730844521e-13      , -9.561370974107459e-14    , 1.049655828777461e-14     , -1.0361981347387672e-15   , 9.297071924139056e-17     , -7.65037681687333e-18     , 5.910234156694694e-19     , -4.165149723519907e-20    , },
+    /* x = 20.0        */  {4.88126554688137e-10      , -3.4223017029859653e-10   , 1.2542070925073882e-10    , -3.1830133352225435e-11   , 6.257969803061774e-12     , -1.0117467644489584e-12   , 1.3953498754221897e-13    , -1.6826092122272326e-14   , 1.8057351044290762e-15    , -1.747713298557234e-16    , 1.5412784125144956e-17    , -1.2492295686286032e-18   , 9.51953270739891e-20      , -6.630599892472792e-21    , },
+    /* x = 22.0        */  {1.25622451598006e-10      , -8.242776528741668e-11    , 2.8451059327909294e-11    , -6.844041147234333e-12    , 1.2832955963620181e-12    , -1.990119351213481e-13    , 2.6464973485486003e-14    , -3.091514769414529e-15    , 3.2271026143784107e-16    , -3.048857068964148e-17    , 2.632600450948264e-18     , -2.0946722276105626e-19   , 1.569816340511235e-20     , -1.0779700517695634e-21   , },
+    /* x = 24.0        */  {3.535054751285137e-11     , -2.163958058066857e-11    , 7.002182152970852e-12     , -1.5875493561433422e-12   , 2.821233443345625e-13     , -4.1696584405154586e-14   , 5.312756970477277e-15     , -5.975992545594251e-16    , 6.034109250570792e-17     , -5.5368612100104015e-18   , 4.660145988769145e-19     , -3.625562137551e-20       , 2.6626728573351683e-21    , -1.7971109553498514e-22   , },
+    /* x = 26.0        */  {1.0835951555559575e-11    , -6.185832766774218e-12    , 1.872712523027848e-12     , -3.987973697389243e-13    , 6.686225869288482e-14     , -9.367831067869911e-15    , 1.1370936201534668e-15    , -1.2244594979574558e-16   , 1.1891546485315974e-17    , -1.0540890343433114e-18   , 8.604793909225645e-20     , -6.516238296081271e-21    , 4.670361630239625e-22     , -3.0870682130617263e-23   , },
+    /* x = 28.0        */  {3.5944645921372733e-12    , -1.91679372054341e-12     , 5.431019501137446e-13     , -1.0851370673340411e-13   , 1.7123330696959144e-14    , -2.266245828675551e-15    , 2.609090731873322e-16     , -2.6763062214558767e-17   , 2.4867861047142136e-18    , -2.1182037129353653e-19   , 1.6684996352622213e-20    , -1.2239201621155819e-21   , 8.521712831986812e-23     , -5.493977633252165e-24    , },
+    /* x = 30.0        */  {1.2804442809551406e-12    , -6.396669022342686e-13    , 1.6995631453746836e-13    , -3.188848722187667e-14    , 4.734421634535705e-15     , -5.90993800918648e-16     , 6.436524924589907e-17     , -6.267035799076585e-18    , 5.548112854996074e-19     , -4.520132323695666e-20    , 3.419062910214827e-21     , -2.417731992763863e-22    , 1.6275620968088824e-23    , -1.0189406559121406e-24   , },
+    /* x = 32.0        */  {4.861059299891473e-13     , -2.282518930836131e-13    , 5.702767867889478e-14     , -1.0068885407519034e-14   , 1.4082283297522581e-15    , -1.6583874122498932e-16   , 1.7072132156143057e-17    , -1.5749588912208728e-18   , 1.3247876454583583e-19    , -1.0287800710345791e-20   , 7.442839152389894e-22     , -5.0516846172330127e-23   , 3.2730906576068187e-24    , -1.9810734382812487e-25   , },
+    /* x = 34.0        */  {1.9530692829946278e-13    , -8.648406093724759e-14    , 2.038102499466537e-14     , -3.3953362808346728e-15   , 4.482941325416714e-16     , -4.987771385509264e-17    , 4.856504769057039e-18     , -4.243959070455419e-19    , 3.387985435634317e-20     , -2.50272280014912e-21     , 1.7269756404017749e-22    , -1.1212900533031822e-23   , 6.965752527724358e-25     , -4.0596360904570185e-26   , },
+    /* x = 36.0        */  {8.254087732355374e-14     , -3.4576781980458225e-14   , 7.709111316749076e-15     , -1.2152082470634643e-15   , 1.5185298444368903e-16    , -1.599651609943605e-17    , 1.475554217420263e-18     , -1.22259298856391e-19     , 9.264761340190971e-21     , -6.506417895723884e-22    , 4.276300304436842e-23     , -2.650392364194358e-24    , 1.5742940721912335e-25    , -8.805725164394915e-27    , },
+  },
+  /* n = 16 */
+  {
+    /* x = 0.0         */  {0.01182117223432189       , -0.011109621280589869     , 0.005239325912299896      , -0.0016525563615677826    , 0.0003920572382520227     , -7.460367189635212e-05    , 1.1857990062106536e-05    , -1.6189920119083414e-06   , 1.9379224969041353e-07    , -2.0656378019804704e-08   , 1.9845213734052646e-09    , -1.73629657495558e-10     , 1.4198257440367193e-11    , -1.0514697014794971e-12   , },
+    /* x = 2.0         */  {0.0018168223746501636     , -0.0016946783325985696    , 0.0007938894394237069     , -0.00024890972637498226   , 5.8734775028977374e-05    , -1.1122153137177977e-05   , 1.7600096683611018e-06    , -2.3932689330601703e-07   , 2.8541231043297245e-08    , -3.0318598904201267e-09   , 2.9036513996879075e-10    , -2.5330682968568004e-11   , 2.065594443709115e-12     , -1.525880389895427e-13    , },
+    /* x = 4.0         */  {0.0002836069004988289     , -0.000262108071737588     , 0.00012179177558648733    , -3.791073990526459e-05    , 8.88819224506982e-06      , -1.6733618081654377e-06   , 2.634166553263941e-07     , -3.564985485205825e-08    , 4.233116715476753e-09     , -4.478969143777104e-10    , 4.274018688311357e-11     , -3.716078841752615e-12    , 3.0206226115469996e-13    , -2.2250254768212813e-14   , },
+    /* x = 6.0         */  {4.512249614374943e-05     , -4.122574337065814e-05    , 1.8964966157801573e-05    , -5.85149440622599e-06     , 1.3612134687998159e-06    , -2.544952903018498e-07    , 3.9812870020841886e-08    , -5.357922764403429e-09    , 6.329775989947851e-10     , -6.666470050252165e-11    , 6.3346093263974835e-12    , -5.486379597682061e-13    , 4.443254913423787e-14     , -3.262285041806837e-15    , },
+    /* x = 8.0         */  {7.350124027388055e-06     , -6.619127156507008e-06    , 3.0072123997514334e-06    , -9.178140138421559e-07    , 2.1147841471087987e-07    , -3.920599814051756e-08    , 6.087434091731689e-09     , -8.137462685930285e-10    , 9.555568029190683e-11     , -1.0009044138353856e-11   , 9.463791604071815e-13     , -8.159603421647889e-14    , 6.580114742217611e-15     , -4.81301732852678e-16     , },
+    /* x = 10.0        */  {1.2328689537563153e-06    , -1.090135212896033e-06    , 4.875689013889305e-07     , -1.4680604479196217e-07   , 3.34297607794781e-08      , -6.133781748485971e-09    , 9.43725564612164e-10      , -1.2513535032812e-10      , 1.458826566828595e-11     , -1.5181603456253235e-12   , 1.4270724500765573e-13    , -1.2238922668120806e-14   , 9.820750845427524e-16     , -7.151963754335939e-17    , },
+    /* x = 12.0        */  {2.1448387120057503e-07    , -1.852937824091507e-07    , 8.124909571805328e-08     , -2.4051946642022074e-08   , 5.397157223299065e-09     , -9.77715801485996e-10     , 1.4875449322113963e-10    , -1.953080123174451e-11    , 2.2570677714840604e-12    , -2.330618914126891e-13    , 2.1755323528755737e-14    , -1.8540811751194514e-15   , 1.4790503149163535e-16    , -1.0716014021686741e-17   , },
+    /* x = 14.0        */  {3.9042555022349224e-08    , -3.27500665078566e-08     , 1.4005833454551287e-08    , -4.0584964174169505e-09   , 8.941470016510488e-10     , -1.5942731364084081e-10   , 2.3923269221297775e-11    , -3.103251356665266e-12    , 3.5482497861375913e-13    , -3.629462749661792e-14    , 3.3596111188646153e-15    , -2.84175019599002e-16     , 2.251213358256412e-17     , -1.6211884946498149e-18   , },
+    /* x = 16.0        */  {7.511525657013572e-09     , -6.0729696909881215e-09   , 2.5169788528929283e-09    , -7.100836172854762e-10    , 1.5289238879845114e-10    , -2.6727140536155963e-11   , 3.942510927812347e-12     , -5.038397367244437e-13    , 5.686147164872063e-14     , -5.7498046527751405e-15   , 5.268449289414304e-16     , -4.416196486239292e-17    , 3.469475473823937e-18     , -2.4805493042208463e-19   , },
+    /* x = 18.0        */  {1.5437456373966124e-09    , -1.1931791999092349e-09   , 4.757694152537322e-10     , -1.2984272057561724e-10   , 2.7171491422809082e-11    , -4.634638403983642e-12    , 6.69295966627317e-13      , -8.397239422053492e-14    , 9.325786556302747e-15     , -9.298393702484532e-16    , 8.415087534941424e-17     , -6.976905332066013e-18    , 5.42658509280978e-19      , -3.846432208686049e-20    , },
+    /* x = 20.0        */  {3.422301702985966e-10     , -2.50841418501488e-10     , 9.549040005667249e-11     , -2.503187921191608e-11    , 5.058733822295517e-12     , -8.372099282334069e-13    , 1.1778264461239354e-13    , -1.4445869479795884e-14   , 1.5729424905694081e-15    , -1.5414866427134537e-16   , 1.3741014940181137e-17    , -1.1241679415195944e-18   , 8.63833809009688e-20      , -6.059554215112495e-21    , },
+    /* x = 22.0        */  {8.242776528741668e-11     , -5.690211865582025e-11    , 2.0532123441702395e-11    , -5.133182385394933e-12    , 9.95059675614793e-13      , -1.5878984139132625e-13   , 2.1640603347245727e-14    , -2.5816802685315864e-15   , 2.7439721904955335e-16    , -2.6329347307302723e-17   , 2.3040584417043633e-18    , -1.854601124603412e-19    , 1.4043070442542182e-20    , -9.72756493704502e-22     , },
+    /* x = 24.0        */  {2.1639580580668572e-11    , -1.4004364305941975e-11   , 4.762648068429929e-12     , -1.1284933773295253e-12   , 2.084829220270772e-13     , -3.187654190141042e-14    , 4.183194775654775e-15     , -4.827284407469461e-16    , 4.9831764308304125e-17    , -4.660694812557138e-18    , 3.987987140199518e-19     , -3.1473021171429106e-20   , 2.3410158830237705e-21    , -1.5970683445498004e-22   , },
+    /* x = 26.0        */  {6.185832766774218e-12     , -3.7454250460557424e-12   , 1.1963921092167567e-12    , -2.6744903477006794e-13   , 4.6839155339565934e-14    , -6.822561734166571e-15    , 8.5712164753149055e-16    , -9.513232141052143e-17    , 9.486803535155306e-18     , -8.605719408342629e-19    , 7.167644448476528e-20     , -5.523650104108222e-21    , 4.0211047415964904e-22    , -2.6931623528005257e-23   , },
+    /* x = 28.0        */  {1.91679372054341e-12      , -1.086203900227497e-12    , 3.2554112020020956e-13    , -6.849332278758045e-14    , 1.1331229143414687e-14    , -1.565454441429649e-15    , 1.8734143532462143e-16    , -1.9894280052260982e-17   , 1.9063837215849447e-18    , -1.668660731919493e-19    , 1.3462750254475748e-20    , -1.0085440113245804e-21   , 7.155681935901577e-23     , -4.687792210684608e-24    , },
+    /* x = 30.0        */  {6.396669022342686e-13     , -3.3991262907493814e-13   , 9.566546166562951e-14     , -1.893768653809655e-14    , 2.9549690045997578e-15    , -3.8619149589193554e-16   , 4.3869250562247265e-17    , -4.438488696827734e-18    , 4.0681197618623166e-19    , -3.4193539431177993e-20   , 2.6594396236021215e-21    , -1.9276715061666279e-22   , 1.3270073079356252e-23    , -8.468734821174937e-25    , },
+    /* x = 32.0        */  {2.282518930836131e-13     , -1.1405535735778984e-13   , 3.020665622255701e-14     , -5.632913319000307e-15    , 8.291937061261424e-16     , -1.0243279301541012e-16   , 1.1024712232805239e-17    , -1.0598298170598794e-18   , 9.259021869605126e-20     , -7.443387974448029e-21    , 5.556732774974727e-22     , -3.879804833211666e-23    , 2.5797704199341664e-24    , -1.5969891651330666e-25   , },
+    /* x = 34.0        */  {8.648406093724759e-14     , -4.07620499893308e-14     , 1.0186008842504002e-14    , -1.7931765301649582e-15   , 2.493885692756926e-16     , -2.9139028629891064e-17   , 2.97077134821766e-18      , -2.7103877560555557e-19   , 2.252450756110804e-20     , -1.727084273903927e-21    , 1.2333959838079343e-22    , -8.264083014591168e-24    , 5.285918235546787e-25     , -3.1610226722990613e-26   , },
+    /* x = 36.0        */  {3.4576781980458225e-14    , -1.541822263349816e-14    , 3.645624741190389e-15     , -6.074119377743955e-16    , 7.998258049722648e-17     , -8.853325307767738e-18    , 8.558150917728195e-19     , -7.41180783529533e-20     , 5.855776581725718e-21     , -4.276527095434033e-22    , 2.915385097070333e-23     , -1.8693577594089993e-24   , 1.1464353988023165e-25    , -6.599069196889737e-27    , },
+  },
+  /* n = 17 */
+  {
+    /* x = 0.0         */  {0.011109621280589876      , -0.010478651824601525     , 0.004957669084702677      , -0.001568228952952599     , 0.0003730183594907052     , -7.114794087223964e-05    , 1.133294404041817e-05     , -1.5503360937479258e-06   , 1.8590749420356837e-07    , -1.9848704792596257e-08   , 1.9098362436775138e-09    , -1.6733176269022618e-10   , 1.3701831872071894e-11    , -1.0159404398101424e-12   , },
+    /* x = 2.0         */  {0.0016946783325985707     , -0.0015877788788476648    , 0.00074672917912485       , -0.00023493910010787542   , 5.5610765687182045e-05    , -1.0560058082498508e-05   , 1.6752882469388647e-06    , -2.2832957271907162e-07   , 2.7286752307989844e-08    , -2.9041568322792083e-09   , 2.786245126558508e-10     , -2.4345944239008164e-11   , 1.9883721477128936e-12    , -1.4708680272765125e-13   , },
+    /* x = 4.0         */  {0.00026210807173758814    , -0.00024358355117301116   , 0.0001137322197157797     , -3.5552768979110864e-05   , 8.366809041014645e-06     , -1.5804999424777725e-06   , 2.4954898306448406e-07    , -3.386489363870159e-08    , 4.031074158026956e-09     , -4.274753749737256e-10    , 4.087498131440581e-11     , -3.5605841202032403e-12   , 2.899391633725455e-13     , -2.1391112247958887e-14   , },
+    /* x = 6.0         */  {4.122574337065817e-05     , -3.792993231560848e-05    , 1.755448321867592e-05     , -5.44485387502847e-06     , 1.2724764515365735e-06    , -2.3887722166271795e-07   , 3.7505459219648046e-08    , -5.063814932555507e-09    , 5.999825856458758e-10     , -6.33568379404277e-11     , 6.0347426559695065e-12    , -5.238116440151617e-13    , 4.250967744107001e-14     , -3.126815463533415e-15    , },
+    /* x = 8.0         */  {6.619127156507012e-06     , -6.014424799503651e-06    , 2.7534420415261672e-06    , -8.459136588184091e-07    , 1.960299907065922e-07     , -3.652460477646153e-08    , 5.696223860927398e-09     , -7.644445808734718e-10    , 9.008143844368472e-11     , -9.46537130690347e-12     , 8.975160896905783e-13     , -7.758246804239758e-14    , 6.271573358066404e-15     , -4.597093834314558e-16    , },
+    /* x = 10.0        */  {1.0901352128960336e-06    , -9.75137802777977e-07     , 4.404181343758422e-07     , -1.337190431141961e-07    , 3.0668908743020304e-08    , -5.6623534211312765e-09   , 8.759474494622718e-10     , -1.1670599785123284e-10   , 1.3663449185382244e-11    , -1.4273062433574486e-12   , 1.3462220904565872e-13    , -1.1580825164981869e-14   , 9.319155633235757e-16     , -6.803602436179429e-17    , },
+    /* x = 12.0        */  {1.852937824091508e-07     , -1.6249819143612388e-07   , 7.215583992605965e-08     , -2.1588628892642038e-08   , 4.888579007517657e-09     , -8.925269643165131e-10    , 1.3671560820130329e-10    , -1.8056523158425033e-11   , 2.0975579247607083e-12    , -2.1758810101703717e-13   , 2.0394010845134364e-14    , -1.7444264730565864e-15   , 1.3962896336605676e-16    , -1.0146223634201852e-17   , },
+    /* x = 14.0        */  {3.2750066507856616e-08    , -2.8011666909105178e-08   , 1.2175489252249866e-08    , -3.57658800652081e-09     , 7.971365682173293e-10     , -1.4353961607850597e-10   , 2.1722759433646686e-11    , -2.8385969682579424e-12   , 3.266517825062351e-13     , -3.3601356871302366e-14   , 3.125793167836542e-15     , -2.6556671344225944e-16   , 2.1123471399600835e-17    , -1.5265332544122796e-18   , },
+    /* x = 16.0        */  {6.072969690988123e-09     , -5.033957705786253e-09    , 2.1302508518562798e-09    , -6.115695551811288e-10    , 1.3363570268276328e-10    , -2.3655065680993316e-11   , 3.526878147549188e-12     , -4.548913383342544e-13    , 5.1748262281309904e-14    , -5.269246697934815e-15    , 4.857616588477967e-16     , -4.0937659379741524e-17   , 3.231970866831054e-18     , -2.320510189190754e-19    , },
+    /* x = 18.0        */  {1.1931791999092353e-09    , -9.515388305075251e-10    , 3.89528161726829e-10      , -1.0868596568928599e-10   , 2.3173192020221264e-11    , -4.015775817322675e-12    , 5.878067580888964e-13     , -7.460622554231119e-14    , 8.3685574501032e-15       , -8.416314446931396e-16    , 7.674290980299794e-17     , -6.404807004231083e-18    , 5.011449411455117e-19     , -3.5703771515920815e-20   , },
+    /* x = 20.0        */  {2.5084141850148803e-10    , -1.909808001133545e-10    , 7.509563763574472e-11     , -2.0234935288877665e-11   , 4.186049641213941e-12     , -7.066958704148728e-13    , 1.0112108613339237e-13    , -1.25835294818154e-14     , 1.3873384610193373e-15    , -1.3742929846960324e-16   , 1.2365375462450085e-17    , -1.0198857150243042e-18   , 7.89458151294425e-20      , -5.5724485219935235e-21   , },
+    /* x = 22.0        */  {5.6902118655820255e-11    , -4.10642468834063e-11     , 1.5399547156184246e-11    , -3.9802387024108495e-12   , 7.939492069640031e-13     , -1.2984362051850877e-13   , 1.8071761844331907e-14    , -2.19517609470255e-15     , 2.3696420160763294e-16    , -2.3043624152482357e-17   , 2.039987074200062e-18     , -1.658635270383828e-19    , 1.2672804650953403e-20    , -8.845686916222094e-22    , },
+    /* x = 24.0        */  {1.4004364305941977e-11    , -9.525296136860102e-12    , 3.385480131988487e-12     , -8.33931688100482e-13     , 1.5938270950823184e-13    , -2.5099168724391642e-14   , 3.3790990795652376e-15    , -3.9865384596950544e-16   , 4.194626545007985e-17     , -3.988479484309429e-18    , 3.461913645399447e-19     , -2.7662435912555834e-20   , 2.080504910883944e-21     , -1.4327202707798304e-22   , },
+    /* x = 26.0        */  {3.7454250460557424e-12    , -2.3927842184335538e-12   , 8.023471043101894e-13     , -1.8735662135696528e-13   , 3.4112808671025746e-14    , -5.142729896878593e-15    , 6.659262489476418e-16     , -7.589438373851024e-17    , 7.745149452009427e-18     , -7.168461226230826e-19    , 6.075821058574746e-20     , -4.754031557052968e-21    , 3.508168118512546e-22     , -2.3768014375380246e-23   , },
+    /* x = 28.0        */  {1.0862039002274973e-12    , -6.51082240400426e-13     , 2.0547996836273895e-13    , -4.532491657343713e-14    , 7.8272722071806e-15       , -1.1240486139428933e-15   , 1.3925996021050968e-16    , -1.5251062170279383e-17   , 1.5017949915823672e-18    , -1.346414429372862e-19    , 1.1093658640718542e-20    , -8.465137375420581e-22    , 6.105966432304954e-23     , -4.0565771460267194e-24   , },
+    /* x = 30.0        */  {3.3991262907493814e-13    , -1.9133092333126026e-13   , 5.681305961428923e-14     , -1.181987601835992e-14    , 1.93095747946527e-15      , -2.632155037255937e-16    , 3.1069420850948115e-17    , -3.2544944678171343e-18   , 3.0774191241317507e-19    , -2.6596856420486125e-20   , 2.1203823984054024e-21    , -1.5709347871970244e-22   , 1.1029814164606719e-23    , -7.158919780384917e-25    , },
+    /* x = 32.0        */  {1.1405535735778984e-13    , -6.041331244511425e-14    , 1.6898739957000844e-14    , -3.3167748244973934e-15   , 5.121639650780518e-16     , -6.614827346143563e-17    , 7.418808714613007e-18     , -7.407215034044933e-19    , 6.699050206984729e-20     , -5.557184154503445e-21    , 4.267684599834501e-22     , -3.056325634104955e-23    , 2.0797485642077907e-24    , -1.3134577825292023e-25   , },
+    /* x = 34.0        */  {4.07620499893308e-14      , -2.0372017685008048e-14   , 5.379529590494861e-15     , -9.97554277101394e-16     , 1.4569514314964196e-16    , -1.7824628101697235e-17   , 1.8972714283429406e-18    , -1.8019601327444267e-19   , 1.5543760385188712e-20    , -1.2334825579377588e-21   , 9.090303564366855e-23     , -6.267535835780773e-24    , 4.1161572059077884e-25    , -2.5191627978550824e-26   , },
+    /* x = 36.0        */  {1.541822263349816e-14     , -7.291249482380787e-15    , 1.8222358133231836e-15    , -3.1993032198862856e-16   , 4.426662653887511e-17     , -5.1348905531341565e-18   , 5.1882654829585135e-19    , -4.684620313870197e-20    , 3.8488747605389805e-21    , -2.915559567841438e-22    , 2.056256900644176e-23     , -1.3604939599758744e-24   , 8.592112401325289e-26     , -5.076730976175703e-27    , },
+  },
+  /* n = 18 */
+  {
+    /* x = 0.0         */  {0.010478651824601531      , -0.009915338169407031     , 0.004704686858857148      , -0.0014920734379091432    , 0.00035573970436985963    , -6.799766472577778e-05    , 1.0852352614654628e-05    , -1.4872581120854512e-06   , 1.7863843224544417e-07    , -1.910173937812893e-08    , 1.8405622495799475e-09    , -1.6147426699491077e-10   , 1.323891548094616e-11     , -9.827316709501978e-13    , },
+    /* x = 2.0         */  {0.0015877788788476658     , -0.001493458358249942     , 0.0007048173003235326     , -0.00022244306274097378   , 5.280029041374122e-05     , -1.0051729551447324e-05   , 1.598307003038959e-06     , -2.182937524305937e-07    , 2.613742433743339e-08     , -2.786732966411742e-09    , 2.6779282401751197e-10    , -2.3434633093318826e-11   , 1.916697014927482e-12     , -1.419672266013282e-13    , },
+    /* x = 4.0         */  {0.00024358355117301133    , -0.00022746443943159455   , 0.00010665830693731905    , -3.346723616293363e-05    , 7.902499712569594e-06     , -1.4972939085150212e-06   , 2.370542546032761e-07     , -3.224855467012332e-08    , 3.847280234193668e-09     , -4.0882058516866353e-10   , 3.9164607042952885e-11    , -3.417493508840364e-12    , 2.7874570315597776e-13    , -2.059547233739916e-14    , },
+    /* x = 6.0         */  {3.79299323156085e-05      , -3.5108966437356964e-05   , 1.633456162508344e-05     , -5.089905805982317e-06    , 1.194386108339865e-06     , -2.2503275679419425e-07   , 3.544670440175009e-08     , -4.799855059579339e-09    , 5.702118117912489e-10     , -6.035774248489206e-11    , 5.7616637394711206e-12    , -5.011114322425249e-13    , 4.074473381678918e-14     , -3.00204743463929e-15     , },
+    /* x = 8.0         */  {6.0144247995036545e-06    , -5.506884083053085e-06    , 2.5377409764549395e-06    , -7.841199628023379e-07    , 1.8262302388614677e-07    , -3.417734338191615e-08    , 5.351112047683854e-09     , -7.206506831242767e-10    , 8.5188381260413e-11       , -8.976672685203509e-12    , 8.533685243531275e-13     , -7.393925257935372e-14    , 5.9902681989913464e-15    , -4.399461010877042e-16    , },
+    /* x = 10.0        */  {9.751378027779776e-07     , -8.808362687517951e-07    , 4.0115712934254594e-07    , -1.2267563496853787e-07   , 2.8311767106220533e-08    , -5.255684728674827e-09    , 8.169419822503297e-10     , -1.0930747192129216e-10   , 1.2845761994369176e-11    , -1.3464450038051257e-12   , 1.2738340112225274e-13    , -1.0988407750416725e-14   , 8.865323629754316e-16     , -6.486995222705121e-17    , },
+    /* x = 12.0        */  {1.6249819143612396e-07    , -1.4431167985213574e-07   , 6.476588667791985e-08     , -1.9554316029544472e-08   , 4.462634821666006e-09     , -8.202936539448512e-10    , 1.2639566170840274e-10    , -1.6780445347329117e-11   , 1.958293767618686e-12     , -2.039732088898647e-13    , 1.918785173867359e-14     , -1.6466545332533977e-15   , 1.3220619044293367e-16    , -9.632524350938629e-18    , },
+    /* x = 14.0        */  {2.8011666909105188e-08    , -2.4350978504502194e-08   , 1.0729764019561498e-08    , -3.1885462727905515e-09   , 7.176980804049638e-10     , -1.303365573110137e-10    , 1.9870178718114526e-11    , -2.6132115578582716e-12   , 3.0241233976531156e-13    , -3.126288679214719e-14    , 2.921108755697557e-15     , -2.491563967567275e-16    , 1.9890423800026775e-17    , -1.441978200473539e-18    , },
+    /* x = 16.0        */  {5.0339577057862545e-09    , -4.260501703712932e-09    , 1.8347086655432464e-09    , -5.345428107191502e-10    , 1.1827532840683547e-10    , -2.116126899245695e-11    , 3.1842393593678105e-12    , -4.139856899057105e-13    , 4.742323950917112e-14     , -4.858365384460147e-15    , 4.502954510167717e-16     , -3.8130036502386724e-17   , 3.0235009061883596e-18    , -2.179049317706477e-19    , },
+    /* x = 18.0        */  {9.515388305075253e-10     , -7.790563234537148e-10    , 3.260578970678367e-10     , -9.269276807906642e-11    , 2.007887908689712e-11     , -3.5268405649064936e-12   , 5.222435774340175e-13     , -6.694839721056072e-14    , 7.574685921470793e-15     , -7.675435049246162e-16    , 7.045002243264348e-17     , -5.913875279210044e-18    , 4.651871478608412e-19     , -3.329308171648637e-20    , },
+    /* x = 20.0        */  {1.9098080011335455e-10    , -1.5019127527149822e-10   , 6.070480586662973e-11     , -1.6744198564574277e-11   , 3.5334793521179524e-12    , -6.067265193345428e-13    , 8.808470616345438e-14     , -1.1098698031586802e-14   , 1.2368641346746e-15       , -1.2367146210751375e-16   , 1.1218304344215405e-17    , -9.318932321489394e-19    , 7.260130462327365e-20     , -5.1529577638678876e-21   , },
+    /* x = 22.0        */  {4.10642468834063e-11      , -3.0799094312369876e-11   , 1.194071610723204e-11     , -3.175796827811774e-12    , 6.492181025993331e-13     , -1.0843057146426314e-13   , 1.5366232630325238e-14    , -1.8957120952467575e-15   , 2.0739268722101262e-16    , -2.0402653618192186e-17   , 1.82443049505404e-18      , -1.4964453957881964e-19   , 1.1524232000800139e-20    , -8.098250962792145e-22    , },
+    /* x = 24.0        */  {9.525296136860104e-12     , -6.770960263977195e-12    , 2.501795064301365e-12     , -6.375308380258479e-13    , 1.254958436230331e-13     , -2.0274594541126965e-14   , 2.790576916626477e-15     , -3.355698807376244e-16    , 3.5896326417203374e-17    , -3.462358985723259e-18    , 3.042759814466705e-19     , -2.457733175447074e-20    , 1.8664688445622133e-21    , -1.2959449263941509e-22   , },
+    /* x = 26.0        */  {2.392784218433554e-12     , -1.604694208620415e-12    , 5.620698640708828e-13     , -1.3645123468294544e-13   , 2.571364948456646e-14     , -3.9955575041070255e-15   , 5.312606853366878e-16     , -6.196115590663512e-17    , 6.4516168885397325e-18    , -6.076549210923016e-19    , 5.229260171615698e-20     , -4.146243285240035e-21    , 3.09618925764962e-22      , -2.1189146866890427e-23   , },
+    /* x = 28.0        */  {6.51082240400426e-13      , -4.1095993672548396e-13   , 1.3597474972030924e-13    , -3.130908882852825e-14    , 5.620243069743119e-15     , -8.355597630109603e-16    , 1.0675743505440738e-16    , -1.2014353272399406e-17   , 1.2117732812110263e-18    , -1.1094879926018288e-19   , 9.311362864814142e-21     , -7.220557528601973e-22    , 5.2840327457272505e-23    , -3.5538941016610136e-24   , },
+    /* x = 30.0        */  {1.9133092333126026e-13    , -1.136261192285795e-13    , 3.545962805507939e-14     , -7.72382991782752e-15     , 1.3160775186328302e-15    , -1.8641652540780388e-16   , 2.278146125138185e-17     , -2.4619341481260364e-18   , 2.3937175779935055e-19    , -2.1205934876300505e-20   , 1.727979358559347e-21     , -1.3051524815756698e-22   , 9.324381367577787e-24     , -6.142553446096538e-25    , },
+    /* x = 32.0        */  {6.041331244511425e-14     , -3.379747991400188e-14    , 9.950324473492116e-15     , -2.048655860306199e-15    , 3.307413673080296e-16     , -4.451285234176395e-17    , 5.185050519744095e-18     , -5.359238104718177e-19    , 5.0014666149961555e-20    , -4.268062494065022e-21    , 3.361872543293736e-22     , -2.4627134608757603e-23   , 1.710610011927329e-24     , -1.0996336748552882e-25   , },
+    /* x = 34.0        */  {2.0372017685008048e-14    , -1.0759059180989757e-14   , 2.99266283130417e-15      , -5.827805725974479e-16    , 8.912314050864087e-17     , -1.1383628580140033e-17   , 1.2613720921784581e-18    , -1.2435004466434542e-19   , 1.1101344612952942e-20    , -9.091008000023362e-22    , 6.894133793514593e-23     , -4.8779018265489625e-24   , 3.2805710991238775e-25    , -2.0498089064748057e-26   , },
+    /* x = 36.0        */  {7.291249482380787e-15     , -3.644471626646374e-15    , 9.597909659658834e-16     , -1.770665061552819e-16    , 2.567445276570009e-17     , -3.112959291742401e-18    , 3.279234218302101e-19     , -3.0790990588375315e-20   , 2.6240039125904655e-21    , -2.05639434846518e-22     , 1.496513870707872e-23     , -1.0190564186236114e-24   , 6.610472796626386e-26     , -3.999481092051517e-27    , },
+  },
+  /* n = 19 */
+  {
+    /* x = 0.0         */  {0.009915338169407038      , -0.00940937371771592      , 0.0044762203137268        , -0.0014229588174274601    , 0.00033998832363728456    , -6.511411615589794e-05    , 1.0410806744293316e-05    , -1.4291056747162865e-06   , 1.7191574078063554e-07    , -1.8408892538270944e-08   , 1.7761324710024258e-09    , -1.5601258074428034e-10   , 1.2806229024438387e-11    , -9.516234303435889e-13    , },
+    /* x = 2.0         */  {0.0014934583582499432     , -0.0014096346006472994    , 0.0006673291882228307     , -0.0002112011616474714    , 5.025864775844465e-05     , -9.58984208569901e-06     , 1.5280562612147763e-06    , -2.0909913761660963e-07   , 2.5080609126375485e-08    , -2.678399667302802e-09    , 2.5776881040720427e-10    , -2.2588857904468038e-11   , 1.8499937899026346e-12    , -1.371910330566041e-13    , },
+    /* x = 4.0         */  {0.00022746443943159468    , -0.00021331661387467198   , 0.00010040170848878781    , -3.160999884919378e-05    , 7.486469542749575e-06     , -1.4223255373843924e-06   , 2.2573988185329183e-07    , -3.077820466412719e-08    , 3.6793870615192365e-09    , -3.917143033497926e-10    , 3.7590673320589185e-11    , -3.2853883263656298e-12   , 2.6837947260321753e-13    , -1.9856581007367914e-14   , },
+    /* x = 6.0         */  {3.5108966437356984e-05    , -3.266912325017181e-05    , 1.5269717417945054e-05    , -4.77754443320178e-06     , 1.125163783996274e-06     , -2.1268022783011405e-07   , 3.359898529558485e-08     , -4.5616890847695055e-09   , 5.432199426876349e-10     , -5.7626557186235555e-11   , 5.5119711923064984e-12    , -4.802778863934906e-13    , 3.9119191971764e-14       , -2.8867710180631347e-15   , },
+    /* x = 8.0         */  {5.506884083053088e-06     , -5.075481952910598e-06    , 2.3523598884067375e-06    , -7.30492095521548e-07     , 1.7088671691326755e-07    , -3.210667249352646e-08    , 5.0445547641706935e-09    , -6.815062596798548e-10    , 8.079009209808006e-11     , -8.535134645550319e-12    , 8.132946866014727e-13     , -7.061804638206831e-14    , 5.7327882734595275e-15    , -4.217915160366187e-16    , },
+    /* x = 10.0        */  {8.808362687517956e-07     , -8.023142586851976e-07    , 3.6802690490557313e-07    , -1.1324706842149662e-07   , 2.6278423643914186e-08    , -4.901651923982154e-09    , 7.651523008564175e-10     , -1.0276597980796655e-10   , 1.2118010590502856e-11    , -1.2740469954208672e-12   , 1.2086705196923894e-13    , -1.0452476281554262e-14   , 8.452852709138705e-16     , -6.198055202773178e-17    , },
+    /* x = 12.0        */  {1.443116798521358e-07     , -1.2953177335585534e-07   , 5.8662948088627443e-08    , -1.785053928616329e-08    , 4.101468269803843e-09     , -7.583739747585899e-10    , 1.1746311704923308e-10    , -1.566633296225073e-11    , 1.8357596988234613e-12    , -1.91910018725951e-13     , 1.8112399173636153e-14    , -1.5589770733811017e-15   , 1.2551399957608292e-16    , -9.167185583783358e-18    , },
+    /* x = 14.0        */  {2.4350978504502204e-08    , -2.1459528039125325e-08   , 9.565638818370768e-09     , -2.870792321545238e-09    , 6.516827865668782e-10     , -1.1922107298046788e-10   , 1.8292480848313096e-11    , -2.4192961582624452e-12   , 2.8136610263169825e-13    , -2.921578167703506e-14    , 2.7406015511988916e-15    , -2.345876401074778e-16    , 1.8788924653396414e-17    , -1.3660292411345532e-18   , },
+    /* x = 16.0        */  {4.260501703712933e-09     , -3.669417331086843e-09    , 1.6036284321573183e-09    , -4.731013136161264e-10    , 1.0580634496405115e-10    , -1.9105436257179672e-11   , 2.8978998208600583e-12    , -3.7938553131150107e-13   , 4.372530663339014e-14     , -4.503660062276176e-15    , 4.1941263052524604e-16    , -3.566614330574861e-17    , 2.83922678077508e-18      , -2.0532106596240549e-19   , },
+    /* x = 18.0        */  {7.790563234537151e-10     , -6.521157941357266e-10    , 2.7807830423717924e-10    , -8.03155163458857e-11     , 1.7634202824799115e-11    , -3.1334614799341424e-12   , 4.68638779193855e-13      , -6.059742895607465e-14    , 6.9078942876280415e-15    , -7.0460734308949555e-16   , 6.504994548773924e-17     , -5.488743339548867e-18    , 4.33785619817297e-19      , -3.1172264989267406e-20   , },
+    /* x = 20.0        */  {1.5019127527149827e-10    , -1.2140961173326763e-10   , 5.023259569371978e-11     , -1.4133917408210233e-11   , 3.0336325967133983e-12    , -5.285082393356959e-13    , 7.769088602579575e-14     , -9.894904103726216e-15    , 1.1130435775381722e-15    , -1.1219949870915756e-16   , 1.025041624855027e-17     , -8.568521219663165e-19    , 6.713730008721639e-20     , -4.788570381039888e-21    , },
+    /* x = 22.0        */  {3.0799094312369876e-11    , -2.3881432214465352e-11   , 9.527390483434851e-12     , -2.5968724103565902e-12   , 5.421528573276017e-13     , -9.219739614875154e-14    , 1.3269984636550528e-14    , -1.6591401000726566e-15   , 1.8362394723512037e-16    , -1.824686793481053e-17    , 1.6460266956162606e-18    , -1.36053603039632e-19     , 1.05507241921467e-20      , -7.458383297193609e-22    , },
+    /* x = 24.0        */  {6.770960263977196e-12     , -5.003590128602932e-12    , 1.9125925140774696e-12    , -5.019833744856821e-13    , 1.0137297270662049e-13    , -1.6743461557830262e-14   , 2.3489891604315457e-15    , -2.8717039005701543e-16   , 3.1161241012196175e-17    , -3.0431655799415826e-18   , 2.703407331122365e-19     , -2.204344218061264e-20    , 1.688334547686463e-21     , -1.1807862636296411e-22   , },
+    /* x = 26.0        */  {1.6046942086204152e-12    , -1.1241397281417981e-12   , 4.093537040488245e-13     , -1.028545979372247e-13    , 1.9977787520692403e-14    , -3.187564121393342e-15    , 4.3372809059143387e-16    , -5.16128993919524e-17     , 5.468895907879444e-18     , -5.2299151048649965e-19   , 4.5607093912753563e-20    , -3.6582596083922675e-21   , 2.760343040201378e-22     , -1.9058567004797632e-23   , },
+    /* x = 28.0        */  {4.10959936725484e-13      , -2.7194949944062384e-13   , 9.392726648558281e-14     , -2.2480972278800535e-14   , 4.1777988150804184e-15    , -6.405446118743889e-16    , 8.410047278381796e-17     , -9.694180351327351e-18    , 9.985394568920958e-19     , -9.312444445300854e-20    , 7.94235556655802e-21      , -6.246431226074908e-22    , 4.629434423630413e-23     , -3.1473753983607644e-24   , },
+    /* x = 30.0        */  {1.1362611922857952e-13    , -7.091925611015969e-14    , 2.3171489753482242e-14    , -5.264310074502147e-15    , 9.320826270432948e-16     , -1.3668876777093116e-16   , 1.7233539016358095e-17    , -1.9149730616262965e-18   , 1.9085345787133133e-19    , -1.7281628680333826e-20   , 1.4356247191129475e-21    , -1.1029078279865723e-22   , 8.000960744903249e-24     , -5.3400352644611995e-25   , },
+    /* x = 32.0        */  {3.379747991400188e-14     , -1.990064894698439e-14    , 6.145967580918542e-15     , -1.3229654692270091e-15   , 2.2256426170955396e-16    , -3.111030316446195e-17    , 3.7514666697780414e-18    , -4.0011715393193714e-19   , 3.841257000018875e-20     , -3.3621939269928964e-21   , 2.70891094380872e-22      , -2.024679655861054e-23    , 1.4322098828840117e-24    , -9.352006597076703e-26    , },
+    /* x = 34.0        */  {1.0759059180989757e-14    , -5.985325662608369e-15    , 1.7483417177923337e-15    , -3.5649256203363513e-16   , 5.691814290083053e-17     , -7.568232561427995e-18    , 8.704503120246154e-19     , -8.88107250595969e-20     , 8.181908541148351e-21     , -6.894717704117034e-22    , 5.365560867027164e-23     , -3.885718323695191e-24    , 2.669520679637944e-25     , -1.6991120954022523e-26   , },
+    /* x = 36.0        */  {3.644471626646374e-15     , -1.9195819319317724e-15   , 5.311995184658438e-16     , -1.0269781106262448e-16   , 1.5564796458736053e-17    , -1.9675405325646346e-18   , 2.1553693400318296e-19    , -2.0992025267581577e-20   , 1.850755161020564e-21     , -1.4966244969430626e-22   , 1.1209378683637383e-23    , -7.836007273132782e-25    , 5.208123074492634e-26     , -3.2190516568769424e-27   , },
+  },
+  /* n = 20 */
+  {
+    /* x = 0.0         */  {0.009409373717715927      , -0.008952440627455174     , 0.00426887645228177       , -0.001359953294498755     , 0.00032557058078763534    , -6.24648409193696e-05     , 1.0003739683909247e-05    , -1.3753241977189524e-06   , 1.656801166500248e-07     , -1.7764494408558485e-08   , 1.7160564372051867e-09    , -1.509079320546585e-10    , 1.2400907297899429e-11    , -9.224226829259553e-13    , },
+    /* x = 2.0         */  {0.0014096346006473004     , -0.0013346583764458878    , 0.0006336034849423265     , -0.00020103459102652907   , 4.794921042966499e-05     , -9.16833763255752e-06     , 1.4636939576997755e-06    , -2.006446242975774e-07    , 2.410560904244997e-08     , -2.5781441839234334e-09   , 2.4846566659890465e-10    , -2.1801815605277667e-11   , 1.7877638929817268e-12    , -1.3272488490937085e-13   , },
+    /* x = 4.0         */  {0.0002133166138746721     , -0.0002008034169776083    , 9.48299965475687e-05      , -2.994587816995129e-05    , 7.111627687090586e-06     , -1.3544393005461467e-06   , 2.1544743183937872e-07    , -2.943506057198432e-08    , 3.5254304650147914e-09    , -3.7597260198903964e-10   , 3.613757511681158e-11     , -3.1630571757267186e-12   , 2.5875250067751874e-13    , -1.9168604902586114e-14   , },
+    /* x = 6.0         */  {3.266912325017183e-05     , -3.053943483589485e-05    , 1.433263329960351e-05     , -4.500655135833251e-06    , 1.0634011391749695e-06    , -2.0159391314058913e-07   , 3.193182347625336e-08     , -4.345754332120376e-09    , 5.186392657044585e-10     , -5.5129264640223224e-11   , 5.282811277465013e-12     , -4.610917968713289e-13    , 3.7617293044431476e-14    , -2.7799507872162412e-15   , },
+    /* x = 8.0         */  {5.075481952910602e-06     , -4.704719776814166e-06    , 2.1914762865643783e-06    , -6.835468676309453e-07    , 1.6053336247117832e-07    , -3.026732878421847e-08    , 4.770543800735754e-09     , -6.46319977737978e-10     , 7.681624829244753e-11     , -8.134338768476293e-12    , 7.76762835112882e-13      , -6.757847752025691e-14    , 5.496263473818957e-15     , -4.0505894858672617e-16   , },
+    /* x = 10.0        */  {8.023142586851981e-07     , -7.360538098112475e-07    , 3.39741205264451e-07      , -1.0511369457241583e-07   , 2.4508259620428675e-08    , -4.5909138343169e-09      , 7.193618561694775e-10     , -9.694397353746681e-11    , 1.1466428287150857e-11    , -1.2088744078717837e-12   , 1.1497202866015385e-13    , -9.965450899600954e-15    , 8.076420267711442e-16     , -5.933358877296777e-17    , },
+    /* x = 12.0        */  {1.2953177335585542e-07    , -1.173258961772698e-07    , 5.355161785848416e-08     , -1.640587307873776e-08    , 3.791869873869016e-09     , -7.047787065953537e-10    , 1.0966433037058518e-10    , -1.4686061205300933e-11   , 1.7271909511284712e-12    , -1.811540381873785e-13    , 1.7147982532914712e-14    , -1.4799407214597315e-15   , 1.1945171546976027e-16    , -8.74381129802091e-18     , },
+    /* x = 14.0        */  {2.1459528039125335e-08    , -1.913127763674375e-08    , 8.612376964634871e-09     , -2.606731146196641e-09    , 5.961053649135832e-10     , -1.0975488572793956e-10   , 1.6935073053859614e-11    , -2.2509263896815236e-12   , 2.629421507723002e-13     , -2.741047402290591e-14    , 2.580350922512167e-15     , -2.2157530766812001e-16   , 1.7799517327199687e-17    , -1.297466985612326e-18    , },
+    /* x = 16.0        */  {3.6694173310868444e-09    , -3.2072568643149674e-09   , 1.4193039408482539e-09    , -4.232253798456043e-10    , 9.552718128757257e-11     , -1.738739902059564e-11    , 2.6556987111431885e-12    , -3.4980208940572207e-13   , 4.053295778521971e-14     , -4.194793165435133e-15    , 3.9231073287501276e-16    , -3.348862692443745e-17    , 2.6752992247967788e-18    , -1.940617714054422e-19    , },
+    /* x = 18.0        */  {6.521157941357269e-10     , -5.561566084744085e-10    , 2.4094654903763824e-10    , -7.05368112975963e-11     , 1.5667307399922118e-11    , -2.8118326895693346e-12   , 4.241820014856045e-13     , -5.5263099405539495e-14   , 6.3414686743422126e-15    , -6.506001186607551e-16    , 6.03736474498246e-17      , -5.117559361543733e-18    , 4.0615925375156382e-19    , -2.929388548768758e-20    , },
+    /* x = 20.0        */  {1.2140961173326766e-10    , -1.004651913874472e-10    , 4.2401752224627836e-11    , -1.2134530386609444e-11   , 2.6425411967166035e-12    , -4.661453183528498e-13    , 6.92643285430632e-14      , -8.90434024446778e-15     , 1.00979588061137e-15      , -1.0251952151452736e-16   , 9.424989794811554e-18     , -7.922409376734153e-19    , 6.239089684771447e-20     , -4.46957040766941e-21     , },
+    /* x = 22.0        */  {2.3881432214465355e-11    , -1.905478096687088e-11    , 7.790617231069333e-12     , -2.1686114292726843e-12   , 4.609869807496053e-13     , -7.961990815891634e-14    , 1.1613980672435932e-14    , -1.4689902837786216e-15   , 1.6422187157545329e-16    , -1.646263998405326e-17    , 1.4965308030544618e-18    , -1.2453731540932167e-19   , 9.717292716141877e-21     , -6.905623154740237e-22    , },
+    /* x = 24.0        */  {5.003590128602933e-12     , -3.825185028155124e-12    , 1.505950123456978e-12     , -4.0549189082056693e-13   , 8.371730779006036e-14     , -1.409393501584151e-14    , 2.010192726035106e-15     , -2.4928972517978786e-16   , 2.7388499571894356e-17    , -2.7037794252487326e-18   , 2.42468718607872e-19      , -1.9935221003007576e-20   , 1.5383479745535114e-21    , -1.082805674475909e-22    , },
+    /* x = 26.0        */  {1.1241397281417983e-12    , -8.187074080976785e-13    , 3.0856379381166334e-13    , -7.991115008182581e-14    , 1.593782060711027e-14     , -2.602368552045492e-15    , 3.6129029505448997e-16    , -4.3751134885781225e-17   , 4.706925071339258e-18     , -4.561303096620172e-19    , 4.0239411430271225e-20    , -3.2605884641043506e-21   , 2.4828659442630817e-22    , -1.7276905151547678e-23   , },
+    /* x = 28.0        */  {2.7194949944062384e-13    , -1.8785453297117044e-13   , 6.744291683639987e-14     , -1.6711195260167947e-14   , 3.202723059395042e-15     , -5.04602838086887e-16     , 6.78592623484126e-17      , -7.988310381537317e-18    , 8.381202376987613e-19     , -7.943322587807574e-20    , 6.870841988158613e-21     , -5.4709125655690515e-22   , 4.100038077026457e-23     , -2.8140242232320264e-24   , },
+    /* x = 30.0        */  {7.09192561101597e-14      , -4.6342979506965286e-14   , 1.5792930223506156e-14    , -3.728330508147523e-15    , 6.834438388584541e-16     , -1.0340123432912294e-16   , 1.3404811413149802e-17    , -1.5268267828576778e-18   , 1.5553469720032242e-19    , -1.435786104755774e-20    , 1.2131603987529396e-21    , -9.460284258249008e-23    , 6.955942067517812e-24     , -4.696269526730654e-25    , },
+    /* x = 32.0        */  {1.9900648946984394e-14    , -1.2291935161837222e-14   , 3.968896407680979e-15     , -8.902570468338099e-16    , 1.555515158229507e-16     , -2.2508800058333816e-17   , 2.8008200744465535e-18    , -3.0730040885959346e-19   , 3.0259751937155263e-20    , -2.7091880898148683e-21   , 2.227083139560489e-22     , -1.6944607534551958e-23   , 1.2181058073594705e-24    , -8.064779058964985e-26    , },
+    /* x = 34.0        */  {5.985325662608369e-15     , -3.496683435584692e-15    , 1.069477686100897e-15     , -2.276725716025398e-16    , 3.7841162807251446e-17    , -5.222701879190172e-18    , 6.216750748820505e-19     , -6.545524149471644e-20    , 6.205247080514274e-21     , -5.366052921931581e-22    , 4.2741780151104876e-23    , -3.1604753237447238e-24   , 2.21292383524107e-25      , -1.4318335995905746e-26   , },
+    /* x = 36.0        */  {1.9195819319317724e-15    , -1.0623990369316922e-15   , 3.0809343318787193e-16    , -6.22591858347999e-17     , 9.837702662843246e-18     , -1.293221605318233e-18    , 1.469441767767062e-19     , -1.4806036338025378e-20   , 1.3469622537632163e-21    , -1.1210286367055062e-22   , 8.619406060466683e-24     , -6.170520196079111e-25    , 4.192110872319779e-26     , -2.6412404429423143e-27   , },
+  },
+  /* n = 21 */
+  {
+    /* x = 0.0         */  {0.00895244062745518       , -0.008537752904565066     , 0.0040798598834956715     , -0.0013022823231016584    , 0.00031232420460475805    , -6.002243854355916e-05    , 9.627269346058645e-06     , -1.3254392561392926e-06   , 1.5988053105934434e-07    , -1.7163639697043518e-08   , 1.65990767124893e-09      , -1.4612644870543463e-10   , 1.2020435833838127e-11    , -8.949593271467567e-13    , },
+    /* x = 2.0         */  {0.0013346583764458889     , -0.0012672069698848722    , 0.0006031037730795022     , -0.00019179684171163902   , 4.584168816392176e-05     , -8.782163809409259e-06    , 1.4045123646382834e-06    , -1.9284463146922977e-07   , 2.3203309323995924e-08    , -2.485098363780669e-09    , 2.3980856120082577e-10    , -2.106761072960653e-11    , 1.7295730871985967e-12    , -1.28539614994435e-13     , },
+    /* x = 4.0         */  {0.00020080341697760847    , -0.00018965999309516901   , 8.983763450984164e-05     , -2.844651074735041e-05    , 6.7721965028938895e-06    , -1.2926846001468784e-06   , 2.0604542322062767e-07    , -2.8203409003273778e-08   , 3.383755096514016e-09     , -3.61439413379756e-10     , 3.4791987468542344e-11    , -3.049459593726461e-12    , 2.4978880666069856e-13    , -1.8526480271090287e-14   , },
+    /* x = 6.0         */  {3.053943483589487e-05     , -2.8665266599211593e-05   , 1.3501965407497988e-05    , -4.253604556553455e-06    , 1.0079695657265033e-06    , -1.9159094217578725e-07   , 3.042028021174986e-08     , -4.1491091022573565e-09   , 4.961636241313992e-10     , -5.2837324414498016e-11   , 5.071772759989146e-12     , -4.433667302589446e-13    , 3.622555081241823e-14     , -2.680695652028894e-15    , },
+    /* x = 8.0         */  {4.704719776814169e-06     , -4.382952573129421e-06    , 2.0506406028925796e-06    , -6.421334498634333e-07    , 1.5133664392450777e-07    , -2.8623262996000905e-08   , 4.524239827769402e-09     , -6.145292562829811e-10    , 7.32090840555264e-11      , -7.768967093877585e-12    , 7.433288911516654e-13     , -6.478658204844783e-14    , 5.2782624192740155e-15    , -3.8958926289437954e-16   , },
+    /* x = 10.0        */  {7.360538098112479e-07     , -6.794824105289991e-07    , 3.153410837172102e-07     , -9.803303847860671e-08    , 2.2954569172081974e-08    , -4.316171164998512e-09    , 6.78607812374057e-10      , -9.173131967085783e-11    , 1.087987478902045e-11     , -1.1499158126476249e-12   , 1.0961495499412571e-13    , -9.521031107372165e-15    , 7.731567589406662e-16     , -5.690018308883974e-17    , },
+    /* x = 12.0        */  {1.1732589617726987e-07    , -1.0710323571698259e-07   , 4.921761923620783e-08     , -1.5167479495019584e-08   , 3.5238935330496074e-09    , -6.579859863332645e-10    , 1.0280242808743228e-10    , -1.381751194850301e-11    , 1.6303870930728517e-12    , -1.7150854277427045e-13   , 1.627861513504102e-14     , -1.4083533723150639e-15   , 1.1393604045956808e-16    , -8.357068045364064e-18    , },
+    /* x = 14.0        */  {1.913127763674376e-08     , -1.722475392927185e-08    , 7.820193438589119e-09     , -2.384421459586858e-09    , 5.48774428650426e-10      , -1.0161043893063827e-10   , 1.575648467626793e-11     , -2.1035348913323145e-12   , 2.4669437658152554e-13    , -2.5807754061346765e-14   , 2.43722045186908e-15      , -2.0988893129862377e-16   , 1.6906321986176035e-17    , -1.2352874964060089e-18   , },
+    /* x = 16.0        */  {3.207256864314969e-09     , -2.8386078816968217e-09   , 1.2696761395366937e-09    , -3.8210872514024324e-10   , 8.693699510456907e-11     , -1.5934192357313493e-11   , 2.4486146182027797e-12    , -3.24263317599994e-13     , 3.775315485632515e-14     , -3.923739385913971e-15    , 3.6835889102355623e-16    , -3.155187490310882e-17    , 2.5286235225150203e-18    , -1.8393411406796569e-19   , },
+    /* x = 18.0        */  {5.561566084744087e-10     , -4.818930980753236e-10    , 2.1161043389277106e-10    , -6.266922959817977e-11    , 1.4059163448084425e-11    , -2.545092022496592e-12    , 3.8684169469741005e-13    , -5.073169763616631e-14    , 5.8554035140017405e-15    , -6.038313861323261e-16    , 5.629076106296894e-17     , -4.791063856469414e-18    , 3.816903636697109e-19     , -2.762002207321537e-20    , },
+    /* x = 20.0        */  {1.0046519138744722e-10    , -8.480350444926282e-11    , 3.6403591159825644e-11    , -1.057016478663763e-11    , 2.330726591800101e-12     , -4.1558597331812835e-13   , 6.233038153916105e-14     , -8.07835919613569e-15     , 9.2267606248549e-16       , -9.426429047135395e-17    , 8.714289624204168e-18     , -7.361277316426753e-19    , 5.8235585142171e-20       , -4.188320846783772e-21    , },
+    /* x = 22.0        */  {1.9054780966870885e-11    , -1.558123446213976e-11    , 6.505834287817643e-12     , -1.843947922963329e-12    , 3.980995408000448e-13     , -6.968388435054979e-14    , 1.0282931960223986e-14    , -1.3137737687278823e-15   , 1.4816381606189896e-16    , -1.4967515611476397e-17   , 1.369855508236643e-18     , -1.1468055070499347e-19   , 8.997297487627065e-21     , -6.424181767425079e-22    , },
+    /* x = 24.0        */  {3.825185028155124e-12     , -3.0119002469141262e-12   , 1.2164756724616376e-12    , -3.348692311547862e-13    , 7.046967508005021e-14     , -1.2061156405323536e-14   , 1.7450280722131777e-15    , -2.1910780942986468e-16   , 2.4334023496742005e-17    , -2.425030358592165e-18    , 2.1927895344633183e-19    , -1.816062671813432e-20    , 1.4107303595974132e-21    , -9.98645995932595e-23     , },
+    /* x = 26.0        */  {8.187074080976787e-13     , -6.171275876233536e-13    , 2.397334502454675e-13     , -6.375128242757956e-14    , 1.301184276035931e-14     , -2.1677417780829533e-15   , 3.062579435675059e-16     , -3.7655371016464896e-17   , 4.105174143448935e-18     , -4.0244830839143534e-19   , 3.586514664480305e-20     , -2.932134255401454e-21    , 2.250821506770689e-22     , -1.5770610902063764e-23   , },
+    /* x = 28.0        */  {1.8785453297117044e-13    , -1.3488583367280407e-13   , 5.013358578050227e-14     , -1.2810892237441563e-14   , 2.523014190455415e-15     , -4.071555753382998e-16    , 5.591817257004453e-17     , -6.704957146787783e-18    , 7.148992487463538e-19     , -6.871713879926467e-20    , 6.017792757209088e-21     , -4.843940371645244e-22    , 3.665907116667298e-23     , -2.537209282012373e-24    , },
+    /* x = 30.0        */  {4.6342979506965286e-14    , -3.1585860447013025e-14   , 1.1184991524442312e-14    , -2.7337753554110226e-15   , 5.170061716490197e-16     , -8.04288686841045e-17     , 1.0687787463657377e-17    , -1.2442767956762969e-18   , 1.2922078445947633e-19    , -1.2133037804576385e-20   , 1.0405970126071422e-21    , -8.221976587995567e-23    , 6.1176078941594136e-24    , -4.1723822979371385e-25   , },
+    /* x = 32.0        */  {1.2291935161837223e-14    , -7.937792815362079e-15    , 2.6707711405013874e-15    , -6.222060632879564e-16    , 1.1254400029223475e-16    , -1.6804920481307126e-17   , 2.1511028593016395e-18    , -2.420778835506231e-19    , 2.4382698627864356e-20    , -2.2273250884679717e-21   , 1.8638499221619663e-22    , -1.4406080256538544e-23   , 1.0504907482536945e-24    , -7.040607427304649e-26    , },
+    /* x = 34.0        */  {3.496683435584692e-15     , -2.138955372201815e-15    , 6.830177148076122e-16     , -1.5136465122833685e-16   , 2.611350939604743e-17     , -3.730050455314419e-18    , 4.58186689999437e-19      , -4.964195369748599e-20    , 4.8294486232145586e-21    , -4.274598781826384e-22    , 3.4764257086835785e-23    , -2.61878143118591e-24     , 1.8649165422103112e-25    , -1.2244001710464393e-26   , },
+    /* x = 36.0        */  {1.0623990369316922e-15    , -6.161868663757476e-16    , 1.8677755750439841e-16    , -3.9350810651252523e-17   , 6.466108026608181e-18     , -8.816650617446746e-19    , 1.0364225428449248e-19    , -1.077569389801094e-20    , 1.0089259480906406e-21    , -8.620163746878684e-23    , 6.787401037315113e-24     , -4.96439781667416e-25     , 3.4398376322232655e-26    , -2.204786101597772e-27    , },
+  },
+  /* n = 22 */
+  {
+    /* x = 0.0         */  {0.008537752904565073      , -0.008159719766992826     , 0.003906846969304398      , -0.0012492968183715628    , 0.0003001121927254836     , -5.776361650372999e-05    , 9.27807475606825e-06      , -1.279042619905164e-06    , 1.5447283636854949e-07    , -1.6602063117235397e-08   , 1.6073135909422238e-09    , -1.4163840844507373e-10   , 1.1662598862607466e-11    , -8.690828895892791e-13    , },
+    /* x = 2.0         */  {0.0012672069698848733     , -0.001206207546159217     , 0.0005753905251348345     , -0.0001833667526488808    , 4.39108190481468e-05      , -8.427074249107585e-06    , 1.3499124150014165e-06    , -1.8562624108630842e-07   , 2.2365896596459105e-08    , -2.3985138048863922e-09   , 2.317326461560523e-10     , -2.0381109307464787e-11   , 1.6750414463971293e-12    , -1.2460959530669603e-13   , },
+    /* x = 4.0         */  {0.00018965999309516918    , -0.00017967526901971386   , 8.533953224203939e-05     , -2.708878601059644e-05    , 6.463423000892422e-06     , -1.2362725481389607e-06   , 1.9742386226426124e-07    , -2.7070007180942036e-08   , 3.252956346294687e-09     , -3.479814727137784e-10    , 3.354246563497318e-11     , -2.9436970595568643e-12   , 2.4142243291048605e-13    , -1.7925790586132945e-14   , },
+    /* x = 6.0         */  {2.8665266599211614e-05    , -2.7003930815000393e-05   , 1.2760813669658658e-05    , -4.031878262764641e-06    , 9.57954710901708e-07      , -1.825216825432949e-07    , 2.904376360648151e-08     , -3.969304142942657e-09    , 4.755361540144696e-10     , -5.072662151024112e-11    , 4.87680493367467e-12      , -4.269431643147432e-13    , 3.4932358782001224e-14    , -2.5882347020676476e-15   , },
+    /* x = 8.0         */  {4.382952573129424e-06     , -4.1012812057858e-06      , 1.926400349590053e-06     , -6.053465756775346e-07    , 1.4311631498329858e-07    , -2.7145439151148874e-08   , 4.301704778167123e-09     , -5.856719692666772e-10    , 6.99207377353638e-11      , -7.434578365482196e-12    , 7.126192620918815e-13     , -6.221359269473423e-14    , 5.0767124257024885e-15    , -3.7524600874212915e-16   , },
+    /* x = 10.0        */  {6.794824105289996e-07     , -6.306821674345136e-07    , 2.9409911543578425e-07    , -9.18182766853425e-08     , 2.1580855825471135e-08    , -4.071646901122215e-09    , 6.421192353985259e-10     , -8.703889589175261e-11    , 1.034924723755749e-11     , -1.0963373634739345e-12   , 1.0472652742055193e-13    , -9.113939997654728e-15    , 7.41453337907964e-16      , -5.465581450079546e-17    , },
+    /* x = 12.0        */  {1.0710323571698265e-07    , -9.84352384724293e-08     , 4.550243848505351e-08     , -1.4095574131761318e-08   , 3.2899299317361916e-09    , -6.168145724599584e-10    , 9.672258330410294e-11     , -1.3043081748565801e-11   , 1.5435776038028946e-12    , -1.6281365027700877e-13   , 1.549118417005656e-14     , -1.3432288915354422e-15   , 1.0889751354357855e-16    , -8.002476079972466e-18    , },
+    /* x = 14.0        */  {1.722475392927186e-08     , -1.564038687718025e-08    , 7.153264378759804e-09     , -2.195097714537323e-09    , 5.080521946634482e-10     , -9.453890863723718e-11    , 1.4724744190086144e-11    , -1.973552803931764e-12    , 2.322698920783891e-13     , -2.4376254751096624e-14   , 2.3086750535518643e-15    , -1.9934045245907278e-16   , 1.609626423322556e-17     , -1.1786575107210778e-18   , },
+    /* x = 16.0        */  {2.838607881696823e-09     , -2.5393522790736857e-09   , 1.146326175420616e-09     , -3.4774798040872934e-10   , 7.967096178808269e-11     , -1.469168779516897e-11    , 2.2698432159258834e-12    , -3.0202491132385703e-13   , 3.53136700622696e-14      , -3.684189510130124e-15    , 3.4705537992060816e-16    , -2.9819224747986694e-17   , 2.396687182710328e-18     , -1.7478004341178947e-19   , },
+    /* x = 18.0        */  {4.818930980753238e-10     , -4.2322086778558674e-10   , 1.880076887945224e-10     , -5.623665379091093e-11    , 1.2725460112708413e-11    , -2.3210501810297155e-12   , 3.551218823708399e-13     , -4.684317916445294e-14    , 5.4344847947142476e-15    , -5.629973677119069e-16    , 5.2699434237156345e-17    , -4.5019364447132726e-18   , 3.5988514346479893e-19    , -2.6120053750669215e-20   , },
+    /* x = 20.0        */  {8.480350444926286e-11     , -7.280718231965801e-11    , 3.171049435991035e-11     , -9.322906366985253e-12    , 2.0779298666244656e-12    , -3.7398229117197136e-13   , 5.654851421057174e-14     , -7.381401118837525e-15    , 8.483789622334419e-16     , -8.715643113012781e-17    , 8.097064759373505e-18     , -6.870125956037152e-19    , 5.457192161965937e-20     , -3.9387513861226565e-21   , },
+    /* x = 22.0        */  {1.5581234462139764e-11    , -1.301166857563631e-11    , 5.531843768889604e-12     , -1.592398163167395e-12    , 3.4841942175787227e-13    , -6.169759205650036e-14    , 9.196416356499917e-15     , -1.1853094037915194e-15   , 1.3470769321314347e-16    , -1.3700617486471844e-17   , 1.2614345146455232e-18    , -1.0616732812565196e-19   , 8.37018063569642e-21      , -6.001723715605858e-22    , },
+    /* x = 24.0        */  {3.0119002469141267e-12    , -2.432951344923433e-12    , 1.0046076934642998e-12    , -2.8187870031514396e-13   , 6.030578202740239e-14     , -1.0470168478805827e-14   , 1.5337546622419587e-15    , -1.9467201449327352e-16   , 2.1825281300540673e-17    , -2.1931076504294126e-18   , 1.997589993994521e-19     , -1.6651086311388434e-20   , 1.3011107321819923e-21    , -9.25733048398213e-23     , },
+    /* x = 26.0        */  {6.171275876233538e-13     , -4.794669004909598e-13    , 1.9125384728272958e-13    , -5.2047371040646004e-14   , 1.0838708890536528e-14    , -1.83754766852844e-15     , 2.635875965307255e-16     , -3.284136600382415e-17    , 3.62203602821717e-18      , -3.5870124050672204e-19   , 3.225225184673589e-20     , -2.6575390027690434e-21   , 2.0546341485040952e-22    , -1.448441990061873e-23    , },
+    /* x = 28.0        */  {1.348858336728041e-13     , -1.0026717156100846e-13   , 3.843267671232325e-14     , -1.0092056761695759e-14   , 2.0357778767106824e-15    , -3.355090365537319e-16    , 4.693469993542209e-17     , -5.7191896709188154e-18   , 6.184544465547639e-19     , -6.018584747140425e-20    , 5.328141416805168e-21     , -4.329957509306209e-22    , 3.3053904556726286e-23    , -2.304703639842124e-24    , },
+    /* x = 30.0        */  {3.1585860447013025e-14    , -2.2369983048885262e-14   , 8.201326066232838e-15     , -2.0680246865756455e-15   , 4.021443434235995e-16     , -6.412672496590471e-17    , 8.709937554962777e-18     , -1.0337655747009222e-18   , 1.0919737189720497e-19    , -1.0407255506550166e-20   , 9.043864695460636e-22     , -7.228931911921122e-23    , 5.435354182310104e-24     , -3.7404518782331704e-25   , },
+    /* x = 32.0        */  {7.937792815362079e-15     , -5.3415422810028804e-15   , 1.8666181898638314e-15    , -4.501760011655444e-16    , 8.402460240703966e-17     , -1.29066171863697e-17     , 1.694545182434709e-18     , -1.9506147257637465e-19   , 2.0045930981698593e-20    , -1.864063449519209e-21    , 1.5846181215498702e-22    , -1.2419507256418965e-23   , 9.171229696425549e-25     , -6.213586552066884e-26    , },
+    /* x = 34.0        */  {2.1389553722018153e-15    , -1.3660354296152426e-15   , 4.540939536850042e-16     , -1.0445403758361022e-16   , 1.865025227665672e-17     , -2.7491201452135834e-18   , 3.4749367547614687e-19    , -3.863556910694232e-20    , 3.84713977427457e-21      , -3.4767902224055266e-22   , 2.8805744392144605e-23    , -2.2060826865870258e-24   , 1.5948162481687592e-25    , -1.0607147980600436e-26   , },
+    /* x = 36.0        */  {6.161868663757476e-16     , -3.7355511500880003e-16   , 1.1805243195375647e-16    , -2.5864432106330616e-17   , 4.408325308737996e-18     , -6.21853526626203e-19     , 7.542985721587903e-20     , -8.071404082040712e-21    , 7.758148876564963e-22     , -6.788043314171886e-23    , 5.46069049271209e-24      , -4.071743319183415e-25    , 2.871571569201583e-26     , -1.8689701954847406e-27   , },
+  },
+  /* n = 23 */
+  {
+    /* x = 0.0         */  {0.008159719766992833      , -0.007813693938610238     , 0.003747890455114127      , -0.001200448770855799     , 0.00028881808252612757    , -5.566844895177681e-05    , 8.953298303438265e-06     , -1.2357811081465765e-06   , 1.4941864498807746e-07    , -1.6076038388124122e-08   , 1.5579472624183266e-09    , -1.3741762276849053e-10   , 1.132543626583653e-11     , -8.446597749218558e-13    , },
+    /* x = 2.0         */  {0.0012062075461592178     , -0.0011507810502698753    , 0.0005501002579465622     , -0.00017564327618598295   , 4.213537124660671e-05     , -8.099474549468076e-06    , 1.2993836824732419e-06    , -1.7892694619475001e-07   , 2.158663524007136e-08     , -2.317741948976959e-09    , 2.24181449628281e-10      , -1.9737820042013443e-11   , 1.623835139708729e-12     , -1.2091221708399863e-13   , },
+    /* x = 4.0         */  {0.000179675269019714      , -0.0001706790644841084    , 8.126635803177783e-05     , -2.585369200262133e-05    , 6.1813627408480195e-06    , -1.184543182123826e-06    , 1.8949004953105348e-07    , -2.60236182344624e-08     , 3.1318348307645433e-09    , -3.354843192868015e-10    , 3.237912619894718e-11     , -2.8449896873337716e-12   , 2.335958512150231e-13     , -1.7362666718950393e-14   , },
+    /* x = 6.0         */  {2.700393081500041e-05     , -2.5521627339321585e-05   , 1.209563478829227e-05     , -3.831818843470176e-06    , 9.126084127385108e-07     , -1.7426258286922526e-07   , 2.7785128894809346e-08    , -3.804284543800435e-09    , 4.565398203094747e-10     , -4.8776646562201544e-11   , 4.696153107475503e-12     , -4.1168383150263553e-13   , 3.372767562121327e-14     , -2.5018977187980607e-15   , },
+    /* x = 8.0         */  {4.101281205785802e-06     , -3.852800699180723e-06    , 1.8160397270323652e-06    , -5.724652599134262e-07    , 1.357271957589253e-07     , -2.5810228846977424e-08   , 4.0997037695960636e-09    , -5.593652236939088e-10    , 6.691123801596428e-11     , -7.127436252769065e-12    , 6.843175172785537e-13     , -5.983499011435246e-14    , 4.889836245153282e-15     , -3.619115491776335e-16    , },
+    /* x = 10.0        */  {6.30682167434514e-07      , -5.881982308716582e-07    , 2.7545483005599295e-07    , -8.632342329901257e-08    , 2.0358234506072118e-08    , -3.852715438247926e-09    , 6.092722690289614e-10     , -8.279387937097315e-11    , 9.867041014606546e-12     , -1.0474459528638116e-12   , 1.0024870160808877e-13    , -8.739726845497155e-15    , 7.122123981932634e-16     , -5.257953724108118e-17    , },
+    /* x = 12.0        */  {9.843523847242937e-08     , -9.100487697012011e-08    , 4.228672239527892e-08     , -1.3159719726525475e-08   , 3.08407286236692e-09      , -5.803355035995433e-10    , 9.130157191769987e-11     , -1.2348606445759085e-11   , 1.4653235431301205e-12    , -1.549382195780171e-13    , 1.4774842454662086e-14    , -1.2837451099492191e-15   , 1.0427779066328086e-16    , -7.676247306415187e-18    , },
+    /* x = 14.0        */  {1.5640386877180256e-08    , -1.430652875752153e-08    , 6.585293143611232e-09     , -2.0322087785922402e-09   , 4.726945431960103e-10     , -8.834846569468225e-11    , 1.3814869580358537e-11    , -1.858157024937919e-12    , 2.193863938365817e-13     , -2.3090622840357364e-14   , 2.192646137364312e-15     , -1.8977506854048436e-16   , 1.5358492107978434e-17    , -1.1268802236042734e-18   , },
+    /* x = 16.0        */  {2.539352279073687e-09     , -2.2926523508415163e-09   , 1.0432439412260796e-09    , -3.186838471432378e-10    , 7.34584389772911e-11      , -1.3619059377420152e-11   , 2.1141743723240305e-12    , -2.8250904854650763e-13   , 3.315772047062936e-14     , -3.4711258389028984e-15   , 3.279969220896802e-16     , -2.8260918193982746e-17   , 2.2774319281550124e-18    , -1.664690004558298e-19    , },
+    /* x = 18.0        */  {4.232208677855869e-10     , -3.7601537758908704e-10   , 1.6870996137271673e-10    , -5.0901840449480687e-11   , 1.1605250905362902e-11    , -2.1307313064058402e-12   , 3.279022531222757e-13     , -4.3475831942034583e-14   , 5.066978514427263e-15     , -5.27079456732218e-16     , 4.951914467583187e-17     , -4.244326314746521e-18    , 3.4034483682035725e-19    , -2.47690236544316e-20     , },
+    /* x = 20.0        */  {7.280718231965803e-11     , -6.342098871982705e-11    , 2.796871910095336e-11     , -8.311719466294882e-12    , 1.869911455891861e-12     , -3.3929108709087566e-13   , 5.1669807678221124e-14    , -6.7870247342935415e-15   , 7.844082094393768e-16     , -8.098341696344689e-17    , 7.556816571405158e-18     , -6.437168328797976e-19    , 5.1320860555278234e-20    , -3.715986953623969e-21    , },
+    /* x = 22.0        */  {1.3011668575636315e-11    , -1.1063687537780167e-11   , 4.777194489501823e-12     , -1.3936776870007438e-12   , 3.084879602873231e-13     , -5.517849841579986e-14    , 8.297165803395316e-15     , -1.0776604909460897e-15   , 1.2330560698078152e-16    , -1.2616279293711496e-17   , 1.1677921047865614e-18    , -9.875387737829752e-20    , 7.81988018015443e-21      , -5.628500717609017e-22    , },
+    /* x = 24.0        */  {2.432951344923434e-12     , -2.0092153869287465e-12   , 8.45636100945377e-13      , -2.412231281049005e-13    , 5.235084239476287e-14     , -9.20252801584725e-15     , 1.3627040979305073e-15    , -1.74602088855078e-16     , 1.973797640269644e-17     , -1.9978862315128526e-18   , 1.8315456769229738e-19    , -1.5354747745756323e-20   , 1.2061374273786156e-21    , -8.620679135332224e-23    , },
+    /* x = 26.0        */  {4.794669004909599e-13     , -3.82507694565482e-13     , 1.5614211312192954e-13    , -4.3354835561415425e-14   , 9.187738342755196e-15     , -1.5815255857627016e-15   , 2.2988956148431437e-16    , -2.897626315884774e-17    , 3.2283123270874216e-18    , -3.2256848420507903e-19   , 2.923179223819902e-20     , -2.4254383161999823e-21   , 1.88710867797362e-22      , -1.337622606048921e-23    , },
+    /* x = 28.0        */  {1.0026717156100848e-13    , -7.68653534246501e-14     , 3.0276170285085956e-14    , -8.14311150672761e-15     , 1.6775451827863037e-15    , -2.816082006489437e-16    , 4.0034327611727767e-17    , -4.947631623196115e-18    , 5.416728087701523e-19     , -5.3288655958914365e-20   , 4.7627757514028906e-21    , -3.9032564512025608e-22   , 3.0025700611065216e-23    , -2.1073804807911134e-24   , },
+    /* x = 30.0        */  {2.2369983048885266e-14    , -1.6402652132466253e-14   , 6.204074059726726e-15     , -1.6085773736759331e-15   , 3.206336248323238e-16     , -5.2259625496012235e-17   , 7.236359009463482e-18     , -8.735783417406342e-19    , 9.36653283682949e-20      , -9.045026234617147e-21    , 7.951543387965412e-22     , -6.421037018416873e-23    , 4.8728323498994935e-24    , -3.380088314700646e-25    , },
+    /* x = 32.0        */  {5.341542281002881e-15     , -3.7332363797277576e-15   , 1.3505280034965994e-15    , -3.3609840962513396e-16   , 6.453308593230147e-17     , -1.0167271121838695e-17   , 1.365430305860113e-18     , -1.6036734409320605e-19   , 1.6776575705806695e-20    , -1.5848083869806914e-21   , 1.3661002286868202e-22    , -1.0839398119071785e-23   , 8.094234393448576e-25     , -5.536698209784618e-26    , },
+    /* x = 34.0        */  {1.3660354296152426e-15    , -9.081879073700244e-16    , 3.1336211275082507e-16    , -7.460100910611904e-17    , 1.3745600726142841e-17    , -2.084962057428776e-18    , 2.7044898338890944e-19    , -3.0777100773314204e-20   , 3.1291119709983142e-21    , -2.8808938841796555e-22   , 2.4266155788011245e-23    , -1.8858961458321016e-24   , 1.3816703831691794e-25    , -9.295725303130933e-27    , },
+    /* x = 36.0        */  {3.7355511500880003e-16    , -2.361048639075157e-16    , 7.759329631899088e-17     , -1.7633301234864237e-17   , 3.1092676331437354e-18    , -4.525791440852516e-19    , 5.64998285132182e-20      , -6.2065160911223315e-21   , 6.109240291453681e-22     , -5.461242453627641e-23    , 4.478789679417066e-24     , -3.3977071972964463e-25   , 2.4343150731953218e-26    , -1.6061692023493879e-27   , },
+  },
+  /* n = 24 */
+  {
+    /* x = 0.0         */  {0.007813693938610245      , -0.007495780910229656     , 0.003601346312566851      , -0.001155272330059636     , 0.00027834224476616274    , -5.3719790224642305e-05   , 8.650467722083407e-06     , -1.195347620370074e-06    , 1.446844203788755e-07     , -1.5582295762042593e-08   , 1.5115206218634843e-09    , -1.3344092725901678e-10   , 1.100720776136307e-11     , -8.215709653532256e-13    , },
+    /* x = 2.0         */  {0.0011507810502698764     , -0.0011002005158933248    , 0.000526929828557871      , -0.0001685414849800129    , 4.049737274837922e-05     , -7.79630215258529e-06     , 1.2524886183760941e-06    , -1.726928618739294e-07    , 2.0859688228793544e-08    , -2.242218008889258e-09    , 2.1710556898173258e-10    , -1.9133797016283374e-11   , 1.575659660658826e-12     , -1.1742745975846653e-13   , },
+    /* x = 4.0         */  {0.00017067906448410853    , -0.00016253271606358439   , 7.756107600785284e-05     , -2.472545096247261e-05    , 5.922715910767815e-06     , -1.1369403054644447e-06   , 1.8216532692744894e-07    , -2.5054647101475594e-08   , 3.0193604033032994e-09    , -3.238491072305171e-10    , 3.129339069104219e-11     , -2.7526573482156117e-12   , 2.2625866278341558e-13    , -1.683370497409747e-14    , },
+    /* x = 6.0         */  {2.5521627339321606e-05    , -2.419126957658867e-05    , 1.1495456530408928e-05    , -3.6504336508218012e-06   , 8.713129143674729e-07     , -1.6671077455945673e-07   , 2.6629991704124928e-08    , -3.652314025574153e-09    , 4.3899003868106514e-10    , -4.696985064833032e-11    , 4.528307385520036e-12     , -3.974699916847421e-13    , 3.260277138786053e-14     , -2.4210993419237197e-15   , },
+    /* x = 8.0         */  {3.852800699180726e-06     , -3.6320794540653267e-06   , 1.7173957797400481e-06    , -5.42908783016612e-07     , 1.290511442379624e-07     , -2.4598222789439304e-08   , 3.915556551094e-09        , -5.352892492277485e-10    , 6.414695791432587e-11     , -6.844376098889643e-12    , 6.58153952047611e-13      , -5.762975309488803e-14    , 4.7161016413004174e-15    , -3.494839497469244e-16    , },
+    /* x = 10.0        */  {5.881982308716586e-07     , -5.509096601120723e-07    , 2.5897026989700436e-07    , -8.143293802152172e-08    , 1.926357719168436e-08     , -3.655633639083257e-09    , 5.795571534617966e-10     , -7.893623319699773e-11    , 9.427018151330107e-12     , -1.0026610756692306e-12   , 9.613252100543871e-14     , -8.394613238160943e-15    , 6.851611272671397e-16     , -5.065335796575265e-17    , },
+    /* x = 12.0        */  {9.100487697012016e-08     , -8.457344479057043e-08    , 3.947915917957159e-08     , -1.2336291449064837e-08   , 2.901677518062308e-09     , -5.478094351330504e-10    , 8.644024481023217e-11     , -1.1722574524616031e-11   , 1.394444640737936e-12     , -1.4777376776713406e-13   , 1.4120546380652325e-14    , -1.2292115676607143e-15   , 1.0002753468769074e-16    , -7.375158377629516e-18    , },
+    /* x = 14.0        */  {1.4306528757521538e-08    , -1.3170586287224306e-08   , 6.096626335776014e-09     , -1.890778172725084e-09    , 4.417423284828375e-10     , -8.288921801295048e-11    , 1.3007099129313163e-11    , -1.755089128039988e-12    , 2.0781570254333924e-13    , -2.1930170410722808e-14   , 2.087430920156699e-15     , -1.810643160847932e-16    , 1.468393058172819e-17     , -1.079368872752669e-18    , },
+    /* x = 16.0        */  {2.2926523508415176e-09    , -2.08648788245243e-09     , 9.560515414296097e-10     , -2.938337559004853e-10    , 6.80952968884839e-11      , -1.2685046312082774e-11   , 1.9775633331855796e-12    , -2.6526146601225443e-13   , 3.124014678024211e-14     , -3.2805152239560207e-15   , 3.10856184961816e-16      , -2.68525819352198e-17     , 2.169157456635119e-18     , -1.5889229824564415e-19   , },
+    /* x = 18.0        */  {3.7601537758908724e-10    , -3.3741992274547363e-10   , 1.5270552134842675e-10    , -4.642100362016543e-11    , 1.0653656532233409e-11    , -1.9674135303131636e-12   , 3.0433082261390695e-13    , -4.0535783990942626e-14   , 4.743717211542823e-15     , -4.95272359721943e-16     , 4.6685535009347006e-17    , -4.013509931799667e-18    , 3.227444382072371e-19     , -2.3546415647903444e-20   , },
+    /* x = 20.0        */  {6.342098871982707e-11     , -5.5937438201912723e-11   , 2.493515839888237e-11     , -7.479645823375385e-12    , 1.6964554354847413e-12    , -3.10018847798452e-13     , 4.750917299429233e-14     , -6.275259086585215e-15    , 7.288510650537986e-16     , -7.558024809809202e-17    , 7.080579693022085e-18     , -6.053037516040154e-19    , 4.841891830894166e-20     , -3.516074809627154e-21    , },
+    /* x = 22.0        */  {1.1063687537780172e-11    , -9.55438897900455e-12     , 4.1810330610018904e-12    , -1.2339518411203596e-12   , 2.7589249208355057e-13    , -4.9782995080854905e-14   , 7.543623414773534e-15     , -9.864438632635742e-16    , 1.135465604680376e-16     , -1.1679741182574961e-17   , 1.0862468629559924e-18    , -9.224979014926507e-20    , 7.333702437575485e-21     , -5.296727058343395e-22    , },
+    /* x = 24.0        */  {2.0092153869287473e-12    , -1.6912722018908914e-12   , 7.236693843146499e-13     , -2.094033695746483e-13    , 4.601264007992487e-14     , -8.1762246272249e-15      , 1.2222146186797213e-15    , -1.5790366016487372e-16   , 1.7980983168296477e-17    , -1.8318226743724645e-18   , 1.688952973430307e-19     , -1.4231862132547006e-20   , 1.1232076964614924e-21    , -8.060801163292104e-23    , },
+    /* x = 26.0        */  {3.825076945654821e-13     , -3.1228422624388024e-13   , 1.3006450668423837e-13    , -3.6750953370342686e-14   , 7.907627928918834e-15     , -1.379337375010747e-15    , 2.0283384160630336e-16    , -2.582647535399098e-17    , 2.90311744145683e-18      , -2.92360579826839e-19     , 2.667876185409653e-20     , -2.227295445247894e-21    , 1.7427628489784107e-22    , -1.2413532792268994e-23   , },
+    /* x = 28.0        */  {7.686535342465011e-14     , -6.055234057017522e-14    , 2.4429334520181605e-14    , -6.710180731039331e-15    , 1.4080410032610328e-15    , -2.4020596662363125e-16   , 3.4633421284053173e-17    , -4.3333788377395885e-18   , 4.795980714757991e-19     , -4.7634418360070875e-20   , 4.29341796641328e-21      , -3.5449428234085728e-22   , 2.7455634169849667e-23    , -1.9383302380644873e-24   , },
+    /* x = 30.0        */  {1.6402652132466256e-14    , -1.2408148119453977e-14   , 4.825732121027607e-15     , -1.2825344993124907e-15   , 2.6129812748262575e-16    , -4.3418154208068156e-17   , 6.1150483798727825e-18    , -7.493220504678424e-19    , 8.140526249642802e-20     , -7.952600484431899e-21    , 7.062882712804295e-22     , -5.755127184963973e-23    , 4.403497565792351e-24     , -3.076170904834434e-25    , },
+    /* x = 32.0        */  {3.7332363797277576e-15    , -2.7010560069932836e-15   , 1.0082952288753712e-15    , -2.581323437264876e-16    , 5.083635560960365e-17     , -8.19258185963243e-18     , 1.1225714066833435e-18    , -1.3421251239760432e-19   , 1.4263279702755407e-20    , -1.3662712196113807e-21   , 1.1922925281134758e-22    , -9.563827587902869e-24    , 7.212714168589626e-25     , -4.975834823719289e-26    , },
+    /* x = 34.0        */  {9.081879073700244e-16     , -6.267242255016641e-16    , 2.238030273183521e-16     , -5.498240290412174e-17    , 1.0424810287210823e-17    , -1.622693904381307e-18    , 2.154397050918278e-19     , -2.5032880343874204e-20   , 2.592805184484052e-21     , -2.426898410149797e-22    , 2.074418413162755e-23     , -1.6333169264738907e-24   , 1.2108934474143543e-25    , -8.230325916976206e-27    , },
+    /* x = 36.0        */  {2.361048639075157e-16     , -1.5518659263798416e-16   , 5.2899903704591865e-17    , -1.2437070532498605e-17   , 2.262895720437445e-18     , -3.3899897176653685e-19   , 4.3445612584151444e-20    , -4.887389614538332e-21    , 4.91511935919569e-22      , -4.4792698527844576e-23   , 3.737365372605865e-24     , -2.8792653428836795e-25   , 2.0921127590614312e-26    , -1.3972806541187133e-27   , },
+  },
+  /* n = 25 */
+  {
+    /* x = 0.0         */  {0.007495780910229663      , -0.007202692625135066     , 0.0034658169901783764     , -0.0011133689790209706    , 0.0002685989511303015     , -5.190280672576246e-05    , 8.367433308553653e-06     , -1.1574738644625871e-06   , 1.4024073480300797e-07    , -1.5117954235301728e-08   , 1.4677788694282794e-09    , -1.296877576101958e-10    , 1.0706362941710175e-11    , -7.997100861907451e-13    , },
+    /* x = 2.0         */  {0.0011002005158933256     , -0.0010538596571159366    , 0.000505624454939963      , -0.00016198949098728265   , 3.8981510763936976e-05    , -7.514931766384481e-06    , 1.20885002826629e-06      , -1.668772919488763e-07    , 2.0179972476671848e-08    , -2.1714478971247853e-09   , 2.104616005826502e-10     , -1.856555952046484e-11    , 1.5302542135010645e-12    , -1.1413753157536667e-13   , },
+    /* x = 4.0         */  {0.0001625327160635845     , -0.00015512215201573355   , 7.4176352887407e-05       , -2.3690863642178987e-05   , 5.684701527466636e-06     , -1.0929919695980052e-06   , 1.7538252901704912e-07    , -2.4154852614652766e-08   , 2.9146434508466256e-09    , -3.12990041520749e-10     , 3.027777793803013e-11     , -2.6661042734009684e-12   , 2.193665308310976e-13     , -1.633589937764463e-14    , },
+    /* x = 6.0         */  {2.419126957658869e-05     , -2.2990913060821857e-05   , 1.0951300952463851e-05    , -3.485251657341788e-06    , 8.335538728179821e-07     , -1.5977995137808607e-07   , 2.5566198079652244e-08    , -3.511915914543273e-09    , 4.227288687884467e-10     , -4.529113304543575e-11    , 4.371961667707305e-12     , -3.8419842570638737e-13   , 3.155002133684585e-14     , -2.345326118261153e-15    , },
+    /* x = 8.0         */  {3.6320794540653297e-06    , -3.434791559480673e-06    , 1.628726349049613e-06     , -5.162045769333945e-07    , 1.2299111395017285e-07    , -2.3493339472717513e-08   , 3.747024730305832e-09     , -5.131750301705057e-10    , 6.15994155115421e-11      , -6.5827005522162484e-12   , 6.338973401710276e-13     , -5.557976101276475e-14    , 4.554180881153989e-15     , -3.378744611890167e-16    , },
+    /* x = 10.0        */  {5.509096601120726e-07     , -5.17940539794092e-07     , 2.442988140645329e-07     , -7.705430876406855e-08    , 1.827816819584581e-08     , -3.4773429447991656e-09   , 5.525536303169691e-10     , -7.541605364824755e-11    , 9.023954100132885e-12     , -9.614931129782626e-13    , 9.233642430756055e-14     , -8.075372035241109e-15    , 6.600651625088567e-16     , -4.8861737987320755e-17   , },
+    /* x = 12.0        */  {8.457344479057048e-08     , -7.895831835915527e-08    , 3.700887434718984e-08     , -1.1606710071861613e-08   , 2.7390471757274883e-09    , -5.186414723511772e-10    , 8.205802137353574e-11     , -1.1155543827774327e-11   , 1.3299645502125126e-12    , -1.4122984928143858e-13   , 1.352070110662523e-14     , -1.1790444945725418e-15   , 9.610476302714713e-17     , -7.096450446138953e-18    , },
+    /* x = 14.0        */  {1.3170586287224314e-08    , -1.2193252671553795e-08   , 5.672334518174573e-09     , -1.7669693138747822e-09   , 4.144460900738109e-10     , -7.804259528516565e-11    , 1.2285623852793018e-11    , -1.6625236796678852e-12   , 1.9737162689328803e-13    , -2.087786792167344e-14    , 1.9916163427286408e-15    , -1.73100786481326e-16     , 1.406493762063471e-17     , -1.0356261505291009e-18   , },
+    /* x = 16.0        */  {2.0864878824524312e-09    , -1.9121030828594783e-09   , 8.815012677013566e-10     , -2.7238118754563525e-10   , 6.342523156173904e-11     , -1.1865380073842158e-11   , 1.8568302557240535e-12    , -2.4992088948259427e-13   , 2.9524650649416045e-14    , -3.1090840264194516e-15   , 2.9536506921808566e-16    , -2.557408570642922e-17    , 2.0704482755080848e-18    , -1.5195880502089396e-19   , },
+    /* x = 18.0        */  {3.374199227454738e-10     , -3.0541104269689176e-10   , 1.3926301086048167e-10    , -4.2614626127708166e-11   , 9.837067651760797e-12     , -1.8259849467164616e-12   , 2.8375048700057366e-13    , -3.7949695650255693e-14   , 4.4574532434896896e-15    , -4.669324445602247e-16    , 4.4146647655178406e-17    , -3.805638225398613e-18    , 3.068167651157408e-19     , -2.2435229037534787e-20   , },
+    /* x = 20.0        */  {5.593743820191275e-11     , -4.987031679777043e-11    , 2.2438937470123987e-11    , -6.785821741756754e-12    , 1.5500942390211362e-12    , -2.8505503960620875e-13   , 4.392681346747223e-14     , -5.8308022693766165e-15   , 6.802225299679348e-16     , -7.081725974934864e-17    , 6.658050757954818e-18     , -5.710212471542949e-19    , 4.581462043572223e-20     , -3.335781550221564e-21    , },
+    /* x = 22.0        */  {9.554388979004554e-12     , -8.362066122004634e-12    , 3.701855523360756e-12     , -1.1035699683068898e-12   , 2.4891497540858314e-13    , -4.5261740734536684e-14   , 6.905107022160775e-15     , -9.083715467466914e-16    , 1.05117714971452e-16      , -1.0864186837978475e-17   , 1.0147043445189769e-18    , -8.650462588100364e-20    , 6.901508953566471e-21     , -5.000123198583007e-22    , },
+    /* x = 24.0        */  {1.691272201890892e-12     , -1.4473387686294288e-12   , 6.282101087238962e-13     , -1.8405056031556701e-13   , 4.088112313677295e-14     , -7.33328774928281e-15     , 1.105325618041144e-15     , -1.4384772357713353e-16   , 1.6486410740737062e-17    , -1.6892129405330217e-18   , 1.5654395974189407e-19    , -1.3251570637386663e-20   , 1.0502765887019286e-21    , -7.56522348506782e-23     , },
+    /* x = 26.0        */  {3.1228422624388034e-13    , -2.601290133684965e-13    , 1.1025286011102067e-13    , -3.163051171504327e-14    , 6.896686875152301e-15     , -1.2170030553282759e-15   , 1.8078532700475586e-16    , -2.3224917848002448e-17   , 2.6312462325106476e-18    , -2.668273804932099e-19    , 2.4499258275651848e-20    , -2.0566078304119357e-21   , 1.6173654276880815e-22    , -1.1570958675974955e-23   , },
+    /* x = 28.0        */  {6.055234057017523e-14     , -4.885866904036627e-14    , 2.0130542193116856e-14    , -5.632164012946228e-15    , 1.2010298331333123e-15    , -2.0780052858573702e-16   , 3.033365179141754e-17     , -3.836781213149092e-18    , 4.287099211706942e-19     , -4.2940338514627567e-20   , 3.8992846274677435e-21    , -3.240916588263556e-22    , 2.5253743784996722e-23    , -1.792252967345033e-24    , },
+    /* x = 30.0        */  {1.2408148119453979e-14    , -9.651464242055694e-15    , 3.847603497937295e-15     , -1.045192509915113e-15    , 2.1709077104270284e-16    , -3.669029041779265e-17    , 5.245254341935449e-18     , -6.512415720039682e-19    , 7.157342866126234e-20     , -7.063850856041994e-21    , 6.330402269533909e-22     , -5.199689819354843e-23    , 4.0076640306479356e-24    , -2.8173249829484434e-25   , },
+    /* x = 32.0        */  {2.701056006993284e-15     , -2.0165904577508193e-15   , 7.743970311794348e-16     , -2.0334542243595312e-16   , 4.0962909298536105e-17    , -6.7354284622602375e-18   , 9.39487584988021e-19      , -1.141061531811086e-19    , 1.2296444823777916e-20    , -1.1924473683221411e-21   , 1.0519834136786319e-22    , -8.520100577658898e-24    , 6.482266596634533e-25     , -4.5058672337687777e-26   , },
+    /* x = 34.0        */  {6.267242255016642e-16     , -4.476060546367167e-16    , 1.649472087123607e-16     , -4.1699241148441566e-17   , 8.113469521966836e-18     , -1.2926382341676442e-18   , 1.752301621176412e-19     , -2.0742427694669852e-20   , 2.1842091895082085e-21    , -2.074671119312359e-22    , 1.7965879553575158e-23    , -1.4310140891454204e-24   , 1.0721484767620217e-25    , -7.353724296322118e-27    , },
+    /* x = 36.0        */  {1.5518659263798418e-16    , -1.0579980740918584e-16   , 3.731121159749507e-17     , -9.051582881682646e-18    , 1.6949948588426186e-18    , -2.606736761092913e-19    , 3.4211727254077474e-20    , -3.932093184396181e-21    , 4.0313438895540075e-22    , -3.7377876645831826e-23   , 3.1670919354996476e-24    , -2.4736747318869634e-25   , 1.8200993381876224e-26    , -1.2288553990365452e-27   , },
+  },
+  /* n = 26 */
+  {
+    /* x = 0.0         */  {0.007202692625135072      , -0.006931633980358082     , 0.003340106937062394      , -0.001074395804478658     , 0.00025951403363572314    , -5.020460023439022e-05    , 8.10231701806126e-06      , -1.1219244186993516e-06   , 1.360616592192425e-07     , -1.4680465481686823e-08   , 1.42649580559445e-09      , -1.2613979499044824e-10   , 1.0421516080129542e-11    , -7.78981771320089e-13     , },
+    /* x = 2.0         */  {0.0010538596571159375     , -0.0010112489098801152    , 0.0004859684729617742     , -0.0001559260430496836    , 3.7574658832906115e-05    , -7.25310022419575e-06     , 1.1681410389196576e-06    , -1.6143957176169062e-07   , 1.954304119489071e-08     , -2.1049975228294745e-09   , 2.0421125792272432e-10    , -1.803002559145977e-11    , 1.4873870328111539e-12    , -1.1102656837520328e-13   , },
+    /* x = 4.0         */  {0.00015512215201573368    , -0.00014835270577484108   , 7.107259092652643e-05     , -2.2738806108999906e-05   , 5.464959848130404e-06     , -1.0522951819048064e-06   , 1.6908396762865562e-07    , -2.3317117874472762e-08   , 2.816911817954961e-09     , -3.028323012687023e-10    , 2.932573470015531e-11     , -2.584806413914447e-12    , 2.1288029876085817e-13    , -1.586658541650676e-14    , },
+    /* x = 6.0         */  {2.2990913060821874e-05    , -2.190260190493158e-05    , 1.0455754972023858e-05    , -3.3342154911477147e-06   , 7.988997569105187e-07     , -1.5339718959623483e-07   , 2.4583411305365007e-08    , -3.3818266888289125e-09   , 4.076204040854503e-10     , -4.37274311985104e-11     , 4.225980579950389e-12     , -3.717789930606416e-13    , 3.056273726153887e-14     , -2.2741258415784796e-15   , },
+    /* x = 8.0         */  {3.4347915594806756e-06    , -3.2574526980997837e-06   , 1.5486137307999675e-06    , -4.919644557828301e-07    , 1.1746669736647108e-07    , -2.2482148542643287e-08   , 3.592225197350705e-09     , -4.927947113163867e-10    , 5.924433463657965e-11     , -6.340097083744651e-12    , 6.113483610322706e-13     , -5.366931388631887e-14    , 4.402917954062461e-15     , -3.2700546834776667e-16   , },
+    /* x = 10.0        */  {5.179405397940925e-07     , -4.885976281291464e-07    , 2.311629262921745e-07     , -7.31126727808056e-08     , 1.738671472441114e-08     , -3.3153218051086433e-09   , 5.279123735439408e-10     , -7.219154436923299e-11    , 8.653442289706313e-12     , -9.23526405398533e-13     , 8.8824914046818e-14       , -7.77923133551044e-15     , 6.367221093855195e-16     , -4.719119211390276e-17    , },
+    /* x = 12.0        */  {7.895831835915532e-08     , -7.401774869439136e-08    , 3.482013021558033e-08     , -1.0956188702536466e-08   , 2.5932073618159305e-09    , -4.923481316037713e-10    , 7.808880650616417e-11     , -1.0639703588372863e-11   , 1.271069261295213e-12     , -1.3523050754794628e-13   , 1.296888534959738e-14     , -1.1327472212559622e-15   , 9.247354226455144e-17     , -6.837749320140832e-18    , },
+    /* x = 14.0        */  {1.2193252671553803e-08    , -1.1344669036350843e-08   , 5.300907941623693e-09     , -1.6577843602408827e-09   , 3.902129764345461e-10     , -7.371374360617711e-11    , 1.1637665715823396e-11    , -1.5789711501733353e-12   , 1.8790090098769452e-13    , -1.99195833239648e-14     , 1.9040209436663328e-15    , -1.657940472902641e-16    , 1.3495036114259626e-17    , -9.952280138408742e-19    , },
+    /* x = 16.0        */  {1.9121030828594795e-09    , -1.7630025354029615e-09   , 8.171435626368104e-10     , -2.537009262390037e-10    , 5.932690037048256e-11     , -1.1140981605941605e-11   , 1.7494462202727856e-12    , -2.3619693236816203e-13   , 2.7981769322200724e-14    , -2.9541509887464037e-15   , 2.8130214792506415e-16    , -2.440867434219619e-17    , 1.980117495563486e-18     , -1.455915956720655e-19    , },
+    /* x = 18.0        */  {3.0541104269689197e-10    , -2.785260217209999e-10    , 1.278438783831105e-10     , -3.934827060587311e-11    , 9.129924733768831e-12     , -1.7025029325377925e-12   , 2.6564786865634766e-13    , -3.565958580600305e-14    , 4.2023939200626625e-15    , -4.4154008664817706e-16   , 4.186014393084046e-17     , -3.617547577726764e-18    , 2.9234041114968393e-19    , -2.1421271306874036e-20   , },
+    /* x = 20.0        */  {4.987031679777046e-11     , -4.487787494025338e-11    , 2.03574652252682e-11      , -6.200376955911257e-12    , 1.425275198058567e-12     , -2.635608823649554e-13    , 4.081561575350621e-14     , -5.441774294795661e-15    , 6.373556209117468e-16     , -6.659140908977472e-17    , 6.280956818368383e-18     , -5.40259625656662e-19     , 4.346585885940275e-20     , -3.1724403653865688e-21   , },
+    /* x = 22.0        */  {8.362066122004637e-12     , -7.40371104672232e-12     , 3.3107099049203628e-12    , -9.95659901608476e-13     , 2.2630870367677294e-13    , -4.143064236575104e-14    , 6.3586008075944076e-15    , -8.409408327256782e-16    , 9.777772361597285e-17     , -1.0148670057103927e-17   , 9.515097417697797e-19     , -8.139825625315151e-20    , 6.515122352756593e-21     , -4.733578095381041e-22    , },
+    /* x = 24.0        */  {1.4473387686294294e-12    , -1.256420217447914e-12    , 5.521516809466551e-13     , -1.635244925432004e-13    , 3.6666438747026527e-14    , -6.631953743281018e-15    , 1.0069340620996267e-15    , -1.3189115242657283e-16   , 1.5202922766150742e-17    , -1.5656844000082356e-18   , 1.457611151330169e-19     , -1.2389634013269908e-20   , 9.85719904188327e-22      , -7.123939561756328e-23    , },
+    /* x = 26.0        */  {2.6012901336849654e-13    , -2.2050572022205983e-13   , 9.489153514512286e-14     , -2.7586747500017703e-14   , 6.0850152767339515e-15    , -1.0847119673538088e-15   , 1.6257442449161104e-16    , -2.1049949567933506e-17   , 2.4014473768414675e-18    , -2.4502979312839947e-19   , 2.2621754813435437e-20    , -1.908358119475438e-21    , 1.5076115016510147e-22    , -1.0828458684236598e-23   , },
+    /* x = 28.0        */  {4.8858669040366283e-14    , -4.026108438623655e-14    , 1.6896492038837623e-14    , -4.8041193324422966e-15   , 1.0390026429428253e-15    , -1.8200191156735226e-16   , 2.68574684241611e-17      , -3.429676249129281e-18    , 3.864631921099111e-19     , -3.89985679367132e-20     , 3.564865989141993e-21     , -2.9805058104688358e-22   , 2.3351022537407126e-23    , -1.665033608280509e-24    , },
+    /* x = 30.0        */  {9.651464242055697e-15     , -7.695206995875033e-15    , 3.1355775297451747e-15    , -8.683630841566365e-16    , 1.8345145209114985e-16    , -3.1471526179227805e-17   , 4.558690993530689e-18     , -5.72586943011526e-19     , 6.357468020052903e-20     , -6.331293968937348e-21    , 5.719438819800799e-22     , -4.7313620730516194e-23   , 3.670522384295729e-24     , -2.5948792872458505e-25   , },
+    /* x = 32.0        */  {2.0165904577508193e-15    , -1.5487940623589398e-15   , 6.100362673078336e-16     , -1.638516371919003e-16    , 3.367714231164419e-17     , -5.636925530131438e-18    , 7.9874307062114025e-19    , -9.837148160565657e-20    , 1.0732029843739559e-20    , -1.052124581403881e-21    , 9.371765563738296e-23     , -7.655497641180152e-24    , 5.870176360036886e-25     , -4.108011443284074e-26    , },
+    /* x = 34.0        */  {4.476060546367168e-16     , -3.2989441742473273e-16   , 1.2509772344532059e-16    , -3.245387808750548e-17    , 6.463191170892932e-18     , -1.0513809759636157e-18   , 1.451969936000426e-19     , -1.7473661102428838e-20   , 1.867204570252526e-21     , -1.796815585062025e-22    , 1.5740604571228245e-23    , -1.2667089346383057e-24   , 9.579857872290426e-26     , -6.624030457379233e-27    , },
+    /* x = 36.0        */  {1.0579980740918584e-16    , -7.4622423194992e-17      , 2.7154748645047273e-17    , -6.779979435310858e-18    , 1.303368380555355e-18     , -2.0527036406116998e-19   , 2.752465224805474e-20     , -3.2250730665553895e-21   , 3.364009813613678e-22     , -3.167466942806119e-23    , 2.7209526832598053e-24    , -2.1513858735104493e-25   , 1.6007675803837832e-26    , -1.0912640225901946e-27   , },
+  },
+  /* n = 27 */
+  {
+    /* x = 0.0         */  {0.006931633980358088      , -0.006680213874126083     , 0.0032231874134354688     , -0.0010380561345014196    , 0.00025102300117869165    , -4.8613902481756986e-05   , 7.853470898536262e-06     , -1.088491850911199e-06    , 1.3212425868440663e-07    , -1.4267567211357683e-08   , 1.3874699302945543e-09    , -1.227806678774378e-10    , 1.0151424842438649e-11    , -7.593002757475516e-13    , },
+    /* x = 2.0         */  {0.001011248909880116      , -0.0009719369459237329    , 0.00046777812914897897    , -0.00015029863532572109   , 3.626550112193702e-05     , -7.008846286667086e-06    , 1.1300769977314535e-06    , -1.5634412702844138e-07   , 1.894498756457117e-08     , -2.0424839721559783e-09   , 1.9832064057383634e-10    , -1.752445660910728e-11    , 1.4468514605014194e-12    , -1.0808037986230411e-13   , },
+    /* x = 4.0         */  {0.0001483527057748412     , -0.0001421451818530792    , 6.821641832698948e-05     , -2.185983939167919e-05    , 5.261475909660595e-06     , -1.0145038133564924e-06   , 1.632198244657128e-07     , -2.253526564186073e-08    , 2.7254921164310596e-09    , -2.9331034593222446e-10   , 2.84314966323938e-11      , -2.508300999763776e-12    , 2.0676525745953851e-13    , -1.542339303774103e-14    , },
+    /* x = 6.0         */  {2.19026019049316e-05      , -2.0911509944051484e-05   , 1.000264647344168e-05     , -3.195599027521522e-06    , 7.669859480006871e-07     , -1.4750046891754865e-07   , 2.367278672812654e-08     , -3.260959096810949e-09    , 3.935470815437868e-10     , -4.2267389992831904e-11   , 4.0893726091595125e-12    , -3.601326344611056e-13    , 2.963502866688657e-14     , -2.207098726081051e-15    , },
+    /* x = 8.0         */  {3.2574526980997863e-06    , -3.0972274616004754e-06   , 1.4758933673482806e-06    , -4.6986678944858003e-07   , 1.1241074271601269e-07    , -2.1553351339897957e-08   , 3.4495629657906896e-09    , -4.739540834248684e-10    , 5.70609025227716e-11      , -6.114572253068081e-12    , 5.903343203372283e-13     , -5.1884744049308514e-14   , 4.261301861341155e-15     , -3.1680880814494283e-16   , },
+    /* x = 10.0        */  {4.885976281291467e-07     , -4.6232585258442687e-07   , 2.1933801834238667e-07    , -6.954685889515221e-08    , 1.657660902594522e-08     , -3.1674742637026804e-09   , 5.053408086547345e-10     , -6.922745281151984e-11    , 8.311741784554748e-12     , -8.884059378497936e-13    , 8.556750025263108e-14     , -7.503797671709661e-15    , 6.149563175006867e-16     , -4.562996306453105e-17    , },
+    /* x = 12.0        */  {7.401774869439141e-08     , -6.964026043117193e-08    , 3.286856610760505e-08     , -1.0372829446903386e-08   , 2.4617406580768566e-09    , -4.685328422811442e-10    , 7.447792484016771e-11     , -1.0168541728191258e-11   , 1.217075164662005e-12     , -1.2971152267953738e-13   , 1.2459635909322887e-14    , -1.0898947067489383e-15   , 8.910294845894748e-17     , -6.5970013818012016e-18   , },
+    /* x = 14.0        */  {1.1344669036350851e-08    , -1.0601815883249019e-08   , 4.973353080722018e-09     , -1.5608519056858673e-09   , 3.6856871803928715e-10    , -6.982599476595784e-11    , 1.1052798010880066e-11    , -1.5032054130479338e-12   , 1.7927633635399952e-13    , -1.90435007538781e-14     , 1.8236499948405325e-15    , -1.5906746389642316e-16   , 1.2968703062191134e-17    , -9.578108455890477e-19    , },
+    /* x = 16.0        */  {1.7630025354029625e-09    , -1.6342871252738593e-09   , 7.611027787169194e-10     , -2.373076014742982e-10    , 5.5704908030930456e-11    , -1.0496677390348982e-11   , 1.6533785207086604e-12    , -2.2385389274381004e-13   , 2.6587371475446348e-14    , -2.8135016170598923e-15   , 2.6848311937609105e-16    , -2.3342301166036242e-17   , 1.8971632310252926e-18    , -1.3972533053905056e-19   , },
+    /* x = 18.0        */  {2.7852602172100006e-10    , -2.5568775676625596e-10   , 1.180448118176059e-10     , -3.6519698933955975e-11   , 8.512514662867718e-12     , -1.59388722201572e-12     , 2.49617099783875e-13      , -3.3619112958902425e-14   , 3.97386261892634e-15      , -4.1867185816157925e-16   , 3.979122496483881e-17     , -3.4466168985737618e-18   , 2.791305373972223e-19     , -2.0492612118587893e-20   , },
+    /* x = 20.0        */  {4.487787494025341e-11     , -4.071493045054156e-11    , 1.86011308677318e-11      , -5.701100792069098e-12    , 1.3178044118510647e-12    , -2.4489369600807407e-13   , 3.8092419937370753e-14    , -5.0988393008359385e-15   , 5.99322952264482e-16      , -6.281995902422116e-17    , 5.942591411574026e-18     , -5.125202385458365e-19    , 4.133790325513616e-20     , -3.023834867664074e-21    , },
+    /* x = 22.0        */  {7.403711046722323e-12     , -6.621419809841491e-12    , 2.986979704825137e-12     , -9.052348146825502e-13    , 2.07153211832646e-13      , -3.8151605066515825e-14   , 5.8865858104012604e-15    , -7.822209469864041e-16    , 9.133807054372539e-17     , -9.516641321128079e-18    , 8.953416749759766e-19     , -7.683381120746105e-20    , 6.1678867180750205e-21    , -4.492896426551265e-22    , },
+    /* x = 24.0        */  {1.2564202174479147e-12    , -1.1043033618934252e-12   , 4.905734776295577e-13     , -1.4666575498443057e-13   , 3.3159768716985205e-14    , -6.041604405688777e-15    , 9.232380642010706e-16     , -1.2162325603412158e-16   , 1.4091165568460738e-17    , -1.4578423767656831e-18   , 1.3628013786215197e-19    , -1.1626804926367017e-20   , 9.28234588078626e-22      , -6.728846278010054e-23    , },
+    /* x = 26.0        */  {2.205057202220599e-13     , -1.897830702902631e-13    , 8.276024250004657e-14     , -2.4340061106380277e-14   , 5.42355983685627e-15      , -9.75446551951113e-16     , 1.4734964655679164e-16    , -1.921155995650225e-17    , 2.20526903556015e-18      , -2.2625249587078524e-19   , 2.099106177332849e-20     , -1.77862839541943e-21     , 1.4108909251992664e-22    , -1.0170038360152658e-23   , },
+    /* x = 28.0        */  {4.0261084386236565e-14    , -3.3792984077677896e-14   , 1.4412357997325894e-14    , -4.156010571686445e-15    , 9.100095578500046e-16     , -1.611448113089288e-16    , 2.400773368032854e-17     , -3.0917026257772656e-18   , 3.5098724768038726e-19    , -3.5653998066726065e-20   , 3.2784231575060448e-21    , -2.7555265918600083e-22   , 2.169388922022405e-23     , -1.5534407336236838e-24   , },
+    /* x = 30.0        */  {7.695206995875035e-15     , -6.271155059490759e-15    , 2.605089252469757e-15     , -7.338058083514776e-16    , 1.5735763089817246e-16    , -2.735214607931964e-17    , 4.008108591318944e-18     , -5.085969914467681e-19    , 5.698166664068554e-20     , -5.7202642846768765e-21   , 5.204293708883338e-22     , -4.3325734741208066e-23   , 3.380782579303131e-24     , -2.402141093597584e-25    , },
+    /* x = 32.0        */  {1.54879406235894e-15      , -1.2200725346157315e-15   , 4.915549115756772e-16     , -1.347085692445184e-16    , 2.8184627650973514e-17    , -4.792458442257995e-18    , 6.886003697210388e-19     , -8.585616813691499e-20    , 9.46912448702954e-21      , -9.373060407456455e-22    , 8.420729170342191e-23     , -6.93118730260473e-24     , 5.351987889405363e-25     , -3.7680358093328286e-26   , },
+    /* x = 34.0        */  {3.2989441742473277e-16    , -2.5019544689065143e-16   , 9.73616342625127e-17      , -2.5852764683243407e-17   , 5.256904879868041e-18     , -8.711819645560727e-19    , 1.223156274771501e-19     , -1.493762529892571e-20    , 1.617134540577243e-21     , -1.574266989774187e-22    , 1.3933295639620142e-23    , -1.1315551792982708e-24   , 8.629518757190729e-26     , -6.0101289263317665e-27   , },
+    /* x = 36.0        */  {7.462242319499202e-17     , -5.430949729009621e-17    , 2.0339938305931972e-17    , -5.21347352216802e-18     , 1.0263518203138825e-18    , -1.6514791396907818e-19   , 2.2575511427325855e-20    , -2.691206019011777e-21    , 2.8507210749353904e-22    , -2.72128859552796e-23     , 2.36644364961329e-24      , -1.8916001883332653e-25   , 1.4215820240629064e-26    , -9.77502626914505e-28     , },
+  },
+  /* n = 28 */
+  {
+    /* x = 0.0         */  {0.006680213874126089      , -0.006446374826872201     , 0.0031141684035037656     , -0.0010040920046743157    , 0.00024306951241536331    , -4.7120825755404914e-05   , 7.619442924797531e-06     , -1.056992681697625e-06    , 1.2840817258339374e-07    , -1.3877244157980263e-08   , 1.3505211631827395e-09    , -1.1959570014828443e-10   , 9.89497221634258e-12      , -7.405882927267922e-13    , },
+    /* x = 2.0         */  {0.0009719369459237336     , -0.0009355562582981376    , 0.00045089590597709324    , -0.00014506200448199735   , 3.5044231434269554e-05    , -6.780462038163766e-06    , 1.0944088847146604e-06    , -1.515597032219557e-07    , 1.8382365360014307e-08    , -1.9835681970731333e-09   , 1.9275962476326e-10       , -1.7046410864503927e-11   , 1.408462641231779e-12     , -1.0528623486258264e-13   , },
+    /* x = 4.0         */  {0.0001421451818530793     , -0.00013643283665400456   , 6.55795181750276e-05      , -2.104590363782285e-05    , 5.07251906691541e-06      , -9.793189541726887e-07    , 1.5774685885477946e-07    , -2.1803908815202453e-08   , 2.63979448121822e-09      , -2.843665247927687e-10    , 2.7589973438231673e-11    , -2.4361778658855487e-12   , 2.0099053317969096e-13    , -1.5004207181861367e-14   , },
+    /* x = 6.0         */  {2.09115099440515e-05      , -2.0005292946887016e-05   , 9.586797082563144e-06     , -3.0679437918856488e-06   , 7.375023446067127e-07     , -1.4203672142303301e-07   , 2.282671358660978e-08     , -3.1483726349278287e-09   , 3.8040670510137826e-10    , -4.090109307853808e-11    , 3.961268132106096e-12     , -3.491897279639604e-13    , 2.876168781983349e-14     , -2.143890057273355e-15    , },
+    /* x = 8.0         */  {3.097227461600478e-06     , -2.9517867346970855e-06   , 1.4096003683455366e-06    , -4.4964297084727003e-07   , 1.0776675670220391e-07    , -2.0697377945824403e-08   , 3.317678570944449e-09     , -4.5648664447524565e-10   , 5.5031178201475656e-11    , -5.904398910717306e-12    , 5.707048786282913e-13     , -5.021409978926375e-14    , 4.1284447115647865e-15    , -3.072243818109142e-16    , },
+    /* x = 10.0        */  {4.6232585258442724e-07    , -4.386760366848487e-07    , 2.0864057668542744e-07    , -6.630643610136841e-08    , 1.5837371318902916e-08    , -3.032044873648349e-09    , 4.845921678107063e-10     , -6.649385151043741e-11    , 7.995657448108127e-12     , -8.558267752463008e-13    , 8.253785561419754e-14     , -7.246994121032888e-15    , 5.946146407094607e-16     , -4.416775547043604e-17    , },
+    /* x = 12.0        */  {6.964026043117197e-08     , -6.573713221522096e-08    , 3.111848834070595e-08     , -9.846962631959359e-09    , 2.3426642114618103e-09    , -4.4686755217471963e-10   , 7.117979182807175e-11     , -9.736589375982235e-12    , 1.1674042811828642e-12    , -1.24618256540119e-13     , 1.1988277477933824e-14    , -1.0501212175892265e-15   , 8.59662326789765e-17      , -6.3724217845573576e-18   , },
+    /* x = 14.0        */  {1.0601815883249027e-08    , -9.946706161445612e-09    , 4.682555717056994e-09     , -1.4742748721067299e-09   , 3.4912997383789624e-10    , -6.631678851920825e-11    , 1.0522437852416068e-11    , -1.4342089610986539e-12   , 1.713915901933e-13        , -1.8239671852936832e-14   , 1.7496605403548677e-15    , -1.528557005280214e-16    , 1.2481202397693708e-17    , -9.230611937502623e-19    , },
+    /* x = 16.0        */  {1.6342871252738603e-09    , -1.5222055574340679e-09   , 7.119228044228064e-10     , -2.2281963211638592e-10   , 5.24833869529216e-11      , -9.920271190298135e-12    , 1.5669772435577396e-12    , -2.1269872012896065e-13   , 2.532152665976843e-14     , -2.685292702453388e-15    , 2.567534745219718e-16     , -2.2363110998017315e-17   , 1.8207344690724085e-18    , -1.3430418598383118e-19   , },
+    /* x = 18.0        */  {2.556877567662561e-10     , -2.3608962363524535e-10   , 1.0955909680185506e-10    , -3.405005865039814e-11    , 7.969436110250193e-12     , -1.4977026083611552e-12   , 2.3533378988855514e-13    , -3.179086414918748e-14    , 3.768048488858033e-15     , -3.979797356983387e-16    , 3.791105955173653e-17     , -3.29065839793781e-18     , 2.670317633183446e-19     , -1.9639157884384072e-20   , },
+    /* x = 20.0        */  {4.071493045054158e-11     , -3.720226173546853e-11    , 1.710330237620541e-11     , -5.271217647246503e-12    , 1.2244684800655257e-12    , -2.2855452104451123e-13   , 3.5691874985089324e-14    , -4.794578206008409e-15    , 5.653798900233721e-16     , -5.943583855021838e-17    , 5.6374695465364946e-18    , -4.873918868825712e-19    , 3.9401888516343004e-20    , -2.888109840960494e-21    , },
+    /* x = 22.0        */  {6.621419809841495e-12     , -5.973959409651002e-12    , 2.7157044440473724e-12    , -8.28612847307235e-13     , 1.90758025336289e-13      , -3.531951507262129e-14    , 5.475546611095064e-15     , -7.3070376331638e-16      , 8.564981005820459e-17     , -8.954885639921442e-18    , 8.451345999924154e-19     , -7.273246088194378e-20    , 5.854338495356289e-21     , -4.274607295045826e-22    , },
+    /* x = 24.0        */  {1.1043033618934256e-12    , -9.811469552592242e-13    , 4.399972649532504e-13     , -1.3263907486445948e-13   , 3.020802202899474e-14     , -5.539428416548934e-15    , 8.513627895943682e-16     , -1.1272920511522e-16      , 1.3120587058269465e-17    , -1.3630203867915537e-18   , 1.2788931224983417e-19    , -1.094764526681192e-20    , 8.767654197591843e-22     , -6.373324575081641e-23    , },
+    /* x = 26.0        */  {1.8978307029026317e-13    , -1.655204850001095e-13    , 7.302018331913465e-14     , -2.169423934690163e-14    , 4.877232759837999e-15     , -8.840978840533873e-16    , 1.3448091929978219e-16    , -1.7642134326745384e-17   , 2.0362733109310143e-18    , -2.09943547497262e-19     , 1.9564083027465187e-20    , -1.6643251347554276e-21   , 1.3251209302191025e-22    , -9.582812444371616e-24    , },
+    /* x = 28.0        */  {3.379298407767791e-14     , -2.8824715994654275e-14   , 1.24680317150584e-14      , -3.640038231320545e-15    , 8.057240565570905e-16     , -1.440464027974734e-16    , 2.1641918320689466e-17    , -2.8078952549948438e-18   , 3.208861106531954e-19     , -3.278923115241141e-20    , 3.0309540328251645e-21    , -2.5596261108916383e-22   , 2.0240266822333056e-23    , -1.4549099459452983e-24   , },
+    /* x = 30.0        */  {6.271155059490761e-15     , -5.210178504939895e-15    , 2.20141742505429e-15      , -6.294305235804872e-16    , 1.3676073039849698e-16    , -2.4048651657773764e-17   , 3.560178931012009e-18     , -4.5585291450076e-19      , 5.1482398097128955e-20    , -5.205061352683902e-21    , 4.765639795425273e-22     , -3.989932715019955e-23    , 3.1297303364544468e-24    , -2.2338848527405417e-25   , },
+    /* x = 32.0        */  {1.220072534615732e-15     , -9.831098231514137e-16    , 4.041257077335332e-16     , -1.1273851060199579e-16   , 2.3962292211583127e-17    , -4.131602235416218e-18    , 6.009931755510891e-19     , -7.575293077465178e-20    , 8.435757382708687e-21     , -8.421923319269045e-22    , 7.624011109610776e-23     , -6.318150415424181e-24    , 4.909171812520883e-25     , -3.4750212863261624e-26   , },
+    /* x = 34.0        */  {2.501954468906515e-16     , -1.9472326852503476e-16   , 7.755829404972679e-17     , -2.102761951917234e-17    , 4.355909822826256e-18     , -7.3389376756219845e-19   , 1.0456337687216667e-19    , -1.2937066038957408e-20   , 1.4168407629462002e-21    , -1.3935181737266458e-22   , 1.2446645275465064e-23    , -1.0190789021163355e-24   , 7.829957779322276e-26     , -5.488589742757178e-27    , },
+    /* x = 36.0        */  {5.4309497290096217e-17    , -4.0679876611865455e-17   , 1.5640420566503512e-17    , -4.105407281207326e-18    , 8.257395698526925e-19     , -1.3545306899792835e-19   , 1.8838442098030678e-20    , -2.2805752063039624e-21   , 2.4491604871616546e-22    , -2.3667468797149705e-23   , 2.0806867516342425e-24    , -1.679430203234547e-25    , 1.2734247127525509e-26    , -8.824013438984288e-28    , },
+  },
+  /* n = 29 */
+  {
+    /* x = 0.0         */  {0.006446374826872207      , -0.006228336807008765     , 0.0030122760140224654     , -0.0009722780496219755    , 0.00023560412878344844    , -4.571665790421288e-05    , 7.398948741044304e-06     , -1.027264026268737e-06    , 1.2489526351326672e-07    , -1.350769527795445e-08    , 1.315488072706796e-09     , -1.1657169726890727e-10   , 9.651151105094889e-12     , -7.227759411350124e-13    , },
+    /* x = 2.0         */  {0.0009355562582981383     , -0.0009017918119543616    , 0.00043518601344592374    , -0.00014017692573147243   , 3.3902310191729976e-05    , -6.566453358758052e-06    , 1.06091791817952e-06      , -1.4705873055810863e-07   , 1.7852123147971815e-08    , -1.927948920490602e-09    , 1.8750135263945937e-10    , -1.6593704452540952e-11   , 1.3720547255694035e-12    , -1.0263267876520486e-13   , },
+    /* x = 4.0         */  {0.00013643283665400467    , -0.00013115903635008011   , 6.313771091345884e-05     , -2.0290076266863797e-05   , 4.896594770992963e-06     , -9.464811603118172e-07    , 1.5262736108463034e-07    , -2.1118328477592595e-08   , 2.5593000556903153e-09    , -2.7594992837873496e-10   , 2.6796653457653727e-11    , -2.3680722066168206e-12   , 1.95528573532429e-13      , -1.460713448144311e-14    , },
+    /* x = 6.0         */  {2.0005292946887033e-05    , -1.9173594165129845e-05   , 9.203831375655563e-06     , -2.9500093783130126e-06   , 7.101836071336204e-07     , -1.3696028254457026e-07   , 2.2038608355896186e-08    , -3.0432497352747468e-09   , 3.68110027583049e-10      , -3.961984313812786e-11    , 3.8409013332392495e-12    , -3.3888872802476353e-13   , 2.7938094038173144e-14    , -2.0841840406164068e-15   , },
+    /* x = 8.0         */  {2.9517867346970876e-06    , -2.819200736691582e-06    , 1.3489289125416123e-06    , -4.310670267925279e-07    , 1.0348688973175863e-07    , -1.9906071572308438e-08   , 3.1954064986691094e-09    , -4.4024886681805444e-10   , 5.313961732304486e-11     , -5.7080734793439954e-12   , 5.523285713941999e-13     , -4.864688594525723e-14    , 4.0035636475655745e-15    , -2.9819900332490477e-16   , },
+    /* x = 10.0        */  {4.3867603668484904e-07    , -4.172811533709279e-07    , 1.989193083040769e-07     , -6.334948527327414e-08    , 1.5160224368619514e-08    , -2.9075530279093345e-09   , 4.654569587595106e-10     , -6.396517939038966e-11    , 7.702444863846444e-12     , -8.255256133725337e-13    , 7.971313471239577e-14     , -7.007010082452875e-15    , 5.755629731119539e-16     , -4.279551720091933e-17    , },
+    /* x = 12.0        */  {6.573713221522102e-08     , -6.223697668142241e-08    , 2.9540887895874005e-08    , -9.370656845510643e-09    , 2.2343377609278968e-09    , -4.2707875399888354e-10   , 6.815612537120513e-11     , -9.33922270162589e-12     , 1.1215648675049986e-12    , -1.1990395069613805e-13   , 1.1550787112467345e-14    , -1.0131104406838932e-15   , 8.304014641752011e-17     , -6.162452292164685e-18    , },
+    /* x = 14.0        */  {9.946706161445618e-09     , -9.365111434115508e-09    , 4.422824616319602e-09     , -1.3965198953029337e-09   , 3.3158394260387346e-10    , -6.313462755251302e-11    , 1.003946269009054e-11     , -1.371131052443182e-12    , 1.6415712725717108e-13    , -1.7499666128998374e-14   , 1.6813339083657923e-15    , -1.4710273892188122e-16   , 1.2028451372667783e-17    , -8.907075099607781e-19    , },
+    /* x = 16.0        */  {1.522205557434069e-09     , -1.4238456088458335e-09   , 6.684588963490727e-10     , -2.0993354780462495e-10   , 4.9601355952624875e-11    , -9.401863524921848e-12    , 1.4888910354577893e-12    , -2.0257197101841082e-13   , 2.416764599112998e-14     , -2.5679789896378625e-15   , 2.4598281017578685e-16    , -2.1461035529270962e-17   , 1.7501041232933308e-18    , -1.2928020745066768e-19   , },
+    /* x = 18.0        */  {2.3608962363524545e-10    , -2.1911819360374227e-10   , 1.0215017595118205e-10    , -3.187774443997102e-11    , 7.488513041970746e-12     , -1.4120027486022702e-12   , 2.2253604825234525e-13    , -3.014435258317782e-14    , 3.581819318550113e-15     , -3.791753776799863e-16    , 3.619558267505177e-17     , -3.147833279714882e-18    , 2.5591262732716295e-19    , -1.8852317381889196e-20   , },
+    /* x = 20.0        */  {3.720226173546855e-11     , -3.420660475241553e-11    , 1.5813652941737702e-11    , -4.897873920111143e-12    , 1.14277260524667e-12      , -2.1415125126963873e-13   , 3.3562047326296576e-14    , -4.523033941220723e-15    , 5.349227950420391e-16     , -5.638419238516167e-17    , 5.3610681563261375e-18    , -4.645328785936388e-19    , 3.763365268490465e-20     , -2.763702020730669e-21    , },
+    /* x = 22.0        */  {5.9739594096510056e-12    , -5.43140888809544e-12     , 2.485838541921439e-12     , -7.630321013228928e-13    , 1.765975753666509e-13     , -3.285327986700753e-14    , 5.1149263261990034e-15    , -6.851977166857127e-16    , 8.059400722550758e-17     , -8.452746577923262e-18    , 8.000214105710391e-19     , -6.902951033884996e-20    , 5.5699574329299625e-21    , -4.075817971323346e-22    , },
+    /* x = 24.0        */  {9.811469552592246e-13     , -8.799945299066041e-13    , 3.9791722459333915e-13    , -1.2083208811267322e-13   , 2.7697142083268965e-14    , -5.108176767328034e-15    , 7.891044332895777e-16     , -1.0496458305684545e-16   , 1.2267188875216167e-17    , -1.279101085969542e-18    , 1.2041882323014705e-19    , -1.0339655891186306e-20   , 8.304504151007488e-22     , -6.05192366622991e-23     , },
+    /* x = 26.0        */  {1.6552048500010955e-13    , -1.4604036663828475e-13   , 6.508271804069904e-14     , -1.9508931038857307e-14   , 4.420489420345051e-15     , -8.068855202523866e-16    , 1.2349493991221475e-16    , -1.6290169516407014e-17   , 1.889492731142006e-18     , -1.9567195073564587e-19   , 1.8306790603764512e-20    , -1.5629804326367117e-21   , 1.2486235735860282e-22    , -9.05630741093034e-24     , },
+    /* x = 28.0        */  {2.882471599465428e-14     , -2.4936063430119136e-14   , 1.0920114693960753e-14    , -3.22289622615367e-15     , 7.202320139991018e-16     , -1.2985151059659275e-16   , 1.9655266728629118e-17    , -2.5670863228023576e-18   , 2.9510320110234723e-19    , -3.031423913371866e-20    , 2.8154706636452653e-21    , -2.387816772700689e-22    , 1.8956762811912284e-23    , -1.3673861278200889e-24   , },
+    /* x = 30.0        */  {5.210178504939897e-15     , -4.402834850108937e-15    , 1.888291570741328e-15     , -5.470429215825932e-16    , 1.2024325829064848e-16    , -2.1361073688658072e-17   , 3.190970392961713e-18     , -4.118587938696387e-19    , 4.6845570483872206e-20    , -4.766356614284559e-21    , 4.388746942275562e-22     , -3.693106370124776e-23    , 2.9105614903597097e-24    , -2.0859864581671385e-25   , },
+    /* x = 32.0        */  {9.831098231514139e-16     , -8.082514154671213e-16    , 3.382155318059669e-16     , -9.584916884457329e-17    , 2.065801117735397e-17     , -3.605959069144648e-18    , 5.302705141125745e-19     , -6.748599871022446e-20    , 7.579733794760145e-21     , -7.625117789409344e-22    , 6.949690929782563e-23     , -5.794405997838635e-24    , 4.5275112090234795e-25    , -3.2204914641646116e-26   , },
+    /* x = 34.0        */  {1.9472326852503478e-16    , -1.5511658809946217e-16   , 6.308285855751383e-17     , -1.7423639291029623e-17   , 3.669468837853367e-18     , -6.273802637124204e-19    , 9.055946206927378e-20     , -1.1334716655727013e-20   , 1.254166792317399e-21     , -1.244837774473253e-22    , 1.120944161104912e-23     , -9.244725482648261e-25    , 7.150670046506615e-26     , -5.041543596080017e-27    , },
+    /* x = 36.0        */  {4.067987661186546e-17     , -3.128084113300839e-17    , 1.2316221843621477e-17    , -3.3029582793669535e-18   , 6.7726534499632e-19       , -1.1303065298265634e-19   , 1.5964026412067773e-20    , -1.9593268865979126e-21   , 2.130072878814145e-22     , -2.0809623827253126e-23   , 1.847306037595541e-24     , -1.5040504322246218e-25   , 1.1495650463015956e-26    , -8.020910573159093e-28    , },
+  },
+  /* n = 30 */
+  {
+    /* x = 0.0         */  {0.00622833680700877       , -0.006024552028046136     , 0.0029168341488654556     , -0.0009424165150952432    , 0.00022858328952734083    , -4.439369279334515e-05    , 7.190848153749848e-06     , -9.991607855197124e-07    , 1.2156932207623733e-07    , -1.3157306038143844e-08   , 1.282225524259689e-09     , -1.1369676402845907e-10   , 9.419051138382886e-12     , -7.057998951922984e-13    , },
+    /* x = 2.0         */  {0.0009017918119543623     , -0.0008703720268920184    , 0.0004205307771943506     , -0.00013560924076145195   , 3.283226679467954e-05     , -6.365507558306315e-06    , 1.0294111096375668e-06    , -1.4281679759027993e-07   , 1.735154943375528e-08     , -1.8753575283812443e-09   , 1.8252180210223472e-10    , -1.616437817733147e-11    , 1.337478492280572e-12     , -1.0010937766557374e-13   , },
+    /* x = 4.0         */  {0.00013115903635008022    , -0.00012627542182694194   , 6.087022880058193e-05     , -1.9586379083194585e-05   , 4.7324058016853496e-06    , -9.157641735056901e-07    , 1.4782829873699496e-07    , -2.0474373779207835e-08   , 2.483550654459605e-09     , -2.680154342483475e-10    , 2.604752396853217e-11     , -2.3036584922841213e-12   , 1.9035471376880813e-13    , -1.4230475032623475e-14   , },
+    /* x = 6.0         */  {1.9173594165129858e-05    , -1.8407662751314585e-05   , 8.85002813493769e-06      , -2.8407344284237288e-06   , 6.848014127408195e-07     , -1.3223165113251038e-07   , 2.1302748060663164e-08    , -2.944876420978874e-09    , 3.565787731076244e-10     , -3.8415981046843886e-11   , 3.727595234711088e-12     , -3.291750324861194e-13    , 2.7160133577427906e-14    , -2.027698627066142e-15    , },
+    /* x = 8.0         */  {2.8192007366915844e-06    , -2.697857825083719e-06    , 1.2932010803773914e-06    , -4.139475589112118e-07    , 9.953035786410559e-08     , -1.9172439134469593e-08   , 3.0817420554202647e-09    , -4.25116395744639e-10     , 5.13726876874024e-11      , -5.524281151517571e-12    , 5.350899557193114e-13     , -4.7173849913722e-14      , 3.885965849322131e-15     , -2.8968543868381512e-16   , },
+    /* x = 10.0        */  {4.172811533709282e-07     , -3.978386166082246e-07    , 1.9004845581979493e-07    , -6.064089747221101e-08    , 1.4537765139913377e-08    , -2.7927417729676323e-09   , 4.477562539722844e-10     , -6.161948113418992e-11    , 7.429734293167125e-12     , -7.972739705807931e-13    , 7.70734215841347e-14      , -6.782260251058458e-15    , 5.576834012812598e-16     , -4.150525853628288e-17    , },
+    /* x = 12.0        */  {6.223697668142246e-08     , -5.908177579175819e-08    , 2.811197053652798e-08     , -8.937351043385734e-09    , 2.135393770047035e-09     , -4.089367551609369e-10    , 6.5374558658781e-11       , -8.97250776086019e-12     , 1.0791360976138008e-12    , -1.1552837102317525e-13   , 1.1143685479036837e-14    , -9.785874918724614e-16    , 8.030439255145342e-17     , -5.9657267454652094e-18   , },
+    /* x = 14.0        */  {9.365111434115515e-09     , -8.845649232640672e-09    , 4.189559685908233e-09     , -1.3263357703684918e-09   , 3.1567313777014026e-10    , -6.023677656371076e-11    , 9.597917330736318e-12     , -1.3132554055370497e-12   , 1.574970730969785e-13     , -1.6816296051435683e-14   , 1.6180539169004395e-15    , -1.4176029503398347e-16   , 1.1606912977181681e-17    , -8.60513451725737e-19     , },
+    /* x = 16.0        */  {1.4238456088458344e-09    , -1.336917792698358e-09    , 6.298006434137928e-10     , -1.9840542380369304e-10   , 4.700931762570385e-11     , -8.933346274026354e-12    , 1.4180037918739588e-12    , -1.9334093441746437e-13   , 2.3111822168565e-14       , -2.460256304451416e-15    , 2.360603782302017e-16     , -2.062747392482477e-17    , 1.6846475879442325e-18    , -1.2461198885692705e-19   , },
+    /* x = 18.0        */  {2.1911819360374243e-10    , -2.0430035190239504e-10   , 9.563323331990116e-11     , -2.9954052166892985e-11   , 7.060013743170179e-12     , -1.33521629842719e-12     , 2.1101046731975913e-13    , -2.8654520584194474e-14   , 3.4125800332036485e-15    , -3.620181086700114e-16    , 3.4624568157221504e-17    , -3.016586063532313e-18    , 2.4566123276278575e-19    , -1.812473677643699e-20    , },
+    /* x = 20.0        */  {3.420660475241555e-11     , -3.162730588347993e-11    , 1.4693621760331694e-11    , -4.57109042084197e-12     , 1.0707562563713464e-12    , -2.0137228526061245e-13   , 3.166123747739546e-14     , -4.279377395785988e-15    , 5.07457969671159e-16      , -5.3619785304693357e-17   , 5.109628731673345e-18     , -4.436572461034612e-19    , 3.601283566999732e-20     , -2.649285931648446e-21    , },
+    /* x = 22.0        */  {5.4314088880954436e-12    , -4.971677083843543e-12    , 2.289096303968424e-12     , -7.063903014453332e-13    , 1.6426639933843035e-13    , -3.0689558148694264e-14   , 4.796384000512789e-15     , -6.44751328078125e-16     , 7.607475410638458e-17     , -8.001552238438574e-18    , 7.592904811742517e-19     , -6.567144470684515e-20    , 5.31097615374186e-21      , -3.8941009910342884e-22   , },
+    /* x = 24.0        */  {8.799945299066045e-13     , -7.958344491867766e-13    , 3.624962643379822e-13     , -1.1078856832992953e-13   , 2.5540883837140253e-14    , -4.734626628064181e-15    , 7.347520789971925e-16     , -9.813740306087688e-17    , 1.151191491871401e-17     , -1.2043861682111437e-18   , 1.1373118368715229e-19    , -9.792628656900769e-21    , 7.885797129655652e-22     , -5.760120768247397e-23    , },
+    /* x = 26.0        */  {1.4604036663828483e-13    , -1.3016543608141272e-13   , 5.852679311656636e-14     , -1.7681957680911432e-14   , 4.0344276013361395e-15    , -7.409696436936813e-16    , 1.1403118625860808e-16    , -1.511592576707949e-17    , 1.7610483200792675e-18    , -1.8309739636404764e-19   , 1.71920381984006e-20      , -1.4726065073363191e-21   , 1.1800349350127557e-22    , -8.581938896135032e-24    , },
+    /* x = 28.0        */  {2.4936063430119146e-14    , -2.1840229387923705e-14   , 9.668688678460177e-15     , -2.880928055925986e-15    , 6.492575529940596e-16     , -1.1793160100578075e-16   , 1.796960420634915e-17     , -2.360823192907066e-18    , 2.7282826636038703e-19    , -2.815913678402953e-20    , 2.6264868198039038e-21    , -2.236141331178104e-22    , 1.7816615500994755e-23    , -1.289207162314368e-24    , },
+    /* x = 30.0        */  {4.4028348501089375e-15    , -3.77658314148299e-15     , 1.6411287647476542e-15    , -4.80973033151914e-16     , 1.0680536844496407e-16    , -1.914582245392183e-17    , 2.883011549052578e-18     , -3.7476419748168865e-19   , 4.289722674806918e-20     , -4.3894188024813414e-21   , 4.062248623569919e-22     , -3.434028058949155e-23    , 2.7179058903456076e-24    , -1.9551582714795295e-25   , },
+    /* x = 32.0        */  {8.082514154671216e-16     , -6.76431063611985e-16     , 2.8754750653370077e-16    , -8.263204470777832e-17    , 1.8029795345978265e-17    , -3.1816230994182606e-18   , 4.724019897473038e-19     , -6.063781418018734e-20    , 6.86260863418186e-21      , -6.95072107979192e-22     , 6.37359003408177e-23      , -5.343093305100533e-24    , 4.195969173778237e-25     , -2.9977936211375804e-26   , },
+    /* x = 34.0        */  {1.551165880994622e-16     , -1.2616571711503563e-16   , 5.227091787308592e-17     , -1.4677875351159176e-17   , 3.1369013186014147e-18    , -5.43356774705043e-19     , 7.934301640136355e-20     , -1.0033325614748457e-20   , 1.120354401480924e-21     , -1.1211041312557332e-22   , 1.01688025293035e-23      , -8.441169020291459e-25    , 6.568389597275958e-26     , -4.6551985653221426e-27   , },
+    /* x = 36.0        */  {3.12808411330084e-17      , -2.4632443687244207e-17   , 9.9088748381004e-18       , -2.7090613799452037e-18   , 5.651532649194242e-19     , -9.578415883321059e-20    , 1.371528817669731e-20     , -1.7040569282088594e-21   , 1.87286677640655e-22      , -1.847558144737316e-23    , 1.6543936791009642e-24    , -1.3574721450218109e-25   , 1.044965675329048e-26     , -7.336384675858722e-28    , },
+  },
+  /* n = 31 */
+  {
+    /* x = 0.0         */  {0.006024552028046141      , -0.005833668297732088     , 0.0028272495452852696     , -0.0009143331580716975    , 0.0002219684639728614     , -4.3145089261613056e-05   , 6.994125469182692e-06     , -9.725532843760421e-07    , 1.184158174691737e-07     , -1.2824624894811166e-08   , 1.250602675317862e-09     , -1.1096014852186895e-10   , 9.197847337032282e-12     , -6.896026337239269e-13    , },
+    /* x = 2.0         */  {0.0008703720268920191     , -0.0008410615543888679    , 0.00040682772228429077    , -0.00013132906717338146   , 3.1827537792400014e-05    , -6.17646670587316e-06     , 9.997175789628289e-07     , -1.3881221237847853e-07   , 1.6878226690326747e-08    , -1.8255537676234625e-09   , 1.7779942277295025e-10    , -1.575666942045391e-11    , 1.3045993183605816e-12    , -9.770698476772884e-14    , },
+    /* x = 4.0         */  {0.00012627542182694205    , -0.00012174045760118752   , 5.875913724957452e-05     , -1.8929623205983673e-05   , 4.578820867651617e-06     , -8.869697992439321e-07    , 1.433206158631705e-07     , -1.986837923981443e-08    , 2.412140175420714e-09     , -2.6052290992095254e-10   , 2.5339004270987568e-11    , -2.2426453366690984e-12   , 1.8544680912501302e-13    , -1.3872698362353308e-14   , },
+    /* x = 6.0         */  {1.8407662751314598e-05    , -1.7700056269878747e-05   , 8.522203285269873e-06     , -2.739205650855448e-06    , 6.61158255680058e-07      , -1.2781648933479354e-07   , 2.061413486281083e-08     , -2.8526264854643443e-09   , 3.457440095310265e-10     , -3.728273615789654e-11    , 3.620749233581158e-12     , -3.2000003433843216e-13   , 2.6424132239185252e-14    , -1.9741811397933806e-15   , },
+    /* x = 8.0         */  {2.6978578250837214e-06    , -2.5864021607552634e-06   , 1.2418426767334485e-06    , -3.98121431441039e-07     , 9.586219567484209e-08     , -1.849045247102073e-08    , 2.9758147582389664e-09    , -4.109809737332594e-10    , 4.9718556024149645e-11    , -5.351867353449272e-12    , 5.188872564097739e-13     , -4.578680409971037e-14    , 3.775036021842921e-15     , -2.816416002718662e-16    , },
+    /* x = 10.0        */  {3.978386166082249e-07     , -3.8009691163965857e-07   , 1.8192269241660633e-07    , -5.815106055745286e-08    , 1.396370886519443e-08     , -2.686537543646585e-09    , 4.31336366228996e-10      , -5.943779884628166e-11    , 7.1754694006516406e-12    , -7.708726629179714e-13    , 7.46012784515777e-14      , -6.571350895819018e-15    , 5.408718493251156e-16     , -4.028990180658866e-17    , },
+    /* x = 12.0        */  {5.9081775791758234e-08    , -5.622394107306583e-08    , 2.6812053130153378e-08    , -8.541575079872376e-09    , 2.044683775855721e-09     , -3.922473547955674e-10    , 6.280755408101162e-11     , -8.633077947821936e-12    , 1.0397558642899837e-12    , -1.1145672004986412e-13   , 1.0763948949186494e-14    , -9.463124128020676e-16    , 7.774117562413989e-17     , -5.78104260627422e-18     , },
+    /* x = 14.0        */  {8.845649232640679e-09     , -8.379119371817886e-09    , 3.979007311104926e-09     , -1.2626925510351017e-09   , 3.01183882825888e-10      , -5.758750439369685e-11    , 9.19278780355005e-12      , -1.2599750251783748e-12   , 1.5134673992009358e-13    , -1.6183399090532448e-14   , 1.559289458083782e-15     , -1.3678654446893956e-16   , 1.1213508718706465e-17    , -8.322724167468573e-19    , },
+    /* x = 16.0        */  {1.336917792698359e-09     , -1.2596012868277907e-09   , 5.952162714109998e-10     , -1.8803727049624648e-10   , 4.4666731371189434e-11    , -8.508022810384879e-12    , 1.3533865358447425e-12    , -1.848943519857189e-13    , 2.2142317621683928e-14    , -2.3610170423673085e-15   , 2.2689157236803894e-16    , -1.985503867373649e-17    , 1.6238255411497453e-18    , -1.2026360612440304e-19   , },
+    /* x = 18.0        */  {2.0430035190239517e-10    , -1.912664666398321e-10    , 8.986215650066747e-11     , -2.8240054971727568e-11   , 6.676081492289069e-12     , -1.2660628124998853e-12   , 2.005816433542831e-13     , -2.730060756570551e-14    , 3.258164553377478e-15     , -3.463056451463052e-16    , 3.318090621536128e-17     , -2.8955929711263282e-18   , 2.361817975030666e-19     , -1.745008802148318e-20    , },
+    /* x = 20.0        */  {3.1627305883479947e-11    , -2.938724352066773e-11    , 1.3713271262524242e-11    , -4.283025025346443e-12    , 1.0068614263253261e-12    , -1.8996742611529425e-13   , 2.99556416636201e-14      , -4.059658990628176e-15    , 4.825782968007192e-16     , -5.110502833138089e-17    , 4.880005718029429e-18     , -4.2452405915104735e-19   , 3.4522174005762325e-20    , -2.543731152576441e-21    , },
+    /* x = 22.0        */  {4.971677083843545e-12     , -4.578192607937484e-12    , 2.1191709043357555e-12    , -6.570655973333616e-13    , 1.5344779074672437e-13    , -2.8778304186378916e-14   , 4.513259280930092e-15     , -6.085973343638464e-16    , 7.201400361426513e-17     , -7.594185661548174e-18    , 7.223531641717109e-19     , -6.261367042685218e-20    , 5.074233152205181e-21     , -3.7274062109099526e-22   , },
+    /* x = 24.0        */  {7.95834449186777e-13      , -7.249925286760581e-13    , 3.3236570498975275e-13    , -1.0216353534555998e-13   , 2.3673133140798834e-14    , -4.408512501001744e-15    , 6.869618191317546e-16     , -9.209521639345151e-17    , 1.0839480430988654e-17    , -1.1375006324756654e-18   , 1.077141069642057e-19     , -9.298158597802e-21       , 7.505642926223534e-22     , -5.494136497985082e-23    , },
+    /* x = 26.0        */  {1.3016543608141277e-13    , -1.1705358623314663e-13   , 5.3045873042728995e-14    , -1.613771040489924e-14    , 3.704848218539061e-15     , -6.841871215608959e-16    , 1.0581148003036649e-16    , -1.408837128314156e-17    , 1.6478772941931514e-18    , -1.7194839697574334e-19   , 1.6197960752778036e-20    , -1.3915879245715847e-21   , 1.11823708200806e-22      , -8.152616022401842e-24    , },
+    /* x = 28.0        */  {2.1840229387923715e-14    , -1.9337377356922434e-14   , 8.642784167777169e-15     , -2.5970302119096515e-15   , 5.896580050394232e-16     , -1.0781762583758043e-16   , 1.6525762299849092e-17    , -2.1826238465103727e-18   , 2.5343233928332505e-19    , -2.6269057142344634e-20   , 2.459649632692632e-21     , -2.1014290530797977e-22   , 1.6798180235840666e-23    , -1.2190172455813166e-24   , },
+    /* x = 30.0        */  {3.776583141482991e-15     , -3.2822575294956223e-15   , 1.4429190994556236e-15    , -4.2722147376981224e-16   , 9.572911227118808e-17     , -1.7298069384742048e-17   , 2.623349374791982e-18     , -3.4317746940996497e-19   , 3.950478546662619e-20     , -4.0628804822504845e-21   , 3.7772720174779844e-22    , -3.2063329563152504e-23   , 2.5474824532059473e-24    , -1.8387548002794801e-25   , },
+    /* x = 32.0        */  {6.764310636119852e-16     , -5.750950130674493e-16    , 2.4789613412331704e-16    , -7.211918138238266e-17    , 1.59081154973305e-17      , -2.8344119522619595e-18   , 4.24464698113003e-19      , -5.490081657139316e-20    , 6.2556514327409865e-21    , -6.374552780751593e-22    , 5.877161990116215e-23     , -4.951126287817836e-24    , 3.905883101238663e-25     , -2.8016526067874115e-26   , },
+    /* x = 34.0        */  {1.2616571711503565e-16    , -1.0454183574617921e-16   , 4.403362605347478e-17     , -1.2547605274169742e-17   , 2.7167838735618427e-18    , -4.760581005321242e-19    , 7.02332791274046e-20      , -8.96282711851766e-21     , 1.0089940949590524e-21    , -1.0170286624305955e-22   , 9.284917435019739e-24     , -7.752523375660835e-25    , 6.065158654589568e-26     , -4.318790300496454e-27    , },
+    /* x = 36.0        */  {2.463244368724421e-17     , -1.9817749676201952e-17   , 8.127184139835185e-18     , -2.2606130596408353e-18   , 4.789207941717314e-19     , -8.229172939204489e-20    , 1.1928398470202273e-20    , -1.4982921565666093e-21   , 1.6628029144628213e-22    , -1.654625563782022e-23    , 1.4931622328683457e-24    , -1.2337180425951269e-25   , 9.55807490889252e-27      , -6.747926628872728e-28    , },
+  },
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#define BOYS_SHORTGRID_MAXN 31
+#define BOYS_SHORTGRID_MAXX 36.5
+#define BOYS_SHORTGRID_ORDER 13
+#define BOYS_SHORTGRID_SPACE 2.0
+#define BOYS_SHORTGRID_NINTERVAL 19
+#define BOYS_SHORTGRID_LOOKUPFAC 0.5
+
@@ -1,14 +1,136 @@
 #pragma once
 
-#include "simint/boys/boys_shortgrid.h"
 #include "simint/vectorization/vectorization.h"
 
+#ifdef SIMINT_BOYS_CHEBYSHEV
+#include "simint/boys/boys_shortgrid_chebyshev.h"
+#else
+#include "simint/boys/boys_shortgrid.h"
+#endif
+
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
 extern "C" {
 #endif
 
-extern double boys_shortgrid[BOYS_SHORTGRID_NPOINT][BOYS_SHORTGRID_MAXN+1];
+#ifdef SIMINT_BOYS_CHEBYSHEV
+
+// Piecewise polynomial fits of Fn(x) for x < BOYS_SHORTGRID_MAXX
+// (see python/boys/gen_boys_shortgrid.py). For each n, the range of x
+// is split into intervals of width BOYS_SHORTGRID_SPACE, and the
+// coefficients for an interval are stored contiguously, as
+// coefficients of (x - middle of interval)^k. The functions keep
+// the names of the Taylor versions below, so boys.h uses either.
+extern const double boys_shortgrid[BOYS_SHORTGRID_MAXN+1][BOYS_SHORTGRID_NINTERVAL][BOYS_SHORTGRID_ORDER+1];
+
+
+/*! \brief Evaluates the polynomial for Fn on an interval
+ *
+ * \param [in] n   The order of the Boys function
+ * \param [in] idx The interval containing x
+ * \param [in] dx  x minus the middle of the interval
+ */
+static inline
+double boys_F_taylor_eval(int n, int idx, double dx)
+{
+    double const * restrict coef = boys_shortgrid[n][idx];
+
+    double f = coef[BOYS_SHORTGRID_ORDER];
+    for(int k = BOYS_SHORTGRID_ORDER-1; k >= 0; k--)
+        f = f*dx + coef[k];
+    return f;
+}
+
+
+static inline
+void boys_F_taylor(double * restrict F, double x, int n)
+{
+    const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*x);
+    const double dx = x - ((double)lookup_idx + 0.5) * BOYS_SHORTGRID_SPACE;
+
+    #ifndef SIMINT_SCALAR
+    #pragma omp simd
+    #endif
+    for(int i = 0; i <= n; ++i)
+        F[i*SIMINT_SIMD_LEN] = boys_F_taylor_eval(i, lookup_idx, dx);
+}
+
+static inline
+double boys_F_taylor_single(double x, int n)
+{
+    const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*x);
+    const double dx = x - ((double)lookup_idx + 0.5) * BOYS_SHORTGRID_SPACE;
+
+    return boys_F_taylor_eval(n, lookup_idx, dx);
+}
+
+static inline
+void boys_F_taylor_vec(SIMINT_DBLTYPE * restrict F, SIMINT_DBLTYPE x, int n)
+{
+    double * restrict Fd = (double *)F;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*xd[v]);
+        const double dx = xd[v] - ((double)lookup_idx + 0.5) * BOYS_SHORTGRID_SPACE;
+
+        for(int i = 0; i <= n; ++i)
+            Fd[i*SIMINT_SIMD_LEN + v] = boys_F_taylor_eval(i, lookup_idx, dx);
+    }
+}
+
+static inline
+SIMINT_DBLTYPE boys_F_taylor_single_vec(SIMINT_DBLTYPE x, int n)
+{
+    SIMINT_DBLTYPE ret;
+    double * retd = (double *)&ret;
+    double * restrict xd = (double *)&x;
+
+    #ifndef SIMINT_SCALAR
+      // workaround for GCC missing simdlen??
+      #if defined __clang__ || defined __INTEL_COMPILER
+        #pragma omp simd simdlen(SIMINT_SIMD_LEN)
+      #else
+        #pragma omp simd
+      #endif
+    #endif
+    for(int v = 0; v < SIMINT_SIMD_LEN; v++)
+    {
+        const int lookup_idx = (int)(BOYS_SHORTGRID_LOOKUPFAC*xd[v]);
+        const double dx = xd[v] - ((double)lookup_idx + 0.5) * BOYS_SHORTGRID_SPACE;
+
+        retd[v] = boys_F_taylor_eval(n, lookup_idx, dx);
+    }
+
+    return ret;
+}
+
+#else
+
+// Fn(x) at the grid points (see python/boys/gen_boys_shortgrid.py).
+// By default, F0 through F(BOYS_SHORTGRID_MAXN) at a point are
+// contiguous. With SIMINT_BOYS_TRANSPOSED, Fn at all the points is
+// contiguous instead, so lanes with nearby x read nearby memory.
+// BOYS_SHORTGRID_PTR gives Fn at a point, and F(n+k) is
+// k*BOYS_SHORTGRID_STRIDE further on.
+#ifdef SIMINT_BOYS_TRANSPOSED
+  extern double boys_shortgrid[BOYS_SHORTGRID_MAXN+1][BOYS_SHORTGRID_NPOINT];
+  #define BOYS_SHORTGRID_PTR(idx, n) (&(boys_shortgrid[(n)][(idx)]))
+  #define BOYS_SHORTGRID_STRIDE BOYS_SHORTGRID_NPOINT
+#else
+  extern double boys_shortgrid[BOYS_SHORTGRID_NPOINT][BOYS_SHORTGRID_MAXN+1];
+  #define BOYS_SHORTGRID_PTR(idx, n) (&(boys_shortgrid[(idx)][(n)]))
+  #define BOYS_SHORTGRID_STRIDE 1
+#endif
 
 static inline
 void boys_F_taylor(double * restrict F, double x, int n)
@@ -18,23 +140,23 @@ void boys_F_taylor(double * restrict F, double x, int n)
     const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
     const double dx = xi-x;   // -delta x
 
-    double const * restrict gridpts = &(boys_shortgrid[lookup_idx][0]);
+    double const * restrict gridpts = BOYS_SHORTGRID_PTR(lookup_idx, 0);
 
     #ifndef SIMINT_SCALAR
     #pragma omp simd
     #endif
     for(int i = 0; i <= n; ++i)
     {
-        double const * restrict gridpts2 = gridpts + i;
+        double const * restrict gridpts2 = gridpts + i*BOYS_SHORTGRID_STRIDE;
 
         F[i*SIMINT_SIMD_LEN] = gridpts2[0]
-               + dx * (                  gridpts2[1]
-               + dx * ( (1.0/2.0   )   * gridpts2[2]
-               + dx * ( (1.0/6.0   )   * gridpts2[3]
-               + dx * ( (1.0/24.0  )   * gridpts2[4]
-               + dx * ( (1.0/120.0 )   * gridpts2[5]
-               + dx * ( (1.0/720.0 )   * gridpts2[6]
-               + dx * ( (1.0/5040.0)   * gridpts2[7]
+               + dx * (                  gridpts2[1*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/2.0   )   * gridpts2[2*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/6.0   )   * gridpts2[3*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/24.0  )   * gridpts2[4*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/120.0 )   * gridpts2[5*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/720.0 )   * gridpts2[6*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/5040.0)   * gridpts2[7*BOYS_SHORTGRID_STRIDE]
                )))))));
     }
 }
@@ -46,16 +168,16 @@ double boys_F_taylor_single(double x, int n)
     const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
     const double dx = xi-x;   // -delta x
 
-    double const * restrict gridpts = &(boys_shortgrid[lookup_idx][n]);
+    double const * restrict gridpts = BOYS_SHORTGRID_PTR(lookup_idx, n);
 
     return gridpts[0]
-           + dx * (                  gridpts[1]
-           + dx * ( (1.0/2.0   )   * gridpts[2]
-           + dx * ( (1.0/6.0   )   * gridpts[3]
-           + dx * ( (1.0/24.0  )   * gridpts[4]
-           + dx * ( (1.0/120.0 )   * gridpts[5]
-           + dx * ( (1.0/720.0 )   * gridpts[6]
-           + dx * ( (1.0/5040.0)   * gridpts[7]
+           + dx * (                  gridpts[1*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/2.0   )   * gridpts[2*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/6.0   )   * gridpts[3*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/24.0  )   * gridpts[4*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/120.0 )   * gridpts[5*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/720.0 )   * gridpts[6*BOYS_SHORTGRID_STRIDE]
+           + dx * ( (1.0/5040.0)   * gridpts[7*BOYS_SHORTGRID_STRIDE]
            )))))));
 }
 
@@ -79,20 +201,20 @@ void boys_F_taylor_vec(SIMINT_DBLTYPE * restrict F, SIMINT_DBLTYPE x, int n)
         const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
         const double dx = xi-xd[v];   // -delta x
 
-        double const * restrict gridpts = &(boys_shortgrid[lookup_idx][0]);
+        double const * restrict gridpts = BOYS_SHORTGRID_PTR(lookup_idx, 0);
 
         for(int i = 0; i <= n; ++i)
         {
-            double const * restrict gridpts2 = gridpts + i;
+            double const * restrict gridpts2 = gridpts + i*BOYS_SHORTGRID_STRIDE;
 
             Fd[i*SIMINT_SIMD_LEN + v] = gridpts2[0]
-                   + dx * (                  gridpts2[1]
-                   + dx * ( (1.0/2.0   )   * gridpts2[2]
-                   + dx * ( (1.0/6.0   )   * gridpts2[3]
-                   + dx * ( (1.0/24.0  )   * gridpts2[4]
-                   + dx * ( (1.0/120.0 )   * gridpts2[5]
-                   + dx * ( (1.0/720.0 )   * gridpts2[6]
-                   + dx * ( (1.0/5040.0)   * gridpts2[7]
+                   + dx * (                  gridpts2[1*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/2.0   )   * gridpts2[2*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/6.0   )   * gridpts2[3*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/24.0  )   * gridpts2[4*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/120.0 )   * gridpts2[5*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/720.0 )   * gridpts2[6*BOYS_SHORTGRID_STRIDE]
+                   + dx * ( (1.0/5040.0)   * gridpts2[7*BOYS_SHORTGRID_STRIDE]
                    )))))));
         }
     }
@@ -119,22 +241,24 @@ SIMINT_DBLTYPE boys_F_taylor_single_vec(SIMINT_DBLTYPE x, int n)
         const double xi = ((double)lookup_idx * BOYS_SHORTGRID_SPACE);
         const double dx = xi-xd[v];   // -delta x
 
-        double const * restrict gridpts = &(boys_shortgrid[lookup_idx][n]);
+        double const * restrict gridpts = BOYS_SHORTGRID_PTR(lookup_idx, n);
 
         retd[v] = gridpts[0]
-               + dx * (                  gridpts[1]
-               + dx * ( (1.0/2.0   )   * gridpts[2]
-               + dx * ( (1.0/6.0   )   * gridpts[3]
-               + dx * ( (1.0/24.0  )   * gridpts[4]
-               + dx * ( (1.0/120.0 )   * gridpts[5]
-               + dx * ( (1.0/720.0 )   * gridpts[6]
-               + dx * ( (1.0/5040.0)   * gridpts[7]
+               + dx * (                  gridpts[1*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/2.0   )   * gridpts[2*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/6.0   )   * gridpts[3*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/24.0  )   * gridpts[4*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/120.0 )   * gridpts[5*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/720.0 )   * gridpts[6*BOYS_SHORTGRID_STRIDE]
+               + dx * ( (1.0/5040.0)   * gridpts[7*BOYS_SHORTGRID_STRIDE]
                )))))));
     }
 
     return ret;
 }
 
+#endif // SIMINT_BOYS_CHEBYSHEV
+
 
 #ifdef __cplusplus
 }
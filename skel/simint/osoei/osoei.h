@@ -1,6 +1,7 @@
 #pragma once
 
 #include "simint/shell/shell.h"
+#include "simint/vectorization/vectorization.h"
 
 #ifdef __cplusplus
 #include "simint/cpp_restrict.hpp"
@@ -21,6 +22,39 @@ void simint_osoei_ke_terms(const double alpha1, const double * xyz1,
                            double * restrict terms);
 
 
+/*! \brief Finds the shell pair of each lane of a vector of primitive pairs
+ *
+ * Used when vectorizing over the primitive pairs of a batch of (up to
+ * SIMINT_NSHELL_SIMD) shell pairs of a simint_multi_shellpair. On the
+ * first call, \p ab should be the first shell pair of the batch and
+ * \p left its number of primitives. Lanes past the last primitive are
+ * given to the last shell pair (and should be masked out by the caller).
+ *
+ * \param [in] P The multi shell pair
+ * \param [in] ab0 The first shell pair of the batch
+ * \param [in] abend One past the last shell pair of the batch
+ * \param [inout] ab The shell pair of the next primitive
+ * \param [inout] left Number of primitives of \p ab not yet given a lane
+ * \param [out] lanes The shell pair (relative to \p ab0) of each lane
+ */
+static inline
+void simint_osoei_lane_shells(struct simint_multi_shellpair const * P,
+                              int ab0, int abend, int * ab, int * left,
+                              int * lanes)
+{
+    for(int n = 0; n < SIMINT_SIMD_LEN; n++)
+    {
+        while(*left == 0 && *ab < abend-1)
+            *left = P->nprim12[++(*ab)];
+
+        if(*left > 0)
+            (*left)--;
+
+        lanes[n] = *ab - ab0;
+    }
+}
+
+
 int simint_compute_osoei_overlap(struct simint_shell const * sh1,
                                  struct simint_shell const * sh2,
                                  double * restrict integrals);
@@ -29,12 +63,23 @@ int simint_compute_osoei_ke(struct simint_shell const * sh1,
                             struct simint_shell const * sh2,
                             double * restrict integrals);
 
+int simint_compute_osoei_overlap_multi(struct simint_multi_shellpair const * P,
+                                       double * restrict integrals);
+
+int simint_compute_osoei_ke_multi(struct simint_multi_shellpair const * P,
+                                  double * restrict integrals);
+
 int simint_compute_osoei_potential(int ncenter,
                                    double * Z, double * x, double * y, double * z,
                                    struct simint_shell const * sh1,
                                    struct simint_shell const * sh2,
                                    double * restrict integrals);
 
+int simint_compute_osoei_potential_multi(int ncenter,
+                                         double * Z, double * x, double * y, double * z,
+                                         struct simint_multi_shellpair const * P,
+                                         double * restrict integrals);
+
 #ifdef __cplusplus
 }
 #endif
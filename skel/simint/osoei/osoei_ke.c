@@ -1,9 +1,12 @@
 #include <math.h>
 #include <string.h>
+#include "simint/constants.h"
 #include "simint/recur_lookup.h"
+#include "simint/simint_workspace.h"
 #include "simint/osoei/osoei.h"
 
 #define NCART(am) ((am>=0)?((((am)+2)*((am)+1))>>1):0)
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
 #define S_IJ(i,j) (s_ij[((i)*(nam2) + j)])
 #define T_IJ(i,j) (t_ij[((i)*(nam2) + j)])
 
@@ -67,3 +70,173 @@ int simint_compute_osoei_ke(struct simint_shell const * sh1,
     return 1;
 }
 
+
+// Same as simint_osoei_ke_terms, but for a vector of primitive
+// pairs, and without the exp(-mu AB^2) (pi/p)^(1/2) factor (ie, S(0,0) = 1)
+static void ke_terms_vec(SIMINT_DBLTYPE alpha1, SIMINT_DBLTYPE alpha2,
+                         SIMINT_DBLTYPE oop,
+                         SIMINT_DBLTYPE const * PA,
+                         SIMINT_DBLTYPE const * PB,
+                         int nam1, int nam2,
+                         SIMINT_DBLTYPE * restrict terms)
+{
+    const SIMINT_DBLTYPE oo2p = SIMINT_MUL(SIMINT_DBLSET1(0.5), oop);
+    const SIMINT_DBLTYPE mu2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), SIMINT_MUL(SIMINT_MUL(alpha1, alpha2), oop));
+    const SIMINT_DBLTYPE a1oop = SIMINT_MUL(alpha1, oop);
+    const SIMINT_DBLTYPE a2oop = SIMINT_MUL(alpha2, oop);
+    const SIMINT_DBLTYPE a1sq = SIMINT_MUL(SIMINT_DBLSET1(2.0), SIMINT_MUL(alpha1, alpha1));
+
+    for(int d = 0; d < 3; d++)
+    {
+        SIMINT_DBLTYPE * const restrict s_ij = terms + d*nam1*nam2;
+        SIMINT_DBLTYPE * const restrict t_ij = terms + (d+3)*nam1*nam2;
+
+        S_IJ(0,0) = SIMINT_DBLSET1(1.0);
+        T_IJ(0,0) = SIMINT_SUB(alpha1, SIMINT_MUL(a1sq, SIMINT_FMADD(PA[d], PA[d], oo2p)));
+
+        // do j = 0 for all remaining i
+        for(int i = 1; i < nam1; i++)
+        {
+            S_IJ(i,0) = SIMINT_MUL(PA[d], S_IJ(i-1,0));
+            if(i > 1)
+                S_IJ(i,0) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(i-1), oo2p), S_IJ(i-2,0), S_IJ(i,0));
+
+            T_IJ(i,0) = SIMINT_FMADD(PA[d], T_IJ(i-1,0), SIMINT_MUL(mu2, S_IJ(i,0)));
+            if(i > 1)
+                T_IJ(i,0) = SIMINT_ADD(T_IJ(i,0), SIMINT_MUL(SIMINT_DBLSET1(i-1),
+                                                             SIMINT_FMSUB(oo2p, T_IJ(i-2,0),
+                                                                          SIMINT_MUL(a2oop, S_IJ(i-2,0)))));
+        }
+
+        // now do i = 0 for all remaining j
+        for(int j = 1; j < nam2; j++)
+        {
+            S_IJ(0,j) = SIMINT_MUL(PB[d], S_IJ(0,j-1));
+            if(j > 1)
+                S_IJ(0,j) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(j-1), oo2p), S_IJ(0,j-2), S_IJ(0,j));
+
+            T_IJ(0,j) = SIMINT_FMADD(PB[d], T_IJ(0,j-1), SIMINT_MUL(mu2, S_IJ(0,j)));
+            if(j > 1)
+                T_IJ(0,j) = SIMINT_ADD(T_IJ(0,j), SIMINT_MUL(SIMINT_DBLSET1(j-1),
+                                                             SIMINT_FMSUB(oo2p, T_IJ(0,j-2),
+                                                                          SIMINT_MUL(a1oop, S_IJ(0,j-2)))));
+        }
+
+        // now all the rest
+        for(int i = 1; i < nam1; i++)
+        for(int j = 1; j < nam2; j++)
+        {
+            const SIMINT_DBLTYPE ioo2p = SIMINT_MUL(SIMINT_DBLSET1(i), oo2p);
+
+            S_IJ(i,j) = SIMINT_FMADD(ioo2p, S_IJ(i-1,j-1), SIMINT_MUL(PB[d], S_IJ(i,j-1)));
+            if(j > 1)
+                S_IJ(i,j) = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(j-1), oo2p), S_IJ(i,j-2), S_IJ(i,j));
+
+            T_IJ(i,j) = SIMINT_FMADD(PB[d], T_IJ(i,j-1), SIMINT_MUL(ioo2p, T_IJ(i-1,j-1)));
+            T_IJ(i,j) = SIMINT_FMADD(mu2, S_IJ(i,j), T_IJ(i,j));
+            if(j > 1)
+                T_IJ(i,j) = SIMINT_ADD(T_IJ(i,j), SIMINT_MUL(SIMINT_DBLSET1(j-1),
+                                                             SIMINT_FMSUB(oo2p, T_IJ(i,j-2),
+                                                                          SIMINT_MUL(a1oop, S_IJ(i,j-2)))));
+        }
+    }
+}
+
+
+int simint_compute_osoei_ke_multi(struct simint_multi_shellpair const * P,
+                                  double * restrict integrals)
+{
+    const int am1 = P->am1;
+    const int am2 = P->am2;
+
+    const int nam1 = am1 + 1;
+    const int nam2 = am2 + 1;
+    const int nam12 = nam1*nam2;
+
+    const int ncart1 = NCART(am1);
+    const int ncart2 = NCART(am2);
+    const int ncart12 = ncart1*ncart2;
+
+    // Mostly needed just for the ordering
+    struct RecurInfo const * aminfo1 =  &recurinfo_array[am_recur_map[am1]];
+    struct RecurInfo const * aminfo2 =  &recurinfo_array[am_recur_map[am2]];
+
+    // Workspace for calculating terms
+    SIMINT_DBLTYPE work[6*nam12];
+    SIMINT_DBLTYPE * prim = (SIMINT_DBLTYPE *)simint_workspace_acquire_size(ncart12*SIMINT_SIMD_LEN);
+
+    // The shell pair prefactor is for ERI. Like the overlap, this
+    // needs (pi/p)^(3/2) rather than sqrt(2) pi^(5/4) / p
+    const SIMINT_DBLTYPE const_fac = SIMINT_DBLSET1(PI*sqrt(PI) / SQRT_TWO_PI_52);
+    const SIMINT_DBLTYPE one = SIMINT_DBLSET1(1.0);
+
+    memset(integrals, 0, (size_t)P->nshell12_clip*ncart12*sizeof(double));
+
+    // vectorized over the primitive pairs of SIMINT_NSHELL_SIMD shell pairs,
+    // whose primitives are stored contiguously and padded
+    int istart = 0;
+    for(int ab0 = 0; ab0 < P->nshell12_clip; ab0 += SIMINT_NSHELL_SIMD)
+    {
+        const int abend = MIN(ab0 + SIMINT_NSHELL_SIMD, P->nshell12_clip);
+
+        int iend = istart;
+        for(int ab = ab0; ab < abend; ab++)
+            iend += P->nprim12[ab];
+
+        int ab = ab0;
+        int left = P->nprim12[ab0];
+
+        for(int i = istart; i < iend; i += SIMINT_SIMD_LEN)
+        {
+            int lanes[SIMINT_SIMD_LEN];
+            simint_osoei_lane_shells(P, ab0, abend, &ab, &left, lanes);
+
+            const SIMINT_DBLTYPE p = SIMINT_DBLLOAD(P->alpha, i);
+            const SIMINT_DBLTYPE alpha1 = SIMINT_DBLLOAD(P->alpha_a, i);
+            const SIMINT_DBLTYPE alpha2 = SIMINT_DBLLOAD(P->beta, i);
+            const SIMINT_DBLTYPE PA[3] = { SIMINT_DBLLOAD(P->PA_x, i),
+                                           SIMINT_DBLLOAD(P->PA_y, i),
+                                           SIMINT_DBLLOAD(P->PA_z, i) };
+            const SIMINT_DBLTYPE PB[3] = { SIMINT_DBLLOAD(P->PB_x, i),
+                                           SIMINT_DBLLOAD(P->PB_y, i),
+                                           SIMINT_DBLLOAD(P->PB_z, i) };
+
+            // lanes past the end of the batch may belong to shell pairs
+            // that aren't calculated (past nshell12_clip)
+            const SIMINT_DBLTYPE prefac = mask_load(MIN(iend - i, SIMINT_SIMD_LEN), P->prefac + i);
+            const SIMINT_DBLTYPE fac = SIMINT_MUL(prefac, SIMINT_DIV(const_fac, SIMINT_SQRT(p)));
+
+            ke_terms_vec(alpha1, alpha2, SIMINT_DIV(one, p), PA, PB, nam1, nam2, work);
+
+            int outidx = 0;
+            for(int n = 0; n < ncart1; n++)
+            for(int m = 0; m < ncart2; m++)
+            {
+                const int8_t * ijk1 = aminfo1[n].ijk;
+                const int8_t * ijk2 = aminfo2[m].ijk;
+                const int xidx = ijk1[0]*nam2 + ijk2[0];
+                const int yidx = ijk1[1]*nam2 + ijk2[1];
+                const int zidx = ijk1[2]*nam2 + ijk2[2];
+
+                const SIMINT_DBLTYPE sx = work[0*nam12 + xidx];
+                const SIMINT_DBLTYPE sy = work[1*nam12 + yidx];
+                const SIMINT_DBLTYPE sz = work[2*nam12 + zidx];
+
+                // Tij*Skl*Smn + Sij*Tkl*Smn + Sij*Skl*Tmn
+                SIMINT_DBLTYPE val = SIMINT_MUL(SIMINT_MUL(work[3*nam12 + xidx], sy), sz);
+                val = SIMINT_FMADD(SIMINT_MUL(sx, work[4*nam12 + yidx]), sz, val);
+                val = SIMINT_FMADD(SIMINT_MUL(sx, sy), work[5*nam12 + zidx], val);
+
+                prim[outidx++] = SIMINT_MUL(fac, val);
+            }
+
+            contract(ncart12, lanes, prim, integrals + ab0*ncart12);
+        }
+
+        istart = SIMINT_SIMD_ROUND(iend);
+    }
+
+    simint_workspace_release((double *)prim);
+
+    return P->nshell12_clip;
+}
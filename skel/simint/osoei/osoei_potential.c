@@ -4,215 +4,426 @@
 #include "simint/boys/boys.h"
 #include "simint/constants.h"
 #include "simint/recur_lookup.h"
+#include "simint/simint_workspace.h"
+#include "simint/vectorization/vectorization.h"
 #include "simint/osoei/osoei.h"
 
 #define NCART(am) ((am>=0)?((((am)+2)*((am)+1))>>1):0)
+#define MAX(a,b) (((a) > (b)) ? (a) : (b))
 
-int simint_compute_osoei_potential(int ncenter,
-                                   double * Z, double * x, double * y, double * z,
-                                   struct simint_shell const * sh1,
-                                   struct simint_shell const * sh2,
-                                   double * restrict integrals)
+// Number of point charges (a multiple of any SIMD length) handled
+// together. All primitive pairs of a shell pair are run over one block
+// before moving to the next, so the block stays in L1 cache.
+#define POTENTIAL_CENTER_BLOCK 256
+
+
+// Primitive pair data of a single shell pair. The prefactor of
+// each pair (2 pi / p * c_a * c_b * exp(-mu AB^2)) is fac[i]*scale
+struct potential_pairs
+{
+    int nprim;
+    double const * alpha;
+    double const * P[3];
+    double const * PA[3];
+    double const * PB[3];
+    double const * fac;
+    double scale;
+};
+
+
+// Offsets (in vectors) of the (i,j) blocks of the recurrence workspace.
+// Each block stores all the values of m it needs, with the cartesians
+// of i and j fastest. Returns the total number of vectors.
+static int potential_offsets(int am1, int am2, int * offsets)
 {
-    const int am1 = sh1->am;
-    const int am2 = sh2->am;
     const int am12 = am1 + am2;
+    int total = 0;
 
-    const int nam1 = am1 + 1;
-    const int nam2 = am2 + 1;
-    const int nam12 = nam1*nam2;
+    for(int i = 0; i <= am1; i++)
+    for(int j = 0; j <= am2; j++)
+    {
+        // (i,0) needs [0, am12-i], (i,j) needs [0, am2-j]
+        const int nm = (j == 0) ? (am12 - i + 1) : (am2 - j + 1);
+        offsets[i*(am2+1) + j] = total;
+        total += NCART(i) * NCART(j) * nm;
+    }
 
-    // Workspace for calculating terms
-    double work[6*nam12];
+    return total;
+}
 
-    const double xyz1[3] = { sh1->x, sh1->y, sh1->z };
-    const double xyz2[3] = { sh2->x, sh2->y, sh2->z };
 
-    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
-    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+// Copies the point charges into (aligned) workspace, padding to a
+// multiple of the vector length with zero charges. The charges,
+// x, y, and z coordinates are stored one after the other, each
+// with length *npad
+static double * potential_pack_centers(int ncenter,
+                                       double const * Z, double const * x,
+                                       double const * y, double const * z,
+                                       int * npad)
+{
+    const int n = SIMINT_SIMD_ROUND(ncenter);
+    double * centers = simint_workspace_acquire_size(4*(size_t)n);
+
+    memcpy(centers,       Z, ncenter*sizeof(double));
+    memcpy(centers +   n, x, ncenter*sizeof(double));
+    memcpy(centers + 2*n, y, ncenter*sizeof(double));
+    memcpy(centers + 3*n, z, ncenter*sizeof(double));
 
-    const int ncart1 = NCART(am1);
-    const int ncart2 = NCART(am2);
-    const int ncart12 = ncart1*ncart2;
+    for(int i = ncenter; i < n; i++)
+    {
+        centers[i] = 0.0;
+        centers[n+i] = 0.0;
+        centers[2*n+i] = 0.0;
+        centers[3*n+i] = 0.0;
+    }
+
+    *npad = n;
+    return centers;
+}
 
-    //TODO - too big
-    double amwork[nam1][nam2][NCART(am1+1)*NCART(am2+1)*(nam1+nam2+1)];
 
-    // Zero the output array
-    memset(integrals, 0, ncart12*sizeof(double));
+// Vertical recurrence for one primitive pair and SIMINT_SIMD_LEN point
+// charges. On entry, the (0,0) block holds the boys function (times
+// the prefactors) for m = [0, am1+am2]. On exit, the (am1,am2)
+// block holds the final integrals
+static void potential_vrr(int am1, int am2, int const * restrict offsets,
+                          SIMINT_DBLTYPE const * restrict PA,
+                          SIMINT_DBLTYPE const * restrict PB,
+                          SIMINT_DBLTYPE const * restrict PC,
+                          SIMINT_DBLTYPE const * restrict oo2p_n,
+                          SIMINT_DBLTYPE * restrict amwork)
+{
+    const int am12 = am1 + am2;
+    const int nam2 = am2 + 1;
 
-    for(int n = 0; n < ncenter; n++)
+    for(int i = 0; i <= am1; i++)
     {
-        for(int a = 0; a < sh1->nprim; a++)
-        {
-            const double a1 = sh1->alpha[a];
-            const double a1xyz[3] = { a1*xyz1[0], a1*xyz1[1], a1*xyz1[2] };
+        const int arrstart1 = am_recur_map[i];
+        struct RecurInfo const * aminfo1 =  &recurinfo_array[arrstart1];
+
+        // number of cartesians in the previous two shells
+        const int incart   = NCART(i);
+        const int incart_1 = (i > 0) ? NCART(i-1) : 0;
+        const int incart_2 = (i > 1) ? NCART(i-2) : 0;
 
-            for(int b = 0; b < sh2->nprim; b++)
+        // only form if i != 0 (ie, don't do (0,0)
+        if(i > 0)
+        {
+            // form (i,0)
+            SIMINT_DBLTYPE * iwork = amwork + offsets[i*nam2];
+            SIMINT_DBLTYPE const * iwork14 = amwork + offsets[(i-1)*nam2];                // location of the 1st and 4th terms
+            SIMINT_DBLTYPE const * iwork25 = (i > 1) ? amwork + offsets[(i-2)*nam2] : NULL;  // location of the 2nd and 5th terms
+
+            // we need [0, am12-i] inclusive
+            const int max_m = am12 - i;
+            int idx = 0;
+            for(int m = 0; m <= max_m; m++)
             {
-                const double a2 = sh2->alpha[b];
-                const double p = a1 + a2;
-                const double oop = 1.0/(a1 + a2); // = 1/p = 1/(a1 + a2)
-                const double mu = a1*a2*oop; // (a1+a2)/(a1*a2)
-
-                const double oo2p = 0.5*oop;
-                const double a2xyz[3] = { a2*xyz2[0], a2*xyz2[1], a2*xyz2[2] };
-
-                const double P[3] = { (a1xyz[0]+a2xyz[0])*oop,
-                                      (a1xyz[1]+a2xyz[1])*oop,
-                                      (a1xyz[2]+a2xyz[2])*oop };
-
-                const double PA[3] = { P[0] - xyz1[0], P[1] - xyz1[1], P[2] - xyz1[2] };
-                const double PB[3] = { P[0] - xyz2[0], P[1] - xyz2[1], P[2] - xyz2[2] };
-                const double PC[3] = { P[0] - x[n], P[1] - y[n], P[2] - z[n] };
-                const double PC2 = PC[0]*PC[0] + PC[1]*PC[1] + PC[2]*PC[2];
-
-                // boys function
-                const double T = PC2 * p;
-
-                // TODO - HACK
-                SIMINT_DBLTYPE Ftmp[am12+1];
-                SIMINT_DBLTYPE Ttmp = SIMINT_DBLSET1(T);
-                boys_F_split(Ftmp, Ttmp, am12);
-                
-                for(int i = 0; i <= am12; i++)
+                const int offset_1 = m*incart_1;
+                const int offset_4 = offset_1 + incart_1;  // (m+1)*incart_1
+                const int offset_2 = m*incart_2;
+                const int offset_5 = offset_2 + incart_2;  // (m+1)*incart_2
+
+                for(int n = 0; n < incart; n++)
                 {
-                    //TODO - hacky type pun
-                    double * Fval = (double*)(&Ftmp[i]);
-                    amwork[0][0][i] = Fval[0] * 2*PI*oop*exp(-mu*AB2);
+                    const int8_t d = aminfo1[n].dir;
+                    const int8_t i_ijk = aminfo1[n].ijk[d];
+                    const int idx1 = offset_1 + aminfo1[n].idx[d][0]; // index for 1st term
+                    const int idx4 = offset_4 + aminfo1[n].idx[d][0]; // index for 4th term
+                    const int idx2 = offset_2 + aminfo1[n].idx[d][1]; // index for 2nd term
+                    const int idx5 = offset_5 + aminfo1[n].idx[d][1]; // index for 5th term
+
+                    // 1st and 4th terms
+                    iwork[idx] = SIMINT_FMSUB(PA[d], iwork14[idx1], SIMINT_MUL(PC[d], iwork14[idx4]));
+
+                    // 2nd and 5th terms
+                    if(i_ijk > 1)
+                        iwork[idx] = SIMINT_FMADD(oo2p_n[i_ijk-1], SIMINT_SUB(iwork25[idx2], iwork25[idx5]), iwork[idx]);
+
+                    idx++;
                 }
+            }
+        }
 
-                // nested recurrence
-                // we skip (0,0) since that is the boys function
-                for(int i = 0; i <= am1; i++)
-                {
-                    const int arrstart1 = am_recur_map[i];
-                    struct RecurInfo const * aminfo1 =  &recurinfo_array[arrstart1];
+        // now (i,j) via second vertical recurrence
+        for(int j = 1; j <= am2; j++)
+        {
+            const int arrstart2 = am_recur_map[j];
+            struct RecurInfo const * aminfo2 =  &recurinfo_array[arrstart2];
+
+            // number of cartesians in the previous two shells
+            const int jncart   = NCART(j);
+            const int jncart_1 = NCART(j-1);   // j can't be zero (loop starts at 1)
+            const int jncart_2 = (j > 1) ? NCART(j-2) : 0;
 
-                    // number of cartesians in the previous two shells
-                    const int incart   = NCART(i);
-                    const int incart_1 = (i > 0) ? NCART(i-1) : 0;
-                    const int incart_2 = (i > 1) ? NCART(i-2) : 0;
+            SIMINT_DBLTYPE * jwork = amwork + offsets[i*nam2 + j];
+            SIMINT_DBLTYPE const * jwork14 = amwork + offsets[i*nam2 + j-1];                        // location of the 1st and 4th terms
+            SIMINT_DBLTYPE const * jwork36 = (j > 1) ? amwork + offsets[i*nam2 + j-2] : NULL;       // location of the 3rd and 6th terms
+            SIMINT_DBLTYPE const * jwork25 = (i > 0) ? amwork + offsets[(i-1)*nam2 + j-1] : NULL;   // location of the 2nd and 5th terms
 
-                    // only form if i != 0 (ie, don't do (0,0)
-                    if(i > 0)
+            // need [0, am2-j] inclusive
+            const int max_m2 = am2 - j;
+
+            int cartidx = 0; // index of the pair of cartesians
+            for(int m = 0; m <= max_m2; m++)
+            {
+                for(int n = 0; n < incart; n++)
+                {
+                    // storage is  m, cart1, cart2
+                    const int offset1 = jncart_1*(m*incart + n);
+                    const int offset4 = jncart_1*((m+1)*incart + n);
+                    const int offset3 = jncart_2*(m*incart + n);
+                    const int offset6 = jncart_2*((m+1)*incart + n);
+
+                    for(int o = 0; o < jncart; o++)
                     {
-                        // form (i,0)
-                        double * iwork = amwork[i][0];
-                        double * iwork14 = amwork[i-1][0];                      // location of the 1st and 4th terms
-                        double * iwork25 = (i > 1) ? amwork[i-2][0] : NULL;  // location of the 2nd and 5th terms
-
-     
-                        // maximum value of (m) to calculate
-                        // we need [0, am12-i] inclusive
-                        const int max_m = am12 - i; 
-                        int idx = 0;
-                        for(int m = 0; m <= max_m; m++)
+                        const int8_t d = aminfo2[o].dir; // direction we should recurse
+                        const int8_t i_ijk = aminfo1[n].ijk[d];  // values of i and j in that direction
+                        const int8_t j_ijk = aminfo2[o].ijk[d];
+                        const int idx1 = offset1 + aminfo2[o].idx[d][0];     // 1st term
+                        const int idx4 = offset4 + aminfo2[o].idx[d][0];     // 4th term
+                        const int idx3 = offset3 + aminfo2[o].idx[d][1];     // 3rd term
+                        const int idx6 = offset6 + aminfo2[o].idx[d][1];     // 6th term
+
+                        // terms 1 & 4
+                        SIMINT_DBLTYPE val = SIMINT_FMSUB(PB[d], jwork14[idx1], SIMINT_MUL(PC[d], jwork14[idx4]));
+
+                        // terms 2 & 5
+                        if(i_ijk > 0)
                         {
-                            // commonly used in dimensioning
-                            const int offset_1 = m*incart_1;
-                            const int offset_4 = offset_1 + incart_1;  // (m+1)*incart_1
-                            const int offset_2 = m*incart_2;
-                            const int offset_5 = offset_2 + incart_2;  // (m+1)*incart_1
-
-                            for(int n = 0; n < incart; n++)
-                            {
-                                // get the recurrence information for this cartesian
-                                const int8_t d = aminfo1[n].dir;
-                                const int8_t i_ijk = aminfo1[n].ijk[d];
-                                const int idx1 = offset_1 + aminfo1[n].idx[d][0]; // index for 1st term
-                                const int idx4 = offset_4 + aminfo1[n].idx[d][0]; // index for 4th term
-                                const int idx2 = offset_2 + aminfo1[n].idx[d][1]; // index for 2nd term
-                                const int idx5 = offset_5 + aminfo1[n].idx[d][1]; // index for 5th term
-
-                                iwork[idx] = PA[d]*iwork14[idx1] - PC[d]*iwork14[idx4];  // 1st and 4th terms
-
-                                if(i_ijk > 1)
-                                    iwork[idx] += oo2p*(i_ijk-1)*(iwork25[idx2] - iwork25[idx5]); // 2nd and 5th terms
-
-                                idx++;
-                            }
+                            const int idx2 = jncart_1*(m*incart_1 + aminfo1[n].idx[d][0]) + aminfo2[o].idx[d][0];
+                            const int idx5 = jncart_1*((m+1)*incart_1 + aminfo1[n].idx[d][0]) + aminfo2[o].idx[d][0];
+                            val = SIMINT_FMADD(oo2p_n[i_ijk], SIMINT_SUB(jwork25[idx2], jwork25[idx5]), val);
                         }
+
+                        // terms 3 & 6
+                        if(j_ijk > 1)
+                            val = SIMINT_FMADD(oo2p_n[j_ijk-1], SIMINT_SUB(jwork36[idx3], jwork36[idx6]), val);
+
+                        jwork[cartidx] = val;
+                        cartidx++;
                     }
+                }
+            } // end loop over m
+        } // end loop over j
+    } // end loop over i
+}
 
-                    // now (i,j) via second vertical recurrence
-                    for(int j = 1; j <= am2; j++)
-                    {
-                        const int arrstart2 = am_recur_map[j];
-                        struct RecurInfo const * aminfo2 =  &recurinfo_array[arrstart2];
 
-                        // number of cartesians in the previous two shells
-                        const int jncart   = NCART(j);
-                        const int jncart_1 = NCART(j-1);   // j can't be zero (loop starts at 1)
-                        const int jncart_2 = (j > 1) ? NCART(j-2) : 0;
+// Computes the potential integrals of one shell pair over all
+// (packed) point charges. amwork and acc must hold the number of
+// vectors from potential_offsets and ncart12 vectors, respectively
+static void potential_shellpair(int am1, int am2, int const * restrict offsets,
+                                int npad, double const * restrict centers,
+                                struct potential_pairs const * pairs,
+                                SIMINT_DBLTYPE * restrict amwork,
+                                SIMINT_DBLTYPE * restrict acc,
+                                double * restrict integrals)
+{
+    const int am12 = am1 + am2;
+    const int ncart12 = NCART(am1) * NCART(am2);
+    SIMINT_DBLTYPE const * amintegrals = amwork + offsets[am1*(am2+1) + am2];
 
-                        double * jwork = amwork[i][j];
+    double const * Zc = centers;
+    double const * xc = centers + npad;
+    double const * yc = centers + 2*npad;
+    double const * zc = centers + 3*npad;
 
-                        double * jwork14 = amwork[i][j-1];                        // location of the 1st and 4th terms
-                        double * jwork36 = (j > 1) ? amwork[i][j-2] : NULL;    // location of the 3rd and 6th terms
-                        double * jwork25 = (i > 0) ? amwork[i-1][j-1] : NULL;  // location of the 2nd and 5th terms
+    SIMINT_DBLTYPE oo2p_n[MAX(am1, am2) + 1];
 
-                        const int max_m2 = am2 - j + 1; // need [0, am2-1] inclusive
+    for(int i = 0; i < ncart12; i++)
+        acc[i] = SIMINT_DBLSET1(0.0);
+
+    for(int cstart = 0; cstart < npad; cstart += POTENTIAL_CENTER_BLOCK)
+    {
+        const int cend = (cstart + POTENTIAL_CENTER_BLOCK < npad) ? cstart + POTENTIAL_CENTER_BLOCK : npad;
+
+        for(int ip = 0; ip < pairs->nprim; ip++)
+        {
+            // the minus sign is the charge of the electron
+            const double fac = -pairs->scale * pairs->fac[ip];
+            if(fac == 0.0)
+                continue;
+
+            const double p = pairs->alpha[ip];
+            const double oo2p = 0.5/p;
+            for(int k = 0; k <= MAX(am1, am2); k++)
+                oo2p_n[k] = SIMINT_DBLSET1(k*oo2p);
+
+            const SIMINT_DBLTYPE vp = SIMINT_DBLSET1(p);
+            const SIMINT_DBLTYPE vfac = SIMINT_DBLSET1(fac);
+            const SIMINT_DBLTYPE P[3] = { SIMINT_DBLSET1(pairs->P[0][ip]),
+                                          SIMINT_DBLSET1(pairs->P[1][ip]),
+                                          SIMINT_DBLSET1(pairs->P[2][ip]) };
+            const SIMINT_DBLTYPE PA[3] = { SIMINT_DBLSET1(pairs->PA[0][ip]),
+                                           SIMINT_DBLSET1(pairs->PA[1][ip]),
+                                           SIMINT_DBLSET1(pairs->PA[2][ip]) };
+            const SIMINT_DBLTYPE PB[3] = { SIMINT_DBLSET1(pairs->PB[0][ip]),
+                                           SIMINT_DBLSET1(pairs->PB[1][ip]),
+                                           SIMINT_DBLSET1(pairs->PB[2][ip]) };
+
+            for(int c = cstart; c < cend; c += SIMINT_SIMD_LEN)
+            {
+                const SIMINT_DBLTYPE PC[3] = { SIMINT_SUB(P[0], SIMINT_DBLLOAD(xc, c)),
+                                               SIMINT_SUB(P[1], SIMINT_DBLLOAD(yc, c)),
+                                               SIMINT_SUB(P[2], SIMINT_DBLLOAD(zc, c)) };
+
+                SIMINT_DBLTYPE PC2 = SIMINT_MUL(PC[0], PC[0]);
+                PC2 = SIMINT_FMADD(PC[1], PC[1], PC2);
+                PC2 = SIMINT_FMADD(PC[2], PC[2], PC2);
+
+                // boys function, one point charge per lane
+                boys_F_split(amwork, SIMINT_MUL(PC2, vp), am12);
+
+                // the recurrence is linear, so the charges
+                // and prefactors can be applied here
+                const SIMINT_DBLTYPE Zfac = SIMINT_MUL(vfac, SIMINT_DBLLOAD(Zc, c));
+                for(int m = 0; m <= am12; m++)
+                    amwork[m] = SIMINT_MUL(amwork[m], Zfac);
+
+                potential_vrr(am1, am2, offsets, PA, PB, PC, oo2p_n, amwork);
 
-                        int cartidx = 0; // index of the pair of cartesians
-                        for(int m = 0; m <= max_m2; m++)
-                        {
-                            int cartidx_1 = 0;  // index of just the first cartesian
-                            for(int n = 0; n < incart; n++)
-                            {
-                                // precompute some of the offsets
-                                // storage is  m, cart1, cart2
-                                // so total index would be (m*ncart1*ncart2 + cart1*ncart2 + cart2)
-                                const int offset1 = jncart_1*(m*incart + cartidx_1);                     // m*incart*jncart_1 + cartidx_1*jncart_1 
-                                const int offset4 = jncart_1*((m+1)*incart + cartidx_1);                 // (m+1)*incart*jncart_1 + cartidx_1*jncart_1
-                                const int offset3 = jncart_2*(m*incart + cartidx_1);                     // m*incart*jncart_2 + cartidx_1*jncart_2
-                                const int offset6 = jncart_2*((m+1)*incart + cartidx_1);                 // (m+1)*incart*jncart_2 + cartidx_1*jncart_2
-                                const int offset2[3] = { jncart_1*(m*incart_1 + aminfo1[n].idx[0][0]),        // m*incart_1*jncart_1 + aminfo1[n].idx[0][0]*jncart_1 
-                                                            jncart_1*(m*incart_1 + aminfo1[n].idx[1][0]),        // m*incart_1*jncart_1 + aminfo1[n].idx[1][0]*jncart_1 
-                                                            jncart_1*(m*incart_1 + aminfo1[n].idx[2][0]) };      // m*incart_1*jncart_1 + aminfo1[n].idx[2][0]*jncart_1 
-                                const int offset5[3] = { jncart_1*((m+1)*incart_1 + aminfo1[n].idx[0][0]),    // (m+1)*incart_1*jncart_1 + aminfo1[n].idx[0][0]*jncart_1 
-                                                            jncart_1*((m+1)*incart_1 + aminfo1[n].idx[1][0]),    // (m+1)*incart_1*jncart_1 + aminfo1[n].idx[1][0]*jncart_1 
-                                                            jncart_1*((m+1)*incart_1 + aminfo1[n].idx[2][0]) };  // (m+1)*incart_1*jncart_1 + aminfo1[n].idx[2][0]*jncart_1 
-
-                                for(int o = 0; o < jncart; o++)
-                                {
-                                    const int8_t d = aminfo2[o].dir; // direction we should recurse
-                                    const int8_t i_ijk = aminfo1[n].ijk[d];  // values of i and j in that direction
-                                    const int8_t j_ijk = aminfo2[o].ijk[d];
-                                    const int idx1 = offset1 + aminfo2[o].idx[d][0];     // 1st term
-                                    const int idx4 = offset4 + aminfo2[o].idx[d][0];     // 4th term
-                                    const int idx3 = offset3 + aminfo2[o].idx[d][1];     // 3rd term
-                                    const int idx6 = offset6 + aminfo2[o].idx[d][1];     // 6th term
-                                    const int idx2 = offset2[d] + aminfo2[o].idx[d][0];  // 2nd term
-                                    const int idx5 = offset5[d] + aminfo2[o].idx[d][0];  // 5th term
-
-
-                                    jwork[cartidx] = PB[d]*jwork14[idx1] - PC[d]*jwork14[idx4]; // terms 1 & 4
-
-                                    if(i_ijk > 0)
-                                        jwork[cartidx] += oo2p*(i_ijk)*jwork25[idx2] - oo2p*(i_ijk)*jwork25[idx5]; // terms 2 & 5
-
-                                    if(j_ijk > 1)
-                                        jwork[cartidx] += oo2p*(j_ijk-1)*(jwork36[idx3] - jwork36[idx6]); // terms 3 & 6
-
-                                    cartidx++;
-                                }
-
-                                cartidx_1++;
-                            }
-                        } // end loop over m
-                    } // end loop over j
-                } // end loop over i
-
-                // apply the coefficients
-                double * amintegrals = amwork[sh1->am][sh2->am];
                 for(int i = 0; i < ncart12; i++)
-                    integrals[i] -= amintegrals[i] * Z[n] * sh1->coef[a] * sh2->coef[b];
+                    acc[i] = SIMINT_ADD(acc[i], amintegrals[i]);
+            }
+        }
+    }
+
+    memset(integrals, 0, ncart12*sizeof(double));
+    contract_all(ncart12, acc, integrals);
+}
+
+
+// Workspace (in vectors) for potential_shellpair
+static size_t potential_worksize(int am1, int am2, int * offsets)
+{
+    return potential_offsets(am1, am2, offsets) + NCART(am1)*NCART(am2);
+}
+
+
+int simint_compute_osoei_potential(int ncenter,
+                                   double * Z, double * x, double * y, double * z,
+                                   struct simint_shell const * sh1,
+                                   struct simint_shell const * sh2,
+                                   double * restrict integrals)
+{
+    const int am1 = sh1->am;
+    const int am2 = sh2->am;
+    const int nprim12 = sh1->nprim * sh2->nprim;
+
+    const double xyz1[3] = { sh1->x, sh1->y, sh1->z };
+    const double xyz2[3] = { sh2->x, sh2->y, sh2->z };
+
+    const double AB[3] = { xyz1[0] - xyz2[0], xyz1[1] - xyz2[1], xyz1[2] - xyz2[2] };
+    const double AB2 = AB[0]*AB[0] + AB[1]*AB[1] + AB[2]*AB[2];
+
+    // Gaussian product information for all primitive pairs
+    double * pairwork = simint_workspace_acquire_size(11*(size_t)nprim12);
+    struct potential_pairs pairs;
+    pairs.nprim = nprim12;
+    pairs.alpha = pairwork;
+    pairs.fac = pairwork + nprim12;
+    pairs.scale = 2.0*PI;
+    for(int d = 0; d < 3; d++)
+    {
+        pairs.P[d] = pairwork + (2+d)*nprim12;
+        pairs.PA[d] = pairwork + (5+d)*nprim12;
+        pairs.PB[d] = pairwork + (8+d)*nprim12;
+    }
+
+    int ip = 0;
+    for(int a = 0; a < sh1->nprim; a++)
+    {
+        const double a1 = sh1->alpha[a];
+
+        for(int b = 0; b < sh2->nprim; b++)
+        {
+            const double a2 = sh2->alpha[b];
+            const double oop = 1.0/(a1 + a2); // = 1/p = 1/(a1 + a2)
+            const double mu = a1*a2*oop; // (a1*a2)/(a1+a2)
+
+            pairwork[ip] = a1 + a2;
+            pairwork[nprim12 + ip] = sh1->coef[a] * sh2->coef[b] * exp(-mu*AB2) * oop;
+
+            for(int d = 0; d < 3; d++)
+            {
+                const double P = (a1*xyz1[d] + a2*xyz2[d])*oop;
+                pairwork[(2+d)*nprim12 + ip] = P;
+                pairwork[(5+d)*nprim12 + ip] = P - xyz1[d];
+                pairwork[(8+d)*nprim12 + ip] = P - xyz2[d];
+            }
 
-            } // end loop over primitive a
-        } // end loop over primitive b
-    } // close loop over atoms
+            ip++;
+        }
+    }
+
+    int offsets[(am1+1)*(am2+1)];
+    const size_t nvec = potential_worksize(am1, am2, offsets);
+    SIMINT_DBLTYPE * amwork = (SIMINT_DBLTYPE *)simint_workspace_acquire_size(nvec*SIMINT_SIMD_LEN);
+
+    int npad;
+    double * centers = potential_pack_centers(ncenter, Z, x, y, z, &npad);
+
+    potential_shellpair(am1, am2, offsets, npad, centers, &pairs,
+                        amwork, amwork + (nvec - NCART(am1)*NCART(am2)),
+                        integrals);
+
+    simint_workspace_release(centers);
+    simint_workspace_release((double *)amwork);
+    simint_workspace_release(pairwork);
 
     return 1;
 }
 
+
+int simint_compute_osoei_potential_multi(int ncenter,
+                                         double * Z, double * x, double * y, double * z,
+                                         struct simint_multi_shellpair const * P,
+                                         double * restrict integrals)
+{
+    const int am1 = P->am1;
+    const int am2 = P->am2;
+    const int ncart12 = NCART(am1) * NCART(am2);
+
+    // The shell pair prefactor is for ERI (2 pi^(5/2) / p, rather
+    // than the 2 pi / p here)
+    struct potential_pairs pairs;
+    pairs.scale = 2.0*PI / SQRT_TWO_PI_52;
+
+    int offsets[(am1+1)*(am2+1)];
+    const size_t nvec = potential_worksize(am1, am2, offsets);
+    SIMINT_DBLTYPE * amwork = (SIMINT_DBLTYPE *)simint_workspace_acquire_size(nvec*SIMINT_SIMD_LEN);
+
+    int npad;
+    double * centers = potential_pack_centers(ncenter, Z, x, y, z, &npad);
+
+    int istart = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab++)
+    {
+        pairs.nprim = P->nprim12[ab];
+        pairs.P[0] = P->x + istart;
+        pairs.P[1] = P->y + istart;
+        pairs.P[2] = P->z + istart;
+        pairs.PA[0] = P->PA_x + istart;
+        pairs.PA[1] = P->PA_y + istart;
+        pairs.PA[2] = P->PA_z + istart;
+        pairs.PB[0] = P->PB_x + istart;
+        pairs.PB[1] = P->PB_y + istart;
+        pairs.PB[2] = P->PB_z + istart;
+        pairs.alpha = P->alpha + istart;
+        pairs.fac = P->prefac + istart;
+
+        potential_shellpair(am1, am2, offsets, npad, centers, &pairs,
+                            amwork, amwork + (nvec - ncart12),
+                            integrals + ab*ncart12);
+
+        // batches of SIMINT_NSHELL_SIMD shell pairs are padded
+        const int iend = istart + P->nprim12[ab];
+        istart = (((ab + 1) % SIMINT_NSHELL_SIMD) == 0) ? SIMINT_SIMD_ROUND(iend) : iend;
+    }
+
+    simint_workspace_release(centers);
+    simint_workspace_release((double *)amwork);
+
+    return P->nshell12_clip;
+}
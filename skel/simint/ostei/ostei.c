@@ -1,11 +1,188 @@
+#include <stdio.h>
+#include <string.h>
+#include "simint/simint_eri.h"
 #include "simint/ostei/ostei.h"
 #include "simint/ostei/ostei_config.h"
+#include "simint/simint_workspace.h"
+#include "simint/vectorization/vectorization.h"
+
+#define NCART(am) ((am>=0)?((((am)+2)*((am)+1))>>1):0)
+#define MAX(a,b) (((a) > (b)) ? (a) : (b))
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
+
+// Workspace needed for this particular AM quartet
+static inline size_t worksize_pq(int deriv,
+                                 struct simint_multi_shellpair const * P,
+                                 struct simint_multi_shellpair const * Q)
+{
+    return simint_ostei_worksize_quartet(deriv, P->am1, P->am2, Q->am1, Q->am2);
+}
 
 // This is the actual storage for this array
 #define AMSIZE   SIMINT_OSTEI_MAXAM+1
 #define DERSIZE  SIMINT_OSTEI_MAXDER+1
 simint_osteifunc simint_osteifunc_array[DERSIZE][AMSIZE][AMSIZE][AMSIZE][AMSIZE];
 
+// Single-precision kernels (no derivatives). Entries are NULL if
+// the float kernels were not generated
+simint_osteifunc simint_osteifunc_float_array[AMSIZE][AMSIZE][AMSIZE][AMSIZE];
+
+// 3- and 2-center kernels, indexed by the AM of the centers that
+// exist. Entries are NULL if they were not generated
+simint_osteifunc simint_osteifunc_3c_array[AMSIZE][AMSIZE][AMSIZE];
+simint_osteifunc simint_osteifunc_2c_array[AMSIZE][AMSIZE];
+
+// Shell quartets whose estimate is below this (squared, like
+// the screening tolerance) are computed with the float kernels
+static double float_tol = 0.0;
+static double float_tol2 = 0.0;
+
+
+void simint_ostei_set_float_tol(double tol)
+{
+    float_tol = (tol > 0.0) ? tol : 0.0;
+    float_tol2 = float_tol * float_tol;
+}
+
+
+double simint_ostei_get_float_tol(void)
+{
+    return float_tol;
+}
+
+
+// May (P|Q) be computed as (Q|P)? (see use_swapped)
+static int swap_enabled = 1;
+
+
+void simint_ostei_set_swap(int enable)
+{
+    swap_enabled = (enable != 0);
+}
+
+
+int simint_ostei_get_swap(void)
+{
+    return swap_enabled;
+}
+
+
+// Kernel to use for (P|Q) with no derivatives. The float kernels
+// are used if the largest integral is estimated to be
+// small enough that single precision is sufficient. screen_max
+// can't be used for this, since it is left at 1e99 when the shell
+// pair is filled (see the README)
+static inline simint_osteifunc ostei_func(struct simint_multi_shellpair const * P,
+                                          struct simint_multi_shellpair const * Q)
+{
+    if(float_tol2 > 0.0 && (P->prim_screen_max * Q->prim_screen_max) < float_tol2)
+    {
+        simint_osteifunc f = simint_osteifunc_float_array[P->am1][P->am2][Q->am1][Q->am2];
+        if(f)
+            return f;
+    }
+
+    return simint_osteifunc_array[0][P->am1][P->am2][Q->am1][Q->am2];
+}
+
+
+// The kernels vectorize over the primitives of the ket, in batches
+// of SIMINT_NSHELL_SIMD shell pairs. This returns the number of vectors
+// needed to cover all the primitives of a shell pair when used as the ket,
+// and the total number of primitives (in nprim).
+static int ket_nvec(struct simint_multi_shellpair const * Q, int * nprim)
+{
+    int nvec = 0;
+    *nprim = 0;
+
+    for(int cd = 0; cd < Q->nshell12_clip; cd += SIMINT_NSHELL_SIMD)
+    {
+        int nprim_batch = 0;
+        for(int i = cd; i < (cd + SIMINT_NSHELL_SIMD) && i < Q->nshell12_clip; i++)
+            nprim_batch += Q->nprim12[i];
+
+        nvec += (nprim_batch + SIMINT_SIMD_LEN - 1) / SIMINT_SIMD_LEN;
+        *nprim += nprim_batch;
+    }
+
+    return nvec;
+}
+
+
+// Should (P|Q) be computed as (Q|P)?
+//
+// The kernels loop over all the primitives of the bra, and do the ket
+// primitives in vectors, so the time is roughly proportional to
+// nprim(bra) * nvec(ket). If the ket has few primitives (ie, a single
+// shell pair with one or two primitives), most of the vector is padding,
+// and it is better to vectorize over the bra primitives instead.
+//
+// If the workspace was given by the caller, it may only be large enough
+// for (P|Q), so the swap is not done if (Q|P) needs more.
+static int use_swapped(struct simint_multi_shellpair const * P,
+                       struct simint_multi_shellpair const * Q,
+                       int work_given)
+{
+    if(!swap_enabled)
+        return 0;
+
+    if(work_given && worksize_pq(0, Q, P) > worksize_pq(0, P, Q))
+        return 0;
+
+    int nprim_P, nprim_Q;
+    const int nvec_P = ket_nvec(P, &nprim_P);
+    const int nvec_Q = ket_nvec(Q, &nprim_Q);
+
+    return ((long)nprim_Q * nvec_P) < ((long)nprim_P * nvec_Q);
+}
+
+
+// Computes (P|Q) by calling the kernel for (Q|P), then
+// transposing the result
+static int compute_swapped(struct simint_multi_shellpair const * P,
+                           struct simint_multi_shellpair const * Q,
+                           double screen_tol2,
+                           double * restrict work,
+                           double * restrict integrals)
+{
+    const int nshell_P = P->nshell12_clip;
+    const int nshell_Q = Q->nshell12_clip;
+    const int ncart_P = NCART(P->am1) * NCART(P->am2);
+    const int ncart_Q = NCART(Q->am1) * NCART(Q->am2);
+    const size_t nint = (size_t)nshell_P * nshell_Q * ncart_P * ncart_Q;
+
+    // kernels may store screening statistics (4 values)
+    // after the integrals
+    double * swapped = simint_workspace_acquire_size(nint + 4);
+
+    double * pool_work = NULL;
+    if(work == NULL)
+        work = pool_work = simint_workspace_acquire_size(worksize_pq(0, Q, P));
+
+    int ret = ostei_func(Q, P)(Q, P, screen_tol2, work, swapped);
+
+    // swapped is ordered [cd][ab][cart_cd][cart_ab]
+    // integrals is ordered [ab][cd][cart_ab][cart_cd]
+    for(int ab = 0; ab < nshell_P; ab++)
+    for(int cd = 0; cd < nshell_Q; cd++)
+    {
+        double const * restrict src = swapped + ((size_t)cd * nshell_P + ab) * ncart_P * ncart_Q;
+        double * restrict dest = integrals + ((size_t)ab * nshell_Q + cd) * ncart_P * ncart_Q;
+
+        for(int i = 0; i < ncart_P; i++)
+        for(int j = 0; j < ncart_Q; j++)
+            dest[i*ncart_Q + j] = src[j*ncart_P + i];
+    }
+
+    #ifdef SIMINT_PRIM_SCREEN_STAT
+    memcpy(integrals + nint, swapped + nint, 4*sizeof(double));
+    #endif
+
+    simint_workspace_release(pool_work);
+    simint_workspace_release(swapped);
+    return ret;
+}
+
 
 int simint_compute_ostei(struct simint_multi_shellpair const * P,
                          struct simint_multi_shellpair const * Q,
@@ -19,8 +196,16 @@ int simint_compute_ostei(struct simint_multi_shellpair const * P,
     if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
         return -1;
 
-    return simint_osteifunc_array[0][P->am1][P->am2][Q->am1][Q->am2](*P, *Q,
-                                                screen_tol2, work, integrals);
+    if(use_swapped(P, Q, work != NULL))
+        return compute_swapped(P, Q, screen_tol2, work, integrals);
+
+    if(work != NULL)
+        return ostei_func(P, Q)(P, Q, screen_tol2, work, integrals);
+
+    double * pool_work = simint_workspace_acquire_size(worksize_pq(0, P, Q));
+    int ret = ostei_func(P, Q)(P, Q, screen_tol2, pool_work, integrals);
+    simint_workspace_release(pool_work);
+    return ret;
 }
 
 
@@ -37,7 +222,520 @@ int simint_compute_ostei_deriv(int deriv,
     if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
         return -1;
 
-    return simint_osteifunc_array[deriv][P->am1][P->am2][Q->am1][Q->am2](*P, *Q,
-                                                  screen_tol2, work, integrals);
+    // may be swapped and/or use the float kernels
+    if(deriv == 0)
+        return simint_compute_ostei(P, Q, screen_tol, work, integrals);
+
+    if(work != NULL)
+        return simint_osteifunc_array[deriv][P->am1][P->am2][Q->am1][Q->am2](P, Q,
+                                                      screen_tol2, work, integrals);
+
+    double * pool_work = simint_workspace_acquire_size(worksize_pq(deriv, P, Q));
+    int ret = simint_osteifunc_array[deriv][P->am1][P->am2][Q->am1][Q->am2](P, Q,
+                                                  screen_tol2, pool_work, integrals);
+    simint_workspace_release(pool_work);
+    return ret;
+}
+
+
+
+// Nonzero if the second shell of every shell pair in P is a zero shell
+// (simint_create_zero_shell), ie an s shell with only zero exponents.
+// Then P = A exactly, which the 3- and 2-center kernels rely on. The
+// padding between batches is skipped.
+static int shellpair_zero_shell2(struct simint_multi_shellpair const * P)
+{
+    if(P->am2 != 0)
+        return 0;
+
+    int start = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab++)
+    {
+        for(int i = start; i < start + P->nprim12[ab]; i++)
+            if(P->beta[i] != 0.0)
+                return 0;
+
+        start += P->nprim12[ab];
+        if(((ab + 1) % SIMINT_NSHELL_SIMD) == 0)
+            start = SIMINT_SIMD_ROUND(start);
+    }
+
+    return 1;
+}
+
+
+// Computes (P|Q) with a 3- or 2-center kernel f. The general 4-center
+// path is used instead if there is no such kernel, or if it would be
+// faster (swapping bra and ket, or single precision)
+static int compute_df(simint_osteifunc f,
+                      struct simint_multi_shellpair const * P,
+                      struct simint_multi_shellpair const * Q,
+                      double screen_tol,
+                      double * restrict work,
+                      double * restrict integrals)
+{
+    double screen_tol2 = screen_tol * screen_tol;
+    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
+        return -1;
+
+    if(f == NULL || use_swapped(P, Q, work != NULL) ||
+       ostei_func(P, Q) != simint_osteifunc_array[0][P->am1][P->am2][Q->am1][Q->am2])
+        return simint_compute_ostei(P, Q, screen_tol, work, integrals);
+
+    if(work != NULL)
+        return f(P, Q, screen_tol2, work, integrals);
+
+    double * pool_work = simint_workspace_acquire_size(worksize_pq(0, P, Q));
+    int ret = f(P, Q, screen_tol2, pool_work, integrals);
+    simint_workspace_release(pool_work);
+    return ret;
+}
+
+
+int simint_compute_ostei_3c(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            double * restrict work,
+                            double * restrict integrals)
+{
+    if(!shellpair_zero_shell2(P))
+        return simint_compute_ostei(P, Q, screen_tol, work, integrals);
+
+    return compute_df(simint_osteifunc_3c_array[P->am1][Q->am1][Q->am2],
+                      P, Q, screen_tol, work, integrals);
 }
 
+
+int simint_compute_ostei_2c(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            double * restrict work,
+                            double * restrict integrals)
+{
+    if(!shellpair_zero_shell2(P))
+        return simint_compute_ostei(P, Q, screen_tol, work, integrals);
+
+    // (A|C) with only the bra being 1-center is (A|CD) with D = 0
+    if(!shellpair_zero_shell2(Q))
+        return simint_compute_ostei_3c(P, Q, screen_tol, work, integrals);
+
+    return compute_df(simint_osteifunc_2c_array[P->am1][Q->am1],
+                      P, Q, screen_tol, work, integrals);
+}
+
+
+int simint_compute_ostei_batch(int deriv,
+                               int ntask,
+                               struct simint_multi_shellpair const * const * PQ,
+                               size_t const * offsets,
+                               double screen_tol,
+                               double * restrict work,
+                               double * restrict integrals,
+                               int * restrict ret)
+{
+    // AMSIZE is not parenthesized
+    #define AMKEY(p,q) (((((p)->am1*(AMSIZE)) + (p)->am2)*(AMSIZE) + (q)->am1)*(AMSIZE) + (q)->am2)
+    #define NAMKEY ((AMSIZE)*(AMSIZE)*(AMSIZE)*(AMSIZE))
+
+    if(ntask <= 0)
+        return 0;
+
+    double screen_tol2 = screen_tol * screen_tol;
+
+    // Bucket the tasks by AM quartet (counting sort) so that each
+    // generated kernel is looked up once and run over its whole group
+    int bucket[NAMKEY+1];
+    for(int k = 0; k <= NAMKEY; k++)
+        bucket[k] = 0;
+
+    // If we are allocating the workspace, make it large enough
+    // for computing (Q|P) instead of (P|Q) (see use_swapped)
+    size_t worksize = 0;
+    for(int t = 0; t < ntask; t++)
+    {
+        bucket[AMKEY(PQ[2*t], PQ[2*t+1])+1]++;
+        worksize = MAX(worksize, worksize_pq(deriv, PQ[2*t], PQ[2*t+1]));
+        if(deriv == 0 && work == NULL)
+            worksize = MAX(worksize, worksize_pq(deriv, PQ[2*t+1], PQ[2*t]));
+    }
+
+    const int work_given = (work != NULL);
+    double * pool_work = NULL;
+    if(work == NULL)
+        work = pool_work = simint_workspace_acquire_size(worksize);
+
+    for(int k = 0; k < NAMKEY; k++)
+        bucket[k+1] += bucket[k];
+
+    // (ints stored in pool memory, to avoid malloc)
+    int * order = (int *)simint_workspace_acquire_size((ntask * sizeof(int) + sizeof(double) - 1) / sizeof(double));
+    for(int t = 0; t < ntask; t++)
+        order[bucket[AMKEY(PQ[2*t], PQ[2*t+1])]++] = t;
+
+    // bucket[k] is now the end of group k
+    int ncomputed = 0;
+    int start = 0;
+    while(start < ntask)
+    {
+        struct simint_multi_shellpair const * P0 = PQ[2*order[start]];
+        struct simint_multi_shellpair const * Q0 = PQ[2*order[start]+1];
+        const int end = bucket[AMKEY(P0, Q0)];
+
+        simint_osteifunc func = simint_osteifunc_array[deriv][P0->am1][P0->am2][Q0->am1][Q0->am2];
+
+        #ifdef SIMINT_PRIM_SCREEN_STAT
+        const int ncart1234 = NCART(P0->am1) * NCART(P0->am2) * NCART(Q0->am1) * NCART(Q0->am2)
+                              * (deriv > 0 ? 12 : 1);
+        #endif
+
+        for(int n = start; n < end; n++)
+        {
+            const int t = order[n];
+            struct simint_multi_shellpair const * P = PQ[2*t];
+            struct simint_multi_shellpair const * Q = PQ[2*t+1];
+
+            int r = -1;
+            if(screen_tol <= 0.0 || (P->screen_max * Q->screen_max) >= screen_tol2)
+            {
+                #ifdef SIMINT_PRIM_SCREEN_STAT
+                // The kernels store screening statistics just past the end of their
+                // integrals, which may belong to a task that was already computed
+                double * stat = integrals + offsets[t]
+                                + (size_t)ncart1234 * P->nshell12_clip * Q->nshell12_clip;
+                double stat_save[4];
+                memcpy(stat_save, stat, 4*sizeof(double));
+                #endif
+
+                if(deriv == 0 && use_swapped(P, Q, work_given))
+                    r = compute_swapped(P, Q, screen_tol2, work, integrals + offsets[t]);
+                else if(deriv == 0)
+                    r = ostei_func(P, Q)(P, Q, screen_tol2, work, integrals + offsets[t]);
+                else
+                    r = func(P, Q, screen_tol2, work, integrals + offsets[t]);
+
+                #ifdef SIMINT_PRIM_SCREEN_STAT
+                memcpy(stat, stat_save, 4*sizeof(double));
+                #endif
+            }
+
+            if(r > 0)
+                ncomputed += r;
+            if(ret)
+                ret[t] = r;
+        }
+
+        start = end;
+    }
+
+    simint_workspace_release((double *)order);
+    simint_workspace_release(pool_work);
+    return ncomputed;
+
+    #undef NAMKEY
+    #undef AMKEY
+}
+
+
+///////////////////////////////////////
+// Fused Coulomb/exchange digestion
+///////////////////////////////////////
+
+// Integrals computed by one kernel call in simint_compute_ostei_jk are
+// kept below this many elements, so that they stay in cache until
+// they are digested
+#define SIMINT_JK_CHUNK 8192
+
+
+// Digests the integrals of shell pairs [ab0, ab0+nab) of P and
+// [cd0, cd0+ncd) of Q into the Coulomb and exchange blocks
+static void digest_jk(struct simint_multi_shellpair const * P, int nb, int ab0, int nab,
+                      struct simint_multi_shellpair const * Q, int nd, int cd0, int ncd,
+                      double const * restrict integrals,
+                      struct simint_jk_blocks const * jk)
+{
+    const int ncart_a = NCART(P->am1);
+    const int ncart_b = NCART(P->am2);
+    const int ncart_c = NCART(Q->am1);
+    const int ncart_d = NCART(Q->am2);
+
+    // number of basis functions in the second and fourth positions,
+    // and in the ranges of the third and fourth positions
+    const int nfb = nb * ncart_b;
+    const int nfd = nd * ncart_d;
+    const int nfc = (Q->nshell12 / nd) * ncart_c;
+
+    for(int ab = ab0; ab < ab0+nab; ab++)
+    for(int cd = cd0; cd < cd0+ncd; cd++)
+    {
+        const int a0 = (ab / nb) * ncart_a;
+        const int b0 = (ab % nb) * ncart_b;
+        const int c0 = (cd / nd) * ncart_c;
+        const int d0 = (cd % nd) * ncart_d;
+
+        double const * restrict q = integrals;
+        integrals += ncart_a * ncart_b * ncart_c * ncart_d;
+
+        // One pass over the (small) block of integrals for each
+        // contribution, so that each loop is simple
+        if(jk->J_ab != NULL)
+        {
+            for(int a = a0, n = 0; a < a0+ncart_a; a++)
+            for(int b = b0; b < b0+ncart_b; b++)
+            {
+                double sum = 0.0;
+                for(int c = c0; c < c0+ncart_c; c++)
+                for(int d = d0; d < d0+ncart_d; d++)
+                    sum += q[n++] * jk->D_cd[c*nfd + d];
+                jk->J_ab[a*nfb + b] += sum;
+            }
+        }
+
+        if(jk->J_cd != NULL)
+        {
+            for(int a = a0, n = 0; a < a0+ncart_a; a++)
+            for(int b = b0; b < b0+ncart_b; b++)
+            {
+                const double dab = jk->D_ab[a*nfb + b];
+                for(int c = c0; c < c0+ncart_c; c++)
+                for(int d = d0; d < d0+ncart_d; d++)
+                    jk->J_cd[c*nfd + d] += q[n++] * dab;
+            }
+        }
+
+        if(jk->K_ac != NULL || jk->K_ad != NULL || jk->K_bc != NULL || jk->K_bd != NULL)
+        {
+            for(int a = a0, n = 0; a < a0+ncart_a; a++)
+            for(int b = b0; b < b0+ncart_b; b++)
+            for(int c = c0; c < c0+ncart_c; c++, n += ncart_d)
+            {
+                double const * restrict qd = q + n;
+
+                if(jk->K_ac != NULL)
+                {
+                    double sum = 0.0;
+                    for(int d = 0; d < ncart_d; d++)
+                        sum += qd[d] * jk->D_bd[b*nfd + d0 + d];
+                    jk->K_ac[a*nfc + c] += sum;
+                }
+
+                if(jk->K_bc != NULL)
+                {
+                    double sum = 0.0;
+                    for(int d = 0; d < ncart_d; d++)
+                        sum += qd[d] * jk->D_ad[a*nfd + d0 + d];
+                    jk->K_bc[b*nfc + c] += sum;
+                }
+
+                if(jk->K_ad != NULL)
+                {
+                    const double dbc = jk->D_bc[b*nfc + c];
+                    for(int d = 0; d < ncart_d; d++)
+                        jk->K_ad[a*nfd + d0 + d] += qd[d] * dbc;
+                }
+
+                if(jk->K_bd != NULL)
+                {
+                    const double dac = jk->D_ac[a*nfc + c];
+                    for(int d = 0; d < ncart_d; d++)
+                        jk->K_bd[b*nfd + d0 + d] += qd[d] * dac;
+                }
+            }
+        }
+    }
+}
+
+
+// Digests integrals for shell pairs [ab0, ab0+nab) of P and [cd0, cd0+ncd) of Q
+typedef void (*digest_func)(struct simint_multi_shellpair const * P, int nb, int ab0, int nab,
+                            struct simint_multi_shellpair const * Q, int nd, int cd0, int ncd,
+                            double const * restrict integrals,
+                            void const * data);
+
+
+static void digest_jk_func(struct simint_multi_shellpair const * P, int nb, int ab0, int nab,
+                           struct simint_multi_shellpair const * Q, int nd, int cd0, int ncd,
+                           double const * restrict integrals,
+                           void const * data)
+{
+    digest_jk(P, nb, ab0, nab, Q, nd, cd0, ncd, integrals, (struct simint_jk_blocks const *)data);
+}
+
+
+// Computes (P|Q) (or its derivatives) in pieces of at most about
+// SIMINT_JK_CHUNK values, and passes each piece to digest. Returns
+// -1 if everything was screened, like simint_compute_ostei
+static int compute_digested(int deriv,
+                            struct simint_multi_shellpair const * P, int nb,
+                            struct simint_multi_shellpair const * Q, int nd,
+                            double screen_tol,
+                            double * restrict work,
+                            digest_func digest, void const * data)
+{
+    double screen_tol2 = screen_tol * screen_tol;
+    if(screen_tol > 0.0 && (P->screen_max * Q->screen_max) < screen_tol2 )
+        return -1;
+
+    // number of values per shell quartet
+    const int nval = NCART(P->am1) * NCART(P->am2) * NCART(Q->am1) * NCART(Q->am2)
+                     * (deriv > 0 ? 12 : 1);
+
+    // Number of ket batches (of SIMINT_NSHELL_SIMD shell pairs) per kernel call
+    const int nbatch = MAX(1, SIMINT_JK_CHUNK / (nval * SIMINT_NSHELL_SIMD));
+    const int chunk = nbatch * SIMINT_NSHELL_SIMD;
+
+    double * pool_work = NULL;
+    if(work == NULL)
+        work = pool_work = simint_workspace_acquire_size(worksize_pq(deriv, P, Q));
+
+    // (kernels may store screening statistics after the integrals)
+    double * integrals = simint_workspace_acquire_size(MAX(SIMINT_JK_CHUNK, (size_t)nval * chunk) + 4);
+
+    // (ints stored in pool memory, to avoid malloc)
+    const int nstart = P->nshell12_clip + Q->nshell12_clip + 2;
+    int * start_P = (int *)simint_workspace_acquire_size((nstart * sizeof(int) + sizeof(double) - 1) / sizeof(double));
+    int * start_Q = start_P + P->nshell12_clip + 1;
+    simint_shellpair_prim_starts(P, start_P);
+    simint_shellpair_prim_starts(Q, start_Q);
+
+    int ncomputed = 0;
+    int screened = 1;
+
+    for(int cd0 = 0; cd0 < Q->nshell12_clip; cd0 += chunk)
+    {
+        const int ncd = MIN(chunk, Q->nshell12_clip - cd0);
+        struct simint_multi_shellpair Qv;
+        simint_shellpair_view(Q, start_Q, cd0, ncd, &Qv);
+
+        // Bra shell pairs per kernel call. Whole batches if they fit (the
+        // kernels pad the bra after each batch), otherwise one at a time.
+        // The bra primitives are loaded one at a time, so they don't
+        // need to be aligned.
+        const int nbra_batch = SIMINT_JK_CHUNK / (nval * ncd * SIMINT_NSHELL_SIMD);
+        const int nbra = (nbra_batch > 0) ? nbra_batch * SIMINT_NSHELL_SIMD : 1;
+
+        for(int ab0 = 0; ab0 < P->nshell12_clip; ab0 += nbra)
+        {
+            const int nab = MIN(nbra, P->nshell12_clip - ab0);
+            struct simint_multi_shellpair Pv;
+            simint_shellpair_view(P, start_P, ab0, nab, &Pv);
+
+            if(screen_tol > 0.0 && (Pv.screen_max * Qv.screen_max) < screen_tol2)
+                continue;
+
+            screened = 0;
+
+            simint_osteifunc func = (deriv == 0) ? ostei_func(&Pv, &Qv)
+                                    : simint_osteifunc_array[deriv][P->am1][P->am2][Q->am1][Q->am2];
+
+            const int r = func(&Pv, &Qv, screen_tol2, work, integrals);
+            if(r <= 0)
+                continue;
+
+            ncomputed += r;
+            digest(P, nb, ab0, nab, Q, nd, cd0, ncd, integrals, data);
+        }
+    }
+
+    simint_workspace_release((double *)start_P);
+    simint_workspace_release(integrals);
+    simint_workspace_release(pool_work);
+    return screened ? -1 : ncomputed;
+}
+
+
+int simint_compute_ostei_jk(struct simint_multi_shellpair const * P, int nb,
+                            struct simint_multi_shellpair const * Q, int nd,
+                            double screen_tol,
+                            double * restrict work,
+                            struct simint_jk_blocks const * jk)
+{
+    return compute_digested(0, P, nb, Q, nd, screen_tol, work, digest_jk_func, jk);
+}
+
+
+#if SIMINT_OSTEI_MAXDER > 0
+
+// Contracts first derivatives of shell pairs [ab0, ab0+nab) of P and
+// [cd0, cd0+ncd) of Q with the two-particle density
+static void digest_grad(struct simint_multi_shellpair const * P, int nb, int ab0, int nab,
+                        struct simint_multi_shellpair const * Q, int nd, int cd0, int ncd,
+                        double const * restrict deriv,
+                        void const * data)
+{
+    struct simint_grad_blocks const * g = (struct simint_grad_blocks const *)data;
+
+    const int ncart_a = NCART(P->am1);
+    const int ncart_b = NCART(P->am2);
+    const int ncart_c = NCART(Q->am1);
+    const int ncart_d = NCART(Q->am2);
+    // number of basis functions in each position
+    const int nfb = nb * ncart_b;
+    const int nfc = (Q->nshell12 / nd) * ncart_c;
+    const int nfd = nd * ncart_d;
+
+    for(int ab = ab0; ab < ab0+nab; ab++)
+    for(int cd = cd0; cd < cd0+ncd; cd++)
+    {
+        const int sa = ab / nb, sb = ab % nb;
+        const int sc = cd / nd, sd = cd % nd;
+        const int a0 = sa * ncart_a, b0 = sb * ncart_b;
+        const int c0 = sc * ncart_c, d0 = sd * ncart_d;
+
+        // derivatives with respect to the 4 centers (x, y, z each),
+        // contracted with the density
+        double sum[12] = {0.0};
+
+        for(int a = a0; a < a0+ncart_a; a++)
+        for(int b = b0; b < b0+ncart_b; b++)
+        for(int c = c0; c < c0+ncart_c; c++)
+        for(int d = d0; d < d0+ncart_d; d++)
+        {
+            double gamma;
+            if(g->gamma != NULL)
+                gamma = g->gamma[(((size_t)a*nfb + b)*nfc + c)*nfd + d];
+            else
+            {
+                gamma = 0.0;
+                if(g->fac_j != 0.0)
+                    gamma += g->fac_j * g->D_ab[a*nfb + b] * g->D_cd[c*nfd + d];
+                if(g->fac_k != 0.0)
+                    gamma -= g->fac_k * (g->D_ac[a*nfc + c] * g->D_bd[b*nfd + d] +
+                                         g->D_ad[a*nfd + d] * g->D_bc[b*nfc + c]);
+            }
+
+            // (deriv ends up at the next shell quartet)
+            for(int n = 0; n < 12; n++)
+                sum[n] += gamma * deriv[n];
+            deriv += 12;
+        }
+
+        for(int x = 0; x < 3; x++)
+        {
+            if(g->G_a != NULL)
+                g->G_a[sa*3 + x] += sum[x];
+            if(g->G_b != NULL)
+                g->G_b[sb*3 + x] += sum[3 + x];
+            if(g->G_c != NULL)
+                g->G_c[sc*3 + x] += sum[6 + x];
+            if(g->G_d != NULL)
+                g->G_d[sd*3 + x] += sum[9 + x];
+        }
+    }
+}
+
+#endif
+
+
+int simint_compute_ostei_grad(struct simint_multi_shellpair const * P, int nb,
+                              struct simint_multi_shellpair const * Q, int nd,
+                              double screen_tol,
+                              double * restrict work,
+                              struct simint_grad_blocks const * grad)
+{
+    #if SIMINT_OSTEI_MAXDER > 0
+    return compute_digested(1, P, nb, Q, nd, screen_tol, work, digest_grad, grad);
+    #else
+    printf("[ERROR] simint_compute_ostei_grad: simint was built without derivatives (SIMINT_MAXDER = 0)\n");
+    return -1;
+    #endif
+}
@@ -8,19 +8,69 @@ extern "C" {
 #endif
 
 //! A pointer to a function that calculates TEI utilizing a shared workspace
-typedef int (*simint_osteifunc)(struct simint_multi_shellpair const,
-                                struct simint_multi_shellpair const,
+typedef int (*simint_osteifunc)(struct simint_multi_shellpair const * restrict,
+                                struct simint_multi_shellpair const * restrict,
                                 double,
                                 double * restrict,
                                 double * restrict);
 
 
+/*! \brief Set the tolerance for computing integrals in single precision
+ *
+ * Shell quartets where the largest integral is estimated to be below
+ * \p tol (from the screening values, as with screen_tol) are computed with
+ * kernels that do the primitive work in single precision. The integrals
+ * are still returned in double precision, with errors on the order of
+ * 1e-7 relative to \p tol.
+ *
+ * This only applies to integrals without derivatives, and only if simint
+ * was generated with float kernels (SIMINT_OSTEI_FLOAT). The default is
+ * zero, which disables single precision.
+ *
+ * This is a global setting, and should not be changed while integrals
+ * are being computed in other threads.
+ *
+ * \param [in] tol Tolerance (set to zero to disable)
+ */
+void simint_ostei_set_float_tol(double tol);
+
+
+/*! \brief Get the tolerance for computing integrals in single precision
+ *
+ * \return The tolerance given to simint_ostei_set_float_tol
+ */
+double simint_ostei_get_float_tol(void);
+
+
+/*! \brief Enable or disable computing (P|Q) as (Q|P)
+ *
+ * Without derivatives, simint_compute_ostei computes (P|Q) by calling
+ * the kernel for (Q|P) and transposing the result, if the ket has few
+ * primitives compared to the bra. The integrals are the same, up to
+ * rounding. This is enabled by default.
+ *
+ * This is a global setting, and should not be changed while integrals
+ * are being computed in other threads.
+ *
+ * \param [in] enable Nonzero to allow the swap, zero to disable it
+ */
+void simint_ostei_set_swap(int enable);
+
+
+/*! \brief Get whether (P|Q) may be computed as (Q|P)
+ *
+ * \return The value given to simint_ostei_set_swap (nonzero by default)
+ */
+int simint_ostei_get_swap(void);
+
+
 /*! \brief Compute an ostei given shell pair information
  *
  * \param [in] P The shell pairs for the bra side of the integral 
  * \param [in] Q The shell pairs for the ket side of the integral
  * \param [in] screen_tol Tolerance for screening (set to zero to disable)
- * \param [in] work Workspace to use in calculating the integrals
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
  * \param [inout] integrals Storage for the final integrals. Since size information
  *                          is not passed, you are expected to ensure that this buffer
  *                          is large enough
@@ -37,7 +87,8 @@ int simint_compute_ostei(struct simint_multi_shellpair const * P,
  * \param [in] P The shell pairs for the bra side of the integral 
  * \param [in] Q The shell pairs for the ket side of the integral
  * \param [in] screen_tol Tolerance for screening (set to zero to disable)
- * \param [in] work Workspace to use in calculating the integrals
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
  * \param [inout] integrals Storage for the final integrals. Since size information
  *                          is not passed, you are expected to ensure that this buffer
  *                          is large enough
@@ -50,6 +101,87 @@ int simint_compute_ostei_deriv(int deriv,
                                double * restrict integrals);
 
 
+/*! \brief Compute a 3-center ostei given shell pair information
+ *
+ * See simint_compute_eri_3c
+ */
+int simint_compute_ostei_3c(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            double * restrict work,
+                            double * restrict integrals);
+
+
+/*! \brief Compute a 2-center ostei given shell pair information
+ *
+ * See simint_compute_eri_2c
+ */
+int simint_compute_ostei_2c(struct simint_multi_shellpair const * P,
+                            struct simint_multi_shellpair const * Q,
+                            double screen_tol,
+                            double * restrict work,
+                            double * restrict integrals);
+
+
+/*! \brief Compute a batch of ostei, grouped by AM quartet
+ *
+ * Each task is a (P,Q) pair of shell pair pointers. The tasks are grouped
+ * by AM quartet internally so that each generated kernel is run over all
+ * of its tasks in one pass, and all tasks share the same workspace.
+ *
+ * \param [in] deriv Order of the derivative to compute
+ * \param [in] ntask Number of tasks in the batch
+ * \param [in] PQ Shell pairs for each task, stored as (P,Q) pairs
+ *                (ie, length 2*ntask, P0 Q0 P1 Q1 ...)
+ * \param [in] offsets Where the integrals for each task should be stored,
+ *                     as an offset (in elements) into \p integrals
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. Must be
+ *                  large enough for the largest AM quartet in the batch. If NULL,
+ *                  workspace is taken from the per-thread pool
+ * \param [inout] integrals Storage for the final integrals. As with simint_compute_ostei,
+ *                          some space past the end of the last task may be written to
+ * \param [out] ret Return value for each task (as from simint_compute_ostei_deriv).
+ *                  Tasks that were screened get -1 and their integrals are not
+ *                  written. May be NULL.
+ * \return Total number of shell quartets calculated
+ */
+int simint_compute_ostei_batch(int deriv,
+                               int ntask,
+                               struct simint_multi_shellpair const * const * PQ,
+                               size_t const * offsets,
+                               double screen_tol,
+                               double * restrict work,
+                               double * restrict integrals,
+                               int * restrict ret);
+
+
+struct simint_jk_blocks;
+
+/*! \brief Compute ostei and digest them into Coulomb and exchange blocks
+ *
+ * See simint_compute_eri_jk
+ */
+int simint_compute_ostei_jk(struct simint_multi_shellpair const * P, int nb,
+                            struct simint_multi_shellpair const * Q, int nd,
+                            double screen_tol,
+                            double * restrict work,
+                            struct simint_jk_blocks const * jk);
+
+
+struct simint_grad_blocks;
+
+/*! \brief Compute ostei first derivatives and contract them into gradients
+ *
+ * See simint_compute_eri_grad
+ */
+int simint_compute_ostei_grad(struct simint_multi_shellpair const * P, int nb,
+                              struct simint_multi_shellpair const * Q, int nd,
+                              double screen_tol,
+                              double * restrict work,
+                              struct simint_grad_blocks const * grad);
+
+
 
 #ifdef __cplusplus
 }
@@ -27,1317 +27,1317 @@ void simint_ostei_deriv1_finalize(void)
 void simint_ostei_deriv1_init(void)
 {
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 0
-    simint_osteifunc_array[1][0][0][0][0] = ostei_deriv1_s_s_s_s;
+    simint_osteifunc_array[1][0][0][0][0] = ostei_deriv1_s_s_s_s_ptr;
     #endif
 
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 1
-    simint_osteifunc_array[1][0][0][0][1] = ostei_deriv1_s_s_s_p;
-    simint_osteifunc_array[1][0][0][1][0] = ostei_deriv1_s_s_p_s;
-    simint_osteifunc_array[1][0][0][1][1] = ostei_deriv1_s_s_p_p;
-    simint_osteifunc_array[1][0][1][0][0] = ostei_deriv1_s_p_s_s;
-    simint_osteifunc_array[1][0][1][0][1] = ostei_deriv1_s_p_s_p;
-    simint_osteifunc_array[1][0][1][1][0] = ostei_deriv1_s_p_p_s;
-    simint_osteifunc_array[1][0][1][1][1] = ostei_deriv1_s_p_p_p;
-    simint_osteifunc_array[1][1][0][0][0] = ostei_deriv1_p_s_s_s;
-    simint_osteifunc_array[1][1][0][0][1] = ostei_deriv1_p_s_s_p;
-    simint_osteifunc_array[1][1][0][1][0] = ostei_deriv1_p_s_p_s;
-    simint_osteifunc_array[1][1][0][1][1] = ostei_deriv1_p_s_p_p;
-    simint_osteifunc_array[1][1][1][0][0] = ostei_deriv1_p_p_s_s;
-    simint_osteifunc_array[1][1][1][0][1] = ostei_deriv1_p_p_s_p;
-    simint_osteifunc_array[1][1][1][1][0] = ostei_deriv1_p_p_p_s;
-    simint_osteifunc_array[1][1][1][1][1] = ostei_deriv1_p_p_p_p;
+    simint_osteifunc_array[1][0][0][0][1] = ostei_deriv1_s_s_s_p_ptr;
+    simint_osteifunc_array[1][0][0][1][0] = ostei_deriv1_s_s_p_s_ptr;
+    simint_osteifunc_array[1][0][0][1][1] = ostei_deriv1_s_s_p_p_ptr;
+    simint_osteifunc_array[1][0][1][0][0] = ostei_deriv1_s_p_s_s_ptr;
+    simint_osteifunc_array[1][0][1][0][1] = ostei_deriv1_s_p_s_p_ptr;
+    simint_osteifunc_array[1][0][1][1][0] = ostei_deriv1_s_p_p_s_ptr;
+    simint_osteifunc_array[1][0][1][1][1] = ostei_deriv1_s_p_p_p_ptr;
+    simint_osteifunc_array[1][1][0][0][0] = ostei_deriv1_p_s_s_s_ptr;
+    simint_osteifunc_array[1][1][0][0][1] = ostei_deriv1_p_s_s_p_ptr;
+    simint_osteifunc_array[1][1][0][1][0] = ostei_deriv1_p_s_p_s_ptr;
+    simint_osteifunc_array[1][1][0][1][1] = ostei_deriv1_p_s_p_p_ptr;
+    simint_osteifunc_array[1][1][1][0][0] = ostei_deriv1_p_p_s_s_ptr;
+    simint_osteifunc_array[1][1][1][0][1] = ostei_deriv1_p_p_s_p_ptr;
+    simint_osteifunc_array[1][1][1][1][0] = ostei_deriv1_p_p_p_s_ptr;
+    simint_osteifunc_array[1][1][1][1][1] = ostei_deriv1_p_p_p_p_ptr;
     #endif
 
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 2
-    simint_osteifunc_array[1][0][0][0][2] = ostei_deriv1_s_s_s_d;
-    simint_osteifunc_array[1][0][0][1][2] = ostei_deriv1_s_s_p_d;
-    simint_osteifunc_array[1][0][0][2][0] = ostei_deriv1_s_s_d_s;
-    simint_osteifunc_array[1][0][0][2][1] = ostei_deriv1_s_s_d_p;
-    simint_osteifunc_array[1][0][0][2][2] = ostei_deriv1_s_s_d_d;
-    simint_osteifunc_array[1][0][1][0][2] = ostei_deriv1_s_p_s_d;
-    simint_osteifunc_array[1][0][1][1][2] = ostei_deriv1_s_p_p_d;
-    simint_osteifunc_array[1][0][1][2][0] = ostei_deriv1_s_p_d_s;
-    simint_osteifunc_array[1][0][1][2][1] = ostei_deriv1_s_p_d_p;
-    simint_osteifunc_array[1][0][1][2][2] = ostei_deriv1_s_p_d_d;
-    simint_osteifunc_array[1][0][2][0][0] = ostei_deriv1_s_d_s_s;
-    simint_osteifunc_array[1][0][2][0][1] = ostei_deriv1_s_d_s_p;
-    simint_osteifunc_array[1][0][2][0][2] = ostei_deriv1_s_d_s_d;
-    simint_osteifunc_array[1][0][2][1][0] = ostei_deriv1_s_d_p_s;
-    simint_osteifunc_array[1][0][2][1][1] = ostei_deriv1_s_d_p_p;
-    simint_osteifunc_array[1][0][2][1][2] = ostei_deriv1_s_d_p_d;
-    simint_osteifunc_array[1][0][2][2][0] = ostei_deriv1_s_d_d_s;
-    simint_osteifunc_array[1][0][2][2][1] = ostei_deriv1_s_d_d_p;
-    simint_osteifunc_array[1][0][2][2][2] = ostei_deriv1_s_d_d_d;
-    simint_osteifunc_array[1][1][0][0][2] = ostei_deriv1_p_s_s_d;
-    simint_osteifunc_array[1][1][0][1][2] = ostei_deriv1_p_s_p_d;
-    simint_osteifunc_array[1][1][0][2][0] = ostei_deriv1_p_s_d_s;
-    simint_osteifunc_array[1][1][0][2][1] = ostei_deriv1_p_s_d_p;
-    simint_osteifunc_array[1][1][0][2][2] = ostei_deriv1_p_s_d_d;
-    simint_osteifunc_array[1][1][1][0][2] = ostei_deriv1_p_p_s_d;
-    simint_osteifunc_array[1][1][1][1][2] = ostei_deriv1_p_p_p_d;
-    simint_osteifunc_array[1][1][1][2][0] = ostei_deriv1_p_p_d_s;
-    simint_osteifunc_array[1][1][1][2][1] = ostei_deriv1_p_p_d_p;
-    simint_osteifunc_array[1][1][1][2][2] = ostei_deriv1_p_p_d_d;
-    simint_osteifunc_array[1][1][2][0][0] = ostei_deriv1_p_d_s_s;
-    simint_osteifunc_array[1][1][2][0][1] = ostei_deriv1_p_d_s_p;
-    simint_osteifunc_array[1][1][2][0][2] = ostei_deriv1_p_d_s_d;
-    simint_osteifunc_array[1][1][2][1][0] = ostei_deriv1_p_d_p_s;
-    simint_osteifunc_array[1][1][2][1][1] = ostei_deriv1_p_d_p_p;
-    simint_osteifunc_array[1][1][2][1][2] = ostei_deriv1_p_d_p_d;
-    simint_osteifunc_array[1][1][2][2][0] = ostei_deriv1_p_d_d_s;
-    simint_osteifunc_array[1][1][2][2][1] = ostei_deriv1_p_d_d_p;
-    simint_osteifunc_array[1][1][2][2][2] = ostei_deriv1_p_d_d_d;
-    simint_osteifunc_array[1][2][0][0][0] = ostei_deriv1_d_s_s_s;
-    simint_osteifunc_array[1][2][0][0][1] = ostei_deriv1_d_s_s_p;
-    simint_osteifunc_array[1][2][0][0][2] = ostei_deriv1_d_s_s_d;
-    simint_osteifunc_array[1][2][0][1][0] = ostei_deriv1_d_s_p_s;
-    simint_osteifunc_array[1][2][0][1][1] = ostei_deriv1_d_s_p_p;
-    simint_osteifunc_array[1][2][0][1][2] = ostei_deriv1_d_s_p_d;
-    simint_osteifunc_array[1][2][0][2][0] = ostei_deriv1_d_s_d_s;
-    simint_osteifunc_array[1][2][0][2][1] = ostei_deriv1_d_s_d_p;
-    simint_osteifunc_array[1][2][0][2][2] = ostei_deriv1_d_s_d_d;
-    simint_osteifunc_array[1][2][1][0][0] = ostei_deriv1_d_p_s_s;
-    simint_osteifunc_array[1][2][1][0][1] = ostei_deriv1_d_p_s_p;
-    simint_osteifunc_array[1][2][1][0][2] = ostei_deriv1_d_p_s_d;
-    simint_osteifunc_array[1][2][1][1][0] = ostei_deriv1_d_p_p_s;
-    simint_osteifunc_array[1][2][1][1][1] = ostei_deriv1_d_p_p_p;
-    simint_osteifunc_array[1][2][1][1][2] = ostei_deriv1_d_p_p_d;
-    simint_osteifunc_array[1][2][1][2][0] = ostei_deriv1_d_p_d_s;
-    simint_osteifunc_array[1][2][1][2][1] = ostei_deriv1_d_p_d_p;
-    simint_osteifunc_array[1][2][1][2][2] = ostei_deriv1_d_p_d_d;
-    simint_osteifunc_array[1][2][2][0][0] = ostei_deriv1_d_d_s_s;
-    simint_osteifunc_array[1][2][2][0][1] = ostei_deriv1_d_d_s_p;
-    simint_osteifunc_array[1][2][2][0][2] = ostei_deriv1_d_d_s_d;
-    simint_osteifunc_array[1][2][2][1][0] = ostei_deriv1_d_d_p_s;
-    simint_osteifunc_array[1][2][2][1][1] = ostei_deriv1_d_d_p_p;
-    simint_osteifunc_array[1][2][2][1][2] = ostei_deriv1_d_d_p_d;
-    simint_osteifunc_array[1][2][2][2][0] = ostei_deriv1_d_d_d_s;
-    simint_osteifunc_array[1][2][2][2][1] = ostei_deriv1_d_d_d_p;
-    simint_osteifunc_array[1][2][2][2][2] = ostei_deriv1_d_d_d_d;
+    simint_osteifunc_array[1][0][0][0][2] = ostei_deriv1_s_s_s_d_ptr;
+    simint_osteifunc_array[1][0][0][1][2] = ostei_deriv1_s_s_p_d_ptr;
+    simint_osteifunc_array[1][0][0][2][0] = ostei_deriv1_s_s_d_s_ptr;
+    simint_osteifunc_array[1][0][0][2][1] = ostei_deriv1_s_s_d_p_ptr;
+    simint_osteifunc_array[1][0][0][2][2] = ostei_deriv1_s_s_d_d_ptr;
+    simint_osteifunc_array[1][0][1][0][2] = ostei_deriv1_s_p_s_d_ptr;
+    simint_osteifunc_array[1][0][1][1][2] = ostei_deriv1_s_p_p_d_ptr;
+    simint_osteifunc_array[1][0][1][2][0] = ostei_deriv1_s_p_d_s_ptr;
+    simint_osteifunc_array[1][0][1][2][1] = ostei_deriv1_s_p_d_p_ptr;
+    simint_osteifunc_array[1][0][1][2][2] = ostei_deriv1_s_p_d_d_ptr;
+    simint_osteifunc_array[1][0][2][0][0] = ostei_deriv1_s_d_s_s_ptr;
+    simint_osteifunc_array[1][0][2][0][1] = ostei_deriv1_s_d_s_p_ptr;
+    simint_osteifunc_array[1][0][2][0][2] = ostei_deriv1_s_d_s_d_ptr;
+    simint_osteifunc_array[1][0][2][1][0] = ostei_deriv1_s_d_p_s_ptr;
+    simint_osteifunc_array[1][0][2][1][1] = ostei_deriv1_s_d_p_p_ptr;
+    simint_osteifunc_array[1][0][2][1][2] = ostei_deriv1_s_d_p_d_ptr;
+    simint_osteifunc_array[1][0][2][2][0] = ostei_deriv1_s_d_d_s_ptr;
+    simint_osteifunc_array[1][0][2][2][1] = ostei_deriv1_s_d_d_p_ptr;
+    simint_osteifunc_array[1][0][2][2][2] = ostei_deriv1_s_d_d_d_ptr;
+    simint_osteifunc_array[1][1][0][0][2] = ostei_deriv1_p_s_s_d_ptr;
+    simint_osteifunc_array[1][1][0][1][2] = ostei_deriv1_p_s_p_d_ptr;
+    simint_osteifunc_array[1][1][0][2][0] = ostei_deriv1_p_s_d_s_ptr;
+    simint_osteifunc_array[1][1][0][2][1] = ostei_deriv1_p_s_d_p_ptr;
+    simint_osteifunc_array[1][1][0][2][2] = ostei_deriv1_p_s_d_d_ptr;
+    simint_osteifunc_array[1][1][1][0][2] = ostei_deriv1_p_p_s_d_ptr;
+    simint_osteifunc_array[1][1][1][1][2] = ostei_deriv1_p_p_p_d_ptr;
+    simint_osteifunc_array[1][1][1][2][0] = ostei_deriv1_p_p_d_s_ptr;
+    simint_osteifunc_array[1][1][1][2][1] = ostei_deriv1_p_p_d_p_ptr;
+    simint_osteifunc_array[1][1][1][2][2] = ostei_deriv1_p_p_d_d_ptr;
+    simint_osteifunc_array[1][1][2][0][0] = ostei_deriv1_p_d_s_s_ptr;
+    simint_osteifunc_array[1][1][2][0][1] = ostei_deriv1_p_d_s_p_ptr;
+    simint_osteifunc_array[1][1][2][0][2] = ostei_deriv1_p_d_s_d_ptr;
+    simint_osteifunc_array[1][1][2][1][0] = ostei_deriv1_p_d_p_s_ptr;
+    simint_osteifunc_array[1][1][2][1][1] = ostei_deriv1_p_d_p_p_ptr;
+    simint_osteifunc_array[1][1][2][1][2] = ostei_deriv1_p_d_p_d_ptr;
+    simint_osteifunc_array[1][1][2][2][0] = ostei_deriv1_p_d_d_s_ptr;
+    simint_osteifunc_array[1][1][2][2][1] = ostei_deriv1_p_d_d_p_ptr;
+    simint_osteifunc_array[1][1][2][2][2] = ostei_deriv1_p_d_d_d_ptr;
+    simint_osteifunc_array[1][2][0][0][0] = ostei_deriv1_d_s_s_s_ptr;
+    simint_osteifunc_array[1][2][0][0][1] = ostei_deriv1_d_s_s_p_ptr;
+    simint_osteifunc_array[1][2][0][0][2] = ostei_deriv1_d_s_s_d_ptr;
+    simint_osteifunc_array[1][2][0][1][0] = ostei_deriv1_d_s_p_s_ptr;
+    simint_osteifunc_array[1][2][0][1][1] = ostei_deriv1_d_s_p_p_ptr;
+    simint_osteifunc_array[1][2][0][1][2] = ostei_deriv1_d_s_p_d_ptr;
+    simint_osteifunc_array[1][2][0][2][0] = ostei_deriv1_d_s_d_s_ptr;
+    simint_osteifunc_array[1][2][0][2][1] = ostei_deriv1_d_s_d_p_ptr;
+    simint_osteifunc_array[1][2][0][2][2] = ostei_deriv1_d_s_d_d_ptr;
+    simint_osteifunc_array[1][2][1][0][0] = ostei_deriv1_d_p_s_s_ptr;
+    simint_osteifunc_array[1][2][1][0][1] = ostei_deriv1_d_p_s_p_ptr;
+    simint_osteifunc_array[1][2][1][0][2] = ostei_deriv1_d_p_s_d_ptr;
+    simint_osteifunc_array[1][2][1][1][0] = ostei_deriv1_d_p_p_s_ptr;
+    simint_osteifunc_array[1][2][1][1][1] = ostei_deriv1_d_p_p_p_ptr;
+    simint_osteifunc_array[1][2][1][1][2] = ostei_deriv1_d_p_p_d_ptr;
+    simint_osteifunc_array[1][2][1][2][0] = ostei_deriv1_d_p_d_s_ptr;
+    simint_osteifunc_array[1][2][1][2][1] = ostei_deriv1_d_p_d_p_ptr;
+    simint_osteifunc_array[1][2][1][2][2] = ostei_deriv1_d_p_d_d_ptr;
+    simint_osteifunc_array[1][2][2][0][0] = ostei_deriv1_d_d_s_s_ptr;
+    simint_osteifunc_array[1][2][2][0][1] = ostei_deriv1_d_d_s_p_ptr;
+    simint_osteifunc_array[1][2][2][0][2] = ostei_deriv1_d_d_s_d_ptr;
+    simint_osteifunc_array[1][2][2][1][0] = ostei_deriv1_d_d_p_s_ptr;
+    simint_osteifunc_array[1][2][2][1][1] = ostei_deriv1_d_d_p_p_ptr;
+    simint_osteifunc_array[1][2][2][1][2] = ostei_deriv1_d_d_p_d_ptr;
+    simint_osteifunc_array[1][2][2][2][0] = ostei_deriv1_d_d_d_s_ptr;
+    simint_osteifunc_array[1][2][2][2][1] = ostei_deriv1_d_d_d_p_ptr;
+    simint_osteifunc_array[1][2][2][2][2] = ostei_deriv1_d_d_d_d_ptr;
     #endif
 
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 3
-    simint_osteifunc_array[1][0][0][0][3] = ostei_deriv1_s_s_s_f;
-    simint_osteifunc_array[1][0][0][1][3] = ostei_deriv1_s_s_p_f;
-    simint_osteifunc_array[1][0][0][2][3] = ostei_deriv1_s_s_d_f;
-    simint_osteifunc_array[1][0][0][3][0] = ostei_deriv1_s_s_f_s;
-    simint_osteifunc_array[1][0][0][3][1] = ostei_deriv1_s_s_f_p;
-    simint_osteifunc_array[1][0][0][3][2] = ostei_deriv1_s_s_f_d;
-    simint_osteifunc_array[1][0][0][3][3] = ostei_deriv1_s_s_f_f;
-    simint_osteifunc_array[1][0][1][0][3] = ostei_deriv1_s_p_s_f;
-    simint_osteifunc_array[1][0][1][1][3] = ostei_deriv1_s_p_p_f;
-    simint_osteifunc_array[1][0][1][2][3] = ostei_deriv1_s_p_d_f;
-    simint_osteifunc_array[1][0][1][3][0] = ostei_deriv1_s_p_f_s;
-    simint_osteifunc_array[1][0][1][3][1] = ostei_deriv1_s_p_f_p;
-    simint_osteifunc_array[1][0][1][3][2] = ostei_deriv1_s_p_f_d;
-    simint_osteifunc_array[1][0][1][3][3] = ostei_deriv1_s_p_f_f;
-    simint_osteifunc_array[1][0][2][0][3] = ostei_deriv1_s_d_s_f;
-    simint_osteifunc_array[1][0][2][1][3] = ostei_deriv1_s_d_p_f;
-    simint_osteifunc_array[1][0][2][2][3] = ostei_deriv1_s_d_d_f;
-    simint_osteifunc_array[1][0][2][3][0] = ostei_deriv1_s_d_f_s;
-    simint_osteifunc_array[1][0][2][3][1] = ostei_deriv1_s_d_f_p;
-    simint_osteifunc_array[1][0][2][3][2] = ostei_deriv1_s_d_f_d;
-    simint_osteifunc_array[1][0][2][3][3] = ostei_deriv1_s_d_f_f;
-    simint_osteifunc_array[1][0][3][0][0] = ostei_deriv1_s_f_s_s;
-    simint_osteifunc_array[1][0][3][0][1] = ostei_deriv1_s_f_s_p;
-    simint_osteifunc_array[1][0][3][0][2] = ostei_deriv1_s_f_s_d;
-    simint_osteifunc_array[1][0][3][0][3] = ostei_deriv1_s_f_s_f;
-    simint_osteifunc_array[1][0][3][1][0] = ostei_deriv1_s_f_p_s;
-    simint_osteifunc_array[1][0][3][1][1] = ostei_deriv1_s_f_p_p;
-    simint_osteifunc_array[1][0][3][1][2] = ostei_deriv1_s_f_p_d;
-    simint_osteifunc_array[1][0][3][1][3] = ostei_deriv1_s_f_p_f;
-    simint_osteifunc_array[1][0][3][2][0] = ostei_deriv1_s_f_d_s;
-    simint_osteifunc_array[1][0][3][2][1] = ostei_deriv1_s_f_d_p;
-    simint_osteifunc_array[1][0][3][2][2] = ostei_deriv1_s_f_d_d;
-    simint_osteifunc_array[1][0][3][2][3] = ostei_deriv1_s_f_d_f;
-    simint_osteifunc_array[1][0][3][3][0] = ostei_deriv1_s_f_f_s;
-    simint_osteifunc_array[1][0][3][3][1] = ostei_deriv1_s_f_f_p;
-    simint_osteifunc_array[1][0][3][3][2] = ostei_deriv1_s_f_f_d;
-    simint_osteifunc_array[1][0][3][3][3] = ostei_deriv1_s_f_f_f;
-    simint_osteifunc_array[1][1][0][0][3] = ostei_deriv1_p_s_s_f;
-    simint_osteifunc_array[1][1][0][1][3] = ostei_deriv1_p_s_p_f;
-    simint_osteifunc_array[1][1][0][2][3] = ostei_deriv1_p_s_d_f;
-    simint_osteifunc_array[1][1][0][3][0] = ostei_deriv1_p_s_f_s;
-    simint_osteifunc_array[1][1][0][3][1] = ostei_deriv1_p_s_f_p;
-    simint_osteifunc_array[1][1][0][3][2] = ostei_deriv1_p_s_f_d;
-    simint_osteifunc_array[1][1][0][3][3] = ostei_deriv1_p_s_f_f;
-    simint_osteifunc_array[1][1][1][0][3] = ostei_deriv1_p_p_s_f;
-    simint_osteifunc_array[1][1][1][1][3] = ostei_deriv1_p_p_p_f;
-    simint_osteifunc_array[1][1][1][2][3] = ostei_deriv1_p_p_d_f;
-    simint_osteifunc_array[1][1][1][3][0] = ostei_deriv1_p_p_f_s;
-    simint_osteifunc_array[1][1][1][3][1] = ostei_deriv1_p_p_f_p;
-    simint_osteifunc_array[1][1][1][3][2] = ostei_deriv1_p_p_f_d;
-    simint_osteifunc_array[1][1][1][3][3] = ostei_deriv1_p_p_f_f;
-    simint_osteifunc_array[1][1][2][0][3] = ostei_deriv1_p_d_s_f;
-    simint_osteifunc_array[1][1][2][1][3] = ostei_deriv1_p_d_p_f;
-    simint_osteifunc_array[1][1][2][2][3] = ostei_deriv1_p_d_d_f;
-    simint_osteifunc_array[1][1][2][3][0] = ostei_deriv1_p_d_f_s;
-    simint_osteifunc_array[1][1][2][3][1] = ostei_deriv1_p_d_f_p;
-    simint_osteifunc_array[1][1][2][3][2] = ostei_deriv1_p_d_f_d;
-    simint_osteifunc_array[1][1][2][3][3] = ostei_deriv1_p_d_f_f;
-    simint_osteifunc_array[1][1][3][0][0] = ostei_deriv1_p_f_s_s;
-    simint_osteifunc_array[1][1][3][0][1] = ostei_deriv1_p_f_s_p;
-    simint_osteifunc_array[1][1][3][0][2] = ostei_deriv1_p_f_s_d;
-    simint_osteifunc_array[1][1][3][0][3] = ostei_deriv1_p_f_s_f;
-    simint_osteifunc_array[1][1][3][1][0] = ostei_deriv1_p_f_p_s;
-    simint_osteifunc_array[1][1][3][1][1] = ostei_deriv1_p_f_p_p;
-    simint_osteifunc_array[1][1][3][1][2] = ostei_deriv1_p_f_p_d;
-    simint_osteifunc_array[1][1][3][1][3] = ostei_deriv1_p_f_p_f;
-    simint_osteifunc_array[1][1][3][2][0] = ostei_deriv1_p_f_d_s;
-    simint_osteifunc_array[1][1][3][2][1] = ostei_deriv1_p_f_d_p;
-    simint_osteifunc_array[1][1][3][2][2] = ostei_deriv1_p_f_d_d;
-    simint_osteifunc_array[1][1][3][2][3] = ostei_deriv1_p_f_d_f;
-    simint_osteifunc_array[1][1][3][3][0] = ostei_deriv1_p_f_f_s;
-    simint_osteifunc_array[1][1][3][3][1] = ostei_deriv1_p_f_f_p;
-    simint_osteifunc_array[1][1][3][3][2] = ostei_deriv1_p_f_f_d;
-    simint_osteifunc_array[1][1][3][3][3] = ostei_deriv1_p_f_f_f;
-    simint_osteifunc_array[1][2][0][0][3] = ostei_deriv1_d_s_s_f;
-    simint_osteifunc_array[1][2][0][1][3] = ostei_deriv1_d_s_p_f;
-    simint_osteifunc_array[1][2][0][2][3] = ostei_deriv1_d_s_d_f;
-    simint_osteifunc_array[1][2][0][3][0] = ostei_deriv1_d_s_f_s;
-    simint_osteifunc_array[1][2][0][3][1] = ostei_deriv1_d_s_f_p;
-    simint_osteifunc_array[1][2][0][3][2] = ostei_deriv1_d_s_f_d;
-    simint_osteifunc_array[1][2][0][3][3] = ostei_deriv1_d_s_f_f;
-    simint_osteifunc_array[1][2][1][0][3] = ostei_deriv1_d_p_s_f;
-    simint_osteifunc_array[1][2][1][1][3] = ostei_deriv1_d_p_p_f;
-    simint_osteifunc_array[1][2][1][2][3] = ostei_deriv1_d_p_d_f;
-    simint_osteifunc_array[1][2][1][3][0] = ostei_deriv1_d_p_f_s;
-    simint_osteifunc_array[1][2][1][3][1] = ostei_deriv1_d_p_f_p;
-    simint_osteifunc_array[1][2][1][3][2] = ostei_deriv1_d_p_f_d;
-    simint_osteifunc_array[1][2][1][3][3] = ostei_deriv1_d_p_f_f;
-    simint_osteifunc_array[1][2][2][0][3] = ostei_deriv1_d_d_s_f;
-    simint_osteifunc_array[1][2][2][1][3] = ostei_deriv1_d_d_p_f;
-    simint_osteifunc_array[1][2][2][2][3] = ostei_deriv1_d_d_d_f;
-    simint_osteifunc_array[1][2][2][3][0] = ostei_deriv1_d_d_f_s;
-    simint_osteifunc_array[1][2][2][3][1] = ostei_deriv1_d_d_f_p;
-    simint_osteifunc_array[1][2][2][3][2] = ostei_deriv1_d_d_f_d;
-    simint_osteifunc_array[1][2][2][3][3] = ostei_deriv1_d_d_f_f;
-    simint_osteifunc_array[1][2][3][0][0] = ostei_deriv1_d_f_s_s;
-    simint_osteifunc_array[1][2][3][0][1] = ostei_deriv1_d_f_s_p;
-    simint_osteifunc_array[1][2][3][0][2] = ostei_deriv1_d_f_s_d;
-    simint_osteifunc_array[1][2][3][0][3] = ostei_deriv1_d_f_s_f;
-    simint_osteifunc_array[1][2][3][1][0] = ostei_deriv1_d_f_p_s;
-    simint_osteifunc_array[1][2][3][1][1] = ostei_deriv1_d_f_p_p;
-    simint_osteifunc_array[1][2][3][1][2] = ostei_deriv1_d_f_p_d;
-    simint_osteifunc_array[1][2][3][1][3] = ostei_deriv1_d_f_p_f;
-    simint_osteifunc_array[1][2][3][2][0] = ostei_deriv1_d_f_d_s;
-    simint_osteifunc_array[1][2][3][2][1] = ostei_deriv1_d_f_d_p;
-    simint_osteifunc_array[1][2][3][2][2] = ostei_deriv1_d_f_d_d;
-    simint_osteifunc_array[1][2][3][2][3] = ostei_deriv1_d_f_d_f;
-    simint_osteifunc_array[1][2][3][3][0] = ostei_deriv1_d_f_f_s;
-    simint_osteifunc_array[1][2][3][3][1] = ostei_deriv1_d_f_f_p;
-    simint_osteifunc_array[1][2][3][3][2] = ostei_deriv1_d_f_f_d;
-    simint_osteifunc_array[1][2][3][3][3] = ostei_deriv1_d_f_f_f;
-    simint_osteifunc_array[1][3][0][0][0] = ostei_deriv1_f_s_s_s;
-    simint_osteifunc_array[1][3][0][0][1] = ostei_deriv1_f_s_s_p;
-    simint_osteifunc_array[1][3][0][0][2] = ostei_deriv1_f_s_s_d;
-    simint_osteifunc_array[1][3][0][0][3] = ostei_deriv1_f_s_s_f;
-    simint_osteifunc_array[1][3][0][1][0] = ostei_deriv1_f_s_p_s;
-    simint_osteifunc_array[1][3][0][1][1] = ostei_deriv1_f_s_p_p;
-    simint_osteifunc_array[1][3][0][1][2] = ostei_deriv1_f_s_p_d;
-    simint_osteifunc_array[1][3][0][1][3] = ostei_deriv1_f_s_p_f;
-    simint_osteifunc_array[1][3][0][2][0] = ostei_deriv1_f_s_d_s;
-    simint_osteifunc_array[1][3][0][2][1] = ostei_deriv1_f_s_d_p;
-    simint_osteifunc_array[1][3][0][2][2] = ostei_deriv1_f_s_d_d;
-    simint_osteifunc_array[1][3][0][2][3] = ostei_deriv1_f_s_d_f;
-    simint_osteifunc_array[1][3][0][3][0] = ostei_deriv1_f_s_f_s;
-    simint_osteifunc_array[1][3][0][3][1] = ostei_deriv1_f_s_f_p;
-    simint_osteifunc_array[1][3][0][3][2] = ostei_deriv1_f_s_f_d;
-    simint_osteifunc_array[1][3][0][3][3] = ostei_deriv1_f_s_f_f;
-    simint_osteifunc_array[1][3][1][0][0] = ostei_deriv1_f_p_s_s;
-    simint_osteifunc_array[1][3][1][0][1] = ostei_deriv1_f_p_s_p;
-    simint_osteifunc_array[1][3][1][0][2] = ostei_deriv1_f_p_s_d;
-    simint_osteifunc_array[1][3][1][0][3] = ostei_deriv1_f_p_s_f;
-    simint_osteifunc_array[1][3][1][1][0] = ostei_deriv1_f_p_p_s;
-    simint_osteifunc_array[1][3][1][1][1] = ostei_deriv1_f_p_p_p;
-    simint_osteifunc_array[1][3][1][1][2] = ostei_deriv1_f_p_p_d;
-    simint_osteifunc_array[1][3][1][1][3] = ostei_deriv1_f_p_p_f;
-    simint_osteifunc_array[1][3][1][2][0] = ostei_deriv1_f_p_d_s;
-    simint_osteifunc_array[1][3][1][2][1] = ostei_deriv1_f_p_d_p;
-    simint_osteifunc_array[1][3][1][2][2] = ostei_deriv1_f_p_d_d;
-    simint_osteifunc_array[1][3][1][2][3] = ostei_deriv1_f_p_d_f;
-    simint_osteifunc_array[1][3][1][3][0] = ostei_deriv1_f_p_f_s;
-    simint_osteifunc_array[1][3][1][3][1] = ostei_deriv1_f_p_f_p;
-    simint_osteifunc_array[1][3][1][3][2] = ostei_deriv1_f_p_f_d;
-    simint_osteifunc_array[1][3][1][3][3] = ostei_deriv1_f_p_f_f;
-    simint_osteifunc_array[1][3][2][0][0] = ostei_deriv1_f_d_s_s;
-    simint_osteifunc_array[1][3][2][0][1] = ostei_deriv1_f_d_s_p;
-    simint_osteifunc_array[1][3][2][0][2] = ostei_deriv1_f_d_s_d;
-    simint_osteifunc_array[1][3][2][0][3] = ostei_deriv1_f_d_s_f;
-    simint_osteifunc_array[1][3][2][1][0] = ostei_deriv1_f_d_p_s;
-    simint_osteifunc_array[1][3][2][1][1] = ostei_deriv1_f_d_p_p;
-    simint_osteifunc_array[1][3][2][1][2] = ostei_deriv1_f_d_p_d;
-    simint_osteifunc_array[1][3][2][1][3] = ostei_deriv1_f_d_p_f;
-    simint_osteifunc_array[1][3][2][2][0] = ostei_deriv1_f_d_d_s;
-    simint_osteifunc_array[1][3][2][2][1] = ostei_deriv1_f_d_d_p;
-    simint_osteifunc_array[1][3][2][2][2] = ostei_deriv1_f_d_d_d;
-    simint_osteifunc_array[1][3][2][2][3] = ostei_deriv1_f_d_d_f;
-    simint_osteifunc_array[1][3][2][3][0] = ostei_deriv1_f_d_f_s;
-    simint_osteifunc_array[1][3][2][3][1] = ostei_deriv1_f_d_f_p;
-    simint_osteifunc_array[1][3][2][3][2] = ostei_deriv1_f_d_f_d;
-    simint_osteifunc_array[1][3][2][3][3] = ostei_deriv1_f_d_f_f;
-    simint_osteifunc_array[1][3][3][0][0] = ostei_deriv1_f_f_s_s;
-    simint_osteifunc_array[1][3][3][0][1] = ostei_deriv1_f_f_s_p;
-    simint_osteifunc_array[1][3][3][0][2] = ostei_deriv1_f_f_s_d;
-    simint_osteifunc_array[1][3][3][0][3] = ostei_deriv1_f_f_s_f;
-    simint_osteifunc_array[1][3][3][1][0] = ostei_deriv1_f_f_p_s;
-    simint_osteifunc_array[1][3][3][1][1] = ostei_deriv1_f_f_p_p;
-    simint_osteifunc_array[1][3][3][1][2] = ostei_deriv1_f_f_p_d;
-    simint_osteifunc_array[1][3][3][1][3] = ostei_deriv1_f_f_p_f;
-    simint_osteifunc_array[1][3][3][2][0] = ostei_deriv1_f_f_d_s;
-    simint_osteifunc_array[1][3][3][2][1] = ostei_deriv1_f_f_d_p;
-    simint_osteifunc_array[1][3][3][2][2] = ostei_deriv1_f_f_d_d;
-    simint_osteifunc_array[1][3][3][2][3] = ostei_deriv1_f_f_d_f;
-    simint_osteifunc_array[1][3][3][3][0] = ostei_deriv1_f_f_f_s;
-    simint_osteifunc_array[1][3][3][3][1] = ostei_deriv1_f_f_f_p;
-    simint_osteifunc_array[1][3][3][3][2] = ostei_deriv1_f_f_f_d;
-    simint_osteifunc_array[1][3][3][3][3] = ostei_deriv1_f_f_f_f;
+    simint_osteifunc_array[1][0][0][0][3] = ostei_deriv1_s_s_s_f_ptr;
+    simint_osteifunc_array[1][0][0][1][3] = ostei_deriv1_s_s_p_f_ptr;
+    simint_osteifunc_array[1][0][0][2][3] = ostei_deriv1_s_s_d_f_ptr;
+    simint_osteifunc_array[1][0][0][3][0] = ostei_deriv1_s_s_f_s_ptr;
+    simint_osteifunc_array[1][0][0][3][1] = ostei_deriv1_s_s_f_p_ptr;
+    simint_osteifunc_array[1][0][0][3][2] = ostei_deriv1_s_s_f_d_ptr;
+    simint_osteifunc_array[1][0][0][3][3] = ostei_deriv1_s_s_f_f_ptr;
+    simint_osteifunc_array[1][0][1][0][3] = ostei_deriv1_s_p_s_f_ptr;
+    simint_osteifunc_array[1][0][1][1][3] = ostei_deriv1_s_p_p_f_ptr;
+    simint_osteifunc_array[1][0][1][2][3] = ostei_deriv1_s_p_d_f_ptr;
+    simint_osteifunc_array[1][0][1][3][0] = ostei_deriv1_s_p_f_s_ptr;
+    simint_osteifunc_array[1][0][1][3][1] = ostei_deriv1_s_p_f_p_ptr;
+    simint_osteifunc_array[1][0][1][3][2] = ostei_deriv1_s_p_f_d_ptr;
+    simint_osteifunc_array[1][0][1][3][3] = ostei_deriv1_s_p_f_f_ptr;
+    simint_osteifunc_array[1][0][2][0][3] = ostei_deriv1_s_d_s_f_ptr;
+    simint_osteifunc_array[1][0][2][1][3] = ostei_deriv1_s_d_p_f_ptr;
+    simint_osteifunc_array[1][0][2][2][3] = ostei_deriv1_s_d_d_f_ptr;
+    simint_osteifunc_array[1][0][2][3][0] = ostei_deriv1_s_d_f_s_ptr;
+    simint_osteifunc_array[1][0][2][3][1] = ostei_deriv1_s_d_f_p_ptr;
+    simint_osteifunc_array[1][0][2][3][2] = ostei_deriv1_s_d_f_d_ptr;
+    simint_osteifunc_array[1][0][2][3][3] = ostei_deriv1_s_d_f_f_ptr;
+    simint_osteifunc_array[1][0][3][0][0] = ostei_deriv1_s_f_s_s_ptr;
+    simint_osteifunc_array[1][0][3][0][1] = ostei_deriv1_s_f_s_p_ptr;
+    simint_osteifunc_array[1][0][3][0][2] = ostei_deriv1_s_f_s_d_ptr;
+    simint_osteifunc_array[1][0][3][0][3] = ostei_deriv1_s_f_s_f_ptr;
+    simint_osteifunc_array[1][0][3][1][0] = ostei_deriv1_s_f_p_s_ptr;
+    simint_osteifunc_array[1][0][3][1][1] = ostei_deriv1_s_f_p_p_ptr;
+    simint_osteifunc_array[1][0][3][1][2] = ostei_deriv1_s_f_p_d_ptr;
+    simint_osteifunc_array[1][0][3][1][3] = ostei_deriv1_s_f_p_f_ptr;
+    simint_osteifunc_array[1][0][3][2][0] = ostei_deriv1_s_f_d_s_ptr;
+    simint_osteifunc_array[1][0][3][2][1] = ostei_deriv1_s_f_d_p_ptr;
+    simint_osteifunc_array[1][0][3][2][2] = ostei_deriv1_s_f_d_d_ptr;
+    simint_osteifunc_array[1][0][3][2][3] = ostei_deriv1_s_f_d_f_ptr;
+    simint_osteifunc_array[1][0][3][3][0] = ostei_deriv1_s_f_f_s_ptr;
+    simint_osteifunc_array[1][0][3][3][1] = ostei_deriv1_s_f_f_p_ptr;
+    simint_osteifunc_array[1][0][3][3][2] = ostei_deriv1_s_f_f_d_ptr;
+    simint_osteifunc_array[1][0][3][3][3] = ostei_deriv1_s_f_f_f_ptr;
+    simint_osteifunc_array[1][1][0][0][3] = ostei_deriv1_p_s_s_f_ptr;
+    simint_osteifunc_array[1][1][0][1][3] = ostei_deriv1_p_s_p_f_ptr;
+    simint_osteifunc_array[1][1][0][2][3] = ostei_deriv1_p_s_d_f_ptr;
+    simint_osteifunc_array[1][1][0][3][0] = ostei_deriv1_p_s_f_s_ptr;
+    simint_osteifunc_array[1][1][0][3][1] = ostei_deriv1_p_s_f_p_ptr;
+    simint_osteifunc_array[1][1][0][3][2] = ostei_deriv1_p_s_f_d_ptr;
+    simint_osteifunc_array[1][1][0][3][3] = ostei_deriv1_p_s_f_f_ptr;
+    simint_osteifunc_array[1][1][1][0][3] = ostei_deriv1_p_p_s_f_ptr;
+    simint_osteifunc_array[1][1][1][1][3] = ostei_deriv1_p_p_p_f_ptr;
+    simint_osteifunc_array[1][1][1][2][3] = ostei_deriv1_p_p_d_f_ptr;
+    simint_osteifunc_array[1][1][1][3][0] = ostei_deriv1_p_p_f_s_ptr;
+    simint_osteifunc_array[1][1][1][3][1] = ostei_deriv1_p_p_f_p_ptr;
+    simint_osteifunc_array[1][1][1][3][2] = ostei_deriv1_p_p_f_d_ptr;
+    simint_osteifunc_array[1][1][1][3][3] = ostei_deriv1_p_p_f_f_ptr;
+    simint_osteifunc_array[1][1][2][0][3] = ostei_deriv1_p_d_s_f_ptr;
+    simint_osteifunc_array[1][1][2][1][3] = ostei_deriv1_p_d_p_f_ptr;
+    simint_osteifunc_array[1][1][2][2][3] = ostei_deriv1_p_d_d_f_ptr;
+    simint_osteifunc_array[1][1][2][3][0] = ostei_deriv1_p_d_f_s_ptr;
+    simint_osteifunc_array[1][1][2][3][1] = ostei_deriv1_p_d_f_p_ptr;
+    simint_osteifunc_array[1][1][2][3][2] = ostei_deriv1_p_d_f_d_ptr;
+    simint_osteifunc_array[1][1][2][3][3] = ostei_deriv1_p_d_f_f_ptr;
+    simint_osteifunc_array[1][1][3][0][0] = ostei_deriv1_p_f_s_s_ptr;
+    simint_osteifunc_array[1][1][3][0][1] = ostei_deriv1_p_f_s_p_ptr;
+    simint_osteifunc_array[1][1][3][0][2] = ostei_deriv1_p_f_s_d_ptr;
+    simint_osteifunc_array[1][1][3][0][3] = ostei_deriv1_p_f_s_f_ptr;
+    simint_osteifunc_array[1][1][3][1][0] = ostei_deriv1_p_f_p_s_ptr;
+    simint_osteifunc_array[1][1][3][1][1] = ostei_deriv1_p_f_p_p_ptr;
+    simint_osteifunc_array[1][1][3][1][2] = ostei_deriv1_p_f_p_d_ptr;
+    simint_osteifunc_array[1][1][3][1][3] = ostei_deriv1_p_f_p_f_ptr;
+    simint_osteifunc_array[1][1][3][2][0] = ostei_deriv1_p_f_d_s_ptr;
+    simint_osteifunc_array[1][1][3][2][1] = ostei_deriv1_p_f_d_p_ptr;
+    simint_osteifunc_array[1][1][3][2][2] = ostei_deriv1_p_f_d_d_ptr;
+    simint_osteifunc_array[1][1][3][2][3] = ostei_deriv1_p_f_d_f_ptr;
+    simint_osteifunc_array[1][1][3][3][0] = ostei_deriv1_p_f_f_s_ptr;
+    simint_osteifunc_array[1][1][3][3][1] = ostei_deriv1_p_f_f_p_ptr;
+    simint_osteifunc_array[1][1][3][3][2] = ostei_deriv1_p_f_f_d_ptr;
+    simint_osteifunc_array[1][1][3][3][3] = ostei_deriv1_p_f_f_f_ptr;
+    simint_osteifunc_array[1][2][0][0][3] = ostei_deriv1_d_s_s_f_ptr;
+    simint_osteifunc_array[1][2][0][1][3] = ostei_deriv1_d_s_p_f_ptr;
+    simint_osteifunc_array[1][2][0][2][3] = ostei_deriv1_d_s_d_f_ptr;
+    simint_osteifunc_array[1][2][0][3][0] = ostei_deriv1_d_s_f_s_ptr;
+    simint_osteifunc_array[1][2][0][3][1] = ostei_deriv1_d_s_f_p_ptr;
+    simint_osteifunc_array[1][2][0][3][2] = ostei_deriv1_d_s_f_d_ptr;
+    simint_osteifunc_array[1][2][0][3][3] = ostei_deriv1_d_s_f_f_ptr;
+    simint_osteifunc_array[1][2][1][0][3] = ostei_deriv1_d_p_s_f_ptr;
+    simint_osteifunc_array[1][2][1][1][3] = ostei_deriv1_d_p_p_f_ptr;
+    simint_osteifunc_array[1][2][1][2][3] = ostei_deriv1_d_p_d_f_ptr;
+    simint_osteifunc_array[1][2][1][3][0] = ostei_deriv1_d_p_f_s_ptr;
+    simint_osteifunc_array[1][2][1][3][1] = ostei_deriv1_d_p_f_p_ptr;
+    simint_osteifunc_array[1][2][1][3][2] = ostei_deriv1_d_p_f_d_ptr;
+    simint_osteifunc_array[1][2][1][3][3] = ostei_deriv1_d_p_f_f_ptr;
+    simint_osteifunc_array[1][2][2][0][3] = ostei_deriv1_d_d_s_f_ptr;
+    simint_osteifunc_array[1][2][2][1][3] = ostei_deriv1_d_d_p_f_ptr;
+    simint_osteifunc_array[1][2][2][2][3] = ostei_deriv1_d_d_d_f_ptr;
+    simint_osteifunc_array[1][2][2][3][0] = ostei_deriv1_d_d_f_s_ptr;
+    simint_osteifunc_array[1][2][2][3][1] = ostei_deriv1_d_d_f_p_ptr;
+    simint_osteifunc_array[1][2][2][3][2] = ostei_deriv1_d_d_f_d_ptr;
+    simint_osteifunc_array[1][2][2][3][3] = ostei_deriv1_d_d_f_f_ptr;
+    simint_osteifunc_array[1][2][3][0][0] = ostei_deriv1_d_f_s_s_ptr;
+    simint_osteifunc_array[1][2][3][0][1] = ostei_deriv1_d_f_s_p_ptr;
+    simint_osteifunc_array[1][2][3][0][2] = ostei_deriv1_d_f_s_d_ptr;
+    simint_osteifunc_array[1][2][3][0][3] = ostei_deriv1_d_f_s_f_ptr;
+    simint_osteifunc_array[1][2][3][1][0] = ostei_deriv1_d_f_p_s_ptr;
+    simint_osteifunc_array[1][2][3][1][1] = ostei_deriv1_d_f_p_p_ptr;
+    simint_osteifunc_array[1][2][3][1][2] = ostei_deriv1_d_f_p_d_ptr;
+    simint_osteifunc_array[1][2][3][1][3] = ostei_deriv1_d_f_p_f_ptr;
+    simint_osteifunc_array[1][2][3][2][0] = ostei_deriv1_d_f_d_s_ptr;
+    simint_osteifunc_array[1][2][3][2][1] = ostei_deriv1_d_f_d_p_ptr;
+    simint_osteifunc_array[1][2][3][2][2] = ostei_deriv1_d_f_d_d_ptr;
+    simint_osteifunc_array[1][2][3][2][3] = ostei_deriv1_d_f_d_f_ptr;
+    simint_osteifunc_array[1][2][3][3][0] = ostei_deriv1_d_f_f_s_ptr;
+    simint_osteifunc_array[1][2][3][3][1] = ostei_deriv1_d_f_f_p_ptr;
+    simint_osteifunc_array[1][2][3][3][2] = ostei_deriv1_d_f_f_d_ptr;
+    simint_osteifunc_array[1][2][3][3][3] = ostei_deriv1_d_f_f_f_ptr;
+    simint_osteifunc_array[1][3][0][0][0] = ostei_deriv1_f_s_s_s_ptr;
+    simint_osteifunc_array[1][3][0][0][1] = ostei_deriv1_f_s_s_p_ptr;
+    simint_osteifunc_array[1][3][0][0][2] = ostei_deriv1_f_s_s_d_ptr;
+    simint_osteifunc_array[1][3][0][0][3] = ostei_deriv1_f_s_s_f_ptr;
+    simint_osteifunc_array[1][3][0][1][0] = ostei_deriv1_f_s_p_s_ptr;
+    simint_osteifunc_array[1][3][0][1][1] = ostei_deriv1_f_s_p_p_ptr;
+    simint_osteifunc_array[1][3][0][1][2] = ostei_deriv1_f_s_p_d_ptr;
+    simint_osteifunc_array[1][3][0][1][3] = ostei_deriv1_f_s_p_f_ptr;
+    simint_osteifunc_array[1][3][0][2][0] = ostei_deriv1_f_s_d_s_ptr;
+    simint_osteifunc_array[1][3][0][2][1] = ostei_deriv1_f_s_d_p_ptr;
+    simint_osteifunc_array[1][3][0][2][2] = ostei_deriv1_f_s_d_d_ptr;
+    simint_osteifunc_array[1][3][0][2][3] = ostei_deriv1_f_s_d_f_ptr;
+    simint_osteifunc_array[1][3][0][3][0] = ostei_deriv1_f_s_f_s_ptr;
+    simint_osteifunc_array[1][3][0][3][1] = ostei_deriv1_f_s_f_p_ptr;
+    simint_osteifunc_array[1][3][0][3][2] = ostei_deriv1_f_s_f_d_ptr;
+    simint_osteifunc_array[1][3][0][3][3] = ostei_deriv1_f_s_f_f_ptr;
+    simint_osteifunc_array[1][3][1][0][0] = ostei_deriv1_f_p_s_s_ptr;
+    simint_osteifunc_array[1][3][1][0][1] = ostei_deriv1_f_p_s_p_ptr;
+    simint_osteifunc_array[1][3][1][0][2] = ostei_deriv1_f_p_s_d_ptr;
+    simint_osteifunc_array[1][3][1][0][3] = ostei_deriv1_f_p_s_f_ptr;
+    simint_osteifunc_array[1][3][1][1][0] = ostei_deriv1_f_p_p_s_ptr;
+    simint_osteifunc_array[1][3][1][1][1] = ostei_deriv1_f_p_p_p_ptr;
+    simint_osteifunc_array[1][3][1][1][2] = ostei_deriv1_f_p_p_d_ptr;
+    simint_osteifunc_array[1][3][1][1][3] = ostei_deriv1_f_p_p_f_ptr;
+    simint_osteifunc_array[1][3][1][2][0] = ostei_deriv1_f_p_d_s_ptr;
+    simint_osteifunc_array[1][3][1][2][1] = ostei_deriv1_f_p_d_p_ptr;
+    simint_osteifunc_array[1][3][1][2][2] = ostei_deriv1_f_p_d_d_ptr;
+    simint_osteifunc_array[1][3][1][2][3] = ostei_deriv1_f_p_d_f_ptr;
+    simint_osteifunc_array[1][3][1][3][0] = ostei_deriv1_f_p_f_s_ptr;
+    simint_osteifunc_array[1][3][1][3][1] = ostei_deriv1_f_p_f_p_ptr;
+    simint_osteifunc_array[1][3][1][3][2] = ostei_deriv1_f_p_f_d_ptr;
+    simint_osteifunc_array[1][3][1][3][3] = ostei_deriv1_f_p_f_f_ptr;
+    simint_osteifunc_array[1][3][2][0][0] = ostei_deriv1_f_d_s_s_ptr;
+    simint_osteifunc_array[1][3][2][0][1] = ostei_deriv1_f_d_s_p_ptr;
+    simint_osteifunc_array[1][3][2][0][2] = ostei_deriv1_f_d_s_d_ptr;
+    simint_osteifunc_array[1][3][2][0][3] = ostei_deriv1_f_d_s_f_ptr;
+    simint_osteifunc_array[1][3][2][1][0] = ostei_deriv1_f_d_p_s_ptr;
+    simint_osteifunc_array[1][3][2][1][1] = ostei_deriv1_f_d_p_p_ptr;
+    simint_osteifunc_array[1][3][2][1][2] = ostei_deriv1_f_d_p_d_ptr;
+    simint_osteifunc_array[1][3][2][1][3] = ostei_deriv1_f_d_p_f_ptr;
+    simint_osteifunc_array[1][3][2][2][0] = ostei_deriv1_f_d_d_s_ptr;
+    simint_osteifunc_array[1][3][2][2][1] = ostei_deriv1_f_d_d_p_ptr;
+    simint_osteifunc_array[1][3][2][2][2] = ostei_deriv1_f_d_d_d_ptr;
+    simint_osteifunc_array[1][3][2][2][3] = ostei_deriv1_f_d_d_f_ptr;
+    simint_osteifunc_array[1][3][2][3][0] = ostei_deriv1_f_d_f_s_ptr;
+    simint_osteifunc_array[1][3][2][3][1] = ostei_deriv1_f_d_f_p_ptr;
+    simint_osteifunc_array[1][3][2][3][2] = ostei_deriv1_f_d_f_d_ptr;
+    simint_osteifunc_array[1][3][2][3][3] = ostei_deriv1_f_d_f_f_ptr;
+    simint_osteifunc_array[1][3][3][0][0] = ostei_deriv1_f_f_s_s_ptr;
+    simint_osteifunc_array[1][3][3][0][1] = ostei_deriv1_f_f_s_p_ptr;
+    simint_osteifunc_array[1][3][3][0][2] = ostei_deriv1_f_f_s_d_ptr;
+    simint_osteifunc_array[1][3][3][0][3] = ostei_deriv1_f_f_s_f_ptr;
+    simint_osteifunc_array[1][3][3][1][0] = ostei_deriv1_f_f_p_s_ptr;
+    simint_osteifunc_array[1][3][3][1][1] = ostei_deriv1_f_f_p_p_ptr;
+    simint_osteifunc_array[1][3][3][1][2] = ostei_deriv1_f_f_p_d_ptr;
+    simint_osteifunc_array[1][3][3][1][3] = ostei_deriv1_f_f_p_f_ptr;
+    simint_osteifunc_array[1][3][3][2][0] = ostei_deriv1_f_f_d_s_ptr;
+    simint_osteifunc_array[1][3][3][2][1] = ostei_deriv1_f_f_d_p_ptr;
+    simint_osteifunc_array[1][3][3][2][2] = ostei_deriv1_f_f_d_d_ptr;
+    simint_osteifunc_array[1][3][3][2][3] = ostei_deriv1_f_f_d_f_ptr;
+    simint_osteifunc_array[1][3][3][3][0] = ostei_deriv1_f_f_f_s_ptr;
+    simint_osteifunc_array[1][3][3][3][1] = ostei_deriv1_f_f_f_p_ptr;
+    simint_osteifunc_array[1][3][3][3][2] = ostei_deriv1_f_f_f_d_ptr;
+    simint_osteifunc_array[1][3][3][3][3] = ostei_deriv1_f_f_f_f_ptr;
     #endif
 
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 4
-    simint_osteifunc_array[1][0][0][0][4] = ostei_deriv1_s_s_s_g;
-    simint_osteifunc_array[1][0][0][1][4] = ostei_deriv1_s_s_p_g;
-    simint_osteifunc_array[1][0][0][2][4] = ostei_deriv1_s_s_d_g;
-    simint_osteifunc_array[1][0][0][3][4] = ostei_deriv1_s_s_f_g;
-    simint_osteifunc_array[1][0][0][4][0] = ostei_deriv1_s_s_g_s;
-    simint_osteifunc_array[1][0][0][4][1] = ostei_deriv1_s_s_g_p;
-    simint_osteifunc_array[1][0][0][4][2] = ostei_deriv1_s_s_g_d;
-    simint_osteifunc_array[1][0][0][4][3] = ostei_deriv1_s_s_g_f;
-    simint_osteifunc_array[1][0][0][4][4] = ostei_deriv1_s_s_g_g;
-    simint_osteifunc_array[1][0][1][0][4] = ostei_deriv1_s_p_s_g;
-    simint_osteifunc_array[1][0][1][1][4] = ostei_deriv1_s_p_p_g;
-    simint_osteifunc_array[1][0][1][2][4] = ostei_deriv1_s_p_d_g;
-    simint_osteifunc_array[1][0][1][3][4] = ostei_deriv1_s_p_f_g;
-    simint_osteifunc_array[1][0][1][4][0] = ostei_deriv1_s_p_g_s;
-    simint_osteifunc_array[1][0][1][4][1] = ostei_deriv1_s_p_g_p;
-    simint_osteifunc_array[1][0][1][4][2] = ostei_deriv1_s_p_g_d;
-    simint_osteifunc_array[1][0][1][4][3] = ostei_deriv1_s_p_g_f;
-    simint_osteifunc_array[1][0][1][4][4] = ostei_deriv1_s_p_g_g;
-    simint_osteifunc_array[1][0][2][0][4] = ostei_deriv1_s_d_s_g;
-    simint_osteifunc_array[1][0][2][1][4] = ostei_deriv1_s_d_p_g;
-    simint_osteifunc_array[1][0][2][2][4] = ostei_deriv1_s_d_d_g;
-    simint_osteifunc_array[1][0][2][3][4] = ostei_deriv1_s_d_f_g;
-    simint_osteifunc_array[1][0][2][4][0] = ostei_deriv1_s_d_g_s;
-    simint_osteifunc_array[1][0][2][4][1] = ostei_deriv1_s_d_g_p;
-    simint_osteifunc_array[1][0][2][4][2] = ostei_deriv1_s_d_g_d;
-    simint_osteifunc_array[1][0][2][4][3] = ostei_deriv1_s_d_g_f;
-    simint_osteifunc_array[1][0][2][4][4] = ostei_deriv1_s_d_g_g;
-    simint_osteifunc_array[1][0][3][0][4] = ostei_deriv1_s_f_s_g;
-    simint_osteifunc_array[1][0][3][1][4] = ostei_deriv1_s_f_p_g;
-    simint_osteifunc_array[1][0][3][2][4] = ostei_deriv1_s_f_d_g;
-    simint_osteifunc_array[1][0][3][3][4] = ostei_deriv1_s_f_f_g;
-    simint_osteifunc_array[1][0][3][4][0] = ostei_deriv1_s_f_g_s;
-    simint_osteifunc_array[1][0][3][4][1] = ostei_deriv1_s_f_g_p;
-    simint_osteifunc_array[1][0][3][4][2] = ostei_deriv1_s_f_g_d;
-    simint_osteifunc_array[1][0][3][4][3] = ostei_deriv1_s_f_g_f;
-    simint_osteifunc_array[1][0][3][4][4] = ostei_deriv1_s_f_g_g;
-    simint_osteifunc_array[1][0][4][0][0] = ostei_deriv1_s_g_s_s;
-    simint_osteifunc_array[1][0][4][0][1] = ostei_deriv1_s_g_s_p;
-    simint_osteifunc_array[1][0][4][0][2] = ostei_deriv1_s_g_s_d;
-    simint_osteifunc_array[1][0][4][0][3] = ostei_deriv1_s_g_s_f;
-    simint_osteifunc_array[1][0][4][0][4] = ostei_deriv1_s_g_s_g;
-    simint_osteifunc_array[1][0][4][1][0] = ostei_deriv1_s_g_p_s;
-    simint_osteifunc_array[1][0][4][1][1] = ostei_deriv1_s_g_p_p;
-    simint_osteifunc_array[1][0][4][1][2] = ostei_deriv1_s_g_p_d;
-    simint_osteifunc_array[1][0][4][1][3] = ostei_deriv1_s_g_p_f;
-    simint_osteifunc_array[1][0][4][1][4] = ostei_deriv1_s_g_p_g;
-    simint_osteifunc_array[1][0][4][2][0] = ostei_deriv1_s_g_d_s;
-    simint_osteifunc_array[1][0][4][2][1] = ostei_deriv1_s_g_d_p;
-    simint_osteifunc_array[1][0][4][2][2] = ostei_deriv1_s_g_d_d;
-    simint_osteifunc_array[1][0][4][2][3] = ostei_deriv1_s_g_d_f;
-    simint_osteifunc_array[1][0][4][2][4] = ostei_deriv1_s_g_d_g;
-    simint_osteifunc_array[1][0][4][3][0] = ostei_deriv1_s_g_f_s;
-    simint_osteifunc_array[1][0][4][3][1] = ostei_deriv1_s_g_f_p;
-    simint_osteifunc_array[1][0][4][3][2] = ostei_deriv1_s_g_f_d;
-    simint_osteifunc_array[1][0][4][3][3] = ostei_deriv1_s_g_f_f;
-    simint_osteifunc_array[1][0][4][3][4] = ostei_deriv1_s_g_f_g;
-    simint_osteifunc_array[1][0][4][4][0] = ostei_deriv1_s_g_g_s;
-    simint_osteifunc_array[1][0][4][4][1] = ostei_deriv1_s_g_g_p;
-    simint_osteifunc_array[1][0][4][4][2] = ostei_deriv1_s_g_g_d;
-    simint_osteifunc_array[1][0][4][4][3] = ostei_deriv1_s_g_g_f;
-    simint_osteifunc_array[1][0][4][4][4] = ostei_deriv1_s_g_g_g;
-    simint_osteifunc_array[1][1][0][0][4] = ostei_deriv1_p_s_s_g;
-    simint_osteifunc_array[1][1][0][1][4] = ostei_deriv1_p_s_p_g;
-    simint_osteifunc_array[1][1][0][2][4] = ostei_deriv1_p_s_d_g;
-    simint_osteifunc_array[1][1][0][3][4] = ostei_deriv1_p_s_f_g;
-    simint_osteifunc_array[1][1][0][4][0] = ostei_deriv1_p_s_g_s;
-    simint_osteifunc_array[1][1][0][4][1] = ostei_deriv1_p_s_g_p;
-    simint_osteifunc_array[1][1][0][4][2] = ostei_deriv1_p_s_g_d;
-    simint_osteifunc_array[1][1][0][4][3] = ostei_deriv1_p_s_g_f;
-    simint_osteifunc_array[1][1][0][4][4] = ostei_deriv1_p_s_g_g;
-    simint_osteifunc_array[1][1][1][0][4] = ostei_deriv1_p_p_s_g;
-    simint_osteifunc_array[1][1][1][1][4] = ostei_deriv1_p_p_p_g;
-    simint_osteifunc_array[1][1][1][2][4] = ostei_deriv1_p_p_d_g;
-    simint_osteifunc_array[1][1][1][3][4] = ostei_deriv1_p_p_f_g;
-    simint_osteifunc_array[1][1][1][4][0] = ostei_deriv1_p_p_g_s;
-    simint_osteifunc_array[1][1][1][4][1] = ostei_deriv1_p_p_g_p;
-    simint_osteifunc_array[1][1][1][4][2] = ostei_deriv1_p_p_g_d;
-    simint_osteifunc_array[1][1][1][4][3] = ostei_deriv1_p_p_g_f;
-    simint_osteifunc_array[1][1][1][4][4] = ostei_deriv1_p_p_g_g;
-    simint_osteifunc_array[1][1][2][0][4] = ostei_deriv1_p_d_s_g;
-    simint_osteifunc_array[1][1][2][1][4] = ostei_deriv1_p_d_p_g;
-    simint_osteifunc_array[1][1][2][2][4] = ostei_deriv1_p_d_d_g;
-    simint_osteifunc_array[1][1][2][3][4] = ostei_deriv1_p_d_f_g;
-    simint_osteifunc_array[1][1][2][4][0] = ostei_deriv1_p_d_g_s;
-    simint_osteifunc_array[1][1][2][4][1] = ostei_deriv1_p_d_g_p;
-    simint_osteifunc_array[1][1][2][4][2] = ostei_deriv1_p_d_g_d;
-    simint_osteifunc_array[1][1][2][4][3] = ostei_deriv1_p_d_g_f;
-    simint_osteifunc_array[1][1][2][4][4] = ostei_deriv1_p_d_g_g;
-    simint_osteifunc_array[1][1][3][0][4] = ostei_deriv1_p_f_s_g;
-    simint_osteifunc_array[1][1][3][1][4] = ostei_deriv1_p_f_p_g;
-    simint_osteifunc_array[1][1][3][2][4] = ostei_deriv1_p_f_d_g;
-    simint_osteifunc_array[1][1][3][3][4] = ostei_deriv1_p_f_f_g;
-    simint_osteifunc_array[1][1][3][4][0] = ostei_deriv1_p_f_g_s;
-    simint_osteifunc_array[1][1][3][4][1] = ostei_deriv1_p_f_g_p;
-    simint_osteifunc_array[1][1][3][4][2] = ostei_deriv1_p_f_g_d;
-    simint_osteifunc_array[1][1][3][4][3] = ostei_deriv1_p_f_g_f;
-    simint_osteifunc_array[1][1][3][4][4] = ostei_deriv1_p_f_g_g;
-    simint_osteifunc_array[1][1][4][0][0] = ostei_deriv1_p_g_s_s;
-    simint_osteifunc_array[1][1][4][0][1] = ostei_deriv1_p_g_s_p;
-    simint_osteifunc_array[1][1][4][0][2] = ostei_deriv1_p_g_s_d;
-    simint_osteifunc_array[1][1][4][0][3] = ostei_deriv1_p_g_s_f;
-    simint_osteifunc_array[1][1][4][0][4] = ostei_deriv1_p_g_s_g;
-    simint_osteifunc_array[1][1][4][1][0] = ostei_deriv1_p_g_p_s;
-    simint_osteifunc_array[1][1][4][1][1] = ostei_deriv1_p_g_p_p;
-    simint_osteifunc_array[1][1][4][1][2] = ostei_deriv1_p_g_p_d;
-    simint_osteifunc_array[1][1][4][1][3] = ostei_deriv1_p_g_p_f;
-    simint_osteifunc_array[1][1][4][1][4] = ostei_deriv1_p_g_p_g;
-    simint_osteifunc_array[1][1][4][2][0] = ostei_deriv1_p_g_d_s;
-    simint_osteifunc_array[1][1][4][2][1] = ostei_deriv1_p_g_d_p;
-    simint_osteifunc_array[1][1][4][2][2] = ostei_deriv1_p_g_d_d;
-    simint_osteifunc_array[1][1][4][2][3] = ostei_deriv1_p_g_d_f;
-    simint_osteifunc_array[1][1][4][2][4] = ostei_deriv1_p_g_d_g;
-    simint_osteifunc_array[1][1][4][3][0] = ostei_deriv1_p_g_f_s;
-    simint_osteifunc_array[1][1][4][3][1] = ostei_deriv1_p_g_f_p;
-    simint_osteifunc_array[1][1][4][3][2] = ostei_deriv1_p_g_f_d;
-    simint_osteifunc_array[1][1][4][3][3] = ostei_deriv1_p_g_f_f;
-    simint_osteifunc_array[1][1][4][3][4] = ostei_deriv1_p_g_f_g;
-    simint_osteifunc_array[1][1][4][4][0] = ostei_deriv1_p_g_g_s;
-    simint_osteifunc_array[1][1][4][4][1] = ostei_deriv1_p_g_g_p;
-    simint_osteifunc_array[1][1][4][4][2] = ostei_deriv1_p_g_g_d;
-    simint_osteifunc_array[1][1][4][4][3] = ostei_deriv1_p_g_g_f;
-    simint_osteifunc_array[1][1][4][4][4] = ostei_deriv1_p_g_g_g;
-    simint_osteifunc_array[1][2][0][0][4] = ostei_deriv1_d_s_s_g;
-    simint_osteifunc_array[1][2][0][1][4] = ostei_deriv1_d_s_p_g;
-    simint_osteifunc_array[1][2][0][2][4] = ostei_deriv1_d_s_d_g;
-    simint_osteifunc_array[1][2][0][3][4] = ostei_deriv1_d_s_f_g;
-    simint_osteifunc_array[1][2][0][4][0] = ostei_deriv1_d_s_g_s;
-    simint_osteifunc_array[1][2][0][4][1] = ostei_deriv1_d_s_g_p;
-    simint_osteifunc_array[1][2][0][4][2] = ostei_deriv1_d_s_g_d;
-    simint_osteifunc_array[1][2][0][4][3] = ostei_deriv1_d_s_g_f;
-    simint_osteifunc_array[1][2][0][4][4] = ostei_deriv1_d_s_g_g;
-    simint_osteifunc_array[1][2][1][0][4] = ostei_deriv1_d_p_s_g;
-    simint_osteifunc_array[1][2][1][1][4] = ostei_deriv1_d_p_p_g;
-    simint_osteifunc_array[1][2][1][2][4] = ostei_deriv1_d_p_d_g;
-    simint_osteifunc_array[1][2][1][3][4] = ostei_deriv1_d_p_f_g;
-    simint_osteifunc_array[1][2][1][4][0] = ostei_deriv1_d_p_g_s;
-    simint_osteifunc_array[1][2][1][4][1] = ostei_deriv1_d_p_g_p;
-    simint_osteifunc_array[1][2][1][4][2] = ostei_deriv1_d_p_g_d;
-    simint_osteifunc_array[1][2][1][4][3] = ostei_deriv1_d_p_g_f;
-    simint_osteifunc_array[1][2][1][4][4] = ostei_deriv1_d_p_g_g;
-    simint_osteifunc_array[1][2][2][0][4] = ostei_deriv1_d_d_s_g;
-    simint_osteifunc_array[1][2][2][1][4] = ostei_deriv1_d_d_p_g;
-    simint_osteifunc_array[1][2][2][2][4] = ostei_deriv1_d_d_d_g;
-    simint_osteifunc_array[1][2][2][3][4] = ostei_deriv1_d_d_f_g;
-    simint_osteifunc_array[1][2][2][4][0] = ostei_deriv1_d_d_g_s;
-    simint_osteifunc_array[1][2][2][4][1] = ostei_deriv1_d_d_g_p;
-    simint_osteifunc_array[1][2][2][4][2] = ostei_deriv1_d_d_g_d;
-    simint_osteifunc_array[1][2][2][4][3] = ostei_deriv1_d_d_g_f;
-    simint_osteifunc_array[1][2][2][4][4] = ostei_deriv1_d_d_g_g;
-    simint_osteifunc_array[1][2][3][0][4] = ostei_deriv1_d_f_s_g;
-    simint_osteifunc_array[1][2][3][1][4] = ostei_deriv1_d_f_p_g;
-    simint_osteifunc_array[1][2][3][2][4] = ostei_deriv1_d_f_d_g;
-    simint_osteifunc_array[1][2][3][3][4] = ostei_deriv1_d_f_f_g;
-    simint_osteifunc_array[1][2][3][4][0] = ostei_deriv1_d_f_g_s;
-    simint_osteifunc_array[1][2][3][4][1] = ostei_deriv1_d_f_g_p;
-    simint_osteifunc_array[1][2][3][4][2] = ostei_deriv1_d_f_g_d;
-    simint_osteifunc_array[1][2][3][4][3] = ostei_deriv1_d_f_g_f;
-    simint_osteifunc_array[1][2][3][4][4] = ostei_deriv1_d_f_g_g;
-    simint_osteifunc_array[1][2][4][0][0] = ostei_deriv1_d_g_s_s;
-    simint_osteifunc_array[1][2][4][0][1] = ostei_deriv1_d_g_s_p;
-    simint_osteifunc_array[1][2][4][0][2] = ostei_deriv1_d_g_s_d;
-    simint_osteifunc_array[1][2][4][0][3] = ostei_deriv1_d_g_s_f;
-    simint_osteifunc_array[1][2][4][0][4] = ostei_deriv1_d_g_s_g;
-    simint_osteifunc_array[1][2][4][1][0] = ostei_deriv1_d_g_p_s;
-    simint_osteifunc_array[1][2][4][1][1] = ostei_deriv1_d_g_p_p;
-    simint_osteifunc_array[1][2][4][1][2] = ostei_deriv1_d_g_p_d;
-    simint_osteifunc_array[1][2][4][1][3] = ostei_deriv1_d_g_p_f;
-    simint_osteifunc_array[1][2][4][1][4] = ostei_deriv1_d_g_p_g;
-    simint_osteifunc_array[1][2][4][2][0] = ostei_deriv1_d_g_d_s;
-    simint_osteifunc_array[1][2][4][2][1] = ostei_deriv1_d_g_d_p;
-    simint_osteifunc_array[1][2][4][2][2] = ostei_deriv1_d_g_d_d;
-    simint_osteifunc_array[1][2][4][2][3] = ostei_deriv1_d_g_d_f;
-    simint_osteifunc_array[1][2][4][2][4] = ostei_deriv1_d_g_d_g;
-    simint_osteifunc_array[1][2][4][3][0] = ostei_deriv1_d_g_f_s;
-    simint_osteifunc_array[1][2][4][3][1] = ostei_deriv1_d_g_f_p;
-    simint_osteifunc_array[1][2][4][3][2] = ostei_deriv1_d_g_f_d;
-    simint_osteifunc_array[1][2][4][3][3] = ostei_deriv1_d_g_f_f;
-    simint_osteifunc_array[1][2][4][3][4] = ostei_deriv1_d_g_f_g;
-    simint_osteifunc_array[1][2][4][4][0] = ostei_deriv1_d_g_g_s;
-    simint_osteifunc_array[1][2][4][4][1] = ostei_deriv1_d_g_g_p;
-    simint_osteifunc_array[1][2][4][4][2] = ostei_deriv1_d_g_g_d;
-    simint_osteifunc_array[1][2][4][4][3] = ostei_deriv1_d_g_g_f;
-    simint_osteifunc_array[1][2][4][4][4] = ostei_deriv1_d_g_g_g;
-    simint_osteifunc_array[1][3][0][0][4] = ostei_deriv1_f_s_s_g;
-    simint_osteifunc_array[1][3][0][1][4] = ostei_deriv1_f_s_p_g;
-    simint_osteifunc_array[1][3][0][2][4] = ostei_deriv1_f_s_d_g;
-    simint_osteifunc_array[1][3][0][3][4] = ostei_deriv1_f_s_f_g;
-    simint_osteifunc_array[1][3][0][4][0] = ostei_deriv1_f_s_g_s;
-    simint_osteifunc_array[1][3][0][4][1] = ostei_deriv1_f_s_g_p;
-    simint_osteifunc_array[1][3][0][4][2] = ostei_deriv1_f_s_g_d;
-    simint_osteifunc_array[1][3][0][4][3] = ostei_deriv1_f_s_g_f;
-    simint_osteifunc_array[1][3][0][4][4] = ostei_deriv1_f_s_g_g;
-    simint_osteifunc_array[1][3][1][0][4] = ostei_deriv1_f_p_s_g;
-    simint_osteifunc_array[1][3][1][1][4] = ostei_deriv1_f_p_p_g;
-    simint_osteifunc_array[1][3][1][2][4] = ostei_deriv1_f_p_d_g;
-    simint_osteifunc_array[1][3][1][3][4] = ostei_deriv1_f_p_f_g;
-    simint_osteifunc_array[1][3][1][4][0] = ostei_deriv1_f_p_g_s;
-    simint_osteifunc_array[1][3][1][4][1] = ostei_deriv1_f_p_g_p;
-    simint_osteifunc_array[1][3][1][4][2] = ostei_deriv1_f_p_g_d;
-    simint_osteifunc_array[1][3][1][4][3] = ostei_deriv1_f_p_g_f;
-    simint_osteifunc_array[1][3][1][4][4] = ostei_deriv1_f_p_g_g;
-    simint_osteifunc_array[1][3][2][0][4] = ostei_deriv1_f_d_s_g;
-    simint_osteifunc_array[1][3][2][1][4] = ostei_deriv1_f_d_p_g;
-    simint_osteifunc_array[1][3][2][2][4] = ostei_deriv1_f_d_d_g;
-    simint_osteifunc_array[1][3][2][3][4] = ostei_deriv1_f_d_f_g;
-    simint_osteifunc_array[1][3][2][4][0] = ostei_deriv1_f_d_g_s;
-    simint_osteifunc_array[1][3][2][4][1] = ostei_deriv1_f_d_g_p;
-    simint_osteifunc_array[1][3][2][4][2] = ostei_deriv1_f_d_g_d;
-    simint_osteifunc_array[1][3][2][4][3] = ostei_deriv1_f_d_g_f;
-    simint_osteifunc_array[1][3][2][4][4] = ostei_deriv1_f_d_g_g;
-    simint_osteifunc_array[1][3][3][0][4] = ostei_deriv1_f_f_s_g;
-    simint_osteifunc_array[1][3][3][1][4] = ostei_deriv1_f_f_p_g;
-    simint_osteifunc_array[1][3][3][2][4] = ostei_deriv1_f_f_d_g;
-    simint_osteifunc_array[1][3][3][3][4] = ostei_deriv1_f_f_f_g;
-    simint_osteifunc_array[1][3][3][4][0] = ostei_deriv1_f_f_g_s;
-    simint_osteifunc_array[1][3][3][4][1] = ostei_deriv1_f_f_g_p;
-    simint_osteifunc_array[1][3][3][4][2] = ostei_deriv1_f_f_g_d;
-    simint_osteifunc_array[1][3][3][4][3] = ostei_deriv1_f_f_g_f;
-    simint_osteifunc_array[1][3][3][4][4] = ostei_deriv1_f_f_g_g;
-    simint_osteifunc_array[1][3][4][0][0] = ostei_deriv1_f_g_s_s;
-    simint_osteifunc_array[1][3][4][0][1] = ostei_deriv1_f_g_s_p;
-    simint_osteifunc_array[1][3][4][0][2] = ostei_deriv1_f_g_s_d;
-    simint_osteifunc_array[1][3][4][0][3] = ostei_deriv1_f_g_s_f;
-    simint_osteifunc_array[1][3][4][0][4] = ostei_deriv1_f_g_s_g;
-    simint_osteifunc_array[1][3][4][1][0] = ostei_deriv1_f_g_p_s;
-    simint_osteifunc_array[1][3][4][1][1] = ostei_deriv1_f_g_p_p;
-    simint_osteifunc_array[1][3][4][1][2] = ostei_deriv1_f_g_p_d;
-    simint_osteifunc_array[1][3][4][1][3] = ostei_deriv1_f_g_p_f;
-    simint_osteifunc_array[1][3][4][1][4] = ostei_deriv1_f_g_p_g;
-    simint_osteifunc_array[1][3][4][2][0] = ostei_deriv1_f_g_d_s;
-    simint_osteifunc_array[1][3][4][2][1] = ostei_deriv1_f_g_d_p;
-    simint_osteifunc_array[1][3][4][2][2] = ostei_deriv1_f_g_d_d;
-    simint_osteifunc_array[1][3][4][2][3] = ostei_deriv1_f_g_d_f;
-    simint_osteifunc_array[1][3][4][2][4] = ostei_deriv1_f_g_d_g;
-    simint_osteifunc_array[1][3][4][3][0] = ostei_deriv1_f_g_f_s;
-    simint_osteifunc_array[1][3][4][3][1] = ostei_deriv1_f_g_f_p;
-    simint_osteifunc_array[1][3][4][3][2] = ostei_deriv1_f_g_f_d;
-    simint_osteifunc_array[1][3][4][3][3] = ostei_deriv1_f_g_f_f;
-    simint_osteifunc_array[1][3][4][3][4] = ostei_deriv1_f_g_f_g;
-    simint_osteifunc_array[1][3][4][4][0] = ostei_deriv1_f_g_g_s;
-    simint_osteifunc_array[1][3][4][4][1] = ostei_deriv1_f_g_g_p;
-    simint_osteifunc_array[1][3][4][4][2] = ostei_deriv1_f_g_g_d;
-    simint_osteifunc_array[1][3][4][4][3] = ostei_deriv1_f_g_g_f;
-    simint_osteifunc_array[1][3][4][4][4] = ostei_deriv1_f_g_g_g;
-    simint_osteifunc_array[1][4][0][0][0] = ostei_deriv1_g_s_s_s;
-    simint_osteifunc_array[1][4][0][0][1] = ostei_deriv1_g_s_s_p;
-    simint_osteifunc_array[1][4][0][0][2] = ostei_deriv1_g_s_s_d;
-    simint_osteifunc_array[1][4][0][0][3] = ostei_deriv1_g_s_s_f;
-    simint_osteifunc_array[1][4][0][0][4] = ostei_deriv1_g_s_s_g;
-    simint_osteifunc_array[1][4][0][1][0] = ostei_deriv1_g_s_p_s;
-    simint_osteifunc_array[1][4][0][1][1] = ostei_deriv1_g_s_p_p;
-    simint_osteifunc_array[1][4][0][1][2] = ostei_deriv1_g_s_p_d;
-    simint_osteifunc_array[1][4][0][1][3] = ostei_deriv1_g_s_p_f;
-    simint_osteifunc_array[1][4][0][1][4] = ostei_deriv1_g_s_p_g;
-    simint_osteifunc_array[1][4][0][2][0] = ostei_deriv1_g_s_d_s;
-    simint_osteifunc_array[1][4][0][2][1] = ostei_deriv1_g_s_d_p;
-    simint_osteifunc_array[1][4][0][2][2] = ostei_deriv1_g_s_d_d;
-    simint_osteifunc_array[1][4][0][2][3] = ostei_deriv1_g_s_d_f;
-    simint_osteifunc_array[1][4][0][2][4] = ostei_deriv1_g_s_d_g;
-    simint_osteifunc_array[1][4][0][3][0] = ostei_deriv1_g_s_f_s;
-    simint_osteifunc_array[1][4][0][3][1] = ostei_deriv1_g_s_f_p;
-    simint_osteifunc_array[1][4][0][3][2] = ostei_deriv1_g_s_f_d;
-    simint_osteifunc_array[1][4][0][3][3] = ostei_deriv1_g_s_f_f;
-    simint_osteifunc_array[1][4][0][3][4] = ostei_deriv1_g_s_f_g;
-    simint_osteifunc_array[1][4][0][4][0] = ostei_deriv1_g_s_g_s;
-    simint_osteifunc_array[1][4][0][4][1] = ostei_deriv1_g_s_g_p;
-    simint_osteifunc_array[1][4][0][4][2] = ostei_deriv1_g_s_g_d;
-    simint_osteifunc_array[1][4][0][4][3] = ostei_deriv1_g_s_g_f;
-    simint_osteifunc_array[1][4][0][4][4] = ostei_deriv1_g_s_g_g;
-    simint_osteifunc_array[1][4][1][0][0] = ostei_deriv1_g_p_s_s;
-    simint_osteifunc_array[1][4][1][0][1] = ostei_deriv1_g_p_s_p;
-    simint_osteifunc_array[1][4][1][0][2] = ostei_deriv1_g_p_s_d;
-    simint_osteifunc_array[1][4][1][0][3] = ostei_deriv1_g_p_s_f;
-    simint_osteifunc_array[1][4][1][0][4] = ostei_deriv1_g_p_s_g;
-    simint_osteifunc_array[1][4][1][1][0] = ostei_deriv1_g_p_p_s;
-    simint_osteifunc_array[1][4][1][1][1] = ostei_deriv1_g_p_p_p;
-    simint_osteifunc_array[1][4][1][1][2] = ostei_deriv1_g_p_p_d;
-    simint_osteifunc_array[1][4][1][1][3] = ostei_deriv1_g_p_p_f;
-    simint_osteifunc_array[1][4][1][1][4] = ostei_deriv1_g_p_p_g;
-    simint_osteifunc_array[1][4][1][2][0] = ostei_deriv1_g_p_d_s;
-    simint_osteifunc_array[1][4][1][2][1] = ostei_deriv1_g_p_d_p;
-    simint_osteifunc_array[1][4][1][2][2] = ostei_deriv1_g_p_d_d;
-    simint_osteifunc_array[1][4][1][2][3] = ostei_deriv1_g_p_d_f;
-    simint_osteifunc_array[1][4][1][2][4] = ostei_deriv1_g_p_d_g;
-    simint_osteifunc_array[1][4][1][3][0] = ostei_deriv1_g_p_f_s;
-    simint_osteifunc_array[1][4][1][3][1] = ostei_deriv1_g_p_f_p;
-    simint_osteifunc_array[1][4][1][3][2] = ostei_deriv1_g_p_f_d;
-    simint_osteifunc_array[1][4][1][3][3] = ostei_deriv1_g_p_f_f;
-    simint_osteifunc_array[1][4][1][3][4] = ostei_deriv1_g_p_f_g;
-    simint_osteifunc_array[1][4][1][4][0] = ostei_deriv1_g_p_g_s;
-    simint_osteifunc_array[1][4][1][4][1] = ostei_deriv1_g_p_g_p;
-    simint_osteifunc_array[1][4][1][4][2] = ostei_deriv1_g_p_g_d;
-    simint_osteifunc_array[1][4][1][4][3] = ostei_deriv1_g_p_g_f;
-    simint_osteifunc_array[1][4][1][4][4] = ostei_deriv1_g_p_g_g;
-    simint_osteifunc_array[1][4][2][0][0] = ostei_deriv1_g_d_s_s;
-    simint_osteifunc_array[1][4][2][0][1] = ostei_deriv1_g_d_s_p;
-    simint_osteifunc_array[1][4][2][0][2] = ostei_deriv1_g_d_s_d;
-    simint_osteifunc_array[1][4][2][0][3] = ostei_deriv1_g_d_s_f;
-    simint_osteifunc_array[1][4][2][0][4] = ostei_deriv1_g_d_s_g;
-    simint_osteifunc_array[1][4][2][1][0] = ostei_deriv1_g_d_p_s;
-    simint_osteifunc_array[1][4][2][1][1] = ostei_deriv1_g_d_p_p;
-    simint_osteifunc_array[1][4][2][1][2] = ostei_deriv1_g_d_p_d;
-    simint_osteifunc_array[1][4][2][1][3] = ostei_deriv1_g_d_p_f;
-    simint_osteifunc_array[1][4][2][1][4] = ostei_deriv1_g_d_p_g;
-    simint_osteifunc_array[1][4][2][2][0] = ostei_deriv1_g_d_d_s;
-    simint_osteifunc_array[1][4][2][2][1] = ostei_deriv1_g_d_d_p;
-    simint_osteifunc_array[1][4][2][2][2] = ostei_deriv1_g_d_d_d;
-    simint_osteifunc_array[1][4][2][2][3] = ostei_deriv1_g_d_d_f;
-    simint_osteifunc_array[1][4][2][2][4] = ostei_deriv1_g_d_d_g;
-    simint_osteifunc_array[1][4][2][3][0] = ostei_deriv1_g_d_f_s;
-    simint_osteifunc_array[1][4][2][3][1] = ostei_deriv1_g_d_f_p;
-    simint_osteifunc_array[1][4][2][3][2] = ostei_deriv1_g_d_f_d;
-    simint_osteifunc_array[1][4][2][3][3] = ostei_deriv1_g_d_f_f;
-    simint_osteifunc_array[1][4][2][3][4] = ostei_deriv1_g_d_f_g;
-    simint_osteifunc_array[1][4][2][4][0] = ostei_deriv1_g_d_g_s;
-    simint_osteifunc_array[1][4][2][4][1] = ostei_deriv1_g_d_g_p;
-    simint_osteifunc_array[1][4][2][4][2] = ostei_deriv1_g_d_g_d;
-    simint_osteifunc_array[1][4][2][4][3] = ostei_deriv1_g_d_g_f;
-    simint_osteifunc_array[1][4][2][4][4] = ostei_deriv1_g_d_g_g;
-    simint_osteifunc_array[1][4][3][0][0] = ostei_deriv1_g_f_s_s;
-    simint_osteifunc_array[1][4][3][0][1] = ostei_deriv1_g_f_s_p;
-    simint_osteifunc_array[1][4][3][0][2] = ostei_deriv1_g_f_s_d;
-    simint_osteifunc_array[1][4][3][0][3] = ostei_deriv1_g_f_s_f;
-    simint_osteifunc_array[1][4][3][0][4] = ostei_deriv1_g_f_s_g;
-    simint_osteifunc_array[1][4][3][1][0] = ostei_deriv1_g_f_p_s;
-    simint_osteifunc_array[1][4][3][1][1] = ostei_deriv1_g_f_p_p;
-    simint_osteifunc_array[1][4][3][1][2] = ostei_deriv1_g_f_p_d;
-    simint_osteifunc_array[1][4][3][1][3] = ostei_deriv1_g_f_p_f;
-    simint_osteifunc_array[1][4][3][1][4] = ostei_deriv1_g_f_p_g;
-    simint_osteifunc_array[1][4][3][2][0] = ostei_deriv1_g_f_d_s;
-    simint_osteifunc_array[1][4][3][2][1] = ostei_deriv1_g_f_d_p;
-    simint_osteifunc_array[1][4][3][2][2] = ostei_deriv1_g_f_d_d;
-    simint_osteifunc_array[1][4][3][2][3] = ostei_deriv1_g_f_d_f;
-    simint_osteifunc_array[1][4][3][2][4] = ostei_deriv1_g_f_d_g;
-    simint_osteifunc_array[1][4][3][3][0] = ostei_deriv1_g_f_f_s;
-    simint_osteifunc_array[1][4][3][3][1] = ostei_deriv1_g_f_f_p;
-    simint_osteifunc_array[1][4][3][3][2] = ostei_deriv1_g_f_f_d;
-    simint_osteifunc_array[1][4][3][3][3] = ostei_deriv1_g_f_f_f;
-    simint_osteifunc_array[1][4][3][3][4] = ostei_deriv1_g_f_f_g;
-    simint_osteifunc_array[1][4][3][4][0] = ostei_deriv1_g_f_g_s;
-    simint_osteifunc_array[1][4][3][4][1] = ostei_deriv1_g_f_g_p;
-    simint_osteifunc_array[1][4][3][4][2] = ostei_deriv1_g_f_g_d;
-    simint_osteifunc_array[1][4][3][4][3] = ostei_deriv1_g_f_g_f;
-    simint_osteifunc_array[1][4][3][4][4] = ostei_deriv1_g_f_g_g;
-    simint_osteifunc_array[1][4][4][0][0] = ostei_deriv1_g_g_s_s;
-    simint_osteifunc_array[1][4][4][0][1] = ostei_deriv1_g_g_s_p;
-    simint_osteifunc_array[1][4][4][0][2] = ostei_deriv1_g_g_s_d;
-    simint_osteifunc_array[1][4][4][0][3] = ostei_deriv1_g_g_s_f;
-    simint_osteifunc_array[1][4][4][0][4] = ostei_deriv1_g_g_s_g;
-    simint_osteifunc_array[1][4][4][1][0] = ostei_deriv1_g_g_p_s;
-    simint_osteifunc_array[1][4][4][1][1] = ostei_deriv1_g_g_p_p;
-    simint_osteifunc_array[1][4][4][1][2] = ostei_deriv1_g_g_p_d;
-    simint_osteifunc_array[1][4][4][1][3] = ostei_deriv1_g_g_p_f;
-    simint_osteifunc_array[1][4][4][1][4] = ostei_deriv1_g_g_p_g;
-    simint_osteifunc_array[1][4][4][2][0] = ostei_deriv1_g_g_d_s;
-    simint_osteifunc_array[1][4][4][2][1] = ostei_deriv1_g_g_d_p;
-    simint_osteifunc_array[1][4][4][2][2] = ostei_deriv1_g_g_d_d;
-    simint_osteifunc_array[1][4][4][2][3] = ostei_deriv1_g_g_d_f;
-    simint_osteifunc_array[1][4][4][2][4] = ostei_deriv1_g_g_d_g;
-    simint_osteifunc_array[1][4][4][3][0] = ostei_deriv1_g_g_f_s;
-    simint_osteifunc_array[1][4][4][3][1] = ostei_deriv1_g_g_f_p;
-    simint_osteifunc_array[1][4][4][3][2] = ostei_deriv1_g_g_f_d;
-    simint_osteifunc_array[1][4][4][3][3] = ostei_deriv1_g_g_f_f;
-    simint_osteifunc_array[1][4][4][3][4] = ostei_deriv1_g_g_f_g;
-    simint_osteifunc_array[1][4][4][4][0] = ostei_deriv1_g_g_g_s;
-    simint_osteifunc_array[1][4][4][4][1] = ostei_deriv1_g_g_g_p;
-    simint_osteifunc_array[1][4][4][4][2] = ostei_deriv1_g_g_g_d;
-    simint_osteifunc_array[1][4][4][4][3] = ostei_deriv1_g_g_g_f;
-    simint_osteifunc_array[1][4][4][4][4] = ostei_deriv1_g_g_g_g;
+    simint_osteifunc_array[1][0][0][0][4] = ostei_deriv1_s_s_s_g_ptr;
+    simint_osteifunc_array[1][0][0][1][4] = ostei_deriv1_s_s_p_g_ptr;
+    simint_osteifunc_array[1][0][0][2][4] = ostei_deriv1_s_s_d_g_ptr;
+    simint_osteifunc_array[1][0][0][3][4] = ostei_deriv1_s_s_f_g_ptr;
+    simint_osteifunc_array[1][0][0][4][0] = ostei_deriv1_s_s_g_s_ptr;
+    simint_osteifunc_array[1][0][0][4][1] = ostei_deriv1_s_s_g_p_ptr;
+    simint_osteifunc_array[1][0][0][4][2] = ostei_deriv1_s_s_g_d_ptr;
+    simint_osteifunc_array[1][0][0][4][3] = ostei_deriv1_s_s_g_f_ptr;
+    simint_osteifunc_array[1][0][0][4][4] = ostei_deriv1_s_s_g_g_ptr;
+    simint_osteifunc_array[1][0][1][0][4] = ostei_deriv1_s_p_s_g_ptr;
+    simint_osteifunc_array[1][0][1][1][4] = ostei_deriv1_s_p_p_g_ptr;
+    simint_osteifunc_array[1][0][1][2][4] = ostei_deriv1_s_p_d_g_ptr;
+    simint_osteifunc_array[1][0][1][3][4] = ostei_deriv1_s_p_f_g_ptr;
+    simint_osteifunc_array[1][0][1][4][0] = ostei_deriv1_s_p_g_s_ptr;
+    simint_osteifunc_array[1][0][1][4][1] = ostei_deriv1_s_p_g_p_ptr;
+    simint_osteifunc_array[1][0][1][4][2] = ostei_deriv1_s_p_g_d_ptr;
+    simint_osteifunc_array[1][0][1][4][3] = ostei_deriv1_s_p_g_f_ptr;
+    simint_osteifunc_array[1][0][1][4][4] = ostei_deriv1_s_p_g_g_ptr;
+    simint_osteifunc_array[1][0][2][0][4] = ostei_deriv1_s_d_s_g_ptr;
+    simint_osteifunc_array[1][0][2][1][4] = ostei_deriv1_s_d_p_g_ptr;
+    simint_osteifunc_array[1][0][2][2][4] = ostei_deriv1_s_d_d_g_ptr;
+    simint_osteifunc_array[1][0][2][3][4] = ostei_deriv1_s_d_f_g_ptr;
+    simint_osteifunc_array[1][0][2][4][0] = ostei_deriv1_s_d_g_s_ptr;
+    simint_osteifunc_array[1][0][2][4][1] = ostei_deriv1_s_d_g_p_ptr;
+    simint_osteifunc_array[1][0][2][4][2] = ostei_deriv1_s_d_g_d_ptr;
+    simint_osteifunc_array[1][0][2][4][3] = ostei_deriv1_s_d_g_f_ptr;
+    simint_osteifunc_array[1][0][2][4][4] = ostei_deriv1_s_d_g_g_ptr;
+    simint_osteifunc_array[1][0][3][0][4] = ostei_deriv1_s_f_s_g_ptr;
+    simint_osteifunc_array[1][0][3][1][4] = ostei_deriv1_s_f_p_g_ptr;
+    simint_osteifunc_array[1][0][3][2][4] = ostei_deriv1_s_f_d_g_ptr;
+    simint_osteifunc_array[1][0][3][3][4] = ostei_deriv1_s_f_f_g_ptr;
+    simint_osteifunc_array[1][0][3][4][0] = ostei_deriv1_s_f_g_s_ptr;
+    simint_osteifunc_array[1][0][3][4][1] = ostei_deriv1_s_f_g_p_ptr;
+    simint_osteifunc_array[1][0][3][4][2] = ostei_deriv1_s_f_g_d_ptr;
+    simint_osteifunc_array[1][0][3][4][3] = ostei_deriv1_s_f_g_f_ptr;
+    simint_osteifunc_array[1][0][3][4][4] = ostei_deriv1_s_f_g_g_ptr;
+    simint_osteifunc_array[1][0][4][0][0] = ostei_deriv1_s_g_s_s_ptr;
+    simint_osteifunc_array[1][0][4][0][1] = ostei_deriv1_s_g_s_p_ptr;
+    simint_osteifunc_array[1][0][4][0][2] = ostei_deriv1_s_g_s_d_ptr;
+    simint_osteifunc_array[1][0][4][0][3] = ostei_deriv1_s_g_s_f_ptr;
+    simint_osteifunc_array[1][0][4][0][4] = ostei_deriv1_s_g_s_g_ptr;
+    simint_osteifunc_array[1][0][4][1][0] = ostei_deriv1_s_g_p_s_ptr;
+    simint_osteifunc_array[1][0][4][1][1] = ostei_deriv1_s_g_p_p_ptr;
+    simint_osteifunc_array[1][0][4][1][2] = ostei_deriv1_s_g_p_d_ptr;
+    simint_osteifunc_array[1][0][4][1][3] = ostei_deriv1_s_g_p_f_ptr;
+    simint_osteifunc_array[1][0][4][1][4] = ostei_deriv1_s_g_p_g_ptr;
+    simint_osteifunc_array[1][0][4][2][0] = ostei_deriv1_s_g_d_s_ptr;
+    simint_osteifunc_array[1][0][4][2][1] = ostei_deriv1_s_g_d_p_ptr;
+    simint_osteifunc_array[1][0][4][2][2] = ostei_deriv1_s_g_d_d_ptr;
+    simint_osteifunc_array[1][0][4][2][3] = ostei_deriv1_s_g_d_f_ptr;
+    simint_osteifunc_array[1][0][4][2][4] = ostei_deriv1_s_g_d_g_ptr;
+    simint_osteifunc_array[1][0][4][3][0] = ostei_deriv1_s_g_f_s_ptr;
+    simint_osteifunc_array[1][0][4][3][1] = ostei_deriv1_s_g_f_p_ptr;
+    simint_osteifunc_array[1][0][4][3][2] = ostei_deriv1_s_g_f_d_ptr;
+    simint_osteifunc_array[1][0][4][3][3] = ostei_deriv1_s_g_f_f_ptr;
+    simint_osteifunc_array[1][0][4][3][4] = ostei_deriv1_s_g_f_g_ptr;
+    simint_osteifunc_array[1][0][4][4][0] = ostei_deriv1_s_g_g_s_ptr;
+    simint_osteifunc_array[1][0][4][4][1] = ostei_deriv1_s_g_g_p_ptr;
+    simint_osteifunc_array[1][0][4][4][2] = ostei_deriv1_s_g_g_d_ptr;
+    simint_osteifunc_array[1][0][4][4][3] = ostei_deriv1_s_g_g_f_ptr;
+    simint_osteifunc_array[1][0][4][4][4] = ostei_deriv1_s_g_g_g_ptr;
+    simint_osteifunc_array[1][1][0][0][4] = ostei_deriv1_p_s_s_g_ptr;
+    simint_osteifunc_array[1][1][0][1][4] = ostei_deriv1_p_s_p_g_ptr;
+    simint_osteifunc_array[1][1][0][2][4] = ostei_deriv1_p_s_d_g_ptr;
+    simint_osteifunc_array[1][1][0][3][4] = ostei_deriv1_p_s_f_g_ptr;
+    simint_osteifunc_array[1][1][0][4][0] = ostei_deriv1_p_s_g_s_ptr;
+    simint_osteifunc_array[1][1][0][4][1] = ostei_deriv1_p_s_g_p_ptr;
+    simint_osteifunc_array[1][1][0][4][2] = ostei_deriv1_p_s_g_d_ptr;
+    simint_osteifunc_array[1][1][0][4][3] = ostei_deriv1_p_s_g_f_ptr;
+    simint_osteifunc_array[1][1][0][4][4] = ostei_deriv1_p_s_g_g_ptr;
+    simint_osteifunc_array[1][1][1][0][4] = ostei_deriv1_p_p_s_g_ptr;
+    simint_osteifunc_array[1][1][1][1][4] = ostei_deriv1_p_p_p_g_ptr;
+    simint_osteifunc_array[1][1][1][2][4] = ostei_deriv1_p_p_d_g_ptr;
+    simint_osteifunc_array[1][1][1][3][4] = ostei_deriv1_p_p_f_g_ptr;
+    simint_osteifunc_array[1][1][1][4][0] = ostei_deriv1_p_p_g_s_ptr;
+    simint_osteifunc_array[1][1][1][4][1] = ostei_deriv1_p_p_g_p_ptr;
+    simint_osteifunc_array[1][1][1][4][2] = ostei_deriv1_p_p_g_d_ptr;
+    simint_osteifunc_array[1][1][1][4][3] = ostei_deriv1_p_p_g_f_ptr;
+    simint_osteifunc_array[1][1][1][4][4] = ostei_deriv1_p_p_g_g_ptr;
+    simint_osteifunc_array[1][1][2][0][4] = ostei_deriv1_p_d_s_g_ptr;
+    simint_osteifunc_array[1][1][2][1][4] = ostei_deriv1_p_d_p_g_ptr;
+    simint_osteifunc_array[1][1][2][2][4] = ostei_deriv1_p_d_d_g_ptr;
+    simint_osteifunc_array[1][1][2][3][4] = ostei_deriv1_p_d_f_g_ptr;
+    simint_osteifunc_array[1][1][2][4][0] = ostei_deriv1_p_d_g_s_ptr;
+    simint_osteifunc_array[1][1][2][4][1] = ostei_deriv1_p_d_g_p_ptr;
+    simint_osteifunc_array[1][1][2][4][2] = ostei_deriv1_p_d_g_d_ptr;
+    simint_osteifunc_array[1][1][2][4][3] = ostei_deriv1_p_d_g_f_ptr;
+    simint_osteifunc_array[1][1][2][4][4] = ostei_deriv1_p_d_g_g_ptr;
+    simint_osteifunc_array[1][1][3][0][4] = ostei_deriv1_p_f_s_g_ptr;
+    simint_osteifunc_array[1][1][3][1][4] = ostei_deriv1_p_f_p_g_ptr;
+    simint_osteifunc_array[1][1][3][2][4] = ostei_deriv1_p_f_d_g_ptr;
+    simint_osteifunc_array[1][1][3][3][4] = ostei_deriv1_p_f_f_g_ptr;
+    simint_osteifunc_array[1][1][3][4][0] = ostei_deriv1_p_f_g_s_ptr;
+    simint_osteifunc_array[1][1][3][4][1] = ostei_deriv1_p_f_g_p_ptr;
+    simint_osteifunc_array[1][1][3][4][2] = ostei_deriv1_p_f_g_d_ptr;
+    simint_osteifunc_array[1][1][3][4][3] = ostei_deriv1_p_f_g_f_ptr;
+    simint_osteifunc_array[1][1][3][4][4] = ostei_deriv1_p_f_g_g_ptr;
+    simint_osteifunc_array[1][1][4][0][0] = ostei_deriv1_p_g_s_s_ptr;
+    simint_osteifunc_array[1][1][4][0][1] = ostei_deriv1_p_g_s_p_ptr;
+    simint_osteifunc_array[1][1][4][0][2] = ostei_deriv1_p_g_s_d_ptr;
+    simint_osteifunc_array[1][1][4][0][3] = ostei_deriv1_p_g_s_f_ptr;
+    simint_osteifunc_array[1][1][4][0][4] = ostei_deriv1_p_g_s_g_ptr;
+    simint_osteifunc_array[1][1][4][1][0] = ostei_deriv1_p_g_p_s_ptr;
+    simint_osteifunc_array[1][1][4][1][1] = ostei_deriv1_p_g_p_p_ptr;
+    simint_osteifunc_array[1][1][4][1][2] = ostei_deriv1_p_g_p_d_ptr;
+    simint_osteifunc_array[1][1][4][1][3] = ostei_deriv1_p_g_p_f_ptr;
+    simint_osteifunc_array[1][1][4][1][4] = ostei_deriv1_p_g_p_g_ptr;
+    simint_osteifunc_array[1][1][4][2][0] = ostei_deriv1_p_g_d_s_ptr;
+    simint_osteifunc_array[1][1][4][2][1] = ostei_deriv1_p_g_d_p_ptr;
+    simint_osteifunc_array[1][1][4][2][2] = ostei_deriv1_p_g_d_d_ptr;
+    simint_osteifunc_array[1][1][4][2][3] = ostei_deriv1_p_g_d_f_ptr;
+    simint_osteifunc_array[1][1][4][2][4] = ostei_deriv1_p_g_d_g_ptr;
+    simint_osteifunc_array[1][1][4][3][0] = ostei_deriv1_p_g_f_s_ptr;
+    simint_osteifunc_array[1][1][4][3][1] = ostei_deriv1_p_g_f_p_ptr;
+    simint_osteifunc_array[1][1][4][3][2] = ostei_deriv1_p_g_f_d_ptr;
+    simint_osteifunc_array[1][1][4][3][3] = ostei_deriv1_p_g_f_f_ptr;
+    simint_osteifunc_array[1][1][4][3][4] = ostei_deriv1_p_g_f_g_ptr;
+    simint_osteifunc_array[1][1][4][4][0] = ostei_deriv1_p_g_g_s_ptr;
+    simint_osteifunc_array[1][1][4][4][1] = ostei_deriv1_p_g_g_p_ptr;
+    simint_osteifunc_array[1][1][4][4][2] = ostei_deriv1_p_g_g_d_ptr;
+    simint_osteifunc_array[1][1][4][4][3] = ostei_deriv1_p_g_g_f_ptr;
+    simint_osteifunc_array[1][1][4][4][4] = ostei_deriv1_p_g_g_g_ptr;
+    simint_osteifunc_array[1][2][0][0][4] = ostei_deriv1_d_s_s_g_ptr;
+    simint_osteifunc_array[1][2][0][1][4] = ostei_deriv1_d_s_p_g_ptr;
+    simint_osteifunc_array[1][2][0][2][4] = ostei_deriv1_d_s_d_g_ptr;
+    simint_osteifunc_array[1][2][0][3][4] = ostei_deriv1_d_s_f_g_ptr;
+    simint_osteifunc_array[1][2][0][4][0] = ostei_deriv1_d_s_g_s_ptr;
+    simint_osteifunc_array[1][2][0][4][1] = ostei_deriv1_d_s_g_p_ptr;
+    simint_osteifunc_array[1][2][0][4][2] = ostei_deriv1_d_s_g_d_ptr;
+    simint_osteifunc_array[1][2][0][4][3] = ostei_deriv1_d_s_g_f_ptr;
+    simint_osteifunc_array[1][2][0][4][4] = ostei_deriv1_d_s_g_g_ptr;
+    simint_osteifunc_array[1][2][1][0][4] = ostei_deriv1_d_p_s_g_ptr;
+    simint_osteifunc_array[1][2][1][1][4] = ostei_deriv1_d_p_p_g_ptr;
+    simint_osteifunc_array[1][2][1][2][4] = ostei_deriv1_d_p_d_g_ptr;
+    simint_osteifunc_array[1][2][1][3][4] = ostei_deriv1_d_p_f_g_ptr;
+    simint_osteifunc_array[1][2][1][4][0] = ostei_deriv1_d_p_g_s_ptr;
+    simint_osteifunc_array[1][2][1][4][1] = ostei_deriv1_d_p_g_p_ptr;
+    simint_osteifunc_array[1][2][1][4][2] = ostei_deriv1_d_p_g_d_ptr;
+    simint_osteifunc_array[1][2][1][4][3] = ostei_deriv1_d_p_g_f_ptr;
+    simint_osteifunc_array[1][2][1][4][4] = ostei_deriv1_d_p_g_g_ptr;
+    simint_osteifunc_array[1][2][2][0][4] = ostei_deriv1_d_d_s_g_ptr;
+    simint_osteifunc_array[1][2][2][1][4] = ostei_deriv1_d_d_p_g_ptr;
+    simint_osteifunc_array[1][2][2][2][4] = ostei_deriv1_d_d_d_g_ptr;
+    simint_osteifunc_array[1][2][2][3][4] = ostei_deriv1_d_d_f_g_ptr;
+    simint_osteifunc_array[1][2][2][4][0] = ostei_deriv1_d_d_g_s_ptr;
+    simint_osteifunc_array[1][2][2][4][1] = ostei_deriv1_d_d_g_p_ptr;
+    simint_osteifunc_array[1][2][2][4][2] = ostei_deriv1_d_d_g_d_ptr;
+    simint_osteifunc_array[1][2][2][4][3] = ostei_deriv1_d_d_g_f_ptr;
+    simint_osteifunc_array[1][2][2][4][4] = ostei_deriv1_d_d_g_g_ptr;
+    simint_osteifunc_array[1][2][3][0][4] = ostei_deriv1_d_f_s_g_ptr;
+    simint_osteifunc_array[1][2][3][1][4] = ostei_deriv1_d_f_p_g_ptr;
+    simint_osteifunc_array[1][2][3][2][4] = ostei_deriv1_d_f_d_g_ptr;
+    simint_osteifunc_array[1][2][3][3][4] = ostei_deriv1_d_f_f_g_ptr;
+    simint_osteifunc_array[1][2][3][4][0] = ostei_deriv1_d_f_g_s_ptr;
+    simint_osteifunc_array[1][2][3][4][1] = ostei_deriv1_d_f_g_p_ptr;
+    simint_osteifunc_array[1][2][3][4][2] = ostei_deriv1_d_f_g_d_ptr;
+    simint_osteifunc_array[1][2][3][4][3] = ostei_deriv1_d_f_g_f_ptr;
+    simint_osteifunc_array[1][2][3][4][4] = ostei_deriv1_d_f_g_g_ptr;
+    simint_osteifunc_array[1][2][4][0][0] = ostei_deriv1_d_g_s_s_ptr;
+    simint_osteifunc_array[1][2][4][0][1] = ostei_deriv1_d_g_s_p_ptr;
+    simint_osteifunc_array[1][2][4][0][2] = ostei_deriv1_d_g_s_d_ptr;
+    simint_osteifunc_array[1][2][4][0][3] = ostei_deriv1_d_g_s_f_ptr;
+    simint_osteifunc_array[1][2][4][0][4] = ostei_deriv1_d_g_s_g_ptr;
+    simint_osteifunc_array[1][2][4][1][0] = ostei_deriv1_d_g_p_s_ptr;
+    simint_osteifunc_array[1][2][4][1][1] = ostei_deriv1_d_g_p_p_ptr;
+    simint_osteifunc_array[1][2][4][1][2] = ostei_deriv1_d_g_p_d_ptr;
+    simint_osteifunc_array[1][2][4][1][3] = ostei_deriv1_d_g_p_f_ptr;
+    simint_osteifunc_array[1][2][4][1][4] = ostei_deriv1_d_g_p_g_ptr;
+    simint_osteifunc_array[1][2][4][2][0] = ostei_deriv1_d_g_d_s_ptr;
+    simint_osteifunc_array[1][2][4][2][1] = ostei_deriv1_d_g_d_p_ptr;
+    simint_osteifunc_array[1][2][4][2][2] = ostei_deriv1_d_g_d_d_ptr;
+    simint_osteifunc_array[1][2][4][2][3] = ostei_deriv1_d_g_d_f_ptr;
+    simint_osteifunc_array[1][2][4][2][4] = ostei_deriv1_d_g_d_g_ptr;
+    simint_osteifunc_array[1][2][4][3][0] = ostei_deriv1_d_g_f_s_ptr;
+    simint_osteifunc_array[1][2][4][3][1] = ostei_deriv1_d_g_f_p_ptr;
+    simint_osteifunc_array[1][2][4][3][2] = ostei_deriv1_d_g_f_d_ptr;
+    simint_osteifunc_array[1][2][4][3][3] = ostei_deriv1_d_g_f_f_ptr;
+    simint_osteifunc_array[1][2][4][3][4] = ostei_deriv1_d_g_f_g_ptr;
+    simint_osteifunc_array[1][2][4][4][0] = ostei_deriv1_d_g_g_s_ptr;
+    simint_osteifunc_array[1][2][4][4][1] = ostei_deriv1_d_g_g_p_ptr;
+    simint_osteifunc_array[1][2][4][4][2] = ostei_deriv1_d_g_g_d_ptr;
+    simint_osteifunc_array[1][2][4][4][3] = ostei_deriv1_d_g_g_f_ptr;
+    simint_osteifunc_array[1][2][4][4][4] = ostei_deriv1_d_g_g_g_ptr;
+    simint_osteifunc_array[1][3][0][0][4] = ostei_deriv1_f_s_s_g_ptr;
+    simint_osteifunc_array[1][3][0][1][4] = ostei_deriv1_f_s_p_g_ptr;
+    simint_osteifunc_array[1][3][0][2][4] = ostei_deriv1_f_s_d_g_ptr;
+    simint_osteifunc_array[1][3][0][3][4] = ostei_deriv1_f_s_f_g_ptr;
+    simint_osteifunc_array[1][3][0][4][0] = ostei_deriv1_f_s_g_s_ptr;
+    simint_osteifunc_array[1][3][0][4][1] = ostei_deriv1_f_s_g_p_ptr;
+    simint_osteifunc_array[1][3][0][4][2] = ostei_deriv1_f_s_g_d_ptr;
+    simint_osteifunc_array[1][3][0][4][3] = ostei_deriv1_f_s_g_f_ptr;
+    simint_osteifunc_array[1][3][0][4][4] = ostei_deriv1_f_s_g_g_ptr;
+    simint_osteifunc_array[1][3][1][0][4] = ostei_deriv1_f_p_s_g_ptr;
+    simint_osteifunc_array[1][3][1][1][4] = ostei_deriv1_f_p_p_g_ptr;
+    simint_osteifunc_array[1][3][1][2][4] = ostei_deriv1_f_p_d_g_ptr;
+    simint_osteifunc_array[1][3][1][3][4] = ostei_deriv1_f_p_f_g_ptr;
+    simint_osteifunc_array[1][3][1][4][0] = ostei_deriv1_f_p_g_s_ptr;
+    simint_osteifunc_array[1][3][1][4][1] = ostei_deriv1_f_p_g_p_ptr;
+    simint_osteifunc_array[1][3][1][4][2] = ostei_deriv1_f_p_g_d_ptr;
+    simint_osteifunc_array[1][3][1][4][3] = ostei_deriv1_f_p_g_f_ptr;
+    simint_osteifunc_array[1][3][1][4][4] = ostei_deriv1_f_p_g_g_ptr;
+    simint_osteifunc_array[1][3][2][0][4] = ostei_deriv1_f_d_s_g_ptr;
+    simint_osteifunc_array[1][3][2][1][4] = ostei_deriv1_f_d_p_g_ptr;
+    simint_osteifunc_array[1][3][2][2][4] = ostei_deriv1_f_d_d_g_ptr;
+    simint_osteifunc_array[1][3][2][3][4] = ostei_deriv1_f_d_f_g_ptr;
+    simint_osteifunc_array[1][3][2][4][0] = ostei_deriv1_f_d_g_s_ptr;
+    simint_osteifunc_array[1][3][2][4][1] = ostei_deriv1_f_d_g_p_ptr;
+    simint_osteifunc_array[1][3][2][4][2] = ostei_deriv1_f_d_g_d_ptr;
+    simint_osteifunc_array[1][3][2][4][3] = ostei_deriv1_f_d_g_f_ptr;
+    simint_osteifunc_array[1][3][2][4][4] = ostei_deriv1_f_d_g_g_ptr;
+    simint_osteifunc_array[1][3][3][0][4] = ostei_deriv1_f_f_s_g_ptr;
+    simint_osteifunc_array[1][3][3][1][4] = ostei_deriv1_f_f_p_g_ptr;
+    simint_osteifunc_array[1][3][3][2][4] = ostei_deriv1_f_f_d_g_ptr;
+    simint_osteifunc_array[1][3][3][3][4] = ostei_deriv1_f_f_f_g_ptr;
+    simint_osteifunc_array[1][3][3][4][0] = ostei_deriv1_f_f_g_s_ptr;
+    simint_osteifunc_array[1][3][3][4][1] = ostei_deriv1_f_f_g_p_ptr;
+    simint_osteifunc_array[1][3][3][4][2] = ostei_deriv1_f_f_g_d_ptr;
+    simint_osteifunc_array[1][3][3][4][3] = ostei_deriv1_f_f_g_f_ptr;
+    simint_osteifunc_array[1][3][3][4][4] = ostei_deriv1_f_f_g_g_ptr;
+    simint_osteifunc_array[1][3][4][0][0] = ostei_deriv1_f_g_s_s_ptr;
+    simint_osteifunc_array[1][3][4][0][1] = ostei_deriv1_f_g_s_p_ptr;
+    simint_osteifunc_array[1][3][4][0][2] = ostei_deriv1_f_g_s_d_ptr;
+    simint_osteifunc_array[1][3][4][0][3] = ostei_deriv1_f_g_s_f_ptr;
+    simint_osteifunc_array[1][3][4][0][4] = ostei_deriv1_f_g_s_g_ptr;
+    simint_osteifunc_array[1][3][4][1][0] = ostei_deriv1_f_g_p_s_ptr;
+    simint_osteifunc_array[1][3][4][1][1] = ostei_deriv1_f_g_p_p_ptr;
+    simint_osteifunc_array[1][3][4][1][2] = ostei_deriv1_f_g_p_d_ptr;
+    simint_osteifunc_array[1][3][4][1][3] = ostei_deriv1_f_g_p_f_ptr;
+    simint_osteifunc_array[1][3][4][1][4] = ostei_deriv1_f_g_p_g_ptr;
+    simint_osteifunc_array[1][3][4][2][0] = ostei_deriv1_f_g_d_s_ptr;
+    simint_osteifunc_array[1][3][4][2][1] = ostei_deriv1_f_g_d_p_ptr;
+    simint_osteifunc_array[1][3][4][2][2] = ostei_deriv1_f_g_d_d_ptr;
+    simint_osteifunc_array[1][3][4][2][3] = ostei_deriv1_f_g_d_f_ptr;
+    simint_osteifunc_array[1][3][4][2][4] = ostei_deriv1_f_g_d_g_ptr;
+    simint_osteifunc_array[1][3][4][3][0] = ostei_deriv1_f_g_f_s_ptr;
+    simint_osteifunc_array[1][3][4][3][1] = ostei_deriv1_f_g_f_p_ptr;
+    simint_osteifunc_array[1][3][4][3][2] = ostei_deriv1_f_g_f_d_ptr;
+    simint_osteifunc_array[1][3][4][3][3] = ostei_deriv1_f_g_f_f_ptr;
+    simint_osteifunc_array[1][3][4][3][4] = ostei_deriv1_f_g_f_g_ptr;
+    simint_osteifunc_array[1][3][4][4][0] = ostei_deriv1_f_g_g_s_ptr;
+    simint_osteifunc_array[1][3][4][4][1] = ostei_deriv1_f_g_g_p_ptr;
+    simint_osteifunc_array[1][3][4][4][2] = ostei_deriv1_f_g_g_d_ptr;
+    simint_osteifunc_array[1][3][4][4][3] = ostei_deriv1_f_g_g_f_ptr;
+    simint_osteifunc_array[1][3][4][4][4] = ostei_deriv1_f_g_g_g_ptr;
+    simint_osteifunc_array[1][4][0][0][0] = ostei_deriv1_g_s_s_s_ptr;
+    simint_osteifunc_array[1][4][0][0][1] = ostei_deriv1_g_s_s_p_ptr;
+    simint_osteifunc_array[1][4][0][0][2] = ostei_deriv1_g_s_s_d_ptr;
+    simint_osteifunc_array[1][4][0][0][3] = ostei_deriv1_g_s_s_f_ptr;
+    simint_osteifunc_array[1][4][0][0][4] = ostei_deriv1_g_s_s_g_ptr;
+    simint_osteifunc_array[1][4][0][1][0] = ostei_deriv1_g_s_p_s_ptr;
+    simint_osteifunc_array[1][4][0][1][1] = ostei_deriv1_g_s_p_p_ptr;
+    simint_osteifunc_array[1][4][0][1][2] = ostei_deriv1_g_s_p_d_ptr;
+    simint_osteifunc_array[1][4][0][1][3] = ostei_deriv1_g_s_p_f_ptr;
+    simint_osteifunc_array[1][4][0][1][4] = ostei_deriv1_g_s_p_g_ptr;
+    simint_osteifunc_array[1][4][0][2][0] = ostei_deriv1_g_s_d_s_ptr;
+    simint_osteifunc_array[1][4][0][2][1] = ostei_deriv1_g_s_d_p_ptr;
+    simint_osteifunc_array[1][4][0][2][2] = ostei_deriv1_g_s_d_d_ptr;
+    simint_osteifunc_array[1][4][0][2][3] = ostei_deriv1_g_s_d_f_ptr;
+    simint_osteifunc_array[1][4][0][2][4] = ostei_deriv1_g_s_d_g_ptr;
+    simint_osteifunc_array[1][4][0][3][0] = ostei_deriv1_g_s_f_s_ptr;
+    simint_osteifunc_array[1][4][0][3][1] = ostei_deriv1_g_s_f_p_ptr;
+    simint_osteifunc_array[1][4][0][3][2] = ostei_deriv1_g_s_f_d_ptr;
+    simint_osteifunc_array[1][4][0][3][3] = ostei_deriv1_g_s_f_f_ptr;
+    simint_osteifunc_array[1][4][0][3][4] = ostei_deriv1_g_s_f_g_ptr;
+    simint_osteifunc_array[1][4][0][4][0] = ostei_deriv1_g_s_g_s_ptr;
+    simint_osteifunc_array[1][4][0][4][1] = ostei_deriv1_g_s_g_p_ptr;
+    simint_osteifunc_array[1][4][0][4][2] = ostei_deriv1_g_s_g_d_ptr;
+    simint_osteifunc_array[1][4][0][4][3] = ostei_deriv1_g_s_g_f_ptr;
+    simint_osteifunc_array[1][4][0][4][4] = ostei_deriv1_g_s_g_g_ptr;
+    simint_osteifunc_array[1][4][1][0][0] = ostei_deriv1_g_p_s_s_ptr;
+    simint_osteifunc_array[1][4][1][0][1] = ostei_deriv1_g_p_s_p_ptr;
+    simint_osteifunc_array[1][4][1][0][2] = ostei_deriv1_g_p_s_d_ptr;
+    simint_osteifunc_array[1][4][1][0][3] = ostei_deriv1_g_p_s_f_ptr;
+    simint_osteifunc_array[1][4][1][0][4] = ostei_deriv1_g_p_s_g_ptr;
+    simint_osteifunc_array[1][4][1][1][0] = ostei_deriv1_g_p_p_s_ptr;
+    simint_osteifunc_array[1][4][1][1][1] = ostei_deriv1_g_p_p_p_ptr;
+    simint_osteifunc_array[1][4][1][1][2] = ostei_deriv1_g_p_p_d_ptr;
+    simint_osteifunc_array[1][4][1][1][3] = ostei_deriv1_g_p_p_f_ptr;
+    simint_osteifunc_array[1][4][1][1][4] = ostei_deriv1_g_p_p_g_ptr;
+    simint_osteifunc_array[1][4][1][2][0] = ostei_deriv1_g_p_d_s_ptr;
+    simint_osteifunc_array[1][4][1][2][1] = ostei_deriv1_g_p_d_p_ptr;
+    simint_osteifunc_array[1][4][1][2][2] = ostei_deriv1_g_p_d_d_ptr;
+    simint_osteifunc_array[1][4][1][2][3] = ostei_deriv1_g_p_d_f_ptr;
+    simint_osteifunc_array[1][4][1][2][4] = ostei_deriv1_g_p_d_g_ptr;
+    simint_osteifunc_array[1][4][1][3][0] = ostei_deriv1_g_p_f_s_ptr;
+    simint_osteifunc_array[1][4][1][3][1] = ostei_deriv1_g_p_f_p_ptr;
+    simint_osteifunc_array[1][4][1][3][2] = ostei_deriv1_g_p_f_d_ptr;
+    simint_osteifunc_array[1][4][1][3][3] = ostei_deriv1_g_p_f_f_ptr;
+    simint_osteifunc_array[1][4][1][3][4] = ostei_deriv1_g_p_f_g_ptr;
+    simint_osteifunc_array[1][4][1][4][0] = ostei_deriv1_g_p_g_s_ptr;
+    simint_osteifunc_array[1][4][1][4][1] = ostei_deriv1_g_p_g_p_ptr;
+    simint_osteifunc_array[1][4][1][4][2] = ostei_deriv1_g_p_g_d_ptr;
+    simint_osteifunc_array[1][4][1][4][3] = ostei_deriv1_g_p_g_f_ptr;
+    simint_osteifunc_array[1][4][1][4][4] = ostei_deriv1_g_p_g_g_ptr;
+    simint_osteifunc_array[1][4][2][0][0] = ostei_deriv1_g_d_s_s_ptr;
+    simint_osteifunc_array[1][4][2][0][1] = ostei_deriv1_g_d_s_p_ptr;
+    simint_osteifunc_array[1][4][2][0][2] = ostei_deriv1_g_d_s_d_ptr;
+    simint_osteifunc_array[1][4][2][0][3] = ostei_deriv1_g_d_s_f_ptr;
+    simint_osteifunc_array[1][4][2][0][4] = ostei_deriv1_g_d_s_g_ptr;
+    simint_osteifunc_array[1][4][2][1][0] = ostei_deriv1_g_d_p_s_ptr;
+    simint_osteifunc_array[1][4][2][1][1] = ostei_deriv1_g_d_p_p_ptr;
+    simint_osteifunc_array[1][4][2][1][2] = ostei_deriv1_g_d_p_d_ptr;
+    simint_osteifunc_array[1][4][2][1][3] = ostei_deriv1_g_d_p_f_ptr;
+    simint_osteifunc_array[1][4][2][1][4] = ostei_deriv1_g_d_p_g_ptr;
+    simint_osteifunc_array[1][4][2][2][0] = ostei_deriv1_g_d_d_s_ptr;
+    simint_osteifunc_array[1][4][2][2][1] = ostei_deriv1_g_d_d_p_ptr;
+    simint_osteifunc_array[1][4][2][2][2] = ostei_deriv1_g_d_d_d_ptr;
+    simint_osteifunc_array[1][4][2][2][3] = ostei_deriv1_g_d_d_f_ptr;
+    simint_osteifunc_array[1][4][2][2][4] = ostei_deriv1_g_d_d_g_ptr;
+    simint_osteifunc_array[1][4][2][3][0] = ostei_deriv1_g_d_f_s_ptr;
+    simint_osteifunc_array[1][4][2][3][1] = ostei_deriv1_g_d_f_p_ptr;
+    simint_osteifunc_array[1][4][2][3][2] = ostei_deriv1_g_d_f_d_ptr;
+    simint_osteifunc_array[1][4][2][3][3] = ostei_deriv1_g_d_f_f_ptr;
+    simint_osteifunc_array[1][4][2][3][4] = ostei_deriv1_g_d_f_g_ptr;
+    simint_osteifunc_array[1][4][2][4][0] = ostei_deriv1_g_d_g_s_ptr;
+    simint_osteifunc_array[1][4][2][4][1] = ostei_deriv1_g_d_g_p_ptr;
+    simint_osteifunc_array[1][4][2][4][2] = ostei_deriv1_g_d_g_d_ptr;
+    simint_osteifunc_array[1][4][2][4][3] = ostei_deriv1_g_d_g_f_ptr;
+    simint_osteifunc_array[1][4][2][4][4] = ostei_deriv1_g_d_g_g_ptr;
+    simint_osteifunc_array[1][4][3][0][0] = ostei_deriv1_g_f_s_s_ptr;
+    simint_osteifunc_array[1][4][3][0][1] = ostei_deriv1_g_f_s_p_ptr;
+    simint_osteifunc_array[1][4][3][0][2] = ostei_deriv1_g_f_s_d_ptr;
+    simint_osteifunc_array[1][4][3][0][3] = ostei_deriv1_g_f_s_f_ptr;
+    simint_osteifunc_array[1][4][3][0][4] = ostei_deriv1_g_f_s_g_ptr;
+    simint_osteifunc_array[1][4][3][1][0] = ostei_deriv1_g_f_p_s_ptr;
+    simint_osteifunc_array[1][4][3][1][1] = ostei_deriv1_g_f_p_p_ptr;
+    simint_osteifunc_array[1][4][3][1][2] = ostei_deriv1_g_f_p_d_ptr;
+    simint_osteifunc_array[1][4][3][1][3] = ostei_deriv1_g_f_p_f_ptr;
+    simint_osteifunc_array[1][4][3][1][4] = ostei_deriv1_g_f_p_g_ptr;
+    simint_osteifunc_array[1][4][3][2][0] = ostei_deriv1_g_f_d_s_ptr;
+    simint_osteifunc_array[1][4][3][2][1] = ostei_deriv1_g_f_d_p_ptr;
+    simint_osteifunc_array[1][4][3][2][2] = ostei_deriv1_g_f_d_d_ptr;
+    simint_osteifunc_array[1][4][3][2][3] = ostei_deriv1_g_f_d_f_ptr;
+    simint_osteifunc_array[1][4][3][2][4] = ostei_deriv1_g_f_d_g_ptr;
+    simint_osteifunc_array[1][4][3][3][0] = ostei_deriv1_g_f_f_s_ptr;
+    simint_osteifunc_array[1][4][3][3][1] = ostei_deriv1_g_f_f_p_ptr;
+    simint_osteifunc_array[1][4][3][3][2] = ostei_deriv1_g_f_f_d_ptr;
+    simint_osteifunc_array[1][4][3][3][3] = ostei_deriv1_g_f_f_f_ptr;
+    simint_osteifunc_array[1][4][3][3][4] = ostei_deriv1_g_f_f_g_ptr;
+    simint_osteifunc_array[1][4][3][4][0] = ostei_deriv1_g_f_g_s_ptr;
+    simint_osteifunc_array[1][4][3][4][1] = ostei_deriv1_g_f_g_p_ptr;
+    simint_osteifunc_array[1][4][3][4][2] = ostei_deriv1_g_f_g_d_ptr;
+    simint_osteifunc_array[1][4][3][4][3] = ostei_deriv1_g_f_g_f_ptr;
+    simint_osteifunc_array[1][4][3][4][4] = ostei_deriv1_g_f_g_g_ptr;
+    simint_osteifunc_array[1][4][4][0][0] = ostei_deriv1_g_g_s_s_ptr;
+    simint_osteifunc_array[1][4][4][0][1] = ostei_deriv1_g_g_s_p_ptr;
+    simint_osteifunc_array[1][4][4][0][2] = ostei_deriv1_g_g_s_d_ptr;
+    simint_osteifunc_array[1][4][4][0][3] = ostei_deriv1_g_g_s_f_ptr;
+    simint_osteifunc_array[1][4][4][0][4] = ostei_deriv1_g_g_s_g_ptr;
+    simint_osteifunc_array[1][4][4][1][0] = ostei_deriv1_g_g_p_s_ptr;
+    simint_osteifunc_array[1][4][4][1][1] = ostei_deriv1_g_g_p_p_ptr;
+    simint_osteifunc_array[1][4][4][1][2] = ostei_deriv1_g_g_p_d_ptr;
+    simint_osteifunc_array[1][4][4][1][3] = ostei_deriv1_g_g_p_f_ptr;
+    simint_osteifunc_array[1][4][4][1][4] = ostei_deriv1_g_g_p_g_ptr;
+    simint_osteifunc_array[1][4][4][2][0] = ostei_deriv1_g_g_d_s_ptr;
+    simint_osteifunc_array[1][4][4][2][1] = ostei_deriv1_g_g_d_p_ptr;
+    simint_osteifunc_array[1][4][4][2][2] = ostei_deriv1_g_g_d_d_ptr;
+    simint_osteifunc_array[1][4][4][2][3] = ostei_deriv1_g_g_d_f_ptr;
+    simint_osteifunc_array[1][4][4][2][4] = ostei_deriv1_g_g_d_g_ptr;
+    simint_osteifunc_array[1][4][4][3][0] = ostei_deriv1_g_g_f_s_ptr;
+    simint_osteifunc_array[1][4][4][3][1] = ostei_deriv1_g_g_f_p_ptr;
+    simint_osteifunc_array[1][4][4][3][2] = ostei_deriv1_g_g_f_d_ptr;
+    simint_osteifunc_array[1][4][4][3][3] = ostei_deriv1_g_g_f_f_ptr;
+    simint_osteifunc_array[1][4][4][3][4] = ostei_deriv1_g_g_f_g_ptr;
+    simint_osteifunc_array[1][4][4][4][0] = ostei_deriv1_g_g_g_s_ptr;
+    simint_osteifunc_array[1][4][4][4][1] = ostei_deriv1_g_g_g_p_ptr;
+    simint_osteifunc_array[1][4][4][4][2] = ostei_deriv1_g_g_g_d_ptr;
+    simint_osteifunc_array[1][4][4][4][3] = ostei_deriv1_g_g_g_f_ptr;
+    simint_osteifunc_array[1][4][4][4][4] = ostei_deriv1_g_g_g_g_ptr;
     #endif
 
     #if SIMINT_OSTEI_DERIV1_MAXAM >= 5
-    simint_osteifunc_array[1][0][0][0][5] = ostei_deriv1_s_s_s_h;
-    simint_osteifunc_array[1][0][0][1][5] = ostei_deriv1_s_s_p_h;
-    simint_osteifunc_array[1][0][0][2][5] = ostei_deriv1_s_s_d_h;
-    simint_osteifunc_array[1][0][0][3][5] = ostei_deriv1_s_s_f_h;
-    simint_osteifunc_array[1][0][0][4][5] = ostei_deriv1_s_s_g_h;
-    simint_osteifunc_array[1][0][0][5][0] = ostei_deriv1_s_s_h_s;
-    simint_osteifunc_array[1][0][0][5][1] = ostei_deriv1_s_s_h_p;
-    simint_osteifunc_array[1][0][0][5][2] = ostei_deriv1_s_s_h_d;
-    simint_osteifunc_array[1][0][0][5][3] = ostei_deriv1_s_s_h_f;
-    simint_osteifunc_array[1][0][0][5][4] = ostei_deriv1_s_s_h_g;
-    simint_osteifunc_array[1][0][0][5][5] = ostei_deriv1_s_s_h_h;
-    simint_osteifunc_array[1][0][1][0][5] = ostei_deriv1_s_p_s_h;
-    simint_osteifunc_array[1][0][1][1][5] = ostei_deriv1_s_p_p_h;
-    simint_osteifunc_array[1][0][1][2][5] = ostei_deriv1_s_p_d_h;
-    simint_osteifunc_array[1][0][1][3][5] = ostei_deriv1_s_p_f_h;
-    simint_osteifunc_array[1][0][1][4][5] = ostei_deriv1_s_p_g_h;
-    simint_osteifunc_array[1][0][1][5][0] = ostei_deriv1_s_p_h_s;
-    simint_osteifunc_array[1][0][1][5][1] = ostei_deriv1_s_p_h_p;
-    simint_osteifunc_array[1][0][1][5][2] = ostei_deriv1_s_p_h_d;
-    simint_osteifunc_array[1][0][1][5][3] = ostei_deriv1_s_p_h_f;
-    simint_osteifunc_array[1][0][1][5][4] = ostei_deriv1_s_p_h_g;
-    simint_osteifunc_array[1][0][1][5][5] = ostei_deriv1_s_p_h_h;
-    simint_osteifunc_array[1][0][2][0][5] = ostei_deriv1_s_d_s_h;
-    simint_osteifunc_array[1][0][2][1][5] = ostei_deriv1_s_d_p_h;
-    simint_osteifunc_array[1][0][2][2][5] = ostei_deriv1_s_d_d_h;
-    simint_osteifunc_array[1][0][2][3][5] = ostei_deriv1_s_d_f_h;
-    simint_osteifunc_array[1][0][2][4][5] = ostei_deriv1_s_d_g_h;
-    simint_osteifunc_array[1][0][2][5][0] = ostei_deriv1_s_d_h_s;
-    simint_osteifunc_array[1][0][2][5][1] = ostei_deriv1_s_d_h_p;
-    simint_osteifunc_array[1][0][2][5][2] = ostei_deriv1_s_d_h_d;
-    simint_osteifunc_array[1][0][2][5][3] = ostei_deriv1_s_d_h_f;
-    simint_osteifunc_array[1][0][2][5][4] = ostei_deriv1_s_d_h_g;
-    simint_osteifunc_array[1][0][2][5][5] = ostei_deriv1_s_d_h_h;
-    simint_osteifunc_array[1][0][3][0][5] = ostei_deriv1_s_f_s_h;
-    simint_osteifunc_array[1][0][3][1][5] = ostei_deriv1_s_f_p_h;
-    simint_osteifunc_array[1][0][3][2][5] = ostei_deriv1_s_f_d_h;
-    simint_osteifunc_array[1][0][3][3][5] = ostei_deriv1_s_f_f_h;
-    simint_osteifunc_array[1][0][3][4][5] = ostei_deriv1_s_f_g_h;
-    simint_osteifunc_array[1][0][3][5][0] = ostei_deriv1_s_f_h_s;
-    simint_osteifunc_array[1][0][3][5][1] = ostei_deriv1_s_f_h_p;
-    simint_osteifunc_array[1][0][3][5][2] = ostei_deriv1_s_f_h_d;
-    simint_osteifunc_array[1][0][3][5][3] = ostei_deriv1_s_f_h_f;
-    simint_osteifunc_array[1][0][3][5][4] = ostei_deriv1_s_f_h_g;
-    simint_osteifunc_array[1][0][3][5][5] = ostei_deriv1_s_f_h_h;
-    simint_osteifunc_array[1][0][4][0][5] = ostei_deriv1_s_g_s_h;
-    simint_osteifunc_array[1][0][4][1][5] = ostei_deriv1_s_g_p_h;
-    simint_osteifunc_array[1][0][4][2][5] = ostei_deriv1_s_g_d_h;
-    simint_osteifunc_array[1][0][4][3][5] = ostei_deriv1_s_g_f_h;
-    simint_osteifunc_array[1][0][4][4][5] = ostei_deriv1_s_g_g_h;
-    simint_osteifunc_array[1][0][4][5][0] = ostei_deriv1_s_g_h_s;
-    simint_osteifunc_array[1][0][4][5][1] = ostei_deriv1_s_g_h_p;
-    simint_osteifunc_array[1][0][4][5][2] = ostei_deriv1_s_g_h_d;
-    simint_osteifunc_array[1][0][4][5][3] = ostei_deriv1_s_g_h_f;
-    simint_osteifunc_array[1][0][4][5][4] = ostei_deriv1_s_g_h_g;
-    simint_osteifunc_array[1][0][4][5][5] = ostei_deriv1_s_g_h_h;
-    simint_osteifunc_array[1][0][5][0][0] = ostei_deriv1_s_h_s_s;
-    simint_osteifunc_array[1][0][5][0][1] = ostei_deriv1_s_h_s_p;
-    simint_osteifunc_array[1][0][5][0][2] = ostei_deriv1_s_h_s_d;
-    simint_osteifunc_array[1][0][5][0][3] = ostei_deriv1_s_h_s_f;
-    simint_osteifunc_array[1][0][5][0][4] = ostei_deriv1_s_h_s_g;
-    simint_osteifunc_array[1][0][5][0][5] = ostei_deriv1_s_h_s_h;
-    simint_osteifunc_array[1][0][5][1][0] = ostei_deriv1_s_h_p_s;
-    simint_osteifunc_array[1][0][5][1][1] = ostei_deriv1_s_h_p_p;
-    simint_osteifunc_array[1][0][5][1][2] = ostei_deriv1_s_h_p_d;
-    simint_osteifunc_array[1][0][5][1][3] = ostei_deriv1_s_h_p_f;
-    simint_osteifunc_array[1][0][5][1][4] = ostei_deriv1_s_h_p_g;
-    simint_osteifunc_array[1][0][5][1][5] = ostei_deriv1_s_h_p_h;
-    simint_osteifunc_array[1][0][5][2][0] = ostei_deriv1_s_h_d_s;
-    simint_osteifunc_array[1][0][5][2][1] = ostei_deriv1_s_h_d_p;
-    simint_osteifunc_array[1][0][5][2][2] = ostei_deriv1_s_h_d_d;
-    simint_osteifunc_array[1][0][5][2][3] = ostei_deriv1_s_h_d_f;
-    simint_osteifunc_array[1][0][5][2][4] = ostei_deriv1_s_h_d_g;
-    simint_osteifunc_array[1][0][5][2][5] = ostei_deriv1_s_h_d_h;
-    simint_osteifunc_array[1][0][5][3][0] = ostei_deriv1_s_h_f_s;
-    simint_osteifunc_array[1][0][5][3][1] = ostei_deriv1_s_h_f_p;
-    simint_osteifunc_array[1][0][5][3][2] = ostei_deriv1_s_h_f_d;
-    simint_osteifunc_array[1][0][5][3][3] = ostei_deriv1_s_h_f_f;
-    simint_osteifunc_array[1][0][5][3][4] = ostei_deriv1_s_h_f_g;
-    simint_osteifunc_array[1][0][5][3][5] = ostei_deriv1_s_h_f_h;
-    simint_osteifunc_array[1][0][5][4][0] = ostei_deriv1_s_h_g_s;
-    simint_osteifunc_array[1][0][5][4][1] = ostei_deriv1_s_h_g_p;
-    simint_osteifunc_array[1][0][5][4][2] = ostei_deriv1_s_h_g_d;
-    simint_osteifunc_array[1][0][5][4][3] = ostei_deriv1_s_h_g_f;
-    simint_osteifunc_array[1][0][5][4][4] = ostei_deriv1_s_h_g_g;
-    simint_osteifunc_array[1][0][5][4][5] = ostei_deriv1_s_h_g_h;
-    simint_osteifunc_array[1][0][5][5][0] = ostei_deriv1_s_h_h_s;
-    simint_osteifunc_array[1][0][5][5][1] = ostei_deriv1_s_h_h_p;
-    simint_osteifunc_array[1][0][5][5][2] = ostei_deriv1_s_h_h_d;
-    simint_osteifunc_array[1][0][5][5][3] = ostei_deriv1_s_h_h_f;
-    simint_osteifunc_array[1][0][5][5][4] = ostei_deriv1_s_h_h_g;
-    simint_osteifunc_array[1][0][5][5][5] = ostei_deriv1_s_h_h_h;
-    simint_osteifunc_array[1][1][0][0][5] = ostei_deriv1_p_s_s_h;
-    simint_osteifunc_array[1][1][0][1][5] = ostei_deriv1_p_s_p_h;
-    simint_osteifunc_array[1][1][0][2][5] = ostei_deriv1_p_s_d_h;
-    simint_osteifunc_array[1][1][0][3][5] = ostei_deriv1_p_s_f_h;
-    simint_osteifunc_array[1][1][0][4][5] = ostei_deriv1_p_s_g_h;
-    simint_osteifunc_array[1][1][0][5][0] = ostei_deriv1_p_s_h_s;
-    simint_osteifunc_array[1][1][0][5][1] = ostei_deriv1_p_s_h_p;
-    simint_osteifunc_array[1][1][0][5][2] = ostei_deriv1_p_s_h_d;
-    simint_osteifunc_array[1][1][0][5][3] = ostei_deriv1_p_s_h_f;
-    simint_osteifunc_array[1][1][0][5][4] = ostei_deriv1_p_s_h_g;
-    simint_osteifunc_array[1][1][0][5][5] = ostei_deriv1_p_s_h_h;
-    simint_osteifunc_array[1][1][1][0][5] = ostei_deriv1_p_p_s_h;
-    simint_osteifunc_array[1][1][1][1][5] = ostei_deriv1_p_p_p_h;
-    simint_osteifunc_array[1][1][1][2][5] = ostei_deriv1_p_p_d_h;
-    simint_osteifunc_array[1][1][1][3][5] = ostei_deriv1_p_p_f_h;
-    simint_osteifunc_array[1][1][1][4][5] = ostei_deriv1_p_p_g_h;
-    simint_osteifunc_array[1][1][1][5][0] = ostei_deriv1_p_p_h_s;
-    simint_osteifunc_array[1][1][1][5][1] = ostei_deriv1_p_p_h_p;
-    simint_osteifunc_array[1][1][1][5][2] = ostei_deriv1_p_p_h_d;
-    simint_osteifunc_array[1][1][1][5][3] = ostei_deriv1_p_p_h_f;
-    simint_osteifunc_array[1][1][1][5][4] = ostei_deriv1_p_p_h_g;
-    simint_osteifunc_array[1][1][1][5][5] = ostei_deriv1_p_p_h_h;
-    simint_osteifunc_array[1][1][2][0][5] = ostei_deriv1_p_d_s_h;
-    simint_osteifunc_array[1][1][2][1][5] = ostei_deriv1_p_d_p_h;
-    simint_osteifunc_array[1][1][2][2][5] = ostei_deriv1_p_d_d_h;
-    simint_osteifunc_array[1][1][2][3][5] = ostei_deriv1_p_d_f_h;
-    simint_osteifunc_array[1][1][2][4][5] = ostei_deriv1_p_d_g_h;
-    simint_osteifunc_array[1][1][2][5][0] = ostei_deriv1_p_d_h_s;
-    simint_osteifunc_array[1][1][2][5][1] = ostei_deriv1_p_d_h_p;
-    simint_osteifunc_array[1][1][2][5][2] = ostei_deriv1_p_d_h_d;
-    simint_osteifunc_array[1][1][2][5][3] = ostei_deriv1_p_d_h_f;
-    simint_osteifunc_array[1][1][2][5][4] = ostei_deriv1_p_d_h_g;
-    simint_osteifunc_array[1][1][2][5][5] = ostei_deriv1_p_d_h_h;
-    simint_osteifunc_array[1][1][3][0][5] = ostei_deriv1_p_f_s_h;
-    simint_osteifunc_array[1][1][3][1][5] = ostei_deriv1_p_f_p_h;
-    simint_osteifunc_array[1][1][3][2][5] = ostei_deriv1_p_f_d_h;
-    simint_osteifunc_array[1][1][3][3][5] = ostei_deriv1_p_f_f_h;
-    simint_osteifunc_array[1][1][3][4][5] = ostei_deriv1_p_f_g_h;
-    simint_osteifunc_array[1][1][3][5][0] = ostei_deriv1_p_f_h_s;
-    simint_osteifunc_array[1][1][3][5][1] = ostei_deriv1_p_f_h_p;
-    simint_osteifunc_array[1][1][3][5][2] = ostei_deriv1_p_f_h_d;
-    simint_osteifunc_array[1][1][3][5][3] = ostei_deriv1_p_f_h_f;
-    simint_osteifunc_array[1][1][3][5][4] = ostei_deriv1_p_f_h_g;
-    simint_osteifunc_array[1][1][3][5][5] = ostei_deriv1_p_f_h_h;
-    simint_osteifunc_array[1][1][4][0][5] = ostei_deriv1_p_g_s_h;
-    simint_osteifunc_array[1][1][4][1][5] = ostei_deriv1_p_g_p_h;
-    simint_osteifunc_array[1][1][4][2][5] = ostei_deriv1_p_g_d_h;
-    simint_osteifunc_array[1][1][4][3][5] = ostei_deriv1_p_g_f_h;
-    simint_osteifunc_array[1][1][4][4][5] = ostei_deriv1_p_g_g_h;
-    simint_osteifunc_array[1][1][4][5][0] = ostei_deriv1_p_g_h_s;
-    simint_osteifunc_array[1][1][4][5][1] = ostei_deriv1_p_g_h_p;
-    simint_osteifunc_array[1][1][4][5][2] = ostei_deriv1_p_g_h_d;
-    simint_osteifunc_array[1][1][4][5][3] = ostei_deriv1_p_g_h_f;
-    simint_osteifunc_array[1][1][4][5][4] = ostei_deriv1_p_g_h_g;
-    simint_osteifunc_array[1][1][4][5][5] = ostei_deriv1_p_g_h_h;
-    simint_osteifunc_array[1][1][5][0][0] = ostei_deriv1_p_h_s_s;
-    simint_osteifunc_array[1][1][5][0][1] = ostei_deriv1_p_h_s_p;
-    simint_osteifunc_array[1][1][5][0][2] = ostei_deriv1_p_h_s_d;
-    simint_osteifunc_array[1][1][5][0][3] = ostei_deriv1_p_h_s_f;
-    simint_osteifunc_array[1][1][5][0][4] = ostei_deriv1_p_h_s_g;
-    simint_osteifunc_array[1][1][5][0][5] = ostei_deriv1_p_h_s_h;
-    simint_osteifunc_array[1][1][5][1][0] = ostei_deriv1_p_h_p_s;
-    simint_osteifunc_array[1][1][5][1][1] = ostei_deriv1_p_h_p_p;
-    simint_osteifunc_array[1][1][5][1][2] = ostei_deriv1_p_h_p_d;
-    simint_osteifunc_array[1][1][5][1][3] = ostei_deriv1_p_h_p_f;
-    simint_osteifunc_array[1][1][5][1][4] = ostei_deriv1_p_h_p_g;
-    simint_osteifunc_array[1][1][5][1][5] = ostei_deriv1_p_h_p_h;
-    simint_osteifunc_array[1][1][5][2][0] = ostei_deriv1_p_h_d_s;
-    simint_osteifunc_array[1][1][5][2][1] = ostei_deriv1_p_h_d_p;
-    simint_osteifunc_array[1][1][5][2][2] = ostei_deriv1_p_h_d_d;
-    simint_osteifunc_array[1][1][5][2][3] = ostei_deriv1_p_h_d_f;
-    simint_osteifunc_array[1][1][5][2][4] = ostei_deriv1_p_h_d_g;
-    simint_osteifunc_array[1][1][5][2][5] = ostei_deriv1_p_h_d_h;
-    simint_osteifunc_array[1][1][5][3][0] = ostei_deriv1_p_h_f_s;
-    simint_osteifunc_array[1][1][5][3][1] = ostei_deriv1_p_h_f_p;
-    simint_osteifunc_array[1][1][5][3][2] = ostei_deriv1_p_h_f_d;
-    simint_osteifunc_array[1][1][5][3][3] = ostei_deriv1_p_h_f_f;
-    simint_osteifunc_array[1][1][5][3][4] = ostei_deriv1_p_h_f_g;
-    simint_osteifunc_array[1][1][5][3][5] = ostei_deriv1_p_h_f_h;
-    simint_osteifunc_array[1][1][5][4][0] = ostei_deriv1_p_h_g_s;
-    simint_osteifunc_array[1][1][5][4][1] = ostei_deriv1_p_h_g_p;
-    simint_osteifunc_array[1][1][5][4][2] = ostei_deriv1_p_h_g_d;
-    simint_osteifunc_array[1][1][5][4][3] = ostei_deriv1_p_h_g_f;
-    simint_osteifunc_array[1][1][5][4][4] = ostei_deriv1_p_h_g_g;
-    simint_osteifunc_array[1][1][5][4][5] = ostei_deriv1_p_h_g_h;
-    simint_osteifunc_array[1][1][5][5][0] = ostei_deriv1_p_h_h_s;
-    simint_osteifunc_array[1][1][5][5][1] = ostei_deriv1_p_h_h_p;
-    simint_osteifunc_array[1][1][5][5][2] = ostei_deriv1_p_h_h_d;
-    simint_osteifunc_array[1][1][5][5][3] = ostei_deriv1_p_h_h_f;
-    simint_osteifunc_array[1][1][5][5][4] = ostei_deriv1_p_h_h_g;
-    simint_osteifunc_array[1][1][5][5][5] = ostei_deriv1_p_h_h_h;
-    simint_osteifunc_array[1][2][0][0][5] = ostei_deriv1_d_s_s_h;
-    simint_osteifunc_array[1][2][0][1][5] = ostei_deriv1_d_s_p_h;
-    simint_osteifunc_array[1][2][0][2][5] = ostei_deriv1_d_s_d_h;
-    simint_osteifunc_array[1][2][0][3][5] = ostei_deriv1_d_s_f_h;
-    simint_osteifunc_array[1][2][0][4][5] = ostei_deriv1_d_s_g_h;
-    simint_osteifunc_array[1][2][0][5][0] = ostei_deriv1_d_s_h_s;
-    simint_osteifunc_array[1][2][0][5][1] = ostei_deriv1_d_s_h_p;
-    simint_osteifunc_array[1][2][0][5][2] = ostei_deriv1_d_s_h_d;
-    simint_osteifunc_array[1][2][0][5][3] = ostei_deriv1_d_s_h_f;
-    simint_osteifunc_array[1][2][0][5][4] = ostei_deriv1_d_s_h_g;
-    simint_osteifunc_array[1][2][0][5][5] = ostei_deriv1_d_s_h_h;
-    simint_osteifunc_array[1][2][1][0][5] = ostei_deriv1_d_p_s_h;
-    simint_osteifunc_array[1][2][1][1][5] = ostei_deriv1_d_p_p_h;
-    simint_osteifunc_array[1][2][1][2][5] = ostei_deriv1_d_p_d_h;
-    simint_osteifunc_array[1][2][1][3][5] = ostei_deriv1_d_p_f_h;
-    simint_osteifunc_array[1][2][1][4][5] = ostei_deriv1_d_p_g_h;
-    simint_osteifunc_array[1][2][1][5][0] = ostei_deriv1_d_p_h_s;
-    simint_osteifunc_array[1][2][1][5][1] = ostei_deriv1_d_p_h_p;
-    simint_osteifunc_array[1][2][1][5][2] = ostei_deriv1_d_p_h_d;
-    simint_osteifunc_array[1][2][1][5][3] = ostei_deriv1_d_p_h_f;
-    simint_osteifunc_array[1][2][1][5][4] = ostei_deriv1_d_p_h_g;
-    simint_osteifunc_array[1][2][1][5][5] = ostei_deriv1_d_p_h_h;
-    simint_osteifunc_array[1][2][2][0][5] = ostei_deriv1_d_d_s_h;
-    simint_osteifunc_array[1][2][2][1][5] = ostei_deriv1_d_d_p_h;
-    simint_osteifunc_array[1][2][2][2][5] = ostei_deriv1_d_d_d_h;
-    simint_osteifunc_array[1][2][2][3][5] = ostei_deriv1_d_d_f_h;
-    simint_osteifunc_array[1][2][2][4][5] = ostei_deriv1_d_d_g_h;
-    simint_osteifunc_array[1][2][2][5][0] = ostei_deriv1_d_d_h_s;
-    simint_osteifunc_array[1][2][2][5][1] = ostei_deriv1_d_d_h_p;
-    simint_osteifunc_array[1][2][2][5][2] = ostei_deriv1_d_d_h_d;
-    simint_osteifunc_array[1][2][2][5][3] = ostei_deriv1_d_d_h_f;
-    simint_osteifunc_array[1][2][2][5][4] = ostei_deriv1_d_d_h_g;
-    simint_osteifunc_array[1][2][2][5][5] = ostei_deriv1_d_d_h_h;
-    simint_osteifunc_array[1][2][3][0][5] = ostei_deriv1_d_f_s_h;
-    simint_osteifunc_array[1][2][3][1][5] = ostei_deriv1_d_f_p_h;
-    simint_osteifunc_array[1][2][3][2][5] = ostei_deriv1_d_f_d_h;
-    simint_osteifunc_array[1][2][3][3][5] = ostei_deriv1_d_f_f_h;
-    simint_osteifunc_array[1][2][3][4][5] = ostei_deriv1_d_f_g_h;
-    simint_osteifunc_array[1][2][3][5][0] = ostei_deriv1_d_f_h_s;
-    simint_osteifunc_array[1][2][3][5][1] = ostei_deriv1_d_f_h_p;
-    simint_osteifunc_array[1][2][3][5][2] = ostei_deriv1_d_f_h_d;
-    simint_osteifunc_array[1][2][3][5][3] = ostei_deriv1_d_f_h_f;
-    simint_osteifunc_array[1][2][3][5][4] = ostei_deriv1_d_f_h_g;
-    simint_osteifunc_array[1][2][3][5][5] = ostei_deriv1_d_f_h_h;
-    simint_osteifunc_array[1][2][4][0][5] = ostei_deriv1_d_g_s_h;
-    simint_osteifunc_array[1][2][4][1][5] = ostei_deriv1_d_g_p_h;
-    simint_osteifunc_array[1][2][4][2][5] = ostei_deriv1_d_g_d_h;
-    simint_osteifunc_array[1][2][4][3][5] = ostei_deriv1_d_g_f_h;
-    simint_osteifunc_array[1][2][4][4][5] = ostei_deriv1_d_g_g_h;
-    simint_osteifunc_array[1][2][4][5][0] = ostei_deriv1_d_g_h_s;
-    simint_osteifunc_array[1][2][4][5][1] = ostei_deriv1_d_g_h_p;
-    simint_osteifunc_array[1][2][4][5][2] = ostei_deriv1_d_g_h_d;
-    simint_osteifunc_array[1][2][4][5][3] = ostei_deriv1_d_g_h_f;
-    simint_osteifunc_array[1][2][4][5][4] = ostei_deriv1_d_g_h_g;
-    simint_osteifunc_array[1][2][4][5][5] = ostei_deriv1_d_g_h_h;
-    simint_osteifunc_array[1][2][5][0][0] = ostei_deriv1_d_h_s_s;
-    simint_osteifunc_array[1][2][5][0][1] = ostei_deriv1_d_h_s_p;
-    simint_osteifunc_array[1][2][5][0][2] = ostei_deriv1_d_h_s_d;
-    simint_osteifunc_array[1][2][5][0][3] = ostei_deriv1_d_h_s_f;
-    simint_osteifunc_array[1][2][5][0][4] = ostei_deriv1_d_h_s_g;
-    simint_osteifunc_array[1][2][5][0][5] = ostei_deriv1_d_h_s_h;
-    simint_osteifunc_array[1][2][5][1][0] = ostei_deriv1_d_h_p_s;
-    simint_osteifunc_array[1][2][5][1][1] = ostei_deriv1_d_h_p_p;
-    simint_osteifunc_array[1][2][5][1][2] = ostei_deriv1_d_h_p_d;
-    simint_osteifunc_array[1][2][5][1][3] = ostei_deriv1_d_h_p_f;
-    simint_osteifunc_array[1][2][5][1][4] = ostei_deriv1_d_h_p_g;
-    simint_osteifunc_array[1][2][5][1][5] = ostei_deriv1_d_h_p_h;
-    simint_osteifunc_array[1][2][5][2][0] = ostei_deriv1_d_h_d_s;
-    simint_osteifunc_array[1][2][5][2][1] = ostei_deriv1_d_h_d_p;
-    simint_osteifunc_array[1][2][5][2][2] = ostei_deriv1_d_h_d_d;
-    simint_osteifunc_array[1][2][5][2][3] = ostei_deriv1_d_h_d_f;
-    simint_osteifunc_array[1][2][5][2][4] = ostei_deriv1_d_h_d_g;
-    simint_osteifunc_array[1][2][5][2][5] = ostei_deriv1_d_h_d_h;
-    simint_osteifunc_array[1][2][5][3][0] = ostei_deriv1_d_h_f_s;
-    simint_osteifunc_array[1][2][5][3][1] = ostei_deriv1_d_h_f_p;
-    simint_osteifunc_array[1][2][5][3][2] = ostei_deriv1_d_h_f_d;
-    simint_osteifunc_array[1][2][5][3][3] = ostei_deriv1_d_h_f_f;
-    simint_osteifunc_array[1][2][5][3][4] = ostei_deriv1_d_h_f_g;
-    simint_osteifunc_array[1][2][5][3][5] = ostei_deriv1_d_h_f_h;
-    simint_osteifunc_array[1][2][5][4][0] = ostei_deriv1_d_h_g_s;
-    simint_osteifunc_array[1][2][5][4][1] = ostei_deriv1_d_h_g_p;
-    simint_osteifunc_array[1][2][5][4][2] = ostei_deriv1_d_h_g_d;
-    simint_osteifunc_array[1][2][5][4][3] = ostei_deriv1_d_h_g_f;
-    simint_osteifunc_array[1][2][5][4][4] = ostei_deriv1_d_h_g_g;
-    simint_osteifunc_array[1][2][5][4][5] = ostei_deriv1_d_h_g_h;
-    simint_osteifunc_array[1][2][5][5][0] = ostei_deriv1_d_h_h_s;
-    simint_osteifunc_array[1][2][5][5][1] = ostei_deriv1_d_h_h_p;
-    simint_osteifunc_array[1][2][5][5][2] = ostei_deriv1_d_h_h_d;
-    simint_osteifunc_array[1][2][5][5][3] = ostei_deriv1_d_h_h_f;
-    simint_osteifunc_array[1][2][5][5][4] = ostei_deriv1_d_h_h_g;
-    simint_osteifunc_array[1][2][5][5][5] = ostei_deriv1_d_h_h_h;
-    simint_osteifunc_array[1][3][0][0][5] = ostei_deriv1_f_s_s_h;
-    simint_osteifunc_array[1][3][0][1][5] = ostei_deriv1_f_s_p_h;
-    simint_osteifunc_array[1][3][0][2][5] = ostei_deriv1_f_s_d_h;
-    simint_osteifunc_array[1][3][0][3][5] = ostei_deriv1_f_s_f_h;
-    simint_osteifunc_array[1][3][0][4][5] = ostei_deriv1_f_s_g_h;
-    simint_osteifunc_array[1][3][0][5][0] = ostei_deriv1_f_s_h_s;
-    simint_osteifunc_array[1][3][0][5][1] = ostei_deriv1_f_s_h_p;
-    simint_osteifunc_array[1][3][0][5][2] = ostei_deriv1_f_s_h_d;
-    simint_osteifunc_array[1][3][0][5][3] = ostei_deriv1_f_s_h_f;
-    simint_osteifunc_array[1][3][0][5][4] = ostei_deriv1_f_s_h_g;
-    simint_osteifunc_array[1][3][0][5][5] = ostei_deriv1_f_s_h_h;
-    simint_osteifunc_array[1][3][1][0][5] = ostei_deriv1_f_p_s_h;
-    simint_osteifunc_array[1][3][1][1][5] = ostei_deriv1_f_p_p_h;
-    simint_osteifunc_array[1][3][1][2][5] = ostei_deriv1_f_p_d_h;
-    simint_osteifunc_array[1][3][1][3][5] = ostei_deriv1_f_p_f_h;
-    simint_osteifunc_array[1][3][1][4][5] = ostei_deriv1_f_p_g_h;
-    simint_osteifunc_array[1][3][1][5][0] = ostei_deriv1_f_p_h_s;
-    simint_osteifunc_array[1][3][1][5][1] = ostei_deriv1_f_p_h_p;
-    simint_osteifunc_array[1][3][1][5][2] = ostei_deriv1_f_p_h_d;
-    simint_osteifunc_array[1][3][1][5][3] = ostei_deriv1_f_p_h_f;
-    simint_osteifunc_array[1][3][1][5][4] = ostei_deriv1_f_p_h_g;
-    simint_osteifunc_array[1][3][1][5][5] = ostei_deriv1_f_p_h_h;
-    simint_osteifunc_array[1][3][2][0][5] = ostei_deriv1_f_d_s_h;
-    simint_osteifunc_array[1][3][2][1][5] = ostei_deriv1_f_d_p_h;
-    simint_osteifunc_array[1][3][2][2][5] = ostei_deriv1_f_d_d_h;
-    simint_osteifunc_array[1][3][2][3][5] = ostei_deriv1_f_d_f_h;
-    simint_osteifunc_array[1][3][2][4][5] = ostei_deriv1_f_d_g_h;
-    simint_osteifunc_array[1][3][2][5][0] = ostei_deriv1_f_d_h_s;
-    simint_osteifunc_array[1][3][2][5][1] = ostei_deriv1_f_d_h_p;
-    simint_osteifunc_array[1][3][2][5][2] = ostei_deriv1_f_d_h_d;
-    simint_osteifunc_array[1][3][2][5][3] = ostei_deriv1_f_d_h_f;
-    simint_osteifunc_array[1][3][2][5][4] = ostei_deriv1_f_d_h_g;
-    simint_osteifunc_array[1][3][2][5][5] = ostei_deriv1_f_d_h_h;
-    simint_osteifunc_array[1][3][3][0][5] = ostei_deriv1_f_f_s_h;
-    simint_osteifunc_array[1][3][3][1][5] = ostei_deriv1_f_f_p_h;
-    simint_osteifunc_array[1][3][3][2][5] = ostei_deriv1_f_f_d_h;
-    simint_osteifunc_array[1][3][3][3][5] = ostei_deriv1_f_f_f_h;
-    simint_osteifunc_array[1][3][3][4][5] = ostei_deriv1_f_f_g_h;
-    simint_osteifunc_array[1][3][3][5][0] = ostei_deriv1_f_f_h_s;
-    simint_osteifunc_array[1][3][3][5][1] = ostei_deriv1_f_f_h_p;
-    simint_osteifunc_array[1][3][3][5][2] = ostei_deriv1_f_f_h_d;
-    simint_osteifunc_array[1][3][3][5][3] = ostei_deriv1_f_f_h_f;
-    simint_osteifunc_array[1][3][3][5][4] = ostei_deriv1_f_f_h_g;
-    simint_osteifunc_array[1][3][3][5][5] = ostei_deriv1_f_f_h_h;
-    simint_osteifunc_array[1][3][4][0][5] = ostei_deriv1_f_g_s_h;
-    simint_osteifunc_array[1][3][4][1][5] = ostei_deriv1_f_g_p_h;
-    simint_osteifunc_array[1][3][4][2][5] = ostei_deriv1_f_g_d_h;
-    simint_osteifunc_array[1][3][4][3][5] = ostei_deriv1_f_g_f_h;
-    simint_osteifunc_array[1][3][4][4][5] = ostei_deriv1_f_g_g_h;
-    simint_osteifunc_array[1][3][4][5][0] = ostei_deriv1_f_g_h_s;
-    simint_osteifunc_array[1][3][4][5][1] = ostei_deriv1_f_g_h_p;
-    simint_osteifunc_array[1][3][4][5][2] = ostei_deriv1_f_g_h_d;
-    simint_osteifunc_array[1][3][4][5][3] = ostei_deriv1_f_g_h_f;
-    simint_osteifunc_array[1][3][4][5][4] = ostei_deriv1_f_g_h_g;
-    simint_osteifunc_array[1][3][4][5][5] = ostei_deriv1_f_g_h_h;
-    simint_osteifunc_array[1][3][5][0][0] = ostei_deriv1_f_h_s_s;
-    simint_osteifunc_array[1][3][5][0][1] = ostei_deriv1_f_h_s_p;
-    simint_osteifunc_array[1][3][5][0][2] = ostei_deriv1_f_h_s_d;
-    simint_osteifunc_array[1][3][5][0][3] = ostei_deriv1_f_h_s_f;
-    simint_osteifunc_array[1][3][5][0][4] = ostei_deriv1_f_h_s_g;
-    simint_osteifunc_array[1][3][5][0][5] = ostei_deriv1_f_h_s_h;
-    simint_osteifunc_array[1][3][5][1][0] = ostei_deriv1_f_h_p_s;
-    simint_osteifunc_array[1][3][5][1][1] = ostei_deriv1_f_h_p_p;
-    simint_osteifunc_array[1][3][5][1][2] = ostei_deriv1_f_h_p_d;
-    simint_osteifunc_array[1][3][5][1][3] = ostei_deriv1_f_h_p_f;
-    simint_osteifunc_array[1][3][5][1][4] = ostei_deriv1_f_h_p_g;
-    simint_osteifunc_array[1][3][5][1][5] = ostei_deriv1_f_h_p_h;
-    simint_osteifunc_array[1][3][5][2][0] = ostei_deriv1_f_h_d_s;
-    simint_osteifunc_array[1][3][5][2][1] = ostei_deriv1_f_h_d_p;
-    simint_osteifunc_array[1][3][5][2][2] = ostei_deriv1_f_h_d_d;
-    simint_osteifunc_array[1][3][5][2][3] = ostei_deriv1_f_h_d_f;
-    simint_osteifunc_array[1][3][5][2][4] = ostei_deriv1_f_h_d_g;
-    simint_osteifunc_array[1][3][5][2][5] = ostei_deriv1_f_h_d_h;
-    simint_osteifunc_array[1][3][5][3][0] = ostei_deriv1_f_h_f_s;
-    simint_osteifunc_array[1][3][5][3][1] = ostei_deriv1_f_h_f_p;
-    simint_osteifunc_array[1][3][5][3][2] = ostei_deriv1_f_h_f_d;
-    simint_osteifunc_array[1][3][5][3][3] = ostei_deriv1_f_h_f_f;
-    simint_osteifunc_array[1][3][5][3][4] = ostei_deriv1_f_h_f_g;
-    simint_osteifunc_array[1][3][5][3][5] = ostei_deriv1_f_h_f_h;
-    simint_osteifunc_array[1][3][5][4][0] = ostei_deriv1_f_h_g_s;
-    simint_osteifunc_array[1][3][5][4][1] = ostei_deriv1_f_h_g_p;
-    simint_osteifunc_array[1][3][5][4][2] = ostei_deriv1_f_h_g_d;
-    simint_osteifunc_array[1][3][5][4][3] = ostei_deriv1_f_h_g_f;
-    simint_osteifunc_array[1][3][5][4][4] = ostei_deriv1_f_h_g_g;
-    simint_osteifunc_array[1][3][5][4][5] = ostei_deriv1_f_h_g_h;
-    simint_osteifunc_array[1][3][5][5][0] = ostei_deriv1_f_h_h_s;
-    simint_osteifunc_array[1][3][5][5][1] = ostei_deriv1_f_h_h_p;
-    simint_osteifunc_array[1][3][5][5][2] = ostei_deriv1_f_h_h_d;
-    simint_osteifunc_array[1][3][5][5][3] = ostei_deriv1_f_h_h_f;
-    simint_osteifunc_array[1][3][5][5][4] = ostei_deriv1_f_h_h_g;
-    simint_osteifunc_array[1][3][5][5][5] = ostei_deriv1_f_h_h_h;
-    simint_osteifunc_array[1][4][0][0][5] = ostei_deriv1_g_s_s_h;
-    simint_osteifunc_array[1][4][0][1][5] = ostei_deriv1_g_s_p_h;
-    simint_osteifunc_array[1][4][0][2][5] = ostei_deriv1_g_s_d_h;
-    simint_osteifunc_array[1][4][0][3][5] = ostei_deriv1_g_s_f_h;
-    simint_osteifunc_array[1][4][0][4][5] = ostei_deriv1_g_s_g_h;
-    simint_osteifunc_array[1][4][0][5][0] = ostei_deriv1_g_s_h_s;
-    simint_osteifunc_array[1][4][0][5][1] = ostei_deriv1_g_s_h_p;
-    simint_osteifunc_array[1][4][0][5][2] = ostei_deriv1_g_s_h_d;
-    simint_osteifunc_array[1][4][0][5][3] = ostei_deriv1_g_s_h_f;
-    simint_osteifunc_array[1][4][0][5][4] = ostei_deriv1_g_s_h_g;
-    simint_osteifunc_array[1][4][0][5][5] = ostei_deriv1_g_s_h_h;
-    simint_osteifunc_array[1][4][1][0][5] = ostei_deriv1_g_p_s_h;
-    simint_osteifunc_array[1][4][1][1][5] = ostei_deriv1_g_p_p_h;
-    simint_osteifunc_array[1][4][1][2][5] = ostei_deriv1_g_p_d_h;
-    simint_osteifunc_array[1][4][1][3][5] = ostei_deriv1_g_p_f_h;
-    simint_osteifunc_array[1][4][1][4][5] = ostei_deriv1_g_p_g_h;
-    simint_osteifunc_array[1][4][1][5][0] = ostei_deriv1_g_p_h_s;
-    simint_osteifunc_array[1][4][1][5][1] = ostei_deriv1_g_p_h_p;
-    simint_osteifunc_array[1][4][1][5][2] = ostei_deriv1_g_p_h_d;
-    simint_osteifunc_array[1][4][1][5][3] = ostei_deriv1_g_p_h_f;
-    simint_osteifunc_array[1][4][1][5][4] = ostei_deriv1_g_p_h_g;
-    simint_osteifunc_array[1][4][1][5][5] = ostei_deriv1_g_p_h_h;
-    simint_osteifunc_array[1][4][2][0][5] = ostei_deriv1_g_d_s_h;
-    simint_osteifunc_array[1][4][2][1][5] = ostei_deriv1_g_d_p_h;
-    simint_osteifunc_array[1][4][2][2][5] = ostei_deriv1_g_d_d_h;
-    simint_osteifunc_array[1][4][2][3][5] = ostei_deriv1_g_d_f_h;
-    simint_osteifunc_array[1][4][2][4][5] = ostei_deriv1_g_d_g_h;
-    simint_osteifunc_array[1][4][2][5][0] = ostei_deriv1_g_d_h_s;
-    simint_osteifunc_array[1][4][2][5][1] = ostei_deriv1_g_d_h_p;
-    simint_osteifunc_array[1][4][2][5][2] = ostei_deriv1_g_d_h_d;
-    simint_osteifunc_array[1][4][2][5][3] = ostei_deriv1_g_d_h_f;
-    simint_osteifunc_array[1][4][2][5][4] = ostei_deriv1_g_d_h_g;
-    simint_osteifunc_array[1][4][2][5][5] = ostei_deriv1_g_d_h_h;
-    simint_osteifunc_array[1][4][3][0][5] = ostei_deriv1_g_f_s_h;
-    simint_osteifunc_array[1][4][3][1][5] = ostei_deriv1_g_f_p_h;
-    simint_osteifunc_array[1][4][3][2][5] = ostei_deriv1_g_f_d_h;
-    simint_osteifunc_array[1][4][3][3][5] = ostei_deriv1_g_f_f_h;
-    simint_osteifunc_array[1][4][3][4][5] = ostei_deriv1_g_f_g_h;
-    simint_osteifunc_array[1][4][3][5][0] = ostei_deriv1_g_f_h_s;
-    simint_osteifunc_array[1][4][3][5][1] = ostei_deriv1_g_f_h_p;
-    simint_osteifunc_array[1][4][3][5][2] = ostei_deriv1_g_f_h_d;
-    simint_osteifunc_array[1][4][3][5][3] = ostei_deriv1_g_f_h_f;
-    simint_osteifunc_array[1][4][3][5][4] = ostei_deriv1_g_f_h_g;
-    simint_osteifunc_array[1][4][3][5][5] = ostei_deriv1_g_f_h_h;
-    simint_osteifunc_array[1][4][4][0][5] = ostei_deriv1_g_g_s_h;
-    simint_osteifunc_array[1][4][4][1][5] = ostei_deriv1_g_g_p_h;
-    simint_osteifunc_array[1][4][4][2][5] = ostei_deriv1_g_g_d_h;
-    simint_osteifunc_array[1][4][4][3][5] = ostei_deriv1_g_g_f_h;
-    simint_osteifunc_array[1][4][4][4][5] = ostei_deriv1_g_g_g_h;
-    simint_osteifunc_array[1][4][4][5][0] = ostei_deriv1_g_g_h_s;
-    simint_osteifunc_array[1][4][4][5][1] = ostei_deriv1_g_g_h_p;
-    simint_osteifunc_array[1][4][4][5][2] = ostei_deriv1_g_g_h_d;
-    simint_osteifunc_array[1][4][4][5][3] = ostei_deriv1_g_g_h_f;
-    simint_osteifunc_array[1][4][4][5][4] = ostei_deriv1_g_g_h_g;
-    simint_osteifunc_array[1][4][4][5][5] = ostei_deriv1_g_g_h_h;
-    simint_osteifunc_array[1][4][5][0][0] = ostei_deriv1_g_h_s_s;
-    simint_osteifunc_array[1][4][5][0][1] = ostei_deriv1_g_h_s_p;
-    simint_osteifunc_array[1][4][5][0][2] = ostei_deriv1_g_h_s_d;
-    simint_osteifunc_array[1][4][5][0][3] = ostei_deriv1_g_h_s_f;
-    simint_osteifunc_array[1][4][5][0][4] = ostei_deriv1_g_h_s_g;
-    simint_osteifunc_array[1][4][5][0][5] = ostei_deriv1_g_h_s_h;
-    simint_osteifunc_array[1][4][5][1][0] = ostei_deriv1_g_h_p_s;
-    simint_osteifunc_array[1][4][5][1][1] = ostei_deriv1_g_h_p_p;
-    simint_osteifunc_array[1][4][5][1][2] = ostei_deriv1_g_h_p_d;
-    simint_osteifunc_array[1][4][5][1][3] = ostei_deriv1_g_h_p_f;
-    simint_osteifunc_array[1][4][5][1][4] = ostei_deriv1_g_h_p_g;
-    simint_osteifunc_array[1][4][5][1][5] = ostei_deriv1_g_h_p_h;
-    simint_osteifunc_array[1][4][5][2][0] = ostei_deriv1_g_h_d_s;
-    simint_osteifunc_array[1][4][5][2][1] = ostei_deriv1_g_h_d_p;
-    simint_osteifunc_array[1][4][5][2][2] = ostei_deriv1_g_h_d_d;
-    simint_osteifunc_array[1][4][5][2][3] = ostei_deriv1_g_h_d_f;
-    simint_osteifunc_array[1][4][5][2][4] = ostei_deriv1_g_h_d_g;
-    simint_osteifunc_array[1][4][5][2][5] = ostei_deriv1_g_h_d_h;
-    simint_osteifunc_array[1][4][5][3][0] = ostei_deriv1_g_h_f_s;
-    simint_osteifunc_array[1][4][5][3][1] = ostei_deriv1_g_h_f_p;
-    simint_osteifunc_array[1][4][5][3][2] = ostei_deriv1_g_h_f_d;
-    simint_osteifunc_array[1][4][5][3][3] = ostei_deriv1_g_h_f_f;
-    simint_osteifunc_array[1][4][5][3][4] = ostei_deriv1_g_h_f_g;
-    simint_osteifunc_array[1][4][5][3][5] = ostei_deriv1_g_h_f_h;
-    simint_osteifunc_array[1][4][5][4][0] = ostei_deriv1_g_h_g_s;
-    simint_osteifunc_array[1][4][5][4][1] = ostei_deriv1_g_h_g_p;
-    simint_osteifunc_array[1][4][5][4][2] = ostei_deriv1_g_h_g_d;
-    simint_osteifunc_array[1][4][5][4][3] = ostei_deriv1_g_h_g_f;
-    simint_osteifunc_array[1][4][5][4][4] = ostei_deriv1_g_h_g_g;
-    simint_osteifunc_array[1][4][5][4][5] = ostei_deriv1_g_h_g_h;
-    simint_osteifunc_array[1][4][5][5][0] = ostei_deriv1_g_h_h_s;
-    simint_osteifunc_array[1][4][5][5][1] = ostei_deriv1_g_h_h_p;
-    simint_osteifunc_array[1][4][5][5][2] = ostei_deriv1_g_h_h_d;
-    simint_osteifunc_array[1][4][5][5][3] = ostei_deriv1_g_h_h_f;
-    simint_osteifunc_array[1][4][5][5][4] = ostei_deriv1_g_h_h_g;
-    simint_osteifunc_array[1][4][5][5][5] = ostei_deriv1_g_h_h_h;
-    simint_osteifunc_array[1][5][0][0][0] = ostei_deriv1_h_s_s_s;
-    simint_osteifunc_array[1][5][0][0][1] = ostei_deriv1_h_s_s_p;
-    simint_osteifunc_array[1][5][0][0][2] = ostei_deriv1_h_s_s_d;
-    simint_osteifunc_array[1][5][0][0][3] = ostei_deriv1_h_s_s_f;
-    simint_osteifunc_array[1][5][0][0][4] = ostei_deriv1_h_s_s_g;
-    simint_osteifunc_array[1][5][0][0][5] = ostei_deriv1_h_s_s_h;
-    simint_osteifunc_array[1][5][0][1][0] = ostei_deriv1_h_s_p_s;
-    simint_osteifunc_array[1][5][0][1][1] = ostei_deriv1_h_s_p_p;
-    simint_osteifunc_array[1][5][0][1][2] = ostei_deriv1_h_s_p_d;
-    simint_osteifunc_array[1][5][0][1][3] = ostei_deriv1_h_s_p_f;
-    simint_osteifunc_array[1][5][0][1][4] = ostei_deriv1_h_s_p_g;
-    simint_osteifunc_array[1][5][0][1][5] = ostei_deriv1_h_s_p_h;
-    simint_osteifunc_array[1][5][0][2][0] = ostei_deriv1_h_s_d_s;
-    simint_osteifunc_array[1][5][0][2][1] = ostei_deriv1_h_s_d_p;
-    simint_osteifunc_array[1][5][0][2][2] = ostei_deriv1_h_s_d_d;
-    simint_osteifunc_array[1][5][0][2][3] = ostei_deriv1_h_s_d_f;
-    simint_osteifunc_array[1][5][0][2][4] = ostei_deriv1_h_s_d_g;
-    simint_osteifunc_array[1][5][0][2][5] = ostei_deriv1_h_s_d_h;
-    simint_osteifunc_array[1][5][0][3][0] = ostei_deriv1_h_s_f_s;
-    simint_osteifunc_array[1][5][0][3][1] = ostei_deriv1_h_s_f_p;
-    simint_osteifunc_array[1][5][0][3][2] = ostei_deriv1_h_s_f_d;
-    simint_osteifunc_array[1][5][0][3][3] = ostei_deriv1_h_s_f_f;
-    simint_osteifunc_array[1][5][0][3][4] = ostei_deriv1_h_s_f_g;
-    simint_osteifunc_array[1][5][0][3][5] = ostei_deriv1_h_s_f_h;
-    simint_osteifunc_array[1][5][0][4][0] = ostei_deriv1_h_s_g_s;
-    simint_osteifunc_array[1][5][0][4][1] = ostei_deriv1_h_s_g_p;
-    simint_osteifunc_array[1][5][0][4][2] = ostei_deriv1_h_s_g_d;
-    simint_osteifunc_array[1][5][0][4][3] = ostei_deriv1_h_s_g_f;
-    simint_osteifunc_array[1][5][0][4][4] = ostei_deriv1_h_s_g_g;
-    simint_osteifunc_array[1][5][0][4][5] = ostei_deriv1_h_s_g_h;
-    simint_osteifunc_array[1][5][0][5][0] = ostei_deriv1_h_s_h_s;
-    simint_osteifunc_array[1][5][0][5][1] = ostei_deriv1_h_s_h_p;
-    simint_osteifunc_array[1][5][0][5][2] = ostei_deriv1_h_s_h_d;
-    simint_osteifunc_array[1][5][0][5][3] = ostei_deriv1_h_s_h_f;
-    simint_osteifunc_array[1][5][0][5][4] = ostei_deriv1_h_s_h_g;
-    simint_osteifunc_array[1][5][0][5][5] = ostei_deriv1_h_s_h_h;
-    simint_osteifunc_array[1][5][1][0][0] = ostei_deriv1_h_p_s_s;
-    simint_osteifunc_array[1][5][1][0][1] = ostei_deriv1_h_p_s_p;
-    simint_osteifunc_array[1][5][1][0][2] = ostei_deriv1_h_p_s_d;
-    simint_osteifunc_array[1][5][1][0][3] = ostei_deriv1_h_p_s_f;
-    simint_osteifunc_array[1][5][1][0][4] = ostei_deriv1_h_p_s_g;
-    simint_osteifunc_array[1][5][1][0][5] = ostei_deriv1_h_p_s_h;
-    simint_osteifunc_array[1][5][1][1][0] = ostei_deriv1_h_p_p_s;
-    simint_osteifunc_array[1][5][1][1][1] = ostei_deriv1_h_p_p_p;
-    simint_osteifunc_array[1][5][1][1][2] = ostei_deriv1_h_p_p_d;
-    simint_osteifunc_array[1][5][1][1][3] = ostei_deriv1_h_p_p_f;
-    simint_osteifunc_array[1][5][1][1][4] = ostei_deriv1_h_p_p_g;
-    simint_osteifunc_array[1][5][1][1][5] = ostei_deriv1_h_p_p_h;
-    simint_osteifunc_array[1][5][1][2][0] = ostei_deriv1_h_p_d_s;
-    simint_osteifunc_array[1][5][1][2][1] = ostei_deriv1_h_p_d_p;
-    simint_osteifunc_array[1][5][1][2][2] = ostei_deriv1_h_p_d_d;
-    simint_osteifunc_array[1][5][1][2][3] = ostei_deriv1_h_p_d_f;
-    simint_osteifunc_array[1][5][1][2][4] = ostei_deriv1_h_p_d_g;
-    simint_osteifunc_array[1][5][1][2][5] = ostei_deriv1_h_p_d_h;
-    simint_osteifunc_array[1][5][1][3][0] = ostei_deriv1_h_p_f_s;
-    simint_osteifunc_array[1][5][1][3][1] = ostei_deriv1_h_p_f_p;
-    simint_osteifunc_array[1][5][1][3][2] = ostei_deriv1_h_p_f_d;
-    simint_osteifunc_array[1][5][1][3][3] = ostei_deriv1_h_p_f_f;
-    simint_osteifunc_array[1][5][1][3][4] = ostei_deriv1_h_p_f_g;
-    simint_osteifunc_array[1][5][1][3][5] = ostei_deriv1_h_p_f_h;
-    simint_osteifunc_array[1][5][1][4][0] = ostei_deriv1_h_p_g_s;
-    simint_osteifunc_array[1][5][1][4][1] = ostei_deriv1_h_p_g_p;
-    simint_osteifunc_array[1][5][1][4][2] = ostei_deriv1_h_p_g_d;
-    simint_osteifunc_array[1][5][1][4][3] = ostei_deriv1_h_p_g_f;
-    simint_osteifunc_array[1][5][1][4][4] = ostei_deriv1_h_p_g_g;
-    simint_osteifunc_array[1][5][1][4][5] = ostei_deriv1_h_p_g_h;
-    simint_osteifunc_array[1][5][1][5][0] = ostei_deriv1_h_p_h_s;
-    simint_osteifunc_array[1][5][1][5][1] = ostei_deriv1_h_p_h_p;
-    simint_osteifunc_array[1][5][1][5][2] = ostei_deriv1_h_p_h_d;
-    simint_osteifunc_array[1][5][1][5][3] = ostei_deriv1_h_p_h_f;
-    simint_osteifunc_array[1][5][1][5][4] = ostei_deriv1_h_p_h_g;
-    simint_osteifunc_array[1][5][1][5][5] = ostei_deriv1_h_p_h_h;
-    simint_osteifunc_array[1][5][2][0][0] = ostei_deriv1_h_d_s_s;
-    simint_osteifunc_array[1][5][2][0][1] = ostei_deriv1_h_d_s_p;
-    simint_osteifunc_array[1][5][2][0][2] = ostei_deriv1_h_d_s_d;
-    simint_osteifunc_array[1][5][2][0][3] = ostei_deriv1_h_d_s_f;
-    simint_osteifunc_array[1][5][2][0][4] = ostei_deriv1_h_d_s_g;
-    simint_osteifunc_array[1][5][2][0][5] = ostei_deriv1_h_d_s_h;
-    simint_osteifunc_array[1][5][2][1][0] = ostei_deriv1_h_d_p_s;
-    simint_osteifunc_array[1][5][2][1][1] = ostei_deriv1_h_d_p_p;
-    simint_osteifunc_array[1][5][2][1][2] = ostei_deriv1_h_d_p_d;
-    simint_osteifunc_array[1][5][2][1][3] = ostei_deriv1_h_d_p_f;
-    simint_osteifunc_array[1][5][2][1][4] = ostei_deriv1_h_d_p_g;
-    simint_osteifunc_array[1][5][2][1][5] = ostei_deriv1_h_d_p_h;
-    simint_osteifunc_array[1][5][2][2][0] = ostei_deriv1_h_d_d_s;
-    simint_osteifunc_array[1][5][2][2][1] = ostei_deriv1_h_d_d_p;
-    simint_osteifunc_array[1][5][2][2][2] = ostei_deriv1_h_d_d_d;
-    simint_osteifunc_array[1][5][2][2][3] = ostei_deriv1_h_d_d_f;
-    simint_osteifunc_array[1][5][2][2][4] = ostei_deriv1_h_d_d_g;
-    simint_osteifunc_array[1][5][2][2][5] = ostei_deriv1_h_d_d_h;
-    simint_osteifunc_array[1][5][2][3][0] = ostei_deriv1_h_d_f_s;
-    simint_osteifunc_array[1][5][2][3][1] = ostei_deriv1_h_d_f_p;
-    simint_osteifunc_array[1][5][2][3][2] = ostei_deriv1_h_d_f_d;
-    simint_osteifunc_array[1][5][2][3][3] = ostei_deriv1_h_d_f_f;
-    simint_osteifunc_array[1][5][2][3][4] = ostei_deriv1_h_d_f_g;
-    simint_osteifunc_array[1][5][2][3][5] = ostei_deriv1_h_d_f_h;
-    simint_osteifunc_array[1][5][2][4][0] = ostei_deriv1_h_d_g_s;
-    simint_osteifunc_array[1][5][2][4][1] = ostei_deriv1_h_d_g_p;
-    simint_osteifunc_array[1][5][2][4][2] = ostei_deriv1_h_d_g_d;
-    simint_osteifunc_array[1][5][2][4][3] = ostei_deriv1_h_d_g_f;
-    simint_osteifunc_array[1][5][2][4][4] = ostei_deriv1_h_d_g_g;
-    simint_osteifunc_array[1][5][2][4][5] = ostei_deriv1_h_d_g_h;
-    simint_osteifunc_array[1][5][2][5][0] = ostei_deriv1_h_d_h_s;
-    simint_osteifunc_array[1][5][2][5][1] = ostei_deriv1_h_d_h_p;
-    simint_osteifunc_array[1][5][2][5][2] = ostei_deriv1_h_d_h_d;
-    simint_osteifunc_array[1][5][2][5][3] = ostei_deriv1_h_d_h_f;
-    simint_osteifunc_array[1][5][2][5][4] = ostei_deriv1_h_d_h_g;
-    simint_osteifunc_array[1][5][2][5][5] = ostei_deriv1_h_d_h_h;
-    simint_osteifunc_array[1][5][3][0][0] = ostei_deriv1_h_f_s_s;
-    simint_osteifunc_array[1][5][3][0][1] = ostei_deriv1_h_f_s_p;
-    simint_osteifunc_array[1][5][3][0][2] = ostei_deriv1_h_f_s_d;
-    simint_osteifunc_array[1][5][3][0][3] = ostei_deriv1_h_f_s_f;
-    simint_osteifunc_array[1][5][3][0][4] = ostei_deriv1_h_f_s_g;
-    simint_osteifunc_array[1][5][3][0][5] = ostei_deriv1_h_f_s_h;
-    simint_osteifunc_array[1][5][3][1][0] = ostei_deriv1_h_f_p_s;
-    simint_osteifunc_array[1][5][3][1][1] = ostei_deriv1_h_f_p_p;
-    simint_osteifunc_array[1][5][3][1][2] = ostei_deriv1_h_f_p_d;
-    simint_osteifunc_array[1][5][3][1][3] = ostei_deriv1_h_f_p_f;
-    simint_osteifunc_array[1][5][3][1][4] = ostei_deriv1_h_f_p_g;
-    simint_osteifunc_array[1][5][3][1][5] = ostei_deriv1_h_f_p_h;
-    simint_osteifunc_array[1][5][3][2][0] = ostei_deriv1_h_f_d_s;
-    simint_osteifunc_array[1][5][3][2][1] = ostei_deriv1_h_f_d_p;
-    simint_osteifunc_array[1][5][3][2][2] = ostei_deriv1_h_f_d_d;
-    simint_osteifunc_array[1][5][3][2][3] = ostei_deriv1_h_f_d_f;
-    simint_osteifunc_array[1][5][3][2][4] = ostei_deriv1_h_f_d_g;
-    simint_osteifunc_array[1][5][3][2][5] = ostei_deriv1_h_f_d_h;
-    simint_osteifunc_array[1][5][3][3][0] = ostei_deriv1_h_f_f_s;
-    simint_osteifunc_array[1][5][3][3][1] = ostei_deriv1_h_f_f_p;
-    simint_osteifunc_array[1][5][3][3][2] = ostei_deriv1_h_f_f_d;
-    simint_osteifunc_array[1][5][3][3][3] = ostei_deriv1_h_f_f_f;
-    simint_osteifunc_array[1][5][3][3][4] = ostei_deriv1_h_f_f_g;
-    simint_osteifunc_array[1][5][3][3][5] = ostei_deriv1_h_f_f_h;
-    simint_osteifunc_array[1][5][3][4][0] = ostei_deriv1_h_f_g_s;
-    simint_osteifunc_array[1][5][3][4][1] = ostei_deriv1_h_f_g_p;
-    simint_osteifunc_array[1][5][3][4][2] = ostei_deriv1_h_f_g_d;
-    simint_osteifunc_array[1][5][3][4][3] = ostei_deriv1_h_f_g_f;
-    simint_osteifunc_array[1][5][3][4][4] = ostei_deriv1_h_f_g_g;
-    simint_osteifunc_array[1][5][3][4][5] = ostei_deriv1_h_f_g_h;
-    simint_osteifunc_array[1][5][3][5][0] = ostei_deriv1_h_f_h_s;
-    simint_osteifunc_array[1][5][3][5][1] = ostei_deriv1_h_f_h_p;
-    simint_osteifunc_array[1][5][3][5][2] = ostei_deriv1_h_f_h_d;
-    simint_osteifunc_array[1][5][3][5][3] = ostei_deriv1_h_f_h_f;
-    simint_osteifunc_array[1][5][3][5][4] = ostei_deriv1_h_f_h_g;
-    simint_osteifunc_array[1][5][3][5][5] = ostei_deriv1_h_f_h_h;
-    simint_osteifunc_array[1][5][4][0][0] = ostei_deriv1_h_g_s_s;
-    simint_osteifunc_array[1][5][4][0][1] = ostei_deriv1_h_g_s_p;
-    simint_osteifunc_array[1][5][4][0][2] = ostei_deriv1_h_g_s_d;
-    simint_osteifunc_array[1][5][4][0][3] = ostei_deriv1_h_g_s_f;
-    simint_osteifunc_array[1][5][4][0][4] = ostei_deriv1_h_g_s_g;
-    simint_osteifunc_array[1][5][4][0][5] = ostei_deriv1_h_g_s_h;
-    simint_osteifunc_array[1][5][4][1][0] = ostei_deriv1_h_g_p_s;
-    simint_osteifunc_array[1][5][4][1][1] = ostei_deriv1_h_g_p_p;
-    simint_osteifunc_array[1][5][4][1][2] = ostei_deriv1_h_g_p_d;
-    simint_osteifunc_array[1][5][4][1][3] = ostei_deriv1_h_g_p_f;
-    simint_osteifunc_array[1][5][4][1][4] = ostei_deriv1_h_g_p_g;
-    simint_osteifunc_array[1][5][4][1][5] = ostei_deriv1_h_g_p_h;
-    simint_osteifunc_array[1][5][4][2][0] = ostei_deriv1_h_g_d_s;
-    simint_osteifunc_array[1][5][4][2][1] = ostei_deriv1_h_g_d_p;
-    simint_osteifunc_array[1][5][4][2][2] = ostei_deriv1_h_g_d_d;
-    simint_osteifunc_array[1][5][4][2][3] = ostei_deriv1_h_g_d_f;
-    simint_osteifunc_array[1][5][4][2][4] = ostei_deriv1_h_g_d_g;
-    simint_osteifunc_array[1][5][4][2][5] = ostei_deriv1_h_g_d_h;
-    simint_osteifunc_array[1][5][4][3][0] = ostei_deriv1_h_g_f_s;
-    simint_osteifunc_array[1][5][4][3][1] = ostei_deriv1_h_g_f_p;
-    simint_osteifunc_array[1][5][4][3][2] = ostei_deriv1_h_g_f_d;
-    simint_osteifunc_array[1][5][4][3][3] = ostei_deriv1_h_g_f_f;
-    simint_osteifunc_array[1][5][4][3][4] = ostei_deriv1_h_g_f_g;
-    simint_osteifunc_array[1][5][4][3][5] = ostei_deriv1_h_g_f_h;
-    simint_osteifunc_array[1][5][4][4][0] = ostei_deriv1_h_g_g_s;
-    simint_osteifunc_array[1][5][4][4][1] = ostei_deriv1_h_g_g_p;
-    simint_osteifunc_array[1][5][4][4][2] = ostei_deriv1_h_g_g_d;
-    simint_osteifunc_array[1][5][4][4][3] = ostei_deriv1_h_g_g_f;
-    simint_osteifunc_array[1][5][4][4][4] = ostei_deriv1_h_g_g_g;
-    simint_osteifunc_array[1][5][4][4][5] = ostei_deriv1_h_g_g_h;
-    simint_osteifunc_array[1][5][4][5][0] = ostei_deriv1_h_g_h_s;
-    simint_osteifunc_array[1][5][4][5][1] = ostei_deriv1_h_g_h_p;
-    simint_osteifunc_array[1][5][4][5][2] = ostei_deriv1_h_g_h_d;
-    simint_osteifunc_array[1][5][4][5][3] = ostei_deriv1_h_g_h_f;
-    simint_osteifunc_array[1][5][4][5][4] = ostei_deriv1_h_g_h_g;
-    simint_osteifunc_array[1][5][4][5][5] = ostei_deriv1_h_g_h_h;
-    simint_osteifunc_array[1][5][5][0][0] = ostei_deriv1_h_h_s_s;
-    simint_osteifunc_array[1][5][5][0][1] = ostei_deriv1_h_h_s_p;
-    simint_osteifunc_array[1][5][5][0][2] = ostei_deriv1_h_h_s_d;
-    simint_osteifunc_array[1][5][5][0][3] = ostei_deriv1_h_h_s_f;
-    simint_osteifunc_array[1][5][5][0][4] = ostei_deriv1_h_h_s_g;
-    simint_osteifunc_array[1][5][5][0][5] = ostei_deriv1_h_h_s_h;
-    simint_osteifunc_array[1][5][5][1][0] = ostei_deriv1_h_h_p_s;
-    simint_osteifunc_array[1][5][5][1][1] = ostei_deriv1_h_h_p_p;
-    simint_osteifunc_array[1][5][5][1][2] = ostei_deriv1_h_h_p_d;
-    simint_osteifunc_array[1][5][5][1][3] = ostei_deriv1_h_h_p_f;
-    simint_osteifunc_array[1][5][5][1][4] = ostei_deriv1_h_h_p_g;
-    simint_osteifunc_array[1][5][5][1][5] = ostei_deriv1_h_h_p_h;
-    simint_osteifunc_array[1][5][5][2][0] = ostei_deriv1_h_h_d_s;
-    simint_osteifunc_array[1][5][5][2][1] = ostei_deriv1_h_h_d_p;
-    simint_osteifunc_array[1][5][5][2][2] = ostei_deriv1_h_h_d_d;
-    simint_osteifunc_array[1][5][5][2][3] = ostei_deriv1_h_h_d_f;
-    simint_osteifunc_array[1][5][5][2][4] = ostei_deriv1_h_h_d_g;
-    simint_osteifunc_array[1][5][5][2][5] = ostei_deriv1_h_h_d_h;
-    simint_osteifunc_array[1][5][5][3][0] = ostei_deriv1_h_h_f_s;
-    simint_osteifunc_array[1][5][5][3][1] = ostei_deriv1_h_h_f_p;
-    simint_osteifunc_array[1][5][5][3][2] = ostei_deriv1_h_h_f_d;
-    simint_osteifunc_array[1][5][5][3][3] = ostei_deriv1_h_h_f_f;
-    simint_osteifunc_array[1][5][5][3][4] = ostei_deriv1_h_h_f_g;
-    simint_osteifunc_array[1][5][5][3][5] = ostei_deriv1_h_h_f_h;
-    simint_osteifunc_array[1][5][5][4][0] = ostei_deriv1_h_h_g_s;
-    simint_osteifunc_array[1][5][5][4][1] = ostei_deriv1_h_h_g_p;
-    simint_osteifunc_array[1][5][5][4][2] = ostei_deriv1_h_h_g_d;
-    simint_osteifunc_array[1][5][5][4][3] = ostei_deriv1_h_h_g_f;
-    simint_osteifunc_array[1][5][5][4][4] = ostei_deriv1_h_h_g_g;
-    simint_osteifunc_array[1][5][5][4][5] = ostei_deriv1_h_h_g_h;
-    simint_osteifunc_array[1][5][5][5][0] = ostei_deriv1_h_h_h_s;
-    simint_osteifunc_array[1][5][5][5][1] = ostei_deriv1_h_h_h_p;
-    simint_osteifunc_array[1][5][5][5][2] = ostei_deriv1_h_h_h_d;
-    simint_osteifunc_array[1][5][5][5][3] = ostei_deriv1_h_h_h_f;
-    simint_osteifunc_array[1][5][5][5][4] = ostei_deriv1_h_h_h_g;
-    simint_osteifunc_array[1][5][5][5][5] = ostei_deriv1_h_h_h_h;
+    simint_osteifunc_array[1][0][0][0][5] = ostei_deriv1_s_s_s_h_ptr;
+    simint_osteifunc_array[1][0][0][1][5] = ostei_deriv1_s_s_p_h_ptr;
+    simint_osteifunc_array[1][0][0][2][5] = ostei_deriv1_s_s_d_h_ptr;
+    simint_osteifunc_array[1][0][0][3][5] = ostei_deriv1_s_s_f_h_ptr;
+    simint_osteifunc_array[1][0][0][4][5] = ostei_deriv1_s_s_g_h_ptr;
+    simint_osteifunc_array[1][0][0][5][0] = ostei_deriv1_s_s_h_s_ptr;
+    simint_osteifunc_array[1][0][0][5][1] = ostei_deriv1_s_s_h_p_ptr;
+    simint_osteifunc_array[1][0][0][5][2] = ostei_deriv1_s_s_h_d_ptr;
+    simint_osteifunc_array[1][0][0][5][3] = ostei_deriv1_s_s_h_f_ptr;
+    simint_osteifunc_array[1][0][0][5][4] = ostei_deriv1_s_s_h_g_ptr;
+    simint_osteifunc_array[1][0][0][5][5] = ostei_deriv1_s_s_h_h_ptr;
+    simint_osteifunc_array[1][0][1][0][5] = ostei_deriv1_s_p_s_h_ptr;
+    simint_osteifunc_array[1][0][1][1][5] = ostei_deriv1_s_p_p_h_ptr;
+    simint_osteifunc_array[1][0][1][2][5] = ostei_deriv1_s_p_d_h_ptr;
+    simint_osteifunc_array[1][0][1][3][5] = ostei_deriv1_s_p_f_h_ptr;
+    simint_osteifunc_array[1][0][1][4][5] = ostei_deriv1_s_p_g_h_ptr;
+    simint_osteifunc_array[1][0][1][5][0] = ostei_deriv1_s_p_h_s_ptr;
+    simint_osteifunc_array[1][0][1][5][1] = ostei_deriv1_s_p_h_p_ptr;
+    simint_osteifunc_array[1][0][1][5][2] = ostei_deriv1_s_p_h_d_ptr;
+    simint_osteifunc_array[1][0][1][5][3] = ostei_deriv1_s_p_h_f_ptr;
+    simint_osteifunc_array[1][0][1][5][4] = ostei_deriv1_s_p_h_g_ptr;
+    simint_osteifunc_array[1][0][1][5][5] = ostei_deriv1_s_p_h_h_ptr;
+    simint_osteifunc_array[1][0][2][0][5] = ostei_deriv1_s_d_s_h_ptr;
+    simint_osteifunc_array[1][0][2][1][5] = ostei_deriv1_s_d_p_h_ptr;
+    simint_osteifunc_array[1][0][2][2][5] = ostei_deriv1_s_d_d_h_ptr;
+    simint_osteifunc_array[1][0][2][3][5] = ostei_deriv1_s_d_f_h_ptr;
+    simint_osteifunc_array[1][0][2][4][5] = ostei_deriv1_s_d_g_h_ptr;
+    simint_osteifunc_array[1][0][2][5][0] = ostei_deriv1_s_d_h_s_ptr;
+    simint_osteifunc_array[1][0][2][5][1] = ostei_deriv1_s_d_h_p_ptr;
+    simint_osteifunc_array[1][0][2][5][2] = ostei_deriv1_s_d_h_d_ptr;
+    simint_osteifunc_array[1][0][2][5][3] = ostei_deriv1_s_d_h_f_ptr;
+    simint_osteifunc_array[1][0][2][5][4] = ostei_deriv1_s_d_h_g_ptr;
+    simint_osteifunc_array[1][0][2][5][5] = ostei_deriv1_s_d_h_h_ptr;
+    simint_osteifunc_array[1][0][3][0][5] = ostei_deriv1_s_f_s_h_ptr;
+    simint_osteifunc_array[1][0][3][1][5] = ostei_deriv1_s_f_p_h_ptr;
+    simint_osteifunc_array[1][0][3][2][5] = ostei_deriv1_s_f_d_h_ptr;
+    simint_osteifunc_array[1][0][3][3][5] = ostei_deriv1_s_f_f_h_ptr;
+    simint_osteifunc_array[1][0][3][4][5] = ostei_deriv1_s_f_g_h_ptr;
+    simint_osteifunc_array[1][0][3][5][0] = ostei_deriv1_s_f_h_s_ptr;
+    simint_osteifunc_array[1][0][3][5][1] = ostei_deriv1_s_f_h_p_ptr;
+    simint_osteifunc_array[1][0][3][5][2] = ostei_deriv1_s_f_h_d_ptr;
+    simint_osteifunc_array[1][0][3][5][3] = ostei_deriv1_s_f_h_f_ptr;
+    simint_osteifunc_array[1][0][3][5][4] = ostei_deriv1_s_f_h_g_ptr;
+    simint_osteifunc_array[1][0][3][5][5] = ostei_deriv1_s_f_h_h_ptr;
+    simint_osteifunc_array[1][0][4][0][5] = ostei_deriv1_s_g_s_h_ptr;
+    simint_osteifunc_array[1][0][4][1][5] = ostei_deriv1_s_g_p_h_ptr;
+    simint_osteifunc_array[1][0][4][2][5] = ostei_deriv1_s_g_d_h_ptr;
+    simint_osteifunc_array[1][0][4][3][5] = ostei_deriv1_s_g_f_h_ptr;
+    simint_osteifunc_array[1][0][4][4][5] = ostei_deriv1_s_g_g_h_ptr;
+    simint_osteifunc_array[1][0][4][5][0] = ostei_deriv1_s_g_h_s_ptr;
+    simint_osteifunc_array[1][0][4][5][1] = ostei_deriv1_s_g_h_p_ptr;
+    simint_osteifunc_array[1][0][4][5][2] = ostei_deriv1_s_g_h_d_ptr;
+    simint_osteifunc_array[1][0][4][5][3] = ostei_deriv1_s_g_h_f_ptr;
+    simint_osteifunc_array[1][0][4][5][4] = ostei_deriv1_s_g_h_g_ptr;
+    simint_osteifunc_array[1][0][4][5][5] = ostei_deriv1_s_g_h_h_ptr;
+    simint_osteifunc_array[1][0][5][0][0] = ostei_deriv1_s_h_s_s_ptr;
+    simint_osteifunc_array[1][0][5][0][1] = ostei_deriv1_s_h_s_p_ptr;
+    simint_osteifunc_array[1][0][5][0][2] = ostei_deriv1_s_h_s_d_ptr;
+    simint_osteifunc_array[1][0][5][0][3] = ostei_deriv1_s_h_s_f_ptr;
+    simint_osteifunc_array[1][0][5][0][4] = ostei_deriv1_s_h_s_g_ptr;
+    simint_osteifunc_array[1][0][5][0][5] = ostei_deriv1_s_h_s_h_ptr;
+    simint_osteifunc_array[1][0][5][1][0] = ostei_deriv1_s_h_p_s_ptr;
+    simint_osteifunc_array[1][0][5][1][1] = ostei_deriv1_s_h_p_p_ptr;
+    simint_osteifunc_array[1][0][5][1][2] = ostei_deriv1_s_h_p_d_ptr;
+    simint_osteifunc_array[1][0][5][1][3] = ostei_deriv1_s_h_p_f_ptr;
+    simint_osteifunc_array[1][0][5][1][4] = ostei_deriv1_s_h_p_g_ptr;
+    simint_osteifunc_array[1][0][5][1][5] = ostei_deriv1_s_h_p_h_ptr;
+    simint_osteifunc_array[1][0][5][2][0] = ostei_deriv1_s_h_d_s_ptr;
+    simint_osteifunc_array[1][0][5][2][1] = ostei_deriv1_s_h_d_p_ptr;
+    simint_osteifunc_array[1][0][5][2][2] = ostei_deriv1_s_h_d_d_ptr;
+    simint_osteifunc_array[1][0][5][2][3] = ostei_deriv1_s_h_d_f_ptr;
+    simint_osteifunc_array[1][0][5][2][4] = ostei_deriv1_s_h_d_g_ptr;
+    simint_osteifunc_array[1][0][5][2][5] = ostei_deriv1_s_h_d_h_ptr;
+    simint_osteifunc_array[1][0][5][3][0] = ostei_deriv1_s_h_f_s_ptr;
+    simint_osteifunc_array[1][0][5][3][1] = ostei_deriv1_s_h_f_p_ptr;
+    simint_osteifunc_array[1][0][5][3][2] = ostei_deriv1_s_h_f_d_ptr;
+    simint_osteifunc_array[1][0][5][3][3] = ostei_deriv1_s_h_f_f_ptr;
+    simint_osteifunc_array[1][0][5][3][4] = ostei_deriv1_s_h_f_g_ptr;
+    simint_osteifunc_array[1][0][5][3][5] = ostei_deriv1_s_h_f_h_ptr;
+    simint_osteifunc_array[1][0][5][4][0] = ostei_deriv1_s_h_g_s_ptr;
+    simint_osteifunc_array[1][0][5][4][1] = ostei_deriv1_s_h_g_p_ptr;
+    simint_osteifunc_array[1][0][5][4][2] = ostei_deriv1_s_h_g_d_ptr;
+    simint_osteifunc_array[1][0][5][4][3] = ostei_deriv1_s_h_g_f_ptr;
+    simint_osteifunc_array[1][0][5][4][4] = ostei_deriv1_s_h_g_g_ptr;
+    simint_osteifunc_array[1][0][5][4][5] = ostei_deriv1_s_h_g_h_ptr;
+    simint_osteifunc_array[1][0][5][5][0] = ostei_deriv1_s_h_h_s_ptr;
+    simint_osteifunc_array[1][0][5][5][1] = ostei_deriv1_s_h_h_p_ptr;
+    simint_osteifunc_array[1][0][5][5][2] = ostei_deriv1_s_h_h_d_ptr;
+    simint_osteifunc_array[1][0][5][5][3] = ostei_deriv1_s_h_h_f_ptr;
+    simint_osteifunc_array[1][0][5][5][4] = ostei_deriv1_s_h_h_g_ptr;
+    simint_osteifunc_array[1][0][5][5][5] = ostei_deriv1_s_h_h_h_ptr;
+    simint_osteifunc_array[1][1][0][0][5] = ostei_deriv1_p_s_s_h_ptr;
+    simint_osteifunc_array[1][1][0][1][5] = ostei_deriv1_p_s_p_h_ptr;
+    simint_osteifunc_array[1][1][0][2][5] = ostei_deriv1_p_s_d_h_ptr;
+    simint_osteifunc_array[1][1][0][3][5] = ostei_deriv1_p_s_f_h_ptr;
+    simint_osteifunc_array[1][1][0][4][5] = ostei_deriv1_p_s_g_h_ptr;
+    simint_osteifunc_array[1][1][0][5][0] = ostei_deriv1_p_s_h_s_ptr;
+    simint_osteifunc_array[1][1][0][5][1] = ostei_deriv1_p_s_h_p_ptr;
+    simint_osteifunc_array[1][1][0][5][2] = ostei_deriv1_p_s_h_d_ptr;
+    simint_osteifunc_array[1][1][0][5][3] = ostei_deriv1_p_s_h_f_ptr;
+    simint_osteifunc_array[1][1][0][5][4] = ostei_deriv1_p_s_h_g_ptr;
+    simint_osteifunc_array[1][1][0][5][5] = ostei_deriv1_p_s_h_h_ptr;
+    simint_osteifunc_array[1][1][1][0][5] = ostei_deriv1_p_p_s_h_ptr;
+    simint_osteifunc_array[1][1][1][1][5] = ostei_deriv1_p_p_p_h_ptr;
+    simint_osteifunc_array[1][1][1][2][5] = ostei_deriv1_p_p_d_h_ptr;
+    simint_osteifunc_array[1][1][1][3][5] = ostei_deriv1_p_p_f_h_ptr;
+    simint_osteifunc_array[1][1][1][4][5] = ostei_deriv1_p_p_g_h_ptr;
+    simint_osteifunc_array[1][1][1][5][0] = ostei_deriv1_p_p_h_s_ptr;
+    simint_osteifunc_array[1][1][1][5][1] = ostei_deriv1_p_p_h_p_ptr;
+    simint_osteifunc_array[1][1][1][5][2] = ostei_deriv1_p_p_h_d_ptr;
+    simint_osteifunc_array[1][1][1][5][3] = ostei_deriv1_p_p_h_f_ptr;
+    simint_osteifunc_array[1][1][1][5][4] = ostei_deriv1_p_p_h_g_ptr;
+    simint_osteifunc_array[1][1][1][5][5] = ostei_deriv1_p_p_h_h_ptr;
+    simint_osteifunc_array[1][1][2][0][5] = ostei_deriv1_p_d_s_h_ptr;
+    simint_osteifunc_array[1][1][2][1][5] = ostei_deriv1_p_d_p_h_ptr;
+    simint_osteifunc_array[1][1][2][2][5] = ostei_deriv1_p_d_d_h_ptr;
+    simint_osteifunc_array[1][1][2][3][5] = ostei_deriv1_p_d_f_h_ptr;
+    simint_osteifunc_array[1][1][2][4][5] = ostei_deriv1_p_d_g_h_ptr;
+    simint_osteifunc_array[1][1][2][5][0] = ostei_deriv1_p_d_h_s_ptr;
+    simint_osteifunc_array[1][1][2][5][1] = ostei_deriv1_p_d_h_p_ptr;
+    simint_osteifunc_array[1][1][2][5][2] = ostei_deriv1_p_d_h_d_ptr;
+    simint_osteifunc_array[1][1][2][5][3] = ostei_deriv1_p_d_h_f_ptr;
+    simint_osteifunc_array[1][1][2][5][4] = ostei_deriv1_p_d_h_g_ptr;
+    simint_osteifunc_array[1][1][2][5][5] = ostei_deriv1_p_d_h_h_ptr;
+    simint_osteifunc_array[1][1][3][0][5] = ostei_deriv1_p_f_s_h_ptr;
+    simint_osteifunc_array[1][1][3][1][5] = ostei_deriv1_p_f_p_h_ptr;
+    simint_osteifunc_array[1][1][3][2][5] = ostei_deriv1_p_f_d_h_ptr;
+    simint_osteifunc_array[1][1][3][3][5] = ostei_deriv1_p_f_f_h_ptr;
+    simint_osteifunc_array[1][1][3][4][5] = ostei_deriv1_p_f_g_h_ptr;
+    simint_osteifunc_array[1][1][3][5][0] = ostei_deriv1_p_f_h_s_ptr;
+    simint_osteifunc_array[1][1][3][5][1] = ostei_deriv1_p_f_h_p_ptr;
+    simint_osteifunc_array[1][1][3][5][2] = ostei_deriv1_p_f_h_d_ptr;
+    simint_osteifunc_array[1][1][3][5][3] = ostei_deriv1_p_f_h_f_ptr;
+    simint_osteifunc_array[1][1][3][5][4] = ostei_deriv1_p_f_h_g_ptr;
+    simint_osteifunc_array[1][1][3][5][5] = ostei_deriv1_p_f_h_h_ptr;
+    simint_osteifunc_array[1][1][4][0][5] = ostei_deriv1_p_g_s_h_ptr;
+    simint_osteifunc_array[1][1][4][1][5] = ostei_deriv1_p_g_p_h_ptr;
+    simint_osteifunc_array[1][1][4][2][5] = ostei_deriv1_p_g_d_h_ptr;
+    simint_osteifunc_array[1][1][4][3][5] = ostei_deriv1_p_g_f_h_ptr;
+    simint_osteifunc_array[1][1][4][4][5] = ostei_deriv1_p_g_g_h_ptr;
+    simint_osteifunc_array[1][1][4][5][0] = ostei_deriv1_p_g_h_s_ptr;
+    simint_osteifunc_array[1][1][4][5][1] = ostei_deriv1_p_g_h_p_ptr;
+    simint_osteifunc_array[1][1][4][5][2] = ostei_deriv1_p_g_h_d_ptr;
+    simint_osteifunc_array[1][1][4][5][3] = ostei_deriv1_p_g_h_f_ptr;
+    simint_osteifunc_array[1][1][4][5][4] = ostei_deriv1_p_g_h_g_ptr;
+    simint_osteifunc_array[1][1][4][5][5] = ostei_deriv1_p_g_h_h_ptr;
+    simint_osteifunc_array[1][1][5][0][0] = ostei_deriv1_p_h_s_s_ptr;
+    simint_osteifunc_array[1][1][5][0][1] = ostei_deriv1_p_h_s_p_ptr;
+    simint_osteifunc_array[1][1][5][0][2] = ostei_deriv1_p_h_s_d_ptr;
+    simint_osteifunc_array[1][1][5][0][3] = ostei_deriv1_p_h_s_f_ptr;
+    simint_osteifunc_array[1][1][5][0][4] = ostei_deriv1_p_h_s_g_ptr;
+    simint_osteifunc_array[1][1][5][0][5] = ostei_deriv1_p_h_s_h_ptr;
+    simint_osteifunc_array[1][1][5][1][0] = ostei_deriv1_p_h_p_s_ptr;
+    simint_osteifunc_array[1][1][5][1][1] = ostei_deriv1_p_h_p_p_ptr;
+    simint_osteifunc_array[1][1][5][1][2] = ostei_deriv1_p_h_p_d_ptr;
+    simint_osteifunc_array[1][1][5][1][3] = ostei_deriv1_p_h_p_f_ptr;
+    simint_osteifunc_array[1][1][5][1][4] = ostei_deriv1_p_h_p_g_ptr;
+    simint_osteifunc_array[1][1][5][1][5] = ostei_deriv1_p_h_p_h_ptr;
+    simint_osteifunc_array[1][1][5][2][0] = ostei_deriv1_p_h_d_s_ptr;
+    simint_osteifunc_array[1][1][5][2][1] = ostei_deriv1_p_h_d_p_ptr;
+    simint_osteifunc_array[1][1][5][2][2] = ostei_deriv1_p_h_d_d_ptr;
+    simint_osteifunc_array[1][1][5][2][3] = ostei_deriv1_p_h_d_f_ptr;
+    simint_osteifunc_array[1][1][5][2][4] = ostei_deriv1_p_h_d_g_ptr;
+    simint_osteifunc_array[1][1][5][2][5] = ostei_deriv1_p_h_d_h_ptr;
+    simint_osteifunc_array[1][1][5][3][0] = ostei_deriv1_p_h_f_s_ptr;
+    simint_osteifunc_array[1][1][5][3][1] = ostei_deriv1_p_h_f_p_ptr;
+    simint_osteifunc_array[1][1][5][3][2] = ostei_deriv1_p_h_f_d_ptr;
+    simint_osteifunc_array[1][1][5][3][3] = ostei_deriv1_p_h_f_f_ptr;
+    simint_osteifunc_array[1][1][5][3][4] = ostei_deriv1_p_h_f_g_ptr;
+    simint_osteifunc_array[1][1][5][3][5] = ostei_deriv1_p_h_f_h_ptr;
+    simint_osteifunc_array[1][1][5][4][0] = ostei_deriv1_p_h_g_s_ptr;
+    simint_osteifunc_array[1][1][5][4][1] = ostei_deriv1_p_h_g_p_ptr;
+    simint_osteifunc_array[1][1][5][4][2] = ostei_deriv1_p_h_g_d_ptr;
+    simint_osteifunc_array[1][1][5][4][3] = ostei_deriv1_p_h_g_f_ptr;
+    simint_osteifunc_array[1][1][5][4][4] = ostei_deriv1_p_h_g_g_ptr;
+    simint_osteifunc_array[1][1][5][4][5] = ostei_deriv1_p_h_g_h_ptr;
+    simint_osteifunc_array[1][1][5][5][0] = ostei_deriv1_p_h_h_s_ptr;
+    simint_osteifunc_array[1][1][5][5][1] = ostei_deriv1_p_h_h_p_ptr;
+    simint_osteifunc_array[1][1][5][5][2] = ostei_deriv1_p_h_h_d_ptr;
+    simint_osteifunc_array[1][1][5][5][3] = ostei_deriv1_p_h_h_f_ptr;
+    simint_osteifunc_array[1][1][5][5][4] = ostei_deriv1_p_h_h_g_ptr;
+    simint_osteifunc_array[1][1][5][5][5] = ostei_deriv1_p_h_h_h_ptr;
+    simint_osteifunc_array[1][2][0][0][5] = ostei_deriv1_d_s_s_h_ptr;
+    simint_osteifunc_array[1][2][0][1][5] = ostei_deriv1_d_s_p_h_ptr;
+    simint_osteifunc_array[1][2][0][2][5] = ostei_deriv1_d_s_d_h_ptr;
+    simint_osteifunc_array[1][2][0][3][5] = ostei_deriv1_d_s_f_h_ptr;
+    simint_osteifunc_array[1][2][0][4][5] = ostei_deriv1_d_s_g_h_ptr;
+    simint_osteifunc_array[1][2][0][5][0] = ostei_deriv1_d_s_h_s_ptr;
+    simint_osteifunc_array[1][2][0][5][1] = ostei_deriv1_d_s_h_p_ptr;
+    simint_osteifunc_array[1][2][0][5][2] = ostei_deriv1_d_s_h_d_ptr;
+    simint_osteifunc_array[1][2][0][5][3] = ostei_deriv1_d_s_h_f_ptr;
+    simint_osteifunc_array[1][2][0][5][4] = ostei_deriv1_d_s_h_g_ptr;
+    simint_osteifunc_array[1][2][0][5][5] = ostei_deriv1_d_s_h_h_ptr;
+    simint_osteifunc_array[1][2][1][0][5] = ostei_deriv1_d_p_s_h_ptr;
+    simint_osteifunc_array[1][2][1][1][5] = ostei_deriv1_d_p_p_h_ptr;
+    simint_osteifunc_array[1][2][1][2][5] = ostei_deriv1_d_p_d_h_ptr;
+    simint_osteifunc_array[1][2][1][3][5] = ostei_deriv1_d_p_f_h_ptr;
+    simint_osteifunc_array[1][2][1][4][5] = ostei_deriv1_d_p_g_h_ptr;
+    simint_osteifunc_array[1][2][1][5][0] = ostei_deriv1_d_p_h_s_ptr;
+    simint_osteifunc_array[1][2][1][5][1] = ostei_deriv1_d_p_h_p_ptr;
+    simint_osteifunc_array[1][2][1][5][2] = ostei_deriv1_d_p_h_d_ptr;
+    simint_osteifunc_array[1][2][1][5][3] = ostei_deriv1_d_p_h_f_ptr;
+    simint_osteifunc_array[1][2][1][5][4] = ostei_deriv1_d_p_h_g_ptr;
+    simint_osteifunc_array[1][2][1][5][5] = ostei_deriv1_d_p_h_h_ptr;
+    simint_osteifunc_array[1][2][2][0][5] = ostei_deriv1_d_d_s_h_ptr;
+    simint_osteifunc_array[1][2][2][1][5] = ostei_deriv1_d_d_p_h_ptr;
+    simint_osteifunc_array[1][2][2][2][5] = ostei_deriv1_d_d_d_h_ptr;
+    simint_osteifunc_array[1][2][2][3][5] = ostei_deriv1_d_d_f_h_ptr;
+    simint_osteifunc_array[1][2][2][4][5] = ostei_deriv1_d_d_g_h_ptr;
+    simint_osteifunc_array[1][2][2][5][0] = ostei_deriv1_d_d_h_s_ptr;
+    simint_osteifunc_array[1][2][2][5][1] = ostei_deriv1_d_d_h_p_ptr;
+    simint_osteifunc_array[1][2][2][5][2] = ostei_deriv1_d_d_h_d_ptr;
+    simint_osteifunc_array[1][2][2][5][3] = ostei_deriv1_d_d_h_f_ptr;
+    simint_osteifunc_array[1][2][2][5][4] = ostei_deriv1_d_d_h_g_ptr;
+    simint_osteifunc_array[1][2][2][5][5] = ostei_deriv1_d_d_h_h_ptr;
+    simint_osteifunc_array[1][2][3][0][5] = ostei_deriv1_d_f_s_h_ptr;
+    simint_osteifunc_array[1][2][3][1][5] = ostei_deriv1_d_f_p_h_ptr;
+    simint_osteifunc_array[1][2][3][2][5] = ostei_deriv1_d_f_d_h_ptr;
+    simint_osteifunc_array[1][2][3][3][5] = ostei_deriv1_d_f_f_h_ptr;
+    simint_osteifunc_array[1][2][3][4][5] = ostei_deriv1_d_f_g_h_ptr;
+    simint_osteifunc_array[1][2][3][5][0] = ostei_deriv1_d_f_h_s_ptr;
+    simint_osteifunc_array[1][2][3][5][1] = ostei_deriv1_d_f_h_p_ptr;
+    simint_osteifunc_array[1][2][3][5][2] = ostei_deriv1_d_f_h_d_ptr;
+    simint_osteifunc_array[1][2][3][5][3] = ostei_deriv1_d_f_h_f_ptr;
+    simint_osteifunc_array[1][2][3][5][4] = ostei_deriv1_d_f_h_g_ptr;
+    simint_osteifunc_array[1][2][3][5][5] = ostei_deriv1_d_f_h_h_ptr;
+    simint_osteifunc_array[1][2][4][0][5] = ostei_deriv1_d_g_s_h_ptr;
+    simint_osteifunc_array[1][2][4][1][5] = ostei_deriv1_d_g_p_h_ptr;
+    simint_osteifunc_array[1][2][4][2][5] = ostei_deriv1_d_g_d_h_ptr;
+    simint_osteifunc_array[1][2][4][3][5] = ostei_deriv1_d_g_f_h_ptr;
+    simint_osteifunc_array[1][2][4][4][5] = ostei_deriv1_d_g_g_h_ptr;
+    simint_osteifunc_array[1][2][4][5][0] = ostei_deriv1_d_g_h_s_ptr;
+    simint_osteifunc_array[1][2][4][5][1] = ostei_deriv1_d_g_h_p_ptr;
+    simint_osteifunc_array[1][2][4][5][2] = ostei_deriv1_d_g_h_d_ptr;
+    simint_osteifunc_array[1][2][4][5][3] = ostei_deriv1_d_g_h_f_ptr;
+    simint_osteifunc_array[1][2][4][5][4] = ostei_deriv1_d_g_h_g_ptr;
+    simint_osteifunc_array[1][2][4][5][5] = ostei_deriv1_d_g_h_h_ptr;
+    simint_osteifunc_array[1][2][5][0][0] = ostei_deriv1_d_h_s_s_ptr;
+    simint_osteifunc_array[1][2][5][0][1] = ostei_deriv1_d_h_s_p_ptr;
+    simint_osteifunc_array[1][2][5][0][2] = ostei_deriv1_d_h_s_d_ptr;
+    simint_osteifunc_array[1][2][5][0][3] = ostei_deriv1_d_h_s_f_ptr;
+    simint_osteifunc_array[1][2][5][0][4] = ostei_deriv1_d_h_s_g_ptr;
+    simint_osteifunc_array[1][2][5][0][5] = ostei_deriv1_d_h_s_h_ptr;
+    simint_osteifunc_array[1][2][5][1][0] = ostei_deriv1_d_h_p_s_ptr;
+    simint_osteifunc_array[1][2][5][1][1] = ostei_deriv1_d_h_p_p_ptr;
+    simint_osteifunc_array[1][2][5][1][2] = ostei_deriv1_d_h_p_d_ptr;
+    simint_osteifunc_array[1][2][5][1][3] = ostei_deriv1_d_h_p_f_ptr;
+    simint_osteifunc_array[1][2][5][1][4] = ostei_deriv1_d_h_p_g_ptr;
+    simint_osteifunc_array[1][2][5][1][5] = ostei_deriv1_d_h_p_h_ptr;
+    simint_osteifunc_array[1][2][5][2][0] = ostei_deriv1_d_h_d_s_ptr;
+    simint_osteifunc_array[1][2][5][2][1] = ostei_deriv1_d_h_d_p_ptr;
+    simint_osteifunc_array[1][2][5][2][2] = ostei_deriv1_d_h_d_d_ptr;
+    simint_osteifunc_array[1][2][5][2][3] = ostei_deriv1_d_h_d_f_ptr;
+    simint_osteifunc_array[1][2][5][2][4] = ostei_deriv1_d_h_d_g_ptr;
+    simint_osteifunc_array[1][2][5][2][5] = ostei_deriv1_d_h_d_h_ptr;
+    simint_osteifunc_array[1][2][5][3][0] = ostei_deriv1_d_h_f_s_ptr;
+    simint_osteifunc_array[1][2][5][3][1] = ostei_deriv1_d_h_f_p_ptr;
+    simint_osteifunc_array[1][2][5][3][2] = ostei_deriv1_d_h_f_d_ptr;
+    simint_osteifunc_array[1][2][5][3][3] = ostei_deriv1_d_h_f_f_ptr;
+    simint_osteifunc_array[1][2][5][3][4] = ostei_deriv1_d_h_f_g_ptr;
+    simint_osteifunc_array[1][2][5][3][5] = ostei_deriv1_d_h_f_h_ptr;
+    simint_osteifunc_array[1][2][5][4][0] = ostei_deriv1_d_h_g_s_ptr;
+    simint_osteifunc_array[1][2][5][4][1] = ostei_deriv1_d_h_g_p_ptr;
+    simint_osteifunc_array[1][2][5][4][2] = ostei_deriv1_d_h_g_d_ptr;
+    simint_osteifunc_array[1][2][5][4][3] = ostei_deriv1_d_h_g_f_ptr;
+    simint_osteifunc_array[1][2][5][4][4] = ostei_deriv1_d_h_g_g_ptr;
+    simint_osteifunc_array[1][2][5][4][5] = ostei_deriv1_d_h_g_h_ptr;
+    simint_osteifunc_array[1][2][5][5][0] = ostei_deriv1_d_h_h_s_ptr;
+    simint_osteifunc_array[1][2][5][5][1] = ostei_deriv1_d_h_h_p_ptr;
+    simint_osteifunc_array[1][2][5][5][2] = ostei_deriv1_d_h_h_d_ptr;
+    simint_osteifunc_array[1][2][5][5][3] = ostei_deriv1_d_h_h_f_ptr;
+    simint_osteifunc_array[1][2][5][5][4] = ostei_deriv1_d_h_h_g_ptr;
+    simint_osteifunc_array[1][2][5][5][5] = ostei_deriv1_d_h_h_h_ptr;
+    simint_osteifunc_array[1][3][0][0][5] = ostei_deriv1_f_s_s_h_ptr;
+    simint_osteifunc_array[1][3][0][1][5] = ostei_deriv1_f_s_p_h_ptr;
+    simint_osteifunc_array[1][3][0][2][5] = ostei_deriv1_f_s_d_h_ptr;
+    simint_osteifunc_array[1][3][0][3][5] = ostei_deriv1_f_s_f_h_ptr;
+    simint_osteifunc_array[1][3][0][4][5] = ostei_deriv1_f_s_g_h_ptr;
+    simint_osteifunc_array[1][3][0][5][0] = ostei_deriv1_f_s_h_s_ptr;
+    simint_osteifunc_array[1][3][0][5][1] = ostei_deriv1_f_s_h_p_ptr;
+    simint_osteifunc_array[1][3][0][5][2] = ostei_deriv1_f_s_h_d_ptr;
+    simint_osteifunc_array[1][3][0][5][3] = ostei_deriv1_f_s_h_f_ptr;
+    simint_osteifunc_array[1][3][0][5][4] = ostei_deriv1_f_s_h_g_ptr;
+    simint_osteifunc_array[1][3][0][5][5] = ostei_deriv1_f_s_h_h_ptr;
+    simint_osteifunc_array[1][3][1][0][5] = ostei_deriv1_f_p_s_h_ptr;
+    simint_osteifunc_array[1][3][1][1][5] = ostei_deriv1_f_p_p_h_ptr;
+    simint_osteifunc_array[1][3][1][2][5] = ostei_deriv1_f_p_d_h_ptr;
+    simint_osteifunc_array[1][3][1][3][5] = ostei_deriv1_f_p_f_h_ptr;
+    simint_osteifunc_array[1][3][1][4][5] = ostei_deriv1_f_p_g_h_ptr;
+    simint_osteifunc_array[1][3][1][5][0] = ostei_deriv1_f_p_h_s_ptr;
+    simint_osteifunc_array[1][3][1][5][1] = ostei_deriv1_f_p_h_p_ptr;
+    simint_osteifunc_array[1][3][1][5][2] = ostei_deriv1_f_p_h_d_ptr;
+    simint_osteifunc_array[1][3][1][5][3] = ostei_deriv1_f_p_h_f_ptr;
+    simint_osteifunc_array[1][3][1][5][4] = ostei_deriv1_f_p_h_g_ptr;
+    simint_osteifunc_array[1][3][1][5][5] = ostei_deriv1_f_p_h_h_ptr;
+    simint_osteifunc_array[1][3][2][0][5] = ostei_deriv1_f_d_s_h_ptr;
+    simint_osteifunc_array[1][3][2][1][5] = ostei_deriv1_f_d_p_h_ptr;
+    simint_osteifunc_array[1][3][2][2][5] = ostei_deriv1_f_d_d_h_ptr;
+    simint_osteifunc_array[1][3][2][3][5] = ostei_deriv1_f_d_f_h_ptr;
+    simint_osteifunc_array[1][3][2][4][5] = ostei_deriv1_f_d_g_h_ptr;
+    simint_osteifunc_array[1][3][2][5][0] = ostei_deriv1_f_d_h_s_ptr;
+    simint_osteifunc_array[1][3][2][5][1] = ostei_deriv1_f_d_h_p_ptr;
+    simint_osteifunc_array[1][3][2][5][2] = ostei_deriv1_f_d_h_d_ptr;
+    simint_osteifunc_array[1][3][2][5][3] = ostei_deriv1_f_d_h_f_ptr;
+    simint_osteifunc_array[1][3][2][5][4] = ostei_deriv1_f_d_h_g_ptr;
+    simint_osteifunc_array[1][3][2][5][5] = ostei_deriv1_f_d_h_h_ptr;
+    simint_osteifunc_array[1][3][3][0][5] = ostei_deriv1_f_f_s_h_ptr;
+    simint_osteifunc_array[1][3][3][1][5] = ostei_deriv1_f_f_p_h_ptr;
+    simint_osteifunc_array[1][3][3][2][5] = ostei_deriv1_f_f_d_h_ptr;
+    simint_osteifunc_array[1][3][3][3][5] = ostei_deriv1_f_f_f_h_ptr;
+    simint_osteifunc_array[1][3][3][4][5] = ostei_deriv1_f_f_g_h_ptr;
+    simint_osteifunc_array[1][3][3][5][0] = ostei_deriv1_f_f_h_s_ptr;
+    simint_osteifunc_array[1][3][3][5][1] = ostei_deriv1_f_f_h_p_ptr;
+    simint_osteifunc_array[1][3][3][5][2] = ostei_deriv1_f_f_h_d_ptr;
+    simint_osteifunc_array[1][3][3][5][3] = ostei_deriv1_f_f_h_f_ptr;
+    simint_osteifunc_array[1][3][3][5][4] = ostei_deriv1_f_f_h_g_ptr;
+    simint_osteifunc_array[1][3][3][5][5] = ostei_deriv1_f_f_h_h_ptr;
+    simint_osteifunc_array[1][3][4][0][5] = ostei_deriv1_f_g_s_h_ptr;
+    simint_osteifunc_array[1][3][4][1][5] = ostei_deriv1_f_g_p_h_ptr;
+    simint_osteifunc_array[1][3][4][2][5] = ostei_deriv1_f_g_d_h_ptr;
+    simint_osteifunc_array[1][3][4][3][5] = ostei_deriv1_f_g_f_h_ptr;
+    simint_osteifunc_array[1][3][4][4][5] = ostei_deriv1_f_g_g_h_ptr;
+    simint_osteifunc_array[1][3][4][5][0] = ostei_deriv1_f_g_h_s_ptr;
+    simint_osteifunc_array[1][3][4][5][1] = ostei_deriv1_f_g_h_p_ptr;
+    simint_osteifunc_array[1][3][4][5][2] = ostei_deriv1_f_g_h_d_ptr;
+    simint_osteifunc_array[1][3][4][5][3] = ostei_deriv1_f_g_h_f_ptr;
+    simint_osteifunc_array[1][3][4][5][4] = ostei_deriv1_f_g_h_g_ptr;
+    simint_osteifunc_array[1][3][4][5][5] = ostei_deriv1_f_g_h_h_ptr;
+    simint_osteifunc_array[1][3][5][0][0] = ostei_deriv1_f_h_s_s_ptr;
+    simint_osteifunc_array[1][3][5][0][1] = ostei_deriv1_f_h_s_p_ptr;
+    simint_osteifunc_array[1][3][5][0][2] = ostei_deriv1_f_h_s_d_ptr;
+    simint_osteifunc_array[1][3][5][0][3] = ostei_deriv1_f_h_s_f_ptr;
+    simint_osteifunc_array[1][3][5][0][4] = ostei_deriv1_f_h_s_g_ptr;
+    simint_osteifunc_array[1][3][5][0][5] = ostei_deriv1_f_h_s_h_ptr;
+    simint_osteifunc_array[1][3][5][1][0] = ostei_deriv1_f_h_p_s_ptr;
+    simint_osteifunc_array[1][3][5][1][1] = ostei_deriv1_f_h_p_p_ptr;
+    simint_osteifunc_array[1][3][5][1][2] = ostei_deriv1_f_h_p_d_ptr;
+    simint_osteifunc_array[1][3][5][1][3] = ostei_deriv1_f_h_p_f_ptr;
+    simint_osteifunc_array[1][3][5][1][4] = ostei_deriv1_f_h_p_g_ptr;
+    simint_osteifunc_array[1][3][5][1][5] = ostei_deriv1_f_h_p_h_ptr;
+    simint_osteifunc_array[1][3][5][2][0] = ostei_deriv1_f_h_d_s_ptr;
+    simint_osteifunc_array[1][3][5][2][1] = ostei_deriv1_f_h_d_p_ptr;
+    simint_osteifunc_array[1][3][5][2][2] = ostei_deriv1_f_h_d_d_ptr;
+    simint_osteifunc_array[1][3][5][2][3] = ostei_deriv1_f_h_d_f_ptr;
+    simint_osteifunc_array[1][3][5][2][4] = ostei_deriv1_f_h_d_g_ptr;
+    simint_osteifunc_array[1][3][5][2][5] = ostei_deriv1_f_h_d_h_ptr;
+    simint_osteifunc_array[1][3][5][3][0] = ostei_deriv1_f_h_f_s_ptr;
+    simint_osteifunc_array[1][3][5][3][1] = ostei_deriv1_f_h_f_p_ptr;
+    simint_osteifunc_array[1][3][5][3][2] = ostei_deriv1_f_h_f_d_ptr;
+    simint_osteifunc_array[1][3][5][3][3] = ostei_deriv1_f_h_f_f_ptr;
+    simint_osteifunc_array[1][3][5][3][4] = ostei_deriv1_f_h_f_g_ptr;
+    simint_osteifunc_array[1][3][5][3][5] = ostei_deriv1_f_h_f_h_ptr;
+    simint_osteifunc_array[1][3][5][4][0] = ostei_deriv1_f_h_g_s_ptr;
+    simint_osteifunc_array[1][3][5][4][1] = ostei_deriv1_f_h_g_p_ptr;
+    simint_osteifunc_array[1][3][5][4][2] = ostei_deriv1_f_h_g_d_ptr;
+    simint_osteifunc_array[1][3][5][4][3] = ostei_deriv1_f_h_g_f_ptr;
+    simint_osteifunc_array[1][3][5][4][4] = ostei_deriv1_f_h_g_g_ptr;
+    simint_osteifunc_array[1][3][5][4][5] = ostei_deriv1_f_h_g_h_ptr;
+    simint_osteifunc_array[1][3][5][5][0] = ostei_deriv1_f_h_h_s_ptr;
+    simint_osteifunc_array[1][3][5][5][1] = ostei_deriv1_f_h_h_p_ptr;
+    simint_osteifunc_array[1][3][5][5][2] = ostei_deriv1_f_h_h_d_ptr;
+    simint_osteifunc_array[1][3][5][5][3] = ostei_deriv1_f_h_h_f_ptr;
+    simint_osteifunc_array[1][3][5][5][4] = ostei_deriv1_f_h_h_g_ptr;
+    simint_osteifunc_array[1][3][5][5][5] = ostei_deriv1_f_h_h_h_ptr;
+    simint_osteifunc_array[1][4][0][0][5] = ostei_deriv1_g_s_s_h_ptr;
+    simint_osteifunc_array[1][4][0][1][5] = ostei_deriv1_g_s_p_h_ptr;
+    simint_osteifunc_array[1][4][0][2][5] = ostei_deriv1_g_s_d_h_ptr;
+    simint_osteifunc_array[1][4][0][3][5] = ostei_deriv1_g_s_f_h_ptr;
+    simint_osteifunc_array[1][4][0][4][5] = ostei_deriv1_g_s_g_h_ptr;
+    simint_osteifunc_array[1][4][0][5][0] = ostei_deriv1_g_s_h_s_ptr;
+    simint_osteifunc_array[1][4][0][5][1] = ostei_deriv1_g_s_h_p_ptr;
+    simint_osteifunc_array[1][4][0][5][2] = ostei_deriv1_g_s_h_d_ptr;
+    simint_osteifunc_array[1][4][0][5][3] = ostei_deriv1_g_s_h_f_ptr;
+    simint_osteifunc_array[1][4][0][5][4] = ostei_deriv1_g_s_h_g_ptr;
+    simint_osteifunc_array[1][4][0][5][5] = ostei_deriv1_g_s_h_h_ptr;
+    simint_osteifunc_array[1][4][1][0][5] = ostei_deriv1_g_p_s_h_ptr;
+    simint_osteifunc_array[1][4][1][1][5] = ostei_deriv1_g_p_p_h_ptr;
+    simint_osteifunc_array[1][4][1][2][5] = ostei_deriv1_g_p_d_h_ptr;
+    simint_osteifunc_array[1][4][1][3][5] = ostei_deriv1_g_p_f_h_ptr;
+    simint_osteifunc_array[1][4][1][4][5] = ostei_deriv1_g_p_g_h_ptr;
+    simint_osteifunc_array[1][4][1][5][0] = ostei_deriv1_g_p_h_s_ptr;
+    simint_osteifunc_array[1][4][1][5][1] = ostei_deriv1_g_p_h_p_ptr;
+    simint_osteifunc_array[1][4][1][5][2] = ostei_deriv1_g_p_h_d_ptr;
+    simint_osteifunc_array[1][4][1][5][3] = ostei_deriv1_g_p_h_f_ptr;
+    simint_osteifunc_array[1][4][1][5][4] = ostei_deriv1_g_p_h_g_ptr;
+    simint_osteifunc_array[1][4][1][5][5] = ostei_deriv1_g_p_h_h_ptr;
+    simint_osteifunc_array[1][4][2][0][5] = ostei_deriv1_g_d_s_h_ptr;
+    simint_osteifunc_array[1][4][2][1][5] = ostei_deriv1_g_d_p_h_ptr;
+    simint_osteifunc_array[1][4][2][2][5] = ostei_deriv1_g_d_d_h_ptr;
+    simint_osteifunc_array[1][4][2][3][5] = ostei_deriv1_g_d_f_h_ptr;
+    simint_osteifunc_array[1][4][2][4][5] = ostei_deriv1_g_d_g_h_ptr;
+    simint_osteifunc_array[1][4][2][5][0] = ostei_deriv1_g_d_h_s_ptr;
+    simint_osteifunc_array[1][4][2][5][1] = ostei_deriv1_g_d_h_p_ptr;
+    simint_osteifunc_array[1][4][2][5][2] = ostei_deriv1_g_d_h_d_ptr;
+    simint_osteifunc_array[1][4][2][5][3] = ostei_deriv1_g_d_h_f_ptr;
+    simint_osteifunc_array[1][4][2][5][4] = ostei_deriv1_g_d_h_g_ptr;
+    simint_osteifunc_array[1][4][2][5][5] = ostei_deriv1_g_d_h_h_ptr;
+    simint_osteifunc_array[1][4][3][0][5] = ostei_deriv1_g_f_s_h_ptr;
+    simint_osteifunc_array[1][4][3][1][5] = ostei_deriv1_g_f_p_h_ptr;
+    simint_osteifunc_array[1][4][3][2][5] = ostei_deriv1_g_f_d_h_ptr;
+    simint_osteifunc_array[1][4][3][3][5] = ostei_deriv1_g_f_f_h_ptr;
+    simint_osteifunc_array[1][4][3][4][5] = ostei_deriv1_g_f_g_h_ptr;
+    simint_osteifunc_array[1][4][3][5][0] = ostei_deriv1_g_f_h_s_ptr;
+    simint_osteifunc_array[1][4][3][5][1] = ostei_deriv1_g_f_h_p_ptr;
+    simint_osteifunc_array[1][4][3][5][2] = ostei_deriv1_g_f_h_d_ptr;
+    simint_osteifunc_array[1][4][3][5][3] = ostei_deriv1_g_f_h_f_ptr;
+    simint_osteifunc_array[1][4][3][5][4] = ostei_deriv1_g_f_h_g_ptr;
+    simint_osteifunc_array[1][4][3][5][5] = ostei_deriv1_g_f_h_h_ptr;
+    simint_osteifunc_array[1][4][4][0][5] = ostei_deriv1_g_g_s_h_ptr;
+    simint_osteifunc_array[1][4][4][1][5] = ostei_deriv1_g_g_p_h_ptr;
+    simint_osteifunc_array[1][4][4][2][5] = ostei_deriv1_g_g_d_h_ptr;
+    simint_osteifunc_array[1][4][4][3][5] = ostei_deriv1_g_g_f_h_ptr;
+    simint_osteifunc_array[1][4][4][4][5] = ostei_deriv1_g_g_g_h_ptr;
+    simint_osteifunc_array[1][4][4][5][0] = ostei_deriv1_g_g_h_s_ptr;
+    simint_osteifunc_array[1][4][4][5][1] = ostei_deriv1_g_g_h_p_ptr;
+    simint_osteifunc_array[1][4][4][5][2] = ostei_deriv1_g_g_h_d_ptr;
+    simint_osteifunc_array[1][4][4][5][3] = ostei_deriv1_g_g_h_f_ptr;
+    simint_osteifunc_array[1][4][4][5][4] = ostei_deriv1_g_g_h_g_ptr;
+    simint_osteifunc_array[1][4][4][5][5] = ostei_deriv1_g_g_h_h_ptr;
+    simint_osteifunc_array[1][4][5][0][0] = ostei_deriv1_g_h_s_s_ptr;
+    simint_osteifunc_array[1][4][5][0][1] = ostei_deriv1_g_h_s_p_ptr;
+    simint_osteifunc_array[1][4][5][0][2] = ostei_deriv1_g_h_s_d_ptr;
+    simint_osteifunc_array[1][4][5][0][3] = ostei_deriv1_g_h_s_f_ptr;
+    simint_osteifunc_array[1][4][5][0][4] = ostei_deriv1_g_h_s_g_ptr;
+    simint_osteifunc_array[1][4][5][0][5] = ostei_deriv1_g_h_s_h_ptr;
+    simint_osteifunc_array[1][4][5][1][0] = ostei_deriv1_g_h_p_s_ptr;
+    simint_osteifunc_array[1][4][5][1][1] = ostei_deriv1_g_h_p_p_ptr;
+    simint_osteifunc_array[1][4][5][1][2] = ostei_deriv1_g_h_p_d_ptr;
+    simint_osteifunc_array[1][4][5][1][3] = ostei_deriv1_g_h_p_f_ptr;
+    simint_osteifunc_array[1][4][5][1][4] = ostei_deriv1_g_h_p_g_ptr;
+    simint_osteifunc_array[1][4][5][1][5] = ostei_deriv1_g_h_p_h_ptr;
+    simint_osteifunc_array[1][4][5][2][0] = ostei_deriv1_g_h_d_s_ptr;
+    simint_osteifunc_array[1][4][5][2][1] = ostei_deriv1_g_h_d_p_ptr;
+    simint_osteifunc_array[1][4][5][2][2] = ostei_deriv1_g_h_d_d_ptr;
+    simint_osteifunc_array[1][4][5][2][3] = ostei_deriv1_g_h_d_f_ptr;
+    simint_osteifunc_array[1][4][5][2][4] = ostei_deriv1_g_h_d_g_ptr;
+    simint_osteifunc_array[1][4][5][2][5] = ostei_deriv1_g_h_d_h_ptr;
+    simint_osteifunc_array[1][4][5][3][0] = ostei_deriv1_g_h_f_s_ptr;
+    simint_osteifunc_array[1][4][5][3][1] = ostei_deriv1_g_h_f_p_ptr;
+    simint_osteifunc_array[1][4][5][3][2] = ostei_deriv1_g_h_f_d_ptr;
+    simint_osteifunc_array[1][4][5][3][3] = ostei_deriv1_g_h_f_f_ptr;
+    simint_osteifunc_array[1][4][5][3][4] = ostei_deriv1_g_h_f_g_ptr;
+    simint_osteifunc_array[1][4][5][3][5] = ostei_deriv1_g_h_f_h_ptr;
+    simint_osteifunc_array[1][4][5][4][0] = ostei_deriv1_g_h_g_s_ptr;
+    simint_osteifunc_array[1][4][5][4][1] = ostei_deriv1_g_h_g_p_ptr;
+    simint_osteifunc_array[1][4][5][4][2] = ostei_deriv1_g_h_g_d_ptr;
+    simint_osteifunc_array[1][4][5][4][3] = ostei_deriv1_g_h_g_f_ptr;
+    simint_osteifunc_array[1][4][5][4][4] = ostei_deriv1_g_h_g_g_ptr;
+    simint_osteifunc_array[1][4][5][4][5] = ostei_deriv1_g_h_g_h_ptr;
+    simint_osteifunc_array[1][4][5][5][0] = ostei_deriv1_g_h_h_s_ptr;
+    simint_osteifunc_array[1][4][5][5][1] = ostei_deriv1_g_h_h_p_ptr;
+    simint_osteifunc_array[1][4][5][5][2] = ostei_deriv1_g_h_h_d_ptr;
+    simint_osteifunc_array[1][4][5][5][3] = ostei_deriv1_g_h_h_f_ptr;
+    simint_osteifunc_array[1][4][5][5][4] = ostei_deriv1_g_h_h_g_ptr;
+    simint_osteifunc_array[1][4][5][5][5] = ostei_deriv1_g_h_h_h_ptr;
+    simint_osteifunc_array[1][5][0][0][0] = ostei_deriv1_h_s_s_s_ptr;
+    simint_osteifunc_array[1][5][0][0][1] = ostei_deriv1_h_s_s_p_ptr;
+    simint_osteifunc_array[1][5][0][0][2] = ostei_deriv1_h_s_s_d_ptr;
+    simint_osteifunc_array[1][5][0][0][3] = ostei_deriv1_h_s_s_f_ptr;
+    simint_osteifunc_array[1][5][0][0][4] = ostei_deriv1_h_s_s_g_ptr;
+    simint_osteifunc_array[1][5][0][0][5] = ostei_deriv1_h_s_s_h_ptr;
+    simint_osteifunc_array[1][5][0][1][0] = ostei_deriv1_h_s_p_s_ptr;
+    simint_osteifunc_array[1][5][0][1][1] = ostei_deriv1_h_s_p_p_ptr;
+    simint_osteifunc_array[1][5][0][1][2] = ostei_deriv1_h_s_p_d_ptr;
+    simint_osteifunc_array[1][5][0][1][3] = ostei_deriv1_h_s_p_f_ptr;
+    simint_osteifunc_array[1][5][0][1][4] = ostei_deriv1_h_s_p_g_ptr;
+    simint_osteifunc_array[1][5][0][1][5] = ostei_deriv1_h_s_p_h_ptr;
+    simint_osteifunc_array[1][5][0][2][0] = ostei_deriv1_h_s_d_s_ptr;
+    simint_osteifunc_array[1][5][0][2][1] = ostei_deriv1_h_s_d_p_ptr;
+    simint_osteifunc_array[1][5][0][2][2] = ostei_deriv1_h_s_d_d_ptr;
+    simint_osteifunc_array[1][5][0][2][3] = ostei_deriv1_h_s_d_f_ptr;
+    simint_osteifunc_array[1][5][0][2][4] = ostei_deriv1_h_s_d_g_ptr;
+    simint_osteifunc_array[1][5][0][2][5] = ostei_deriv1_h_s_d_h_ptr;
+    simint_osteifunc_array[1][5][0][3][0] = ostei_deriv1_h_s_f_s_ptr;
+    simint_osteifunc_array[1][5][0][3][1] = ostei_deriv1_h_s_f_p_ptr;
+    simint_osteifunc_array[1][5][0][3][2] = ostei_deriv1_h_s_f_d_ptr;
+    simint_osteifunc_array[1][5][0][3][3] = ostei_deriv1_h_s_f_f_ptr;
+    simint_osteifunc_array[1][5][0][3][4] = ostei_deriv1_h_s_f_g_ptr;
+    simint_osteifunc_array[1][5][0][3][5] = ostei_deriv1_h_s_f_h_ptr;
+    simint_osteifunc_array[1][5][0][4][0] = ostei_deriv1_h_s_g_s_ptr;
+    simint_osteifunc_array[1][5][0][4][1] = ostei_deriv1_h_s_g_p_ptr;
+    simint_osteifunc_array[1][5][0][4][2] = ostei_deriv1_h_s_g_d_ptr;
+    simint_osteifunc_array[1][5][0][4][3] = ostei_deriv1_h_s_g_f_ptr;
+    simint_osteifunc_array[1][5][0][4][4] = ostei_deriv1_h_s_g_g_ptr;
+    simint_osteifunc_array[1][5][0][4][5] = ostei_deriv1_h_s_g_h_ptr;
+    simint_osteifunc_array[1][5][0][5][0] = ostei_deriv1_h_s_h_s_ptr;
+    simint_osteifunc_array[1][5][0][5][1] = ostei_deriv1_h_s_h_p_ptr;
+    simint_osteifunc_array[1][5][0][5][2] = ostei_deriv1_h_s_h_d_ptr;
+    simint_osteifunc_array[1][5][0][5][3] = ostei_deriv1_h_s_h_f_ptr;
+    simint_osteifunc_array[1][5][0][5][4] = ostei_deriv1_h_s_h_g_ptr;
+    simint_osteifunc_array[1][5][0][5][5] = ostei_deriv1_h_s_h_h_ptr;
+    simint_osteifunc_array[1][5][1][0][0] = ostei_deriv1_h_p_s_s_ptr;
+    simint_osteifunc_array[1][5][1][0][1] = ostei_deriv1_h_p_s_p_ptr;
+    simint_osteifunc_array[1][5][1][0][2] = ostei_deriv1_h_p_s_d_ptr;
+    simint_osteifunc_array[1][5][1][0][3] = ostei_deriv1_h_p_s_f_ptr;
+    simint_osteifunc_array[1][5][1][0][4] = ostei_deriv1_h_p_s_g_ptr;
+    simint_osteifunc_array[1][5][1][0][5] = ostei_deriv1_h_p_s_h_ptr;
+    simint_osteifunc_array[1][5][1][1][0] = ostei_deriv1_h_p_p_s_ptr;
+    simint_osteifunc_array[1][5][1][1][1] = ostei_deriv1_h_p_p_p_ptr;
+    simint_osteifunc_array[1][5][1][1][2] = ostei_deriv1_h_p_p_d_ptr;
+    simint_osteifunc_array[1][5][1][1][3] = ostei_deriv1_h_p_p_f_ptr;
+    simint_osteifunc_array[1][5][1][1][4] = ostei_deriv1_h_p_p_g_ptr;
+    simint_osteifunc_array[1][5][1][1][5] = ostei_deriv1_h_p_p_h_ptr;
+    simint_osteifunc_array[1][5][1][2][0] = ostei_deriv1_h_p_d_s_ptr;
+    simint_osteifunc_array[1][5][1][2][1] = ostei_deriv1_h_p_d_p_ptr;
+    simint_osteifunc_array[1][5][1][2][2] = ostei_deriv1_h_p_d_d_ptr;
+    simint_osteifunc_array[1][5][1][2][3] = ostei_deriv1_h_p_d_f_ptr;
+    simint_osteifunc_array[1][5][1][2][4] = ostei_deriv1_h_p_d_g_ptr;
+    simint_osteifunc_array[1][5][1][2][5] = ostei_deriv1_h_p_d_h_ptr;
+    simint_osteifunc_array[1][5][1][3][0] = ostei_deriv1_h_p_f_s_ptr;
+    simint_osteifunc_array[1][5][1][3][1] = ostei_deriv1_h_p_f_p_ptr;
+    simint_osteifunc_array[1][5][1][3][2] = ostei_deriv1_h_p_f_d_ptr;
+    simint_osteifunc_array[1][5][1][3][3] = ostei_deriv1_h_p_f_f_ptr;
+    simint_osteifunc_array[1][5][1][3][4] = ostei_deriv1_h_p_f_g_ptr;
+    simint_osteifunc_array[1][5][1][3][5] = ostei_deriv1_h_p_f_h_ptr;
+    simint_osteifunc_array[1][5][1][4][0] = ostei_deriv1_h_p_g_s_ptr;
+    simint_osteifunc_array[1][5][1][4][1] = ostei_deriv1_h_p_g_p_ptr;
+    simint_osteifunc_array[1][5][1][4][2] = ostei_deriv1_h_p_g_d_ptr;
+    simint_osteifunc_array[1][5][1][4][3] = ostei_deriv1_h_p_g_f_ptr;
+    simint_osteifunc_array[1][5][1][4][4] = ostei_deriv1_h_p_g_g_ptr;
+    simint_osteifunc_array[1][5][1][4][5] = ostei_deriv1_h_p_g_h_ptr;
+    simint_osteifunc_array[1][5][1][5][0] = ostei_deriv1_h_p_h_s_ptr;
+    simint_osteifunc_array[1][5][1][5][1] = ostei_deriv1_h_p_h_p_ptr;
+    simint_osteifunc_array[1][5][1][5][2] = ostei_deriv1_h_p_h_d_ptr;
+    simint_osteifunc_array[1][5][1][5][3] = ostei_deriv1_h_p_h_f_ptr;
+    simint_osteifunc_array[1][5][1][5][4] = ostei_deriv1_h_p_h_g_ptr;
+    simint_osteifunc_array[1][5][1][5][5] = ostei_deriv1_h_p_h_h_ptr;
+    simint_osteifunc_array[1][5][2][0][0] = ostei_deriv1_h_d_s_s_ptr;
+    simint_osteifunc_array[1][5][2][0][1] = ostei_deriv1_h_d_s_p_ptr;
+    simint_osteifunc_array[1][5][2][0][2] = ostei_deriv1_h_d_s_d_ptr;
+    simint_osteifunc_array[1][5][2][0][3] = ostei_deriv1_h_d_s_f_ptr;
+    simint_osteifunc_array[1][5][2][0][4] = ostei_deriv1_h_d_s_g_ptr;
+    simint_osteifunc_array[1][5][2][0][5] = ostei_deriv1_h_d_s_h_ptr;
+    simint_osteifunc_array[1][5][2][1][0] = ostei_deriv1_h_d_p_s_ptr;
+    simint_osteifunc_array[1][5][2][1][1] = ostei_deriv1_h_d_p_p_ptr;
+    simint_osteifunc_array[1][5][2][1][2] = ostei_deriv1_h_d_p_d_ptr;
+    simint_osteifunc_array[1][5][2][1][3] = ostei_deriv1_h_d_p_f_ptr;
+    simint_osteifunc_array[1][5][2][1][4] = ostei_deriv1_h_d_p_g_ptr;
+    simint_osteifunc_array[1][5][2][1][5] = ostei_deriv1_h_d_p_h_ptr;
+    simint_osteifunc_array[1][5][2][2][0] = ostei_deriv1_h_d_d_s_ptr;
+    simint_osteifunc_array[1][5][2][2][1] = ostei_deriv1_h_d_d_p_ptr;
+    simint_osteifunc_array[1][5][2][2][2] = ostei_deriv1_h_d_d_d_ptr;
+    simint_osteifunc_array[1][5][2][2][3] = ostei_deriv1_h_d_d_f_ptr;
+    simint_osteifunc_array[1][5][2][2][4] = ostei_deriv1_h_d_d_g_ptr;
+    simint_osteifunc_array[1][5][2][2][5] = ostei_deriv1_h_d_d_h_ptr;
+    simint_osteifunc_array[1][5][2][3][0] = ostei_deriv1_h_d_f_s_ptr;
+    simint_osteifunc_array[1][5][2][3][1] = ostei_deriv1_h_d_f_p_ptr;
+    simint_osteifunc_array[1][5][2][3][2] = ostei_deriv1_h_d_f_d_ptr;
+    simint_osteifunc_array[1][5][2][3][3] = ostei_deriv1_h_d_f_f_ptr;
+    simint_osteifunc_array[1][5][2][3][4] = ostei_deriv1_h_d_f_g_ptr;
+    simint_osteifunc_array[1][5][2][3][5] = ostei_deriv1_h_d_f_h_ptr;
+    simint_osteifunc_array[1][5][2][4][0] = ostei_deriv1_h_d_g_s_ptr;
+    simint_osteifunc_array[1][5][2][4][1] = ostei_deriv1_h_d_g_p_ptr;
+    simint_osteifunc_array[1][5][2][4][2] = ostei_deriv1_h_d_g_d_ptr;
+    simint_osteifunc_array[1][5][2][4][3] = ostei_deriv1_h_d_g_f_ptr;
+    simint_osteifunc_array[1][5][2][4][4] = ostei_deriv1_h_d_g_g_ptr;
+    simint_osteifunc_array[1][5][2][4][5] = ostei_deriv1_h_d_g_h_ptr;
+    simint_osteifunc_array[1][5][2][5][0] = ostei_deriv1_h_d_h_s_ptr;
+    simint_osteifunc_array[1][5][2][5][1] = ostei_deriv1_h_d_h_p_ptr;
+    simint_osteifunc_array[1][5][2][5][2] = ostei_deriv1_h_d_h_d_ptr;
+    simint_osteifunc_array[1][5][2][5][3] = ostei_deriv1_h_d_h_f_ptr;
+    simint_osteifunc_array[1][5][2][5][4] = ostei_deriv1_h_d_h_g_ptr;
+    simint_osteifunc_array[1][5][2][5][5] = ostei_deriv1_h_d_h_h_ptr;
+    simint_osteifunc_array[1][5][3][0][0] = ostei_deriv1_h_f_s_s_ptr;
+    simint_osteifunc_array[1][5][3][0][1] = ostei_deriv1_h_f_s_p_ptr;
+    simint_osteifunc_array[1][5][3][0][2] = ostei_deriv1_h_f_s_d_ptr;
+    simint_osteifunc_array[1][5][3][0][3] = ostei_deriv1_h_f_s_f_ptr;
+    simint_osteifunc_array[1][5][3][0][4] = ostei_deriv1_h_f_s_g_ptr;
+    simint_osteifunc_array[1][5][3][0][5] = ostei_deriv1_h_f_s_h_ptr;
+    simint_osteifunc_array[1][5][3][1][0] = ostei_deriv1_h_f_p_s_ptr;
+    simint_osteifunc_array[1][5][3][1][1] = ostei_deriv1_h_f_p_p_ptr;
+    simint_osteifunc_array[1][5][3][1][2] = ostei_deriv1_h_f_p_d_ptr;
+    simint_osteifunc_array[1][5][3][1][3] = ostei_deriv1_h_f_p_f_ptr;
+    simint_osteifunc_array[1][5][3][1][4] = ostei_deriv1_h_f_p_g_ptr;
+    simint_osteifunc_array[1][5][3][1][5] = ostei_deriv1_h_f_p_h_ptr;
+    simint_osteifunc_array[1][5][3][2][0] = ostei_deriv1_h_f_d_s_ptr;
+    simint_osteifunc_array[1][5][3][2][1] = ostei_deriv1_h_f_d_p_ptr;
+    simint_osteifunc_array[1][5][3][2][2] = ostei_deriv1_h_f_d_d_ptr;
+    simint_osteifunc_array[1][5][3][2][3] = ostei_deriv1_h_f_d_f_ptr;
+    simint_osteifunc_array[1][5][3][2][4] = ostei_deriv1_h_f_d_g_ptr;
+    simint_osteifunc_array[1][5][3][2][5] = ostei_deriv1_h_f_d_h_ptr;
+    simint_osteifunc_array[1][5][3][3][0] = ostei_deriv1_h_f_f_s_ptr;
+    simint_osteifunc_array[1][5][3][3][1] = ostei_deriv1_h_f_f_p_ptr;
+    simint_osteifunc_array[1][5][3][3][2] = ostei_deriv1_h_f_f_d_ptr;
+    simint_osteifunc_array[1][5][3][3][3] = ostei_deriv1_h_f_f_f_ptr;
+    simint_osteifunc_array[1][5][3][3][4] = ostei_deriv1_h_f_f_g_ptr;
+    simint_osteifunc_array[1][5][3][3][5] = ostei_deriv1_h_f_f_h_ptr;
+    simint_osteifunc_array[1][5][3][4][0] = ostei_deriv1_h_f_g_s_ptr;
+    simint_osteifunc_array[1][5][3][4][1] = ostei_deriv1_h_f_g_p_ptr;
+    simint_osteifunc_array[1][5][3][4][2] = ostei_deriv1_h_f_g_d_ptr;
+    simint_osteifunc_array[1][5][3][4][3] = ostei_deriv1_h_f_g_f_ptr;
+    simint_osteifunc_array[1][5][3][4][4] = ostei_deriv1_h_f_g_g_ptr;
+    simint_osteifunc_array[1][5][3][4][5] = ostei_deriv1_h_f_g_h_ptr;
+    simint_osteifunc_array[1][5][3][5][0] = ostei_deriv1_h_f_h_s_ptr;
+    simint_osteifunc_array[1][5][3][5][1] = ostei_deriv1_h_f_h_p_ptr;
+    simint_osteifunc_array[1][5][3][5][2] = ostei_deriv1_h_f_h_d_ptr;
+    simint_osteifunc_array[1][5][3][5][3] = ostei_deriv1_h_f_h_f_ptr;
+    simint_osteifunc_array[1][5][3][5][4] = ostei_deriv1_h_f_h_g_ptr;
+    simint_osteifunc_array[1][5][3][5][5] = ostei_deriv1_h_f_h_h_ptr;
+    simint_osteifunc_array[1][5][4][0][0] = ostei_deriv1_h_g_s_s_ptr;
+    simint_osteifunc_array[1][5][4][0][1] = ostei_deriv1_h_g_s_p_ptr;
+    simint_osteifunc_array[1][5][4][0][2] = ostei_deriv1_h_g_s_d_ptr;
+    simint_osteifunc_array[1][5][4][0][3] = ostei_deriv1_h_g_s_f_ptr;
+    simint_osteifunc_array[1][5][4][0][4] = ostei_deriv1_h_g_s_g_ptr;
+    simint_osteifunc_array[1][5][4][0][5] = ostei_deriv1_h_g_s_h_ptr;
+    simint_osteifunc_array[1][5][4][1][0] = ostei_deriv1_h_g_p_s_ptr;
+    simint_osteifunc_array[1][5][4][1][1] = ostei_deriv1_h_g_p_p_ptr;
+    simint_osteifunc_array[1][5][4][1][2] = ostei_deriv1_h_g_p_d_ptr;
+    simint_osteifunc_array[1][5][4][1][3] = ostei_deriv1_h_g_p_f_ptr;
+    simint_osteifunc_array[1][5][4][1][4] = ostei_deriv1_h_g_p_g_ptr;
+    simint_osteifunc_array[1][5][4][1][5] = ostei_deriv1_h_g_p_h_ptr;
+    simint_osteifunc_array[1][5][4][2][0] = ostei_deriv1_h_g_d_s_ptr;
+    simint_osteifunc_array[1][5][4][2][1] = ostei_deriv1_h_g_d_p_ptr;
+    simint_osteifunc_array[1][5][4][2][2] = ostei_deriv1_h_g_d_d_ptr;
+    simint_osteifunc_array[1][5][4][2][3] = ostei_deriv1_h_g_d_f_ptr;
+    simint_osteifunc_array[1][5][4][2][4] = ostei_deriv1_h_g_d_g_ptr;
+    simint_osteifunc_array[1][5][4][2][5] = ostei_deriv1_h_g_d_h_ptr;
+    simint_osteifunc_array[1][5][4][3][0] = ostei_deriv1_h_g_f_s_ptr;
+    simint_osteifunc_array[1][5][4][3][1] = ostei_deriv1_h_g_f_p_ptr;
+    simint_osteifunc_array[1][5][4][3][2] = ostei_deriv1_h_g_f_d_ptr;
+    simint_osteifunc_array[1][5][4][3][3] = ostei_deriv1_h_g_f_f_ptr;
+    simint_osteifunc_array[1][5][4][3][4] = ostei_deriv1_h_g_f_g_ptr;
+    simint_osteifunc_array[1][5][4][3][5] = ostei_deriv1_h_g_f_h_ptr;
+    simint_osteifunc_array[1][5][4][4][0] = ostei_deriv1_h_g_g_s_ptr;
+    simint_osteifunc_array[1][5][4][4][1] = ostei_deriv1_h_g_g_p_ptr;
+    simint_osteifunc_array[1][5][4][4][2] = ostei_deriv1_h_g_g_d_ptr;
+    simint_osteifunc_array[1][5][4][4][3] = ostei_deriv1_h_g_g_f_ptr;
+    simint_osteifunc_array[1][5][4][4][4] = ostei_deriv1_h_g_g_g_ptr;
+    simint_osteifunc_array[1][5][4][4][5] = ostei_deriv1_h_g_g_h_ptr;
+    simint_osteifunc_array[1][5][4][5][0] = ostei_deriv1_h_g_h_s_ptr;
+    simint_osteifunc_array[1][5][4][5][1] = ostei_deriv1_h_g_h_p_ptr;
+    simint_osteifunc_array[1][5][4][5][2] = ostei_deriv1_h_g_h_d_ptr;
+    simint_osteifunc_array[1][5][4][5][3] = ostei_deriv1_h_g_h_f_ptr;
+    simint_osteifunc_array[1][5][4][5][4] = ostei_deriv1_h_g_h_g_ptr;
+    simint_osteifunc_array[1][5][4][5][5] = ostei_deriv1_h_g_h_h_ptr;
+    simint_osteifunc_array[1][5][5][0][0] = ostei_deriv1_h_h_s_s_ptr;
+    simint_osteifunc_array[1][5][5][0][1] = ostei_deriv1_h_h_s_p_ptr;
+    simint_osteifunc_array[1][5][5][0][2] = ostei_deriv1_h_h_s_d_ptr;
+    simint_osteifunc_array[1][5][5][0][3] = ostei_deriv1_h_h_s_f_ptr;
+    simint_osteifunc_array[1][5][5][0][4] = ostei_deriv1_h_h_s_g_ptr;
+    simint_osteifunc_array[1][5][5][0][5] = ostei_deriv1_h_h_s_h_ptr;
+    simint_osteifunc_array[1][5][5][1][0] = ostei_deriv1_h_h_p_s_ptr;
+    simint_osteifunc_array[1][5][5][1][1] = ostei_deriv1_h_h_p_p_ptr;
+    simint_osteifunc_array[1][5][5][1][2] = ostei_deriv1_h_h_p_d_ptr;
+    simint_osteifunc_array[1][5][5][1][3] = ostei_deriv1_h_h_p_f_ptr;
+    simint_osteifunc_array[1][5][5][1][4] = ostei_deriv1_h_h_p_g_ptr;
+    simint_osteifunc_array[1][5][5][1][5] = ostei_deriv1_h_h_p_h_ptr;
+    simint_osteifunc_array[1][5][5][2][0] = ostei_deriv1_h_h_d_s_ptr;
+    simint_osteifunc_array[1][5][5][2][1] = ostei_deriv1_h_h_d_p_ptr;
+    simint_osteifunc_array[1][5][5][2][2] = ostei_deriv1_h_h_d_d_ptr;
+    simint_osteifunc_array[1][5][5][2][3] = ostei_deriv1_h_h_d_f_ptr;
+    simint_osteifunc_array[1][5][5][2][4] = ostei_deriv1_h_h_d_g_ptr;
+    simint_osteifunc_array[1][5][5][2][5] = ostei_deriv1_h_h_d_h_ptr;
+    simint_osteifunc_array[1][5][5][3][0] = ostei_deriv1_h_h_f_s_ptr;
+    simint_osteifunc_array[1][5][5][3][1] = ostei_deriv1_h_h_f_p_ptr;
+    simint_osteifunc_array[1][5][5][3][2] = ostei_deriv1_h_h_f_d_ptr;
+    simint_osteifunc_array[1][5][5][3][3] = ostei_deriv1_h_h_f_f_ptr;
+    simint_osteifunc_array[1][5][5][3][4] = ostei_deriv1_h_h_f_g_ptr;
+    simint_osteifunc_array[1][5][5][3][5] = ostei_deriv1_h_h_f_h_ptr;
+    simint_osteifunc_array[1][5][5][4][0] = ostei_deriv1_h_h_g_s_ptr;
+    simint_osteifunc_array[1][5][5][4][1] = ostei_deriv1_h_h_g_p_ptr;
+    simint_osteifunc_array[1][5][5][4][2] = ostei_deriv1_h_h_g_d_ptr;
+    simint_osteifunc_array[1][5][5][4][3] = ostei_deriv1_h_h_g_f_ptr;
+    simint_osteifunc_array[1][5][5][4][4] = ostei_deriv1_h_h_g_g_ptr;
+    simint_osteifunc_array[1][5][5][4][5] = ostei_deriv1_h_h_g_h_ptr;
+    simint_osteifunc_array[1][5][5][5][0] = ostei_deriv1_h_h_h_s_ptr;
+    simint_osteifunc_array[1][5][5][5][1] = ostei_deriv1_h_h_h_p_ptr;
+    simint_osteifunc_array[1][5][5][5][2] = ostei_deriv1_h_h_h_d_ptr;
+    simint_osteifunc_array[1][5][5][5][3] = ostei_deriv1_h_h_h_f_ptr;
+    simint_osteifunc_array[1][5][5][5][4] = ostei_deriv1_h_h_h_g_ptr;
+    simint_osteifunc_array[1][5][5][5][5] = ostei_deriv1_h_h_h_h_ptr;
     #endif
 
 }
@@ -0,0 +1,305 @@
+/*
+ Generated with:
+   ../../../python/gen_fill.py -l 5 -df ostei_df_init.c
+*/
+
+
+
+#include "simint/ostei/ostei.h"
+#include "simint/ostei/ostei_init.h"
+#include "simint/ostei/ostei_config.h"
+#if SIMINT_OSTEI_DF
+#include "simint/ostei/gen/ostei_df_generated.h"
+#endif
+
+
+// Stores pointers to the ostei functions
+#define AMSIZE   SIMINT_OSTEI_MAXAM+1
+extern simint_osteifunc simint_osteifunc_3c_array[AMSIZE][AMSIZE][AMSIZE];
+extern simint_osteifunc simint_osteifunc_2c_array[AMSIZE][AMSIZE];
+
+
+
+void simint_ostei_df_finalize(void)
+{
+    // nothing to do
+}
+
+
+void simint_ostei_df_init(void)
+{
+    #if SIMINT_OSTEI_DF
+
+    #if SIMINT_OSTEI_MAXAM >= 0
+    simint_osteifunc_3c_array[0][0][0] = ostei_3c_s_s_s_ptr;
+    simint_osteifunc_2c_array[0][0] = ostei_2c_s_s_ptr;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 1
+    simint_osteifunc_3c_array[0][0][1] = ostei_3c_s_s_p_ptr;
+    simint_osteifunc_3c_array[0][1][0] = ostei_3c_s_p_s_ptr;
+    simint_osteifunc_3c_array[0][1][1] = ostei_3c_s_p_p_ptr;
+    simint_osteifunc_3c_array[1][0][0] = ostei_3c_p_s_s_ptr;
+    simint_osteifunc_3c_array[1][0][1] = ostei_3c_p_s_p_ptr;
+    simint_osteifunc_3c_array[1][1][0] = ostei_3c_p_p_s_ptr;
+    simint_osteifunc_3c_array[1][1][1] = ostei_3c_p_p_p_ptr;
+    simint_osteifunc_2c_array[0][1] = ostei_2c_s_p_ptr;
+    simint_osteifunc_2c_array[1][0] = ostei_2c_p_s_ptr;
+    simint_osteifunc_2c_array[1][1] = ostei_2c_p_p_ptr;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 2
+    simint_osteifunc_3c_array[0][0][2] = ostei_3c_s_s_d_ptr;
+    simint_osteifunc_3c_array[0][1][2] = ostei_3c_s_p_d_ptr;
+    simint_osteifunc_3c_array[0][2][0] = ostei_3c_s_d_s_ptr;
+    simint_osteifunc_3c_array[0][2][1] = ostei_3c_s_d_p_ptr;
+    simint_osteifunc_3c_array[0][2][2] = ostei_3c_s_d_d_ptr;
+    simint_osteifunc_3c_array[1][0][2] = ostei_3c_p_s_d_ptr;
+    simint_osteifunc_3c_array[1][1][2] = ostei_3c_p_p_d_ptr;
+    simint_osteifunc_3c_array[1][2][0] = ostei_3c_p_d_s_ptr;
+    simint_osteifunc_3c_array[1][2][1] = ostei_3c_p_d_p_ptr;
+    simint_osteifunc_3c_array[1][2][2] = ostei_3c_p_d_d_ptr;
+    simint_osteifunc_3c_array[2][0][0] = ostei_3c_d_s_s_ptr;
+    simint_osteifunc_3c_array[2][0][1] = ostei_3c_d_s_p_ptr;
+    simint_osteifunc_3c_array[2][0][2] = ostei_3c_d_s_d_ptr;
+    simint_osteifunc_3c_array[2][1][0] = ostei_3c_d_p_s_ptr;
+    simint_osteifunc_3c_array[2][1][1] = ostei_3c_d_p_p_ptr;
+    simint_osteifunc_3c_array[2][1][2] = ostei_3c_d_p_d_ptr;
+    simint_osteifunc_3c_array[2][2][0] = ostei_3c_d_d_s_ptr;
+    simint_osteifunc_3c_array[2][2][1] = ostei_3c_d_d_p_ptr;
+    simint_osteifunc_3c_array[2][2][2] = ostei_3c_d_d_d_ptr;
+    simint_osteifunc_2c_array[0][2] = ostei_2c_s_d_ptr;
+    simint_osteifunc_2c_array[1][2] = ostei_2c_p_d_ptr;
+    simint_osteifunc_2c_array[2][0] = ostei_2c_d_s_ptr;
+    simint_osteifunc_2c_array[2][1] = ostei_2c_d_p_ptr;
+    simint_osteifunc_2c_array[2][2] = ostei_2c_d_d_ptr;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 3
+    simint_osteifunc_3c_array[0][0][3] = ostei_3c_s_s_f_ptr;
+    simint_osteifunc_3c_array[0][1][3] = ostei_3c_s_p_f_ptr;
+    simint_osteifunc_3c_array[0][2][3] = ostei_3c_s_d_f_ptr;
+    simint_osteifunc_3c_array[0][3][0] = ostei_3c_s_f_s_ptr;
+    simint_osteifunc_3c_array[0][3][1] = ostei_3c_s_f_p_ptr;
+    simint_osteifunc_3c_array[0][3][2] = ostei_3c_s_f_d_ptr;
+    simint_osteifunc_3c_array[0][3][3] = ostei_3c_s_f_f_ptr;
+    simint_osteifunc_3c_array[1][0][3] = ostei_3c_p_s_f_ptr;
+    simint_osteifunc_3c_array[1][1][3] = ostei_3c_p_p_f_ptr;
+    simint_osteifunc_3c_array[1][2][3] = ostei_3c_p_d_f_ptr;
+    simint_osteifunc_3c_array[1][3][0] = ostei_3c_p_f_s_ptr;
+    simint_osteifunc_3c_array[1][3][1] = ostei_3c_p_f_p_ptr;
+    simint_osteifunc_3c_array[1][3][2] = ostei_3c_p_f_d_ptr;
+    simint_osteifunc_3c_array[1][3][3] = ostei_3c_p_f_f_ptr;
+    simint_osteifunc_3c_array[2][0][3] = ostei_3c_d_s_f_ptr;
+    simint_osteifunc_3c_array[2][1][3] = ostei_3c_d_p_f_ptr;
+    simint_osteifunc_3c_array[2][2][3] = ostei_3c_d_d_f_ptr;
+    simint_osteifunc_3c_array[2][3][0] = ostei_3c_d_f_s_ptr;
+    simint_osteifunc_3c_array[2][3][1] = ostei_3c_d_f_p_ptr;
+    simint_osteifunc_3c_array[2][3][2] = ostei_3c_d_f_d_ptr;
+    simint_osteifunc_3c_array[2][3][3] = ostei_3c_d_f_f_ptr;
+    simint_osteifunc_3c_array[3][0][0] = ostei_3c_f_s_s_ptr;
+    simint_osteifunc_3c_array[3][0][1] = ostei_3c_f_s_p_ptr;
+    simint_osteifunc_3c_array[3][0][2] = ostei_3c_f_s_d_ptr;
+    simint_osteifunc_3c_array[3][0][3] = ostei_3c_f_s_f_ptr;
+    simint_osteifunc_3c_array[3][1][0] = ostei_3c_f_p_s_ptr;
+    simint_osteifunc_3c_array[3][1][1] = ostei_3c_f_p_p_ptr;
+    simint_osteifunc_3c_array[3][1][2] = ostei_3c_f_p_d_ptr;
+    simint_osteifunc_3c_array[3][1][3] = ostei_3c_f_p_f_ptr;
+    simint_osteifunc_3c_array[3][2][0] = ostei_3c_f_d_s_ptr;
+    simint_osteifunc_3c_array[3][2][1] = ostei_3c_f_d_p_ptr;
+    simint_osteifunc_3c_array[3][2][2] = ostei_3c_f_d_d_ptr;
+    simint_osteifunc_3c_array[3][2][3] = ostei_3c_f_d_f_ptr;
+    simint_osteifunc_3c_array[3][3][0] = ostei_3c_f_f_s_ptr;
+    simint_osteifunc_3c_array[3][3][1] = ostei_3c_f_f_p_ptr;
+    simint_osteifunc_3c_array[3][3][2] = ostei_3c_f_f_d_ptr;
+    simint_osteifunc_3c_array[3][3][3] = ostei_3c_f_f_f_ptr;
+    simint_osteifunc_2c_array[0][3] = ostei_2c_s_f_ptr;
+    simint_osteifunc_2c_array[1][3] = ostei_2c_p_f_ptr;
+    simint_osteifunc_2c_array[2][3] = ostei_2c_d_f_ptr;
+    simint_osteifunc_2c_array[3][0] = ostei_2c_f_s_ptr;
+    simint_osteifunc_2c_array[3][1] = ostei_2c_f_p_ptr;
+    simint_osteifunc_2c_array[3][2] = ostei_2c_f_d_ptr;
+    simint_osteifunc_2c_array[3][3] = ostei_2c_f_f_ptr;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 4
+    simint_osteifunc_3c_array[0][0][4] = ostei_3c_s_s_g_ptr;
+    simint_osteifunc_3c_array[0][1][4] = ostei_3c_s_p_g_ptr;
+    simint_osteifunc_3c_array[0][2][4] = ostei_3c_s_d_g_ptr;
+    simint_osteifunc_3c_array[0][3][4] = ostei_3c_s_f_g_ptr;
+    simint_osteifunc_3c_array[0][4][0] = ostei_3c_s_g_s_ptr;
+    simint_osteifunc_3c_array[0][4][1] = ostei_3c_s_g_p_ptr;
+    simint_osteifunc_3c_array[0][4][2] = ostei_3c_s_g_d_ptr;
+    simint_osteifunc_3c_array[0][4][3] = ostei_3c_s_g_f_ptr;
+    simint_osteifunc_3c_array[0][4][4] = ostei_3c_s_g_g_ptr;
+    simint_osteifunc_3c_array[1][0][4] = ostei_3c_p_s_g_ptr;
+    simint_osteifunc_3c_array[1][1][4] = ostei_3c_p_p_g_ptr;
+    simint_osteifunc_3c_array[1][2][4] = ostei_3c_p_d_g_ptr;
+    simint_osteifunc_3c_array[1][3][4] = ostei_3c_p_f_g_ptr;
+    simint_osteifunc_3c_array[1][4][0] = ostei_3c_p_g_s_ptr;
+    simint_osteifunc_3c_array[1][4][1] = ostei_3c_p_g_p_ptr;
+    simint_osteifunc_3c_array[1][4][2] = ostei_3c_p_g_d_ptr;
+    simint_osteifunc_3c_array[1][4][3] = ostei_3c_p_g_f_ptr;
+    simint_osteifunc_3c_array[1][4][4] = ostei_3c_p_g_g_ptr;
+    simint_osteifunc_3c_array[2][0][4] = ostei_3c_d_s_g_ptr;
+    simint_osteifunc_3c_array[2][1][4] = ostei_3c_d_p_g_ptr;
+    simint_osteifunc_3c_array[2][2][4] = ostei_3c_d_d_g_ptr;
+    simint_osteifunc_3c_array[2][3][4] = ostei_3c_d_f_g_ptr;
+    simint_osteifunc_3c_array[2][4][0] = ostei_3c_d_g_s_ptr;
+    simint_osteifunc_3c_array[2][4][1] = ostei_3c_d_g_p_ptr;
+    simint_osteifunc_3c_array[2][4][2] = ostei_3c_d_g_d_ptr;
+    simint_osteifunc_3c_array[2][4][3] = ostei_3c_d_g_f_ptr;
+    simint_osteifunc_3c_array[2][4][4] = ostei_3c_d_g_g_ptr;
+    simint_osteifunc_3c_array[3][0][4] = ostei_3c_f_s_g_ptr;
+    simint_osteifunc_3c_array[3][1][4] = ostei_3c_f_p_g_ptr;
+    simint_osteifunc_3c_array[3][2][4] = ostei_3c_f_d_g_ptr;
+    simint_osteifunc_3c_array[3][3][4] = ostei_3c_f_f_g_ptr;
+    simint_osteifunc_3c_array[3][4][0] = ostei_3c_f_g_s_ptr;
+    simint_osteifunc_3c_array[3][4][1] = ostei_3c_f_g_p_ptr;
+    simint_osteifunc_3c_array[3][4][2] = ostei_3c_f_g_d_ptr;
+    simint_osteifunc_3c_array[3][4][3] = ostei_3c_f_g_f_ptr;
+    simint_osteifunc_3c_array[3][4][4] = ostei_3c_f_g_g_ptr;
+    simint_osteifunc_3c_array[4][0][0] = ostei_3c_g_s_s_ptr;
+    simint_osteifunc_3c_array[4][0][1] = ostei_3c_g_s_p_ptr;
+    simint_osteifunc_3c_array[4][0][2] = ostei_3c_g_s_d_ptr;
+    simint_osteifunc_3c_array[4][0][3] = ostei_3c_g_s_f_ptr;
+    simint_osteifunc_3c_array[4][0][4] = ostei_3c_g_s_g_ptr;
+    simint_osteifunc_3c_array[4][1][0] = ostei_3c_g_p_s_ptr;
+    simint_osteifunc_3c_array[4][1][1] = ostei_3c_g_p_p_ptr;
+    simint_osteifunc_3c_array[4][1][2] = ostei_3c_g_p_d_ptr;
+    simint_osteifunc_3c_array[4][1][3] = ostei_3c_g_p_f_ptr;
+    simint_osteifunc_3c_array[4][1][4] = ostei_3c_g_p_g_ptr;
+    simint_osteifunc_3c_array[4][2][0] = ostei_3c_g_d_s_ptr;
+    simint_osteifunc_3c_array[4][2][1] = ostei_3c_g_d_p_ptr;
+    simint_osteifunc_3c_array[4][2][2] = ostei_3c_g_d_d_ptr;
+    simint_osteifunc_3c_array[4][2][3] = ostei_3c_g_d_f_ptr;
+    simint_osteifunc_3c_array[4][2][4] = ostei_3c_g_d_g_ptr;
+    simint_osteifunc_3c_array[4][3][0] = ostei_3c_g_f_s_ptr;
+    simint_osteifunc_3c_array[4][3][1] = ostei_3c_g_f_p_ptr;
+    simint_osteifunc_3c_array[4][3][2] = ostei_3c_g_f_d_ptr;
+    simint_osteifunc_3c_array[4][3][3] = ostei_3c_g_f_f_ptr;
+    simint_osteifunc_3c_array[4][3][4] = ostei_3c_g_f_g_ptr;
+    simint_osteifunc_3c_array[4][4][0] = ostei_3c_g_g_s_ptr;
+    simint_osteifunc_3c_array[4][4][1] = ostei_3c_g_g_p_ptr;
+    simint_osteifunc_3c_array[4][4][2] = ostei_3c_g_g_d_ptr;
+    simint_osteifunc_3c_array[4][4][3] = ostei_3c_g_g_f_ptr;
+    simint_osteifunc_3c_array[4][4][4] = ostei_3c_g_g_g_ptr;
+    simint_osteifunc_2c_array[0][4] = ostei_2c_s_g_ptr;
+    simint_osteifunc_2c_array[1][4] = ostei_2c_p_g_ptr;
+    simint_osteifunc_2c_array[2][4] = ostei_2c_d_g_ptr;
+    simint_osteifunc_2c_array[3][4] = ostei_2c_f_g_ptr;
+    simint_osteifunc_2c_array[4][0] = ostei_2c_g_s_ptr;
+    simint_osteifunc_2c_array[4][1] = ostei_2c_g_p_ptr;
+    simint_osteifunc_2c_array[4][2] = ostei_2c_g_d_ptr;
+    simint_osteifunc_2c_array[4][3] = ostei_2c_g_f_ptr;
+    simint_osteifunc_2c_array[4][4] = ostei_2c_g_g_ptr;
+    #endif
+
+    #if SIMINT_OSTEI_MAXAM >= 5
+    simint_osteifunc_3c_array[0][0][5] = ostei_3c_s_s_h_ptr;
+    simint_osteifunc_3c_array[0][1][5] = ostei_3c_s_p_h_ptr;
+    simint_osteifunc_3c_array[0][2][5] = ostei_3c_s_d_h_ptr;
+    simint_osteifunc_3c_array[0][3][5] = ostei_3c_s_f_h_ptr;
+    simint_osteifunc_3c_array[0][4][5] = ostei_3c_s_g_h_ptr;
+    simint_osteifunc_3c_array[0][5][0] = ostei_3c_s_h_s_ptr;
+    simint_osteifunc_3c_array[0][5][1] = ostei_3c_s_h_p_ptr;
+    simint_osteifunc_3c_array[0][5][2] = ostei_3c_s_h_d_ptr;
+    simint_osteifunc_3c_array[0][5][3] = ostei_3c_s_h_f_ptr;
+    simint_osteifunc_3c_array[0][5][4] = ostei_3c_s_h_g_ptr;
+    simint_osteifunc_3c_array[0][5][5] = ostei_3c_s_h_h_ptr;
+    simint_osteifunc_3c_array[1][0][5] = ostei_3c_p_s_h_ptr;
+    simint_osteifunc_3c_array[1][1][5] = ostei_3c_p_p_h_ptr;
+    simint_osteifunc_3c_array[1][2][5] = ostei_3c_p_d_h_ptr;
+    simint_osteifunc_3c_array[1][3][5] = ostei_3c_p_f_h_ptr;
+    simint_osteifunc_3c_array[1][4][5] = ostei_3c_p_g_h_ptr;
+    simint_osteifunc_3c_array[1][5][0] = ostei_3c_p_h_s_ptr;
+    simint_osteifunc_3c_array[1][5][1] = ostei_3c_p_h_p_ptr;
+    simint_osteifunc_3c_array[1][5][2] = ostei_3c_p_h_d_ptr;
+    simint_osteifunc_3c_array[1][5][3] = ostei_3c_p_h_f_ptr;
+    simint_osteifunc_3c_array[1][5][4] = ostei_3c_p_h_g_ptr;
+    simint_osteifunc_3c_array[1][5][5] = ostei_3c_p_h_h_ptr;
+    simint_osteifunc_3c_array[2][0][5] = ostei_3c_d_s_h_ptr;
+    simint_osteifunc_3c_array[2][1][5] = ostei_3c_d_p_h_ptr;
+    simint_osteifunc_3c_array[2][2][5] = ostei_3c_d_d_h_ptr;
+    simint_osteifunc_3c_array[2][3][5] = ostei_3c_d_f_h_ptr;
+    simint_osteifunc_3c_array[2][4][5] = ostei_3c_d_g_h_ptr;
+    simint_osteifunc_3c_array[2][5][0] = ostei_3c_d_h_s_ptr;
+    simint_osteifunc_3c_array[2][5][1] = ostei_3c_d_h_p_ptr;
+    simint_osteifunc_3c_array[2][5][2] = ostei_3c_d_h_d_ptr;
+    simint_osteifunc_3c_array[2][5][3] = ostei_3c_d_h_f_ptr;
+    simint_osteifunc_3c_array[2][5][4] = ostei_3c_d_h_g_ptr;
+    simint_osteifunc_3c_array[2][5][5] = ostei_3c_d_h_h_ptr;
+    simint_osteifunc_3c_array[3][0][5] = ostei_3c_f_s_h_ptr;
+    simint_osteifunc_3c_array[3][1][5] = ostei_3c_f_p_h_ptr;
+    simint_osteifunc_3c_array[3][2][5] = ostei_3c_f_d_h_ptr;
+    simint_osteifunc_3c_array[3][3][5] = ostei_3c_f_f_h_ptr;
+    simint_osteifunc_3c_array[3][4][5] = ostei_3c_f_g_h_ptr;
+    simint_osteifunc_3c_array[3][5][0] = ostei_3c_f_h_s_ptr;
+    simint_osteifunc_3c_array[3][5][1] = ostei_3c_f_h_p_ptr;
+    simint_osteifunc_3c_array[3][5][2] = ostei_3c_f_h_d_ptr;
+    simint_osteifunc_3c_array[3][5][3] = ostei_3c_f_h_f_ptr;
+    simint_osteifunc_3c_array[3][5][4] = ostei_3c_f_h_g_ptr;
+    simint_osteifunc_3c_array[3][5][5] = ostei_3c_f_h_h_ptr;
+    simint_osteifunc_3c_array[4][0][5] = ostei_3c_g_s_h_ptr;
+    simint_osteifunc_3c_array[4][1][5] = ostei_3c_g_p_h_ptr;
+    simint_osteifunc_3c_array[4][2][5] = ostei_3c_g_d_h_ptr;
+    simint_osteifunc_3c_array[4][3][5] = ostei_3c_g_f_h_ptr;
+    simint_osteifunc_3c_array[4][4][5] = ostei_3c_g_g_h_ptr;
+    simint_osteifunc_3c_array[4][5][0] = ostei_3c_g_h_s_ptr;
+    simint_osteifunc_3c_array[4][5][1] = ostei_3c_g_h_p_ptr;
+    simint_osteifunc_3c_array[4][5][2] = ostei_3c_g_h_d_ptr;
+    simint_osteifunc_3c_array[4][5][3] = ostei_3c_g_h_f_ptr;
+    simint_osteifunc_3c_array[4][5][4] = ostei_3c_g_h_g_ptr;
+    simint_osteifunc_3c_array[4][5][5] = ostei_3c_g_h_h_ptr;
+    simint_osteifunc_3c_array[5][0][0] = ostei_3c_h_s_s_ptr;
+    simint_osteifunc_3c_array[5][0][1] = ostei_3c_h_s_p_ptr;
+    simint_osteifunc_3c_array[5][0][2] = ostei_3c_h_s_d_ptr;
+    simint_osteifunc_3c_array[5][0][3] = ostei_3c_h_s_f_ptr;
+    simint_osteifunc_3c_array[5][0][4] = ostei_3c_h_s_g_ptr;
+    simint_osteifunc_3c_array[5][0][5] = ostei_3c_h_s_h_ptr;
+    simint_osteifunc_3c_array[5][1][0] = ostei_3c_h_p_s_ptr;
+    simint_osteifunc_3c_array[5][1][1] = ostei_3c_h_p_p_ptr;
+    simint_osteifunc_3c_array[5][1][2] = ostei_3c_h_p_d_ptr;
+    simint_osteifunc_3c_array[5][1][3] = ostei_3c_h_p_f_ptr;
+    simint_osteifunc_3c_array[5][1][4] = ostei_3c_h_p_g_ptr;
+    simint_osteifunc_3c_array[5][1][5] = ostei_3c_h_p_h_ptr;
+    simint_osteifunc_3c_array[5][2][0] = ostei_3c_h_d_s_ptr;
+    simint_osteifunc_3c_array[5][2][1] = ostei_3c_h_d_p_ptr;
+    simint_osteifunc_3c_array[5][2][2] = ostei_3c_h_d_d_ptr;
+    simint_osteifunc_3c_array[5][2][3] = ostei_3c_h_d_f_ptr;
+    simint_osteifunc_3c_array[5][2][4] = ostei_3c_h_d_g_ptr;
+    simint_osteifunc_3c_array[5][2][5] = ostei_3c_h_d_h_ptr;
+    simint_osteifunc_3c_array[5][3][0] = ostei_3c_h_f_s_ptr;
+    simint_osteifunc_3c_array[5][3][1] = ostei_3c_h_f_p_ptr;
+    simint_osteifunc_3c_array[5][3][2] = ostei_3c_h_f_d_ptr;
+    simint_osteifunc_3c_array[5][3][3] = ostei_3c_h_f_f_ptr;
+    simint_osteifunc_3c_array[5][3][4] = ostei_3c_h_f_g_ptr;
+    simint_osteifunc_3c_array[5][3][5] = ostei_3c_h_f_h_ptr;
+    simint_osteifunc_3c_array[5][4][0] = ostei_3c_h_g_s_ptr;
+    simint_osteifunc_3c_array[5][4][1] = ostei_3c_h_g_p_ptr;
+    simint_osteifunc_3c_array[5][4][2] = ostei_3c_h_g_d_ptr;
+    simint_osteifunc_3c_array[5][4][3] = ostei_3c_h_g_f_ptr;
+    simint_osteifunc_3c_array[5][4][4] = ostei_3c_h_g_g_ptr;
+    simint_osteifunc_3c_array[5][4][5] = ostei_3c_h_g_h_ptr;
+    simint_osteifunc_3c_array[5][5][0] = ostei_3c_h_h_s_ptr;
+    simint_osteifunc_3c_array[5][5][1] = ostei_3c_h_h_p_ptr;
+    simint_osteifunc_3c_array[5][5][2] = ostei_3c_h_h_d_ptr;
+    simint_osteifunc_3c_array[5][5][3] = ostei_3c_h_h_f_ptr;
+    simint_osteifunc_3c_array[5][5][4] = ostei_3c_h_h_g_ptr;
+    simint_osteifunc_3c_array[5][5][5] = ostei_3c_h_h_h_ptr;
+    simint_osteifunc_2c_array[0][5] = ostei_2c_s_h_ptr;
+    simint_osteifunc_2c_array[1][5] = ostei_2c_p_h_ptr;
+    simint_osteifunc_2c_array[2][5] = ostei_2c_d_h_ptr;
+    simint_osteifunc_2c_array[3][5] = ostei_2c_f_h_ptr;
+    simint_osteifunc_2c_array[4][5] = ostei_2c_g_h_ptr;
+    simint_osteifunc_2c_array[5][0] = ostei_2c_h_s_ptr;
+    simint_osteifunc_2c_array[5][1] = ostei_2c_h_p_ptr;
+    simint_osteifunc_2c_array[5][2] = ostei_2c_h_d_ptr;
+    simint_osteifunc_2c_array[5][3] = ostei_2c_h_f_ptr;
+    simint_osteifunc_2c_array[5][4] = ostei_2c_h_g_ptr;
+    simint_osteifunc_2c_array[5][5] = ostei_2c_h_h_ptr;
+    #endif
+
+    #endif // SIMINT_OSTEI_DF
+}
+
@@ -20,6 +20,22 @@ void simint_ostei_init(void);
 void simint_ostei_deriv1_init(void);
 
 
+/*! \brief Initializes the single-precision OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_float_init(void);
+
+
+/*! \brief Initializes the 3- and 2-center OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_df_init(void);
+
+
 /*! \brief Finalizes the OSTEI functionality
  *
  * \warning This is not expected to be called directly from
@@ -36,6 +52,22 @@ void simint_ostei_finalize(void);
 void simint_ostei_deriv1_finalize(void);
 
 
+/*! \brief Finalizes the single-precision OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_float_finalize(void);
+
+
+/*! \brief Finalizes the 3- and 2-center OSTEI functionality
+ *
+ * \warning This is not expected to be called directly from
+ *          outside the library
+ */
+void simint_ostei_df_finalize(void);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,16 +23,14 @@
 extern double const norm_fac[SHELL_PRIM_NORMFAC_MAXL+1];
 
 
-#define SWAP_D(a) tmp_d = ((a)[idxi]); ((a)[idxi]) = ((a)[idxi+1]); ((a)[idxi+1]) = tmp_d;
-
-
 // huangh223, 03/02/18
-// Note: simint_sort_multi_shellpair() is using bubble sort, 
-// sometimes it takes a lot of time when it is called from 
-// GTFock commit 69884fe and libcint commit de13c0f. 
-// Use a quick sort to replace it.
+// Note: the primitives used to be sorted with a bubble sort
+// (simint_sort_multi_shellpair(), now removed), which sometimes
+// took a lot of time when called from GTFock commit 69884fe and
+// libcint commit de13c0f. A quick sort is used instead.
 
 #define SWAP_DOUBLE(a, b) tmp_dbl = (a); (a) = (b); (b) = tmp_dbl;
+#define SWAP_INT(a, b) tmp_int = (a); (a) = (b); (b) = tmp_int;
 
 static void 
 simint_shellpair_screenval_quicksort(
@@ -42,6 +40,7 @@ simint_shellpair_screenval_quicksort(
 {
     int i = left, j = right;
     double mid = P->screen[(i + j) / 2], tmp_dbl;
+    int tmp_int;
     while (i <= j)
     {
         while (P->screen[i] > mid) i++;
@@ -58,8 +57,11 @@ simint_shellpair_screenval_quicksort(
             SWAP_DOUBLE(P->PB_y[i], P->PB_y[j]);
             SWAP_DOUBLE(P->PB_z[i], P->PB_z[j]);
             SWAP_DOUBLE(P->alpha[i], P->alpha[j]);
+            SWAP_DOUBLE(P->alpha_a[i], P->alpha_a[j]);
+            SWAP_DOUBLE(P->beta[i], P->beta[j]);
             SWAP_DOUBLE(P->prefac[i], P->prefac[j]);
             SWAP_DOUBLE(P->screen[i], P->screen[j]);
+            SWAP_INT(P->primij[i], P->primij[j]);
             
             #if SIMINT_OSTEI_MAXDER > 0
             SWAP_DOUBLE(P->alpha2[i], P->alpha2[j]);
@@ -73,61 +75,6 @@ simint_shellpair_screenval_quicksort(
     if (j > left)  simint_shellpair_screenval_quicksort(P, left, j);
 }
 
-static void
-simint_sort_multi_shellpair(struct simint_multi_shellpair * P)
-{
-    if(P->nprim == 1)
-        return;
-
-    int idx = 0;
-    double tmp_d;
-
-    for(int ab = 0; ab < P->nshell12; ab++)
-    {
-        /*
-        int swapped;
-        do {
-            swapped = 0;
-            for(int i = 0; i < (P->nprim12[ab]-1); i++)
-            {
-                const int idxi = idx + i;
-                if(P->screen[idxi] < P->screen[idxi+1])
-                {
-                    SWAP_D(P->x)
-                    SWAP_D(P->y)
-                    SWAP_D(P->z)
-                    SWAP_D(P->PA_x)
-                    SWAP_D(P->PA_y)
-                    SWAP_D(P->PA_z)
-                    SWAP_D(P->PB_x)
-                    SWAP_D(P->PB_y)
-                    SWAP_D(P->PB_z)
-                    SWAP_D(P->alpha)
-                    SWAP_D(P->prefac)
-                    SWAP_D(P->screen)
-
-                    #if SIMINT_OSTEI_MAXDER > 0
-                    SWAP_D(P->alpha2);
-                    SWAP_D(P->beta2);
-                    #endif
-
-                    swapped = 1;
-                }
-            }
-        } while(swapped);
-        */
-        simint_shellpair_screenval_quicksort(P, idx, idx + P->nprim12[ab] - 1);
-
-        idx += P->nprim12[ab];
-
-        int ab1 = ab+1;
-        if( (ab1 % SIMINT_NSHELL_SIMD) == 0 || (ab1 >= P->nshell12) )
-            idx = SIMINT_SIMD_ROUND(idx);
-
-    }
-}
-
-
 static void simint_allocate_multi_shellpair_base(int npair, int nprim,
                                                  struct simint_multi_shellpair * P,
                                                  int screen_method)
@@ -136,7 +83,7 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     const size_t ishell12_size = npair * sizeof(int);
     const size_t dshell12_size = npair * sizeof(double);
 
-    int nprim_arr = 11;
+    int nprim_arr = 13;
     if(screen_method)
         nprim_arr++;
         
@@ -144,7 +91,9 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     nprim_arr += 2;
     #endif
 
-    const size_t memsize = dprim_size*nprim_arr + dshell12_size*3 + ishell12_size;
+    const size_t iprim_size = nprim * sizeof(int);
+
+    const size_t memsize = dprim_size*nprim_arr + dshell12_size*3 + ishell12_size + iprim_size;
 
     // Allocate one large space.
     // Only allocate if the currently allocated memory is too small
@@ -166,6 +115,8 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     P->PB_y       = P->ptr + dprim_size*(dcount++);
     P->PB_z       = P->ptr + dprim_size*(dcount++);
     P->alpha      = P->ptr + dprim_size*(dcount++);
+    P->alpha_a    = P->ptr + dprim_size*(dcount++);
+    P->beta       = P->ptr + dprim_size*(dcount++);
     P->prefac     = P->ptr + dprim_size*(dcount++);
 
     if(screen_method)
@@ -182,6 +133,7 @@ static void simint_allocate_multi_shellpair_base(int npair, int nprim,
     P->AB_y       = P->ptr + dcount*dprim_size +   dshell12_size;
     P->AB_z       = P->ptr + dcount*dprim_size + 2*dshell12_size;
     P->nprim12    = P->ptr + dcount*dprim_size + 3*dshell12_size;
+    P->primij     = P->ptr + dcount*dprim_size + 3*dshell12_size + ishell12_size;
 }
 
 
@@ -353,9 +305,12 @@ void simint_allocate_multi_shellpair(int na, struct simint_shell const * A,
 }
 
 
-void simint_allocate_multi_shellpair2(int npair, struct simint_shell const * AB,
-                                      struct simint_multi_shellpair * P,
-                                      int screen_method)
+// Starting index of the primitives of each shell pair in the
+// multi shell pair arrays (if offsets is not NULL). Each batch of
+// SIMINT_NSHELL_SIMD shell pairs is padded to a multiple of the
+// vector length. Returns the total (padded) number of primitives.
+static int simint_shellpair_prim_offsets(int npair, struct simint_shell const * AB,
+                                         int * offsets)
 {
     int nprim = 0;
     int batchprim = 0;
@@ -363,6 +318,9 @@ void simint_allocate_multi_shellpair2(int npair, struct simint_shell const * AB,
 
     for(int i = 0; i < npair; i++)
     {
+        if(offsets != NULL)
+            offsets[i] = nprim + batchprim;
+
         if(compare_shell(&AB[ij], &AB[ij+1]))
             batchprim += ((AB[ij].nprim)*(AB[ij].nprim+1))/2;
         else
@@ -378,6 +336,15 @@ void simint_allocate_multi_shellpair2(int npair, struct simint_shell const * AB,
         ij += 2;
     }
 
+    return nprim;
+}
+
+
+void simint_allocate_multi_shellpair2(int npair, struct simint_shell const * AB,
+                                      struct simint_multi_shellpair * P,
+                                      int screen_method)
+{
+    const int nprim = simint_shellpair_prim_offsets(npair, AB, NULL);
     simint_allocate_multi_shellpair_base(npair, nprim, P, screen_method);
 }
 
@@ -422,157 +389,363 @@ void simint_fill_multi_shellpair(int na, struct simint_shell const * A,
 }
 
 
-void simint_fill_multi_shellpair2(int npair, struct simint_shell const * AB,
-                                  struct simint_multi_shellpair * P,
-                                  int screen_method)
+// Shell pairs to have before filling them in parallel
+#define SIMINT_SHELLPAIR_OMP_MIN 16
+
+
+union simint_shellpair_vec
+{
+    SIMINT_DBLTYPE v;
+    double d[SIMINT_SIMD_LEN];
+};
+
+
+/*! \brief Fills the primitive data for one shell pair
+ *
+ * The primitives of the shell pair are written starting at \p idx.
+ * Only that region of \p P is written, so shell pairs may be
+ * filled concurrently.
+ *
+ * The primitive pairs are handled SIMINT_SIMD_LEN at a time, in the
+ * order they are stored.
+ *
+ * If \p update is nonzero, the shell pair was already filled
+ * (with the same shells, but possibly different centers). Only the
+ * members that depend on the centers are computed, starting from the
+ * existing order of the primitives.
+ */
+static void simint_fill_shellpair_prims(struct simint_shell const * A,
+                                        struct simint_shell const * B,
+                                        struct simint_multi_shellpair * P,
+                                        int idx, int screen_method,
+                                        int update)
 {
-    int i, j, ij, sasb, idx;
+    // are these the same shells?
+    const int same_shell = compare_shell(A, B);
+    const int nprim = (same_shell ? (A->nprim * (A->nprim+1))/2 : A->nprim * B->nprim);
+    const int nvec = SIMINT_SIMD_ROUND(nprim);
 
-    P->nshell12 = npair;
-    P->nshell12_clip = npair; // by default, it's the same
-    P->nprim = 0;
-    P->screen_max = 1.e99;
+    // The primitive pair stored at idx+p (as i*B->nprim + j)
+    int ij[nprim];
 
-    // zero out
-    // This is not really needed, and can be expensive in
-    // direct code
-    // It's not needed since everything will be taken care of
-    // with a prefactor of 0.0
-    //memset(P->ptr, 0, P->memsize);
+    if(update)
+    {
+        for(int p = 0; p < nprim; p++)
+            ij[p] = P->primij[idx+p];
+    }
+    else
+    {
+        int n = 0;
+        for(int i = 0; i < A->nprim; ++i)
+        for(int j = 0; j < (same_shell ? (i+1) : B->nprim); ++j)
+            ij[n++] = i*B->nprim + j;
+    }
+
+    // compute the screening information
+    if(screen_method && update)
+    {
+        // simint_primscreen gives the values in the original order
+        double screen[nprim];
+        simint_primscreen(A, B, screen, screen_method);
+
+        int order[A->nprim * B->nprim];
+        int n = 0;
+        for(int i = 0; i < A->nprim; ++i)
+        for(int j = 0; j < (same_shell ? (i+1) : B->nprim); ++j)
+            order[i*B->nprim + j] = n++;
+
+        for(int p = 0; p < nprim; p++)
+            P->screen[idx+p] = screen[order[ij[p]]];
+    }
+    else if(screen_method)
+        simint_primscreen(A, B, P->screen + idx, screen_method);
 
-    sasb = 0;
-    idx = 0;
+    // exponents and coefficients of each primitive pair
+    // (the padding gets harmless values)
+    double alpha_a[nvec] SIMINT_ALIGN_ARRAY_DBL;
+    double alpha_b[nvec] SIMINT_ALIGN_ARRAY_DBL;
+    double coef_a[nvec] SIMINT_ALIGN_ARRAY_DBL;
+    double coef_b[nvec] SIMINT_ALIGN_ARRAY_DBL;
 
-    ij = 0;
-    for(sasb = 0; sasb < npair; sasb++)
+    for(int p = 0; p < nvec; p++)
     {
-        struct simint_shell const * A = &AB[ij];
-        struct simint_shell const * B = &AB[ij+1];
+        if(p < nprim)
+        {
+            const int i = ij[p] / B->nprim;
+            const int j = ij[p] % B->nprim;
+            alpha_a[p] = A->alpha[i];
+            alpha_b[p] = B->alpha[j];
+            coef_a[p] = A->coef[i];
+            coef_b[p] = B->coef[j];
+        }
+        else
+        {
+            alpha_a[p] = 1.0;
+            alpha_b[p] = 1.0;
+            coef_a[p] = 0.0;
+            coef_b[p] = 0.0;
+        }
+    }
 
-        // compute the screening information
-        if(screen_method)
+    // do Xab = (Xab_x **2 + Xab_y ** 2 + Xab_z **2)
+    const double Xab_x = A->x - B->x;
+    const double Xab_y = A->y - B->y;
+    const double Xab_z = A->z - B->z;
+    const double Xab = Xab_x*Xab_x + Xab_y*Xab_y + Xab_z*Xab_z;
+
+    const SIMINT_DBLTYPE const_neg_Xab = SIMINT_DBLSET1(-Xab);
+    const SIMINT_DBLTYPE const_sqrt_two_pi_52 = SIMINT_DBLSET1(SQRT_TWO_PI_52);
+    const SIMINT_DBLTYPE Ax = SIMINT_DBLSET1(A->x);
+    const SIMINT_DBLTYPE Ay = SIMINT_DBLSET1(A->y);
+    const SIMINT_DBLTYPE Az = SIMINT_DBLSET1(A->z);
+    const SIMINT_DBLTYPE Bx = SIMINT_DBLSET1(B->x);
+    const SIMINT_DBLTYPE By = SIMINT_DBLSET1(B->y);
+    const SIMINT_DBLTYPE Bz = SIMINT_DBLSET1(B->z);
+
+    for(int p = 0; p < nprim; p += SIMINT_SIMD_LEN)
+    {
+        const int nlane = (nprim - p < SIMINT_SIMD_LEN ? nprim - p : SIMINT_SIMD_LEN);
+
+        const SIMINT_DBLTYPE alpha_i = SIMINT_DBLLOAD(alpha_a, p);
+        const SIMINT_DBLTYPE alpha_j = SIMINT_DBLLOAD(alpha_b, p);
+        const SIMINT_DBLTYPE coef_i = SIMINT_DBLLOAD(coef_a, p);
+        const SIMINT_DBLTYPE coef_j = SIMINT_DBLLOAD(coef_b, p);
+        const SIMINT_DBLTYPE ab_sum = SIMINT_ADD(alpha_i, alpha_j);
+        const SIMINT_DBLTYPE ab_mul = SIMINT_MUL(alpha_i, alpha_j);
+
+        // multiplying by reciprocal of ab_sum resulted
+        // in small numerical differences
+        union simint_shellpair_vec prefac, x, y, z, pa, pb;
+        prefac.v = SIMINT_MUL(SIMINT_MUL(coef_i, coef_j),
+                              SIMINT_EXP(SIMINT_DIV(SIMINT_MUL(const_neg_Xab, ab_mul), ab_sum)));
+        prefac.v = SIMINT_DIV(SIMINT_MUL(prefac.v, const_sqrt_two_pi_52), ab_sum);
+
+        x.v = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Ax, alpha_i), SIMINT_MUL(alpha_j, Bx)), ab_sum);
+        y.v = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Ay, alpha_i), SIMINT_MUL(alpha_j, By)), ab_sum);
+        z.v = SIMINT_DIV(SIMINT_ADD(SIMINT_MUL(Az, alpha_i), SIMINT_MUL(alpha_j, Bz)), ab_sum);
+
+        // P-A and P-B from the exponents rather than by subtracting
+        // the centers, which cancels (and is not zero for A == B)
+        pa.v = SIMINT_DIV(SIMINT_NEG(alpha_j), ab_sum);
+        pb.v = SIMINT_DIV(alpha_i, ab_sum);
+
+        for(int n = 0; n < nlane; n++)
         {
-            double m = simint_primscreen(A, B, P->screen + idx, screen_method);
-            P->screen_max = (m > P->screen_max ? m : P->screen_max);
+            const int d = idx + p + n;
+            const int i = ij[p+n] / B->nprim;
+            const int j = ij[p+n] % B->nprim;
+
+            P->prefac[d] = prefac.d[n];
+            if(same_shell && (i != j))
+                P->prefac[d] *= 2.0;
+
+            P->x[d] = x.d[n];
+            P->y[d] = y.d[n];
+            P->z[d] = z.d[n];
+            P->PA_x[d] = pa.d[n] * Xab_x;
+            P->PA_y[d] = pa.d[n] * Xab_y;
+            P->PA_z[d] = pa.d[n] * Xab_z;
+            P->PB_x[d] = pb.d[n] * Xab_x;
+            P->PB_y[d] = pb.d[n] * Xab_y;
+            P->PB_z[d] = pb.d[n] * Xab_z;
+
+            // the rest doesn't depend on the centers
+            if(update)
+                continue;
+
+            P->alpha[d] = A->alpha[i] + B->alpha[j];
+            P->alpha_a[d] = A->alpha[i];
+            P->beta[d] = B->alpha[j];
+            P->primij[d] = ij[p+n];
+
+            #if SIMINT_OSTEI_MAXDER > 0
+            if(same_shell && (i != j))
+            {
+                // there is already a factor of 2.0 in the prefac,
+                // so we don't need it here (work it out and see
+                // for yourself why we don't need it)
+                P->alpha2[d] = (A->alpha[i] + B->alpha[j]);
+                P->beta2[d] = (A->alpha[i] + B->alpha[j]);
+            }
+            else
+            {
+                P->alpha2[d] = 2.0 * A->alpha[i];
+                P->beta2[d] = 2.0 * B->alpha[j];
+            }
+            #endif
         }
+    }
 
-        // are these the same shells?
-        const int same_shell = compare_shell(A, B);
+    // If we are screening, sort the primitives within the shell pair.
+    // The kernels stop at the first insignificant primitive, so this
+    // is needed after an update, too (the screening values change)
+    if(screen_method && nprim > 1)
+        simint_shellpair_screenval_quicksort(P, idx, idx + nprim - 1);
+}
 
-        P->am1 = A->am;
-        P->am2 = B->am;
 
-        // do Xab = (Xab_x **2 + Xab_y ** 2 + Xab_z **2)
-        const double Xab_x = A->x - B->x;
-        const double Xab_y = A->y - B->y;
-        const double Xab_z = A->z - B->z;
-        const double Xab = Xab_x*Xab_x + Xab_y*Xab_y + Xab_z*Xab_z;
+/*! \brief Fills (or updates) all the shell pairs of a multi shell pair
+ *
+ * See simint_fill_shellpair_prims for \p update
+ */
+static void simint_fill_shellpairs(int npair, struct simint_shell const * AB,
+                                   struct simint_multi_shellpair * P,
+                                   int screen_method, int update)
+{
+    // Where each shell pair starts, so that shell pairs can
+    // be filled independently
+    int * offsets = malloc((npair+1) * sizeof(int));
+    if (offsets == NULL)
+    {
+        printf("[ERROR] simint_fill_shellpairs: cannot allocate %d offsets\n", npair+1);
+        assert(offsets != NULL);
+    }
+    offsets[npair] = simint_shellpair_prim_offsets(npair, AB, offsets);
 
+    int nprim = 0;
 
-        for(i = 0; i < A->nprim; ++i)
-        {
-            const double alpha_i = A->alpha[i];
-            const double AxAa = A->x * alpha_i;
-            const double AyAa = A->y * alpha_i;
-            const double AzAa = A->z * alpha_i;
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic) reduction(+:nprim) \
+                             if(npair >= SIMINT_SHELLPAIR_OMP_MIN)
+    #endif
+    for(int sasb = 0; sasb < npair; sasb++)
+    {
+        struct simint_shell const * A = &AB[2*sasb];
+        struct simint_shell const * B = &AB[2*sasb+1];
 
-            int jend = B->nprim;
-            if(same_shell)
-                jend = (i+1);
+        simint_fill_shellpair_prims(A, B, P, offsets[sasb], screen_method, update);
 
-            for(j = 0; j < jend; ++j)
-            {
-                const double alpha_j = B->alpha[j];
-                const double ab_sum = alpha_i + alpha_j;
-                const double ab_mul = alpha_i * alpha_j;
+        const int same_shell = compare_shell(A, B);
+        const int sasb_nprim = (same_shell ? (A->nprim * (A->nprim+1))/2 : A->nprim * B->nprim);
 
-                // multiplying by reciprocal of ab_sum resulted
-                // in small numerical differences
-                //const double oo_ab_sum = 1.0 / ab_sum;
+        P->AB_x[sasb] = A->x - B->x;
+        P->AB_y[sasb] = A->y - B->y;
+        P->AB_z[sasb] = A->z - B->z;
 
-                P->prefac[idx] = A->coef[i] * B->coef[j]
-                                 * exp(-Xab * ab_mul / ab_sum)
-                                 * SQRT_TWO_PI_52 / ab_sum;
+        nprim += sasb_nprim;
 
-                if(same_shell && (i != j))
-                    P->prefac[idx] *= 2.0;
+        if(update)
+            continue;
 
-                P->x[idx] = (AxAa + alpha_j * B->x) / ab_sum;
-                P->y[idx] = (AyAa + alpha_j * B->y) / ab_sum;
-                P->z[idx] = (AzAa + alpha_j * B->z) / ab_sum;
-                P->PA_x[idx] = P->x[idx] - A->x;
-                P->PA_y[idx] = P->y[idx] - A->y;
-                P->PA_z[idx] = P->z[idx] - A->z;
-                P->PB_x[idx] = P->x[idx] - B->x;
-                P->PB_y[idx] = P->y[idx] - B->y;
-                P->PB_z[idx] = P->z[idx] - B->z;
+        P->nprim12[sasb] = sasb_nprim;
 
-                P->alpha[idx] = ab_sum;
+        // fill in some members until the start of the next shell pair
+        // (only the last shell pair of a batch has anything to fill)
+        for(int idx = offsets[sasb] + sasb_nprim; idx < offsets[sasb+1]; idx++)
+        {
+            P->alpha[idx] = 1.0;
+            P->alpha_a[idx] = 0.5;
+            P->beta[idx] = 0.5;
+            P->prefac[idx] = 0.0;
+            P->x[idx] = 0.0;
+            P->y[idx] = 0.0;
+            P->z[idx] = 0.0;
+            P->PA_x[idx] = 0.0;
+            P->PA_y[idx] = 0.0;
+            P->PA_z[idx] = 0.0;
+            P->PB_x[idx] = 0.0;
+            P->PB_y[idx] = 0.0;
+            P->PB_z[idx] = 0.0;
+            P->primij[idx] = 0;
 
-                #if SIMINT_OSTEI_MAXDER > 0
-                if(same_shell && (i != j))
-                {
-                    // there is already a factor of 2.0 in the prefac,
-                    // so we don't need it here (work it out and see
-                    // for yourself why we don't need it)
-                    P->alpha2[idx] = (alpha_i + alpha_j);
-                    P->beta2[idx] = (alpha_i + alpha_j);
-                }
-                else
-                {
-                    P->alpha2[idx] = 2.0 * alpha_i;
-                    P->beta2[idx] = 2.0 * alpha_j;
-                }
-                #endif
+            if(screen_method)
+                P->screen[idx] = 0.0;
 
-                ++idx;
-            }
+            #if SIMINT_OSTEI_MAXDER > 0
+            P->alpha2[idx] = 1.0;
+            P->beta2[idx] = 1.0;
+            #endif
         }
+    }
 
-        int nprim = (same_shell ? (A->nprim * (A->nprim+1))/2 : A->nprim * B->nprim);
+    P->nprim = nprim;
 
-        P->AB_x[sasb] = Xab_x;
-        P->AB_y[sasb] = Xab_y;
-        P->AB_z[sasb] = Xab_z;
+    // The shell pair is never screened as a whole (see the
+    // README), so screen_max is left "infinite"
+    P->screen_max = 1.e99;
 
-        int sasbp1 = sasb + 1;
+    // the real maximum, used to choose the kernels. The padding
+    // has a screening value of zero
+    P->prim_screen_max = 1.e99;
+    if(screen_method)
+    {
+        P->prim_screen_max = 0.0;
+        for(int i = 0; i < nprim; i++)
+            if(P->screen[i] > P->prim_screen_max)
+                P->prim_screen_max = P->screen[i];
+    }
 
-        if((sasbp1 % SIMINT_NSHELL_SIMD) == 0 || sasbp1 >= npair)
-        {
-            // fill in some members until next boundary
-            while(idx < SIMINT_SIMD_ROUND(idx))
-            {
-                P->alpha[idx] = 1.0;
-                P->prefac[idx] = 0.0;
-                P->x[idx] = 0.0;
-                P->y[idx] = 0.0;
-                P->z[idx] = 0.0;
-                P->PA_x[idx] = 0.0;
-                P->PA_y[idx] = 0.0;
-                P->PA_z[idx] = 0.0;
-                P->PB_x[idx] = 0.0;
-                P->PB_y[idx] = 0.0;
-                P->PB_z[idx] = 0.0;
+    free(offsets);
+}
 
-                #if SIMINT_OSTEI_MAXDER > 0
-                P->alpha2[idx] = 1.0;
-                P->beta2[idx] = 1.0;
-                #endif
 
-                idx++;
-            }
-        }
+void simint_fill_multi_shellpair2(int npair, struct simint_shell const * AB,
+                                  struct simint_multi_shellpair * P,
+                                  int screen_method)
+{
+    P->nshell12 = npair;
+    P->nshell12_clip = npair; // by default, it's the same
+
+    if(npair <= 0)
+    {
+        P->nprim = 0;
+        P->screen_max = 1.e99;
+        P->prim_screen_max = 1.e99;
+        return;
+    }
+
+    P->am1 = AB[0].am;
+    P->am2 = AB[1].am;
+
+    // zero out
+    // This is not really needed, and can be expensive in
+    // direct code
+    // It's not needed since everything will be taken care of
+    // with a prefactor of 0.0
+    //memset(P->ptr, 0, P->memsize);
+
+    simint_fill_shellpairs(npair, AB, P, screen_method, 0);
+}
+
 
-        P->nprim12[sasb] = nprim;
-        P->nprim += nprim;
+void simint_update_multi_shellpair_geometry(int na, struct simint_shell const * A,
+                                            int nb, struct simint_shell const * B,
+                                            struct simint_multi_shellpair * P,
+                                            int screen_method)
+{
+    struct simint_shell *AB = (struct simint_shell*) malloc(sizeof(struct simint_shell) * 2 * na * nb);
+    if (AB == NULL)
+    {
+        printf("[ERROR] simint_update_multi_shellpair_geometry: cannot allocate 2 * %d * %d simint_shell space\n", na, nb);
+        assert(AB != NULL);
+    }
 
+    int ij = 0;
+    for(int i = 0; i < na; ++i)
+    for(int j = 0; j < nb; ++j)
+    {
+        AB[ij] = A[i];
+        AB[ij+1] = B[j];
         ij += 2;
     }
 
+    simint_update_multi_shellpair_geometry2(na*nb, AB, P, screen_method);
 
-    // If we are screening, sort the primitives within each shell
-    if(screen_method)
-        simint_sort_multi_shellpair(P);
+    free(AB);
+}
+
+
+void simint_update_multi_shellpair_geometry2(int npair, struct simint_shell const * AB,
+                                             struct simint_multi_shellpair * P,
+                                             int screen_method)
+{
+    assert(npair == P->nshell12);
+    assert(!screen_method || P->screen != NULL);
+
+    if(npair <= 0)
+        return;
+
+    simint_fill_shellpairs(npair, AB, P, screen_method, 1);
 }
 
 
@@ -636,6 +809,7 @@ void simint_cat_multi_shellpair(int nmpair,
     Pout->am1 = Pin[0]->am1;
     Pout->am2 = Pin[0]->am2;
     Pout->screen_max = 0.0;
+    Pout->prim_screen_max = (screen_method ? 0.0 : 1.e99);
 
     // now copy data
     int idx = 0;
@@ -660,7 +834,10 @@ void simint_cat_multi_shellpair(int nmpair,
                 Pout->z[idx] = Pin[i]->z[p];
 
                 Pout->alpha[idx] = Pin[i]->alpha[p];
+                Pout->alpha_a[idx] = Pin[i]->alpha_a[p];
+                Pout->beta[idx] = Pin[i]->beta[p];
                 Pout->prefac[idx] = Pin[i]->prefac[p];
+                Pout->primij[idx] = Pin[i]->primij[p];
 
                 #if SIMINT_OSTEI_MAXDER > 0
                 Pout->alpha2[idx] = Pin[i]->alpha2[p];
@@ -673,6 +850,9 @@ void simint_cat_multi_shellpair(int nmpair,
                 if(Pin[i]->screen_max > Pout->screen_max)
                     Pout->screen_max = Pin[i]->screen_max;
 
+                if(Pin[i]->prim_screen_max > Pout->prim_screen_max)
+                    Pout->prim_screen_max = Pin[i]->prim_screen_max;
+
                 idx++;
             }
 
@@ -690,6 +870,8 @@ void simint_cat_multi_shellpair(int nmpair,
                 while(idx < SIMINT_SIMD_ROUND(idx))
                 {
                     Pout->alpha[idx] = 1.0;
+                    Pout->alpha_a[idx] = 0.5;
+                    Pout->beta[idx] = 0.5;
                     Pout->prefac[idx] = 0.0;
                     Pout->x[idx] = 0.0;
                     Pout->y[idx] = 0.0;
@@ -700,6 +882,10 @@ void simint_cat_multi_shellpair(int nmpair,
                     Pout->PB_x[idx] = 0.0;
                     Pout->PB_y[idx] = 0.0;
                     Pout->PB_z[idx] = 0.0;
+                    Pout->primij[idx] = 0;
+
+                    if(screen_method)
+                        Pout->screen[idx] = 0.0;
 
                     #if SIMINT_OSTEI_MAXDER > 0
                     Pout->alpha2[idx] = 1.0;
@@ -754,6 +940,7 @@ void simint_cat_shellpairs(
     Pout->am1 = Pin[0]->am1;
     Pout->am2 = Pin[0]->am2;
     Pout->screen_max = 0.0;
+    Pout->prim_screen_max = (screen_method ? 0.0 : 1.e99);
 
     // now copy data
     int idx = 0, sasb = 0;
@@ -786,6 +973,9 @@ void simint_cat_shellpairs(
             if(Pin[i]->screen_max > Pout->screen_max)
                 Pout->screen_max = Pin[i]->screen_max;
 
+            if(Pin[i]->prim_screen_max > Pout->prim_screen_max)
+                Pout->prim_screen_max = Pin[i]->prim_screen_max;
+
             idx++;
         }
         */
@@ -801,7 +991,10 @@ void simint_cat_shellpairs(
         memcpy(&Pout->PB_y[idx], Pin[i]->PB_y, copy_size);
         memcpy(&Pout->PB_z[idx], Pin[i]->PB_z, copy_size);
         memcpy(&Pout->alpha[idx],  Pin[i]->alpha,  copy_size);
+        memcpy(&Pout->alpha_a[idx], Pin[i]->alpha_a, copy_size);
+        memcpy(&Pout->beta[idx],   Pin[i]->beta,   copy_size);
         memcpy(&Pout->prefac[idx], Pin[i]->prefac, copy_size);
+        memcpy(&Pout->primij[idx], Pin[i]->primij, sizeof(int) * Pin[i]->nprim12[0]);
 
         #if SIMINT_OSTEI_MAXDER > 0
         memcpy(&Pout->alpha2[idx], Pin[i]->alpha2, copy_size);
@@ -817,6 +1010,9 @@ void simint_cat_shellpairs(
 
         if (Pin[i]->screen_max > Pout->screen_max)
             Pout->screen_max = Pin[i]->screen_max;
+
+        if (Pin[i]->prim_screen_max > Pout->prim_screen_max)
+            Pout->prim_screen_max = Pin[i]->prim_screen_max;
     
         Pout->AB_x[sasb] = Pin[i]->AB_x[0];
         Pout->AB_y[sasb] = Pin[i]->AB_y[0];
@@ -831,6 +1027,8 @@ void simint_cat_shellpairs(
             while(idx < SIMINT_SIMD_ROUND(idx))
             {
                 Pout->alpha[idx] = 1.0;
+                Pout->alpha_a[idx] = 0.5;
+                Pout->beta[idx] = 0.5;
                 Pout->prefac[idx] = 0.0;
                 Pout->x[idx] = 0.0;
                 Pout->y[idx] = 0.0;
@@ -841,6 +1039,10 @@ void simint_cat_shellpairs(
                 Pout->PB_x[idx] = 0.0;
                 Pout->PB_y[idx] = 0.0;
                 Pout->PB_z[idx] = 0.0;
+                Pout->primij[idx] = 0;
+
+                if(screen_method)
+                    Pout->screen[idx] = 0.0;
 
                 #if SIMINT_OSTEI_MAXDER > 0
                 Pout->alpha2[idx] = 1.0;
@@ -903,6 +1105,7 @@ simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
                 out->PB_y[write_idx] = P->PB_y[read_idx];
                 out->PB_z[write_idx] = P->PB_z[read_idx];
                 out->alpha[write_idx] = P->alpha[read_idx];
+                out->beta[write_idx] = P->beta[read_idx];
                 out->prefac[write_idx] = P->prefac[read_idx];
                 out->screen[write_idx] = P->screen[read_idx];
                 write_idx++;
@@ -928,3 +1131,65 @@ simint_prune_multi_shellpair(struct simint_multi_shellpair const * P,
     out->nprim = write_idx;
 }
 */
+
+
+void simint_shellpair_prim_starts(struct simint_multi_shellpair const * P, int * start)
+{
+    start[0] = 0;
+    for(int ab = 0; ab < P->nshell12_clip; ab++)
+    {
+        const int end = start[ab] + P->nprim12[ab];
+        start[ab+1] = (((ab + 1) % SIMINT_NSHELL_SIMD) == 0) ? SIMINT_SIMD_ROUND(end) : end;
+    }
+}
+
+
+void simint_shellpair_view(struct simint_multi_shellpair const * P,
+                           int const * start, int ab0, int n,
+                           struct simint_multi_shellpair * V)
+{
+    const int i0 = start[ab0];
+
+    *V = *P;
+    V->nshell12 = n;
+    V->nshell12_clip = n;
+    V->nprim12 = P->nprim12 + ab0;
+    V->AB_x = P->AB_x + ab0;
+    V->AB_y = P->AB_y + ab0;
+    V->AB_z = P->AB_z + ab0;
+
+    V->x = P->x + i0;
+    V->y = P->y + i0;
+    V->z = P->z + i0;
+    V->PA_x = P->PA_x + i0;
+    V->PA_y = P->PA_y + i0;
+    V->PA_z = P->PA_z + i0;
+    V->PB_x = P->PB_x + i0;
+    V->PB_y = P->PB_y + i0;
+    V->PB_z = P->PB_z + i0;
+    V->alpha = P->alpha + i0;
+    V->alpha_a = P->alpha_a + i0;
+    V->beta = P->beta + i0;
+    V->prefac = P->prefac + i0;
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    V->alpha2 = P->alpha2 + i0;
+    V->beta2 = P->beta2 + i0;
+    #endif
+
+    V->nprim = 0;
+    for(int ab = ab0; ab < ab0+n; ab++)
+        V->nprim += P->nprim12[ab];
+
+    // screen_max and prim_screen_max are kept from P, so that the view
+    // is screened the same way as the whole shell pair
+    if(P->screen != NULL)
+        V->screen = P->screen + i0;
+
+    if(P->primij != NULL)
+        V->primij = P->primij + i0;
+
+    // the view does not own any memory
+    V->memsize = 0;
+    V->ptr = NULL;
+}
@@ -69,6 +69,8 @@ struct simint_multi_shellpair
     double * PB_z;      //!< Pz - Bz
 
     double * alpha;     //!< New coefficients (from GPT)
+    double * alpha_a;   //!< Exponent on the first center
+    double * beta;      //!< Exponent on the second center
 
     #if SIMINT_OSTEI_MAXDER > 0
     double * alpha2;    //!< 2*exponent on the first center
@@ -76,8 +78,11 @@ struct simint_multi_shellpair
     #endif
 
     double * prefac;    //!< Prefactors for each primitive pair, including coefficients and other factors
-    double * screen;    //!< Screening information (value of g_{abab} for all primitive shell pair)
-    double screen_max;  //!< Maximum value in the screen array
+    double * screen;    //!< Screening information (value of g_{abab} for all primitive shell pair).
+                        //!< Within each shell pair, the primitives are sorted by decreasing screen value
+    double screen_max;  //!< Used to screen whole shell pairs (1e99 when filled, see the README)
+    double prim_screen_max; //!< Maximum value in the screen array (1e99 without screening information)
+    int * primij;       //!< Which primitives of the shells (i*nprim2 + j) form each primitive pair (length nprim, padded)
 
 
     size_t memsize;     //!< Total memory for storing various data in this structure (in bytes)
@@ -85,6 +90,71 @@ struct simint_multi_shellpair
 };
 
 
+/*! \brief A multi shell pair as seen by the integral kernels
+ *
+ * Kernels for permuted quartets (for example, p_s_s_s) call the kernel
+ * for the unpermuted quartet with the two centers of a shell pair
+ * swapped. This only holds the members that depend on the order of the
+ * two centers. Everything else is read from the shell pair itself.
+ *
+ * Swapping the centers negates AB. Rather than storing negated
+ * copies, the kernels multiply AB by AB_sign.
+ */
+struct simint_multi_shellpair_view
+{
+    struct simint_multi_shellpair const * pair; //!< The shell pair being viewed
+
+    double const * PA_x;  //!< Px - Ax, with A being the first center of the view
+    double const * PA_y;  //!< Py - Ay
+    double const * PA_z;  //!< Pz - Az
+    double const * PB_x;  //!< Px - Bx, with B being the second center of the view
+    double const * PB_y;  //!< Py - By
+    double const * PB_z;  //!< Pz - Bz
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    double const * alpha2;  //!< 2*exponent on the first center of the view
+    double const * beta2;   //!< 2*exponent on the second center of the view
+    #endif
+
+    double AB_sign;       //!< 1.0, or -1.0 if the centers are swapped
+};
+
+
+/*! \brief Initialize a view of a multi shell pair
+ *
+ * \param [in] P The shell pair to view
+ * \param [in] swap Nonzero to swap the two centers of the shell pair
+ * \param [out] V The view to initialize
+ */
+static inline
+void simint_init_shellpair_view(struct simint_multi_shellpair const * P, int swap,
+                                struct simint_multi_shellpair_view * V)
+{
+    V->pair = P;
+
+    if(swap)
+    {
+        V->PA_x = P->PB_x;  V->PA_y = P->PB_y;  V->PA_z = P->PB_z;
+        V->PB_x = P->PA_x;  V->PB_y = P->PA_y;  V->PB_z = P->PA_z;
+        #if SIMINT_OSTEI_MAXDER > 0
+        V->alpha2 = P->beta2;
+        V->beta2 = P->alpha2;
+        #endif
+        V->AB_sign = -1.0;
+    }
+    else
+    {
+        V->PA_x = P->PA_x;  V->PA_y = P->PA_y;  V->PA_z = P->PA_z;
+        V->PB_x = P->PB_x;  V->PB_y = P->PB_y;  V->PB_z = P->PB_z;
+        #if SIMINT_OSTEI_MAXDER > 0
+        V->alpha2 = P->alpha2;
+        V->beta2 = P->beta2;
+        #endif
+        V->AB_sign = 1.0;
+    }
+}
+
+
 /*! \brief See if two shells are equivalent */
 static inline
 int compare_shell(struct simint_shell const * A,
@@ -192,7 +262,8 @@ void simint_create_shell(int nprim, int am, double x, double y, double z,
 /*! \brief Create a dummy simint_shell
  *
  * This can be used to represent non-existent shells (for example,
- * for 3-center and 2-center integrals
+ * for 3-center and 2-center integrals, see simint_compute_eri_3c and
+ * simint_compute_eri_2c)
  *
  * \p G must be initialized, but does not need to be allocated or filled.
  * If it is already filled, any existing data in \p G is overwritten.
@@ -309,6 +380,45 @@ void simint_fill_multi_shellpair2(int npair, struct simint_shell const * AB,
                                   int screen_method);
 
 
+/*! \brief Updates a multi shellpair structure for new centers
+ *
+ * Recomputes only the members that depend on the centers of the shells
+ * (coordinates, PA, PB, AB, prefactors and screening information). The
+ * memory is kept. If screening, the primitives of each shell pair
+ * are sorted again by their new screening values.
+ *
+ * The shells must be the same as those used to fill \p P (same order,
+ * exponents and coefficients), except for their centers. This is meant
+ * for geometry optimizations and molecular dynamics.
+ *
+ * \param [in] na Number of shells in the first position
+ * \param [in] A Shells in the first position of this multi_shellpair
+ * \param [in] nb Number of shells in the second position
+ * \param [in] B Shells in the second position of this multi_shellpair
+ * \param [inout] P The structure to update
+ * \param [in] screen_method Screening method for primitives (same as used to fill \p P)
+ */
+void simint_update_multi_shellpair_geometry(int na, struct simint_shell const * A,
+                                            int nb, struct simint_shell const * B,
+                                            struct simint_multi_shellpair * P,
+                                            int screen_method);
+
+
+/*! \brief Updates a multi shellpair structure for new centers
+ *
+ * See simint_update_multi_shellpair_geometry. The shell pairs are
+ * given as for simint_fill_multi_shellpair2.
+ *
+ * \param [in] npair Number of shell pairs in the array
+ * \param [in] AB Pairs of shells in the shell pair
+ * \param [inout] P The structure to update
+ * \param [in] screen_method Screening method for primitives (same as used to fill \p P)
+ */
+void simint_update_multi_shellpair_geometry2(int npair, struct simint_shell const * AB,
+                                             struct simint_multi_shellpair * P,
+                                             int screen_method);
+
+
 /*! \brief Allocates and fills a multi shellpair structure
  *
  * For convenience. Creates a new simint_multi_shellpair structure,
@@ -374,6 +484,36 @@ void simint_cat_shellpairs(
 	struct simint_multi_shellpair * Pout, int screen_method
 );
 
+
+/*! \brief Index of the first primitive of each shell pair
+ *
+ * Each batch of SIMINT_NSHELL_SIMD shell pairs is padded to a
+ * multiple of the vector length.
+ *
+ * \param [in] P The multi shell pair
+ * \param [out] start Index of the first primitive of each shell pair in the
+ *                    arrays of \p P (length nshell12_clip+1)
+ */
+void simint_shellpair_prim_starts(struct simint_multi_shellpair const * P, int * start);
+
+
+/*! \brief Makes a view of some of the shell pairs of a multi shell pair
+ *
+ * No data is copied, and the view does not need to be freed. If \p n > 1
+ * or the view is used as the ket, \p ab0 must be a multiple of
+ * SIMINT_NSHELL_SIMD (so the primitives stay aligned and padded).
+ *
+ * \param [in] P The multi shell pair
+ * \param [in] start From simint_shellpair_prim_starts
+ * \param [in] ab0 First shell pair of the view
+ * \param [in] n Number of shell pairs in the view
+ * \param [out] V The view of shell pairs [ab0, ab0+n) of \p P
+ */
+void simint_shellpair_view(struct simint_multi_shellpair const * P,
+                           int const * start, int ab0, int n,
+                           struct simint_multi_shellpair * V);
+
+
 /*! \brief Remove all insignificant primitive pairs
  *
  *
@@ -1,6 +1,9 @@
 #include <math.h> // for fabs()
+#include <stdio.h>
+#include <stdlib.h>
 
 #include "simint/simint_eri.h"
+#include "simint/simint_workspace.h"
 #include "simint/ostei/ostei_config.h"
 #include "simint/constants.h"
 #include "simint/shell/shell_screen.h"
@@ -48,9 +51,9 @@ double
 simint_shellscreen_schwarz(struct simint_shell const * A,
                            struct simint_shell const * B)
 {
-    // workspace
-    const size_t workmem = simint_ostei_workmem(0, SIMINT_OSTEI_MAXAM);
-    double * work = (double *)SIMINT_ALLOC(workmem);
+    // workspace (only as large as needed for (ab|ab))
+    double * work = simint_workspace_acquire_size(
+                      simint_ostei_worksize_quartet(0, A->am, B->am, A->am, B->am));
 
     const int ncart1 = ((A->am+1) * (A->am+2))/2;
     const int ncart2 = ((B->am+1) * (B->am+2))/2;
@@ -58,7 +61,8 @@ simint_shellscreen_schwarz(struct simint_shell const * A,
     const int ncart1234 = ncart12*ncart12;
 
     // holds the calculated integrals
-    double integrals[ncart1234] SIMINT_ALIGN_ARRAY_DBL;
+    // (plus space for any statistics written past the end)
+    double integrals[ncart1234+4] SIMINT_ALIGN_ARRAY_DBL;
 
     struct simint_multi_shellpair P;
     simint_initialize_multi_shellpair(&P);
@@ -76,7 +80,7 @@ simint_shellscreen_schwarz(struct simint_shell const * A,
     }
 
     simint_free_multi_shellpair(&P);
-    SIMINT_FREE(work);
+    simint_workspace_release(work);
     return max;
 }
 
@@ -132,7 +136,8 @@ simint_primscreen_schwarz(struct simint_shell const * A,
     const int ncart1234 = ncart12*ncart12;
 
     // holds the calculated integrals
-    double integrals[ncart1234] SIMINT_ALIGN_ARRAY_DBL;
+    // (plus space for any statistics written past the end)
+    double integrals[ncart1234+4] SIMINT_ALIGN_ARRAY_DBL;
 
     // here, we basically uncontract the shells
     struct simint_shell new_A, new_B;
@@ -144,14 +149,13 @@ simint_primscreen_schwarz(struct simint_shell const * A,
     struct simint_multi_shellpair P;
     simint_initialize_multi_shellpair(&P);
 
-    // workspace
-    const size_t workmem = simint_ostei_workmem(0, SIMINT_OSTEI_MAXAM);
-    double * work = (double *)SIMINT_ALLOC(workmem);
+    // workspace (only as large as needed for (ab|ab))
+    double * work = simint_workspace_acquire_size(
+                      simint_ostei_worksize_quartet(0, A->am, B->am, A->am, B->am));
 
     double total_max = 0.0;
 
     int idx = 0;
-    int ij = 0;
     for(int i = 0; i < A->nprim; i++)
     {
         simint_create_shell(1, A->am, A->x, A->y, A->z,
@@ -199,21 +203,13 @@ simint_primscreen_schwarz(struct simint_shell const * A,
             if(max > total_max)
                 total_max = max;
 
-            ij++;
-
-            // pad out, if needed
-            if( (ij % SIMINT_NSHELL_SIMD) == 0 || ij >= A->nprim*B->nprim)
-            {
-                while(idx < SIMINT_SIMD_ROUND(idx))
-                    out[idx++] = 0.0;
-            }
         }
     }
 
     simint_free_multi_shellpair(&P);
     simint_free_shell(&new_A);
     simint_free_shell(&new_B);
-    SIMINT_FREE(work);
+    simint_workspace_release(work);
 
     return total_max;
 }
@@ -264,3 +260,228 @@ simint_primscreen_fastschwarz(struct simint_shell const * A,
 
     return total_max;
 }
+
+
+///////////////////////////////////////
+// Screening matrix for a whole basis
+///////////////////////////////////////
+// Same as simint_primscreen_schwarz (with out == NULL), but all the
+// primitive pairs of A and B are put in one shell pair, PP, and the
+// (ij|ij) are calculated a batch of SIMINT_NSHELL_SIMD at a time. Only
+// the diagonal quartets of each batch are used, but this is still faster
+// than creating a shell pair for each primitive pair.
+//
+// AB must hold 2*A->nprim*B->nprim shells, and start one more than
+// A->nprim*B->nprim ints. integrals must hold the integrals for
+// SIMINT_NSHELL_SIMD^2 quartets (plus 4).
+static double
+primscreen_schwarz_batched(struct simint_shell const * A,
+                           struct simint_shell const * B,
+                           double * work, double * integrals,
+                           struct simint_shell * AB, int * start,
+                           struct simint_multi_shellpair * PP)
+{
+    const int ncart12 = (((A->am+1) * (A->am+2))/2) * (((B->am+1) * (B->am+2))/2);
+    const int ncart1234 = ncart12*ncart12;
+    const int same_shell = compare_shell(A, B);
+
+    // single primitive shells, pointing into A and B
+    int npair = 0;
+    for(int i = 0; i < A->nprim; i++)
+    {
+        const int Bend = (same_shell ? (i+1) : B->nprim);
+        for(int j = 0; j < Bend; j++)
+        {
+            AB[2*npair] = *A;
+            AB[2*npair].nprim = 1;
+            AB[2*npair].alpha = A->alpha + i;
+            AB[2*npair].coef = A->coef + i;
+
+            AB[2*npair+1] = *B;
+            AB[2*npair+1].nprim = 1;
+            AB[2*npair+1].alpha = B->alpha + j;
+            AB[2*npair+1].coef = B->coef + j;
+
+            npair++;
+        }
+    }
+
+    simint_create_multi_shellpair2(npair, AB, PP, 0);
+    simint_shellpair_prim_starts(PP, start);
+
+    double total_max = 0.0;
+
+    for(int ab0 = 0; ab0 < npair; ab0 += SIMINT_NSHELL_SIMD)
+    {
+        const int n = (npair - ab0 < SIMINT_NSHELL_SIMD) ? (npair - ab0) : SIMINT_NSHELL_SIMD;
+
+        struct simint_multi_shellpair V;
+        simint_shellpair_view(PP, start, ab0, n, &V);
+        simint_compute_eri(&V, &V, 0.0, work, integrals);
+
+        // the (mn|mn) elements of the (kk|kk) quartets
+        for(int k = 0; k < n; k++)
+        {
+            double const * kk = integrals + (size_t)(k*n + k) * ncart1234;
+            for(int m = 0; m < ncart12; m++)
+            {
+                double abint = fabs(kk[m*ncart12 + m]);
+                total_max = ( abint > total_max ? abint : total_max );
+            }
+        }
+    }
+
+    return total_max;
+}
+
+
+int
+simint_schwarz_matrix(int nshell, struct simint_shell const * shells,
+                      double * restrict out, double * restrict prim_out)
+{
+    if(nshell <= 0)
+        return 0;
+
+    int maxam = 0;
+    for(int i = 0; i < nshell; i++)
+        maxam = (shells[i].am > maxam ? shells[i].am : maxam);
+
+    // Shell pairs (i >= j), sorted by AM pair (counting sort), so
+    // that consecutive quartets use the same kernel
+    const int namkey = (maxam+1)*(maxam+1);
+    const size_t npair = ((size_t)nshell * (nshell+1))/2;
+    int * pairs = malloc(2 * npair * sizeof(int));
+    int * bucket = calloc(namkey+1, sizeof(int));
+
+    if(pairs == NULL || bucket == NULL)
+    {
+        printf("[ERROR] simint_schwarz_matrix: cannot allocate the list of %zu shell pairs\n", npair);
+        free(pairs);
+        free(bucket);
+        return 1;
+    }
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j <= i; j++)
+        bucket[shells[i].am*(maxam+1) + shells[j].am + 1]++;
+
+    for(int k = 0; k < namkey; k++)
+        bucket[k+1] += bucket[k];
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j <= i; j++)
+    {
+        const int n = bucket[shells[i].am*(maxam+1) + shells[j].am]++;
+        pairs[2*n] = i;
+        pairs[2*n+1] = j;
+    }
+
+    free(bucket);
+
+    int maxnprim = 0;
+    for(int i = 0; i < nshell; i++)
+        maxnprim = (shells[i].nprim > maxnprim ? shells[i].nprim : maxnprim);
+
+    int failed = 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel reduction(|:failed)
+    #endif
+    {
+        // Reused for all the shell pairs handled by this thread
+        const int maxncart = ((maxam+1) * (maxam+2))/2;
+        const size_t maxncart1234 = (size_t)maxncart * maxncart * maxncart * maxncart;
+        const size_t maxnprim12 = (size_t)maxnprim * maxnprim;
+
+        double * work = simint_workspace_acquire(0, maxam);
+        double * integrals = simint_workspace_acquire_size(
+                               SIMINT_NSHELL_SIMD * SIMINT_NSHELL_SIMD * maxncart1234 + 4);
+
+        // for prim_out (see primscreen_schwarz_batched)
+        struct simint_shell * AB = NULL;
+        int * start = NULL;
+        if(prim_out != NULL)
+        {
+            AB = malloc(2 * maxnprim12 * sizeof(struct simint_shell));
+            start = malloc((maxnprim12 + 1) * sizeof(int));
+        }
+
+        failed |= (work == NULL || integrals == NULL);
+        failed |= (prim_out != NULL && (AB == NULL || start == NULL));
+
+        struct simint_multi_shellpair P, PP;
+        simint_initialize_multi_shellpair(&P);
+        simint_initialize_multi_shellpair(&PP);
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 16)
+        #endif
+        for(long n = 0; n < (long)npair; n++)
+        {
+            if(failed)
+                continue;
+
+            const int i = pairs[2*n];
+            const int j = pairs[2*n+1];
+            struct simint_shell const * A = shells + i;
+            struct simint_shell const * B = shells + j;
+
+            const int ncart12 = (((A->am+1) * (A->am+2))/2) * (((B->am+1) * (B->am+2))/2);
+            const int ncart1234 = ncart12*ncart12;
+
+            // calculate (ab|ab). This allocates only if P is too small
+            simint_create_multi_shellpair(1, A, 1, B, &P, 0);
+            simint_compute_eri(&P, &P, 0.0, work, integrals);
+
+            // find the max value (as in simint_shellscreen_schwarz)
+            double max = 0;
+            for(int m = 0; m < ncart1234; m++)
+            {
+                double abint = fabs(integrals[m]);
+                max = ( abint > max ? abint : max );
+            }
+
+            out[(size_t)i*nshell + j] = max;
+            out[(size_t)j*nshell + i] = max;
+
+            if(prim_out != NULL)
+            {
+                double prim_max = 0;
+
+                // With a single primitive in each shell, the (ab|ab) just
+                // calculated is the only primitive quartet
+                if(A->nprim == 1 && B->nprim == 1)
+                {
+                    for(int m = 0; m < ncart12; m++)
+                    {
+                        double abint = fabs(integrals[m*ncart12 + m]);
+                        prim_max = ( abint > prim_max ? abint : prim_max );
+                    }
+                }
+                else
+                    prim_max = primscreen_schwarz_batched(A, B, work, integrals,
+                                                          AB, start, &PP);
+
+                prim_out[(size_t)i*nshell + j] = prim_max;
+                prim_out[(size_t)j*nshell + i] = prim_max;
+            }
+        }
+
+        simint_free_multi_shellpair(&PP);
+        simint_free_multi_shellpair(&P);
+        free(start);
+        free(AB);
+        simint_workspace_release(integrals);
+        simint_workspace_release(work);
+    }
+
+    free(pairs);
+
+    if(failed)
+    {
+        printf("[ERROR] simint_schwarz_matrix: cannot allocate the workspace\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -57,6 +57,27 @@ simint_primscreen_fastschwarz(struct simint_shell const * A,
                               struct simint_shell const * B,
                               double * out);
 
+/*! \brief Calculate the Schwarz screening matrix for a whole basis
+ *
+ * Element (i,j) of \p out is the shell screening value of shells
+ * i and j (the same as simint_shellscreen_schwarz). The matrix is
+ * symmetric and stored in full, row-major.
+ *
+ * The (ij|ij) quartets are computed in order of angular momentum,
+ * and spread over threads if OpenMP is enabled.
+ *
+ * \param [in] nshell Number of shells
+ * \param [in] shells The shells (length \p nshell)
+ * \param [out] out Shell screening values (length \p nshell * \p nshell)
+ * \param [out] prim_out If not NULL, the largest primitive screening value
+ *                       of each shell pair (see simint_primscreen_schwarz)
+ *                       (length \p nshell * \p nshell)
+ * \return 0 on success, nonzero if memory could not be allocated
+ */
+int
+simint_schwarz_matrix(int nshell, struct simint_shell const * shells,
+                      double * restrict out, double * restrict prim_out);
+
 
 
 #ifdef __cplusplus
@@ -0,0 +1,482 @@
+// for mmap, fstat, etc
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "simint/ostei/ostei_config.h"
+#include "simint/shell/shell_store.h"
+#include "simint/vectorization/vectorization.h"
+
+
+#if defined(__ICC) || defined(__INTEL_COMPILER)
+    #pragma warning(disable:1338)                  // Pointer arithmetic on void
+#elif defined(__GNUC__) || defined(__GNUG__)
+    #pragma GCC diagnostic ignored "-Wpointer-arith"
+#endif
+
+
+////////////////////////////////////////////////////////////////
+// File format (version 4)
+//
+// header
+// one entry per multi shell pair
+// data block of each multi shell pair
+//
+// The data block is the used part of the memory pointed to by
+// simint_multi_shellpair::ptr. The entry gives the offset of the
+// block in the file, and the offset of each array member within
+// the block (or -1 for NULL). Data blocks start on a multiple of
+// SIMINT_STORE_ALIGN bytes, so the arrays keep their alignment
+// when mapped (mappings start on a page boundary).
+////////////////////////////////////////////////////////////////
+
+#define SIMINT_STORE_MAGIC     "SIMINTSP"
+#define SIMINT_STORE_VERSION   4
+#define SIMINT_STORE_BYTEORDER 0x01020304
+#define SIMINT_STORE_ALIGN     64
+
+// Array members of simint_multi_shellpair, in the order stored
+enum simint_store_member
+{
+    STORE_NPRIM12,
+    STORE_AB_X, STORE_AB_Y, STORE_AB_Z,
+    STORE_X, STORE_Y, STORE_Z,
+    STORE_PA_X, STORE_PA_Y, STORE_PA_Z,
+    STORE_PB_X, STORE_PB_Y, STORE_PB_Z,
+    STORE_ALPHA, STORE_ALPHA_A, STORE_BETA, STORE_ALPHA2, STORE_BETA2,
+    STORE_PREFAC, STORE_SCREEN, STORE_PRIMIJ,
+    STORE_NMEMBER
+};
+
+struct simint_store_header
+{
+    char magic[8];
+    int32_t version;
+    int32_t byteorder;    // detects files from machines with a different byte order
+    int32_t simd_len;     // determines the padding of the primitives
+    int32_t maxder;       // determines if alpha2 and beta2 are stored
+    int64_t n;            // number of multi shell pairs
+};
+
+struct simint_store_entry
+{
+    int32_t am1;
+    int32_t am2;
+    int32_t nprim;
+    int32_t nshell12;
+    int32_t nshell12_clip;
+    int32_t padding_;
+    double screen_max;
+    double prim_screen_max;
+    int64_t offset;       // start of the data block in the file
+    int64_t size;         // size of the data block
+    int64_t member[STORE_NMEMBER];
+};
+
+
+// Pointers to the array members of P (NULL for those not available)
+static void store_members(struct simint_multi_shellpair const * P,
+                          void * member[STORE_NMEMBER])
+{
+    member[STORE_NPRIM12] = P->nprim12;
+    member[STORE_AB_X]    = P->AB_x;
+    member[STORE_AB_Y]    = P->AB_y;
+    member[STORE_AB_Z]    = P->AB_z;
+    member[STORE_X]       = P->x;
+    member[STORE_Y]       = P->y;
+    member[STORE_Z]       = P->z;
+    member[STORE_PA_X]    = P->PA_x;
+    member[STORE_PA_Y]    = P->PA_y;
+    member[STORE_PA_Z]    = P->PA_z;
+    member[STORE_PB_X]    = P->PB_x;
+    member[STORE_PB_Y]    = P->PB_y;
+    member[STORE_PB_Z]    = P->PB_z;
+    member[STORE_ALPHA]   = P->alpha;
+    member[STORE_ALPHA_A] = P->alpha_a;
+    member[STORE_BETA]    = P->beta;
+    member[STORE_PREFAC]  = P->prefac;
+    member[STORE_SCREEN]  = P->screen;
+    member[STORE_PRIMIJ]  = P->primij;
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    member[STORE_ALPHA2]  = P->alpha2;
+    member[STORE_BETA2]   = P->beta2;
+    #else
+    member[STORE_ALPHA2]  = NULL;
+    member[STORE_BETA2]   = NULL;
+    #endif
+}
+
+
+// Sets the array members of P
+static void store_set_members(struct simint_multi_shellpair * P,
+                              void * const member[STORE_NMEMBER])
+{
+    P->nprim12 = member[STORE_NPRIM12];
+    P->AB_x    = member[STORE_AB_X];
+    P->AB_y    = member[STORE_AB_Y];
+    P->AB_z    = member[STORE_AB_Z];
+    P->x       = member[STORE_X];
+    P->y       = member[STORE_Y];
+    P->z       = member[STORE_Z];
+    P->PA_x    = member[STORE_PA_X];
+    P->PA_y    = member[STORE_PA_Y];
+    P->PA_z    = member[STORE_PA_Z];
+    P->PB_x    = member[STORE_PB_X];
+    P->PB_y    = member[STORE_PB_Y];
+    P->PB_z    = member[STORE_PB_Z];
+    P->alpha   = member[STORE_ALPHA];
+    P->alpha_a = member[STORE_ALPHA_A];
+    P->beta    = member[STORE_BETA];
+    P->prefac  = member[STORE_PREFAC];
+    P->screen  = member[STORE_SCREEN];
+    P->primij  = member[STORE_PRIMIJ];
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    P->alpha2  = member[STORE_ALPHA2];
+    P->beta2   = member[STORE_BETA2];
+    #endif
+}
+
+
+// Size (in bytes) of each array member, given the number of
+// primitives (including padding) and the number of shell pairs
+static void store_member_sizes(size_t nprim, size_t nshell12,
+                               size_t size[STORE_NMEMBER])
+{
+    for(int i = 0; i < STORE_NMEMBER; i++)
+        size[i] = nprim * sizeof(double);
+
+    size[STORE_NPRIM12] = nshell12 * sizeof(int);
+    size[STORE_AB_X] = size[STORE_AB_Y] = size[STORE_AB_Z] = nshell12 * sizeof(double);
+    size[STORE_PRIMIJ] = nprim * sizeof(int);
+}
+
+
+// Alignment needed for each member within the data block. The
+// primitive arrays start on a vector boundary, as they do in memory
+// (see simint_allocate_multi_shellpair_base)
+static int64_t store_member_align(int m)
+{
+    switch(m)
+    {
+        case STORE_NPRIM12:
+        case STORE_PRIMIJ:
+            return sizeof(int);
+        case STORE_AB_X:
+        case STORE_AB_Y:
+        case STORE_AB_Z:
+            return sizeof(double);
+        default:
+            return SIMINT_SIMD_ALIGN;
+    }
+}
+
+
+static int64_t store_align(int64_t offset)
+{
+    return (offset + SIMINT_STORE_ALIGN - 1) / SIMINT_STORE_ALIGN * SIMINT_STORE_ALIGN;
+}
+
+
+int simint_write_multi_shellpairs(const char * filename, int n,
+                                  struct simint_multi_shellpair const * P)
+{
+    struct simint_store_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SIMINT_STORE_MAGIC, 8);
+    header.version = SIMINT_STORE_VERSION;
+    header.byteorder = SIMINT_STORE_BYTEORDER;
+    header.simd_len = SIMINT_SIMD_LEN;
+    header.maxder = SIMINT_OSTEI_MAXDER;
+    header.n = n;
+
+    struct simint_store_entry * entries = calloc(n > 0 ? n : 1, sizeof(struct simint_store_entry));
+    if(entries == NULL)
+    {
+        printf("[ERROR] simint_write_multi_shellpairs: cannot allocate %d entries\n", n);
+        return 1;
+    }
+
+    // Lay out the file
+    int64_t offset = store_align(sizeof(header) + n * sizeof(struct simint_store_entry));
+
+    for(int i = 0; i < n; i++)
+    {
+        struct simint_store_entry * e = entries + i;
+        e->am1 = P[i].am1;
+        e->am2 = P[i].am2;
+        e->nprim = P[i].nprim;
+        e->nshell12 = P[i].nshell12;
+        e->nshell12_clip = P[i].nshell12_clip;
+        e->screen_max = P[i].screen_max;
+        e->prim_screen_max = P[i].prim_screen_max;
+        e->offset = offset;
+        e->size = 0;
+
+        void * member[STORE_NMEMBER];
+        size_t size[STORE_NMEMBER];
+        store_members(P + i, member);
+        // Number of primitives, including padding. The arrays
+        // are adjacent in memory (see simint_allocate_multi_shellpair_base)
+        const size_t nprim = (P[i].ptr == NULL) ? 0 : (size_t)(P[i].y - P[i].x);
+        store_member_sizes(nprim, P[i].nshell12, size);
+
+        for(int m = 0; m < STORE_NMEMBER; m++)
+        {
+            if(member[m] == NULL || P[i].ptr == NULL)
+            {
+                e->member[m] = -1;
+                continue;
+            }
+
+            e->member[m] = (int64_t)(member[m] - P[i].ptr);
+            if(e->member[m] + (int64_t)size[m] > e->size)
+                e->size = e->member[m] + size[m];
+        }
+
+        offset = store_align(offset + e->size);
+    }
+
+    FILE * fp = fopen(filename, "wb");
+    if(fp == NULL)
+    {
+        printf("[ERROR] simint_write_multi_shellpairs: cannot open %s for writing\n", filename);
+        free(entries);
+        return 1;
+    }
+
+    int err = 0;
+    err |= (fwrite(&header, sizeof(header), 1, fp) != 1);
+    err |= (n > 0 && fwrite(entries, sizeof(struct simint_store_entry), n, fp) != (size_t)n);
+
+    for(int i = 0; i < n && !err; i++)
+    {
+        err |= (fseek(fp, entries[i].offset, SEEK_SET) != 0);
+        if(entries[i].size > 0)
+            err |= (fwrite(P[i].ptr, entries[i].size, 1, fp) != 1);
+    }
+
+    err |= (fclose(fp) != 0);
+    free(entries);
+
+    if(err)
+    {
+        printf("[ERROR] simint_write_multi_shellpairs: error writing %s\n", filename);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+// Checks that the data block of an entry, and every array member
+// within it, lies within the file. Returns nonzero if not.
+static int store_check_entry(struct simint_store_entry const * e,
+                             void const * addr, size_t filesize)
+{
+    if(e->offset < 0 || e->size < 0 ||
+       e->offset % SIMINT_STORE_ALIGN != 0 ||
+       (size_t)e->size > filesize || (size_t)e->offset > filesize - e->size)
+        return 1;
+
+    if(e->nprim < 0 || e->nshell12 < 0 ||
+       e->nshell12_clip < 0 || e->nshell12_clip > e->nshell12)
+        return 1;
+
+    for(int m = 0; m < STORE_NMEMBER; m++)
+    {
+        if(e->member[m] < -1 || (e->member[m] >= 0 && e->member[m] % (int64_t)sizeof(int) != 0))
+            return 1;
+        if(e->size == 0 && e->member[m] != -1)
+            return 1;
+    }
+
+    // written from an unallocated shell pair
+    if(e->size == 0)
+        return 0;
+
+    // the AM is used to index the kernel tables
+    if(e->am1 < 0 || e->am1 > SIMINT_OSTEI_MAXAM ||
+       e->am2 < 0 || e->am2 > SIMINT_OSTEI_MAXAM)
+        return 1;
+
+    // The number of primitives including the padding isn't
+    // stored, but follows from nprim12
+    size_t size[STORE_NMEMBER];
+    store_member_sizes(0, e->nshell12, size);
+    if(e->member[STORE_NPRIM12] < 0 ||
+       (size_t)e->member[STORE_NPRIM12] + size[STORE_NPRIM12] > (size_t)e->size)
+        return 1;
+
+    int const * nprim12 = addr + e->offset + e->member[STORE_NPRIM12];
+    int64_t nprim = 0;
+    int64_t nprim_pad = 0;
+    int64_t batch = 0;
+    for(int ab = 0; ab < e->nshell12; ab++)
+    {
+        if(nprim12[ab] < 0)
+            return 1;
+
+        nprim += nprim12[ab];
+        batch += nprim12[ab];
+        if(((ab + 1) % SIMINT_NSHELL_SIMD) == 0 || ab + 1 == e->nshell12)
+        {
+            nprim_pad += SIMINT_SIMD_ROUND(batch);
+            batch = 0;
+        }
+    }
+
+    if(nprim != e->nprim || nprim_pad > e->size / (int64_t)sizeof(double))
+        return 1;
+
+    store_member_sizes(nprim_pad, e->nshell12, size);
+
+    for(int m = 0; m < STORE_NMEMBER; m++)
+    {
+        // only these may be NULL
+        if(e->member[m] < 0)
+        {
+            if(m != STORE_SCREEN && m != STORE_ALPHA2 && m != STORE_BETA2)
+                return 1;
+            continue;
+        }
+
+        if((size_t)e->member[m] + size[m] > (size_t)e->size)
+            return 1;
+
+        // the kernels load the primitive arrays as whole vectors
+        if(e->member[m] % store_member_align(m) != 0)
+            return 1;
+    }
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    if(e->member[STORE_ALPHA2] < 0 || e->member[STORE_BETA2] < 0)
+        return 1;
+    #endif
+
+    return 0;
+}
+
+
+static void store_empty_map(struct simint_shellpair_map * map)
+{
+    map->n = 0;
+    map->P = NULL;
+    map->addr = NULL;
+    map->size = 0;
+}
+
+
+int simint_map_multi_shellpairs(const char * filename,
+                                struct simint_shellpair_map * map)
+{
+    store_empty_map(map);
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        printf("[ERROR] simint_map_multi_shellpairs: cannot open %s\n", filename);
+        return 1;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(struct simint_store_header))
+    {
+        printf("[ERROR] simint_map_multi_shellpairs: %s is not a shell pair file\n", filename);
+        close(fd);
+        return 1;
+    }
+
+    const size_t filesize = st.st_size;
+    void * addr = mmap(NULL, filesize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // the mapping stays valid
+
+    if(addr == MAP_FAILED)
+    {
+        printf("[ERROR] simint_map_multi_shellpairs: cannot map %s\n", filename);
+        return 1;
+    }
+
+    struct simint_store_header const * header = addr;
+    struct simint_store_entry const * entries = addr + sizeof(struct simint_store_header);
+
+    const char * err = NULL;
+    if(memcmp(header->magic, SIMINT_STORE_MAGIC, 8) != 0)
+        err = "not a shell pair file";
+    else if(header->version != SIMINT_STORE_VERSION)
+        err = "unsupported version";
+    else if(header->byteorder != SIMINT_STORE_BYTEORDER)
+        err = "written on a machine with a different byte order";
+    else if(header->simd_len != SIMINT_SIMD_LEN)
+        err = "written with a different vectorization";
+    else if(header->maxder != SIMINT_OSTEI_MAXDER)
+        err = "written with a different maximum derivative";
+    else if(header->n < 0 || header->n > INT32_MAX ||
+            (size_t)header->n > (filesize - sizeof(struct simint_store_header)) / sizeof(struct simint_store_entry))
+        err = "truncated or corrupt";
+
+    for(int64_t i = 0; err == NULL && i < header->n; i++)
+        if(store_check_entry(entries + i, addr, filesize))
+            err = "truncated or corrupt";
+
+    struct simint_multi_shellpair * P = NULL;
+    if(err == NULL)
+    {
+        P = malloc((header->n > 0 ? header->n : 1) * sizeof(struct simint_multi_shellpair));
+        if(P == NULL)
+            err = "cannot allocate the shell pairs";
+    }
+
+    if(err != NULL)
+    {
+        printf("[ERROR] simint_map_multi_shellpairs: %s: %s\n", filename, err);
+        munmap(addr, filesize);
+        return 1;
+    }
+
+    for(int i = 0; i < header->n; i++)
+    {
+        struct simint_store_entry const * e = entries + i;
+        void * block = addr + e->offset;
+
+        P[i].am1 = e->am1;
+        P[i].am2 = e->am2;
+        P[i].nprim = e->nprim;
+        P[i].nshell12 = e->nshell12;
+        P[i].nshell12_clip = e->nshell12_clip;
+        P[i].screen_max = e->screen_max;
+        P[i].prim_screen_max = e->prim_screen_max;
+
+        void * member[STORE_NMEMBER];
+        for(int m = 0; m < STORE_NMEMBER; m++)
+            member[m] = (e->member[m] < 0) ? NULL : block + e->member[m];
+        store_set_members(P + i, member);
+
+        // The memory is not owned by the shell pair
+        P[i].ptr = NULL;
+        P[i].memsize = 0;
+    }
+
+    map->n = header->n;
+    map->P = P;
+    map->addr = addr;
+    map->size = filesize;
+    return 0;
+}
+
+
+void simint_unmap_multi_shellpairs(struct simint_shellpair_map * map)
+{
+    if(map->addr != NULL)
+        munmap(map->addr, map->size);
+    free(map->P);
+    store_empty_map(map);
+}
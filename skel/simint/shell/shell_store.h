@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stddef.h>
+#include "simint/shell/shell.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \brief Multi shell pairs mapped from a file
+ *
+ * The data of the shell pairs is not copied. Their members point
+ * into a read-only mapping of the file, so processes on a node that
+ * map the same file share one copy (the page cache).
+ */
+struct simint_shellpair_map
+{
+    int n;                             //!< Number of multi shell pairs
+    struct simint_multi_shellpair * P; //!< The multi shell pairs (length n)
+
+    void * addr;                       //!< Start of the mapping
+    size_t size;                       //!< Size of the mapping (bytes)
+};
+
+
+/*! \brief Writes multi shell pairs to a file
+ *
+ * The file can be mapped with simint_map_multi_shellpairs by any
+ * program using a simint library with the same vectorization and
+ * maximum derivative order.
+ *
+ * \param [in] filename File to write (overwritten if it exists)
+ * \param [in] n Number of multi shell pairs
+ * \param [in] P The multi shell pairs to write (length n)
+ * \return Zero on success, nonzero on error
+ */
+int simint_write_multi_shellpairs(const char * filename, int n,
+                                  struct simint_multi_shellpair const * P);
+
+
+/*! \brief Maps multi shell pairs written by simint_write_multi_shellpairs
+ *
+ * The file is mapped read-only, and the pointers in each shell pair
+ * are set to point into the mapping.
+ *
+ * The shell pairs can be used with anything that does not change them
+ * (ie, computing integrals). They must not be filled or updated, but
+ * they may be copied with simint_cat_multi_shellpair. They don't own
+ * their memory, so simint_free_multi_shellpair does nothing to them.
+ *
+ * This requires mmap (ie, POSIX systems).
+ *
+ * \param [in] filename File to map
+ * \param [out] map Holds the mapped shell pairs
+ * \return Zero on success, nonzero on error (\p map is then empty)
+ */
+int simint_map_multi_shellpairs(const char * filename,
+                                struct simint_shellpair_map * map);
+
+
+/*! \brief Unmaps multi shell pairs mapped by simint_map_multi_shellpairs
+ *
+ * \param [inout] map The mapped shell pairs. Will be empty afterwards
+ */
+void simint_unmap_multi_shellpairs(struct simint_shellpair_map * map);
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -35,6 +35,8 @@ module SimintFortran
       type(C_PTR) :: PB_y
       type(C_PTR) :: PB_z
       type(C_PTR) :: alpha
+      type(C_PTR) :: alpha_a
+      type(C_PTR) :: beta
 
 #if SIMINT_OSTEI_MAXDER > 0
         type(C_PTR) :: alpha2
@@ -44,6 +46,8 @@ module SimintFortran
       type(C_PTR) :: prefac
       type(C_PTR) :: screen
       real(C_DOUBLE) :: screen_max
+      real(C_DOUBLE) :: prim_screen_max
+      type(C_PTR) :: primij
       integer(C_SIZE_T) :: memsize
       type(C_PTR) :: ptr
     end type
@@ -165,6 +169,26 @@ module SimintFortran
       integer(C_INT), intent(in), value :: npair, screen_method
     end subroutine
 
+    subroutine c_simint_update_multi_shellpair_geometry( &
+               na, A, nb, B, P, screen_method) &
+               bind(C, name="simint_update_multi_shellpair_geometry")
+      use iso_c_binding
+      implicit none
+      type(C_PTR), intent(in), value :: A, B
+      type(C_PTR), intent(in), value :: P
+      integer(C_INT), intent(in), value :: na, nb, screen_method
+    end subroutine
+
+    subroutine c_simint_update_multi_shellpair_geometry2( &
+               npair, AB, P, screen_method) &
+               bind(C, name="simint_update_multi_shellpair_geometry2")
+
+      use iso_c_binding
+      implicit none
+      type(C_PTR), intent(in), value :: AB, P
+      integer(C_INT), intent(in), value :: npair, screen_method
+    end subroutine
+
     function c_simint_compute_eri(P, Q, screen_tol, work, integrals) &
              result(res) bind(C, name="simint_compute_eri")
       use iso_c_binding
@@ -369,6 +393,33 @@ module SimintFortran
                                             INT(screen_method, C_INT))
     end subroutine
 
+    subroutine simint_update_multi_shellpair_geometry( &
+               na, A, nb, B, P, screen_method)
+      implicit none
+      integer, intent(in) :: na, nb, screen_method
+      type(c_simint_multi_shellpair), intent(inout), target :: P
+      type(c_simint_shell), intent(in), target :: A(na), B(nb)
+
+      call c_simint_update_multi_shellpair_geometry(INT(na, C_INT), &
+                                                    C_LOC(A), &
+                                                    INT(nb, C_INT), &
+                                                    C_LOC(B), &
+                                                    C_LOC(P), &
+                                                    INT(screen_method, C_INT))
+    end subroutine
+
+    subroutine simint_update_multi_shellpair_geometry2( &
+               npair, AB, P, screen_method)
+      implicit none
+      integer, intent(in) :: npair, screen_method
+      type(c_simint_shell), intent(in), target :: AB(npair)
+      type(c_simint_multi_shellpair), intent(inout), target :: P
+
+      call c_simint_update_multi_shellpair_geometry2(INT(npair, C_INT), &
+                                                     C_LOC(AB), C_LOC(P), &
+                                                     INT(screen_method, C_INT))
+    end subroutine
+
     function simint_compute_eri(P, Q, screen_tol, work, integrals) &
              result(res)
       implicit none
@@ -5,3 +5,5 @@
 #include "simint/simint_init.h"
 #include "simint/simint_eri.h"
 #include "simint/simint_oneelectron.h"
+#include "simint/simint_workspace.h"
+#include "simint/shell/shell_store.h"
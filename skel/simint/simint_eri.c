@@ -20,6 +20,80 @@ int simint_compute_eri_deriv(int deriv,
     return simint_compute_ostei_deriv(deriv, P, Q, screen_tol, work, integrals);
 }
 
+int simint_compute_eri_3c(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          double * restrict work,
+                          double * restrict integrals)
+{
+    return simint_compute_ostei_3c(P, Q, screen_tol, work, integrals);
+}
+
+int simint_compute_eri_2c(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          double * restrict work,
+                          double * restrict integrals)
+{
+    return simint_compute_ostei_2c(P, Q, screen_tol, work, integrals);
+}
+
+int simint_compute_eri_batch(int ntask,
+                             struct simint_multi_shellpair const * const * PQ,
+                             size_t const * offsets,
+                             double screen_tol,
+                             double * restrict work,
+                             double * restrict integrals,
+                             int * restrict ret)
+{
+    return simint_compute_ostei_batch(0, ntask, PQ, offsets, screen_tol,
+                                      work, integrals, ret);
+}
+
+int simint_compute_eri_deriv_batch(int deriv,
+                                   int ntask,
+                                   struct simint_multi_shellpair const * const * PQ,
+                                   size_t const * offsets,
+                                   double screen_tol,
+                                   double * restrict work,
+                                   double * restrict integrals,
+                                   int * restrict ret)
+{
+    return simint_compute_ostei_batch(deriv, ntask, PQ, offsets, screen_tol,
+                                      work, integrals, ret);
+}
+
+int simint_compute_eri_jk(struct simint_multi_shellpair const * P, int nb,
+                          struct simint_multi_shellpair const * Q, int nd,
+                          double screen_tol,
+                          double * restrict work,
+                          struct simint_jk_blocks const * jk)
+{
+    return simint_compute_ostei_jk(P, nb, Q, nd, screen_tol, work, jk);
+}
+
+
+int simint_compute_eri_grad(struct simint_multi_shellpair const * P, int nb,
+                            struct simint_multi_shellpair const * Q, int nd,
+                            double screen_tol,
+                            double * restrict work,
+                            struct simint_grad_blocks const * grad)
+{
+    return simint_compute_ostei_grad(P, nb, Q, nd, screen_tol, work, grad);
+}
+
+
+void simint_eri_set_float_tol(double tol)
+{
+    simint_ostei_set_float_tol(tol);
+}
+
+
+void simint_eri_set_swap(int enable)
+{
+    simint_ostei_set_swap(enable);
+}
+
 
 size_t simint_eri_worksize(int derorder, int maxam)
 {
@@ -31,3 +105,15 @@ size_t simint_eri_workmem(int derorder, int maxam)
 {
     return simint_ostei_workmem(derorder, maxam);
 }
+
+
+size_t simint_eri_worksize_quartet(int derorder, int am1, int am2, int am3, int am4)
+{
+    return simint_ostei_worksize_quartet(derorder, am1, am2, am3, am4);
+}
+
+
+size_t simint_eri_workmem_quartet(int derorder, int am1, int am2, int am3, int am4)
+{
+    return simint_ostei_workmem_quartet(derorder, am1, am2, am3, am4);
+}
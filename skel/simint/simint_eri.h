@@ -14,7 +14,8 @@ extern "C" {
  * \param [in] P The shell pairs for the bra side of the integral 
  * \param [in] Q The shell pairs for the ket side of the integral
  * \param [in] screen_tol Tolerance for screening (set to zero to disable)
- * \param [in] work Workspace to use in calculating the integrals
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
  * \param [inout] integrals Storage for the final integrals. Since size information
  *                          is not passed, you are expected to ensure that this buffer
  *                          is large enough
@@ -31,7 +32,8 @@ int simint_compute_eri(struct simint_multi_shellpair const * P,
  * \param [in] P The shell pairs for the bra side of the integral 
  * \param [in] Q The shell pairs for the ket side of the integral
  * \param [in] screen_tol Tolerance for screening (set to zero to disable)
- * \param [in] work Workspace to use in calculating the integrals
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
  * \param [inout] integrals Storage for the final integrals. Since size information
  *                          is not passed, you are expected to ensure that this buffer
  *                          is large enough
@@ -44,6 +46,250 @@ int simint_compute_eri_deriv(int deriv,
                              double * restrict integrals);
 
 
+/*! \brief Compute three-center ERI (A|CD), such as for density fitting
+ *
+ * \p P should be created from the shells A and a zero shell
+ * (simint_create_zero_shell) in the second position. The integrals are
+ * the same as from simint_compute_eri. If simint was generated with
+ * 3-center kernels (create.py -df), those are used: the Gaussian product
+ * is still formed with the zero shell (it gives P = A), but the kernels
+ * skip the PA terms of the recurrence relations.
+ *
+ * The second shell of \p P is checked (an s shell with only zero
+ * exponents). If it is not a zero shell, the 4-center path is used.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral (A and a zero shell)
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
+ * \param [inout] integrals Storage for the final integrals, as for simint_compute_eri
+ */
+int simint_compute_eri_3c(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          double * restrict work,
+                          double * restrict integrals);
+
+
+/*! \brief Compute two-center ERI (A|C), such as for density fitting
+ *
+ * As simint_compute_eri_3c, but \p Q should also be created with a zero
+ * shell in the second position (the 2-center kernels also skip the QC
+ * terms). If it is not a zero shell, this is the same as
+ * simint_compute_eri_3c.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral (A and a zero shell)
+ * \param [in] Q The shell pairs for the ket side of the integral (C and a zero shell)
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
+ * \param [inout] integrals Storage for the final integrals, as for simint_compute_eri
+ */
+int simint_compute_eri_2c(struct simint_multi_shellpair const * P,
+                          struct simint_multi_shellpair const * Q,
+                          double screen_tol,
+                          double * restrict work,
+                          double * restrict integrals);
+
+
+/*! \brief Compute a batch of ERI given a list of shell pairs
+ *
+ * The tasks are grouped by AM quartet internally and share the workspace.
+ *
+ * \param [in] ntask Number of tasks in the batch
+ * \param [in] PQ Shell pairs for each task, stored as (P,Q) pairs
+ *                (ie, length 2*ntask, P0 Q0 P1 Q1 ...)
+ * \param [in] offsets Where the integrals for each task should be stored,
+ *                     as an offset (in elements) into \p integrals
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
+ * \param [inout] integrals Storage for the final integrals
+ * \param [out] ret Return value for each task. Screened tasks get -1 and their
+ *                  integrals are not written. May be NULL.
+ * \return Total number of shell quartets calculated
+ */
+int simint_compute_eri_batch(int ntask,
+                             struct simint_multi_shellpair const * const * PQ,
+                             size_t const * offsets,
+                             double screen_tol,
+                             double * restrict work,
+                             double * restrict integrals,
+                             int * restrict ret);
+
+
+/*! \brief Compute a batch of ERI derivatives given a list of shell pairs
+ *
+ * \param [in] deriv Order of the derivative to compute
+ *
+ * See simint_compute_eri_batch for the remaining parameters
+ */
+int simint_compute_eri_deriv_batch(int deriv,
+                                   int ntask,
+                                   struct simint_multi_shellpair const * const * PQ,
+                                   size_t const * offsets,
+                                   double screen_tol,
+                                   double * restrict work,
+                                   double * restrict integrals,
+                                   int * restrict ret);
+
+
+/*! \brief Density and Coulomb/exchange blocks for simint_compute_eri_jk
+ *
+ * The shells of a multi shell pair created with simint_create_multi_shellpair
+ * from na shells A and nb shells B cover na*NCART(am1) and nb*NCART(am2) basis
+ * functions, numbered in order of the shells. Each block is stored row-major,
+ * with the functions of the first letter as rows. For example, D_ad has
+ * na*NCART(P->am1) rows and nd*NCART(Q->am2) columns.
+ *
+ * With (ab|cd) the integrals over functions a, b, c and d:
+ *
+ *     J_ab[a][b] += sum_cd (ab|cd) D_cd[c][d]
+ *     J_cd[c][d] += sum_ab (ab|cd) D_ab[a][b]
+ *     K_ac[a][c] += sum_bd (ab|cd) D_bd[b][d]
+ *     K_ad[a][d] += sum_bc (ab|cd) D_bc[b][c]
+ *     K_bc[b][c] += sum_ad (ab|cd) D_ad[a][d]
+ *     K_bd[b][d] += sum_ac (ab|cd) D_ac[a][c]
+ *
+ * Any J or K block may be NULL, in which case it is not computed. The density
+ * block it needs (the one on the right side above) must be given otherwise.
+ * No factors for permutational symmetry are included.
+ */
+struct simint_jk_blocks
+{
+    double const * D_ab;  //!< Density for functions of A and B
+    double const * D_cd;  //!< Density for functions of C and D
+    double const * D_ac;  //!< Density for functions of A and C
+    double const * D_ad;  //!< Density for functions of A and D
+    double const * D_bc;  //!< Density for functions of B and C
+    double const * D_bd;  //!< Density for functions of B and D
+
+    double * J_ab;        //!< Coulomb contribution for functions of A and B
+    double * J_cd;        //!< Coulomb contribution for functions of C and D
+    double * K_ac;        //!< Exchange contribution for functions of A and C
+    double * K_ad;        //!< Exchange contribution for functions of A and D
+    double * K_bc;        //!< Exchange contribution for functions of B and C
+    double * K_bd;        //!< Exchange contribution for functions of B and D
+};
+
+
+/*! \brief Compute ERI and digest them directly into Coulomb and exchange blocks
+ *
+ * The integrals are computed in small pieces, and each piece is contracted
+ * with the density while it is still in cache. The whole block of
+ * integrals is never stored.
+ *
+ * \p P and \p Q must have been created with simint_create_multi_shellpair
+ * (all na*nb pairs of shells, in order). See simint_jk_blocks for the layout
+ * of the blocks.
+ *
+ * \param [in] P The shell pairs for the bra side of the integral
+ * \param [in] nb Number of shells in the second position of \p P
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] nd Number of shells in the second position of \p Q
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
+ * \param [inout] jk Density blocks (read) and Coulomb/exchange blocks (accumulated)
+ * \return Number of shell quartets calculated, or -1 if everything was screened
+ */
+int simint_compute_eri_jk(struct simint_multi_shellpair const * P, int nb,
+                          struct simint_multi_shellpair const * Q, int nd,
+                          double screen_tol,
+                          double * restrict work,
+                          struct simint_jk_blocks const * jk);
+
+
+/*! \brief Two-particle density and gradient blocks for simint_compute_eri_grad
+ *
+ * Basis functions are numbered as for simint_jk_blocks. The two-particle
+ * density is either given directly (gamma[a][b][c][d], row-major), or, if
+ * gamma is NULL, formed from density blocks as
+ *
+ *     gamma[a][b][c][d] = fac_j * D_ab[a][b] * D_cd[c][d]
+ *                       - fac_k * (D_ac[a][c] * D_bd[b][d] + D_ad[a][d] * D_bc[b][c])
+ *
+ * The density blocks for a term are only needed if its factor is nonzero.
+ *
+ * The gradient blocks are indexed by shell: G_a[3*i + x] gets the derivative
+ * with respect to coordinate x of the center of shell i of A:
+ *
+ *     G_a[3*i + x] += sum_abcd gamma[a][b][c][d] d(ab|cd)/dA_x
+ *
+ * Any gradient block may be NULL. No factors for permutational symmetry
+ * are included.
+ */
+struct simint_grad_blocks
+{
+    double const * gamma; //!< Two-particle density (or NULL to use the density blocks)
+
+    double const * D_ab;  //!< Density for functions of A and B
+    double const * D_cd;  //!< Density for functions of C and D
+    double const * D_ac;  //!< Density for functions of A and C
+    double const * D_ad;  //!< Density for functions of A and D
+    double const * D_bc;  //!< Density for functions of B and C
+    double const * D_bd;  //!< Density for functions of B and D
+    double fac_j;         //!< Factor for the Coulomb-like term
+    double fac_k;         //!< Factor for the exchange-like term
+
+    double * G_a;         //!< Gradient for the shells of A (length 3*na)
+    double * G_b;         //!< Gradient for the shells of B (length 3*nb)
+    double * G_c;         //!< Gradient for the shells of C (length 3*nc)
+    double * G_d;         //!< Gradient for the shells of D (length 3*nd)
+};
+
+
+/*! \brief Compute ERI first derivatives and contract them into gradients
+ *
+ * The derivatives are computed in small pieces, and each piece is
+ * contracted with the two-particle density while it is still in cache.
+ * The 12 derivatives of every integral are never stored.
+ *
+ * \p P and \p Q must have been created with simint_create_multi_shellpair,
+ * as for simint_compute_eri_jk. Requires simint to be built with
+ * derivatives (SIMINT_OSTEI_MAXDER > 0).
+ *
+ * \param [in] P The shell pairs for the bra side of the integral
+ * \param [in] nb Number of shells in the second position of \p P
+ * \param [in] Q The shell pairs for the ket side of the integral
+ * \param [in] nd Number of shells in the second position of \p Q
+ * \param [in] screen_tol Tolerance for screening (set to zero to disable)
+ * \param [in] work Workspace to use in calculating the integrals. If NULL,
+ *                  workspace is taken from the per-thread pool (see simint_workspace_acquire)
+ * \param [inout] grad Density (read) and gradient blocks (accumulated)
+ * \return Number of shell quartets calculated, or -1 if everything was screened
+ *         or derivatives are not available
+ */
+int simint_compute_eri_grad(struct simint_multi_shellpair const * P, int nb,
+                            struct simint_multi_shellpair const * Q, int nd,
+                            double screen_tol,
+                            double * restrict work,
+                            struct simint_grad_blocks const * grad);
+
+
+/*! \brief Set the tolerance for computing integrals in single precision
+ *
+ * Shell quartets where the largest integral is estimated to be below \p tol
+ * are computed with single-precision primitive integrals.
+ * See simint_ostei_set_float_tol.
+ *
+ * \param [in] tol Tolerance (set to zero to disable, which is the default)
+ */
+void simint_eri_set_float_tol(double tol);
+
+
+/*! \brief Enable or disable computing (P|Q) as (Q|P)
+ *
+ * Without derivatives, (P|Q) is computed as (Q|P) and transposed when
+ * that is faster (the ket has few primitives). This is enabled by default.
+ * See simint_ostei_set_swap.
+ *
+ * \param [in] enable Nonzero to allow the swap, zero to disable it
+ */
+void simint_eri_set_swap(int enable);
+
+
 /*! \brief Get the required size of the workspace required (number of elements)
  *
  * \param [in] derorder Order of the derivative (0 = no derivative, 1 = first derivative)
@@ -62,6 +308,32 @@ size_t simint_eri_worksize(int derorder, int maxam);
 size_t simint_eri_workmem(int derorder, int maxam);
 
 
+/*! \brief Get the size of the workspace required for a single AM quartet (number of elements)
+ *
+ * This is generally much smaller than simint_eri_worksize for low AM quartets.
+ *
+ * \param [in] derorder Order of the derivative (0 = no derivative, 1 = first derivative)
+ * \param [in] am1 Angular momentum of the first center
+ * \param [in] am2 Angular momentum of the second center
+ * \param [in] am3 Angular momentum of the third center
+ * \param [in] am4 Angular momentum of the fourth center
+ * \return Minimum size of the workspace required (as number of double-precision elements)
+ */
+size_t simint_eri_worksize_quartet(int derorder, int am1, int am2, int am3, int am4);
+
+
+/*! \brief Get the size of the workspace required for a single AM quartet (in bytes)
+ *
+ * \param [in] derorder Order of the derivative (0 = no derivative, 1 = first derivative)
+ * \param [in] am1 Angular momentum of the first center
+ * \param [in] am2 Angular momentum of the second center
+ * \param [in] am3 Angular momentum of the third center
+ * \param [in] am4 Angular momentum of the fourth center
+ * \return Minimum size of the workspace required (in bytes)
+ */
+size_t simint_eri_workmem_quartet(int derorder, int am1, int am2, int am3, int am4);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,10 +1,13 @@
 #include "simint/simint_init.h"
 #include "simint/ostei/ostei_init.h"
+#include "simint/simint_workspace.h"
 
 void simint_init(void)
 {
     simint_ostei_init();
     simint_ostei_deriv1_init();
+    simint_ostei_float_init();
+    simint_ostei_df_init();
 }
 
 
@@ -12,5 +15,8 @@ void simint_finalize(void)
 {
     simint_ostei_finalize();
     simint_ostei_deriv1_finalize();
+    simint_ostei_float_finalize();
+    simint_ostei_df_finalize();
+    simint_workspace_finalize();
 }
 
@@ -17,6 +17,20 @@ int simint_compute_ke(struct simint_shell * a,
 }
 
 
+int simint_compute_overlap_multi(struct simint_multi_shellpair const * P,
+                                 double * restrict integrals)
+{
+    return simint_compute_osoei_overlap_multi(P, integrals);
+}
+
+
+int simint_compute_ke_multi(struct simint_multi_shellpair const * P,
+                            double * restrict integrals)
+{
+    return simint_compute_osoei_ke_multi(P, integrals);
+}
+
+
 int simint_compute_potential(int ncenter,
                              double * Z, double * x, double * y, double * z,
                              struct simint_shell const * sh1,
@@ -25,3 +39,12 @@ int simint_compute_potential(int ncenter,
 {
     return simint_compute_osoei_potential(ncenter, Z, x, y, z, sh1, sh2, integrals);
 }
+
+
+int simint_compute_potential_multi(int ncenter,
+                                   double * Z, double * x, double * y, double * z,
+                                   struct simint_multi_shellpair const * P,
+                                   double * restrict integrals)
+{
+    return simint_compute_osoei_potential_multi(ncenter, Z, x, y, z, P, integrals);
+}
@@ -24,6 +24,62 @@ int simint_compute_potential(int ncenter,
                              struct simint_shell const * sh2,
                              double * restrict integrals);
 
+
+/*! \brief Computes overlap integrals for all shell pairs in a multi shell pair
+ *
+ * The Gaussian product information already stored in \p P is reused, and
+ * the integrals are vectorized over the primitive pairs. \p P only needs
+ * to be filled once for both the ERI and one-electron integrals.
+ *
+ * The integrals for each shell pair are stored one after the other
+ * (in the order of the shell pairs in \p P), each block
+ * being NCART(am1)*NCART(am2) long.
+ *
+ * \param [in] P Shell pairs to calculate (all P->nshell12_clip of them)
+ * \param [out] integrals Output integrals
+ * \return Number of shell pairs calculated
+ */
+int simint_compute_overlap_multi(struct simint_multi_shellpair const * P,
+                                 double * restrict integrals);
+
+
+/*! \brief Computes kinetic energy integrals for all shell pairs in a multi shell pair
+ *
+ * See simint_compute_overlap_multi
+ *
+ * \param [in] P Shell pairs to calculate (all P->nshell12_clip of them)
+ * \param [out] integrals Output integrals
+ * \return Number of shell pairs calculated
+ */
+int simint_compute_ke_multi(struct simint_multi_shellpair const * P,
+                            double * restrict integrals);
+
+
+/*! \brief Computes nuclear attraction integrals for all shell pairs in a multi shell pair
+ *
+ * The integrals are vectorized over the point charges, so this is most
+ * efficient with many of them (ie, QM/MM). The Gaussian product information
+ * already stored in \p P is reused, so \p P only needs to be filled
+ * once for both the ERI and one-electron integrals.
+ *
+ * The integrals for each shell pair are stored one after the other
+ * (in the order of the shell pairs in \p P), each block
+ * being NCART(am1)*NCART(am2) long.
+ *
+ * \param [in] ncenter Number of point charges
+ * \param [in] Z Charges of the point charges (length \p ncenter)
+ * \param [in] x X coordinates of the point charges (length \p ncenter)
+ * \param [in] y Y coordinates of the point charges (length \p ncenter)
+ * \param [in] z Z coordinates of the point charges (length \p ncenter)
+ * \param [in] P Shell pairs to calculate (all P->nshell12_clip of them)
+ * \param [out] integrals Output integrals
+ * \return Number of shell pairs calculated
+ */
+int simint_compute_potential_multi(int ncenter,
+                                   double * Z, double * x, double * y, double * z,
+                                   struct simint_multi_shellpair const * P,
+                                   double * restrict integrals);
+
 #ifdef __cplusplus
 }
 #endif
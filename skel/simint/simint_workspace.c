@@ -0,0 +1,246 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "simint/simint_workspace.h"
+#include "simint/ostei/ostei_config.h"
+#include "simint/vectorization/vectorization.h"
+
+#if defined __INTEL_COMPILER || defined __GNUC__ || defined __clang__
+  #define SIMINT_THREAD_LOCAL __thread
+#else
+  #define SIMINT_THREAD_LOCAL _Thread_local
+#endif
+
+// Number of buffers kept by each thread. If more than this are
+// acquired at the same time, the extras are plain allocations
+#define SIMINT_WORKSPACE_NBUF 4
+
+
+//! Buffers belonging to a single thread
+struct simint_workspace_pool
+{
+    double * buf[SIMINT_WORKSPACE_NBUF];
+    size_t size[SIMINT_WORKSPACE_NBUF];
+    int in_use[SIMINT_WORKSPACE_NBUF];
+    int generation;   // set when the pool is created, then only read by its thread
+    struct simint_workspace_pool * next;
+};
+
+
+// All the pools that have been created, so their buffers can be freed
+// by simint_workspace_finalize. Protected by simint_workspace_lock
+static struct simint_workspace_pool * simint_workspace_pools = NULL;
+static pthread_mutex_t simint_workspace_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Incremented by simint_workspace_finalize, so that
+// threads know the buffers of their pool no longer exist. Only changed
+// under simint_workspace_lock, but read without it by
+// simint_workspace_thread_pool, so all accesses are atomic
+static int simint_workspace_generation = 0;
+
+#if defined __INTEL_COMPILER || defined __GNUC__ || defined __clang__
+  #define SIMINT_ATOMIC_LOAD(x)     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+  #define SIMINT_ATOMIC_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#endif
+
+// Key used to free the pool of a thread when it exits
+static pthread_key_t simint_workspace_key;
+static pthread_once_t simint_workspace_key_once = PTHREAD_ONCE_INIT;
+
+static SIMINT_THREAD_LOCAL struct simint_workspace_pool * thread_pool = NULL;
+
+
+// Frees the buffers of a pool
+static void simint_workspace_free_buffers(struct simint_workspace_pool * pool)
+{
+    for(int i = 0; i < SIMINT_WORKSPACE_NBUF; i++)
+    {
+        if(pool->buf[i] != NULL)
+            SIMINT_FREE(pool->buf[i]);
+
+        pool->buf[i] = NULL;
+        pool->size[i] = 0;
+        pool->in_use[i] = 0;
+    }
+}
+
+
+// Frees a pool, removing it from the list if simint_workspace_finalize
+// hasn't already done so. Only called by the thread owning the pool
+// (or at its exit)
+static void simint_workspace_free_pool(void * p)
+{
+    struct simint_workspace_pool * pool = (struct simint_workspace_pool *)p;
+
+    pthread_mutex_lock(&simint_workspace_lock);
+    if(pool->generation == simint_workspace_generation)
+    {
+        struct simint_workspace_pool ** it = &simint_workspace_pools;
+        while(*it != NULL && *it != pool)
+            it = &(*it)->next;
+        if(*it != NULL)
+            *it = pool->next;
+    }
+    pthread_mutex_unlock(&simint_workspace_lock);
+
+    simint_workspace_free_buffers(pool);
+    free(pool);
+}
+
+
+static void simint_workspace_create_key(void)
+{
+    pthread_key_create(&simint_workspace_key, simint_workspace_free_pool);
+}
+
+
+// Current value of simint_workspace_generation
+static int simint_workspace_current_generation(void)
+{
+    #ifdef SIMINT_ATOMIC_LOAD
+    return SIMINT_ATOMIC_LOAD(simint_workspace_generation);
+    #else
+    pthread_mutex_lock(&simint_workspace_lock);
+    const int generation = simint_workspace_generation;
+    pthread_mutex_unlock(&simint_workspace_lock);
+    return generation;
+    #endif
+}
+
+
+static struct simint_workspace_pool * simint_workspace_thread_pool(void)
+{
+    if(thread_pool == NULL || thread_pool->generation != simint_workspace_current_generation())
+    {
+        // The buffers of an old pool were freed by simint_workspace_finalize,
+        // but the pool itself still belongs to this thread
+        if(thread_pool != NULL)
+            free(thread_pool);
+
+        pthread_once(&simint_workspace_key_once, simint_workspace_create_key);
+
+        struct simint_workspace_pool * pool = calloc(1, sizeof(struct simint_workspace_pool));
+
+        pthread_mutex_lock(&simint_workspace_lock);
+        pool->generation = simint_workspace_generation;
+        pool->next = simint_workspace_pools;
+        simint_workspace_pools = pool;
+        pthread_mutex_unlock(&simint_workspace_lock);
+
+        thread_pool = pool;
+        pthread_setspecific(simint_workspace_key, pool);
+    }
+
+    return thread_pool;
+}
+
+
+double * simint_workspace_acquire(int derorder, int maxam)
+{
+    return simint_workspace_acquire_size(simint_ostei_worksize(derorder, maxam));
+}
+
+
+double * simint_workspace_acquire_size(size_t nelements)
+{
+    struct simint_workspace_pool * pool = simint_workspace_thread_pool();
+
+    if(nelements == 0)
+        nelements = SIMINT_SIMD_LEN;
+
+    // Use the first free buffer that is large enough. Otherwise,
+    // grow the largest free buffer
+    int use = -1;
+    for(int i = 0; i < SIMINT_WORKSPACE_NBUF; i++)
+    {
+        if(pool->in_use[i])
+            continue;
+
+        if(pool->size[i] >= nelements)
+        {
+            use = i;
+            break;
+        }
+
+        if(use < 0 || pool->size[i] > pool->size[use])
+            use = i;
+    }
+
+    // all buffers are in use
+    if(use < 0)
+        return (double *)SIMINT_ALLOC(nelements * sizeof(double));
+
+    if(pool->size[use] < nelements)
+    {
+        if(pool->buf[use] != NULL)
+            SIMINT_FREE(pool->buf[use]);
+
+        pool->buf[use] = (double *)SIMINT_ALLOC(nelements * sizeof(double));
+
+        // touch the memory from this thread, so that the pages
+        // are placed close to it
+        memset(pool->buf[use], 0, nelements * sizeof(double));
+        pool->size[use] = nelements;
+    }
+
+    pool->in_use[use] = 1;
+    return pool->buf[use];
+}
+
+
+void simint_workspace_release(double * work)
+{
+    if(work == NULL)
+        return;
+
+    struct simint_workspace_pool * pool = simint_workspace_thread_pool();
+
+    for(int i = 0; i < SIMINT_WORKSPACE_NBUF; i++)
+    {
+        if(pool->in_use[i] && pool->buf[i] == work)
+        {
+            pool->in_use[i] = 0;
+            return;
+        }
+    }
+
+    // wasn't one of ours, so it was allocated because
+    // all the buffers were in use
+    SIMINT_FREE(work);
+}
+
+
+void simint_workspace_finalize(void)
+{
+    // Other threads may still be running (and exit later), so only
+    // their buffers are freed here. Each thread frees its own pool
+    // when it next needs one, or when it exits.
+    pthread_mutex_lock(&simint_workspace_lock);
+
+    struct simint_workspace_pool * pool = simint_workspace_pools;
+    while(pool != NULL)
+    {
+        struct simint_workspace_pool * next = pool->next;
+        simint_workspace_free_buffers(pool);
+        pool->next = NULL;
+        pool = next;
+    }
+
+    simint_workspace_pools = NULL;
+    #ifdef SIMINT_ATOMIC_STORE
+    SIMINT_ATOMIC_STORE(simint_workspace_generation, simint_workspace_generation + 1);
+    #else
+    simint_workspace_generation++;
+    #endif
+
+    pthread_mutex_unlock(&simint_workspace_lock);
+
+    // The pool of this thread can be freed now
+    if(thread_pool != NULL)
+    {
+        free(thread_pool);
+        thread_pool = NULL;
+        pthread_setspecific(simint_workspace_key, NULL);
+    }
+}
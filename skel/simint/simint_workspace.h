@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*! \brief Obtain workspace from the library-managed, per-thread pool
+ *
+ * Each thread has its own set of buffers. They are allocated (and first
+ * touched) by the thread that uses them, and are only grown when a larger
+ * workspace is requested. Workspace obtained this way must be given back
+ * with simint_workspace_release (by the same thread). The buffers of a
+ * thread are freed when it exits, or by simint_finalize.
+ *
+ * It is safe to acquire more than one workspace at a time (ie, nested).
+ *
+ * \param [in] derorder Order of the derivative (0 = no derivative, 1 = first derivative)
+ * \param [in] maxam Maximum angular momentum to be used in an ERI calculation
+ * \return Workspace of at least simint_ostei_worksize(derorder, maxam) elements
+ */
+double * simint_workspace_acquire(int derorder, int maxam);
+
+
+/*! \brief Obtain workspace of a given size from the per-thread pool
+ *
+ * See simint_workspace_acquire
+ *
+ * \param [in] nelements Minimum size of the workspace (number of double-precision elements)
+ */
+double * simint_workspace_acquire_size(size_t nelements);
+
+
+/*! \brief Return workspace to the per-thread pool
+ *
+ * \param [in] work Workspace obtained from simint_workspace_acquire
+ */
+void simint_workspace_release(double * work);
+
+
+/*! \brief Frees all memory held by the workspace pools of all threads
+ *
+ * Called from simint_finalize. The (small) bookkeeping of other threads
+ * is freed when they next acquire workspace, or when they exit.
+ *
+ * \warning Is not thread safe. No thread may be holding workspace
+ *          when this is called.
+ */
+void simint_workspace_finalize(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -18,24 +18,35 @@ union simint_double4
 };
 
 
-// Missing GCC vectorized exp and pow
-static inline __m256d simint_exp_vec4(__m256d x)
+// Building blocks for the vectorized exp and pow (see vecmath.h)
+// Without AVX2, there are no 256-bit integer shifts, so
+// the two halves are done with SSE
+
+// 2^k for integer-valued k in [-1022, 1023]
+static inline __m256d simint_pow2i_vec4(__m256d k)
 {
-    union simint_double4 u = { x };
-    union simint_double4 res;
-    for(int i = 0; i < 4; i++)
-        res.d[i] = exp(u.d[i]);
-    return res.v;
+    #ifdef __AVX2__
+    const __m256d t = _mm256_add_pd(k, _mm256_set1_pd(6755399441055744.0 + 1023.0));
+    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(t), 52));
+    #else
+    const __m128d lo = simint_pow2i_vec2(_mm256_castpd256_pd128(k));
+    const __m128d hi = simint_pow2i_vec2(_mm256_extractf128_pd(k, 1));
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+    #endif
 }
 
-static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
+// Exponent of a positive, normal x (as a double)
+static inline __m256d simint_logb_vec4(__m256d x)
 {
-    union simint_double4 ua = { a };
-    union simint_double4 up = { p };
-    union simint_double4 res;
-    for(int i = 0; i < 4; i++)
-        res.d[i] = pow(ua.d[i], up.d[i]);
-    return res.v;
+    #ifdef __AVX2__
+    const __m256i e = _mm256_srli_epi64(_mm256_castpd_si256(x), 52);
+    const __m256d t = _mm256_or_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0));
+    return _mm256_sub_pd(t, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+    #else
+    const __m128d lo = simint_logb_vec2(_mm256_castpd256_pd128(x));
+    const __m128d hi = simint_logb_vec2(_mm256_extractf128_pd(x, 1));
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(lo), hi, 1);
+    #endif
 }
 
 #if defined SIMINT_AVX || defined SIMINT_AVX2
@@ -51,6 +62,10 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
     #define SIMINT_MUL(a,b)        _mm256_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm256_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm256_sqrt_pd((a))
+    #define SIMINT_MIN(a,b)        _mm256_min_pd((a), (b))
+    #define SIMINT_MAX(a,b)        _mm256_max_pd((a), (b))
+    #define SIMINT_POW2I(k)        simint_pow2i_vec4((k))
+    #define SIMINT_LOGB(a)         simint_logb_vec4((a))
 
     #ifdef SIMINT_AVX2
       #define SIMINT_FMADD(a,b,c)  _mm256_fmadd_pd((a), (b), (c))
@@ -64,8 +79,8 @@ static inline __m256d simint_pow_vec4(__m256d a, __m256d p)
         #define SIMINT_EXP(a)       _mm256_exp_pd((a))
         #define SIMINT_POW(a,p)     _mm256_pow_pd((a), (p))
     #else
-        #define SIMINT_EXP(a)       simint_exp_vec4((a))
-        #define SIMINT_POW(a,p)     simint_pow_vec4((a), (p))
+        #define SIMINT_EXP(a)       simint_exp_vec((a))
+        #define SIMINT_POW(a,p)     simint_pow_vec((a), (p))
     #endif
 
 
@@ -18,24 +18,18 @@ union simint_double8
 };
 
 
-// Missing GCC vectorized exp and pow
-static inline __m512d simint_exp_vec8(__m512d x)
+// Building blocks for the vectorized exp and pow (see vecmath.h)
+
+// 2^k for integer-valued k in [-1022, 1023]
+static inline __m512d simint_pow2i_vec8(__m512d k)
 {
-    union simint_double8 u = { x };
-    union simint_double8 res;
-    for(int i = 0; i < 8; i++)
-        res.d[i] = exp(u.d[i]);
-    return res.v;
+    return _mm512_scalef_pd(_mm512_set1_pd(1.0), k);
 }
 
-static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
+// Exponent of a positive, normal x (as a double)
+static inline __m512d simint_logb_vec8(__m512d x)
 {
-    union simint_double8 ua = { a };
-    union simint_double8 up = { p };
-    union simint_double8 res;
-    for(int i = 0; i < 8; i++)
-        res.d[i] = pow(ua.d[i], up.d[i]);
-    return res.v;
+    return _mm512_getexp_pd(x);
 }
 
 #if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
@@ -51,6 +45,10 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
     #define SIMINT_MUL(a,b)        _mm512_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm512_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm512_sqrt_pd((a))
+    #define SIMINT_MIN(a,b)        _mm512_min_pd((a), (b))
+    #define SIMINT_MAX(a,b)        _mm512_max_pd((a), (b))
+    #define SIMINT_POW2I(k)        simint_pow2i_vec8((k))
+    #define SIMINT_LOGB(a)         simint_logb_vec8((a))
     #define SIMINT_FMADD(a,b,c)    _mm512_fmadd_pd((a), (b), (c))
     #define SIMINT_FMSUB(a,b,c)    _mm512_fmsub_pd((a), (b), (c))
 
@@ -58,8 +56,8 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
         #define SIMINT_EXP(a)       _mm512_exp_pd((a))
         #define SIMINT_POW(a,p)     _mm512_pow_pd((a), (p))
     #else
-        #define SIMINT_EXP(a)       simint_exp_vec8((a))
-        #define SIMINT_POW(a,p)     simint_pow_vec8((a), (p))
+        #define SIMINT_EXP(a)       simint_exp_vec((a))
+        #define SIMINT_POW(a,p)     simint_pow_vec((a), (p))
     #endif
 
 
@@ -163,7 +161,7 @@ static inline __m512d simint_pow_vec8(__m512d a, __m512d p)
         #else
 
         int offsets[8] = {0, 0, 0, 0, 0, 0, 0, 0};
-        contract_fac(ncart, offsets, factor, src, dest);
+        contract_fac(ncart, factor, offsets, src, dest);
 
         #endif
     }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "simint/vectorization/intrinsics_avx.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+#if defined SIMINT_AVX || defined SIMINT_AVX2
+
+    // Single precision. A float vector holds twice as many
+    // elements as a double vector
+    #define SIMINT_FLT_SIMD_LEN 8
+
+    #define SIMINT_FLTTYPE            __m256
+    #define SIMINT_FLTSET1(a)         _mm256_set1_ps((float)(a))
+    #define SIMINT_FLT_NEG(a)         (-(a))
+    #define SIMINT_FLT_ADD(a,b)       _mm256_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)       _mm256_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)       _mm256_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)       _mm256_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)        _mm256_sqrt_ps((a))
+
+    #ifdef SIMINT_AVX2
+      #define SIMINT_FLT_FMADD(a,b,c) _mm256_fmadd_ps((a), (b), (c))
+    #else
+      #define SIMINT_FLT_FMADD(a,b,c) SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+    #endif
+
+    // Conversion between float vectors and (two) double vectors
+    #define SIMINT_FLT_FROM_DBL(lo,hi)  _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps((lo))), \
+                                                             _mm256_cvtpd_ps((hi)), 1)
+    #define SIMINT_FLT_TO_DBL_LO(a)     _mm256_cvtps_pd(_mm256_castps256_ps128((a)))
+    #define SIMINT_FLT_TO_DBL_HI(a)     _mm256_cvtps_pd(_mm256_extractf128_ps((a), 1))
+
+#endif // defined SIMINT_AVX || defined SIMINT_AVX2
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "simint/vectorization/intrinsics_avx512.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+#if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
+
+    // Single precision. A float vector holds twice as many
+    // elements as a double vector
+    #define SIMINT_FLT_SIMD_LEN 16
+
+    #define SIMINT_FLTTYPE            __m512
+    #define SIMINT_FLTSET1(a)         _mm512_set1_ps((float)(a))
+    #define SIMINT_FLT_NEG(a)         (SIMINT_FLT_MUL((a), (SIMINT_FLTSET1(-1.0f))))
+    #define SIMINT_FLT_ADD(a,b)       _mm512_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)       _mm512_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)       _mm512_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)       _mm512_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)        _mm512_sqrt_ps((a))
+    #define SIMINT_FLT_FMADD(a,b,c)   _mm512_fmadd_ps((a), (b), (c))
+
+    // Conversion between float vectors and (two) double vectors
+    // The 256-bit halves are moved as doubles, since the
+    // float versions of insert/extract require AVX512DQ
+    #define SIMINT_FLT_FROM_DBL(lo,hi)  _mm512_castpd_ps(_mm512_insertf64x4( \
+                                            _mm512_castpd256_pd512(_mm256_castps_pd(_mm512_cvtpd_ps((lo)))), \
+                                            _mm256_castps_pd(_mm512_cvtpd_ps((hi))), 1))
+    #define SIMINT_FLT_TO_DBL_LO(a)     _mm512_cvtps_pd(_mm512_castps512_ps256((a)))
+    #define SIMINT_FLT_TO_DBL_HI(a)     _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd((a)), 1)))
+
+#endif // defined SIMINT_AVX512 || defined SIMINT_MICAVX512
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "simint/vectorization/intrinsics_scalar.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+#if defined SIMINT_SCALAR
+
+    // Single precision. There is only one lane, so the
+    // "high" half of a float vector is the same as the low half
+    #define SIMINT_FLT_SIMD_LEN 1
+
+    #define SIMINT_FLTTYPE            float
+    #define SIMINT_FLTSET1(a)         ((float)(a))
+    #define SIMINT_FLT_NEG(a)         (-(a))
+    #define SIMINT_FLT_ADD(a,b)       ((a)+(b))
+    #define SIMINT_FLT_SUB(a,b)       ((a)-(b))
+    #define SIMINT_FLT_MUL(a,b)       ((a)*(b))
+    #define SIMINT_FLT_DIV(a,b)       ((a)/(b))
+    #define SIMINT_FLT_SQRT(a)        sqrtf((a))
+    #define SIMINT_FLT_FMADD(a,b,c)   SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+
+    // Conversion between float vectors and (two) double vectors
+    #define SIMINT_FLT_FROM_DBL(lo,hi)  ((float)(lo))
+    #define SIMINT_FLT_TO_DBL_LO(a)     ((double)(a))
+    #define SIMINT_FLT_TO_DBL_HI(a)     ((double)(a))
+
+#endif // defined SIMINT_SCALAR
+
+#ifdef __cplusplus
+}
+#endif
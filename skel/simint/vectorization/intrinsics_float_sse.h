@@ -0,0 +1,40 @@
+#pragma once
+
+#include "simint/vectorization/intrinsics_sse.h"
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+#if defined SIMINT_SSE
+
+    // Single precision. A float vector holds twice as many
+    // elements as a double vector
+    #define SIMINT_FLT_SIMD_LEN 4
+
+    #define SIMINT_FLTTYPE            __m128
+    #define SIMINT_FLTSET1(a)         _mm_set1_ps((float)(a))
+    #define SIMINT_FLT_NEG(a)         (-(a))
+    #define SIMINT_FLT_ADD(a,b)       _mm_add_ps((a), (b))
+    #define SIMINT_FLT_SUB(a,b)       _mm_sub_ps((a), (b))
+    #define SIMINT_FLT_MUL(a,b)       _mm_mul_ps((a), (b))
+    #define SIMINT_FLT_DIV(a,b)       _mm_div_ps((a), (b))
+    #define SIMINT_FLT_SQRT(a)        _mm_sqrt_ps((a))
+
+    #ifdef SIMINT_FMA
+      #define SIMINT_FLT_FMADD(a,b,c) _mm_fmadd_ps((a), (b), (c))
+    #else
+      #define SIMINT_FLT_FMADD(a,b,c) SIMINT_FLT_ADD(SIMINT_FLT_MUL((a),(b)),(c))
+    #endif
+
+    // Conversion between float vectors and (two) double vectors
+    #define SIMINT_FLT_FROM_DBL(lo,hi)  _mm_movelh_ps(_mm_cvtpd_ps((lo)), _mm_cvtpd_ps((hi)))
+    #define SIMINT_FLT_TO_DBL_LO(a)     _mm_cvtps_pd((a))
+    #define SIMINT_FLT_TO_DBL_HI(a)     _mm_cvtps_pd(_mm_movehl_ps((a), (a)))
+
+#endif // defined SIMINT_SSE
+
+#ifdef __cplusplus
+}
+#endif
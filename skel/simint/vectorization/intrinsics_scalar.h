@@ -18,6 +18,10 @@ extern "C" {
     #define SIMINT_MUL(a,b)        ((a)*(b))
     #define SIMINT_DIV(a,b)        ((a)/(b))
     #define SIMINT_SQRT(a)         sqrt((a))
+    #define SIMINT_MIN(a,b)        fmin((a), (b))
+    #define SIMINT_MAX(a,b)        fmax((a), (b))
+    #define SIMINT_POW2I(k)        ldexp(1.0, (int)(k))
+    #define SIMINT_LOGB(a)         logb((a))
     #define SIMINT_FMADD(a,b,c)    SIMINT_ADD(SIMINT_MUL((a),(b)),(c))
     #define SIMINT_FMSUB(a,b,c)    SIMINT_SUB(SIMINT_MUL((a),(b)),(c))
     #define SIMINT_EXP(a)          exp((a))
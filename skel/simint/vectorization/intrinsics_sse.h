@@ -15,24 +15,23 @@ union simint_double2
 };
 
 
-// Missing GCC vectorized exp and pow
-static inline __m128d simint_exp_vec2(__m128d x)
+// Building blocks for the vectorized exp and pow (see vecmath.h)
+
+// 2^k for integer-valued k in [-1022, 1023]
+static inline __m128d simint_pow2i_vec2(__m128d k)
 {
-    union simint_double2 u = { x };
-    union simint_double2 res;
-    for(int i = 0; i < 2; i++)
-        res.d[i] = exp(u.d[i]);
-    return res.v;
+    // k + 1023 ends up in the low bits of the mantissa
+    const __m128d t = _mm_add_pd(k, _mm_set1_pd(6755399441055744.0 + 1023.0));
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(t), 52));
 }
 
-static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
+// Exponent of a positive, normal x (as a double)
+static inline __m128d simint_logb_vec2(__m128d x)
 {
-    union simint_double2 ua = { a };
-    union simint_double2 up = { p };
-    union simint_double2 res;
-    for(int i = 0; i < 2; i++)
-        res.d[i] = pow(ua.d[i], up.d[i]);
-    return res.v;
+    // Put the biased exponent into the mantissa of 2^52
+    const __m128i e = _mm_srli_epi64(_mm_castpd_si128(x), 52);
+    const __m128d t = _mm_or_pd(_mm_castsi128_pd(e), _mm_set1_pd(4503599627370496.0));
+    return _mm_sub_pd(t, _mm_set1_pd(4503599627370496.0 + 1023.0));
 }
 
 #if defined SIMINT_SSE
@@ -48,6 +47,10 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
     #define SIMINT_MUL(a,b)        _mm_mul_pd((a), (b))
     #define SIMINT_DIV(a,b)        _mm_div_pd((a), (b))
     #define SIMINT_SQRT(a)         _mm_sqrt_pd((a))
+    #define SIMINT_MIN(a,b)        _mm_min_pd((a), (b))
+    #define SIMINT_MAX(a,b)        _mm_max_pd((a), (b))
+    #define SIMINT_POW2I(k)        simint_pow2i_vec2((k))
+    #define SIMINT_LOGB(a)         simint_logb_vec2((a))
 
     #ifdef SIMINT_FMA
       #define SIMINT_FMADD(a,b,c)  _mm_fmadd_pd((a), (b), (c))
@@ -61,8 +64,8 @@ static inline __m128d simint_pow_vec2(__m128d a, __m128d p)
         #define SIMINT_EXP(a)       _mm_exp_pd((a))
         #define SIMINT_POW(a,p)     _mm_pow_pd((a), (p))
     #else
-        #define SIMINT_EXP(a)       simint_exp_vec2((a))
-        #define SIMINT_POW(a,p)     simint_pow_vec2((a), (p))
+        #define SIMINT_EXP(a)       simint_exp_vec((a))
+        #define SIMINT_POW(a,p)     simint_pow_vec((a), (p))
     #endif
 
 
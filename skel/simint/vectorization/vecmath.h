@@ -0,0 +1,250 @@
+#pragma once
+
+/* Vectorized exp and pow
+ *
+ * These are used for SIMINT_EXP and SIMINT_POW when there is no vector
+ * math library (SVML comes with the Intel compiler only). They are written
+ * in terms of the SIMINT_ macros for the vectorization type, so this file
+ * must be included after the intrinsics header (see vectorization.h).
+ *
+ * Error compared to libm (see test/test_vecmath.cpp):
+ *
+ *   simint_exp_vec(x)    <= 1 ULP, for all x. Results smaller than
+ *                        DBL_MIN are subnormal, and are correct to
+ *                        1 ULP of DBL_TRUE_MIN. Overflows to infinity
+ *                        above log(DBL_MAX).
+ *
+ *   simint_pow_vec(x,p)  <= 1 ULP, for positive, normal x < 2^1022
+ *                        and finite p (same handling of
+ *                        underflow/overflow as simint_exp_vec).
+ *                        Zero, negative, and non-finite x are not
+ *                        supported.
+ *
+ * NaN arguments are not propagated.
+ */
+
+#include "simint/vectorization/vector_config.h"
+
+#if !defined SIMINT_SCALAR && !defined __INTEL_COMPILER
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+
+// Are SIMINT_FMADD/SIMINT_FMSUB fused (ie, a single rounding)?
+#if defined SIMINT_AVX2 || defined SIMINT_AVX512 || defined SIMINT_MICAVX512 || defined SIMINT_FMA
+    #define SIMINT_VECMATH_FMA
+#endif
+
+
+// Adding and subtracting this rounds to the nearest integer
+#define SIMINT_VECMATH_ROUND 6755399441055744.0 // 1.5 * 2^52
+
+// ln(2) split into two parts. ln2_hi has only 32 significant bits,
+// so k*ln2_hi is exact for any exponent k
+#define SIMINT_VECMATH_LN2_HI 6.93147180369123816490e-01
+#define SIMINT_VECMATH_LN2_LO 1.90821492927058770002e-10
+
+
+/*! \brief Computes a + b = hi + lo exactly
+ *
+ * \param [in] a, b Values to add
+ * \param [out] lo The rounding error of a + b
+ * \return a + b, rounded
+ */
+static inline
+SIMINT_DBLTYPE simint_vecmath_two_sum(SIMINT_DBLTYPE a, SIMINT_DBLTYPE b,
+                                      SIMINT_DBLTYPE * lo)
+{
+    const SIMINT_DBLTYPE s = SIMINT_ADD(a, b);
+    const SIMINT_DBLTYPE bb = SIMINT_SUB(s, a);
+    *lo = SIMINT_ADD(SIMINT_SUB(a, SIMINT_SUB(s, bb)), SIMINT_SUB(b, bb));
+    return s;
+}
+
+
+/*! \brief Computes a * b = hi + lo exactly
+ *
+ * \param [in] a, b Values to multiply
+ * \param [out] lo The rounding error of a * b
+ * \return a * b, rounded
+ */
+static inline
+SIMINT_DBLTYPE simint_vecmath_two_prod(SIMINT_DBLTYPE a, SIMINT_DBLTYPE b,
+                                       SIMINT_DBLTYPE * lo)
+{
+    const SIMINT_DBLTYPE p = SIMINT_MUL(a, b);
+
+    #ifdef SIMINT_VECMATH_FMA
+    *lo = SIMINT_FMSUB(a, b, p);
+    #else
+    // Dekker's algorithm. Split a and b into 26-bit halves
+    const SIMINT_DBLTYPE split = SIMINT_DBLSET1(134217729.0); // 2^27 + 1
+    const SIMINT_DBLTYPE ta = SIMINT_MUL(split, a);
+    const SIMINT_DBLTYPE tb = SIMINT_MUL(split, b);
+    const SIMINT_DBLTYPE ah = SIMINT_SUB(ta, SIMINT_SUB(ta, a));
+    const SIMINT_DBLTYPE bh = SIMINT_SUB(tb, SIMINT_SUB(tb, b));
+    const SIMINT_DBLTYPE al = SIMINT_SUB(a, ah);
+    const SIMINT_DBLTYPE bl = SIMINT_SUB(b, bh);
+
+    SIMINT_DBLTYPE err = SIMINT_SUB(SIMINT_MUL(ah, bh), p);
+    err = SIMINT_ADD(err, SIMINT_MUL(ah, bl));
+    err = SIMINT_ADD(err, SIMINT_MUL(al, bh));
+    *lo = SIMINT_ADD(err, SIMINT_MUL(al, bl));
+    #endif
+
+    return p;
+}
+
+
+/*! \brief Computes exp(hi + lo)
+ *
+ * \param [in] hi, lo The argument. lo must be small compared to hi
+ *                    (ie, no larger than the rounding error of hi)
+ */
+static inline
+SIMINT_DBLTYPE simint_vecmath_exp_dd(SIMINT_DBLTYPE hi, SIMINT_DBLTYPE lo)
+{
+    const SIMINT_DBLTYPE round = SIMINT_DBLSET1(SIMINT_VECMATH_ROUND);
+
+    // Outside of this range, the result is zero or infinity anyway
+    hi = SIMINT_MAX(SIMINT_MIN(hi, SIMINT_DBLSET1(710.0)), SIMINT_DBLSET1(-746.0));
+
+    // hi + lo = k*ln(2) + r, with |r| <= ln(2)/2
+    const SIMINT_DBLTYPE k = SIMINT_SUB(SIMINT_FMADD(hi, SIMINT_DBLSET1(1.4426950408889634), round), round);
+    SIMINT_DBLTYPE r = SIMINT_SUB(hi, SIMINT_MUL(k, SIMINT_DBLSET1(SIMINT_VECMATH_LN2_HI)));
+    r = SIMINT_SUB(r, SIMINT_MUL(k, SIMINT_DBLSET1(SIMINT_VECMATH_LN2_LO)));
+    r = SIMINT_ADD(r, lo);
+
+    // exp(r) = 1 + r + r^2/2! + ... + r^13/13!
+    // The truncation error is below 2^-60 for |r| <= ln(2)/2
+    static const double c[12] = { 1.0/6227020800.0, 1.0/479001600.0,
+                                  1.0/39916800.0,   1.0/3628800.0,
+                                  1.0/362880.0,     1.0/40320.0,
+                                  1.0/5040.0,       1.0/720.0,
+                                  1.0/120.0,        1.0/24.0,
+                                  1.0/6.0,          1.0/2.0 };
+
+    SIMINT_DBLTYPE poly = SIMINT_DBLSET1(c[0]);
+    for(int i = 1; i < 12; i++)
+        poly = SIMINT_FMADD(poly, r, SIMINT_DBLSET1(c[i]));
+
+    poly = SIMINT_FMADD(SIMINT_MUL(r, r), poly, r);
+    poly = SIMINT_ADD(poly, SIMINT_DBLSET1(1.0));
+
+    // Multiply by 2^k. This is done in two steps, so that
+    // results can be subnormal (or overflow to infinity)
+    const SIMINT_DBLTYPE k1 = SIMINT_SUB(SIMINT_FMADD(k, SIMINT_DBLSET1(0.5), round), round);
+    const SIMINT_DBLTYPE k2 = SIMINT_SUB(k, k1);
+    return SIMINT_MUL(SIMINT_MUL(poly, SIMINT_POW2I(k1)), SIMINT_POW2I(k2));
+}
+
+
+/*! \brief Computes log(x) = hi + lo
+ *
+ * The result is accurate to about 2^-70 (relative).
+ *
+ * \param [in] x A positive, normal value less than 2^1022
+ * \param [out] lo Low part of the result
+ * \return High part of the result
+ */
+static inline
+SIMINT_DBLTYPE simint_vecmath_log_dd(SIMINT_DBLTYPE x, SIMINT_DBLTYPE * lo)
+{
+    const SIMINT_DBLTYPE one = SIMINT_DBLSET1(1.0);
+
+    // x = 2^e * m, with 0.75 <= m < 1.5
+    const SIMINT_DBLTYPE e = SIMINT_LOGB(SIMINT_MUL(x, SIMINT_DBLSET1(4.0/3.0)));
+    const SIMINT_DBLTYPE m = SIMINT_MUL(x, SIMINT_POW2I(SIMINT_NEG(e)));
+
+    // log(m) = 2*atanh(f) = 2f + 2f^3/3 + 2f^5/5 + ...
+    // with f = (m-1)/(m+1), calculated as fh + fl
+    const SIMINT_DBLTYPE num = SIMINT_SUB(m, one); // exact
+    SIMINT_DBLTYPE den_lo, prod_lo;
+    const SIMINT_DBLTYPE den = simint_vecmath_two_sum(m, one, &den_lo);
+    const SIMINT_DBLTYPE fh = SIMINT_DIV(num, den);
+    const SIMINT_DBLTYPE prod = simint_vecmath_two_prod(fh, den, &prod_lo);
+
+    SIMINT_DBLTYPE rem = SIMINT_SUB(SIMINT_SUB(num, prod), prod_lo);
+    rem = SIMINT_SUB(rem, SIMINT_MUL(fh, den_lo));
+    const SIMINT_DBLTYPE fl = SIMINT_DIV(rem, den);
+
+    // f^2 and f^3, in extra precision
+    SIMINT_DBLTYPE f2_lo, f3_lo;
+    const SIMINT_DBLTYPE f2 = simint_vecmath_two_prod(fh, fh, &f2_lo);
+    f2_lo = SIMINT_FMADD(SIMINT_MUL(SIMINT_DBLSET1(2.0), fh), fl, f2_lo);
+    const SIMINT_DBLTYPE f3 = simint_vecmath_two_prod(f2, fh, &f3_lo);
+    f3_lo = SIMINT_FMADD(f2, fl, SIMINT_FMADD(f2_lo, fh, f3_lo));
+
+    // log(m) = 2f + f^3 * (2/3 + f^2 * poly)
+    // |f| <= 0.2, so the terms through f^27 are enough
+    static const double c[12] = { 2.0/27.0, 2.0/25.0, 2.0/23.0, 2.0/21.0,
+                                  2.0/19.0, 2.0/17.0, 2.0/15.0, 2.0/13.0,
+                                  2.0/11.0, 2.0/9.0,  2.0/7.0,  2.0/5.0 };
+
+    SIMINT_DBLTYPE poly = SIMINT_DBLSET1(c[0]);
+    for(int i = 1; i < 12; i++)
+        poly = SIMINT_FMADD(poly, f2, SIMINT_DBLSET1(c[i]));
+
+    // 2/3 = 0.6666666666666666 + 3.700743415417188e-17
+    SIMINT_DBLTYPE t_lo;
+    const SIMINT_DBLTYPE t = simint_vecmath_two_sum(SIMINT_DBLSET1(0.6666666666666666),
+                                                    SIMINT_MUL(f2, poly), &t_lo);
+    t_lo = SIMINT_ADD(t_lo, SIMINT_DBLSET1(3.700743415417188e-17));
+
+    SIMINT_DBLTYPE tail_lo;
+    const SIMINT_DBLTYPE tail = simint_vecmath_two_prod(f3, t, &tail_lo);
+    tail_lo = SIMINT_FMADD(f3, t_lo, SIMINT_FMADD(f3_lo, t, tail_lo));
+
+    // e*ln2_hi + 2*fh + tail, plus all the small parts
+    SIMINT_DBLTYPE s_lo, s_lo2;
+    SIMINT_DBLTYPE s = simint_vecmath_two_sum(SIMINT_MUL(e, SIMINT_DBLSET1(SIMINT_VECMATH_LN2_HI)),
+                                              SIMINT_MUL(SIMINT_DBLSET1(2.0), fh), &s_lo);
+    s = simint_vecmath_two_sum(s, tail, &s_lo2);
+
+    s_lo = SIMINT_ADD(s_lo, s_lo2);
+    s_lo = SIMINT_ADD(s_lo, tail_lo);
+    s_lo = SIMINT_FMADD(SIMINT_DBLSET1(2.0), fl, s_lo);
+    s_lo = SIMINT_FMADD(e, SIMINT_DBLSET1(SIMINT_VECMATH_LN2_LO), s_lo);
+
+    const SIMINT_DBLTYPE hi = SIMINT_ADD(s, s_lo);
+    *lo = SIMINT_SUB(s_lo, SIMINT_SUB(hi, s));
+    return hi;
+}
+
+
+/*! \brief Vectorized exp(x)
+ *
+ * See the top of this file for the accuracy
+ */
+static inline
+SIMINT_DBLTYPE simint_exp_vec(SIMINT_DBLTYPE x)
+{
+    return simint_vecmath_exp_dd(x, SIMINT_DBLSET1(0.0));
+}
+
+
+/*! \brief Vectorized pow(x, p) for positive x
+ *
+ * Computed as exp(p*log(x)), with the logarithm and product
+ * carried in extra precision.
+ *
+ * See the top of this file for the accuracy and allowed range of x
+ */
+static inline
+SIMINT_DBLTYPE simint_pow_vec(SIMINT_DBLTYPE x, SIMINT_DBLTYPE p)
+{
+    SIMINT_DBLTYPE log_lo, y_lo;
+    const SIMINT_DBLTYPE log_hi = simint_vecmath_log_dd(x, &log_lo);
+    const SIMINT_DBLTYPE y_hi = simint_vecmath_two_prod(p, log_hi, &y_lo);
+    return simint_vecmath_exp_dd(y_hi, SIMINT_FMADD(p, log_lo, y_lo));
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined SIMINT_SCALAR && !defined __INTEL_COMPILER
@@ -17,6 +17,9 @@
   #error Vector type is not set
 #endif
 
+// Vectorized exp and pow (if not provided by the compiler)
+#include "simint/vectorization/vecmath.h"
+
 #define SIMINT_SIMD_ALIGN_DBL (SIMINT_SIMD_LEN*8)
 #define SIMINT_SIMD_ALIGN_INT (SIMINT_SIMD_LEN*sizeof(int))
 
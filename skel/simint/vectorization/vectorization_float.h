@@ -0,0 +1,135 @@
+#pragma once
+
+// Single-precision vectors, used for the primitive integrals
+// in the float (ostei_flt_*) kernels.
+//
+// A float vector holds SIMINT_FLT_SIMD_LEN elements, which is twice
+// SIMINT_SIMD_LEN (except for scalar). Shell pair data is still stored
+// in double precision, and is converted when loaded. Contracted
+// integrals are accumulated in double precision.
+
+#include "simint/vectorization/vectorization.h"
+
+#if defined SIMINT_AVX512 || defined SIMINT_MICAVX512
+  #include "simint/vectorization/intrinsics_float_avx512.h"
+#elif defined SIMINT_AVX || defined SIMINT_AVX2
+  #include "simint/vectorization/intrinsics_float_avx.h"
+#elif defined SIMINT_SSE
+  #include "simint/vectorization/intrinsics_float_sse.h"
+#elif defined SIMINT_SCALAR
+  #include "simint/vectorization/intrinsics_float_scalar.h"
+#else
+  #error Vector type is not set
+#endif
+
+#ifdef __cplusplus
+#include "simint/cpp_restrict.hpp"
+extern "C" {
+#endif
+
+
+union simint_float_vec
+{
+    SIMINT_FLTTYPE v;
+    float f[SIMINT_FLT_SIMD_LEN];
+};
+
+
+/*! \brief Loads doubles into a float vector
+ *
+ * \p memaddr must be aligned to a double vector. The second
+ * half of the float vector is only read if it has any valid
+ * lanes, so this never reads past the (padded) end of the
+ * shell pair arrays.
+ *
+ * \param [in] memaddr Where to load from
+ * \param [in] nlane Number of valid lanes
+ */
+static inline
+SIMINT_FLTTYPE simint_fltload(double const * memaddr, int nlane)
+{
+    const SIMINT_DBLTYPE lo = SIMINT_DBLLOAD(memaddr, 0);
+    #if SIMINT_FLT_SIMD_LEN > SIMINT_SIMD_LEN
+    const SIMINT_DBLTYPE hi = (nlane > SIMINT_SIMD_LEN) ? SIMINT_DBLLOAD(memaddr, SIMINT_SIMD_LEN) : lo;
+    #else
+    const SIMINT_DBLTYPE hi = lo;
+    #endif
+    return SIMINT_FLT_FROM_DBL(lo, hi);
+}
+
+#define SIMINT_FLTLOAD(p,i,nlane)  simint_fltload((p) + (i), (nlane))
+
+
+static inline
+void contract_flt(int ncart,
+                  int const * restrict offsets,
+                  SIMINT_FLTTYPE const * restrict src,
+                  double * restrict dest)
+{
+    for(int n = 0; n < SIMINT_FLT_SIMD_LEN; ++n)
+    {
+        float const * restrict src_tmp = (float *)src + n;
+        double * restrict dest_tmp = dest + offsets[n]*ncart;
+
+        for(int np = 0; np < ncart; ++np)
+        {
+            dest_tmp[np] += *src_tmp;
+            src_tmp += SIMINT_FLT_SIMD_LEN;
+        }
+    }
+}
+
+
+static inline
+void contract_all_flt(int ncart,
+                      SIMINT_FLTTYPE const * restrict src,
+                      double * restrict dest)
+{
+    for(int np = 0; np < ncart; ++np)
+    {
+        union simint_float_vec u = { src[np] };
+        double sum = 0.0;
+        for(int n = 0; n < SIMINT_FLT_SIMD_LEN; ++n)
+            sum += u.f[n];
+        dest[np] += sum;
+    }
+}
+
+
+static inline
+double vector_max_flt(SIMINT_FLTTYPE v)
+{
+    union simint_float_vec m = { v };
+    float max = m.f[0];
+    for(int n = 1; n < SIMINT_FLT_SIMD_LEN; n++)
+        max = (m.f[n] > max ? m.f[n] : max);
+    return max;
+}
+
+
+static inline
+SIMINT_FLTTYPE mask_load_flt(int nlane, double * memaddr)
+{
+    union simint_float_vec u = { simint_fltload(memaddr, nlane) };
+    for(int n = nlane; n < SIMINT_FLT_SIMD_LEN; n++)
+        u.f[n] = 0.0f;
+    return u.v;
+}
+
+
+#ifdef SIMINT_PRIM_SCREEN_STAT
+static inline
+int count_prim_screen_survival_flt(SIMINT_FLTTYPE screen_val, const double screen_tol)
+{
+    union simint_float_vec u = { screen_val };
+    int res = 0;
+    for (int i = 0; i < SIMINT_FLT_SIMD_LEN; i++)
+        if (u.f[i] >= screen_tol) res++;
+    return res;
+}
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
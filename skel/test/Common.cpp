@@ -4,6 +4,8 @@
 #include <fstream>
 #include <cmath>
 #include <array>
+#include <algorithm>
+#include <chrono>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -236,6 +238,47 @@ std::pair<double, double> CalcError(double const * const restrict calc, double c
 
     
 
+std::pair<double, double> CalcMaxError(double const * const restrict calc,
+                                       double const * const restrict ref,
+                                       size_t ncalc)
+{
+    double maxerr = 0;
+    double maxref = 0;
+
+    for(size_t i = 0; i < ncalc; i++)
+    {
+        maxref = std::max(maxref, fabs(ref[i]));
+        maxerr = std::max(maxerr, fabs(calc[i] - ref[i]));
+    }
+
+    const double maxrelerr = (maxref > 0.0 ? maxerr / maxref : maxerr);
+    return std::pair<double, double>(maxerr, maxrelerr);
+}
+
+
+int TestResult(bool failed, double maxrelerr, const char * relto)
+{
+    if(!failed)
+        return 0;
+
+    printf("*** FAILED: Errors larger than %.1e relative to %s\n", maxrelerr, relto);
+    return 1;
+}
+
+
+double BestTime(int nrep, const std::function<void(void)> & f)
+{
+    double best = 1e300;
+    for(int r = 0; r < nrep; r++)
+    {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        f();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
 
 void PrintTimingHeader(void)
 {
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <atomic>
 #include <utility>
+#include <functional>
 
 #include "test/Timer.h" 
 #include "simint/shell/shell.h"
@@ -157,6 +158,35 @@ std::pair<double, double> CalcError(double const * const restrict calc,
                                     double const * const restrict ref,
                                     int ncalc);
 
+/*! \brief Calculate the error relative to the largest reference value
+ *
+ * Unlike CalcError, the relative error is the maximum absolute error
+ * divided by the largest absolute value in \p ref, so that tiny reference
+ * values don't dominate.
+ *
+ * \param [in] calc Calculated values
+ * \param [in] ref Reference values
+ * \param [in] ncalc Number of values in \p calc and \p ref
+ * \return A pair representing the maximum absolute and relative error found
+ */
+std::pair<double, double> CalcMaxError(double const * const restrict calc,
+                                       double const * const restrict ref,
+                                       size_t ncalc);
+
+
+/*! \brief Print the result of a test that compares errors to a tolerance
+ *
+ * \param [in] failed Whether any error was larger than \p maxrelerr
+ * \param [in] maxrelerr The maximum allowed relative error
+ * \param [in] relto What the errors are relative to (for the message)
+ * \return The exit code for the test (nonzero if it failed)
+ */
+int TestResult(bool failed, double maxrelerr, const char * relto);
+
+
+/*! \brief Time of the fastest of \p nrep calls to \p f, in seconds */
+double BestTime(int nrep, const std::function<void(void)> & f);
+
 
 /*! \brief Print the header for timings */
 void PrintTimingHeader(void);
@@ -0,0 +1,148 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+#include "simint/simint.h"
+#include "simint/boys/boys.h"
+
+using namespace std::chrono;
+
+
+// Benchmarks the Boys function when only some of the lanes of
+// a vector are beyond BOYS_SHORTGRID_MAXX (long-range formula) and the
+// rest use the Taylor expansion.
+//
+// For each number of long-range lanes, boys_F_split is compared with
+// evaluating each lane separately (the path used with
+// SIMINT_BOYS_NOVECTOR, and by boys_F_split for mixed vectors unless
+// simint was configured with SIMINT_BOYS_MIXED).
+
+
+// Same as boys_F_split, but always lane-by-lane
+static void boys_F_split_lanes(SIMINT_DBLTYPE * restrict F, SIMINT_DBLTYPE x, int n)
+{
+    double * restrict Fd = (double *)F;
+    double const * restrict xd = (double *)(&x);
+
+    if(n < 4)
+    {
+        for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+        {
+            if(xd[i] < BOYS_SHORTGRID_MAXX)
+                boys_F_taylor(Fd + i, xd[i], n);
+            else
+                boys_F_long(Fd + i, xd[i], n);
+        }
+        return;
+    }
+
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+    {
+        if(xd[i] < BOYS_SHORTGRID_MAXX)
+            Fd[n*SIMINT_SIMD_LEN+i] = boys_F_taylor_single(xd[i], n);
+        else
+            Fd[n*SIMINT_SIMD_LEN+i] = boys_F_long_single(xd[i], n);
+    }
+
+    const SIMINT_DBLTYPE x2 = SIMINT_MUL(SIMINT_DBLSET1(2.0), (x));
+    const SIMINT_DBLTYPE ex = SIMINT_EXP(SIMINT_NEG(x));
+
+    for(int n2 = n-1; n2 >= 0; n2--)
+    {
+        const SIMINT_DBLTYPE den = SIMINT_DBLSET1(1.0 / (2.0 * n2 + 1));
+        F[n2] = SIMINT_MUL(den, ( SIMINT_FMADD(x2, F[(n2+1)], ex)));
+    }
+}
+
+
+typedef void (*boys_func)(SIMINT_DBLTYPE * restrict, SIMINT_DBLTYPE, int);
+
+// Runs func over all the x values and returns the time (in seconds).
+// Results are stored in F.
+static double run(boys_func func, int n, int nvec,
+                  double const * x, double * F)
+{
+    auto t0 = high_resolution_clock::now();
+
+    for(int v = 0; v < nvec; v++)
+    {
+        SIMINT_DBLTYPE * Fv = (SIMINT_DBLTYPE *)(F + v*(n+1)*SIMINT_SIMD_LEN);
+        func(Fv, SIMINT_DBLLOAD(x, v*SIMINT_SIMD_LEN), n);
+    }
+
+    auto t1 = high_resolution_clock::now();
+    return duration_cast<duration<double>>(t1 - t0).count();
+}
+
+
+int main(int argc, char ** argv)
+{
+    std::vector<int> nvals = { 0, 2, 8, 16, BOYS_SHORTGRID_MAXN-7 };
+    if(argc > 1)
+    {
+        nvals.clear();
+        for(int i = 1; i < argc; i++)
+            nvals.push_back(atoi(argv[i]));
+    }
+
+    const int nvec = 16384;
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> short_dist(0.0, BOYS_SHORTGRID_MAXX);
+    std::uniform_real_distribution<double> long_dist(BOYS_SHORTGRID_MAXX, 4*BOYS_SHORTGRID_MAXX);
+
+    double * x = (double *)SIMINT_ALLOC(nvec * SIMINT_SIMD_LEN * sizeof(double));
+
+    printf("Vector length: %d\n", SIMINT_SIMD_LEN);
+    printf("Throughput is in millions of x values (each giving F_0 through F_n) per second\n\n");
+    printf("%4s  %10s  %14s  %14s  %10s  %12s\n",
+           "n", "Mix", "Vector", "Lanes", "Speedup", "Max diff");
+
+    for(int n : nvals)
+    {
+        const size_t nF = (size_t)nvec * (n+1) * SIMINT_SIMD_LEN;
+        double * F_vec = (double *)SIMINT_ALLOC(nF * sizeof(double));
+        double * F_lanes = (double *)SIMINT_ALLOC(nF * sizeof(double));
+
+        // nlong lanes of each vector use the long-range formula
+        for(int nlong = 0; nlong <= SIMINT_SIMD_LEN; nlong++)
+        {
+            for(int v = 0; v < nvec; v++)
+            {
+                double * xv = x + v*SIMINT_SIMD_LEN;
+                for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+                    xv[i] = (i < nlong) ? long_dist(gen) : short_dist(gen);
+                std::shuffle(xv, xv + SIMINT_SIMD_LEN, gen);
+            }
+
+            // alternate between the two, and take the fastest of each
+            double t_vec = 1e300;
+            double t_lanes = 1e300;
+            for(int r = 0; r < 20; r++)
+            {
+                t_vec = std::min(t_vec, run(boys_F_split, n, nvec, x, F_vec));
+                t_lanes = std::min(t_lanes, run(boys_F_split_lanes, n, nvec, x, F_lanes));
+            }
+
+            double maxdiff = 0.0;
+            for(size_t i = 0; i < nF; i++)
+                maxdiff = std::max(maxdiff, std::fabs(F_vec[i] - F_lanes[i]));
+
+            const double nx = (double)nvec * SIMINT_SIMD_LEN;
+            printf("%4d  %4d/%-5d  %14.2f  %14.2f  %10.2f  %12.3e\n",
+                   n, nlong, SIMINT_SIMD_LEN,
+                   1e-6 * nx / t_vec, 1e-6 * nx / t_lanes,
+                   t_lanes / t_vec, maxdiff);
+        }
+
+        printf("\n");
+        SIMINT_FREE(F_vec);
+        SIMINT_FREE(F_lanes);
+    }
+
+    SIMINT_FREE(x);
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include <cstdio>
+#include <cstdlib>
+#include <algorithm>
 
 #include "simint/simint.h"
 #include "test/Common.hpp"
@@ -18,14 +20,110 @@ using namespace std::chrono;
 #define SIMINT_SCREEN 0
 #define SIMINT_SCREEN_TOL 0.0
 
+// Number of runs for the variant timings (the fastest is taken)
+#define VARIANT_NREP 5
+
+
+// Compares the time of simint_compute_eri over whole multi shell pairs
+// with the float kernels, and with the 3- and 2-center kernels (for
+// quartets with s shells in the second and fourth positions)
+static void BenchmarkVariants(ShellMap & shellmap, int maxam,
+                              const std::vector<std::array<int, 4>> & qam_to_test)
+{
+    simint_shell zero;
+    simint_initialize_shell(&zero);
+    simint_create_zero_shell(&zero);
+
+    // Screening information is needed for choosing the float kernels
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    std::vector<simint_multi_shellpair> aux(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    {
+        for(int j = 0; j <= maxam; j++)
+        {
+            simint_multi_shellpair P;
+            simint_initialize_multi_shellpair(&P);
+            simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                          shellmap[j].size(), shellmap[j].data(),
+                                          &P, SIMINT_SCREEN_SCHWARZ);
+            pairs[i].push_back(P);
+        }
+
+        simint_initialize_multi_shellpair(&aux[i]);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      1, &zero, &aux[i], SIMINT_SCREEN_SCHWARZ);
+    }
+
+    printf("%13s %14s %14s %8s %14s %8s\n", "Quartet", "Double (us)",
+           "Float (us)", "Speedup", "3c/2c (us)", "Speedup");
+
+    for(const auto & qam : qam_to_test)
+    {
+        const int i = qam[0], j = qam[1], k = qam[2], l = qam[3];
+
+        simint_multi_shellpair const * P = &pairs[i][j];
+        simint_multi_shellpair const * Q = &pairs[k][l];
+
+        // kernels may write some statistics past the end of the integrals
+        const size_t nint = (size_t)P->nshell12 * Q->nshell12 *
+                            NCART(i) * NCART(j) * NCART(k) * NCART(l);
+        std::vector<double> res(nint + 4);
+
+        simint_eri_set_float_tol(0.0);
+        const double t_dbl = BestTime(VARIANT_NREP, [&]{ simint_compute_eri(P, Q, 0.0, NULL, res.data()); });
+
+        double t_flt = 0.0;
+        if(SIMINT_OSTEI_FLOAT)
+        {
+            simint_eri_set_float_tol(1e300);
+            t_flt = BestTime(VARIANT_NREP, [&]{ simint_compute_eri(P, Q, 0.0, NULL, res.data()); });
+            simint_eri_set_float_tol(0.0);
+        }
+
+        // same quartet, with zero shells in place of the s shells
+        double t_4c = 0.0, t_df = 0.0;
+        if(SIMINT_OSTEI_DF && j == 0)
+        {
+            simint_multi_shellpair const * Pz = &aux[i];
+            simint_multi_shellpair const * Qz = (l == 0) ? &aux[k] : Q;
+            t_4c = BestTime(VARIANT_NREP, [&]{ simint_compute_eri(Pz, Qz, 0.0, NULL, res.data()); });
+            if(l == 0)
+                t_df = BestTime(VARIANT_NREP, [&]{ simint_compute_eri_2c(Pz, Qz, 0.0, NULL, res.data()); });
+            else
+                t_df = BestTime(VARIANT_NREP, [&]{ simint_compute_eri_3c(Pz, Qz, 0.0, NULL, res.data()); });
+        }
+
+        printf("( %d %d | %d %d ) %14.1f", i, j, k, l, 1e6*t_dbl);
+        if(t_flt > 0.0)
+            printf(" %14.1f %8.2f", 1e6*t_flt, t_dbl/t_flt);
+        else
+            printf(" %14s %8s", "-", "-");
+        if(t_df > 0.0)
+            printf(" %14.1f %8.2f", 1e6*t_df, t_4c/t_df);
+        printf("\n");
+    }
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    for(auto & P : aux)
+        simint_free_multi_shellpair(&P);
+
+    simint_free_shell(&zero);
+}
+
+
 int main(int argc, char ** argv)
 {
     // set up the function pointers
     simint_init();
 
-    if(argc != 2)
+    // An optional second argument gives the maximum AM. If given,
+    // all unique quartets up to that AM are benchmarked
+    if(argc != 2 && argc != 3)
     {
-        printf("Give me 1 argument! I got %d\n", argc-1);
+        printf("Give me 1 or 2 arguments! I got %d\n", argc-1);
         return 1;
     }
 
@@ -78,6 +176,19 @@ int main(int argc, char ** argv)
     TimeContrib time_total;
 
     std::vector<std::array<int, 4>> qam_to_test {{0, 0, 0, 0}, {2,2,2,2}, {3, 1, 3, 0}, {2, 2, 3, 0}};
+
+    if(argc == 3)
+    {
+        const int bench_maxam = std::min(atoi(argv[2]), maxam);
+
+        qam_to_test.clear();
+        for(int i = 0; i <= bench_maxam; i++)
+        for(int j = 0; j <= i; j++)
+        for(int k = 0; k <= bench_maxam; k++)
+        for(int l = 0; l <= k; l++)
+            qam_to_test.push_back({i, j, k, l});
+    }
+
     const size_t n_to_test = qam_to_test.size();
 
     for(size_t q = 0; q < n_to_test; q++)
@@ -243,6 +354,12 @@ int main(int argc, char ** argv)
 
     printf("\n");
 
+    if(SIMINT_OSTEI_FLOAT || SIMINT_OSTEI_DF)
+    {
+        BenchmarkVariants(shellmap, maxam, qam_to_test);
+        printf("\n");
+    }
+
     FreeShellMap(shellmap);
 
     SIMINT_FREE(all_res_ints);
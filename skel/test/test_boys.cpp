@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "simint/simint.h"
+#include "simint/boys/boys.h"
+#include "test/Common.hpp"
+
+
+// Tests the short-range Boys function against a series evaluated in long
+// double. The short-range part uses the Taylor table, or the Chebyshev
+// table if simint was configured with SIMINT_BOYS_CHEBYSHEV.
+//
+// boys_F_split is given vectors with some lanes beyond BOYS_SHORTGRID_MAXX,
+// so the mixed paths are run, but only the lanes below BOYS_SHORTGRID_MAXX
+// are checked. The long-range formula is asymptotic, and near
+// BOYS_SHORTGRID_MAXX its error grows quickly with n.
+
+
+// Maximum allowed error, relative to the reference value
+#define MAX_REL_ERR 1e-14
+
+// Largest n tested (the Taylor table needs F(n+7))
+#define MAX_N (BOYS_SHORTGRID_MAXN-7)
+
+
+// F0(x) through Fn(x), from
+// Fi(x) = exp(-x) * sum_k (2x)^k / ((2i+1)(2i+3)...(2i+2k+1)).
+// All terms are positive, so there is no cancellation
+static void boys_ref(long double x, int n, long double * F)
+{
+    for(int i = 0; i <= n; i++)
+    {
+        long double term = 1.0L / (2*i+1);
+        long double sum = term;
+        for(int k = 1; term > 1e-25L * sum; k++)
+        {
+            term *= 2.0L * x / (2*i + 2*k + 1);
+            sum += term;
+        }
+        F[i] = std::exp(-x) * sum;
+    }
+}
+
+
+int main(void)
+{
+    const int nvec = 1024;
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> short_dist(0.0, BOYS_SHORTGRID_MAXX);
+    std::uniform_real_distribution<double> long_dist(BOYS_SHORTGRID_MAXX, 4*BOYS_SHORTGRID_MAXX);
+    std::uniform_int_distribution<int> long_lane(0, 3);
+
+    double * x = (double *)SIMINT_ALLOC(nvec * SIMINT_SIMD_LEN * sizeof(double));
+    double * F = (double *)SIMINT_ALLOC((MAX_N+1) * SIMINT_SIMD_LEN * sizeof(double));
+    std::vector<long double> ref((size_t)nvec * SIMINT_SIMD_LEN * (MAX_N+1));
+
+    // about a quarter of the lanes are long-range, so
+    // there are vectors of each kind
+    for(int i = 0; i < nvec * SIMINT_SIMD_LEN; i++)
+        x[i] = (long_lane(gen) == 0) ? long_dist(gen) : short_dist(gen);
+
+    // the ends of the table
+    for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+    {
+        x[i] = 0.0;
+        x[SIMINT_SIMD_LEN + i] = std::nextafter(BOYS_SHORTGRID_MAXX, 0.0);
+    }
+
+    for(int i = 0; i < nvec * SIMINT_SIMD_LEN; i++)
+        boys_ref(x[i], MAX_N, ref.data() + (size_t)i*(MAX_N+1));
+
+    printf("%4s  %12s  %12s\n", "n", "MaxErr", "MaxRelErr");
+
+    bool failed = false;
+
+    for(int n = 0; n <= MAX_N; n++)
+    {
+        double maxerr = 0.0;
+        double maxrelerr = 0.0;
+
+        for(int v = 0; v < nvec; v++)
+        {
+            boys_F_split((SIMINT_DBLTYPE *)F, SIMINT_DBLLOAD(x, v*SIMINT_SIMD_LEN), n);
+
+            for(int i = 0; i < SIMINT_SIMD_LEN; i++)
+            {
+                if(x[v*SIMINT_SIMD_LEN + i] >= BOYS_SHORTGRID_MAXX)
+                    continue;
+
+                long double const * Fref = ref.data() + (size_t)(v*SIMINT_SIMD_LEN + i)*(MAX_N+1);
+
+                for(int m = 0; m <= n; m++)
+                {
+                    const double r = (double)Fref[m];
+                    const double err = std::fabs(F[m*SIMINT_SIMD_LEN + i] - r);
+                    maxerr = std::max(maxerr, err);
+                    maxrelerr = std::max(maxrelerr, err / r);
+                }
+            }
+        }
+
+        const bool bad = (maxrelerr > MAX_REL_ERR);
+        failed |= bad;
+
+        printf("%4d  %12.3e  %12.3e  %s\n", n, maxerr, maxrelerr, bad ? "***" : "");
+    }
+
+    SIMINT_FREE(x);
+    SIMINT_FREE(F);
+
+    return TestResult(failed, MAX_REL_ERR, "the reference value");
+}
@@ -0,0 +1,142 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+#include "test/ValeevRef.hpp"
+
+
+#define SIMINT_SCREEN 0
+#define SIMINT_SCREEN_TOL 0.0
+
+
+// Checks the batched interface against computing
+// each (bra|ket) with simint_compute_eri, and those
+// against the reference integrals. The bra and ket both
+// contain all the shell pairs for an AM pair.
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+    ValeevRef_Init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    // One multi shell pair per pair of AM
+    std::vector<simint_multi_shellpair> pairs;
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN);
+        pairs.push_back(P);
+    }
+
+    // All tasks, interleaving AM quartets so the batch has to group them
+    std::vector<simint_multi_shellpair const *> PQ;
+    std::vector<std::array<int, 4>> qam;
+    std::vector<size_t> offsets;
+    size_t total = 0;
+
+    for(size_t p = 0; p < pairs.size(); p++)
+    for(size_t q = 0; q < pairs.size(); q++)
+    {
+        const simint_multi_shellpair & P = pairs[(p + q) % pairs.size()];
+        const simint_multi_shellpair & Q = pairs[q];
+        PQ.push_back(&P);
+        PQ.push_back(&Q);
+        qam.push_back({{P.am1, P.am2, Q.am1, Q.am2}});
+        offsets.push_back(total);
+        total += P.nshell12 * Q.nshell12 *
+                 NCART(P.am1) * NCART(P.am2) * NCART(Q.am1) * NCART(Q.am2);
+    }
+
+    const int ntask = offsets.size();
+
+    // kernels may write some statistics past the end of the integrals
+    std::vector<double> res_batch(total + 4, 0.0);
+    std::vector<double> res_single(total + 4, 0.0);
+    std::vector<double> res_ref(total, 0.0);
+    std::vector<int> ret(ntask);
+
+    // the batch uses the library's workspace pool
+    int nbatch = simint_compute_eri_batch(ntask, PQ.data(), offsets.data(),
+                                          SIMINT_SCREEN_TOL, NULL,
+                                          res_batch.data(), ret.data());
+
+    // Also uses the workspace pool, so that the same kernels are
+    // chosen as in the batch (see use_swapped in ostei.c)
+    int nsingle = 0;
+    for(int t = 0; t < ntask; t++)
+    {
+        int r = simint_compute_eri(PQ[2*t], PQ[2*t+1], SIMINT_SCREEN_TOL,
+                                   NULL, res_single.data() + offsets[t]);
+        if(r != ret[t])
+            printf("Task %d: return value mismatch %d vs %d ***\n", t, ret[t], r);
+        if(r > 0)
+            nsingle += r;
+    }
+
+    double maxerr = 0.0;
+    for(size_t n = 0; n < total; n++)
+        maxerr = std::max(maxerr, std::fabs(res_batch[n] - res_single[n]));
+
+    // compare with the reference
+    std::pair<double, double> referr(0.0, 0.0);
+    for(int t = 0; t < ntask; t++)
+    {
+        const int i = qam[t][0];
+        const int j = qam[t][1];
+        const int k = qam[t][2];
+        const int l = qam[t][3];
+
+        ValeevRef_Integrals(shellmap[i].data(), shellmap[i].size(),
+                            shellmap[j].data(), shellmap[j].size(),
+                            shellmap[k].data(), shellmap[k].size(),
+                            shellmap[l].data(), shellmap[l].size(),
+                            res_ref.data() + offsets[t], 0, false);
+    }
+
+    referr = CalcError(res_single.data(), res_ref.data(), total);
+
+    bool bad = (nbatch != nsingle || maxerr > 0.0 || referr.first > 1e-12);
+
+    printf("\n");
+    printf("Tasks: %d  Shell quartets: %d (batch) %d (single)\n", ntask, nbatch, nsingle);
+    printf("Max difference: %10.3e\n", maxerr);
+    printf("Error vs. reference: %10.3e  (relative %10.3e)  %s\n", referr.first, referr.second, bad ? "***" : "");
+    printf("\n");
+
+    for(auto & P : pairs)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    ValeevRef_Finalize();
+    simint_finalize();
+
+    return bad ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares the 3- and 2-center integrals (simint_compute_eri_3c and
+// simint_compute_eri_2c) with the 4-center integrals over the same shell
+// pairs, which have a zero shell in place of the missing centers. Shell
+// pairs with a real s shell in those places must give the 4-center
+// integrals, too.
+
+
+// Maximum allowed error, relative to the largest integral of all quartets
+#define MAX_REL_ERR 1e-13
+
+
+typedef int (*erifunc)(simint_multi_shellpair const *,
+                       simint_multi_shellpair const *,
+                       double, double *, double *);
+
+
+// Result of one comparison
+struct DFResult
+{
+    const char * name;
+    int am[4];
+    double maxerr;
+};
+
+
+// Compares f with simint_compute_eri for (P|Q), and adds the maximum
+// absolute error to results. maxref is updated with the largest
+// 4-center integral. The quartets that are zero by symmetry are only
+// roundoff, so the errors are judged against the largest integral of
+// all quartets once everything is calculated
+static void compare(erifunc f, const char * name,
+                    simint_multi_shellpair const * P,
+                    simint_multi_shellpair const * Q,
+                    std::vector<DFResult> & results, double & maxref)
+{
+    // kernels may write some statistics past the end of the integrals
+    const size_t nint = (size_t)P->nshell12 * Q->nshell12 *
+                        NCART(P->am1) * NCART(P->am2) * NCART(Q->am1) * NCART(Q->am2);
+    std::vector<double> res_4c(nint + 4, 0.0);
+    std::vector<double> res_df(nint + 4, 0.0);
+
+    simint_compute_eri(P, Q, 0.0, NULL, res_4c.data());
+    f(P, Q, 0.0, NULL, res_df.data());
+
+    std::pair<double, double> err = CalcMaxError(res_df.data(), res_4c.data(), nint);
+
+    for(size_t n = 0; n < nint; n++)
+        maxref = std::max(maxref, std::fabs(res_4c[n]));
+
+    results.push_back({name, {P->am1, P->am2, Q->am1, Q->am2}, err.first});
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    if(!SIMINT_OSTEI_DF)
+        printf("Simint was generated without 3- and 2-center kernels (create.py -df)\n\n");
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info. The same basis is used
+    // for the auxiliary shells
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    simint_shell zero;
+    simint_initialize_shell(&zero);
+    simint_create_zero_shell(&zero);
+
+    // One multi shell pair per pair of AM, and one per AM
+    // with a zero shell in the second position
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    std::vector<simint_multi_shellpair> aux(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    {
+        for(int j = 0; j <= maxam; j++)
+        {
+            simint_multi_shellpair P;
+            simint_initialize_multi_shellpair(&P);
+            simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                          shellmap[j].size(), shellmap[j].data(),
+                                          &P, SIMINT_SCREEN_NONE);
+            pairs[i].push_back(P);
+        }
+
+        simint_initialize_multi_shellpair(&aux[i]);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      1, &zero, &aux[i], SIMINT_SCREEN_NONE);
+    }
+
+    std::vector<DFResult> results;
+    double maxref = 0.0;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+        compare(simint_compute_eri_3c, "3c", &aux[i], &pairs[k][l], results, maxref);
+
+    for(int i = 0; i <= maxam; i++)
+    for(int k = 0; k <= maxam; k++)
+        compare(simint_compute_eri_2c, "2c", &aux[i], &aux[k], results, maxref);
+
+    // real s shells in place of the zero shells
+    for(int i = 0; i <= maxam; i++)
+    for(int k = 0; k <= maxam; k++)
+    {
+        compare(simint_compute_eri_3c, "3c", &pairs[i][0], &pairs[k][0], results, maxref);
+        compare(simint_compute_eri_2c, "2c", &aux[i], &pairs[k][0], results, maxref);
+    }
+
+    printf("%20s  %10s  %10s\n", "Quartet", "MaxErr", "MaxRelErr");
+
+    bool failed = false;
+
+    for(const auto & r : results)
+    {
+        const double relerr = (maxref > 0.0 ? r.maxerr / maxref : r.maxerr);
+        const bool bad = (relerr > MAX_REL_ERR);
+
+        printf("%s ( %2d %2d | %2d %2d )  %10.3e  %10.3e  %s\n",
+               r.name, r.am[0], r.am[1], r.am[2], r.am[3], r.maxerr, relerr, bad ? "***" : "");
+
+        failed |= bad;
+    }
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    for(auto & P : aux)
+        simint_free_multi_shellpair(&P);
+
+    simint_free_shell(&zero);
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest integral of all quartets");
+}
@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares the float (single precision) kernels with the double
+// precision kernels. The float kernels are forced by setting a
+// huge float tolerance. Errors are given relative to the largest
+// integral of the quartet, since that is what the float tolerance
+// is compared against.
+
+
+// Maximum allowed error, relative to the largest integral
+#define MAX_REL_ERR 1e-5
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    if(!SIMINT_OSTEI_FLOAT)
+    {
+        printf("Simint was generated without float kernels (create.py -f)\n");
+        simint_finalize();
+        return 0;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    // One multi shell pair per pair of AM. Screening information
+    // is needed for choosing the float kernels
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_SCHWARZ);
+        pairs[i].push_back(P);
+    }
+
+    printf("%17s  %10s  %10s\n", "Quartet", "MaxErr", "MaxRelErr");
+
+    bool failed = false;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        simint_multi_shellpair const * P = &pairs[i][j];
+        simint_multi_shellpair const * Q = &pairs[k][l];
+
+        // kernels may write some statistics past the end of the integrals
+        const size_t nint = (size_t)P->nshell12 * Q->nshell12 *
+                            NCART(i) * NCART(j) * NCART(k) * NCART(l);
+        std::vector<double> res_dbl(nint + 4, 0.0);
+        std::vector<double> res_flt(nint + 4, 0.0);
+
+        simint_eri_set_float_tol(0.0);
+        simint_compute_eri(P, Q, 0.0, NULL, res_dbl.data());
+
+        simint_eri_set_float_tol(1e300);
+        simint_compute_eri(P, Q, 0.0, NULL, res_flt.data());
+
+        std::pair<double, double> err = CalcMaxError(res_flt.data(), res_dbl.data(), nint);
+        const bool bad = (err.second > MAX_REL_ERR);
+        failed |= bad;
+
+        printf("( %2d %2d | %2d %2d )  %10.3e  %10.3e  %s\n",
+               i, j, k, l, err.first, err.second, bad ? "***" : "");
+    }
+
+    simint_eri_set_float_tol(0.0);
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest integral");
+}
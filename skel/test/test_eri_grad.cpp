@@ -0,0 +1,175 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Checks simint_compute_eri_grad against contracting the derivatives
+// from simint_compute_eri_deriv with the two-particle density. Both
+// ways of giving the density (full, and from density blocks) are checked.
+
+
+// Maximum allowed error, relative to the largest gradient element
+#define MAX_REL_ERR 1e-12
+
+
+// Fills v with some values in [-1, 1]
+static void fill(std::vector<double> & v, int seed)
+{
+    for(size_t n = 0; n < v.size(); n++)
+        v[n] = std::sin(0.37*n + 1.3*seed);
+}
+
+
+// Largest error of G relative to the largest element of G_ref
+static double relerr(std::vector<double> const * G, std::vector<double> const * G_ref)
+{
+    std::vector<double> all, all_ref;
+    for(int c = 0; c < 4; c++)
+    {
+        all.insert(all.end(), G[c].begin(), G[c].end());
+        all_ref.insert(all_ref.end(), G_ref[c].begin(), G_ref[c].end());
+    }
+    return CalcMaxError(all.data(), all_ref.data(), all.size()).second;
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_DERIV1_MAXAM ? SIMINT_OSTEI_DERIV1_MAXAM : maxparams.first);
+
+    // One multi shell pair per pair of AM
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_SCHWARZ);
+        pairs[i].push_back(P);
+    }
+
+    printf("%17s  %10s  %10s\n", "Quartet", "Gamma", "Density");
+
+    bool failed = false;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        simint_multi_shellpair const * P = &pairs[i][j];
+        simint_multi_shellpair const * Q = &pairs[k][l];
+
+        // number of shells and functions in each position
+        const int ns[4] = { (int)shellmap[i].size(), (int)shellmap[j].size(),
+                            (int)shellmap[k].size(), (int)shellmap[l].size() };
+        const int nc[4] = { NCART(i), NCART(j), NCART(k), NCART(l) };
+        const int nf[4] = { ns[0]*nc[0], ns[1]*nc[1], ns[2]*nc[2], ns[3]*nc[3] };
+
+        // density blocks, in the order ab, cd, ac, ad, bc, bd
+        const int blk[6][2] = { {0,1}, {2,3}, {0,2}, {0,3}, {1,2}, {1,3} };
+        std::vector<double> D[6];
+        for(int b = 0; b < 6; b++)
+        {
+            D[b].resize((size_t)nf[blk[b][0]] * nf[blk[b][1]]);
+            fill(D[b], b);
+        }
+
+        const double fac_j = 2.0, fac_k = 0.5;
+
+        // the full two-particle density, from the density blocks
+        std::vector<double> gamma((size_t)nf[0]*nf[1]*nf[2]*nf[3]);
+        for(int a = 0; a < nf[0]; a++)
+        for(int b = 0; b < nf[1]; b++)
+        for(int c = 0; c < nf[2]; c++)
+        for(int d = 0; d < nf[3]; d++)
+            gamma[(((size_t)a*nf[1] + b)*nf[2] + c)*nf[3] + d] =
+                fac_j * D[0][a*nf[1]+b] * D[1][c*nf[3]+d]
+              - fac_k * (D[2][a*nf[2]+c] * D[5][b*nf[3]+d] + D[3][a*nf[3]+d] * D[4][b*nf[2]+c]);
+
+        std::vector<double> G_gamma[4], G_dens[4], G_ref[4];
+        for(int c = 0; c < 4; c++)
+        {
+            G_gamma[c].assign(3*ns[c], 0.0);
+            G_dens[c].assign(3*ns[c], 0.0);
+            G_ref[c].assign(3*ns[c], 0.0);
+        }
+
+        simint_grad_blocks g = { gamma.data(), NULL, NULL, NULL, NULL, NULL, NULL, 0.0, 0.0,
+                                 G_gamma[0].data(), G_gamma[1].data(), G_gamma[2].data(), G_gamma[3].data() };
+        simint_compute_eri_grad(P, ns[1], Q, ns[3], 0.0, NULL, &g);
+
+        simint_grad_blocks gd = { NULL, D[0].data(), D[1].data(), D[2].data(),
+                                  D[3].data(), D[4].data(), D[5].data(), fac_j, fac_k,
+                                  G_dens[0].data(), G_dens[1].data(), G_dens[2].data(), G_dens[3].data() };
+        simint_compute_eri_grad(P, ns[1], Q, ns[3], 0.0, NULL, &gd);
+
+        // reference: all the derivatives, then contract
+        const int ncart1234 = nc[0]*nc[1]*nc[2]*nc[3];
+        std::vector<double> res((size_t)P->nshell12 * Q->nshell12 * ncart1234 * 12 + 4, 0.0);
+        simint_compute_eri_deriv(1, P, Q, 0.0, NULL, res.data());
+
+        size_t idx = 0;
+        for(int ab = 0; ab < P->nshell12; ab++)
+        for(int cd = 0; cd < Q->nshell12; cd++)
+        {
+            const int sh[4] = { ab/ns[1], ab%ns[1], cd/ns[3], cd%ns[3] };
+
+            for(int a = sh[0]*nc[0]; a < (sh[0]+1)*nc[0]; a++)
+            for(int b = sh[1]*nc[1]; b < (sh[1]+1)*nc[1]; b++)
+            for(int c = sh[2]*nc[2]; c < (sh[2]+1)*nc[2]; c++)
+            for(int d = sh[3]*nc[3]; d < (sh[3]+1)*nc[3]; d++)
+            {
+                const double v = gamma[(((size_t)a*nf[1] + b)*nf[2] + c)*nf[3] + d];
+                for(int center = 0; center < 4; center++)
+                for(int x = 0; x < 3; x++)
+                    G_ref[center][3*sh[center] + x] += v * res[idx + 3*center + x];
+                idx += 12;
+            }
+        }
+
+        const double err_gamma = relerr(G_gamma, G_ref);
+        const double err_dens = relerr(G_dens, G_ref);
+        const bool bad = (err_gamma > MAX_REL_ERR || err_dens > MAX_REL_ERR);
+        failed |= bad;
+
+        printf("( %2d %2d | %2d %2d )  %10.3e  %10.3e  %s\n", i, j, k, l,
+               err_gamma, err_dens, bad ? "***" : "");
+    }
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest gradient element");
+}
@@ -0,0 +1,153 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Checks simint_compute_eri_jk against contracting the integrals
+// from simint_compute_eri with the density blocks.
+
+
+// Maximum allowed error, relative to the largest element of each block
+#define MAX_REL_ERR 1e-12
+
+
+// Fills v with some values in [-1, 1]
+static void fill(std::vector<double> & v, int seed)
+{
+    for(size_t n = 0; n < v.size(); n++)
+        v[n] = std::sin(0.37*n + 1.3*seed);
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    // One multi shell pair per pair of AM
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_SCHWARZ);
+        pairs[i].push_back(P);
+    }
+
+    printf("%17s  %10s\n", "Quartet", "MaxRelErr");
+
+    bool failed = false;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        simint_multi_shellpair const * P = &pairs[i][j];
+        simint_multi_shellpair const * Q = &pairs[k][l];
+
+        // number of shells and functions in each position
+        const int ns[4] = { (int)shellmap[i].size(), (int)shellmap[j].size(),
+                            (int)shellmap[k].size(), (int)shellmap[l].size() };
+        const int nc[4] = { NCART(i), NCART(j), NCART(k), NCART(l) };
+        const int nf[4] = { ns[0]*nc[0], ns[1]*nc[1], ns[2]*nc[2], ns[3]*nc[3] };
+
+        // the blocks, in the order ab, cd, ac, ad, bc, bd
+        const int blk[6][2] = { {0,1}, {2,3}, {0,2}, {0,3}, {1,2}, {1,3} };
+        std::vector<double> D[6], F[6], F_ref[6];
+        for(int b = 0; b < 6; b++)
+        {
+            const size_t n = (size_t)nf[blk[b][0]] * nf[blk[b][1]];
+            D[b].resize(n);
+            fill(D[b], b);
+            F[b].assign(n, 0.0);
+            F_ref[b].assign(n, 0.0);
+        }
+
+        simint_jk_blocks jk = { D[0].data(), D[1].data(), D[2].data(),
+                                D[3].data(), D[4].data(), D[5].data(),
+                                F[0].data(), F[1].data(), F[2].data(),
+                                F[3].data(), F[4].data(), F[5].data() };
+        simint_compute_eri_jk(P, ns[1], Q, ns[3], 0.0, NULL, &jk);
+
+        // reference: all the integrals, then contract
+        const int ncart1234 = nc[0]*nc[1]*nc[2]*nc[3];
+        std::vector<double> res((size_t)P->nshell12 * Q->nshell12 * ncart1234 + 4, 0.0);
+        simint_compute_eri(P, Q, 0.0, NULL, res.data());
+
+        size_t idx = 0;
+        for(int ab = 0; ab < P->nshell12; ab++)
+        for(int cd = 0; cd < Q->nshell12; cd++)
+        for(int a = (ab/ns[1])*nc[0]; a < (ab/ns[1]+1)*nc[0]; a++)
+        for(int b = (ab%ns[1])*nc[1]; b < (ab%ns[1]+1)*nc[1]; b++)
+        for(int c = (cd/ns[3])*nc[2]; c < (cd/ns[3]+1)*nc[2]; c++)
+        for(int d = (cd%ns[3])*nc[3]; d < (cd%ns[3]+1)*nc[3]; d++)
+        {
+            const double v = res[idx++];
+            F_ref[0][a*nf[1]+b] += v * D[1][c*nf[3]+d];
+            F_ref[1][c*nf[3]+d] += v * D[0][a*nf[1]+b];
+            F_ref[2][a*nf[2]+c] += v * D[5][b*nf[3]+d];
+            F_ref[3][a*nf[3]+d] += v * D[4][b*nf[2]+c];
+            F_ref[4][b*nf[2]+c] += v * D[3][a*nf[3]+d];
+            F_ref[5][b*nf[3]+d] += v * D[2][a*nf[2]+c];
+        }
+
+        double maxrelerr = 0.0;
+        for(int b = 0; b < 6; b++)
+            maxrelerr = std::max(maxrelerr, CalcMaxError(F[b].data(), F_ref[b].data(), F[b].size()).second);
+
+        // A quartet screened as a whole returns -1 and leaves the blocks alone
+        simint_multi_shellpair P_screened = *P;
+        P_screened.screen_max = 0.0;
+        std::vector<double> F_before[6];
+        for(int b = 0; b < 6; b++)
+            F_before[b] = F[b];
+        const int ret_screened = simint_compute_eri_jk(&P_screened, ns[1], Q, ns[3], 1e-10, NULL, &jk);
+        bool bad_screened = (ret_screened != -1);
+        for(int b = 0; b < 6; b++)
+            bad_screened |= (F_before[b] != F[b]);
+
+        const bool bad = (maxrelerr > MAX_REL_ERR) || bad_screened;
+        failed |= bad;
+
+        printf("( %2d %2d | %2d %2d )  %10.3e  %s%s\n", i, j, k, l, maxrelerr,
+               bad_screened ? "screened quartet computed " : "", bad ? "***" : "");
+    }
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest element");
+}
@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// simint_compute_eri may compute (P|Q) as (Q|P) when the ket has few
+// primitives, and transpose the result. This compares (P|Q) computed with
+// and without the swap (see simint_eri_set_swap), where P is all the shell
+// pairs of two AM (many shell pairs and primitives) and Q is a single shell
+// pair with the fewest primitives, so the swap is taken.
+
+
+// Maximum allowed error, relative to the largest integral
+#define MAX_REL_ERR 1e-13
+
+
+// Index of the shell with the fewest primitives
+static int fewest_prim(std::vector<simint_shell> const & shells)
+{
+    int best = 0;
+    for(size_t i = 1; i < shells.size(); i++)
+        if(shells[i].nprim < shells[best].nprim)
+            best = i;
+    return best;
+}
+
+
+// Compares (P|Q) with and without the swap. Returns true if the error is too large
+static bool compare(simint_multi_shellpair const * P,
+                    simint_multi_shellpair const * Q,
+                    double * work)
+{
+    const int ncart = NCART(P->am1) * NCART(P->am2) * NCART(Q->am1) * NCART(Q->am2);
+    const size_t nint = (size_t)P->nshell12 * Q->nshell12 * ncart;
+
+    // kernels may write some statistics past the end of the integrals
+    std::vector<double> res_swap(nint + 4, 0.0);
+    std::vector<double> res_noswap(nint + 4, 0.0);
+
+    simint_eri_set_swap(1);
+    const int ret_swap = simint_compute_eri(P, Q, 0.0, work, res_swap.data());
+
+    simint_eri_set_swap(0);
+    const int ret_noswap = simint_compute_eri(P, Q, 0.0, work, res_noswap.data());
+
+    simint_eri_set_swap(1);
+
+    std::pair<double, double> err = CalcMaxError(res_swap.data(), res_noswap.data(), nint);
+    const bool bad = (ret_swap != ret_noswap || err.second > MAX_REL_ERR);
+
+    printf("( %2d %2d | %2d %2d )  %5d x %5d  %10.3e  %10.3e  %s\n",
+           P->am1, P->am2, Q->am1, Q->am2, P->nprim, Q->nprim,
+           err.first, err.second, bad ? "***" : "");
+
+    return bad;
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    // All shell pairs of each AM pair, and a single shell pair
+    // of the shells with the fewest primitives
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1), single(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_NONE);
+        pairs[i].push_back(P);
+
+        simint_multi_shellpair Q;
+        simint_initialize_multi_shellpair(&Q);
+        simint_create_multi_shellpair(1, &shellmap[i][fewest_prim(shellmap[i])],
+                                      1, &shellmap[j][fewest_prim(shellmap[j])],
+                                      &Q, SIMINT_SCREEN_NONE);
+        single[i].push_back(Q);
+    }
+
+    // workspace given by the caller, large enough for any quartet
+    double * work = (double *)SIMINT_ALLOC(simint_eri_workmem(0, maxam));
+
+    printf("%20s  %13s  %10s  %10s\n", "Quartet", "nprim", "MaxErr", "MaxRelErr");
+
+    bool failed = false;
+
+    for(double * w : { (double *)NULL, work })
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+        failed |= compare(&pairs[i][j], &single[k][l], w);
+
+    SIMINT_FREE(work);
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    for(auto & it : single)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest integral");
+}
@@ -0,0 +1,126 @@
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <functional>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Compares the overlap and kinetic energy integrals over whole multi
+// shell pairs (simint_compute_overlap_multi, simint_compute_ke_multi)
+// with the integrals for each shell pair (simint_compute_overlap,
+// simint_compute_ke).
+
+
+// Maximum allowed error, relative to the largest integral
+#define MAX_REL_ERR 1e-13
+
+
+typedef std::function<void(simint_shell *, simint_shell *, double *)> singlefunc;
+typedef std::function<void(simint_multi_shellpair const *, double *)> multifunc;
+
+
+// Compares f_multi with f_single for all shell pairs of AM i and j, and
+// prints the results. The multi shell pair is also calculated with
+// nshell12_clip smaller than nshell12. Returns true if the error is too large
+static bool compare(singlefunc f_single, multifunc f_multi, const char * name,
+                    ShellMap & shellmap, int i, int j)
+{
+    const int ncart12 = NCART(i) * NCART(j);
+    const int nshell1 = shellmap[i].size();
+    const int nshell2 = shellmap[j].size();
+    const int nshell12 = nshell1 * nshell2;
+
+    std::vector<double> res_single(nshell12 * ncart12);
+    std::vector<double> res_multi(nshell12 * ncart12);
+    std::vector<double> res_clip(nshell12 * ncart12);
+
+    for(int a = 0; a < nshell1; a++)
+    for(int b = 0; b < nshell2; b++)
+        f_single(&shellmap[i][a], &shellmap[j][b], res_single.data() + (a*nshell2 + b)*ncart12);
+
+    simint_multi_shellpair P;
+    simint_initialize_multi_shellpair(&P);
+    simint_create_multi_shellpair(nshell1, shellmap[i].data(),
+                                  nshell2, shellmap[j].data(),
+                                  &P, SIMINT_SCREEN_NONE);
+
+    f_multi(&P, res_multi.data());
+
+    P.nshell12_clip = (nshell12 + 1) / 2;
+    f_multi(&P, res_clip.data());
+    const size_t nclip = P.nshell12_clip * ncart12;
+
+    simint_free_multi_shellpair(&P);
+
+    std::pair<double, double> err = CalcMaxError(res_multi.data(), res_single.data(), res_single.size());
+    std::pair<double, double> err_clip = CalcMaxError(res_clip.data(), res_single.data(), nclip);
+
+    // the clipped part may hold only (near) zero integrals, so its error
+    // is taken relative to the largest integral of the whole block
+    double maxref = 0.0;
+    for(double v : res_single)
+        maxref = std::max(maxref, std::fabs(v));
+
+    const double relerr_clip = (maxref > 0.0 ? err_clip.first / maxref : err_clip.first);
+
+    const bool bad = (err.second > MAX_REL_ERR || relerr_clip > MAX_REL_ERR);
+
+    printf("%8s ( %2d %2d )  %10.3e  %10.3e  %10.3e  %s\n",
+           name, i, j, err.first, err.second, relerr_clip, bad ? "***" : "");
+
+    return bad;
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    const int maxam = FindMaxParams(shellmap).first;
+
+    auto overlap_single = [](simint_shell * A, simint_shell * B, double * res)
+                          { simint_compute_overlap(A, B, res); };
+    auto overlap_multi = [](simint_multi_shellpair const * P, double * res)
+                         { simint_compute_overlap_multi(P, res); };
+    auto ke_single = [](simint_shell * A, simint_shell * B, double * res)
+                     { simint_compute_ke(A, B, res); };
+    auto ke_multi = [](simint_multi_shellpair const * P, double * res)
+                    { simint_compute_ke_multi(P, res); };
+
+    printf("%19s  %10s  %10s  %10s\n", "Pair", "MaxErr", "MaxRelErr", "Clipped");
+
+    bool failed = false;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        failed |= compare(overlap_single, overlap_multi, "Overlap", shellmap, i, j);
+        failed |= compare(ke_single, ke_multi, "KE", shellmap, i, j);
+    }
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest integral");
+}
@@ -0,0 +1,160 @@
+#include <cstdio>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+using namespace std::chrono;
+
+
+// Compares the nuclear attraction integrals over whole multi shell
+// pairs (simint_compute_potential_multi) with the integrals for each
+// shell pair (simint_compute_potential). The point charges are the
+// nuclei of the molecule plus a number of random charges around it
+// (as in QM/MM).
+
+
+// Maximum allowed error, relative to the largest integral
+#define MAX_REL_ERR 1e-13
+
+// Number of random point charges
+#define NCHARGE 2000
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    std::pair<ShellMap, Molecule> molinfo = ReadBasis(basfile);
+    ShellMap shellmap = molinfo.first;
+    Molecule mol = molinfo.second;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    const int maxam = FindMaxParams(shellmap).first;
+
+    // Form SOA from molecule AOS, then add random charges
+    // in a box 10 bohr larger than the molecule
+    std::vector<double> Z, x, y, z;
+    for(const auto & atom : mol)
+    {
+        Z.push_back(atom.Z);
+        x.push_back(atom.x);
+        y.push_back(atom.y);
+        z.push_back(atom.z);
+    }
+
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> qdist(-1.0, 1.0);
+    std::uniform_real_distribution<double> xdist(*std::min_element(x.begin(), x.end()) - 10.0,
+                                                 *std::max_element(x.begin(), x.end()) + 10.0);
+    std::uniform_real_distribution<double> ydist(*std::min_element(y.begin(), y.end()) - 10.0,
+                                                 *std::max_element(y.begin(), y.end()) + 10.0);
+    std::uniform_real_distribution<double> zdist(*std::min_element(z.begin(), z.end()) - 10.0,
+                                                 *std::max_element(z.begin(), z.end()) + 10.0);
+
+    for(int n = 0; n < NCHARGE; n++)
+    {
+        Z.push_back(qdist(gen));
+        x.push_back(xdist(gen));
+        y.push_back(ydist(gen));
+        z.push_back(zdist(gen));
+    }
+
+    const int ncenter = static_cast<int>(Z.size());
+
+    printf("%d point charges\n\n", ncenter);
+    printf("%10s  %10s  %10s  %12s  %12s  %8s\n",
+           "Pair", "MaxErr", "MaxRelErr", "Single (us)", "Multi (us)", "Speedup");
+
+    bool failed = false;
+    double total_single = 0.0;
+    double total_multi = 0.0;
+
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        const int ncart12 = NCART(i) * NCART(j);
+        const int nshell1 = shellmap[i].size();
+        const int nshell2 = shellmap[j].size();
+
+        std::vector<double> res_single(nshell1 * nshell2 * ncart12);
+        std::vector<double> res_multi(nshell1 * nshell2 * ncart12);
+
+        auto t0 = high_resolution_clock::now();
+        for(int a = 0; a < nshell1; a++)
+        for(int b = 0; b < nshell2; b++)
+            simint_compute_potential(ncenter, Z.data(), x.data(), y.data(), z.data(),
+                                     &shellmap[i][a], &shellmap[j][b],
+                                     res_single.data() + (a*nshell2 + b)*ncart12);
+        auto t1 = high_resolution_clock::now();
+
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(nshell1, shellmap[i].data(),
+                                      nshell2, shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_NONE);
+
+        auto t2 = high_resolution_clock::now();
+        simint_compute_potential_multi(ncenter, Z.data(), x.data(), y.data(), z.data(),
+                                       &P, res_multi.data());
+        auto t3 = high_resolution_clock::now();
+
+        simint_free_multi_shellpair(&P);
+
+        double maxint = 0.0;
+        double maxerr = 0.0;
+        for(size_t n = 0; n < res_single.size(); n++)
+        {
+            maxint = std::max(maxint, std::fabs(res_single[n]));
+            maxerr = std::max(maxerr, std::fabs(res_multi[n] - res_single[n]));
+        }
+
+        const double relerr = (maxint > 0.0) ? maxerr / maxint : maxerr;
+        const bool bad = (relerr > MAX_REL_ERR);
+        failed |= bad;
+
+        const double t_single = duration_cast<duration<double>>(t1 - t0).count();
+        const double t_multi = duration_cast<duration<double>>(t3 - t2).count();
+        total_single += t_single;
+        total_multi += t_multi;
+
+        printf("( %2d %2d )  %10.3e  %10.3e  %12.1f  %12.1f  %8.2f  %s\n",
+               i, j, maxerr, relerr, 1e6*t_single, 1e6*t_multi,
+               t_single/t_multi, bad ? "***" : "");
+    }
+
+    printf("\n");
+    printf("Total: single %.1f us, multi %.1f us, speedup %.2f\n",
+           1e6*total_single, 1e6*total_multi, total_single/total_multi);
+    printf("\n");
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    if(failed)
+    {
+        printf("*** FAILED: Errors larger than %.1e relative to the largest integral\n", MAX_REL_ERR);
+        return 1;
+    }
+
+    return 0;
+}
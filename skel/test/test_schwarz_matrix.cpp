@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <vector>
+
+#include "simint/simint.h"
+#include "simint/shell/shell_screen.h"
+#include "test/Common.hpp"
+
+
+// Checks simint_schwarz_matrix against screening each shell pair
+// separately. The matrix is built from the (ij) pairs with i >= j,
+// so the values should be exactly the same as for those pairs.
+// Both are timed (fastest of a few runs).
+
+
+// Number of runs for the timings
+#define NREP 5
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // all shells, in the order of the basis
+    std::vector<simint_shell> shells;
+    for(auto & it : shellmap)
+    {
+        if(it.first > SIMINT_OSTEI_MAXAM)
+            continue;
+        shells.insert(shells.end(), it.second.begin(), it.second.end());
+    }
+
+    const int nshell = shells.size();
+    std::vector<double> mat(nshell*nshell, -1.0);
+    std::vector<double> prim_mat(nshell*nshell, -1.0);
+
+    int ret = 0;
+    const double t_mat = BestTime(NREP, [&]{
+        ret |= simint_schwarz_matrix(nshell, shells.data(), mat.data(), prim_mat.data());
+    });
+
+    // reference: one shell pair at a time
+    std::vector<double> ref(nshell*nshell), prim_ref(nshell*nshell);
+    const double t_pairs = BestTime(NREP, [&]{
+        for(int i = 0; i < nshell; i++)
+        for(int j = 0; j <= i; j++)
+        {
+            ref[i*nshell+j] = simint_shellscreen_schwarz(&shells[i], &shells[j]);
+            prim_ref[i*nshell+j] = simint_primscreen_schwarz(&shells[i], &shells[j], NULL);
+        }
+    });
+
+    int nbad = 0;
+    if(ret != 0)
+    {
+        printf("*** simint_schwarz_matrix failed\n");
+        nbad++;
+    }
+
+    for(int i = 0; i < nshell; i++)
+    for(int j = 0; j <= i; j++)
+    {
+        const double ref_ij = ref[i*nshell+j];
+        const double prim_ref_ij = prim_ref[i*nshell+j];
+
+        for(int ij : { i*nshell+j, j*nshell+i })
+        {
+            if(mat[ij] != ref_ij || prim_mat[ij] != prim_ref_ij)
+            {
+                printf("*** Different values for shells %d %d: %.16e %.16e / %.16e %.16e\n",
+                       i, j, mat[ij], ref_ij, prim_mat[ij], prim_ref_ij);
+                nbad++;
+            }
+        }
+    }
+
+    printf("Shells: %d\n", nshell);
+    printf("Matrix: %.1f us\n", 1e6*t_mat);
+    printf("Pairs:  %.1f us\n", 1e6*t_pairs);
+    printf("Speedup: %.2f\n", t_pairs / t_mat);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    if(nbad > 0)
+    {
+        printf("*** FAILED: %d elements differ\n", nbad);
+        return 1;
+    }
+
+    return 0;
+}
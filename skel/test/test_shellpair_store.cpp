@@ -0,0 +1,155 @@
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Writes shell pairs to a file, maps them back, and checks that
+// the mapped shell pairs give exactly the same integrals.
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // file to hold the shell pairs
+    const char * storefile = "test_shellpair_store.dat";
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+    const int nam = maxam+1;
+
+    // One multi shell pair per pair of AM, stored at [i*nam+j]
+    std::vector<simint_multi_shellpair> pairs(nam*nam);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair & P = pairs[i*nam+j];
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_SCHWARZ);
+    }
+
+    if(simint_write_multi_shellpairs(storefile, pairs.size(), pairs.data()) != 0)
+        return 1;
+
+    simint_shellpair_map map;
+    if(simint_map_multi_shellpairs(storefile, &map) != 0)
+        return 1;
+
+    bool failed = (map.n != static_cast<int>(pairs.size()));
+
+    for(int i = 0; i <= maxam && !failed; i++)
+    for(int j = 0; j <= maxam; j++)
+    for(int k = 0; k <= maxam; k++)
+    for(int l = 0; l <= maxam; l++)
+    {
+        simint_multi_shellpair const * P = &pairs[i*nam+j];
+        simint_multi_shellpair const * Q = &pairs[k*nam+l];
+
+        // kernels may write some statistics past the end of the integrals
+        const size_t nint = (size_t)P->nshell12 * Q->nshell12 *
+                            NCART(i) * NCART(j) * NCART(k) * NCART(l);
+        std::vector<double> res(nint + 4, 0.0);
+        std::vector<double> res_map(nint + 4, 0.0);
+
+        int nscreen = simint_compute_eri(P, Q, 1e-14, NULL, res.data());
+        int nscreen_map = simint_compute_eri(&map.P[i*nam+j], &map.P[k*nam+l],
+                                             1e-14, NULL, res_map.data());
+
+        const bool bad = (nscreen != nscreen_map) ||
+                         memcmp(res.data(), res_map.data(), nint * sizeof(double)) != 0;
+        failed |= bad;
+
+        printf("( %2d %2d | %2d %2d )  %s\n", i, j, k, l, bad ? "DIFFERENT ***" : "same");
+    }
+
+    simint_unmap_multi_shellpairs(&map);
+
+    // Truncated or corrupt files must be rejected
+    std::vector<char> contents;
+    if(FILE * fp = std::fopen(storefile, "rb"))
+    {
+        int c;
+        while((c = std::fgetc(fp)) != EOF)
+            contents.push_back(c);
+        std::fclose(fp);
+    }
+
+    // Offsets within the file of the am1 of the first shell pair, and
+    // of the offset of its x member (see the format in shell_store.c)
+    const size_t am1_offset = 32;
+    const size_t x_offset = 32 + 56 + 4*sizeof(int64_t);
+
+    std::vector<char> am1_bad(contents);
+    int32_t am1 = SIMINT_OSTEI_MAXAM + 1;
+    std::memcpy(am1_bad.data() + am1_offset, &am1, sizeof(am1));
+
+    std::vector<char> x_misaligned(contents);
+    int64_t x_member;
+    std::memcpy(&x_member, x_misaligned.data() + x_offset, sizeof(x_member));
+    x_member += sizeof(int);
+    std::memcpy(x_misaligned.data() + x_offset, &x_member, sizeof(x_member));
+
+    const std::vector<std::pair<const char *, std::vector<char>>> bad_files = {
+        { "Truncated", std::vector<char>(contents.begin(), contents.end() - sizeof(double)) },
+        { "Out of range AM", am1_bad },
+        { "Misaligned", x_misaligned }
+    };
+
+    for(const auto & it : bad_files)
+    {
+        if(FILE * fp = std::fopen(storefile, "wb"))
+        {
+            std::fwrite(it.second.data(), 1, it.second.size(), fp);
+            std::fclose(fp);
+        }
+
+        if(simint_map_multi_shellpairs(storefile, &map) == 0)
+        {
+            printf("*** %s file was mapped\n", it.first);
+            simint_unmap_multi_shellpairs(&map);
+            failed = true;
+        }
+    }
+
+    std::remove(storefile);
+
+    for(auto & P : pairs)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    if(failed)
+    {
+        printf("*** FAILED: Mapped shell pairs give different integrals\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef _OPENMP
+  #include <omp.h>
+#endif
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Checks that shell pairs filled (and updated) with one thread and with
+// several threads are identical, byte for byte. The shells of each AM
+// are repeated, so that there are enough shell pairs to be filled
+// in parallel.
+
+
+// Number of threads to compare with one thread
+#define NTHREAD 4
+
+// Minimum number of shell pairs in each multi shell pair
+#define MIN_NPAIR 64
+
+
+// Compares n elements of two arrays. Returns true if they differ
+template<typename T>
+static bool differ(const char * name, T const * a, T const * b, size_t n)
+{
+    if(n == 0 || std::memcmp(a, b, n * sizeof(T)) == 0)
+        return false;
+
+    printf("    %s differs\n", name);
+    return true;
+}
+
+
+// Compares two shell pairs, including the padding of the primitives.
+// Returns true if they differ
+static bool compare(simint_multi_shellpair const & P1,
+                    simint_multi_shellpair const & P2,
+                    bool screen)
+{
+    if(P1.nshell12 != P2.nshell12 || P1.nprim != P2.nprim ||
+       std::memcmp(&P1.screen_max, &P2.screen_max, sizeof(double)) != 0 ||
+       std::memcmp(&P1.prim_screen_max, &P2.prim_screen_max, sizeof(double)) != 0)
+    {
+        printf("    nshell12, nprim, screen_max or prim_screen_max differ\n");
+        return true;
+    }
+
+    // number of primitives, with the padding after each batch
+    size_t np = 0;
+    size_t batch = 0;
+    for(int ab = 0; ab < P1.nshell12; ab++)
+    {
+        batch += P1.nprim12[ab];
+        if(((ab + 1) % SIMINT_NSHELL_SIMD) == 0 || ab + 1 == P1.nshell12)
+        {
+            np += SIMINT_SIMD_ROUND(batch);
+            batch = 0;
+        }
+    }
+
+    const size_t ns = P1.nshell12;
+
+    bool bad = false;
+    bad |= differ("nprim12", P1.nprim12, P2.nprim12, ns);
+    bad |= differ("AB_x", P1.AB_x, P2.AB_x, ns);
+    bad |= differ("AB_y", P1.AB_y, P2.AB_y, ns);
+    bad |= differ("AB_z", P1.AB_z, P2.AB_z, ns);
+    bad |= differ("x", P1.x, P2.x, np);
+    bad |= differ("y", P1.y, P2.y, np);
+    bad |= differ("z", P1.z, P2.z, np);
+    bad |= differ("PA_x", P1.PA_x, P2.PA_x, np);
+    bad |= differ("PA_y", P1.PA_y, P2.PA_y, np);
+    bad |= differ("PA_z", P1.PA_z, P2.PA_z, np);
+    bad |= differ("PB_x", P1.PB_x, P2.PB_x, np);
+    bad |= differ("PB_y", P1.PB_y, P2.PB_y, np);
+    bad |= differ("PB_z", P1.PB_z, P2.PB_z, np);
+    bad |= differ("alpha", P1.alpha, P2.alpha, np);
+    bad |= differ("alpha_a", P1.alpha_a, P2.alpha_a, np);
+    bad |= differ("beta", P1.beta, P2.beta, np);
+    bad |= differ("prefac", P1.prefac, P2.prefac, np);
+    bad |= differ("primij", P1.primij, P2.primij, np);
+
+    #if SIMINT_OSTEI_MAXDER > 0
+    bad |= differ("alpha2", P1.alpha2, P2.alpha2, np);
+    bad |= differ("beta2", P1.beta2, P2.beta2, np);
+    #endif
+
+    if(screen)
+        bad |= differ("screen", P1.screen, P2.screen, np);
+
+    return bad;
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    bool failed = false;
+
+    #ifndef _OPENMP
+    printf("Not compiled with OpenMP - nothing to test\n");
+    #else
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    const int maxam = FindMaxParams(shellmap).first;
+
+    for(int screen_method : { SIMINT_SCREEN_NONE, SIMINT_SCREEN_SCHWARZ })
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        // repeat the shells of the first position. The copies share
+        // the primitives, so they still count as the same shell
+        std::vector<simint_shell> A;
+        while(A.size() * shellmap[j].size() < MIN_NPAIR)
+            A.insert(A.end(), shellmap[i].begin(), shellmap[i].end());
+
+        std::vector<simint_shell> B = shellmap[j];
+
+        simint_multi_shellpair P[2];
+        for(int t = 0; t < 2; t++)
+        {
+            omp_set_num_threads(t == 0 ? 1 : NTHREAD);
+            simint_initialize_multi_shellpair(&P[t]);
+            simint_create_multi_shellpair(A.size(), A.data(), B.size(), B.data(),
+                                          &P[t], screen_method);
+        }
+
+        bool bad = compare(P[0], P[1], screen_method);
+
+        // update both for a different geometry
+        for(auto & sh : A)
+        {
+            sh.x += 0.1;
+            sh.y -= 0.05;
+        }
+
+        for(int t = 0; t < 2; t++)
+        {
+            omp_set_num_threads(t == 0 ? 1 : NTHREAD);
+            simint_update_multi_shellpair_geometry(A.size(), A.data(), B.size(), B.data(),
+                                                   &P[t], screen_method);
+        }
+
+        bad |= compare(P[0], P[1], screen_method);
+
+        printf("( %2d %2d )  screen %d  %5d pairs  %s\n",
+               i, j, screen_method, P[0].nshell12, bad ? "*** DIFFERENT" : "ok");
+        failed |= bad;
+
+        simint_free_multi_shellpair(&P[0]);
+        simint_free_multi_shellpair(&P[1]);
+    }
+
+    FreeShellMap(shellmap);
+
+    #endif
+
+    simint_finalize();
+
+    if(failed)
+    {
+        printf("*** FAILED: Shell pairs differ between 1 and %d threads\n", NTHREAD);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <cstdio>
+#include <cmath>
+#include <vector>
+
+#include "simint/simint.h"
+#include "test/Common.hpp"
+
+
+// Checks simint_update_multi_shellpair_geometry. Shell pairs created
+// for one geometry and then updated for another should give the same
+// integrals as shell pairs created for the new geometry. The primitives
+// may be in a different order, so the results may differ by roundoff.
+
+
+// Maximum allowed error, relative to the largest integral
+#define MAX_REL_ERR 1e-13
+
+
+// Moves all shells. Shells on the same atom stay together.
+static void displace(ShellMap & shellmap, double scale)
+{
+    for(auto & it : shellmap)
+    for(auto & sh : it.second)
+    {
+        const double x = sh.x, y = sh.y, z = sh.z;
+        sh.x += scale * std::sin(3.0*x + y);
+        sh.y += scale * std::sin(3.0*y + z);
+        sh.z += scale * std::sin(3.0*z + x);
+    }
+}
+
+
+int main(int argc, char ** argv)
+{
+    // set up the function pointers
+    simint_init();
+
+    // parse command line
+    if(argc != 2)
+    {
+        printf("Give me 1 argument! I got %d\n", argc-1);
+        return 1;
+    }
+
+    // basis functions file to read
+    std::string basfile(argv[1]);
+
+    // read in the shell info
+    ShellMap shellmap = ReadBasis(basfile).first;
+
+    // normalize the original
+    for(auto & it : shellmap)
+        simint_normalize_shells(it.second.size(), it.second.data());
+
+    // find the max dimensions
+    std::pair<int, int> maxparams = FindMaxParams(shellmap);
+    const int maxam = (maxparams.first > SIMINT_OSTEI_MAXAM ? SIMINT_OSTEI_MAXAM : maxparams.first);
+
+    // Shell pairs for the original geometry. These are updated below
+    std::vector<std::vector<simint_multi_shellpair>> pairs(maxam+1);
+    for(int i = 0; i <= maxam; i++)
+    for(int j = 0; j <= maxam; j++)
+    {
+        simint_multi_shellpair P;
+        simint_initialize_multi_shellpair(&P);
+        simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                      shellmap[j].size(), shellmap[j].data(),
+                                      &P, SIMINT_SCREEN_SCHWARZ);
+        pairs[i].push_back(P);
+    }
+
+    printf("%17s  %10s  %10s\n", "Quartet", "MaxErr", "MaxRelErr");
+
+    bool failed = false;
+
+    for(double scale : { 0.1, -0.02 })
+    {
+        displace(shellmap, scale);
+
+        // updated and newly-created shell pairs
+        std::vector<std::vector<simint_multi_shellpair>> new_pairs(maxam+1);
+        for(int i = 0; i <= maxam; i++)
+        for(int j = 0; j <= maxam; j++)
+        {
+            simint_update_multi_shellpair_geometry(shellmap[i].size(), shellmap[i].data(),
+                                                   shellmap[j].size(), shellmap[j].data(),
+                                                   &pairs[i][j], SIMINT_SCREEN_SCHWARZ);
+
+            simint_multi_shellpair P;
+            simint_initialize_multi_shellpair(&P);
+            simint_create_multi_shellpair(shellmap[i].size(), shellmap[i].data(),
+                                          shellmap[j].size(), shellmap[j].data(),
+                                          &P, SIMINT_SCREEN_SCHWARZ);
+            new_pairs[i].push_back(P);
+
+            if(pairs[i][j].screen_max != P.screen_max)
+            {
+                printf("*** Different screen_max for ( %d %d ): %.16e  %.16e\n",
+                       i, j, pairs[i][j].screen_max, P.screen_max);
+                failed = true;
+            }
+
+            if(pairs[i][j].prim_screen_max != P.prim_screen_max)
+            {
+                printf("*** Different prim_screen_max for ( %d %d ): %.16e  %.16e\n",
+                       i, j, pairs[i][j].prim_screen_max, P.prim_screen_max);
+                failed = true;
+            }
+        }
+
+        for(int i = 0; i <= maxam; i++)
+        for(int j = 0; j <= maxam; j++)
+        for(int k = 0; k <= maxam; k++)
+        for(int l = 0; l <= maxam; l++)
+        {
+            // kernels may write some statistics past the end of the integrals
+            const size_t nint = (size_t)pairs[i][j].nshell12 * pairs[k][l].nshell12 *
+                                NCART(i) * NCART(j) * NCART(k) * NCART(l);
+            std::vector<double> res_update(nint + 4, 0.0);
+            std::vector<double> res_new(nint + 4, 0.0);
+
+            simint_compute_eri(&pairs[i][j], &pairs[k][l], 0.0, NULL, res_update.data());
+            simint_compute_eri(&new_pairs[i][j], &new_pairs[k][l], 0.0, NULL, res_new.data());
+
+            std::pair<double, double> err = CalcMaxError(res_update.data(), res_new.data(), nint);
+            const bool bad = (err.second > MAX_REL_ERR);
+            failed |= bad;
+
+            printf("( %2d %2d | %2d %2d )  %10.3e  %10.3e  %s\n",
+                   i, j, k, l, err.first, err.second, bad ? "***" : "");
+        }
+
+        for(auto & it : new_pairs)
+        for(auto & P : it)
+            simint_free_multi_shellpair(&P);
+    }
+
+    for(auto & it : pairs)
+    for(auto & P : it)
+        simint_free_multi_shellpair(&P);
+
+    FreeShellMap(shellmap);
+    simint_finalize();
+
+    return TestResult(failed, MAX_REL_ERR, "the largest integral");
+}
@@ -0,0 +1,194 @@
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "simint/simint.h"
+#include "simint/vectorization/vectorization.h"
+
+
+// Tests SIMINT_EXP and SIMINT_POW against libm.
+// The errors should be within the bounds given in vecmath.h
+
+
+// Maximum allowed error, in units in the last place
+#define MAX_ULP 1.0
+
+
+// Difference between a and the reference, in units of the last
+// place of the reference
+static double ulp_error(double a, double ref)
+{
+    if(a == ref)
+        return 0.0;
+    if(std::isinf(ref) || std::isnan(ref) || std::isnan(a))
+        return std::numeric_limits<double>::infinity();
+
+    const double aref = std::fabs(ref);
+    const double ulp = std::nextafter(aref, std::numeric_limits<double>::infinity()) - aref;
+    return std::fabs(a - ref) / ulp;
+}
+
+
+// Prints the maximum error and returns true if it is too large
+static bool report(const std::string & desc,
+                   const std::vector<double> & x,
+                   const std::vector<double> & p,
+                   const std::vector<double> & res,
+                   const std::vector<double> & ref)
+{
+    double maxerr = 0.0;
+    double sumerr = 0.0;
+    size_t maxidx = 0;
+
+    for(size_t i = 0; i < res.size(); i++)
+    {
+        const double err = ulp_error(res[i], ref[i]);
+        sumerr += err;
+        if(err > maxerr)
+        {
+            maxerr = err;
+            maxidx = i;
+        }
+    }
+
+    printf("%-44s  %10zu  %10.4f  %10.4f", desc.c_str(), res.size(),
+                                            maxerr, sumerr/res.size());
+    if(maxerr > 0.0)
+    {
+        if(p.size())
+            printf("   (x = %.17g, p = %.17g)", x[maxidx], p[maxidx]);
+        else
+            printf("   (x = %.17g)", x[maxidx]);
+    }
+    printf("\n");
+
+    return maxerr > MAX_ULP;
+}
+
+
+static bool test_exp(const std::string & desc, std::vector<double> x)
+{
+    // pad to a multiple of the vector length
+    const size_t n = x.size();
+    const size_t nround = SIMINT_SIMD_ROUND(n);
+    double * xd = (double *)SIMINT_ALLOC(nround * sizeof(double));
+    std::copy(x.begin(), x.end(), xd);
+    std::fill(xd + n, xd + nround, 0.0);
+
+    std::vector<double> res(n), ref(n);
+
+    for(size_t i = 0; i < n; i += SIMINT_SIMD_LEN)
+    {
+        SIMINT_DBLTYPE v = SIMINT_EXP(SIMINT_DBLLOAD(xd, i));
+        double const * vd = (double *)(&v);
+        for(size_t j = 0; j < SIMINT_SIMD_LEN && (i+j) < n; j++)
+            res[i+j] = vd[j];
+    }
+
+    for(size_t i = 0; i < n; i++)
+        ref[i] = std::exp(x[i]);
+
+    SIMINT_FREE(xd);
+    return report("exp: " + desc, x, std::vector<double>(), res, ref);
+}
+
+
+static bool test_pow(const std::string & desc, std::vector<double> x, std::vector<double> p)
+{
+    const size_t n = x.size();
+    const size_t nround = SIMINT_SIMD_ROUND(n);
+    double * xd = (double *)SIMINT_ALLOC(nround * sizeof(double));
+    double * pd = (double *)SIMINT_ALLOC(nround * sizeof(double));
+    std::copy(x.begin(), x.end(), xd);
+    std::copy(p.begin(), p.end(), pd);
+    std::fill(xd + n, xd + nround, 1.0);
+    std::fill(pd + n, pd + nround, 1.0);
+
+    std::vector<double> res(n), ref(n);
+
+    for(size_t i = 0; i < n; i += SIMINT_SIMD_LEN)
+    {
+        SIMINT_DBLTYPE v = SIMINT_POW(SIMINT_DBLLOAD(xd, i), SIMINT_DBLLOAD(pd, i));
+        double const * vd = (double *)(&v);
+        for(size_t j = 0; j < SIMINT_SIMD_LEN && (i+j) < n; j++)
+            res[i+j] = vd[j];
+    }
+
+    for(size_t i = 0; i < n; i++)
+        ref[i] = std::pow(x[i], p[i]);
+
+    SIMINT_FREE(xd);
+    SIMINT_FREE(pd);
+    return report("pow: " + desc, x, p, res, ref);
+}
+
+
+// n values evenly distributed in [a, b)
+static std::vector<double> uniform(std::mt19937 & gen, size_t n, double a, double b)
+{
+    std::uniform_real_distribution<double> dist(a, b);
+    std::vector<double> v(n);
+    for(auto & it : v)
+        it = dist(gen);
+    return v;
+}
+
+
+// n values distributed evenly in log space in [a, b)
+static std::vector<double> logspace(std::mt19937 & gen, size_t n, double a, double b)
+{
+    std::vector<double> v = uniform(gen, n, std::log(a), std::log(b));
+    for(auto & it : v)
+        it = std::exp(it);
+    return v;
+}
+
+
+int main(int argc, char ** argv)
+{
+    const size_t n = 1000000;
+    std::mt19937 gen(1234);
+    bool failed = false;
+
+    printf("Maximum allowed error: %.2f ULP\n\n", MAX_ULP);
+    printf("%-44s  %10s  %10s  %10s\n", "Function/Range", "N", "Max ULP", "Avg ULP");
+
+    failed |= test_exp("[-1, 1]", uniform(gen, n, -1.0, 1.0));
+    failed |= test_exp("[-50, 0]", uniform(gen, n, -50.0, 0.0));
+    failed |= test_exp("[-708, 709]", uniform(gen, n, -708.0, 709.0));
+    failed |= test_exp("[-745, -708] (subnormal)", uniform(gen, n, -745.0, -708.0));
+    failed |= test_exp("special", { 0.0, -0.0, 1.0, -1.0, 709.78, 710.0, 1000.0,
+                                    -708.39, -745.2, -746.0, -1000.0, -1e300, 1e300 });
+
+    // The Boys function uses x^-(n+1/2) for large x
+    {
+        std::vector<double> x = uniform(gen, n, 30.0, 1000.0);
+        std::vector<double> p(n);
+        std::uniform_int_distribution<int> nd(0, 40);
+        for(auto & it : p)
+            it = -(nd(gen) + 0.5);
+        failed |= test_pow("x in [30, 1000], p = -(n+1/2)", x, p);
+    }
+
+    failed |= test_pow("x in [1e-3, 1e3], p in [-40, 40]",
+                       logspace(gen, n, 1e-3, 1e3), uniform(gen, n, -40.0, 40.0));
+    failed |= test_pow("x in [0.5, 2], p in [-1000, 1000]",
+                       uniform(gen, n, 0.5, 2.0), uniform(gen, n, -1000.0, 1000.0));
+    failed |= test_pow("x in [1e-300, 1e300], p in [-1, 1]",
+                       logspace(gen, n, 1e-300, 1e300), uniform(gen, n, -1.0, 1.0));
+    failed |= test_pow("special", { 1.0, 1.0,  2.0,    2.0,   0.5,  10.0, 1e10 },
+                                  { 0.0, 1e10, 1024.0, -1075, 0.5,  -0.5, 31.0 });
+
+    printf("\n");
+    if(failed)
+    {
+        printf("*** FAILED: Errors larger than %.2f ULP\n", MAX_ULP);
+        return 1;
+    }
+
+    printf("All errors within %.2f ULP\n", MAX_ULP);
+    return 0;
+}
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+
+# Picks the fastest generator options (-ve/-vg/-he/-hg) for each AM quartet
+#
+# For each candidate set of options, the library is created (with create.py),
+# built, and benchmark_eri is run on a basis set. The fastest options for
+# each quartet are written to a table, which can be given to create.py (-t).
+#
+# The same output directory and build directory is used for all the
+# candidates, so only the kernels that change between candidates
+# are regenerated and recompiled.
+
+
+import argparse
+import sys
+import os
+import subprocess
+import itertools
+
+
+# Threshold that is never reached (ie, never use external/general code)
+NEVER = 99
+
+
+def Run(cmdline, logfile):
+  print("    " + ' '.join(cmdline))
+  with open(logfile, 'a') as lf:
+    ret = subprocess.call(cmdline, stdout=lf, stderr=lf)
+
+  if ret != 0:
+    print("\n")
+    print("*********************************")
+    print("Command returned {} - aborting".format(ret))
+    print("See {}".format(logfile))
+    print("*********************************")
+    print("\n")
+    quit(2)
+
+
+def Candidates(thresholds):
+  # All (external, general) pairs with external <= general.
+  # With L < external, code is inline. With external <= L < general,
+  # it is external. Otherwise, it is general
+  t = sorted(set(thresholds))
+  return [ (e, g) for e in t for g in t if e <= g ]
+
+
+def ParseBenchmark(output):
+  # Lines are
+  # ( i j | k l ) NCont NPrim Ticks(Fill) Ticks(Ints) ...
+  timings = {}
+  for line in output.splitlines():
+    s = line.split()
+    if len(s) < 11 or s[0] != "(" or s[3] != "|" or s[6] != ")":
+      continue
+    q = (int(s[1]), int(s[2]), int(s[4]), int(s[5]))
+    timings[q] = int(s[10])
+  return timings
+
+
+# path to this file
+thisfile = os.path.realpath(__file__)
+topdir = os.path.dirname(thisfile)
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-g", type=str, required=True, help="Path to directory with generator programs")
+parser.add_argument("-l", type=int, required=True, help="Maximum AM")
+parser.add_argument("-p", type=int, required=True, help="Start permuting the slow way when AM of a center reaches this value")
+parser.add_argument("-b", type=str, required=True, help="Basis set file (.mol) to benchmark with (see skel/test/dat)")
+parser.add_argument("-vec", type=str, required=True, help="Vectorization to build with (SIMINT_VECTOR, ie avx2, avx512)")
+parser.add_argument("-vt", type=int, nargs='+', default=[0, NEVER], help="Thresholds to try for -ve and -vg")
+parser.add_argument("-ht", type=int, nargs='+', default=[0, NEVER], help="Thresholds to try for -he and -hg")
+parser.add_argument("-r", type=int, default=3, help="Number of times to run each benchmark (the fastest is used)")
+parser.add_argument("-j", type=int, default=1, help="Number of parallel jobs for generating and building")
+parser.add_argument("-w", type=str, default="tune_work", help="Working directory")
+parser.add_argument("--cmake", type=str, nargs='*', default=[], help="Additional arguments to cmake (ie, -DCMAKE_C_COMPILER=icc)")
+parser.add_argument("outfile", type=str, help="Output file (per-quartet option table)")
+
+args = parser.parse_args()
+
+workdir = os.path.abspath(args.w)
+srcdir = os.path.join(workdir, "src")
+builddir = os.path.join(workdir, "build")
+logfile = os.path.join(workdir, "tune.log")
+basfile = os.path.abspath(args.b)
+
+if not os.path.isfile(basfile):
+  print("The file \"{}\" does not exist".format(basfile))
+  quit(1)
+
+os.makedirs(workdir, exist_ok=True)
+open(logfile, 'w').close()
+
+candidates = list(itertools.product(Candidates(args.vt), Candidates(args.ht)))
+
+print("-------------------------------")
+print("Tuning generator options")
+print("Maximum AM: {}".format(args.l))
+print("Basis: {}".format(basfile))
+print("Candidates: {}".format(len(candidates)))
+print("Log file: {}".format(logfile))
+print("-------------------------------")
+
+
+# timings[q][i] is the time for quartet q using candidate i
+timings = {}
+
+for i, ((ve, vg), (he, hg)) in enumerate(candidates):
+  opts = ["-ve", str(ve), "-vg", str(vg), "-he", str(he), "-hg", str(hg)]
+  print()
+  print("Candidate {} of {}: {}".format(i+1, len(candidates), ' '.join(opts)))
+
+  Run([sys.executable, os.path.join(topdir, "create.py"),
+       "-g", args.g, "-l", str(args.l), "-p", str(args.p), "-d", "0",
+       "-j", str(args.j), "-c", os.path.join(workdir, "cache")] + opts + [srcdir], logfile)
+
+  Run(["cmake", "-S", srcdir, "-B", builddir,
+       "-DCMAKE_BUILD_TYPE=Release",
+       "-DSIMINT_VECTOR={}".format(args.vec),
+       "-DSIMINT_MAXAM={}".format(args.l),
+       "-DSIMINT_MAXDER=0"] + args.cmake, logfile)
+
+  Run(["cmake", "--build", builddir, "--target", "benchmark_eri", "--", "-j{}".format(args.j)], logfile)
+
+  benchmark = os.path.join(builddir, "test", "benchmark_eri")
+  for r in range(args.r):
+    print("    {} {} {}".format(benchmark, basfile, args.l))
+    output = subprocess.check_output([benchmark, basfile, str(args.l)], universal_newlines=True)
+    for q, t in ParseBenchmark(output).items():
+      times = timings.setdefault(q, [None]*len(candidates))
+      if times[i] is None or t < times[i]:
+        times[i] = t
+
+
+# Pick the best candidate for each quartet and write the table
+with open(args.outfile, 'w') as f:
+  f.write("# Per-quartet generator options, created by tune.py\n")
+  f.write("# Basis: {}\n".format(os.path.basename(basfile)))
+  f.write("# Vectorization: {}\n".format(args.vec))
+  f.write("# am1 am2 am3 am4  options  # ticks(best) ticks(worst)\n")
+
+  print()
+  print("Results:")
+  for q in sorted(timings):
+    times = [ t if t is not None else float('inf') for t in timings[q] ]
+    best = times.index(min(times))
+    (ve, vg), (he, hg) = candidates[best]
+    line = "{} {} {} {}  -ve {} -vg {} -he {} -hg {}".format(q[0], q[1], q[2], q[3], ve, vg, he, hg)
+    print("  {}  {:>14} {:>14}".format(line, times[best], max(times)))
+    f.write("{}  # {} {}\n".format(line, times[best], max(times)))
+
+print()
+print("Option table written to {}".format(args.outfile))
+print("Use with create.py -t {}".format(args.outfile))